@@ -478,8 +478,11 @@ class WorkloadGenerator {
      * \param targetOps
      *      Throughput the workload should attempt to maintain; 0 means run at
      *      full throttle.
+     * \param seconds
+     *      If nonzero, return after running for this many seconds; 0 means
+     *      run until the data table is dropped.
      */
-    void run(uint64_t targetOps = 0)
+    void run(uint64_t targetOps = 0, double seconds = 0)
     {
         const uint16_t keyLen = 30;
         char key[keyLen];
@@ -501,6 +504,7 @@ class WorkloadGenerator {
         uint64_t nextStop = 0;
         uint64_t start = Cycles::rdtsc();
         uint64_t stop = 0;
+        uint64_t runCycles = Cycles::fromSeconds(seconds);
 
         try
         {
@@ -524,6 +528,9 @@ class WorkloadGenerator {
                 }
                 opCount++;
                 stop = Cycles::rdtsc();
+                if ((runCycles != 0) && (stop - start >= runCycles)) {
+                    break;
+                }
 
                 // throttle
                 if (targetNSPO > 0) {
@@ -7288,6 +7295,130 @@ workloadThroughput()
     }
 }
 
+// This benchmark ramps the load on a single server up and then back down,
+// by adding and then removing one client running the workload every
+// second, and reports the throughput, the cores used by worker threads,
+// and the latency of reads by an otherwise idle client at each step. It
+// shows how quickly the server adapts its worker cores (see the server's
+// --elasticWorkerCores option) and what that costs in tail latency.
+void
+workloadRamp()
+{
+    const double stepSeconds = 1.0;
+    if (clientIndex == 0) {
+        // This is the master client.
+        printf("# RAMCloud %s workload on a single server, with the offered\n"
+                "# load ramped up and then down one client at a time (one\n"
+                "# step per %.1f seconds). Latencies are for reads issued\n"
+                "# one at a time by one more client.\n",
+                workload.c_str(), stepSeconds);
+        printf("# Generated by 'clusterperf.py workloadRamp'\n");
+        printf("#\n");
+        printf("# numClients  throughput  worker     worker    read latency "
+                "(us)\n");
+        printf("#             (kops)      utiliz.    cores     median      "
+                "99%%\n");
+        printf("#--------------------------------------------------------"
+                "------------\n");
+
+        sendCommand("setup", "ready", 1, numClients-1);
+
+        const uint16_t keyLength = 30;
+        char key[keyLength];
+        memset(key, 0, keyLength);
+        string("workload").copy(key, 8);
+        Buffer value;
+        std::vector<uint64_t> ticks;
+
+        vector<int> steps;
+        for (int numSlaves = 1; numSlaves < numClients; numSlaves++) {
+            steps.push_back(numSlaves);
+        }
+        for (int numSlaves = numClients - 2; numSlaves >= 1; numSlaves--) {
+            steps.push_back(numSlaves);
+        }
+        foreach (int numSlaves, steps) {
+            sendCommand("run", "running", 1, numSlaves);
+
+            Buffer statsBuffer;
+            cluster->objectServerControl(dataTable, key, keyLength,
+                    WireFormat::ControlOp::GET_PERF_STATS, NULL, 0,
+                    &statsBuffer);
+            PerfStats startStats = *statsBuffer.getStart<PerfStats>();
+            ticks.clear();
+            uint64_t stop = Cycles::rdtsc() +
+                    Cycles::fromSeconds(0.9 * stepSeconds);
+            while (true) {
+                uint64_t start = Cycles::rdtsc();
+                if (start >= stop) {
+                    break;
+                }
+                cluster->read(dataTable, key, keyLength, &value);
+                ticks.push_back(Cycles::rdtsc() - start);
+            }
+            cluster->objectServerControl(dataTable, key, keyLength,
+                    WireFormat::ControlOp::GET_PERF_STATS, NULL, 0,
+                    &statsBuffer);
+            PerfStats finishStats = *statsBuffer.getStart<PerfStats>();
+            for (int slave = 1; slave <= numSlaves; slave++) {
+                waitSlave(slave, "idle", 2 * stepSeconds);
+            }
+
+            double elapsedCycles = static_cast<double>(
+                    finishStats.collectionTime - startStats.collectionTime);
+            double rate = static_cast<double>(finishStats.readCount +
+                    finishStats.writeCount -
+                    startStats.readCount -
+                    startStats.writeCount) /
+                    (elapsedCycles / finishStats.cyclesPerSecond);
+            double utilization = static_cast<double>(
+                    finishStats.workerActiveCycles -
+                    startStats.workerActiveCycles) / elapsedCycles;
+            double cores = static_cast<double>(
+                    finishStats.workerCoreCycles -
+                    startStats.workerCoreCycles) / elapsedCycles;
+            std::sort(ticks.begin(), ticks.end());
+            size_t count = ticks.size();
+            printf("%5d       %8.0f     %8.3f   %8.3f  %8.1f %8.1f\n",
+                    numSlaves, rate/1e03, utilization, cores,
+                    Cycles::toSeconds(ticks[count/2])*1e06,
+                    Cycles::toSeconds(ticks[count - 1 - count/100])*1e06);
+        }
+        cluster->dropTable("data");
+        sendCommand("done", "done", 1, numClients-1);
+    } else {
+        // Slaves execute the following code, which creates load by
+        // issuing individual workload requests for one step at a time.
+        WorkloadGenerator loadGenerator(workload);
+        while (true) {
+            char command[20];
+            getCommand(command, sizeof(command));
+            if (strcmp(command, "setup") == 0) {
+                if (clientIndex == 1) {
+                    // Setup need only be performed by one slave.
+                    loadGenerator.setup();
+                    setSlaveState("ready");
+                } else {
+                    // All other slaves should wait for setup to finish.
+                    sendCommand(NULL, "ready", 1, 1);
+                    setSlaveState("ready");
+                }
+            } else if (strcmp(command, "run") == 0) {
+                setSlaveState("running");
+                loadGenerator.run(static_cast<uint64_t>(targetOps),
+                        stepSeconds);
+                setSlaveState("idle");
+            } else if (strcmp(command, "done") == 0) {
+                setSlaveState("done");
+                return;
+            } else {
+                RAMCLOUD_LOG(ERROR, "unknown command %s", command);
+                return;
+            }
+        }
+    }
+}
+
 // The following struct and table define each performance test in terms of
 // a string name and a function that implements the test.
 struct TestInfo {
@@ -7337,6 +7468,7 @@ TestInfo tests[] = {
     {"writeDistWorkload", writeDistWorkload},
     {"writeInterference", writeInterference},
     {"writeThroughput", writeThroughput},
+    {"workloadRamp", workloadRamp},
     {"workloadThroughput", workloadThroughput},
 };
 
@@ -56,6 +56,7 @@ static bool  USE_DECAY_FOR_COST_BENEFIT = false;                // If true, use
 static bool  USE_LIFETIMES_WHEN_REPLAYING = false;              // If true and we're replaying a script, use actual lifetimes rather than estimates based on age.
 static double ROOT_EXP = 0.5;                                   // If TAKE_ROOT_OF_AGE is true, this is what age will be raised to.
 static double LOG_BASE = 2;                                     // If TAKE_LOG_OF_AGE is true, this is the base of our log.
+static int    HOT_WRITE_THRESHOLD = 0;                          // If > 0, objects recently written at least this many times go to a separate hot head.
 
 // -Counters-
 static size_t segmentsCleaned = 0; 
@@ -675,6 +676,57 @@ static int utilisation = 75;
 static Distribution* distribution;
 static Strategy* strategy;
 
+// Count-min sketch estimating how often each object has been written recently.
+// This mirrors RAMCloud's UpdateFrequencySketch, which picks the objects that
+// go to the hot log head when the master's segregateHotWrites option is set.
+class UpdateFrequencySketch {
+  public:
+    enum { ROWS = 4, COUNTERS_PER_ROW = 16384 };
+
+    UpdateFrequencySketch()
+        : updatesSinceAging(0)
+    {
+        memset(counters, 0, sizeof(counters));
+    }
+
+    // Note a write of the given object and return true if it is now hot.
+    bool
+    recordUpdate(int id, int threshold)
+    {
+        static const uint64_t multipliers[ROWS] = {
+            0x9e3779b97f4a7c15UL, 0xc2b2ae3d27d4eb4fUL,
+            0x165667b19e3779f9UL, 0xd6e8feb86659fd93UL
+        };
+        int indexes[ROWS];
+        int min = 255;
+        for (int row = 0; row < ROWS; row++) {
+            indexes[row] = (int)((((uint64_t)id * multipliers[row]) >> 32) % COUNTERS_PER_ROW);
+            min = std::min(min, (int)counters[row][indexes[row]]);
+        }
+        if (min < 255) {
+            for (int row = 0; row < ROWS; row++) {
+                if (counters[row][indexes[row]] == min)
+                    counters[row][indexes[row]]++;
+            }
+            min++;
+        }
+        if (++updatesSinceAging >= 10 * COUNTERS_PER_ROW) {
+            for (int row = 0; row < ROWS; row++) {
+                for (int i = 0; i < COUNTERS_PER_ROW; i++)
+                    counters[row][i] /= 2;
+            }
+            updatesSinceAging = 0;
+        }
+        return min >= threshold;
+    }
+
+    int updatesSinceAging;
+    uint8_t counters[ROWS][COUNTERS_PER_ROW];
+};
+
+static UpdateFrequencySketch updateFrequencies;
+static size_t hotObjectsWritten = 0;
+
 class Utilisations {
   public:
     Utilisations()
@@ -1014,6 +1066,7 @@ usage()
     fprintf(stderr, "  -d hotAndCold|uniform|    (the access distribution)\n");
     fprintf(stderr, "       exponential|zipfian\n");
     fprintf(stderr, "  -D                        (use segment decay rate in cost-benefit strategy)\n");
+    fprintf(stderr, "  -H threshold              (write objects recently written >= threshold times to a separate hot head)\n");
     fprintf(stderr, "  -o scriptFile             (dump the full list of object ids written here)\n");
     fprintf(stderr, "  -i scriptFile             (replay the given script of object writes)\n");
     fprintf(stderr, "  -l                        (if replaying from script, use actual object lifetimes in cleaning)\n");
@@ -1034,13 +1087,14 @@ main(int argc, char** argv)
 	std::vector<Segment*> activeList;
 	std::vector<ObjectReference> objectToSegment;
 	Segment* head = NULL;
+	Segment* hotHead = NULL;
     FILE* outScriptFile = NULL;
     FILE* inScriptFile = NULL;
     std::vector<int> writes;
 
     memset(objectWriteCounts, 0, sizeof(objectWriteCounts));
 
-    for (int ch; (ch = getopt(argc, argv, "aAd:Do:i:lL:rRs:S:tu:")) != -1;) {
+    for (int ch; (ch = getopt(argc, argv, "aAd:DH:o:i:lL:rRs:S:tu:")) != -1;) {
         switch (ch) {
         case 'a':
             ORDER_SEGMENTS_BY_MIN_AGE = false;
@@ -1064,6 +1118,11 @@ main(int argc, char** argv)
         case 'D':
             USE_DECAY_FOR_COST_BENEFIT = true;
             break;
+        case 'H':
+            HOT_WRITE_THRESHOLD = atoi(optarg);
+            if (HOT_WRITE_THRESHOLD < 1 || HOT_WRITE_THRESHOLD > 255)
+                usage();
+            break;
         case 'o':
             outScriptFile = fopen(optarg, "w");
             if (outScriptFile == NULL) {
@@ -1152,6 +1211,7 @@ main(int argc, char** argv)
     printf("# USE_RAMCLOUD_COST_BENEFIT = %s\n", (USE_RAMCLOUD_COST_BENEFIT) ? "true" : "false");
     printf("# USE_DECAY_FOR_COST_BENEFIT = %s\n", (USE_DECAY_FOR_COST_BENEFIT) ? "true" : "false");
     printf("# USE_LIFETIMES_WHEN_REPLAYING = %s\n", (USE_LIFETIMES_WHEN_REPLAYING) ? "true" : "false");
+    printf("# HOT_WRITE_THRESHOLD = %d\n", HOT_WRITE_THRESHOLD);
     printf("##################################\n");
 
 	const int liveDataSegments = TOTAL_LIVE_OBJECTS / OBJECTS_PER_SEGMENT;
@@ -1174,30 +1234,37 @@ main(int argc, char** argv)
 
     time_t startTime = time(NULL);
 	while (true) {
-		if (head != NULL && head->full()) {
-			activeList.push_back(head);
-			head = NULL;
-		}
-			
-		if (head == NULL) {
+        int lifetime = -1;
+		int obj = nextObject(inScriptFile, &lifetime);
+        if (obj == -1)
+            break;
+
+        // With -H, objects that are being overwritten often get a head of
+        // their own, so their segments die together.
+        bool hot = HOT_WRITE_THRESHOLD > 0 &&
+                   updateFrequencies.recordUpdate(obj, HOT_WRITE_THRESHOLD);
+        if (hot)
+            hotObjectsWritten++;
+        Segment*& target = hot ? hotHead : head;
+
+		while (target == NULL || target->full()) {
+			if (target != NULL) {
+				activeList.push_back(target);
+				target = NULL;
+			}
 			if (freeList.empty()) {
-				head = clean(activeList, freeList, objectToSegment);
-				// It's possible that the head is full, so just continue.
-				continue;
+				// It's possible that the new head is full (or NULL), so
+				// check again.
+				target = clean(activeList, freeList, objectToSegment);
 			} else {
-				head = freeList.back();
+				target = freeList.back();
 				freeList.pop_back();
 			}
 		}
 
-        int lifetime = -1;
-		int obj = nextObject(inScriptFile, &lifetime);
-        if (obj == -1)
-            break;
-
 		if (objectToSegment[obj].segment != NULL)
 			objectToSegment[obj].segment->free(&objectToSegment[obj]);
-		objectToSegment[obj] = head->append(obj, currentTimestamp++, lifetime);
+		objectToSegment[obj] = target->append(obj, currentTimestamp++, lifetime);
         objectWriteCounts[obj]++;
         newObjectsWritten++;
 
@@ -1226,13 +1293,15 @@ main(int argc, char** argv)
             }
 		}
 
-        assert((activeList.size() + freeList.size() + 1) == totalSegments);
+        assert((activeList.size() + freeList.size() + (head != NULL) +
+                (hotHead != NULL)) == totalSegments);
 	}
 
 	fprintf(stderr, "\nDone!\n");
 
     printf("# Total simulation time = %d seconds\n", (int)(time(NULL) - startTime));
     printf("# New object writes = %zd\n", newObjectsWritten);
+    printf("# New object writes to hot head = %zd\n", hotObjectsWritten);
     printf("# Survivor objects written by cleaner = %zd\n", cleanerObjectsWritten);
     printf("# LFS write cost = %.3f\n", lfsWriteCost());
     printf("# Cleaning passes = %zd\n", cleaningPasses);
@@ -112,7 +112,7 @@ class CleanerCompactionBenchmark {
             }
             nextKeyVal++;
             numObjects++;
-        } while (objectManager->log.head->id <= numSegments);
+        } while (objectManager->log.heads[0].segment->id <= numSegments);
 
         /*
          * Delete 10% of the objects we just added at random.
@@ -43,13 +43,44 @@ class TestObject {
     uint64_t key;
 } __attribute__((aligned(64)));
 
+/**
+ * HashTable::KeyHashFunction for tables whose references point to
+ * TestObjects. Needed to resize the table.
+ */
+KeyHash
+testObjectKeyHash(uint64_t reference, void* cookie)
+{
+    TestObject* object = reinterpret_cast<TestObject*>(reference);
+    Key key(0, &object->key, sizeof(object->key));
+    return key.getHash();
+}
+
+/**
+ * Look up the TestObject with the given key and return whether it was found.
+ */
+bool
+lookupTestObject(HashTable& ht, uint64_t i)
+{
+    Key key(0, &i, sizeof(i));
+    HashTable::Candidates c;
+    ht.lookup(key.getHash(), c);
+    while (!c.isDone()) {
+        TestObject* candidateObject =
+            reinterpret_cast<TestObject*>(c.getReference());
+        if (candidateObject->key == i)
+            return true;
+        c.next();
+    }
+    return false;
+}
+
 } // anonymous namespace
 
 void
 hashTableBenchmark(uint64_t nkeys, uint64_t nlines)
 {
     uint64_t i;
-    HashTable ht(nlines);
+    HashTable ht(nlines, testObjectKeyHash);
     LargeBlockOfMemory<TestObject> block(nkeys * sizeof(TestObject));
     TestObject* values = block.get();
     assert(nlines == ht.numBuckets);
@@ -180,6 +211,121 @@ hashTableBenchmark(uint64_t nkeys, uint64_t nlines)
 
     free(histogram);
     histogram = NULL;
+
+    // Compare the ways of matching secondary hashes within a cache line,
+    // for keys that are present and keys that aren't.
+    struct {
+        HashTable::MatchImplementation implementation;
+        const char* name;
+    } matchers[] = {
+        { HashTable::MATCH_SCALAR, "scalar" },
+        { HashTable::MATCH_SSE42, "SSE4.2" },
+        { HashTable::MATCH_AVX2, "AVX2" },
+    };
+    HashTable::MatchImplementation defaultMatcher =
+        HashTable::getMatchImplementation();
+    printf("== secondary hash matching ==\n");
+    for (size_t m = 0; m < arrayLength(matchers); m++) {
+        if (!HashTable::setMatchImplementation(matchers[m].implementation)) {
+            printf("    %s: not supported on this machine\n",
+                   matchers[m].name);
+            continue;
+        }
+
+        uint64_t hitCycles = Cycles::rdtsc();
+        for (i = 0; i < nkeys; i++) {
+            bool success = lookupTestObject(ht, i);
+            _unused(success);
+            assert(success);
+        }
+        hitCycles = Cycles::rdtsc() - hitCycles;
+
+        uint64_t missCycles = Cycles::rdtsc();
+        for (i = nkeys; i < 2 * nkeys; i++) {
+            bool success = lookupTestObject(ht, i);
+            _unused(success);
+            assert(!success);
+        }
+        missCycles = Cycles::rdtsc() - missCycles;
+
+        printf("    %s%s: hit avg %lu ticks, %lu nsec; "
+               "miss avg %lu ticks, %lu nsec\n",
+               matchers[m].name,
+               matchers[m].implementation == defaultMatcher ?
+                    " (default)" : "",
+               hitCycles / nkeys, Cycles::toNanoseconds(hitCycles / nkeys),
+               missCycles / nkeys, Cycles::toNanoseconds(missCycles / nkeys));
+    }
+    HashTable::setMatchImplementation(defaultMatcher);
+
+    // Now double the size of the table the way the master does it online:
+    // rehash one old bucket at a time, with lookups interleaved between
+    // steps, and compare lookup latency to the numbers above.
+    printf("Starting resize in 3 seconds (get your measurements ready!)\n");
+    sleep(3);
+    printf("running lookup measurements during resize...");
+    fflush(stdout);
+
+    uint64_t prepareCycles = Cycles::rdtsc();
+    ht.prepareResize(nlines * 2);
+    prepareCycles = Cycles::rdtsc() - prepareCycles;
+    uint64_t startCycles = Cycles::rdtsc();
+    ht.startResize();
+    startCycles = Cycles::rdtsc() - startCycles;
+
+    // Spread nkeys lookups evenly across the rehash steps.
+    uint64_t lookupsPerBucket = std::max(nkeys / nlines, 1UL);
+    uint64_t rehashCycles = 0;
+    uint64_t maxLookupCycles = 0;
+    uint64_t nlookups = 0;
+    lookupCycles = 0;
+    for (uint64_t b = 0; b < nlines; b++) {
+        for (uint64_t j = 0; j < lookupsPerBucket; j++) {
+            uint64_t key = (b * lookupsPerBucket + j) % nkeys;
+            uint64_t start = Cycles::rdtsc();
+            bool success = lookupTestObject(ht, key);
+            uint64_t elapsed = Cycles::rdtsc() - start;
+            _unused(success);
+            assert(success);
+            lookupCycles += elapsed;
+            maxLookupCycles = std::max(maxLookupCycles, elapsed);
+            nlookups++;
+        }
+
+        uint64_t start = Cycles::rdtsc();
+        ht.rehashBucket(b);
+        rehashCycles += Cycles::rdtsc() - start;
+    }
+    uint64_t finishCycles = Cycles::rdtsc();
+    ht.finishResize();
+    finishCycles = Cycles::rdtsc() - finishCycles;
+    printf("done!\n");
+
+    printf("== resize from %lu to %lu lines ==\n", nlines, nlines * 2);
+    printf("    prepareResize(): %lu usec\n",
+           Cycles::toMicroseconds(prepareCycles));
+    printf("    startResize(): %lu nsec\n",
+           Cycles::toNanoseconds(startCycles));
+    printf("    rehashBucket() avg: %lu ticks, %lu nsec\n",
+           rehashCycles / nlines,
+           Cycles::toNanoseconds(rehashCycles / nlines));
+    printf("    finishResize(): %lu usec\n",
+           Cycles::toMicroseconds(finishCycles));
+    printf("    lookup() during resize avg: %lu ticks, %lu nsec "
+           "(max %lu nsec, %lu lookups)\n",
+           lookupCycles / nlookups,
+           Cycles::toNanoseconds(lookupCycles / nlookups),
+           Cycles::toNanoseconds(maxLookupCycles), nlookups);
+
+    lookupCycles = Cycles::rdtsc();
+    for (i = 0; i < nkeys; i++) {
+        bool success = lookupTestObject(ht, i);
+        _unused(success);
+        assert(success);
+    }
+    i = Cycles::rdtsc() - lookupCycles;
+    printf("    lookup() after resize avg: %lu ticks, %lu nsec\n",
+           i / nkeys, Cycles::toNanoseconds(i / nkeys));
 }
 
 } // namespace RAMCloud
@@ -84,29 +84,48 @@ class ObjectManagerBenchmark {
         delete objectManager;
     }
 
+    /**
+     * Read random objects, batchSize at a time (like a MultiRead would).
+     * If prefetch is true, each batch is first passed to
+     * ObjectManager::prefetchObjects.
+     */
     static void
     readerThreadEntry(ObjectManager* objectManager,
                       uint32_t numReads,
                       uint64_t numKeys,
+                      uint32_t batchSize,
+                      bool prefetch,
                       std::atomic<uint32_t>* startFlag,
                       std::atomic<uint32_t>* stopCount)
     {
+        std::vector<uint64_t> keyInts(batchSize);
+        std::vector<KeyHash> keyHashes(batchSize);
+
         while (*startFlag == 0) {
             // wait until master thread releases us
         }
 
-        for (uint32_t i = 0; i < numReads; i++) {
-            uint64_t keyInt = generateRandom() % numKeys;
-            Key key(0, &keyInt, sizeof(keyInt));
-            Buffer buffer;
-            objectManager->readObject(key, &buffer, NULL, NULL);
+        for (uint32_t i = 0; i < numReads; i += batchSize) {
+            for (uint32_t j = 0; j < batchSize; j++) {
+                keyInts[j] = generateRandom() % numKeys;
+                keyHashes[j] = Key::getHash(0, &keyInts[j],
+                                            sizeof(keyInts[j]));
+            }
+            if (prefetch)
+                objectManager->prefetchObjects(&keyHashes[0], batchSize);
+            for (uint32_t j = 0; j < batchSize; j++) {
+                Key key(0, &keyInts[j], sizeof(keyInts[j]));
+                Buffer buffer;
+                objectManager->readObject(key, &buffer, NULL, NULL);
+            }
         }
 
         (*stopCount)++;
     }
 
     double
-    run(uint32_t numSegments, uint32_t dataBytes, uint32_t numThreads)
+    run(uint32_t numSegments, uint32_t dataBytes, uint32_t numThreads,
+        uint32_t batchSize = 1, bool prefetch = false)
     {
         tabletManager.addTablet(0, 0, ~0UL, TabletManager::NORMAL);
 
@@ -127,7 +146,7 @@ class ObjectManagerBenchmark {
                 exit(1);
             }
             nextKeyVal++;
-        } while (objectManager->log.head->id <= numSegments);
+        } while (objectManager->log.heads[0].segment->id <= numSegments);
 
         /*
          * Now "read" a bunch of random objects.
@@ -141,6 +160,8 @@ class ObjectManagerBenchmark {
                                          objectManager,
                                          numReads,
                                          nextKeyVal,
+                                         batchSize,
+                                         prefetch,
                                          &startFlag,
                                          &stopCount);
         }
@@ -191,5 +212,14 @@ main()
             (readsPerSec / oneThreadRate) / threads[i] * 100);
     }
 
+    printf("========= 100-byte Objects, 20-object batches =========\n");
+    for (int prefetch = 0; prefetch <= 1; prefetch++) {
+        RAMCloud::ObjectManagerBenchmark omb("2048", "10%");
+        double readsPerSec = omb.run(numSegments, 100, 1, 20, prefetch);
+        printf(" %s: %.2f reads/s, %.3f us/read\n",
+            prefetch ? "with prefetchObjects" : "without prefetching",
+            readsPerSec, 1.0e6 / readsPerSec);
+    }
+
     return 0;
 }
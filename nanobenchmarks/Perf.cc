@@ -56,8 +56,10 @@
 #include "Common.h"
 #include "Atomic.h"
 #include "Cycles.h"
+#include "Crc32C.h"
 #include "CycleCounter.h"
 #include "Dispatch.h"
+#include "DispatchPool.h"
 #include "Fence.h"
 #include "LockTable.h"
 #include "Logger.h"
@@ -1137,6 +1139,41 @@ double cppAtomicLoad()
     return Cycles::toSeconds(stop - start)/count;
 }
 
+// Measure the cost of computing a CRC32C checksum over a given number
+// of (cached) bytes.
+double crc32CShared(uint32_t length)
+{
+    int count = downCast<int>(std::max(10UL, 100000000UL / length));
+    char* buf = static_cast<char*>(malloc(length));
+    memset(buf, 'x', length);
+    uint32_t total = 0;
+    uint64_t start = Cycles::rdtscp();
+    for (int i = 0; i < count; i++) {
+        Crc32C crc;
+        crc.update(buf, length);
+        total += crc.getResult();
+    }
+    uint64_t stop = Cycles::rdtscp();
+    free(buf);
+    discard(&total);
+    return Cycles::toSeconds(stop - start)/count;
+}
+
+double crc32C100()
+{
+    return crc32CShared(100);
+}
+
+double crc32C1000()
+{
+    return crc32CShared(1000);
+}
+
+double crc32C8M()
+{
+    return crc32CShared(8 * 1024 * 1024);
+}
+
 // Measure the cost of gcc's  __builtin_clzll, which counts the number of
 // leading zeroes in a word.
 double clzll()
@@ -1170,6 +1207,74 @@ double dispatchPoll()
     return Cycles::toSeconds(stop - start)/count;
 }
 
+// Timer used by the dispatchTimer benchmarks: counts its invocations.
+class CountingTimer : public Dispatch::Timer {
+  public:
+    explicit CountingTimer(Dispatch* dispatch)
+        : Dispatch::Timer(dispatch), count(0) {}
+    void handleTimerEvent() { count++; }
+    int count;
+};
+
+// Measure the cost of Dispatch::poll when it fires 10,000 timers whose
+// trigger times are spread over about 1M cycles (the cost is given per
+// timer, and includes finding the timers and invoking their handlers).
+double dispatchTimerExpire10k()
+{
+    int numTimers = 10000;
+    int rounds = 100;
+    Dispatch dispatch(false);
+    std::vector<CountingTimer*> timers;
+    for (int i = 0; i < numTimers; i++) {
+        timers.push_back(new CountingTimer(&dispatch));
+    }
+    uint64_t total = 0;
+    for (int round = 0; round < rounds; round++) {
+        uint64_t base = Cycles::rdtsc();
+        for (int i = 0; i < numTimers; i++) {
+            timers[i]->start(base + 100lu*((i*7919) % numTimers));
+        }
+        while (Cycles::rdtsc() <= base + 100lu*numTimers) {
+            /* Wait for all of the timers to become due. */
+        }
+        uint64_t start = Cycles::rdtscp();
+        dispatch.poll();
+        total += Cycles::rdtscp() - start;
+    }
+    for (int i = 0; i < numTimers; i++) {
+        if (timers[i]->count != rounds) {
+            printf("dispatchTimerExpire10k: timer %d fired %d times\n",
+                    i, timers[i]->count);
+        }
+        delete timers[i];
+    }
+    return Cycles::toSeconds(total)/(rounds*numTimers);
+}
+
+// Measure the cost of restarting a Dispatch::Timer when 10,000 timers
+// are running.
+double dispatchTimerRestart10k()
+{
+    int numTimers = 10000;
+    int count = 1000000;
+    Dispatch dispatch(false);
+    std::vector<CountingTimer*> timers;
+    uint64_t base = Cycles::rdtsc() + Cycles::fromSeconds(1000.0);
+    for (int i = 0; i < numTimers; i++) {
+        timers.push_back(new CountingTimer(&dispatch));
+        timers[i]->start(base + 1000lu*((i*7919) % numTimers));
+    }
+    uint64_t start = Cycles::rdtscp();
+    for (int i = 0; i < count; i++) {
+        timers[i % numTimers]->start(base + 997lu*(i % 12345));
+    }
+    uint64_t stop = Cycles::rdtscp();
+    for (int i = 0; i < numTimers; i++) {
+        delete timers[i];
+    }
+    return Cycles::toSeconds(stop - start)/count;
+}
+
 // Measure the cost of a 32-bit divide. Divides don't take a constant
 // number of cycles. Values were chosen here semi-randomly to depict a
 // fairly expensive scenario. Someone with fancy ALU knowledge could
@@ -1364,6 +1469,67 @@ double hashTableLookup()
     return Cycles::toSeconds((stop - start) / numLookups);
 }
 
+// Measure the cost of probing a small (cache-resident) HashTable at a high
+// load factor, isolating the cost of matching secondary hashes within each
+// cache line. The template arguments select the matching implementation
+// and whether the keys looked up are present (hits) or absent (misses).
+template<HashTable::MatchImplementation implementation, bool hit>
+double hashTableProbe()
+{
+    uint64_t numBuckets = 1024;
+    // Leave room for one chain pointer per bucket: about 7/8 full.
+    uint64_t numKeys = numBuckets * (HashTable::entriesPerCacheLine() - 1);
+    int count = 10;
+    HashTable hashTable(numBuckets);
+    HashTable::Candidates candidates;
+
+    HashTable::MatchImplementation original =
+            HashTable::getMatchImplementation();
+    if (!HashTable::setMatchImplementation(implementation)) {
+        printf("hashTableProbe: implementation %d not supported on "
+               "this machine\n", implementation);
+        return 0;
+    }
+
+    std::vector<uint64_t> objects(numKeys);
+    for (uint64_t i = 0; i < numKeys; i++) {
+        objects[i] = i;
+        Key key(0, &objects[i], downCast<uint16_t>(sizeof(objects[i])));
+        hashTable.insert(key.getHash(), reinterpret_cast<uint64_t>(
+                &objects[i]));
+    }
+
+    // Hash the keys up front so that only the probes are timed.
+    uint64_t firstKey = hit ? 0 : numKeys;
+    std::vector<KeyHash> hashes(numKeys);
+    for (uint64_t i = 0; i < numKeys; i++) {
+        uint64_t k = firstKey + i;
+        hashes[i] = Key(0, &k, downCast<uint16_t>(sizeof(k))).getHash();
+    }
+
+    uint64_t found = 0;
+    uint64_t start = Cycles::rdtscp();
+    for (int c = 0; c < count; c++) {
+        for (uint64_t i = 0; i < numKeys; i++) {
+            hashTable.lookup(hashes[i], candidates);
+            while (!candidates.isDone()) {
+                if (*reinterpret_cast<uint64_t*>(
+                        candidates.getReference()) == firstKey + i) {
+                    found++;
+                    break;
+                }
+                candidates.next();
+            }
+        }
+    }
+    uint64_t stop = Cycles::rdtscp();
+    HashTable::setMatchImplementation(original);
+    if (found != (hit ? numKeys * count : 0))
+        printf("hashTableProbe: unexpected number of hits: %lu\n", found);
+    return Cycles::toSeconds(stop - start) /
+           static_cast<double>(numKeys * count);
+}
+
 // Measure the cost of an lfence instruction.
 double lfence()
 {
@@ -1882,6 +2048,63 @@ double rdtscTest()
     return Cycles::toSeconds(stop - start)/count;
 }
 
+// Rings used by rpcRingHandoff.
+typedef DispatchThread::RpcRing HandoffRing;
+
+// This function runs the second thread for rpcRingHandoff: it passes
+// each value it receives back to the first thread.
+void rpcRingHandoffWorker(HandoffRing* in, HandoffRing* out)
+{
+    pinThread(core2);
+    while (1) {
+        Transport::ServerRpc* value = in->get();
+        if (value == NULL) {
+            continue;
+        }
+        if (value == reinterpret_cast<Transport::ServerRpc*>(1)) {
+            return;
+        }
+        while (!out->put(value)) {
+            /* Retry until there's room. */
+        }
+    }
+}
+
+// Measure the round-trip time for passing an RPC from one thread to
+// another and back through a pair of RpcRings (the single-producer,
+// single-consumer handoff between a DispatchThread and the main dispatch
+// thread).
+double rpcRingHandoff()
+{
+    int count = 1000000;
+    HandoffRing* toWorker = new HandoffRing;
+    HandoffRing* fromWorker = new HandoffRing;
+    std::thread thread(rpcRingHandoffWorker, toWorker, fromWorker);
+    pinThread(core1);
+
+    uint64_t start = 0;
+    for (int i = -10; i < count; i++) {
+        if (i == 0) {
+            // Restart the timing after the test has been running
+            // for a while, so everything is warmed up.
+            start = Cycles::rdtscp();
+        }
+        // The values are never dereferenced; 1 tells the worker to exit.
+        toWorker->put(reinterpret_cast<Transport::ServerRpc*>(
+                static_cast<uintptr_t>(i + 20)));
+        while (fromWorker->get() == NULL) {
+            /* Wait for the value to come back. */
+        }
+    }
+    uint64_t stop = Cycles::rdtscp();
+    toWorker->put(reinterpret_cast<Transport::ServerRpc*>(1));
+    thread.join();
+    unpinThread();
+    delete toWorker;
+    delete fromWorker;
+    return Cycles::toSeconds(stop - start)/count;
+}
+
 // Sorting functor for #segmentEntrySort.
 struct SegmentEntryLessThan {
   public:
@@ -2404,6 +2627,12 @@ TestInfo tests[] = {
      "Exchange method on a C++ atomic_int"},
     {"cppAtomicLoad", cppAtomicLoad,
      "Read a C++ atomic_int"},
+    {"crc32C100", crc32C100,
+     "Compute a CRC32C checksum over 100 bytes"},
+    {"crc32C1000", crc32C1000,
+     "Compute a CRC32C checksum over 1000 bytes"},
+    {"crc32C8M", crc32C8M,
+     "Compute a CRC32C checksum over 8 MB (one segment)"},
     {"cyclesToSeconds", perfCyclesToSeconds,
      "Convert a rdtsc result to (double) seconds"},
     {"cyclesToNanos", perfCyclesToNanoseconds,
@@ -2412,6 +2641,10 @@ TestInfo tests[] = {
     "Find the number of leading 0-bits"},
     {"dispatchPoll", dispatchPoll,
      "Dispatch::poll (no timers or pollers)"},
+    {"dispatchTimerExpire10k", dispatchTimerExpire10k,
+     "Dispatch::poll firing 10,000 timers (per timer)"},
+    {"dispatchTimerRestart10k", dispatchTimerRestart10k,
+     "Restart one of 10,000 running Dispatch::Timers"},
     {"div32", div32,
      "32-bit integer division instruction"},
     {"div64", div64,
@@ -2432,6 +2665,18 @@ TestInfo tests[] = {
      "Key lookup in a 1GB HashTable"},
     {"hashTableLookupPf", hashTableLookup<20>,
      "Key lookup in a 1GB HashTable with prefetching"},
+    {"hashTableProbeHit", hashTableProbe<HashTable::MATCH_SCALAR, true>,
+     "HashTable hit, 7/8 full, scalar matching"},
+    {"hashTableProbeHit", hashTableProbe<HashTable::MATCH_SSE42, true>,
+     "HashTable hit, 7/8 full, SSE4.2 matching"},
+    {"hashTableProbeHit", hashTableProbe<HashTable::MATCH_AVX2, true>,
+     "HashTable hit, 7/8 full, AVX2 matching"},
+    {"hashTableProbeMiss", hashTableProbe<HashTable::MATCH_SCALAR, false>,
+     "HashTable miss, 7/8 full, scalar matching"},
+    {"hashTableProbeMiss", hashTableProbe<HashTable::MATCH_SSE42, false>,
+     "HashTable miss, 7/8 full, SSE4.2 matching"},
+    {"hashTableProbeMiss", hashTableProbe<HashTable::MATCH_AVX2, false>,
+     "HashTable miss, 7/8 full, AVX2 matching"},
     {"lfence", lfence,
      "Lfence instruction"},
     {"lockInDispThrd", lockInDispThrd,
@@ -2482,6 +2727,8 @@ TestInfo tests[] = {
      "Generate 64-bit random number (Arachne version)"},
     {"rdtsc", rdtscTest,
      "Read the fine-grain cycle counter"},
+    {"rpcRingHandoff", rpcRingHandoff,
+     "Round-trip handoff between 2 threads via DispatchThread RpcRings"},
     {"segmentEntrySort", segmentEntrySort,
      "Sort a Segment full of avg. 100-byte Objects by age"},
     {"segmentIterator", segmentIterator<50, 150>,
@@ -19,6 +19,7 @@
 #include "MasterService.h"
 #include "Memory.h"
 #include "SegmentIterator.h"
+#include "SegmentReplayer.h"
 #include "Seglet.h"
 #include "Tablets.pb.h"
 #include "Util.h"
@@ -34,6 +35,7 @@ class RecoverSegmentBenchmark {
     MasterService* service;
     size_t numSegments;
     bool hwThreadsBeforeCores;
+    bool useReplayer;
 
     std::atomic<size_t> next;
     std::vector<Segment*> segments;
@@ -45,13 +47,15 @@ class RecoverSegmentBenchmark {
         string logSize,
         string hashTableSize,
         size_t numSegments,
-        bool hwThreadsBeforeCores)
+        bool hwThreadsBeforeCores,
+        bool useReplayer)
         : context()
         , config(ServerConfig::forTesting())
         , serverList(&context)
         , service(NULL)
         , numSegments{numSegments}
         , hwThreadsBeforeCores{hwThreadsBeforeCores}
+        , useReplayer{useReplayer}
         , next{}
         , segments{}
         , nReady{}
@@ -119,6 +123,31 @@ class RecoverSegmentBenchmark {
         sideLog.commit();
     }
 
+    /**
+     * Replay all of the segments the way a recovery master does: handing
+     * each one to a SegmentReplayer as if it had just arrived from a backup.
+     *
+     * \return
+     *      Number of cycles taken to replay and commit everything.
+     */
+    uint64_t
+    replayWithReplayer(size_t nThreads)
+    {
+        SegmentReplayer replayer(&service->objectManager,
+                downCast<uint32_t>(nThreads));
+
+        uint64_t before = Cycles::rdtsc();
+        for (size_t i = 0; i < numSegments; i++) {
+            Buffer* buffer = new Buffer();
+            segments[i]->appendToBuffer(*buffer);
+            SegmentCertificate certificate;
+            segments[i]->getAppendedLength(&certificate);
+            replayer.replay(buffer, certificate, i);
+        }
+        replayer.commit();
+        return Cycles::rdtsc() - before;
+    }
+
     void
     run(uint32_t dataLen, size_t nThreads)
     {
@@ -178,29 +207,37 @@ class RecoverSegmentBenchmark {
         /*
          * Now run a fake recovery.
          */
-        std::deque<std::thread> threads{};
-        for (size_t i = 0; i < nThreads; ++i)
-            threads.emplace_back(&RecoverSegmentBenchmark::doReplay, this, i);
+        uint64_t ticks;
+        if (useReplayer) {
+            ticks = replayWithReplayer(nThreads);
+        } else {
+            std::deque<std::thread> threads{};
+            for (size_t i = 0; i < nThreads; ++i) {
+                threads.emplace_back(&RecoverSegmentBenchmark::doReplay,
+                                     this, i);
+            }
 
-        while (nReady < nThreads)
-            usleep(100);
-        go = true;
+            while (nReady < nThreads)
+                usleep(100);
+            go = true;
 
-        uint64_t before = Cycles::rdtsc();
+            uint64_t before = Cycles::rdtsc();
 
-        while (nDone < nThreads)
-            usleep(10000);
+            while (nDone < nThreads)
+                usleep(10000);
 
-        uint64_t ticks = Cycles::rdtsc() - before;
+            ticks = Cycles::rdtsc() - before;
 
-        for (auto& thread : threads)
-            thread.join();
+            for (auto& thread : threads)
+                thread.join();
+        }
 
         uint64_t totalObjectBytes = numObjects * dataLen;
         uint64_t totalSegmentBytes = uint64_t(numSegments) *
                                      Segment::DEFAULT_SEGMENT_SIZE;
 
-        printf("%lu threads\n", nThreads);
+        printf("%lu threads%s\n", nThreads,
+               useReplayer ? " (SegmentReplayer)" : "");
         printf("Recovery of %lu %uKB Segments with %u byte Objects took %lu "
             "ms\n", numSegments, Segment::DEFAULT_SEGMENT_SIZE / 1024,
             dataLen, RAMCloud::Cycles::toNanoseconds(ticks) / 1000 / 1000);
@@ -272,9 +309,10 @@ main(int argc, char* argv[])
     std::vector<uint32_t> dataLen{ 64, 128, 256, 512, 1024, 2048, 8192 };
     std::vector<size_t> nThreads{ 1, 2, 4, 8, 16 };
     bool hwThreadsBeforeCores = false;
+    bool useReplayer = false;
 
     int c;
-    while ((c = getopt(argc, argv, "t:s:h")) != -1) {
+    while ((c = getopt(argc, argv, "t:s:hr")) != -1) {
       switch (c) {
         case 't':
           nThreads.clear();
@@ -287,6 +325,10 @@ main(int argc, char* argv[])
         case 'h':
           hwThreadsBeforeCores = true;
           break;
+        case 'r':
+          // Replay through SegmentReplayer, as a recovery master would.
+          useReplayer = true;
+          break;
       }
     }
 
@@ -295,7 +337,8 @@ main(int argc, char* argv[])
             printf("==========================\n");
             RAMCloud::RecoverSegmentBenchmark rsb{"8192", "10%",
                                                   numSegments,
-                                                  hwThreadsBeforeCores};;
+                                                  hwThreadsBeforeCores,
+                                                  useReplayer};
             rsb.run(len, threads);
         }
     }
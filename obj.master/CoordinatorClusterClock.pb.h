@@ -0,0 +1,272 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: CoordinatorClusterClock.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_CoordinatorClusterClock_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_CoordinatorClusterClock_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_CoordinatorClusterClock_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_CoordinatorClusterClock_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_CoordinatorClusterClock_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class CoordinatorClusterClock;
+struct CoordinatorClusterClockDefaultTypeInternal;
+extern CoordinatorClusterClockDefaultTypeInternal _CoordinatorClusterClock_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::CoordinatorClusterClock* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::CoordinatorClusterClock>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class CoordinatorClusterClock final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.CoordinatorClusterClock) */ {
+ public:
+  inline CoordinatorClusterClock() : CoordinatorClusterClock(nullptr) {}
+  ~CoordinatorClusterClock() override;
+  explicit PROTOBUF_CONSTEXPR CoordinatorClusterClock(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CoordinatorClusterClock(const CoordinatorClusterClock& from);
+  CoordinatorClusterClock(CoordinatorClusterClock&& from) noexcept
+    : CoordinatorClusterClock() {
+    *this = ::std::move(from);
+  }
+
+  inline CoordinatorClusterClock& operator=(const CoordinatorClusterClock& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CoordinatorClusterClock& operator=(CoordinatorClusterClock&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CoordinatorClusterClock& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CoordinatorClusterClock* internal_default_instance() {
+    return reinterpret_cast<const CoordinatorClusterClock*>(
+               &_CoordinatorClusterClock_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CoordinatorClusterClock& a, CoordinatorClusterClock& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CoordinatorClusterClock* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CoordinatorClusterClock* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CoordinatorClusterClock* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CoordinatorClusterClock>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CoordinatorClusterClock& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CoordinatorClusterClock& from) {
+    CoordinatorClusterClock::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CoordinatorClusterClock* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.CoordinatorClusterClock";
+  }
+  protected:
+  explicit CoordinatorClusterClock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNextSafeTimeFieldNumber = 1,
+  };
+  // required uint64 next_safe_time = 1;
+  bool has_next_safe_time() const;
+  private:
+  bool _internal_has_next_safe_time() const;
+  public:
+  void clear_next_safe_time();
+  uint64_t next_safe_time() const;
+  void set_next_safe_time(uint64_t value);
+  private:
+  uint64_t _internal_next_safe_time() const;
+  void _internal_set_next_safe_time(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.CoordinatorClusterClock)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t next_safe_time_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_CoordinatorClusterClock_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CoordinatorClusterClock
+
+// required uint64 next_safe_time = 1;
+inline bool CoordinatorClusterClock::_internal_has_next_safe_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CoordinatorClusterClock::has_next_safe_time() const {
+  return _internal_has_next_safe_time();
+}
+inline void CoordinatorClusterClock::clear_next_safe_time() {
+  _impl_.next_safe_time_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CoordinatorClusterClock::_internal_next_safe_time() const {
+  return _impl_.next_safe_time_;
+}
+inline uint64_t CoordinatorClusterClock::next_safe_time() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.CoordinatorClusterClock.next_safe_time)
+  return _internal_next_safe_time();
+}
+inline void CoordinatorClusterClock::_internal_set_next_safe_time(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.next_safe_time_ = value;
+}
+inline void CoordinatorClusterClock::set_next_safe_time(uint64_t value) {
+  _internal_set_next_safe_time(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.CoordinatorClusterClock.next_safe_time)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_CoordinatorClusterClock_2eproto
+// RAMCloud pragma [GCCWARN=0]
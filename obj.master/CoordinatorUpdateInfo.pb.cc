@@ -0,0 +1,355 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: CoordinatorUpdateInfo.proto
+
+#include "CoordinatorUpdateInfo.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR CoordinatorUpdateInfo::CoordinatorUpdateInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.lastfinished_)*/uint64_t{0u}
+  , /*decltype(_impl_.firstavailable_)*/uint64_t{0u}} {}
+struct CoordinatorUpdateInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CoordinatorUpdateInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CoordinatorUpdateInfoDefaultTypeInternal() {}
+  union {
+    CoordinatorUpdateInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CoordinatorUpdateInfoDefaultTypeInternal _CoordinatorUpdateInfo_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_CoordinatorUpdateInfo_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_CoordinatorUpdateInfo_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_CoordinatorUpdateInfo_2eproto = nullptr;
+
+const uint32_t TableStruct_CoordinatorUpdateInfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::CoordinatorUpdateInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::CoordinatorUpdateInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::CoordinatorUpdateInfo, _impl_.lastfinished_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::CoordinatorUpdateInfo, _impl_.firstavailable_),
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::RAMCloud::ProtoBuf::CoordinatorUpdateInfo)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_CoordinatorUpdateInfo_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_CoordinatorUpdateInfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\033CoordinatorUpdateInfo.proto\022\021RAMCloud."
+  "ProtoBuf\"E\n\025CoordinatorUpdateInfo\022\024\n\014las"
+  "tFinished\030\001 \002(\004\022\026\n\016firstAvailable\030\002 \002(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_CoordinatorUpdateInfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_CoordinatorUpdateInfo_2eproto = {
+    false, false, 119, descriptor_table_protodef_CoordinatorUpdateInfo_2eproto,
+    "CoordinatorUpdateInfo.proto",
+    &descriptor_table_CoordinatorUpdateInfo_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_CoordinatorUpdateInfo_2eproto::offsets,
+    file_level_metadata_CoordinatorUpdateInfo_2eproto, file_level_enum_descriptors_CoordinatorUpdateInfo_2eproto,
+    file_level_service_descriptors_CoordinatorUpdateInfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_CoordinatorUpdateInfo_2eproto_getter() {
+  return &descriptor_table_CoordinatorUpdateInfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_CoordinatorUpdateInfo_2eproto(&descriptor_table_CoordinatorUpdateInfo_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class CoordinatorUpdateInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CoordinatorUpdateInfo>()._impl_._has_bits_);
+  static void set_has_lastfinished(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_firstavailable(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+CoordinatorUpdateInfo::CoordinatorUpdateInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.CoordinatorUpdateInfo)
+}
+CoordinatorUpdateInfo::CoordinatorUpdateInfo(const CoordinatorUpdateInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CoordinatorUpdateInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lastfinished_){}
+    , decltype(_impl_.firstavailable_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.lastfinished_, &from._impl_.lastfinished_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.firstavailable_) -
+    reinterpret_cast<char*>(&_impl_.lastfinished_)) + sizeof(_impl_.firstavailable_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.CoordinatorUpdateInfo)
+}
+
+inline void CoordinatorUpdateInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lastfinished_){uint64_t{0u}}
+    , decltype(_impl_.firstavailable_){uint64_t{0u}}
+  };
+}
+
+CoordinatorUpdateInfo::~CoordinatorUpdateInfo() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.CoordinatorUpdateInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CoordinatorUpdateInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CoordinatorUpdateInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CoordinatorUpdateInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.CoordinatorUpdateInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.lastfinished_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.firstavailable_) -
+        reinterpret_cast<char*>(&_impl_.lastfinished_)) + sizeof(_impl_.firstavailable_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CoordinatorUpdateInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 lastFinished = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_lastfinished(&has_bits);
+          _impl_.lastfinished_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 firstAvailable = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_firstavailable(&has_bits);
+          _impl_.firstavailable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CoordinatorUpdateInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.CoordinatorUpdateInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 lastFinished = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_lastfinished(), target);
+  }
+
+  // required uint64 firstAvailable = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_firstavailable(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.CoordinatorUpdateInfo)
+  return target;
+}
+
+size_t CoordinatorUpdateInfo::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.CoordinatorUpdateInfo)
+  size_t total_size = 0;
+
+  if (_internal_has_lastfinished()) {
+    // required uint64 lastFinished = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastfinished());
+  }
+
+  if (_internal_has_firstavailable()) {
+    // required uint64 firstAvailable = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_firstavailable());
+  }
+
+  return total_size;
+}
+size_t CoordinatorUpdateInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.CoordinatorUpdateInfo)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 lastFinished = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lastfinished());
+
+    // required uint64 firstAvailable = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_firstavailable());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CoordinatorUpdateInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CoordinatorUpdateInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CoordinatorUpdateInfo::GetClassData() const { return &_class_data_; }
+
+
+void CoordinatorUpdateInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CoordinatorUpdateInfo*>(&to_msg);
+  auto& from = static_cast<const CoordinatorUpdateInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.CoordinatorUpdateInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.lastfinished_ = from._impl_.lastfinished_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.firstavailable_ = from._impl_.firstavailable_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CoordinatorUpdateInfo::CopyFrom(const CoordinatorUpdateInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.CoordinatorUpdateInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CoordinatorUpdateInfo::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void CoordinatorUpdateInfo::InternalSwap(CoordinatorUpdateInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CoordinatorUpdateInfo, _impl_.firstavailable_)
+      + sizeof(CoordinatorUpdateInfo::_impl_.firstavailable_)
+      - PROTOBUF_FIELD_OFFSET(CoordinatorUpdateInfo, _impl_.lastfinished_)>(
+          reinterpret_cast<char*>(&_impl_.lastfinished_),
+          reinterpret_cast<char*>(&other->_impl_.lastfinished_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CoordinatorUpdateInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_CoordinatorUpdateInfo_2eproto_getter, &descriptor_table_CoordinatorUpdateInfo_2eproto_once,
+      file_level_metadata_CoordinatorUpdateInfo_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::CoordinatorUpdateInfo*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::CoordinatorUpdateInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::CoordinatorUpdateInfo >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,318 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: CoordinatorUpdateInfo.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_CoordinatorUpdateInfo_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_CoordinatorUpdateInfo_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_CoordinatorUpdateInfo_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_CoordinatorUpdateInfo_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_CoordinatorUpdateInfo_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class CoordinatorUpdateInfo;
+struct CoordinatorUpdateInfoDefaultTypeInternal;
+extern CoordinatorUpdateInfoDefaultTypeInternal _CoordinatorUpdateInfo_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::CoordinatorUpdateInfo* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::CoordinatorUpdateInfo>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class CoordinatorUpdateInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.CoordinatorUpdateInfo) */ {
+ public:
+  inline CoordinatorUpdateInfo() : CoordinatorUpdateInfo(nullptr) {}
+  ~CoordinatorUpdateInfo() override;
+  explicit PROTOBUF_CONSTEXPR CoordinatorUpdateInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CoordinatorUpdateInfo(const CoordinatorUpdateInfo& from);
+  CoordinatorUpdateInfo(CoordinatorUpdateInfo&& from) noexcept
+    : CoordinatorUpdateInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline CoordinatorUpdateInfo& operator=(const CoordinatorUpdateInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CoordinatorUpdateInfo& operator=(CoordinatorUpdateInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CoordinatorUpdateInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CoordinatorUpdateInfo* internal_default_instance() {
+    return reinterpret_cast<const CoordinatorUpdateInfo*>(
+               &_CoordinatorUpdateInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CoordinatorUpdateInfo& a, CoordinatorUpdateInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CoordinatorUpdateInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CoordinatorUpdateInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CoordinatorUpdateInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CoordinatorUpdateInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CoordinatorUpdateInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CoordinatorUpdateInfo& from) {
+    CoordinatorUpdateInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CoordinatorUpdateInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.CoordinatorUpdateInfo";
+  }
+  protected:
+  explicit CoordinatorUpdateInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLastFinishedFieldNumber = 1,
+    kFirstAvailableFieldNumber = 2,
+  };
+  // required uint64 lastFinished = 1;
+  bool has_lastfinished() const;
+  private:
+  bool _internal_has_lastfinished() const;
+  public:
+  void clear_lastfinished();
+  uint64_t lastfinished() const;
+  void set_lastfinished(uint64_t value);
+  private:
+  uint64_t _internal_lastfinished() const;
+  void _internal_set_lastfinished(uint64_t value);
+  public:
+
+  // required uint64 firstAvailable = 2;
+  bool has_firstavailable() const;
+  private:
+  bool _internal_has_firstavailable() const;
+  public:
+  void clear_firstavailable();
+  uint64_t firstavailable() const;
+  void set_firstavailable(uint64_t value);
+  private:
+  uint64_t _internal_firstavailable() const;
+  void _internal_set_firstavailable(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.CoordinatorUpdateInfo)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t lastfinished_;
+    uint64_t firstavailable_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_CoordinatorUpdateInfo_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CoordinatorUpdateInfo
+
+// required uint64 lastFinished = 1;
+inline bool CoordinatorUpdateInfo::_internal_has_lastfinished() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CoordinatorUpdateInfo::has_lastfinished() const {
+  return _internal_has_lastfinished();
+}
+inline void CoordinatorUpdateInfo::clear_lastfinished() {
+  _impl_.lastfinished_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CoordinatorUpdateInfo::_internal_lastfinished() const {
+  return _impl_.lastfinished_;
+}
+inline uint64_t CoordinatorUpdateInfo::lastfinished() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.CoordinatorUpdateInfo.lastFinished)
+  return _internal_lastfinished();
+}
+inline void CoordinatorUpdateInfo::_internal_set_lastfinished(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.lastfinished_ = value;
+}
+inline void CoordinatorUpdateInfo::set_lastfinished(uint64_t value) {
+  _internal_set_lastfinished(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.CoordinatorUpdateInfo.lastFinished)
+}
+
+// required uint64 firstAvailable = 2;
+inline bool CoordinatorUpdateInfo::_internal_has_firstavailable() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CoordinatorUpdateInfo::has_firstavailable() const {
+  return _internal_has_firstavailable();
+}
+inline void CoordinatorUpdateInfo::clear_firstavailable() {
+  _impl_.firstavailable_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t CoordinatorUpdateInfo::_internal_firstavailable() const {
+  return _impl_.firstavailable_;
+}
+inline uint64_t CoordinatorUpdateInfo::firstavailable() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.CoordinatorUpdateInfo.firstAvailable)
+  return _internal_firstavailable();
+}
+inline void CoordinatorUpdateInfo::_internal_set_firstavailable(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.firstavailable_ = value;
+}
+inline void CoordinatorUpdateInfo::set_firstavailable(uint64_t value) {
+  _internal_set_firstavailable(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.CoordinatorUpdateInfo.firstAvailable)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_CoordinatorUpdateInfo_2eproto
+// RAMCloud pragma [GCCWARN=0]
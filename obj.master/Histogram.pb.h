@@ -0,0 +1,839 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Histogram.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_Histogram_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_Histogram_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_Histogram_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_Histogram_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Histogram_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class Histogram;
+struct HistogramDefaultTypeInternal;
+extern HistogramDefaultTypeInternal _Histogram_default_instance_;
+class Histogram_Bucket;
+struct Histogram_BucketDefaultTypeInternal;
+extern Histogram_BucketDefaultTypeInternal _Histogram_Bucket_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::Histogram* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Histogram>(Arena*);
+template<> ::RAMCloud::ProtoBuf::Histogram_Bucket* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Histogram_Bucket>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class Histogram_Bucket final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Histogram.Bucket) */ {
+ public:
+  inline Histogram_Bucket() : Histogram_Bucket(nullptr) {}
+  ~Histogram_Bucket() override;
+  explicit PROTOBUF_CONSTEXPR Histogram_Bucket(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Histogram_Bucket(const Histogram_Bucket& from);
+  Histogram_Bucket(Histogram_Bucket&& from) noexcept
+    : Histogram_Bucket() {
+    *this = ::std::move(from);
+  }
+
+  inline Histogram_Bucket& operator=(const Histogram_Bucket& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Histogram_Bucket& operator=(Histogram_Bucket&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Histogram_Bucket& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Histogram_Bucket* internal_default_instance() {
+    return reinterpret_cast<const Histogram_Bucket*>(
+               &_Histogram_Bucket_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Histogram_Bucket& a, Histogram_Bucket& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Histogram_Bucket* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Histogram_Bucket* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Histogram_Bucket* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Histogram_Bucket>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Histogram_Bucket& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Histogram_Bucket& from) {
+    Histogram_Bucket::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Histogram_Bucket* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Histogram.Bucket";
+  }
+  protected:
+  explicit Histogram_Bucket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIndexFieldNumber = 1,
+    kCountFieldNumber = 2,
+  };
+  // required fixed64 index = 1;
+  bool has_index() const;
+  private:
+  bool _internal_has_index() const;
+  public:
+  void clear_index();
+  uint64_t index() const;
+  void set_index(uint64_t value);
+  private:
+  uint64_t _internal_index() const;
+  void _internal_set_index(uint64_t value);
+  public:
+
+  // required fixed64 count = 2;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Histogram.Bucket)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t index_;
+    uint64_t count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Histogram_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Histogram final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Histogram) */ {
+ public:
+  inline Histogram() : Histogram(nullptr) {}
+  ~Histogram() override;
+  explicit PROTOBUF_CONSTEXPR Histogram(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Histogram(const Histogram& from);
+  Histogram(Histogram&& from) noexcept
+    : Histogram() {
+    *this = ::std::move(from);
+  }
+
+  inline Histogram& operator=(const Histogram& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Histogram& operator=(Histogram&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Histogram& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Histogram* internal_default_instance() {
+    return reinterpret_cast<const Histogram*>(
+               &_Histogram_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Histogram& a, Histogram& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Histogram* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Histogram* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Histogram* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Histogram>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Histogram& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Histogram& from) {
+    Histogram::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Histogram* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Histogram";
+  }
+  protected:
+  explicit Histogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Histogram_Bucket Bucket;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketFieldNumber = 3,
+    kNumBucketsFieldNumber = 1,
+    kBucketWidthFieldNumber = 2,
+    kSampleSumHighFieldNumber = 4,
+    kSampleSumLowFieldNumber = 5,
+    kOutliersFieldNumber = 6,
+    kMaxFieldNumber = 7,
+    kMinFieldNumber = 8,
+  };
+  // repeated .RAMCloud.ProtoBuf.Histogram.Bucket bucket = 3;
+  int bucket_size() const;
+  private:
+  int _internal_bucket_size() const;
+  public:
+  void clear_bucket();
+  ::RAMCloud::ProtoBuf::Histogram_Bucket* mutable_bucket(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Histogram_Bucket >*
+      mutable_bucket();
+  private:
+  const ::RAMCloud::ProtoBuf::Histogram_Bucket& _internal_bucket(int index) const;
+  ::RAMCloud::ProtoBuf::Histogram_Bucket* _internal_add_bucket();
+  public:
+  const ::RAMCloud::ProtoBuf::Histogram_Bucket& bucket(int index) const;
+  ::RAMCloud::ProtoBuf::Histogram_Bucket* add_bucket();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Histogram_Bucket >&
+      bucket() const;
+
+  // required fixed64 num_buckets = 1;
+  bool has_num_buckets() const;
+  private:
+  bool _internal_has_num_buckets() const;
+  public:
+  void clear_num_buckets();
+  uint64_t num_buckets() const;
+  void set_num_buckets(uint64_t value);
+  private:
+  uint64_t _internal_num_buckets() const;
+  void _internal_set_num_buckets(uint64_t value);
+  public:
+
+  // required fixed64 bucket_width = 2;
+  bool has_bucket_width() const;
+  private:
+  bool _internal_has_bucket_width() const;
+  public:
+  void clear_bucket_width();
+  uint64_t bucket_width() const;
+  void set_bucket_width(uint64_t value);
+  private:
+  uint64_t _internal_bucket_width() const;
+  void _internal_set_bucket_width(uint64_t value);
+  public:
+
+  // required fixed64 sample_sum_high = 4;
+  bool has_sample_sum_high() const;
+  private:
+  bool _internal_has_sample_sum_high() const;
+  public:
+  void clear_sample_sum_high();
+  uint64_t sample_sum_high() const;
+  void set_sample_sum_high(uint64_t value);
+  private:
+  uint64_t _internal_sample_sum_high() const;
+  void _internal_set_sample_sum_high(uint64_t value);
+  public:
+
+  // required fixed64 sample_sum_low = 5;
+  bool has_sample_sum_low() const;
+  private:
+  bool _internal_has_sample_sum_low() const;
+  public:
+  void clear_sample_sum_low();
+  uint64_t sample_sum_low() const;
+  void set_sample_sum_low(uint64_t value);
+  private:
+  uint64_t _internal_sample_sum_low() const;
+  void _internal_set_sample_sum_low(uint64_t value);
+  public:
+
+  // required fixed64 outliers = 6;
+  bool has_outliers() const;
+  private:
+  bool _internal_has_outliers() const;
+  public:
+  void clear_outliers();
+  uint64_t outliers() const;
+  void set_outliers(uint64_t value);
+  private:
+  uint64_t _internal_outliers() const;
+  void _internal_set_outliers(uint64_t value);
+  public:
+
+  // required fixed64 max = 7;
+  bool has_max() const;
+  private:
+  bool _internal_has_max() const;
+  public:
+  void clear_max();
+  uint64_t max() const;
+  void set_max(uint64_t value);
+  private:
+  uint64_t _internal_max() const;
+  void _internal_set_max(uint64_t value);
+  public:
+
+  // required fixed64 min = 8;
+  bool has_min() const;
+  private:
+  bool _internal_has_min() const;
+  public:
+  void clear_min();
+  uint64_t min() const;
+  void set_min(uint64_t value);
+  private:
+  uint64_t _internal_min() const;
+  void _internal_set_min(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Histogram)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Histogram_Bucket > bucket_;
+    uint64_t num_buckets_;
+    uint64_t bucket_width_;
+    uint64_t sample_sum_high_;
+    uint64_t sample_sum_low_;
+    uint64_t outliers_;
+    uint64_t max_;
+    uint64_t min_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Histogram_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Histogram_Bucket
+
+// required fixed64 index = 1;
+inline bool Histogram_Bucket::_internal_has_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Histogram_Bucket::has_index() const {
+  return _internal_has_index();
+}
+inline void Histogram_Bucket::clear_index() {
+  _impl_.index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Histogram_Bucket::_internal_index() const {
+  return _impl_.index_;
+}
+inline uint64_t Histogram_Bucket::index() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Histogram.Bucket.index)
+  return _internal_index();
+}
+inline void Histogram_Bucket::_internal_set_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.index_ = value;
+}
+inline void Histogram_Bucket::set_index(uint64_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Histogram.Bucket.index)
+}
+
+// required fixed64 count = 2;
+inline bool Histogram_Bucket::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Histogram_Bucket::has_count() const {
+  return _internal_has_count();
+}
+inline void Histogram_Bucket::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Histogram_Bucket::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t Histogram_Bucket::count() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Histogram.Bucket.count)
+  return _internal_count();
+}
+inline void Histogram_Bucket::_internal_set_count(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.count_ = value;
+}
+inline void Histogram_Bucket::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Histogram.Bucket.count)
+}
+
+// -------------------------------------------------------------------
+
+// Histogram
+
+// required fixed64 num_buckets = 1;
+inline bool Histogram::_internal_has_num_buckets() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Histogram::has_num_buckets() const {
+  return _internal_has_num_buckets();
+}
+inline void Histogram::clear_num_buckets() {
+  _impl_.num_buckets_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Histogram::_internal_num_buckets() const {
+  return _impl_.num_buckets_;
+}
+inline uint64_t Histogram::num_buckets() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Histogram.num_buckets)
+  return _internal_num_buckets();
+}
+inline void Histogram::_internal_set_num_buckets(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.num_buckets_ = value;
+}
+inline void Histogram::set_num_buckets(uint64_t value) {
+  _internal_set_num_buckets(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Histogram.num_buckets)
+}
+
+// required fixed64 bucket_width = 2;
+inline bool Histogram::_internal_has_bucket_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Histogram::has_bucket_width() const {
+  return _internal_has_bucket_width();
+}
+inline void Histogram::clear_bucket_width() {
+  _impl_.bucket_width_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Histogram::_internal_bucket_width() const {
+  return _impl_.bucket_width_;
+}
+inline uint64_t Histogram::bucket_width() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Histogram.bucket_width)
+  return _internal_bucket_width();
+}
+inline void Histogram::_internal_set_bucket_width(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.bucket_width_ = value;
+}
+inline void Histogram::set_bucket_width(uint64_t value) {
+  _internal_set_bucket_width(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Histogram.bucket_width)
+}
+
+// repeated .RAMCloud.ProtoBuf.Histogram.Bucket bucket = 3;
+inline int Histogram::_internal_bucket_size() const {
+  return _impl_.bucket_.size();
+}
+inline int Histogram::bucket_size() const {
+  return _internal_bucket_size();
+}
+inline void Histogram::clear_bucket() {
+  _impl_.bucket_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::Histogram_Bucket* Histogram::mutable_bucket(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Histogram.bucket)
+  return _impl_.bucket_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Histogram_Bucket >*
+Histogram::mutable_bucket() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.Histogram.bucket)
+  return &_impl_.bucket_;
+}
+inline const ::RAMCloud::ProtoBuf::Histogram_Bucket& Histogram::_internal_bucket(int index) const {
+  return _impl_.bucket_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::Histogram_Bucket& Histogram::bucket(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Histogram.bucket)
+  return _internal_bucket(index);
+}
+inline ::RAMCloud::ProtoBuf::Histogram_Bucket* Histogram::_internal_add_bucket() {
+  return _impl_.bucket_.Add();
+}
+inline ::RAMCloud::ProtoBuf::Histogram_Bucket* Histogram::add_bucket() {
+  ::RAMCloud::ProtoBuf::Histogram_Bucket* _add = _internal_add_bucket();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.Histogram.bucket)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Histogram_Bucket >&
+Histogram::bucket() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.Histogram.bucket)
+  return _impl_.bucket_;
+}
+
+// required fixed64 sample_sum_high = 4;
+inline bool Histogram::_internal_has_sample_sum_high() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Histogram::has_sample_sum_high() const {
+  return _internal_has_sample_sum_high();
+}
+inline void Histogram::clear_sample_sum_high() {
+  _impl_.sample_sum_high_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Histogram::_internal_sample_sum_high() const {
+  return _impl_.sample_sum_high_;
+}
+inline uint64_t Histogram::sample_sum_high() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Histogram.sample_sum_high)
+  return _internal_sample_sum_high();
+}
+inline void Histogram::_internal_set_sample_sum_high(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.sample_sum_high_ = value;
+}
+inline void Histogram::set_sample_sum_high(uint64_t value) {
+  _internal_set_sample_sum_high(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Histogram.sample_sum_high)
+}
+
+// required fixed64 sample_sum_low = 5;
+inline bool Histogram::_internal_has_sample_sum_low() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Histogram::has_sample_sum_low() const {
+  return _internal_has_sample_sum_low();
+}
+inline void Histogram::clear_sample_sum_low() {
+  _impl_.sample_sum_low_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t Histogram::_internal_sample_sum_low() const {
+  return _impl_.sample_sum_low_;
+}
+inline uint64_t Histogram::sample_sum_low() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Histogram.sample_sum_low)
+  return _internal_sample_sum_low();
+}
+inline void Histogram::_internal_set_sample_sum_low(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.sample_sum_low_ = value;
+}
+inline void Histogram::set_sample_sum_low(uint64_t value) {
+  _internal_set_sample_sum_low(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Histogram.sample_sum_low)
+}
+
+// required fixed64 outliers = 6;
+inline bool Histogram::_internal_has_outliers() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Histogram::has_outliers() const {
+  return _internal_has_outliers();
+}
+inline void Histogram::clear_outliers() {
+  _impl_.outliers_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t Histogram::_internal_outliers() const {
+  return _impl_.outliers_;
+}
+inline uint64_t Histogram::outliers() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Histogram.outliers)
+  return _internal_outliers();
+}
+inline void Histogram::_internal_set_outliers(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.outliers_ = value;
+}
+inline void Histogram::set_outliers(uint64_t value) {
+  _internal_set_outliers(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Histogram.outliers)
+}
+
+// required fixed64 max = 7;
+inline bool Histogram::_internal_has_max() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Histogram::has_max() const {
+  return _internal_has_max();
+}
+inline void Histogram::clear_max() {
+  _impl_.max_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t Histogram::_internal_max() const {
+  return _impl_.max_;
+}
+inline uint64_t Histogram::max() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Histogram.max)
+  return _internal_max();
+}
+inline void Histogram::_internal_set_max(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.max_ = value;
+}
+inline void Histogram::set_max(uint64_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Histogram.max)
+}
+
+// required fixed64 min = 8;
+inline bool Histogram::_internal_has_min() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Histogram::has_min() const {
+  return _internal_has_min();
+}
+inline void Histogram::clear_min() {
+  _impl_.min_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t Histogram::_internal_min() const {
+  return _impl_.min_;
+}
+inline uint64_t Histogram::min() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Histogram.min)
+  return _internal_min();
+}
+inline void Histogram::_internal_set_min(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.min_ = value;
+}
+inline void Histogram::set_min(uint64_t value) {
+  _internal_set_min(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Histogram.min)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_Histogram_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,629 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Indexlet.proto
+
+#include "Indexlet.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR Indexlet::Indexlet(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.first_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.first_not_owned_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.service_locator_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.table_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.backing_table_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.user_data_)*/uint64_t{0u}
+  , /*decltype(_impl_.index_id_)*/0u} {}
+struct IndexletDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IndexletDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IndexletDefaultTypeInternal() {}
+  union {
+    Indexlet _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IndexletDefaultTypeInternal _Indexlet_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_Indexlet_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Indexlet_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Indexlet_2eproto = nullptr;
+
+const uint32_t TableStruct_Indexlet_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Indexlet, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Indexlet, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Indexlet, _impl_.table_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Indexlet, _impl_.index_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Indexlet, _impl_.backing_table_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Indexlet, _impl_.first_key_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Indexlet, _impl_.first_not_owned_key_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Indexlet, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Indexlet, _impl_.service_locator_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Indexlet, _impl_.user_data_),
+  3,
+  7,
+  4,
+  0,
+  1,
+  5,
+  2,
+  6,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 14, -1, sizeof(::RAMCloud::ProtoBuf::Indexlet)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_Indexlet_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_Indexlet_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016Indexlet.proto\022\021RAMCloud.ProtoBuf\"\267\001\n\010"
+  "Indexlet\022\020\n\010table_id\030\001 \002(\004\022\020\n\010index_id\030\002"
+  " \002(\r\022\030\n\020backing_table_id\030\003 \002(\004\022\021\n\tfirst_"
+  "key\030\004 \001(\014\022\033\n\023first_not_owned_key\030\005 \001(\014\022\021"
+  "\n\tserver_id\030\006 \001(\006\022\027\n\017service_locator\030\007 \001"
+  "(\t\022\021\n\tuser_data\030\010 \001(\006"
+  ;
+static ::_pbi::once_flag descriptor_table_Indexlet_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_Indexlet_2eproto = {
+    false, false, 221, descriptor_table_protodef_Indexlet_2eproto,
+    "Indexlet.proto",
+    &descriptor_table_Indexlet_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_Indexlet_2eproto::offsets,
+    file_level_metadata_Indexlet_2eproto, file_level_enum_descriptors_Indexlet_2eproto,
+    file_level_service_descriptors_Indexlet_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Indexlet_2eproto_getter() {
+  return &descriptor_table_Indexlet_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Indexlet_2eproto(&descriptor_table_Indexlet_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class Indexlet::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Indexlet>()._impl_._has_bits_);
+  static void set_has_table_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_index_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_backing_table_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_first_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_first_not_owned_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_service_locator(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_user_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000098) ^ 0x00000098) != 0;
+  }
+};
+
+Indexlet::Indexlet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.Indexlet)
+}
+Indexlet::Indexlet(const Indexlet& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Indexlet* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.first_key_){}
+    , decltype(_impl_.first_not_owned_key_){}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.table_id_){}
+    , decltype(_impl_.backing_table_id_){}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.user_data_){}
+    , decltype(_impl_.index_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.first_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_first_key()) {
+    _this->_impl_.first_key_.Set(from._internal_first_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.first_not_owned_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_first_not_owned_key()) {
+    _this->_impl_.first_not_owned_key_.Set(from._internal_first_not_owned_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_service_locator()) {
+    _this->_impl_.service_locator_.Set(from._internal_service_locator(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.table_id_, &from._impl_.table_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.index_id_) -
+    reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.index_id_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.Indexlet)
+}
+
+inline void Indexlet::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.first_key_){}
+    , decltype(_impl_.first_not_owned_key_){}
+    , decltype(_impl_.service_locator_){}
+    , decltype(_impl_.table_id_){uint64_t{0u}}
+    , decltype(_impl_.backing_table_id_){uint64_t{0u}}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+    , decltype(_impl_.user_data_){uint64_t{0u}}
+    , decltype(_impl_.index_id_){0u}
+  };
+  _impl_.first_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.first_not_owned_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.service_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Indexlet::~Indexlet() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.Indexlet)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Indexlet::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.first_key_.Destroy();
+  _impl_.first_not_owned_key_.Destroy();
+  _impl_.service_locator_.Destroy();
+}
+
+void Indexlet::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Indexlet::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.Indexlet)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.first_key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.first_not_owned_key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.service_locator_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.table_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.index_id_) -
+        reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.index_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Indexlet::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 table_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_table_id(&has_bits);
+          _impl_.table_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 index_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_index_id(&has_bits);
+          _impl_.index_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 backing_table_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_backing_table_id(&has_bits);
+          _impl_.backing_table_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes first_key = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_first_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes first_not_owned_key = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_first_not_owned_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 server_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string service_locator = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_service_locator();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.Indexlet.service_locator");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 user_data = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_user_data(&has_bits);
+          _impl_.user_data_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Indexlet::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.Indexlet)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 table_id = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_table_id(), target);
+  }
+
+  // required uint32 index_id = 2;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_index_id(), target);
+  }
+
+  // required uint64 backing_table_id = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_backing_table_id(), target);
+  }
+
+  // optional bytes first_key = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_first_key(), target);
+  }
+
+  // optional bytes first_not_owned_key = 5;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_first_not_owned_key(), target);
+  }
+
+  // optional fixed64 server_id = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(6, this->_internal_server_id(), target);
+  }
+
+  // optional string service_locator = 7;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_service_locator().data(), static_cast<int>(this->_internal_service_locator().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.Indexlet.service_locator");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_service_locator(), target);
+  }
+
+  // optional fixed64 user_data = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(8, this->_internal_user_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.Indexlet)
+  return target;
+}
+
+size_t Indexlet::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.Indexlet)
+  size_t total_size = 0;
+
+  if (_internal_has_table_id()) {
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+  }
+
+  if (_internal_has_backing_table_id()) {
+    // required uint64 backing_table_id = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_backing_table_id());
+  }
+
+  if (_internal_has_index_id()) {
+    // required uint32 index_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index_id());
+  }
+
+  return total_size;
+}
+size_t Indexlet::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.Indexlet)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000098) ^ 0x00000098) == 0) {  // All required fields are present.
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+
+    // required uint64 backing_table_id = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_backing_table_id());
+
+    // required uint32 index_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index_id());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bytes first_key = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_first_key());
+    }
+
+    // optional bytes first_not_owned_key = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_first_not_owned_key());
+    }
+
+    // optional string service_locator = 7;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_service_locator());
+    }
+
+  }
+  if (cached_has_bits & 0x00000060u) {
+    // optional fixed64 server_id = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional fixed64 user_data = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Indexlet::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Indexlet::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Indexlet::GetClassData() const { return &_class_data_; }
+
+
+void Indexlet::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Indexlet*>(&to_msg);
+  auto& from = static_cast<const Indexlet&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.Indexlet)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_first_key(from._internal_first_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_first_not_owned_key(from._internal_first_not_owned_key());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_service_locator(from._internal_service_locator());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.table_id_ = from._impl_.table_id_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.backing_table_id_ = from._impl_.backing_table_id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.user_data_ = from._impl_.user_data_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.index_id_ = from._impl_.index_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Indexlet::CopyFrom(const Indexlet& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.Indexlet)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Indexlet::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Indexlet::InternalSwap(Indexlet* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.first_key_, lhs_arena,
+      &other->_impl_.first_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.first_not_owned_key_, lhs_arena,
+      &other->_impl_.first_not_owned_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_locator_, lhs_arena,
+      &other->_impl_.service_locator_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Indexlet, _impl_.index_id_)
+      + sizeof(Indexlet::_impl_.index_id_)
+      - PROTOBUF_FIELD_OFFSET(Indexlet, _impl_.table_id_)>(
+          reinterpret_cast<char*>(&_impl_.table_id_),
+          reinterpret_cast<char*>(&other->_impl_.table_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Indexlet::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Indexlet_2eproto_getter, &descriptor_table_Indexlet_2eproto_once,
+      file_level_metadata_Indexlet_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::Indexlet*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::Indexlet >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::Indexlet >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,711 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Indexlet.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_Indexlet_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_Indexlet_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_Indexlet_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_Indexlet_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Indexlet_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class Indexlet;
+struct IndexletDefaultTypeInternal;
+extern IndexletDefaultTypeInternal _Indexlet_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::Indexlet* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Indexlet>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class Indexlet final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Indexlet) */ {
+ public:
+  inline Indexlet() : Indexlet(nullptr) {}
+  ~Indexlet() override;
+  explicit PROTOBUF_CONSTEXPR Indexlet(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Indexlet(const Indexlet& from);
+  Indexlet(Indexlet&& from) noexcept
+    : Indexlet() {
+    *this = ::std::move(from);
+  }
+
+  inline Indexlet& operator=(const Indexlet& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Indexlet& operator=(Indexlet&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Indexlet& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Indexlet* internal_default_instance() {
+    return reinterpret_cast<const Indexlet*>(
+               &_Indexlet_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Indexlet& a, Indexlet& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Indexlet* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Indexlet* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Indexlet* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Indexlet>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Indexlet& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Indexlet& from) {
+    Indexlet::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Indexlet* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Indexlet";
+  }
+  protected:
+  explicit Indexlet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFirstKeyFieldNumber = 4,
+    kFirstNotOwnedKeyFieldNumber = 5,
+    kServiceLocatorFieldNumber = 7,
+    kTableIdFieldNumber = 1,
+    kBackingTableIdFieldNumber = 3,
+    kServerIdFieldNumber = 6,
+    kUserDataFieldNumber = 8,
+    kIndexIdFieldNumber = 2,
+  };
+  // optional bytes first_key = 4;
+  bool has_first_key() const;
+  private:
+  bool _internal_has_first_key() const;
+  public:
+  void clear_first_key();
+  const std::string& first_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_first_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_first_key();
+  PROTOBUF_NODISCARD std::string* release_first_key();
+  void set_allocated_first_key(std::string* first_key);
+  private:
+  const std::string& _internal_first_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_first_key(const std::string& value);
+  std::string* _internal_mutable_first_key();
+  public:
+
+  // optional bytes first_not_owned_key = 5;
+  bool has_first_not_owned_key() const;
+  private:
+  bool _internal_has_first_not_owned_key() const;
+  public:
+  void clear_first_not_owned_key();
+  const std::string& first_not_owned_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_first_not_owned_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_first_not_owned_key();
+  PROTOBUF_NODISCARD std::string* release_first_not_owned_key();
+  void set_allocated_first_not_owned_key(std::string* first_not_owned_key);
+  private:
+  const std::string& _internal_first_not_owned_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_first_not_owned_key(const std::string& value);
+  std::string* _internal_mutable_first_not_owned_key();
+  public:
+
+  // optional string service_locator = 7;
+  bool has_service_locator() const;
+  private:
+  bool _internal_has_service_locator() const;
+  public:
+  void clear_service_locator();
+  const std::string& service_locator() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_locator(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_locator();
+  PROTOBUF_NODISCARD std::string* release_service_locator();
+  void set_allocated_service_locator(std::string* service_locator);
+  private:
+  const std::string& _internal_service_locator() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_locator(const std::string& value);
+  std::string* _internal_mutable_service_locator();
+  public:
+
+  // required uint64 table_id = 1;
+  bool has_table_id() const;
+  private:
+  bool _internal_has_table_id() const;
+  public:
+  void clear_table_id();
+  uint64_t table_id() const;
+  void set_table_id(uint64_t value);
+  private:
+  uint64_t _internal_table_id() const;
+  void _internal_set_table_id(uint64_t value);
+  public:
+
+  // required uint64 backing_table_id = 3;
+  bool has_backing_table_id() const;
+  private:
+  bool _internal_has_backing_table_id() const;
+  public:
+  void clear_backing_table_id();
+  uint64_t backing_table_id() const;
+  void set_backing_table_id(uint64_t value);
+  private:
+  uint64_t _internal_backing_table_id() const;
+  void _internal_set_backing_table_id(uint64_t value);
+  public:
+
+  // optional fixed64 server_id = 6;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // optional fixed64 user_data = 8;
+  bool has_user_data() const;
+  private:
+  bool _internal_has_user_data() const;
+  public:
+  void clear_user_data();
+  uint64_t user_data() const;
+  void set_user_data(uint64_t value);
+  private:
+  uint64_t _internal_user_data() const;
+  void _internal_set_user_data(uint64_t value);
+  public:
+
+  // required uint32 index_id = 2;
+  bool has_index_id() const;
+  private:
+  bool _internal_has_index_id() const;
+  public:
+  void clear_index_id();
+  uint32_t index_id() const;
+  void set_index_id(uint32_t value);
+  private:
+  uint32_t _internal_index_id() const;
+  void _internal_set_index_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Indexlet)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr first_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr first_not_owned_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_locator_;
+    uint64_t table_id_;
+    uint64_t backing_table_id_;
+    uint64_t server_id_;
+    uint64_t user_data_;
+    uint32_t index_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Indexlet_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Indexlet
+
+// required uint64 table_id = 1;
+inline bool Indexlet::_internal_has_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Indexlet::has_table_id() const {
+  return _internal_has_table_id();
+}
+inline void Indexlet::clear_table_id() {
+  _impl_.table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t Indexlet::_internal_table_id() const {
+  return _impl_.table_id_;
+}
+inline uint64_t Indexlet::table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Indexlet.table_id)
+  return _internal_table_id();
+}
+inline void Indexlet::_internal_set_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.table_id_ = value;
+}
+inline void Indexlet::set_table_id(uint64_t value) {
+  _internal_set_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Indexlet.table_id)
+}
+
+// required uint32 index_id = 2;
+inline bool Indexlet::_internal_has_index_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Indexlet::has_index_id() const {
+  return _internal_has_index_id();
+}
+inline void Indexlet::clear_index_id() {
+  _impl_.index_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t Indexlet::_internal_index_id() const {
+  return _impl_.index_id_;
+}
+inline uint32_t Indexlet::index_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Indexlet.index_id)
+  return _internal_index_id();
+}
+inline void Indexlet::_internal_set_index_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.index_id_ = value;
+}
+inline void Indexlet::set_index_id(uint32_t value) {
+  _internal_set_index_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Indexlet.index_id)
+}
+
+// required uint64 backing_table_id = 3;
+inline bool Indexlet::_internal_has_backing_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Indexlet::has_backing_table_id() const {
+  return _internal_has_backing_table_id();
+}
+inline void Indexlet::clear_backing_table_id() {
+  _impl_.backing_table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t Indexlet::_internal_backing_table_id() const {
+  return _impl_.backing_table_id_;
+}
+inline uint64_t Indexlet::backing_table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Indexlet.backing_table_id)
+  return _internal_backing_table_id();
+}
+inline void Indexlet::_internal_set_backing_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.backing_table_id_ = value;
+}
+inline void Indexlet::set_backing_table_id(uint64_t value) {
+  _internal_set_backing_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Indexlet.backing_table_id)
+}
+
+// optional bytes first_key = 4;
+inline bool Indexlet::_internal_has_first_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Indexlet::has_first_key() const {
+  return _internal_has_first_key();
+}
+inline void Indexlet::clear_first_key() {
+  _impl_.first_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Indexlet::first_key() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Indexlet.first_key)
+  return _internal_first_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Indexlet::set_first_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.first_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Indexlet.first_key)
+}
+inline std::string* Indexlet::mutable_first_key() {
+  std::string* _s = _internal_mutable_first_key();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Indexlet.first_key)
+  return _s;
+}
+inline const std::string& Indexlet::_internal_first_key() const {
+  return _impl_.first_key_.Get();
+}
+inline void Indexlet::_internal_set_first_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.first_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Indexlet::_internal_mutable_first_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.first_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Indexlet::release_first_key() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Indexlet.first_key)
+  if (!_internal_has_first_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.first_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_key_.IsDefault()) {
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Indexlet::set_allocated_first_key(std::string* first_key) {
+  if (first_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.first_key_.SetAllocated(first_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_key_.IsDefault()) {
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Indexlet.first_key)
+}
+
+// optional bytes first_not_owned_key = 5;
+inline bool Indexlet::_internal_has_first_not_owned_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Indexlet::has_first_not_owned_key() const {
+  return _internal_has_first_not_owned_key();
+}
+inline void Indexlet::clear_first_not_owned_key() {
+  _impl_.first_not_owned_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Indexlet::first_not_owned_key() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Indexlet.first_not_owned_key)
+  return _internal_first_not_owned_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Indexlet::set_first_not_owned_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.first_not_owned_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Indexlet.first_not_owned_key)
+}
+inline std::string* Indexlet::mutable_first_not_owned_key() {
+  std::string* _s = _internal_mutable_first_not_owned_key();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Indexlet.first_not_owned_key)
+  return _s;
+}
+inline const std::string& Indexlet::_internal_first_not_owned_key() const {
+  return _impl_.first_not_owned_key_.Get();
+}
+inline void Indexlet::_internal_set_first_not_owned_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.first_not_owned_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Indexlet::_internal_mutable_first_not_owned_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.first_not_owned_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Indexlet::release_first_not_owned_key() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Indexlet.first_not_owned_key)
+  if (!_internal_has_first_not_owned_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.first_not_owned_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_not_owned_key_.IsDefault()) {
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Indexlet::set_allocated_first_not_owned_key(std::string* first_not_owned_key) {
+  if (first_not_owned_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.first_not_owned_key_.SetAllocated(first_not_owned_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_not_owned_key_.IsDefault()) {
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Indexlet.first_not_owned_key)
+}
+
+// optional fixed64 server_id = 6;
+inline bool Indexlet::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Indexlet::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void Indexlet::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t Indexlet::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t Indexlet::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Indexlet.server_id)
+  return _internal_server_id();
+}
+inline void Indexlet::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.server_id_ = value;
+}
+inline void Indexlet::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Indexlet.server_id)
+}
+
+// optional string service_locator = 7;
+inline bool Indexlet::_internal_has_service_locator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Indexlet::has_service_locator() const {
+  return _internal_has_service_locator();
+}
+inline void Indexlet::clear_service_locator() {
+  _impl_.service_locator_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Indexlet::service_locator() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Indexlet.service_locator)
+  return _internal_service_locator();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Indexlet::set_service_locator(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.service_locator_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Indexlet.service_locator)
+}
+inline std::string* Indexlet::mutable_service_locator() {
+  std::string* _s = _internal_mutable_service_locator();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Indexlet.service_locator)
+  return _s;
+}
+inline const std::string& Indexlet::_internal_service_locator() const {
+  return _impl_.service_locator_.Get();
+}
+inline void Indexlet::_internal_set_service_locator(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.service_locator_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Indexlet::_internal_mutable_service_locator() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.service_locator_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Indexlet::release_service_locator() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Indexlet.service_locator)
+  if (!_internal_has_service_locator()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.service_locator_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Indexlet::set_allocated_service_locator(std::string* service_locator) {
+  if (service_locator != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.service_locator_.SetAllocated(service_locator, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Indexlet.service_locator)
+}
+
+// optional fixed64 user_data = 8;
+inline bool Indexlet::_internal_has_user_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Indexlet::has_user_data() const {
+  return _internal_has_user_data();
+}
+inline void Indexlet::clear_user_data() {
+  _impl_.user_data_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t Indexlet::_internal_user_data() const {
+  return _impl_.user_data_;
+}
+inline uint64_t Indexlet::user_data() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Indexlet.user_data)
+  return _internal_user_data();
+}
+inline void Indexlet::_internal_set_user_data(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.user_data_ = value;
+}
+inline void Indexlet::set_user_data(uint64_t value) {
+  _internal_set_user_data(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Indexlet.user_data)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_Indexlet_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,339 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: MasterRecoveryInfo.proto
+
+#include "MasterRecoveryInfo.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR MasterRecoveryInfo::MasterRecoveryInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.min_open_segment_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.min_open_segment_epoch_)*/uint64_t{0u}} {}
+struct MasterRecoveryInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MasterRecoveryInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MasterRecoveryInfoDefaultTypeInternal() {}
+  union {
+    MasterRecoveryInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MasterRecoveryInfoDefaultTypeInternal _MasterRecoveryInfo_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_MasterRecoveryInfo_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_MasterRecoveryInfo_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_MasterRecoveryInfo_2eproto = nullptr;
+
+const uint32_t TableStruct_MasterRecoveryInfo_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo, _impl_.min_open_segment_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::MasterRecoveryInfo, _impl_.min_open_segment_epoch_),
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::RAMCloud::ProtoBuf::MasterRecoveryInfo)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_MasterRecoveryInfo_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_MasterRecoveryInfo_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\030MasterRecoveryInfo.proto\022\021RAMCloud.Pro"
+  "toBuf\"W\n\022MasterRecoveryInfo\022\036\n\023min_open_"
+  "segment_id\030\001 \001(\004:\0010\022!\n\026min_open_segment_"
+  "epoch\030\002 \001(\004:\0010"
+  ;
+static ::_pbi::once_flag descriptor_table_MasterRecoveryInfo_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_MasterRecoveryInfo_2eproto = {
+    false, false, 134, descriptor_table_protodef_MasterRecoveryInfo_2eproto,
+    "MasterRecoveryInfo.proto",
+    &descriptor_table_MasterRecoveryInfo_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_MasterRecoveryInfo_2eproto::offsets,
+    file_level_metadata_MasterRecoveryInfo_2eproto, file_level_enum_descriptors_MasterRecoveryInfo_2eproto,
+    file_level_service_descriptors_MasterRecoveryInfo_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_MasterRecoveryInfo_2eproto_getter() {
+  return &descriptor_table_MasterRecoveryInfo_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_MasterRecoveryInfo_2eproto(&descriptor_table_MasterRecoveryInfo_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class MasterRecoveryInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MasterRecoveryInfo>()._impl_._has_bits_);
+  static void set_has_min_open_segment_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_min_open_segment_epoch(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+MasterRecoveryInfo::MasterRecoveryInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+}
+MasterRecoveryInfo::MasterRecoveryInfo(const MasterRecoveryInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MasterRecoveryInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_open_segment_id_){}
+    , decltype(_impl_.min_open_segment_epoch_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_open_segment_id_, &from._impl_.min_open_segment_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.min_open_segment_epoch_) -
+    reinterpret_cast<char*>(&_impl_.min_open_segment_id_)) + sizeof(_impl_.min_open_segment_epoch_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+}
+
+inline void MasterRecoveryInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_open_segment_id_){uint64_t{0u}}
+    , decltype(_impl_.min_open_segment_epoch_){uint64_t{0u}}
+  };
+}
+
+MasterRecoveryInfo::~MasterRecoveryInfo() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MasterRecoveryInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MasterRecoveryInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MasterRecoveryInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.min_open_segment_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.min_open_segment_epoch_) -
+        reinterpret_cast<char*>(&_impl_.min_open_segment_id_)) + sizeof(_impl_.min_open_segment_epoch_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MasterRecoveryInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint64 min_open_segment_id = 1 [default = 0];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_min_open_segment_id(&has_bits);
+          _impl_.min_open_segment_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 min_open_segment_epoch = 2 [default = 0];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_min_open_segment_epoch(&has_bits);
+          _impl_.min_open_segment_epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MasterRecoveryInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint64 min_open_segment_id = 1 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_min_open_segment_id(), target);
+  }
+
+  // optional uint64 min_open_segment_epoch = 2 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_min_open_segment_epoch(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  return target;
+}
+
+size_t MasterRecoveryInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint64 min_open_segment_id = 1 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min_open_segment_id());
+    }
+
+    // optional uint64 min_open_segment_epoch = 2 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min_open_segment_epoch());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MasterRecoveryInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MasterRecoveryInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MasterRecoveryInfo::GetClassData() const { return &_class_data_; }
+
+
+void MasterRecoveryInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MasterRecoveryInfo*>(&to_msg);
+  auto& from = static_cast<const MasterRecoveryInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.min_open_segment_id_ = from._impl_.min_open_segment_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.min_open_segment_epoch_ = from._impl_.min_open_segment_epoch_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MasterRecoveryInfo::CopyFrom(const MasterRecoveryInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.MasterRecoveryInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MasterRecoveryInfo::IsInitialized() const {
+  return true;
+}
+
+void MasterRecoveryInfo::InternalSwap(MasterRecoveryInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MasterRecoveryInfo, _impl_.min_open_segment_epoch_)
+      + sizeof(MasterRecoveryInfo::_impl_.min_open_segment_epoch_)
+      - PROTOBUF_FIELD_OFFSET(MasterRecoveryInfo, _impl_.min_open_segment_id_)>(
+          reinterpret_cast<char*>(&_impl_.min_open_segment_id_),
+          reinterpret_cast<char*>(&other->_impl_.min_open_segment_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MasterRecoveryInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_MasterRecoveryInfo_2eproto_getter, &descriptor_table_MasterRecoveryInfo_2eproto_once,
+      file_level_metadata_MasterRecoveryInfo_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::MasterRecoveryInfo*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::MasterRecoveryInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::MasterRecoveryInfo >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,319 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ProtoBufTest.proto
+
+#include "ProtoBufTest.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR TestMessage::TestMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.foo_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct TestMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestMessageDefaultTypeInternal() {}
+  union {
+    TestMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestMessageDefaultTypeInternal _TestMessage_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_ProtoBufTest_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ProtoBufTest_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ProtoBufTest_2eproto = nullptr;
+
+const uint32_t TableStruct_ProtoBufTest_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TestMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TestMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::TestMessage, _impl_.foo_),
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 7, -1, sizeof(::RAMCloud::ProtoBuf::TestMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_TestMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ProtoBufTest_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022ProtoBufTest.proto\022\021RAMCloud.ProtoBuf\""
+  "\032\n\013TestMessage\022\013\n\003foo\030\001 \002(\t"
+  ;
+static ::_pbi::once_flag descriptor_table_ProtoBufTest_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ProtoBufTest_2eproto = {
+    false, false, 67, descriptor_table_protodef_ProtoBufTest_2eproto,
+    "ProtoBufTest.proto",
+    &descriptor_table_ProtoBufTest_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_ProtoBufTest_2eproto::offsets,
+    file_level_metadata_ProtoBufTest_2eproto, file_level_enum_descriptors_ProtoBufTest_2eproto,
+    file_level_service_descriptors_ProtoBufTest_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ProtoBufTest_2eproto_getter() {
+  return &descriptor_table_ProtoBufTest_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ProtoBufTest_2eproto(&descriptor_table_ProtoBufTest_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class TestMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestMessage>()._impl_._has_bits_);
+  static void set_has_foo(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+TestMessage::TestMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.TestMessage)
+}
+TestMessage::TestMessage(const TestMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TestMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.foo_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.foo_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.foo_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_foo()) {
+    _this->_impl_.foo_.Set(from._internal_foo(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.TestMessage)
+}
+
+inline void TestMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.foo_){}
+  };
+  _impl_.foo_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.foo_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TestMessage::~TestMessage() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.TestMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TestMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.foo_.Destroy();
+}
+
+void TestMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TestMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.TestMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.foo_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TestMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string foo = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_foo();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.TestMessage.foo");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TestMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.TestMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string foo = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_foo().data(), static_cast<int>(this->_internal_foo().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.TestMessage.foo");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_foo(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.TestMessage)
+  return target;
+}
+
+size_t TestMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.TestMessage)
+  size_t total_size = 0;
+
+  // required string foo = 1;
+  if (_internal_has_foo()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_foo());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TestMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TestMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TestMessage::GetClassData() const { return &_class_data_; }
+
+
+void TestMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TestMessage*>(&to_msg);
+  auto& from = static_cast<const TestMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.TestMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_foo()) {
+    _this->_internal_set_foo(from._internal_foo());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TestMessage::CopyFrom(const TestMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.TestMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void TestMessage::InternalSwap(TestMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.foo_, lhs_arena,
+      &other->_impl_.foo_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TestMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ProtoBufTest_2eproto_getter, &descriptor_table_ProtoBufTest_2eproto_once,
+      file_level_metadata_ProtoBufTest_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::TestMessage*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::TestMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::TestMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,2712 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerConfig.proto
+
+#include "ServerConfig.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR ServerConfig_Master::ServerConfig_Master(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.cleaner_balancer_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.log_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.hash_table_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.backup_disk_expansion_factor_)*/0
+  , /*decltype(_impl_.cleaner_write_cost_threshold_)*/0u
+  , /*decltype(_impl_.disable_log_cleaner_)*/false
+  , /*decltype(_impl_.disable_in_memory_cleaning_)*/false
+  , /*decltype(_impl_.use_mincopysets_)*/false
+  , /*decltype(_impl_.use_local_backup_)*/false
+  , /*decltype(_impl_.cleaner_thread_count_)*/0u
+  , /*decltype(_impl_.num_replicas_)*/0u
+  , /*decltype(_impl_.max_hash_table_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.num_log_heads_)*/0u
+  , /*decltype(_impl_.sync_group_commit_micros_)*/0u
+  , /*decltype(_impl_.cold_compression_seconds_)*/0u
+  , /*decltype(_impl_.recovery_replay_threads_)*/0u
+  , /*decltype(_impl_.segregate_hot_writes_)*/false
+  , /*decltype(_impl_.chain_replication_)*/false
+  , /*decltype(_impl_.coalesce_backup_writes_)*/false} {}
+struct ServerConfig_MasterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerConfig_MasterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerConfig_MasterDefaultTypeInternal() {}
+  union {
+    ServerConfig_Master _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerConfig_MasterDefaultTypeInternal _ServerConfig_Master_default_instance_;
+PROTOBUF_CONSTEXPR ServerConfig_Backup::ServerConfig_Backup(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.file_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.num_segment_frames_)*/0u
+  , /*decltype(_impl_.max_non_volatile_buffers_)*/0u
+  , /*decltype(_impl_.strategy_)*/0
+  , /*decltype(_impl_.gc_)*/false
+  , /*decltype(_impl_.in_memory_)*/false
+  , /*decltype(_impl_.io_uring_)*/false
+  , /*decltype(_impl_.persistent_memory_)*/false
+  , /*decltype(_impl_.write_rate_limit_)*/uint64_t{0u}
+  , /*decltype(_impl_.mock_speed_)*/0u
+  , /*decltype(_impl_.recovery_build_threads_)*/0u
+  , /*decltype(_impl_.max_recovery_replicas_)*/0u} {}
+struct ServerConfig_BackupDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerConfig_BackupDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerConfig_BackupDefaultTypeInternal() {}
+  union {
+    ServerConfig_Backup _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerConfig_BackupDefaultTypeInternal _ServerConfig_Backup_default_instance_;
+PROTOBUF_CONSTEXPR ServerConfig::ServerConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.coordinator_locator_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.local_locator_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cluster_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.services_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.rpc_class_weights_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.master_)*/nullptr
+  , /*decltype(_impl_.backup_)*/nullptr
+  , /*decltype(_impl_.segment_size_)*/0u
+  , /*decltype(_impl_.seglet_size_)*/0u
+  , /*decltype(_impl_.max_object_data_size_)*/0u
+  , /*decltype(_impl_.max_object_key_size_)*/0u
+  , /*decltype(_impl_.detect_failures_)*/false
+  , /*decltype(_impl_.pin_memory_)*/false
+  , /*decltype(_impl_.inline_short_rpcs_)*/false
+  , /*decltype(_impl_.elastic_worker_cores_)*/false
+  , /*decltype(_impl_.max_cores_)*/0u
+  , /*decltype(_impl_.dispatch_threads_)*/0u
+  , /*decltype(_impl_.background_rpc_limit_)*/0u} {}
+struct ServerConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerConfigDefaultTypeInternal() {}
+  union {
+    ServerConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerConfigDefaultTypeInternal _ServerConfig_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_ServerConfig_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ServerConfig_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ServerConfig_2eproto = nullptr;
+
+const uint32_t TableStruct_ServerConfig_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.log_bytes_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.hash_table_bytes_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.disable_log_cleaner_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.disable_in_memory_cleaning_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.backup_disk_expansion_factor_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.cleaner_write_cost_threshold_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.cleaner_balancer_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.cleaner_thread_count_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.num_replicas_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.use_mincopysets_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.use_local_backup_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.max_hash_table_bytes_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.num_log_heads_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.sync_group_commit_micros_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.segregate_hot_writes_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.cold_compression_seconds_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.recovery_replay_threads_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.chain_replication_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Master, _impl_.coalesce_backup_writes_),
+  1,
+  2,
+  5,
+  6,
+  3,
+  4,
+  0,
+  9,
+  10,
+  7,
+  8,
+  11,
+  12,
+  13,
+  16,
+  14,
+  15,
+  17,
+  18,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.gc_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.in_memory_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.num_segment_frames_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.max_non_volatile_buffers_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.max_recovery_replicas_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.file_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.strategy_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.mock_speed_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.write_rate_limit_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.recovery_build_threads_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.io_uring_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig_Backup, _impl_.persistent_memory_),
+  4,
+  5,
+  1,
+  2,
+  11,
+  0,
+  3,
+  9,
+  8,
+  10,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.coordinator_locator_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.local_locator_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.cluster_name_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.services_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.detect_failures_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.pin_memory_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.segment_size_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.seglet_size_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.max_object_data_size_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.max_object_key_size_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.max_cores_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.dispatch_threads_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.inline_short_rpcs_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.elastic_worker_cores_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.rpc_class_weights_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.background_rpc_limit_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.master_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerConfig, _impl_.backup_),
+  0,
+  1,
+  2,
+  3,
+  11,
+  12,
+  7,
+  8,
+  9,
+  10,
+  15,
+  16,
+  13,
+  14,
+  4,
+  17,
+  5,
+  6,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 25, -1, sizeof(::RAMCloud::ProtoBuf::ServerConfig_Master)},
+  { 44, 62, -1, sizeof(::RAMCloud::ProtoBuf::ServerConfig_Backup)},
+  { 74, 98, -1, sizeof(::RAMCloud::ProtoBuf::ServerConfig)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_ServerConfig_Master_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_ServerConfig_Backup_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_ServerConfig_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ServerConfig_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022ServerConfig.proto\022\021RAMCloud.ProtoBuf\""
+  "\347\n\n\014ServerConfig\022\033\n\023coordinator_locator\030"
+  "\001 \002(\t\022\025\n\rlocal_locator\030\002 \002(\t\022\024\n\014cluster_"
+  "name\030\003 \002(\t\022\020\n\010services\030\004 \002(\t\022\027\n\017detect_f"
+  "ailures\030\005 \002(\010\022\022\n\npin_memory\030\006 \002(\010\022\024\n\014seg"
+  "ment_size\030\007 \002(\007\022\023\n\013seglet_size\030\010 \002(\007\022\034\n\024"
+  "max_object_data_size\030\t \002(\007\022\033\n\023max_object"
+  "_key_size\030\n \002(\007\022\021\n\tmax_cores\030\013 \002(\007\022\030\n\020di"
+  "spatch_threads\030\016 \002(\007\022\031\n\021inline_short_rpc"
+  "s\030\017 \002(\010\022\034\n\024elastic_worker_cores\030\020 \002(\010\022\031\n"
+  "\021rpc_class_weights\030\021 \002(\t\022\034\n\024background_r"
+  "pc_limit\030\022 \002(\007\0226\n\006master\030\014 \001(\0132&.RAMClou"
+  "d.ProtoBuf.ServerConfig.Master\0226\n\006backup"
+  "\030\r \001(\0132&.RAMCloud.ProtoBuf.ServerConfig."
+  "Backup\032\266\004\n\006Master\022\021\n\tlog_bytes\030\001 \002(\006\022\030\n\020"
+  "hash_table_bytes\030\002 \002(\006\022\033\n\023disable_log_cl"
+  "eaner\030\003 \002(\010\022\"\n\032disable_in_memory_cleanin"
+  "g\030\004 \002(\010\022$\n\034backup_disk_expansion_factor\030"
+  "\005 \002(\001\022$\n\034cleaner_write_cost_threshold\030\006 "
+  "\002(\007\022\030\n\020cleaner_balancer\030\007 \002(\t\022\034\n\024cleaner"
+  "_thread_count\030\010 \002(\007\022\024\n\014num_replicas\030\t \002("
+  "\007\022\027\n\017use_mincopysets\030\n \002(\010\022\030\n\020use_local_"
+  "backup\030\013 \002(\010\022\034\n\024max_hash_table_bytes\030\014 \002"
+  "(\006\022\025\n\rnum_log_heads\030\r \002(\007\022 \n\030sync_group_"
+  "commit_micros\030\016 \002(\007\022\034\n\024segregate_hot_wri"
+  "tes\030\017 \002(\010\022 \n\030cold_compression_seconds\030\020 "
+  "\002(\007\022\037\n\027recovery_replay_threads\030\021 \002(\007\022\031\n\021"
+  "chain_replication\030\022 \002(\010\022\036\n\026coalesce_back"
+  "up_writes\030\023 \002(\010\032\237\002\n\006Backup\022\n\n\002gc\030\001 \002(\010\022\021"
+  "\n\tin_memory\030\002 \002(\010\022\032\n\022num_segment_frames\030"
+  "\003 \002(\007\022 \n\030max_non_volatile_buffers\030\004 \002(\007\022"
+  "\035\n\025max_recovery_replicas\030\024 \002(\007\022\014\n\004file\030\005"
+  " \001(\t\022\020\n\010strategy\030\006 \002(\005\022\022\n\nmock_speed\030\007 \002"
+  "(\007\022\030\n\020write_rate_limit\030\010 \002(\006\022\036\n\026recovery"
+  "_build_threads\030\t \002(\007\022\020\n\010io_uring\030\n \002(\010\022\031"
+  "\n\021persistent_memory\030\013 \002(\010"
+  ;
+static ::_pbi::once_flag descriptor_table_ServerConfig_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ServerConfig_2eproto = {
+    false, false, 1425, descriptor_table_protodef_ServerConfig_2eproto,
+    "ServerConfig.proto",
+    &descriptor_table_ServerConfig_2eproto_once, nullptr, 0, 3,
+    schemas, file_default_instances, TableStruct_ServerConfig_2eproto::offsets,
+    file_level_metadata_ServerConfig_2eproto, file_level_enum_descriptors_ServerConfig_2eproto,
+    file_level_service_descriptors_ServerConfig_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ServerConfig_2eproto_getter() {
+  return &descriptor_table_ServerConfig_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ServerConfig_2eproto(&descriptor_table_ServerConfig_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerConfig_Master::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerConfig_Master>()._impl_._has_bits_);
+  static void set_has_log_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_hash_table_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_disable_log_cleaner(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_disable_in_memory_cleaning(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_backup_disk_expansion_factor(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_cleaner_write_cost_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cleaner_balancer(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_cleaner_thread_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_num_replicas(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_use_mincopysets(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_use_local_backup(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_max_hash_table_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_num_log_heads(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_sync_group_commit_micros(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_segregate_hot_writes(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_cold_compression_seconds(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_recovery_replay_threads(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_chain_replication(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_coalesce_backup_writes(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0007ffff) ^ 0x0007ffff) != 0;
+  }
+};
+
+ServerConfig_Master::ServerConfig_Master(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerConfig.Master)
+}
+ServerConfig_Master::ServerConfig_Master(const ServerConfig_Master& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerConfig_Master* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cleaner_balancer_){}
+    , decltype(_impl_.log_bytes_){}
+    , decltype(_impl_.hash_table_bytes_){}
+    , decltype(_impl_.backup_disk_expansion_factor_){}
+    , decltype(_impl_.cleaner_write_cost_threshold_){}
+    , decltype(_impl_.disable_log_cleaner_){}
+    , decltype(_impl_.disable_in_memory_cleaning_){}
+    , decltype(_impl_.use_mincopysets_){}
+    , decltype(_impl_.use_local_backup_){}
+    , decltype(_impl_.cleaner_thread_count_){}
+    , decltype(_impl_.num_replicas_){}
+    , decltype(_impl_.max_hash_table_bytes_){}
+    , decltype(_impl_.num_log_heads_){}
+    , decltype(_impl_.sync_group_commit_micros_){}
+    , decltype(_impl_.cold_compression_seconds_){}
+    , decltype(_impl_.recovery_replay_threads_){}
+    , decltype(_impl_.segregate_hot_writes_){}
+    , decltype(_impl_.chain_replication_){}
+    , decltype(_impl_.coalesce_backup_writes_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.cleaner_balancer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cleaner_balancer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_cleaner_balancer()) {
+    _this->_impl_.cleaner_balancer_.Set(from._internal_cleaner_balancer(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.log_bytes_, &from._impl_.log_bytes_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.coalesce_backup_writes_) -
+    reinterpret_cast<char*>(&_impl_.log_bytes_)) + sizeof(_impl_.coalesce_backup_writes_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerConfig.Master)
+}
+
+inline void ServerConfig_Master::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cleaner_balancer_){}
+    , decltype(_impl_.log_bytes_){uint64_t{0u}}
+    , decltype(_impl_.hash_table_bytes_){uint64_t{0u}}
+    , decltype(_impl_.backup_disk_expansion_factor_){0}
+    , decltype(_impl_.cleaner_write_cost_threshold_){0u}
+    , decltype(_impl_.disable_log_cleaner_){false}
+    , decltype(_impl_.disable_in_memory_cleaning_){false}
+    , decltype(_impl_.use_mincopysets_){false}
+    , decltype(_impl_.use_local_backup_){false}
+    , decltype(_impl_.cleaner_thread_count_){0u}
+    , decltype(_impl_.num_replicas_){0u}
+    , decltype(_impl_.max_hash_table_bytes_){uint64_t{0u}}
+    , decltype(_impl_.num_log_heads_){0u}
+    , decltype(_impl_.sync_group_commit_micros_){0u}
+    , decltype(_impl_.cold_compression_seconds_){0u}
+    , decltype(_impl_.recovery_replay_threads_){0u}
+    , decltype(_impl_.segregate_hot_writes_){false}
+    , decltype(_impl_.chain_replication_){false}
+    , decltype(_impl_.coalesce_backup_writes_){false}
+  };
+  _impl_.cleaner_balancer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cleaner_balancer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ServerConfig_Master::~ServerConfig_Master() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerConfig.Master)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerConfig_Master::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cleaner_balancer_.Destroy();
+}
+
+void ServerConfig_Master::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerConfig_Master::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerConfig.Master)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.cleaner_balancer_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.log_bytes_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.use_mincopysets_) -
+        reinterpret_cast<char*>(&_impl_.log_bytes_)) + sizeof(_impl_.use_mincopysets_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.use_local_backup_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.recovery_replay_threads_) -
+        reinterpret_cast<char*>(&_impl_.use_local_backup_)) + sizeof(_impl_.recovery_replay_threads_));
+  }
+  if (cached_has_bits & 0x00070000u) {
+    ::memset(&_impl_.segregate_hot_writes_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.coalesce_backup_writes_) -
+        reinterpret_cast<char*>(&_impl_.segregate_hot_writes_)) + sizeof(_impl_.coalesce_backup_writes_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerConfig_Master::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed64 log_bytes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_log_bytes(&has_bits);
+          _impl_.log_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 hash_table_bytes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_hash_table_bytes(&has_bits);
+          _impl_.hash_table_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool disable_log_cleaner = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_disable_log_cleaner(&has_bits);
+          _impl_.disable_log_cleaner_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool disable_in_memory_cleaning = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_disable_in_memory_cleaning(&has_bits);
+          _impl_.disable_in_memory_cleaning_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double backup_disk_expansion_factor = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_backup_disk_expansion_factor(&has_bits);
+          _impl_.backup_disk_expansion_factor_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 cleaner_write_cost_threshold = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _Internal::set_has_cleaner_write_cost_threshold(&has_bits);
+          _impl_.cleaner_write_cost_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string cleaner_balancer = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_cleaner_balancer();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerConfig.Master.cleaner_balancer");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 cleaner_thread_count = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_cleaner_thread_count(&has_bits);
+          _impl_.cleaner_thread_count_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 num_replicas = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _Internal::set_has_num_replicas(&has_bits);
+          _impl_.num_replicas_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool use_mincopysets = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_use_mincopysets(&has_bits);
+          _impl_.use_mincopysets_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool use_local_backup = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_use_local_backup(&has_bits);
+          _impl_.use_local_backup_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 max_hash_table_bytes = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_max_hash_table_bytes(&has_bits);
+          _impl_.max_hash_table_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 num_log_heads = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 109)) {
+          _Internal::set_has_num_log_heads(&has_bits);
+          _impl_.num_log_heads_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 sync_group_commit_micros = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 117)) {
+          _Internal::set_has_sync_group_commit_micros(&has_bits);
+          _impl_.sync_group_commit_micros_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool segregate_hot_writes = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_segregate_hot_writes(&has_bits);
+          _impl_.segregate_hot_writes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 cold_compression_seconds = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 133)) {
+          _Internal::set_has_cold_compression_seconds(&has_bits);
+          _impl_.cold_compression_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 recovery_replay_threads = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 141)) {
+          _Internal::set_has_recovery_replay_threads(&has_bits);
+          _impl_.recovery_replay_threads_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool chain_replication = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _Internal::set_has_chain_replication(&has_bits);
+          _impl_.chain_replication_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool coalesce_backup_writes = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_coalesce_backup_writes(&has_bits);
+          _impl_.coalesce_backup_writes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerConfig_Master::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerConfig.Master)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed64 log_bytes = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_log_bytes(), target);
+  }
+
+  // required fixed64 hash_table_bytes = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_hash_table_bytes(), target);
+  }
+
+  // required bool disable_log_cleaner = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_disable_log_cleaner(), target);
+  }
+
+  // required bool disable_in_memory_cleaning = 4;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_disable_in_memory_cleaning(), target);
+  }
+
+  // required double backup_disk_expansion_factor = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_backup_disk_expansion_factor(), target);
+  }
+
+  // required fixed32 cleaner_write_cost_threshold = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(6, this->_internal_cleaner_write_cost_threshold(), target);
+  }
+
+  // required string cleaner_balancer = 7;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_cleaner_balancer().data(), static_cast<int>(this->_internal_cleaner_balancer().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerConfig.Master.cleaner_balancer");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_cleaner_balancer(), target);
+  }
+
+  // required fixed32 cleaner_thread_count = 8;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(8, this->_internal_cleaner_thread_count(), target);
+  }
+
+  // required fixed32 num_replicas = 9;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(9, this->_internal_num_replicas(), target);
+  }
+
+  // required bool use_mincopysets = 10;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_use_mincopysets(), target);
+  }
+
+  // required bool use_local_backup = 11;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_use_local_backup(), target);
+  }
+
+  // required fixed64 max_hash_table_bytes = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(12, this->_internal_max_hash_table_bytes(), target);
+  }
+
+  // required fixed32 num_log_heads = 13;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(13, this->_internal_num_log_heads(), target);
+  }
+
+  // required fixed32 sync_group_commit_micros = 14;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(14, this->_internal_sync_group_commit_micros(), target);
+  }
+
+  // required bool segregate_hot_writes = 15;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(15, this->_internal_segregate_hot_writes(), target);
+  }
+
+  // required fixed32 cold_compression_seconds = 16;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(16, this->_internal_cold_compression_seconds(), target);
+  }
+
+  // required fixed32 recovery_replay_threads = 17;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(17, this->_internal_recovery_replay_threads(), target);
+  }
+
+  // required bool chain_replication = 18;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(18, this->_internal_chain_replication(), target);
+  }
+
+  // required bool coalesce_backup_writes = 19;
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(19, this->_internal_coalesce_backup_writes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerConfig.Master)
+  return target;
+}
+
+size_t ServerConfig_Master::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerConfig.Master)
+  size_t total_size = 0;
+
+  if (_internal_has_cleaner_balancer()) {
+    // required string cleaner_balancer = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cleaner_balancer());
+  }
+
+  if (_internal_has_log_bytes()) {
+    // required fixed64 log_bytes = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_hash_table_bytes()) {
+    // required fixed64 hash_table_bytes = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_backup_disk_expansion_factor()) {
+    // required double backup_disk_expansion_factor = 5;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_cleaner_write_cost_threshold()) {
+    // required fixed32 cleaner_write_cost_threshold = 6;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_disable_log_cleaner()) {
+    // required bool disable_log_cleaner = 3;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_disable_in_memory_cleaning()) {
+    // required bool disable_in_memory_cleaning = 4;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_use_mincopysets()) {
+    // required bool use_mincopysets = 10;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_use_local_backup()) {
+    // required bool use_local_backup = 11;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_cleaner_thread_count()) {
+    // required fixed32 cleaner_thread_count = 8;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_num_replicas()) {
+    // required fixed32 num_replicas = 9;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_max_hash_table_bytes()) {
+    // required fixed64 max_hash_table_bytes = 12;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_num_log_heads()) {
+    // required fixed32 num_log_heads = 13;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_sync_group_commit_micros()) {
+    // required fixed32 sync_group_commit_micros = 14;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_cold_compression_seconds()) {
+    // required fixed32 cold_compression_seconds = 16;
+    total_size += 2 + 4;
+  }
+
+  if (_internal_has_recovery_replay_threads()) {
+    // required fixed32 recovery_replay_threads = 17;
+    total_size += 2 + 4;
+  }
+
+  if (_internal_has_segregate_hot_writes()) {
+    // required bool segregate_hot_writes = 15;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_chain_replication()) {
+    // required bool chain_replication = 18;
+    total_size += 2 + 1;
+  }
+
+  if (_internal_has_coalesce_backup_writes()) {
+    // required bool coalesce_backup_writes = 19;
+    total_size += 2 + 1;
+  }
+
+  return total_size;
+}
+size_t ServerConfig_Master::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerConfig.Master)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0007ffff) ^ 0x0007ffff) == 0) {  // All required fields are present.
+    // required string cleaner_balancer = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cleaner_balancer());
+
+    // required fixed64 log_bytes = 1;
+    total_size += 1 + 8;
+
+    // required fixed64 hash_table_bytes = 2;
+    total_size += 1 + 8;
+
+    // required double backup_disk_expansion_factor = 5;
+    total_size += 1 + 8;
+
+    // required fixed32 cleaner_write_cost_threshold = 6;
+    total_size += 1 + 4;
+
+    // required bool disable_log_cleaner = 3;
+    total_size += 1 + 1;
+
+    // required bool disable_in_memory_cleaning = 4;
+    total_size += 1 + 1;
+
+    // required bool use_mincopysets = 10;
+    total_size += 1 + 1;
+
+    // required bool use_local_backup = 11;
+    total_size += 1 + 1;
+
+    // required fixed32 cleaner_thread_count = 8;
+    total_size += 1 + 4;
+
+    // required fixed32 num_replicas = 9;
+    total_size += 1 + 4;
+
+    // required fixed64 max_hash_table_bytes = 12;
+    total_size += 1 + 8;
+
+    // required fixed32 num_log_heads = 13;
+    total_size += 1 + 4;
+
+    // required fixed32 sync_group_commit_micros = 14;
+    total_size += 1 + 4;
+
+    // required fixed32 cold_compression_seconds = 16;
+    total_size += 2 + 4;
+
+    // required fixed32 recovery_replay_threads = 17;
+    total_size += 2 + 4;
+
+    // required bool segregate_hot_writes = 15;
+    total_size += 1 + 1;
+
+    // required bool chain_replication = 18;
+    total_size += 2 + 1;
+
+    // required bool coalesce_backup_writes = 19;
+    total_size += 2 + 1;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerConfig_Master::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerConfig_Master::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerConfig_Master::GetClassData() const { return &_class_data_; }
+
+
+void ServerConfig_Master::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerConfig_Master*>(&to_msg);
+  auto& from = static_cast<const ServerConfig_Master&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerConfig.Master)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_cleaner_balancer(from._internal_cleaner_balancer());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.log_bytes_ = from._impl_.log_bytes_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.hash_table_bytes_ = from._impl_.hash_table_bytes_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.backup_disk_expansion_factor_ = from._impl_.backup_disk_expansion_factor_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.cleaner_write_cost_threshold_ = from._impl_.cleaner_write_cost_threshold_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.disable_log_cleaner_ = from._impl_.disable_log_cleaner_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.disable_in_memory_cleaning_ = from._impl_.disable_in_memory_cleaning_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.use_mincopysets_ = from._impl_.use_mincopysets_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.use_local_backup_ = from._impl_.use_local_backup_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.cleaner_thread_count_ = from._impl_.cleaner_thread_count_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.num_replicas_ = from._impl_.num_replicas_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.max_hash_table_bytes_ = from._impl_.max_hash_table_bytes_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.num_log_heads_ = from._impl_.num_log_heads_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.sync_group_commit_micros_ = from._impl_.sync_group_commit_micros_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.cold_compression_seconds_ = from._impl_.cold_compression_seconds_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.recovery_replay_threads_ = from._impl_.recovery_replay_threads_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00070000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.segregate_hot_writes_ = from._impl_.segregate_hot_writes_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.chain_replication_ = from._impl_.chain_replication_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.coalesce_backup_writes_ = from._impl_.coalesce_backup_writes_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerConfig_Master::CopyFrom(const ServerConfig_Master& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerConfig.Master)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerConfig_Master::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ServerConfig_Master::InternalSwap(ServerConfig_Master* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cleaner_balancer_, lhs_arena,
+      &other->_impl_.cleaner_balancer_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerConfig_Master, _impl_.coalesce_backup_writes_)
+      + sizeof(ServerConfig_Master::_impl_.coalesce_backup_writes_)
+      - PROTOBUF_FIELD_OFFSET(ServerConfig_Master, _impl_.log_bytes_)>(
+          reinterpret_cast<char*>(&_impl_.log_bytes_),
+          reinterpret_cast<char*>(&other->_impl_.log_bytes_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerConfig_Master::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerConfig_2eproto_getter, &descriptor_table_ServerConfig_2eproto_once,
+      file_level_metadata_ServerConfig_2eproto[0]);
+}
+
+// ===================================================================
+
+class ServerConfig_Backup::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerConfig_Backup>()._impl_._has_bits_);
+  static void set_has_gc(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_in_memory(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_num_segment_frames(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_max_non_volatile_buffers(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_max_recovery_replicas(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_file(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_strategy(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_mock_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_write_rate_limit(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_recovery_build_threads(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_io_uring(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_persistent_memory(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000ffe) ^ 0x00000ffe) != 0;
+  }
+};
+
+ServerConfig_Backup::ServerConfig_Backup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerConfig.Backup)
+}
+ServerConfig_Backup::ServerConfig_Backup(const ServerConfig_Backup& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerConfig_Backup* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_){}
+    , decltype(_impl_.num_segment_frames_){}
+    , decltype(_impl_.max_non_volatile_buffers_){}
+    , decltype(_impl_.strategy_){}
+    , decltype(_impl_.gc_){}
+    , decltype(_impl_.in_memory_){}
+    , decltype(_impl_.io_uring_){}
+    , decltype(_impl_.persistent_memory_){}
+    , decltype(_impl_.write_rate_limit_){}
+    , decltype(_impl_.mock_speed_){}
+    , decltype(_impl_.recovery_build_threads_){}
+    , decltype(_impl_.max_recovery_replicas_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_file()) {
+    _this->_impl_.file_.Set(from._internal_file(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.num_segment_frames_, &from._impl_.num_segment_frames_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_recovery_replicas_) -
+    reinterpret_cast<char*>(&_impl_.num_segment_frames_)) + sizeof(_impl_.max_recovery_replicas_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerConfig.Backup)
+}
+
+inline void ServerConfig_Backup::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.file_){}
+    , decltype(_impl_.num_segment_frames_){0u}
+    , decltype(_impl_.max_non_volatile_buffers_){0u}
+    , decltype(_impl_.strategy_){0}
+    , decltype(_impl_.gc_){false}
+    , decltype(_impl_.in_memory_){false}
+    , decltype(_impl_.io_uring_){false}
+    , decltype(_impl_.persistent_memory_){false}
+    , decltype(_impl_.write_rate_limit_){uint64_t{0u}}
+    , decltype(_impl_.mock_speed_){0u}
+    , decltype(_impl_.recovery_build_threads_){0u}
+    , decltype(_impl_.max_recovery_replicas_){0u}
+  };
+  _impl_.file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ServerConfig_Backup::~ServerConfig_Backup() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerConfig.Backup)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerConfig_Backup::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_.Destroy();
+}
+
+void ServerConfig_Backup::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerConfig_Backup::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerConfig.Backup)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.file_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.num_segment_frames_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.persistent_memory_) -
+        reinterpret_cast<char*>(&_impl_.num_segment_frames_)) + sizeof(_impl_.persistent_memory_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    ::memset(&_impl_.write_rate_limit_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.max_recovery_replicas_) -
+        reinterpret_cast<char*>(&_impl_.write_rate_limit_)) + sizeof(_impl_.max_recovery_replicas_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerConfig_Backup::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bool gc = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_gc(&has_bits);
+          _impl_.gc_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool in_memory = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_in_memory(&has_bits);
+          _impl_.in_memory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 num_segment_frames = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_num_segment_frames(&has_bits);
+          _impl_.num_segment_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 max_non_volatile_buffers = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_max_non_volatile_buffers(&has_bits);
+          _impl_.max_non_volatile_buffers_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string file = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_file();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerConfig.Backup.file");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 strategy = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_strategy(&has_bits);
+          _impl_.strategy_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 mock_speed = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _Internal::set_has_mock_speed(&has_bits);
+          _impl_.mock_speed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 write_rate_limit = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_write_rate_limit(&has_bits);
+          _impl_.write_rate_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 recovery_build_threads = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _Internal::set_has_recovery_build_threads(&has_bits);
+          _impl_.recovery_build_threads_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool io_uring = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_io_uring(&has_bits);
+          _impl_.io_uring_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool persistent_memory = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_persistent_memory(&has_bits);
+          _impl_.persistent_memory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 max_recovery_replicas = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 165)) {
+          _Internal::set_has_max_recovery_replicas(&has_bits);
+          _impl_.max_recovery_replicas_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerConfig_Backup::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerConfig.Backup)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bool gc = 1;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_gc(), target);
+  }
+
+  // required bool in_memory = 2;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_in_memory(), target);
+  }
+
+  // required fixed32 num_segment_frames = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(3, this->_internal_num_segment_frames(), target);
+  }
+
+  // required fixed32 max_non_volatile_buffers = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(4, this->_internal_max_non_volatile_buffers(), target);
+  }
+
+  // optional string file = 5;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_file().data(), static_cast<int>(this->_internal_file().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerConfig.Backup.file");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_file(), target);
+  }
+
+  // required int32 strategy = 6;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_strategy(), target);
+  }
+
+  // required fixed32 mock_speed = 7;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(7, this->_internal_mock_speed(), target);
+  }
+
+  // required fixed64 write_rate_limit = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(8, this->_internal_write_rate_limit(), target);
+  }
+
+  // required fixed32 recovery_build_threads = 9;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(9, this->_internal_recovery_build_threads(), target);
+  }
+
+  // required bool io_uring = 10;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_io_uring(), target);
+  }
+
+  // required bool persistent_memory = 11;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_persistent_memory(), target);
+  }
+
+  // required fixed32 max_recovery_replicas = 20;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(20, this->_internal_max_recovery_replicas(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerConfig.Backup)
+  return target;
+}
+
+size_t ServerConfig_Backup::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerConfig.Backup)
+  size_t total_size = 0;
+
+  if (_internal_has_num_segment_frames()) {
+    // required fixed32 num_segment_frames = 3;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_max_non_volatile_buffers()) {
+    // required fixed32 max_non_volatile_buffers = 4;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_strategy()) {
+    // required int32 strategy = 6;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_strategy());
+  }
+
+  if (_internal_has_gc()) {
+    // required bool gc = 1;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_in_memory()) {
+    // required bool in_memory = 2;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_io_uring()) {
+    // required bool io_uring = 10;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_persistent_memory()) {
+    // required bool persistent_memory = 11;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_write_rate_limit()) {
+    // required fixed64 write_rate_limit = 8;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_mock_speed()) {
+    // required fixed32 mock_speed = 7;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_recovery_build_threads()) {
+    // required fixed32 recovery_build_threads = 9;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_max_recovery_replicas()) {
+    // required fixed32 max_recovery_replicas = 20;
+    total_size += 2 + 4;
+  }
+
+  return total_size;
+}
+size_t ServerConfig_Backup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerConfig.Backup)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000ffe) ^ 0x00000ffe) == 0) {  // All required fields are present.
+    // required fixed32 num_segment_frames = 3;
+    total_size += 1 + 4;
+
+    // required fixed32 max_non_volatile_buffers = 4;
+    total_size += 1 + 4;
+
+    // required int32 strategy = 6;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_strategy());
+
+    // required bool gc = 1;
+    total_size += 1 + 1;
+
+    // required bool in_memory = 2;
+    total_size += 1 + 1;
+
+    // required bool io_uring = 10;
+    total_size += 1 + 1;
+
+    // required bool persistent_memory = 11;
+    total_size += 1 + 1;
+
+    // required fixed64 write_rate_limit = 8;
+    total_size += 1 + 8;
+
+    // required fixed32 mock_speed = 7;
+    total_size += 1 + 4;
+
+    // required fixed32 recovery_build_threads = 9;
+    total_size += 1 + 4;
+
+    // required fixed32 max_recovery_replicas = 20;
+    total_size += 2 + 4;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string file = 5;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerConfig_Backup::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerConfig_Backup::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerConfig_Backup::GetClassData() const { return &_class_data_; }
+
+
+void ServerConfig_Backup::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerConfig_Backup*>(&to_msg);
+  auto& from = static_cast<const ServerConfig_Backup&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerConfig.Backup)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_file(from._internal_file());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.num_segment_frames_ = from._impl_.num_segment_frames_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.max_non_volatile_buffers_ = from._impl_.max_non_volatile_buffers_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.strategy_ = from._impl_.strategy_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.gc_ = from._impl_.gc_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.in_memory_ = from._impl_.in_memory_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.io_uring_ = from._impl_.io_uring_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.persistent_memory_ = from._impl_.persistent_memory_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.write_rate_limit_ = from._impl_.write_rate_limit_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.mock_speed_ = from._impl_.mock_speed_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.recovery_build_threads_ = from._impl_.recovery_build_threads_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.max_recovery_replicas_ = from._impl_.max_recovery_replicas_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerConfig_Backup::CopyFrom(const ServerConfig_Backup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerConfig.Backup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerConfig_Backup::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ServerConfig_Backup::InternalSwap(ServerConfig_Backup* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_, lhs_arena,
+      &other->_impl_.file_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerConfig_Backup, _impl_.max_recovery_replicas_)
+      + sizeof(ServerConfig_Backup::_impl_.max_recovery_replicas_)
+      - PROTOBUF_FIELD_OFFSET(ServerConfig_Backup, _impl_.num_segment_frames_)>(
+          reinterpret_cast<char*>(&_impl_.num_segment_frames_),
+          reinterpret_cast<char*>(&other->_impl_.num_segment_frames_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerConfig_Backup::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerConfig_2eproto_getter, &descriptor_table_ServerConfig_2eproto_once,
+      file_level_metadata_ServerConfig_2eproto[1]);
+}
+
+// ===================================================================
+
+class ServerConfig::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerConfig>()._impl_._has_bits_);
+  static void set_has_coordinator_locator(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_local_locator(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_cluster_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_services(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_detect_failures(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_pin_memory(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_segment_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_seglet_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_max_object_data_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_max_object_key_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_max_cores(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_dispatch_threads(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_inline_short_rpcs(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_elastic_worker_cores(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_rpc_class_weights(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_background_rpc_limit(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static const ::RAMCloud::ProtoBuf::ServerConfig_Master& master(const ServerConfig* msg);
+  static void set_has_master(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::RAMCloud::ProtoBuf::ServerConfig_Backup& backup(const ServerConfig* msg);
+  static void set_has_backup(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0003ff9f) ^ 0x0003ff9f) != 0;
+  }
+};
+
+const ::RAMCloud::ProtoBuf::ServerConfig_Master&
+ServerConfig::_Internal::master(const ServerConfig* msg) {
+  return *msg->_impl_.master_;
+}
+const ::RAMCloud::ProtoBuf::ServerConfig_Backup&
+ServerConfig::_Internal::backup(const ServerConfig* msg) {
+  return *msg->_impl_.backup_;
+}
+ServerConfig::ServerConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerConfig)
+}
+ServerConfig::ServerConfig(const ServerConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.coordinator_locator_){}
+    , decltype(_impl_.local_locator_){}
+    , decltype(_impl_.cluster_name_){}
+    , decltype(_impl_.services_){}
+    , decltype(_impl_.rpc_class_weights_){}
+    , decltype(_impl_.master_){nullptr}
+    , decltype(_impl_.backup_){nullptr}
+    , decltype(_impl_.segment_size_){}
+    , decltype(_impl_.seglet_size_){}
+    , decltype(_impl_.max_object_data_size_){}
+    , decltype(_impl_.max_object_key_size_){}
+    , decltype(_impl_.detect_failures_){}
+    , decltype(_impl_.pin_memory_){}
+    , decltype(_impl_.inline_short_rpcs_){}
+    , decltype(_impl_.elastic_worker_cores_){}
+    , decltype(_impl_.max_cores_){}
+    , decltype(_impl_.dispatch_threads_){}
+    , decltype(_impl_.background_rpc_limit_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.coordinator_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.coordinator_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_coordinator_locator()) {
+    _this->_impl_.coordinator_locator_.Set(from._internal_coordinator_locator(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.local_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.local_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_local_locator()) {
+    _this->_impl_.local_locator_.Set(from._internal_local_locator(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cluster_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cluster_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_cluster_name()) {
+    _this->_impl_.cluster_name_.Set(from._internal_cluster_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.services_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.services_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_services()) {
+    _this->_impl_.services_.Set(from._internal_services(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.rpc_class_weights_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rpc_class_weights_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_rpc_class_weights()) {
+    _this->_impl_.rpc_class_weights_.Set(from._internal_rpc_class_weights(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_master()) {
+    _this->_impl_.master_ = new ::RAMCloud::ProtoBuf::ServerConfig_Master(*from._impl_.master_);
+  }
+  if (from._internal_has_backup()) {
+    _this->_impl_.backup_ = new ::RAMCloud::ProtoBuf::ServerConfig_Backup(*from._impl_.backup_);
+  }
+  ::memcpy(&_impl_.segment_size_, &from._impl_.segment_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.background_rpc_limit_) -
+    reinterpret_cast<char*>(&_impl_.segment_size_)) + sizeof(_impl_.background_rpc_limit_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerConfig)
+}
+
+inline void ServerConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.coordinator_locator_){}
+    , decltype(_impl_.local_locator_){}
+    , decltype(_impl_.cluster_name_){}
+    , decltype(_impl_.services_){}
+    , decltype(_impl_.rpc_class_weights_){}
+    , decltype(_impl_.master_){nullptr}
+    , decltype(_impl_.backup_){nullptr}
+    , decltype(_impl_.segment_size_){0u}
+    , decltype(_impl_.seglet_size_){0u}
+    , decltype(_impl_.max_object_data_size_){0u}
+    , decltype(_impl_.max_object_key_size_){0u}
+    , decltype(_impl_.detect_failures_){false}
+    , decltype(_impl_.pin_memory_){false}
+    , decltype(_impl_.inline_short_rpcs_){false}
+    , decltype(_impl_.elastic_worker_cores_){false}
+    , decltype(_impl_.max_cores_){0u}
+    , decltype(_impl_.dispatch_threads_){0u}
+    , decltype(_impl_.background_rpc_limit_){0u}
+  };
+  _impl_.coordinator_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.coordinator_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.local_locator_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.local_locator_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cluster_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cluster_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.services_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.services_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.rpc_class_weights_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rpc_class_weights_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ServerConfig::~ServerConfig() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.coordinator_locator_.Destroy();
+  _impl_.local_locator_.Destroy();
+  _impl_.cluster_name_.Destroy();
+  _impl_.services_.Destroy();
+  _impl_.rpc_class_weights_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.master_;
+  if (this != internal_default_instance()) delete _impl_.backup_;
+}
+
+void ServerConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.coordinator_locator_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.local_locator_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.cluster_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.services_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _impl_.rpc_class_weights_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.master_ != nullptr);
+      _impl_.master_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.backup_ != nullptr);
+      _impl_.backup_->Clear();
+    }
+  }
+  _impl_.segment_size_ = 0u;
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.seglet_size_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.max_cores_) -
+        reinterpret_cast<char*>(&_impl_.seglet_size_)) + sizeof(_impl_.max_cores_));
+  }
+  if (cached_has_bits & 0x00030000u) {
+    ::memset(&_impl_.dispatch_threads_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.background_rpc_limit_) -
+        reinterpret_cast<char*>(&_impl_.dispatch_threads_)) + sizeof(_impl_.background_rpc_limit_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string coordinator_locator = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_coordinator_locator();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerConfig.coordinator_locator");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string local_locator = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_local_locator();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerConfig.local_locator");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string cluster_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_cluster_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerConfig.cluster_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string services = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_services();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerConfig.services");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool detect_failures = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_detect_failures(&has_bits);
+          _impl_.detect_failures_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool pin_memory = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_pin_memory(&has_bits);
+          _impl_.pin_memory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 segment_size = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _Internal::set_has_segment_size(&has_bits);
+          _impl_.segment_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 seglet_size = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_seglet_size(&has_bits);
+          _impl_.seglet_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 max_object_data_size = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _Internal::set_has_max_object_data_size(&has_bits);
+          _impl_.max_object_data_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 max_object_key_size = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 85)) {
+          _Internal::set_has_max_object_key_size(&has_bits);
+          _impl_.max_object_key_size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 max_cores = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 93)) {
+          _Internal::set_has_max_cores(&has_bits);
+          _impl_.max_cores_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .RAMCloud.ProtoBuf.ServerConfig.Master master = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_master(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .RAMCloud.ProtoBuf.ServerConfig.Backup backup = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_backup(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 dispatch_threads = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 117)) {
+          _Internal::set_has_dispatch_threads(&has_bits);
+          _impl_.dispatch_threads_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool inline_short_rpcs = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_inline_short_rpcs(&has_bits);
+          _impl_.inline_short_rpcs_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool elastic_worker_cores = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_elastic_worker_cores(&has_bits);
+          _impl_.elastic_worker_cores_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string rpc_class_weights = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          auto str = _internal_mutable_rpc_class_weights();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.ServerConfig.rpc_class_weights");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed32 background_rpc_limit = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 149)) {
+          _Internal::set_has_background_rpc_limit(&has_bits);
+          _impl_.background_rpc_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string coordinator_locator = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_coordinator_locator().data(), static_cast<int>(this->_internal_coordinator_locator().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerConfig.coordinator_locator");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_coordinator_locator(), target);
+  }
+
+  // required string local_locator = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_local_locator().data(), static_cast<int>(this->_internal_local_locator().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerConfig.local_locator");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_local_locator(), target);
+  }
+
+  // required string cluster_name = 3;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_cluster_name().data(), static_cast<int>(this->_internal_cluster_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerConfig.cluster_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_cluster_name(), target);
+  }
+
+  // required string services = 4;
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_services().data(), static_cast<int>(this->_internal_services().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerConfig.services");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_services(), target);
+  }
+
+  // required bool detect_failures = 5;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_detect_failures(), target);
+  }
+
+  // required bool pin_memory = 6;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_pin_memory(), target);
+  }
+
+  // required fixed32 segment_size = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(7, this->_internal_segment_size(), target);
+  }
+
+  // required fixed32 seglet_size = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(8, this->_internal_seglet_size(), target);
+  }
+
+  // required fixed32 max_object_data_size = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(9, this->_internal_max_object_data_size(), target);
+  }
+
+  // required fixed32 max_object_key_size = 10;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(10, this->_internal_max_object_key_size(), target);
+  }
+
+  // required fixed32 max_cores = 11;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(11, this->_internal_max_cores(), target);
+  }
+
+  // optional .RAMCloud.ProtoBuf.ServerConfig.Master master = 12;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::master(this),
+        _Internal::master(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .RAMCloud.ProtoBuf.ServerConfig.Backup backup = 13;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::backup(this),
+        _Internal::backup(this).GetCachedSize(), target, stream);
+  }
+
+  // required fixed32 dispatch_threads = 14;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(14, this->_internal_dispatch_threads(), target);
+  }
+
+  // required bool inline_short_rpcs = 15;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(15, this->_internal_inline_short_rpcs(), target);
+  }
+
+  // required bool elastic_worker_cores = 16;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(16, this->_internal_elastic_worker_cores(), target);
+  }
+
+  // required string rpc_class_weights = 17;
+  if (cached_has_bits & 0x00000010u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_rpc_class_weights().data(), static_cast<int>(this->_internal_rpc_class_weights().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.ServerConfig.rpc_class_weights");
+    target = stream->WriteStringMaybeAliased(
+        17, this->_internal_rpc_class_weights(), target);
+  }
+
+  // required fixed32 background_rpc_limit = 18;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(18, this->_internal_background_rpc_limit(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerConfig)
+  return target;
+}
+
+size_t ServerConfig::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerConfig)
+  size_t total_size = 0;
+
+  if (_internal_has_coordinator_locator()) {
+    // required string coordinator_locator = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_coordinator_locator());
+  }
+
+  if (_internal_has_local_locator()) {
+    // required string local_locator = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_local_locator());
+  }
+
+  if (_internal_has_cluster_name()) {
+    // required string cluster_name = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cluster_name());
+  }
+
+  if (_internal_has_services()) {
+    // required string services = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_services());
+  }
+
+  if (_internal_has_rpc_class_weights()) {
+    // required string rpc_class_weights = 17;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rpc_class_weights());
+  }
+
+  if (_internal_has_segment_size()) {
+    // required fixed32 segment_size = 7;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_seglet_size()) {
+    // required fixed32 seglet_size = 8;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_max_object_data_size()) {
+    // required fixed32 max_object_data_size = 9;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_max_object_key_size()) {
+    // required fixed32 max_object_key_size = 10;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_detect_failures()) {
+    // required bool detect_failures = 5;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_pin_memory()) {
+    // required bool pin_memory = 6;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_inline_short_rpcs()) {
+    // required bool inline_short_rpcs = 15;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_elastic_worker_cores()) {
+    // required bool elastic_worker_cores = 16;
+    total_size += 2 + 1;
+  }
+
+  if (_internal_has_max_cores()) {
+    // required fixed32 max_cores = 11;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_dispatch_threads()) {
+    // required fixed32 dispatch_threads = 14;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_background_rpc_limit()) {
+    // required fixed32 background_rpc_limit = 18;
+    total_size += 2 + 4;
+  }
+
+  return total_size;
+}
+size_t ServerConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerConfig)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0003ff9f) ^ 0x0003ff9f) == 0) {  // All required fields are present.
+    // required string coordinator_locator = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_coordinator_locator());
+
+    // required string local_locator = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_local_locator());
+
+    // required string cluster_name = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cluster_name());
+
+    // required string services = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_services());
+
+    // required string rpc_class_weights = 17;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rpc_class_weights());
+
+    // required fixed32 segment_size = 7;
+    total_size += 1 + 4;
+
+    // required fixed32 seglet_size = 8;
+    total_size += 1 + 4;
+
+    // required fixed32 max_object_data_size = 9;
+    total_size += 1 + 4;
+
+    // required fixed32 max_object_key_size = 10;
+    total_size += 1 + 4;
+
+    // required bool detect_failures = 5;
+    total_size += 1 + 1;
+
+    // required bool pin_memory = 6;
+    total_size += 1 + 1;
+
+    // required bool inline_short_rpcs = 15;
+    total_size += 1 + 1;
+
+    // required bool elastic_worker_cores = 16;
+    total_size += 2 + 1;
+
+    // required fixed32 max_cores = 11;
+    total_size += 1 + 4;
+
+    // required fixed32 dispatch_threads = 14;
+    total_size += 1 + 4;
+
+    // required fixed32 background_rpc_limit = 18;
+    total_size += 2 + 4;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000060u) {
+    // optional .RAMCloud.ProtoBuf.ServerConfig.Master master = 12;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.master_);
+    }
+
+    // optional .RAMCloud.ProtoBuf.ServerConfig.Backup backup = 13;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.backup_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerConfig::GetClassData() const { return &_class_data_; }
+
+
+void ServerConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerConfig*>(&to_msg);
+  auto& from = static_cast<const ServerConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_coordinator_locator(from._internal_coordinator_locator());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_local_locator(from._internal_local_locator());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_cluster_name(from._internal_cluster_name());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_services(from._internal_services());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_set_rpc_class_weights(from._internal_rpc_class_weights());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_master()->::RAMCloud::ProtoBuf::ServerConfig_Master::MergeFrom(
+          from._internal_master());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_backup()->::RAMCloud::ProtoBuf::ServerConfig_Backup::MergeFrom(
+          from._internal_backup());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.segment_size_ = from._impl_.segment_size_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.seglet_size_ = from._impl_.seglet_size_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.max_object_data_size_ = from._impl_.max_object_data_size_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.max_object_key_size_ = from._impl_.max_object_key_size_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.detect_failures_ = from._impl_.detect_failures_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.pin_memory_ = from._impl_.pin_memory_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.inline_short_rpcs_ = from._impl_.inline_short_rpcs_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.elastic_worker_cores_ = from._impl_.elastic_worker_cores_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.max_cores_ = from._impl_.max_cores_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00030000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.dispatch_threads_ = from._impl_.dispatch_threads_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.background_rpc_limit_ = from._impl_.background_rpc_limit_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerConfig::CopyFrom(const ServerConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerConfig::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_master()) {
+    if (!_impl_.master_->IsInitialized()) return false;
+  }
+  if (_internal_has_backup()) {
+    if (!_impl_.backup_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ServerConfig::InternalSwap(ServerConfig* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.coordinator_locator_, lhs_arena,
+      &other->_impl_.coordinator_locator_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.local_locator_, lhs_arena,
+      &other->_impl_.local_locator_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cluster_name_, lhs_arena,
+      &other->_impl_.cluster_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.services_, lhs_arena,
+      &other->_impl_.services_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rpc_class_weights_, lhs_arena,
+      &other->_impl_.rpc_class_weights_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerConfig, _impl_.background_rpc_limit_)
+      + sizeof(ServerConfig::_impl_.background_rpc_limit_)
+      - PROTOBUF_FIELD_OFFSET(ServerConfig, _impl_.master_)>(
+          reinterpret_cast<char*>(&_impl_.master_),
+          reinterpret_cast<char*>(&other->_impl_.master_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerConfig_2eproto_getter, &descriptor_table_ServerConfig_2eproto_once,
+      file_level_metadata_ServerConfig_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerConfig_Master*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerConfig_Master >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerConfig_Master >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerConfig_Backup*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerConfig_Backup >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerConfig_Backup >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerConfig*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerConfig >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,3107 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerConfig.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ServerConfig_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ServerConfig_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ServerConfig_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ServerConfig_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ServerConfig_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class ServerConfig;
+struct ServerConfigDefaultTypeInternal;
+extern ServerConfigDefaultTypeInternal _ServerConfig_default_instance_;
+class ServerConfig_Backup;
+struct ServerConfig_BackupDefaultTypeInternal;
+extern ServerConfig_BackupDefaultTypeInternal _ServerConfig_Backup_default_instance_;
+class ServerConfig_Master;
+struct ServerConfig_MasterDefaultTypeInternal;
+extern ServerConfig_MasterDefaultTypeInternal _ServerConfig_Master_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::ServerConfig* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerConfig>(Arena*);
+template<> ::RAMCloud::ProtoBuf::ServerConfig_Backup* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerConfig_Backup>(Arena*);
+template<> ::RAMCloud::ProtoBuf::ServerConfig_Master* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerConfig_Master>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerConfig_Master final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerConfig.Master) */ {
+ public:
+  inline ServerConfig_Master() : ServerConfig_Master(nullptr) {}
+  ~ServerConfig_Master() override;
+  explicit PROTOBUF_CONSTEXPR ServerConfig_Master(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerConfig_Master(const ServerConfig_Master& from);
+  ServerConfig_Master(ServerConfig_Master&& from) noexcept
+    : ServerConfig_Master() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerConfig_Master& operator=(const ServerConfig_Master& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerConfig_Master& operator=(ServerConfig_Master&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerConfig_Master& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerConfig_Master* internal_default_instance() {
+    return reinterpret_cast<const ServerConfig_Master*>(
+               &_ServerConfig_Master_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ServerConfig_Master& a, ServerConfig_Master& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerConfig_Master* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerConfig_Master* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerConfig_Master* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerConfig_Master>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerConfig_Master& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerConfig_Master& from) {
+    ServerConfig_Master::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerConfig_Master* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerConfig.Master";
+  }
+  protected:
+  explicit ServerConfig_Master(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCleanerBalancerFieldNumber = 7,
+    kLogBytesFieldNumber = 1,
+    kHashTableBytesFieldNumber = 2,
+    kBackupDiskExpansionFactorFieldNumber = 5,
+    kCleanerWriteCostThresholdFieldNumber = 6,
+    kDisableLogCleanerFieldNumber = 3,
+    kDisableInMemoryCleaningFieldNumber = 4,
+    kUseMincopysetsFieldNumber = 10,
+    kUseLocalBackupFieldNumber = 11,
+    kCleanerThreadCountFieldNumber = 8,
+    kNumReplicasFieldNumber = 9,
+    kMaxHashTableBytesFieldNumber = 12,
+    kNumLogHeadsFieldNumber = 13,
+    kSyncGroupCommitMicrosFieldNumber = 14,
+    kColdCompressionSecondsFieldNumber = 16,
+    kRecoveryReplayThreadsFieldNumber = 17,
+    kSegregateHotWritesFieldNumber = 15,
+    kChainReplicationFieldNumber = 18,
+    kCoalesceBackupWritesFieldNumber = 19,
+  };
+  // required string cleaner_balancer = 7;
+  bool has_cleaner_balancer() const;
+  private:
+  bool _internal_has_cleaner_balancer() const;
+  public:
+  void clear_cleaner_balancer();
+  const std::string& cleaner_balancer() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cleaner_balancer(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cleaner_balancer();
+  PROTOBUF_NODISCARD std::string* release_cleaner_balancer();
+  void set_allocated_cleaner_balancer(std::string* cleaner_balancer);
+  private:
+  const std::string& _internal_cleaner_balancer() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cleaner_balancer(const std::string& value);
+  std::string* _internal_mutable_cleaner_balancer();
+  public:
+
+  // required fixed64 log_bytes = 1;
+  bool has_log_bytes() const;
+  private:
+  bool _internal_has_log_bytes() const;
+  public:
+  void clear_log_bytes();
+  uint64_t log_bytes() const;
+  void set_log_bytes(uint64_t value);
+  private:
+  uint64_t _internal_log_bytes() const;
+  void _internal_set_log_bytes(uint64_t value);
+  public:
+
+  // required fixed64 hash_table_bytes = 2;
+  bool has_hash_table_bytes() const;
+  private:
+  bool _internal_has_hash_table_bytes() const;
+  public:
+  void clear_hash_table_bytes();
+  uint64_t hash_table_bytes() const;
+  void set_hash_table_bytes(uint64_t value);
+  private:
+  uint64_t _internal_hash_table_bytes() const;
+  void _internal_set_hash_table_bytes(uint64_t value);
+  public:
+
+  // required double backup_disk_expansion_factor = 5;
+  bool has_backup_disk_expansion_factor() const;
+  private:
+  bool _internal_has_backup_disk_expansion_factor() const;
+  public:
+  void clear_backup_disk_expansion_factor();
+  double backup_disk_expansion_factor() const;
+  void set_backup_disk_expansion_factor(double value);
+  private:
+  double _internal_backup_disk_expansion_factor() const;
+  void _internal_set_backup_disk_expansion_factor(double value);
+  public:
+
+  // required fixed32 cleaner_write_cost_threshold = 6;
+  bool has_cleaner_write_cost_threshold() const;
+  private:
+  bool _internal_has_cleaner_write_cost_threshold() const;
+  public:
+  void clear_cleaner_write_cost_threshold();
+  uint32_t cleaner_write_cost_threshold() const;
+  void set_cleaner_write_cost_threshold(uint32_t value);
+  private:
+  uint32_t _internal_cleaner_write_cost_threshold() const;
+  void _internal_set_cleaner_write_cost_threshold(uint32_t value);
+  public:
+
+  // required bool disable_log_cleaner = 3;
+  bool has_disable_log_cleaner() const;
+  private:
+  bool _internal_has_disable_log_cleaner() const;
+  public:
+  void clear_disable_log_cleaner();
+  bool disable_log_cleaner() const;
+  void set_disable_log_cleaner(bool value);
+  private:
+  bool _internal_disable_log_cleaner() const;
+  void _internal_set_disable_log_cleaner(bool value);
+  public:
+
+  // required bool disable_in_memory_cleaning = 4;
+  bool has_disable_in_memory_cleaning() const;
+  private:
+  bool _internal_has_disable_in_memory_cleaning() const;
+  public:
+  void clear_disable_in_memory_cleaning();
+  bool disable_in_memory_cleaning() const;
+  void set_disable_in_memory_cleaning(bool value);
+  private:
+  bool _internal_disable_in_memory_cleaning() const;
+  void _internal_set_disable_in_memory_cleaning(bool value);
+  public:
+
+  // required bool use_mincopysets = 10;
+  bool has_use_mincopysets() const;
+  private:
+  bool _internal_has_use_mincopysets() const;
+  public:
+  void clear_use_mincopysets();
+  bool use_mincopysets() const;
+  void set_use_mincopysets(bool value);
+  private:
+  bool _internal_use_mincopysets() const;
+  void _internal_set_use_mincopysets(bool value);
+  public:
+
+  // required bool use_local_backup = 11;
+  bool has_use_local_backup() const;
+  private:
+  bool _internal_has_use_local_backup() const;
+  public:
+  void clear_use_local_backup();
+  bool use_local_backup() const;
+  void set_use_local_backup(bool value);
+  private:
+  bool _internal_use_local_backup() const;
+  void _internal_set_use_local_backup(bool value);
+  public:
+
+  // required fixed32 cleaner_thread_count = 8;
+  bool has_cleaner_thread_count() const;
+  private:
+  bool _internal_has_cleaner_thread_count() const;
+  public:
+  void clear_cleaner_thread_count();
+  uint32_t cleaner_thread_count() const;
+  void set_cleaner_thread_count(uint32_t value);
+  private:
+  uint32_t _internal_cleaner_thread_count() const;
+  void _internal_set_cleaner_thread_count(uint32_t value);
+  public:
+
+  // required fixed32 num_replicas = 9;
+  bool has_num_replicas() const;
+  private:
+  bool _internal_has_num_replicas() const;
+  public:
+  void clear_num_replicas();
+  uint32_t num_replicas() const;
+  void set_num_replicas(uint32_t value);
+  private:
+  uint32_t _internal_num_replicas() const;
+  void _internal_set_num_replicas(uint32_t value);
+  public:
+
+  // required fixed64 max_hash_table_bytes = 12;
+  bool has_max_hash_table_bytes() const;
+  private:
+  bool _internal_has_max_hash_table_bytes() const;
+  public:
+  void clear_max_hash_table_bytes();
+  uint64_t max_hash_table_bytes() const;
+  void set_max_hash_table_bytes(uint64_t value);
+  private:
+  uint64_t _internal_max_hash_table_bytes() const;
+  void _internal_set_max_hash_table_bytes(uint64_t value);
+  public:
+
+  // required fixed32 num_log_heads = 13;
+  bool has_num_log_heads() const;
+  private:
+  bool _internal_has_num_log_heads() const;
+  public:
+  void clear_num_log_heads();
+  uint32_t num_log_heads() const;
+  void set_num_log_heads(uint32_t value);
+  private:
+  uint32_t _internal_num_log_heads() const;
+  void _internal_set_num_log_heads(uint32_t value);
+  public:
+
+  // required fixed32 sync_group_commit_micros = 14;
+  bool has_sync_group_commit_micros() const;
+  private:
+  bool _internal_has_sync_group_commit_micros() const;
+  public:
+  void clear_sync_group_commit_micros();
+  uint32_t sync_group_commit_micros() const;
+  void set_sync_group_commit_micros(uint32_t value);
+  private:
+  uint32_t _internal_sync_group_commit_micros() const;
+  void _internal_set_sync_group_commit_micros(uint32_t value);
+  public:
+
+  // required fixed32 cold_compression_seconds = 16;
+  bool has_cold_compression_seconds() const;
+  private:
+  bool _internal_has_cold_compression_seconds() const;
+  public:
+  void clear_cold_compression_seconds();
+  uint32_t cold_compression_seconds() const;
+  void set_cold_compression_seconds(uint32_t value);
+  private:
+  uint32_t _internal_cold_compression_seconds() const;
+  void _internal_set_cold_compression_seconds(uint32_t value);
+  public:
+
+  // required fixed32 recovery_replay_threads = 17;
+  bool has_recovery_replay_threads() const;
+  private:
+  bool _internal_has_recovery_replay_threads() const;
+  public:
+  void clear_recovery_replay_threads();
+  uint32_t recovery_replay_threads() const;
+  void set_recovery_replay_threads(uint32_t value);
+  private:
+  uint32_t _internal_recovery_replay_threads() const;
+  void _internal_set_recovery_replay_threads(uint32_t value);
+  public:
+
+  // required bool segregate_hot_writes = 15;
+  bool has_segregate_hot_writes() const;
+  private:
+  bool _internal_has_segregate_hot_writes() const;
+  public:
+  void clear_segregate_hot_writes();
+  bool segregate_hot_writes() const;
+  void set_segregate_hot_writes(bool value);
+  private:
+  bool _internal_segregate_hot_writes() const;
+  void _internal_set_segregate_hot_writes(bool value);
+  public:
+
+  // required bool chain_replication = 18;
+  bool has_chain_replication() const;
+  private:
+  bool _internal_has_chain_replication() const;
+  public:
+  void clear_chain_replication();
+  bool chain_replication() const;
+  void set_chain_replication(bool value);
+  private:
+  bool _internal_chain_replication() const;
+  void _internal_set_chain_replication(bool value);
+  public:
+
+  // required bool coalesce_backup_writes = 19;
+  bool has_coalesce_backup_writes() const;
+  private:
+  bool _internal_has_coalesce_backup_writes() const;
+  public:
+  void clear_coalesce_backup_writes();
+  bool coalesce_backup_writes() const;
+  void set_coalesce_backup_writes(bool value);
+  private:
+  bool _internal_coalesce_backup_writes() const;
+  void _internal_set_coalesce_backup_writes(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerConfig.Master)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cleaner_balancer_;
+    uint64_t log_bytes_;
+    uint64_t hash_table_bytes_;
+    double backup_disk_expansion_factor_;
+    uint32_t cleaner_write_cost_threshold_;
+    bool disable_log_cleaner_;
+    bool disable_in_memory_cleaning_;
+    bool use_mincopysets_;
+    bool use_local_backup_;
+    uint32_t cleaner_thread_count_;
+    uint32_t num_replicas_;
+    uint64_t max_hash_table_bytes_;
+    uint32_t num_log_heads_;
+    uint32_t sync_group_commit_micros_;
+    uint32_t cold_compression_seconds_;
+    uint32_t recovery_replay_threads_;
+    bool segregate_hot_writes_;
+    bool chain_replication_;
+    bool coalesce_backup_writes_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerConfig_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerConfig_Backup final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerConfig.Backup) */ {
+ public:
+  inline ServerConfig_Backup() : ServerConfig_Backup(nullptr) {}
+  ~ServerConfig_Backup() override;
+  explicit PROTOBUF_CONSTEXPR ServerConfig_Backup(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerConfig_Backup(const ServerConfig_Backup& from);
+  ServerConfig_Backup(ServerConfig_Backup&& from) noexcept
+    : ServerConfig_Backup() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerConfig_Backup& operator=(const ServerConfig_Backup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerConfig_Backup& operator=(ServerConfig_Backup&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerConfig_Backup& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerConfig_Backup* internal_default_instance() {
+    return reinterpret_cast<const ServerConfig_Backup*>(
+               &_ServerConfig_Backup_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ServerConfig_Backup& a, ServerConfig_Backup& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerConfig_Backup* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerConfig_Backup* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerConfig_Backup* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerConfig_Backup>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerConfig_Backup& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerConfig_Backup& from) {
+    ServerConfig_Backup::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerConfig_Backup* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerConfig.Backup";
+  }
+  protected:
+  explicit ServerConfig_Backup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileFieldNumber = 5,
+    kNumSegmentFramesFieldNumber = 3,
+    kMaxNonVolatileBuffersFieldNumber = 4,
+    kStrategyFieldNumber = 6,
+    kGcFieldNumber = 1,
+    kInMemoryFieldNumber = 2,
+    kIoUringFieldNumber = 10,
+    kPersistentMemoryFieldNumber = 11,
+    kWriteRateLimitFieldNumber = 8,
+    kMockSpeedFieldNumber = 7,
+    kRecoveryBuildThreadsFieldNumber = 9,
+    kMaxRecoveryReplicasFieldNumber = 20,
+  };
+  // optional string file = 5;
+  bool has_file() const;
+  private:
+  bool _internal_has_file() const;
+  public:
+  void clear_file();
+  const std::string& file() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file();
+  PROTOBUF_NODISCARD std::string* release_file();
+  void set_allocated_file(std::string* file);
+  private:
+  const std::string& _internal_file() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file(const std::string& value);
+  std::string* _internal_mutable_file();
+  public:
+
+  // required fixed32 num_segment_frames = 3;
+  bool has_num_segment_frames() const;
+  private:
+  bool _internal_has_num_segment_frames() const;
+  public:
+  void clear_num_segment_frames();
+  uint32_t num_segment_frames() const;
+  void set_num_segment_frames(uint32_t value);
+  private:
+  uint32_t _internal_num_segment_frames() const;
+  void _internal_set_num_segment_frames(uint32_t value);
+  public:
+
+  // required fixed32 max_non_volatile_buffers = 4;
+  bool has_max_non_volatile_buffers() const;
+  private:
+  bool _internal_has_max_non_volatile_buffers() const;
+  public:
+  void clear_max_non_volatile_buffers();
+  uint32_t max_non_volatile_buffers() const;
+  void set_max_non_volatile_buffers(uint32_t value);
+  private:
+  uint32_t _internal_max_non_volatile_buffers() const;
+  void _internal_set_max_non_volatile_buffers(uint32_t value);
+  public:
+
+  // required int32 strategy = 6;
+  bool has_strategy() const;
+  private:
+  bool _internal_has_strategy() const;
+  public:
+  void clear_strategy();
+  int32_t strategy() const;
+  void set_strategy(int32_t value);
+  private:
+  int32_t _internal_strategy() const;
+  void _internal_set_strategy(int32_t value);
+  public:
+
+  // required bool gc = 1;
+  bool has_gc() const;
+  private:
+  bool _internal_has_gc() const;
+  public:
+  void clear_gc();
+  bool gc() const;
+  void set_gc(bool value);
+  private:
+  bool _internal_gc() const;
+  void _internal_set_gc(bool value);
+  public:
+
+  // required bool in_memory = 2;
+  bool has_in_memory() const;
+  private:
+  bool _internal_has_in_memory() const;
+  public:
+  void clear_in_memory();
+  bool in_memory() const;
+  void set_in_memory(bool value);
+  private:
+  bool _internal_in_memory() const;
+  void _internal_set_in_memory(bool value);
+  public:
+
+  // required bool io_uring = 10;
+  bool has_io_uring() const;
+  private:
+  bool _internal_has_io_uring() const;
+  public:
+  void clear_io_uring();
+  bool io_uring() const;
+  void set_io_uring(bool value);
+  private:
+  bool _internal_io_uring() const;
+  void _internal_set_io_uring(bool value);
+  public:
+
+  // required bool persistent_memory = 11;
+  bool has_persistent_memory() const;
+  private:
+  bool _internal_has_persistent_memory() const;
+  public:
+  void clear_persistent_memory();
+  bool persistent_memory() const;
+  void set_persistent_memory(bool value);
+  private:
+  bool _internal_persistent_memory() const;
+  void _internal_set_persistent_memory(bool value);
+  public:
+
+  // required fixed64 write_rate_limit = 8;
+  bool has_write_rate_limit() const;
+  private:
+  bool _internal_has_write_rate_limit() const;
+  public:
+  void clear_write_rate_limit();
+  uint64_t write_rate_limit() const;
+  void set_write_rate_limit(uint64_t value);
+  private:
+  uint64_t _internal_write_rate_limit() const;
+  void _internal_set_write_rate_limit(uint64_t value);
+  public:
+
+  // required fixed32 mock_speed = 7;
+  bool has_mock_speed() const;
+  private:
+  bool _internal_has_mock_speed() const;
+  public:
+  void clear_mock_speed();
+  uint32_t mock_speed() const;
+  void set_mock_speed(uint32_t value);
+  private:
+  uint32_t _internal_mock_speed() const;
+  void _internal_set_mock_speed(uint32_t value);
+  public:
+
+  // required fixed32 recovery_build_threads = 9;
+  bool has_recovery_build_threads() const;
+  private:
+  bool _internal_has_recovery_build_threads() const;
+  public:
+  void clear_recovery_build_threads();
+  uint32_t recovery_build_threads() const;
+  void set_recovery_build_threads(uint32_t value);
+  private:
+  uint32_t _internal_recovery_build_threads() const;
+  void _internal_set_recovery_build_threads(uint32_t value);
+  public:
+
+  // required fixed32 max_recovery_replicas = 20;
+  bool has_max_recovery_replicas() const;
+  private:
+  bool _internal_has_max_recovery_replicas() const;
+  public:
+  void clear_max_recovery_replicas();
+  uint32_t max_recovery_replicas() const;
+  void set_max_recovery_replicas(uint32_t value);
+  private:
+  uint32_t _internal_max_recovery_replicas() const;
+  void _internal_set_max_recovery_replicas(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerConfig.Backup)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_;
+    uint32_t num_segment_frames_;
+    uint32_t max_non_volatile_buffers_;
+    int32_t strategy_;
+    bool gc_;
+    bool in_memory_;
+    bool io_uring_;
+    bool persistent_memory_;
+    uint64_t write_rate_limit_;
+    uint32_t mock_speed_;
+    uint32_t recovery_build_threads_;
+    uint32_t max_recovery_replicas_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerConfig_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerConfig) */ {
+ public:
+  inline ServerConfig() : ServerConfig(nullptr) {}
+  ~ServerConfig() override;
+  explicit PROTOBUF_CONSTEXPR ServerConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerConfig(const ServerConfig& from);
+  ServerConfig(ServerConfig&& from) noexcept
+    : ServerConfig() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerConfig& operator=(const ServerConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerConfig& operator=(ServerConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerConfig* internal_default_instance() {
+    return reinterpret_cast<const ServerConfig*>(
+               &_ServerConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ServerConfig& a, ServerConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerConfig& from) {
+    ServerConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerConfig* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerConfig";
+  }
+  protected:
+  explicit ServerConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ServerConfig_Master Master;
+  typedef ServerConfig_Backup Backup;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCoordinatorLocatorFieldNumber = 1,
+    kLocalLocatorFieldNumber = 2,
+    kClusterNameFieldNumber = 3,
+    kServicesFieldNumber = 4,
+    kRpcClassWeightsFieldNumber = 17,
+    kMasterFieldNumber = 12,
+    kBackupFieldNumber = 13,
+    kSegmentSizeFieldNumber = 7,
+    kSegletSizeFieldNumber = 8,
+    kMaxObjectDataSizeFieldNumber = 9,
+    kMaxObjectKeySizeFieldNumber = 10,
+    kDetectFailuresFieldNumber = 5,
+    kPinMemoryFieldNumber = 6,
+    kInlineShortRpcsFieldNumber = 15,
+    kElasticWorkerCoresFieldNumber = 16,
+    kMaxCoresFieldNumber = 11,
+    kDispatchThreadsFieldNumber = 14,
+    kBackgroundRpcLimitFieldNumber = 18,
+  };
+  // required string coordinator_locator = 1;
+  bool has_coordinator_locator() const;
+  private:
+  bool _internal_has_coordinator_locator() const;
+  public:
+  void clear_coordinator_locator();
+  const std::string& coordinator_locator() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_coordinator_locator(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_coordinator_locator();
+  PROTOBUF_NODISCARD std::string* release_coordinator_locator();
+  void set_allocated_coordinator_locator(std::string* coordinator_locator);
+  private:
+  const std::string& _internal_coordinator_locator() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_coordinator_locator(const std::string& value);
+  std::string* _internal_mutable_coordinator_locator();
+  public:
+
+  // required string local_locator = 2;
+  bool has_local_locator() const;
+  private:
+  bool _internal_has_local_locator() const;
+  public:
+  void clear_local_locator();
+  const std::string& local_locator() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_local_locator(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_local_locator();
+  PROTOBUF_NODISCARD std::string* release_local_locator();
+  void set_allocated_local_locator(std::string* local_locator);
+  private:
+  const std::string& _internal_local_locator() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_local_locator(const std::string& value);
+  std::string* _internal_mutable_local_locator();
+  public:
+
+  // required string cluster_name = 3;
+  bool has_cluster_name() const;
+  private:
+  bool _internal_has_cluster_name() const;
+  public:
+  void clear_cluster_name();
+  const std::string& cluster_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cluster_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cluster_name();
+  PROTOBUF_NODISCARD std::string* release_cluster_name();
+  void set_allocated_cluster_name(std::string* cluster_name);
+  private:
+  const std::string& _internal_cluster_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cluster_name(const std::string& value);
+  std::string* _internal_mutable_cluster_name();
+  public:
+
+  // required string services = 4;
+  bool has_services() const;
+  private:
+  bool _internal_has_services() const;
+  public:
+  void clear_services();
+  const std::string& services() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_services(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_services();
+  PROTOBUF_NODISCARD std::string* release_services();
+  void set_allocated_services(std::string* services);
+  private:
+  const std::string& _internal_services() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_services(const std::string& value);
+  std::string* _internal_mutable_services();
+  public:
+
+  // required string rpc_class_weights = 17;
+  bool has_rpc_class_weights() const;
+  private:
+  bool _internal_has_rpc_class_weights() const;
+  public:
+  void clear_rpc_class_weights();
+  const std::string& rpc_class_weights() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rpc_class_weights(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rpc_class_weights();
+  PROTOBUF_NODISCARD std::string* release_rpc_class_weights();
+  void set_allocated_rpc_class_weights(std::string* rpc_class_weights);
+  private:
+  const std::string& _internal_rpc_class_weights() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rpc_class_weights(const std::string& value);
+  std::string* _internal_mutable_rpc_class_weights();
+  public:
+
+  // optional .RAMCloud.ProtoBuf.ServerConfig.Master master = 12;
+  bool has_master() const;
+  private:
+  bool _internal_has_master() const;
+  public:
+  void clear_master();
+  const ::RAMCloud::ProtoBuf::ServerConfig_Master& master() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::ServerConfig_Master* release_master();
+  ::RAMCloud::ProtoBuf::ServerConfig_Master* mutable_master();
+  void set_allocated_master(::RAMCloud::ProtoBuf::ServerConfig_Master* master);
+  private:
+  const ::RAMCloud::ProtoBuf::ServerConfig_Master& _internal_master() const;
+  ::RAMCloud::ProtoBuf::ServerConfig_Master* _internal_mutable_master();
+  public:
+  void unsafe_arena_set_allocated_master(
+      ::RAMCloud::ProtoBuf::ServerConfig_Master* master);
+  ::RAMCloud::ProtoBuf::ServerConfig_Master* unsafe_arena_release_master();
+
+  // optional .RAMCloud.ProtoBuf.ServerConfig.Backup backup = 13;
+  bool has_backup() const;
+  private:
+  bool _internal_has_backup() const;
+  public:
+  void clear_backup();
+  const ::RAMCloud::ProtoBuf::ServerConfig_Backup& backup() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::ServerConfig_Backup* release_backup();
+  ::RAMCloud::ProtoBuf::ServerConfig_Backup* mutable_backup();
+  void set_allocated_backup(::RAMCloud::ProtoBuf::ServerConfig_Backup* backup);
+  private:
+  const ::RAMCloud::ProtoBuf::ServerConfig_Backup& _internal_backup() const;
+  ::RAMCloud::ProtoBuf::ServerConfig_Backup* _internal_mutable_backup();
+  public:
+  void unsafe_arena_set_allocated_backup(
+      ::RAMCloud::ProtoBuf::ServerConfig_Backup* backup);
+  ::RAMCloud::ProtoBuf::ServerConfig_Backup* unsafe_arena_release_backup();
+
+  // required fixed32 segment_size = 7;
+  bool has_segment_size() const;
+  private:
+  bool _internal_has_segment_size() const;
+  public:
+  void clear_segment_size();
+  uint32_t segment_size() const;
+  void set_segment_size(uint32_t value);
+  private:
+  uint32_t _internal_segment_size() const;
+  void _internal_set_segment_size(uint32_t value);
+  public:
+
+  // required fixed32 seglet_size = 8;
+  bool has_seglet_size() const;
+  private:
+  bool _internal_has_seglet_size() const;
+  public:
+  void clear_seglet_size();
+  uint32_t seglet_size() const;
+  void set_seglet_size(uint32_t value);
+  private:
+  uint32_t _internal_seglet_size() const;
+  void _internal_set_seglet_size(uint32_t value);
+  public:
+
+  // required fixed32 max_object_data_size = 9;
+  bool has_max_object_data_size() const;
+  private:
+  bool _internal_has_max_object_data_size() const;
+  public:
+  void clear_max_object_data_size();
+  uint32_t max_object_data_size() const;
+  void set_max_object_data_size(uint32_t value);
+  private:
+  uint32_t _internal_max_object_data_size() const;
+  void _internal_set_max_object_data_size(uint32_t value);
+  public:
+
+  // required fixed32 max_object_key_size = 10;
+  bool has_max_object_key_size() const;
+  private:
+  bool _internal_has_max_object_key_size() const;
+  public:
+  void clear_max_object_key_size();
+  uint32_t max_object_key_size() const;
+  void set_max_object_key_size(uint32_t value);
+  private:
+  uint32_t _internal_max_object_key_size() const;
+  void _internal_set_max_object_key_size(uint32_t value);
+  public:
+
+  // required bool detect_failures = 5;
+  bool has_detect_failures() const;
+  private:
+  bool _internal_has_detect_failures() const;
+  public:
+  void clear_detect_failures();
+  bool detect_failures() const;
+  void set_detect_failures(bool value);
+  private:
+  bool _internal_detect_failures() const;
+  void _internal_set_detect_failures(bool value);
+  public:
+
+  // required bool pin_memory = 6;
+  bool has_pin_memory() const;
+  private:
+  bool _internal_has_pin_memory() const;
+  public:
+  void clear_pin_memory();
+  bool pin_memory() const;
+  void set_pin_memory(bool value);
+  private:
+  bool _internal_pin_memory() const;
+  void _internal_set_pin_memory(bool value);
+  public:
+
+  // required bool inline_short_rpcs = 15;
+  bool has_inline_short_rpcs() const;
+  private:
+  bool _internal_has_inline_short_rpcs() const;
+  public:
+  void clear_inline_short_rpcs();
+  bool inline_short_rpcs() const;
+  void set_inline_short_rpcs(bool value);
+  private:
+  bool _internal_inline_short_rpcs() const;
+  void _internal_set_inline_short_rpcs(bool value);
+  public:
+
+  // required bool elastic_worker_cores = 16;
+  bool has_elastic_worker_cores() const;
+  private:
+  bool _internal_has_elastic_worker_cores() const;
+  public:
+  void clear_elastic_worker_cores();
+  bool elastic_worker_cores() const;
+  void set_elastic_worker_cores(bool value);
+  private:
+  bool _internal_elastic_worker_cores() const;
+  void _internal_set_elastic_worker_cores(bool value);
+  public:
+
+  // required fixed32 max_cores = 11;
+  bool has_max_cores() const;
+  private:
+  bool _internal_has_max_cores() const;
+  public:
+  void clear_max_cores();
+  uint32_t max_cores() const;
+  void set_max_cores(uint32_t value);
+  private:
+  uint32_t _internal_max_cores() const;
+  void _internal_set_max_cores(uint32_t value);
+  public:
+
+  // required fixed32 dispatch_threads = 14;
+  bool has_dispatch_threads() const;
+  private:
+  bool _internal_has_dispatch_threads() const;
+  public:
+  void clear_dispatch_threads();
+  uint32_t dispatch_threads() const;
+  void set_dispatch_threads(uint32_t value);
+  private:
+  uint32_t _internal_dispatch_threads() const;
+  void _internal_set_dispatch_threads(uint32_t value);
+  public:
+
+  // required fixed32 background_rpc_limit = 18;
+  bool has_background_rpc_limit() const;
+  private:
+  bool _internal_has_background_rpc_limit() const;
+  public:
+  void clear_background_rpc_limit();
+  uint32_t background_rpc_limit() const;
+  void set_background_rpc_limit(uint32_t value);
+  private:
+  uint32_t _internal_background_rpc_limit() const;
+  void _internal_set_background_rpc_limit(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerConfig)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr coordinator_locator_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr local_locator_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cluster_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr services_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rpc_class_weights_;
+    ::RAMCloud::ProtoBuf::ServerConfig_Master* master_;
+    ::RAMCloud::ProtoBuf::ServerConfig_Backup* backup_;
+    uint32_t segment_size_;
+    uint32_t seglet_size_;
+    uint32_t max_object_data_size_;
+    uint32_t max_object_key_size_;
+    bool detect_failures_;
+    bool pin_memory_;
+    bool inline_short_rpcs_;
+    bool elastic_worker_cores_;
+    uint32_t max_cores_;
+    uint32_t dispatch_threads_;
+    uint32_t background_rpc_limit_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerConfig_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ServerConfig_Master
+
+// required fixed64 log_bytes = 1;
+inline bool ServerConfig_Master::_internal_has_log_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_log_bytes() const {
+  return _internal_has_log_bytes();
+}
+inline void ServerConfig_Master::clear_log_bytes() {
+  _impl_.log_bytes_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ServerConfig_Master::_internal_log_bytes() const {
+  return _impl_.log_bytes_;
+}
+inline uint64_t ServerConfig_Master::log_bytes() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.log_bytes)
+  return _internal_log_bytes();
+}
+inline void ServerConfig_Master::_internal_set_log_bytes(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.log_bytes_ = value;
+}
+inline void ServerConfig_Master::set_log_bytes(uint64_t value) {
+  _internal_set_log_bytes(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.log_bytes)
+}
+
+// required fixed64 hash_table_bytes = 2;
+inline bool ServerConfig_Master::_internal_has_hash_table_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_hash_table_bytes() const {
+  return _internal_has_hash_table_bytes();
+}
+inline void ServerConfig_Master::clear_hash_table_bytes() {
+  _impl_.hash_table_bytes_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ServerConfig_Master::_internal_hash_table_bytes() const {
+  return _impl_.hash_table_bytes_;
+}
+inline uint64_t ServerConfig_Master::hash_table_bytes() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.hash_table_bytes)
+  return _internal_hash_table_bytes();
+}
+inline void ServerConfig_Master::_internal_set_hash_table_bytes(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.hash_table_bytes_ = value;
+}
+inline void ServerConfig_Master::set_hash_table_bytes(uint64_t value) {
+  _internal_set_hash_table_bytes(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.hash_table_bytes)
+}
+
+// required bool disable_log_cleaner = 3;
+inline bool ServerConfig_Master::_internal_has_disable_log_cleaner() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_disable_log_cleaner() const {
+  return _internal_has_disable_log_cleaner();
+}
+inline void ServerConfig_Master::clear_disable_log_cleaner() {
+  _impl_.disable_log_cleaner_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool ServerConfig_Master::_internal_disable_log_cleaner() const {
+  return _impl_.disable_log_cleaner_;
+}
+inline bool ServerConfig_Master::disable_log_cleaner() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.disable_log_cleaner)
+  return _internal_disable_log_cleaner();
+}
+inline void ServerConfig_Master::_internal_set_disable_log_cleaner(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.disable_log_cleaner_ = value;
+}
+inline void ServerConfig_Master::set_disable_log_cleaner(bool value) {
+  _internal_set_disable_log_cleaner(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.disable_log_cleaner)
+}
+
+// required bool disable_in_memory_cleaning = 4;
+inline bool ServerConfig_Master::_internal_has_disable_in_memory_cleaning() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_disable_in_memory_cleaning() const {
+  return _internal_has_disable_in_memory_cleaning();
+}
+inline void ServerConfig_Master::clear_disable_in_memory_cleaning() {
+  _impl_.disable_in_memory_cleaning_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool ServerConfig_Master::_internal_disable_in_memory_cleaning() const {
+  return _impl_.disable_in_memory_cleaning_;
+}
+inline bool ServerConfig_Master::disable_in_memory_cleaning() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.disable_in_memory_cleaning)
+  return _internal_disable_in_memory_cleaning();
+}
+inline void ServerConfig_Master::_internal_set_disable_in_memory_cleaning(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.disable_in_memory_cleaning_ = value;
+}
+inline void ServerConfig_Master::set_disable_in_memory_cleaning(bool value) {
+  _internal_set_disable_in_memory_cleaning(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.disable_in_memory_cleaning)
+}
+
+// required double backup_disk_expansion_factor = 5;
+inline bool ServerConfig_Master::_internal_has_backup_disk_expansion_factor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_backup_disk_expansion_factor() const {
+  return _internal_has_backup_disk_expansion_factor();
+}
+inline void ServerConfig_Master::clear_backup_disk_expansion_factor() {
+  _impl_.backup_disk_expansion_factor_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double ServerConfig_Master::_internal_backup_disk_expansion_factor() const {
+  return _impl_.backup_disk_expansion_factor_;
+}
+inline double ServerConfig_Master::backup_disk_expansion_factor() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.backup_disk_expansion_factor)
+  return _internal_backup_disk_expansion_factor();
+}
+inline void ServerConfig_Master::_internal_set_backup_disk_expansion_factor(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.backup_disk_expansion_factor_ = value;
+}
+inline void ServerConfig_Master::set_backup_disk_expansion_factor(double value) {
+  _internal_set_backup_disk_expansion_factor(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.backup_disk_expansion_factor)
+}
+
+// required fixed32 cleaner_write_cost_threshold = 6;
+inline bool ServerConfig_Master::_internal_has_cleaner_write_cost_threshold() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_cleaner_write_cost_threshold() const {
+  return _internal_has_cleaner_write_cost_threshold();
+}
+inline void ServerConfig_Master::clear_cleaner_write_cost_threshold() {
+  _impl_.cleaner_write_cost_threshold_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t ServerConfig_Master::_internal_cleaner_write_cost_threshold() const {
+  return _impl_.cleaner_write_cost_threshold_;
+}
+inline uint32_t ServerConfig_Master::cleaner_write_cost_threshold() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.cleaner_write_cost_threshold)
+  return _internal_cleaner_write_cost_threshold();
+}
+inline void ServerConfig_Master::_internal_set_cleaner_write_cost_threshold(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.cleaner_write_cost_threshold_ = value;
+}
+inline void ServerConfig_Master::set_cleaner_write_cost_threshold(uint32_t value) {
+  _internal_set_cleaner_write_cost_threshold(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.cleaner_write_cost_threshold)
+}
+
+// required string cleaner_balancer = 7;
+inline bool ServerConfig_Master::_internal_has_cleaner_balancer() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_cleaner_balancer() const {
+  return _internal_has_cleaner_balancer();
+}
+inline void ServerConfig_Master::clear_cleaner_balancer() {
+  _impl_.cleaner_balancer_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ServerConfig_Master::cleaner_balancer() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.cleaner_balancer)
+  return _internal_cleaner_balancer();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerConfig_Master::set_cleaner_balancer(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.cleaner_balancer_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.cleaner_balancer)
+}
+inline std::string* ServerConfig_Master::mutable_cleaner_balancer() {
+  std::string* _s = _internal_mutable_cleaner_balancer();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerConfig.Master.cleaner_balancer)
+  return _s;
+}
+inline const std::string& ServerConfig_Master::_internal_cleaner_balancer() const {
+  return _impl_.cleaner_balancer_.Get();
+}
+inline void ServerConfig_Master::_internal_set_cleaner_balancer(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.cleaner_balancer_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerConfig_Master::_internal_mutable_cleaner_balancer() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.cleaner_balancer_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerConfig_Master::release_cleaner_balancer() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerConfig.Master.cleaner_balancer)
+  if (!_internal_has_cleaner_balancer()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.cleaner_balancer_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cleaner_balancer_.IsDefault()) {
+    _impl_.cleaner_balancer_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerConfig_Master::set_allocated_cleaner_balancer(std::string* cleaner_balancer) {
+  if (cleaner_balancer != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.cleaner_balancer_.SetAllocated(cleaner_balancer, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cleaner_balancer_.IsDefault()) {
+    _impl_.cleaner_balancer_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerConfig.Master.cleaner_balancer)
+}
+
+// required fixed32 cleaner_thread_count = 8;
+inline bool ServerConfig_Master::_internal_has_cleaner_thread_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_cleaner_thread_count() const {
+  return _internal_has_cleaner_thread_count();
+}
+inline void ServerConfig_Master::clear_cleaner_thread_count() {
+  _impl_.cleaner_thread_count_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t ServerConfig_Master::_internal_cleaner_thread_count() const {
+  return _impl_.cleaner_thread_count_;
+}
+inline uint32_t ServerConfig_Master::cleaner_thread_count() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.cleaner_thread_count)
+  return _internal_cleaner_thread_count();
+}
+inline void ServerConfig_Master::_internal_set_cleaner_thread_count(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.cleaner_thread_count_ = value;
+}
+inline void ServerConfig_Master::set_cleaner_thread_count(uint32_t value) {
+  _internal_set_cleaner_thread_count(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.cleaner_thread_count)
+}
+
+// required fixed32 num_replicas = 9;
+inline bool ServerConfig_Master::_internal_has_num_replicas() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_num_replicas() const {
+  return _internal_has_num_replicas();
+}
+inline void ServerConfig_Master::clear_num_replicas() {
+  _impl_.num_replicas_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint32_t ServerConfig_Master::_internal_num_replicas() const {
+  return _impl_.num_replicas_;
+}
+inline uint32_t ServerConfig_Master::num_replicas() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.num_replicas)
+  return _internal_num_replicas();
+}
+inline void ServerConfig_Master::_internal_set_num_replicas(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.num_replicas_ = value;
+}
+inline void ServerConfig_Master::set_num_replicas(uint32_t value) {
+  _internal_set_num_replicas(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.num_replicas)
+}
+
+// required bool use_mincopysets = 10;
+inline bool ServerConfig_Master::_internal_has_use_mincopysets() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_use_mincopysets() const {
+  return _internal_has_use_mincopysets();
+}
+inline void ServerConfig_Master::clear_use_mincopysets() {
+  _impl_.use_mincopysets_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool ServerConfig_Master::_internal_use_mincopysets() const {
+  return _impl_.use_mincopysets_;
+}
+inline bool ServerConfig_Master::use_mincopysets() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.use_mincopysets)
+  return _internal_use_mincopysets();
+}
+inline void ServerConfig_Master::_internal_set_use_mincopysets(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.use_mincopysets_ = value;
+}
+inline void ServerConfig_Master::set_use_mincopysets(bool value) {
+  _internal_set_use_mincopysets(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.use_mincopysets)
+}
+
+// required bool use_local_backup = 11;
+inline bool ServerConfig_Master::_internal_has_use_local_backup() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_use_local_backup() const {
+  return _internal_has_use_local_backup();
+}
+inline void ServerConfig_Master::clear_use_local_backup() {
+  _impl_.use_local_backup_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool ServerConfig_Master::_internal_use_local_backup() const {
+  return _impl_.use_local_backup_;
+}
+inline bool ServerConfig_Master::use_local_backup() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.use_local_backup)
+  return _internal_use_local_backup();
+}
+inline void ServerConfig_Master::_internal_set_use_local_backup(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.use_local_backup_ = value;
+}
+inline void ServerConfig_Master::set_use_local_backup(bool value) {
+  _internal_set_use_local_backup(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.use_local_backup)
+}
+
+// required fixed64 max_hash_table_bytes = 12;
+inline bool ServerConfig_Master::_internal_has_max_hash_table_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_max_hash_table_bytes() const {
+  return _internal_has_max_hash_table_bytes();
+}
+inline void ServerConfig_Master::clear_max_hash_table_bytes() {
+  _impl_.max_hash_table_bytes_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint64_t ServerConfig_Master::_internal_max_hash_table_bytes() const {
+  return _impl_.max_hash_table_bytes_;
+}
+inline uint64_t ServerConfig_Master::max_hash_table_bytes() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.max_hash_table_bytes)
+  return _internal_max_hash_table_bytes();
+}
+inline void ServerConfig_Master::_internal_set_max_hash_table_bytes(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.max_hash_table_bytes_ = value;
+}
+inline void ServerConfig_Master::set_max_hash_table_bytes(uint64_t value) {
+  _internal_set_max_hash_table_bytes(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.max_hash_table_bytes)
+}
+
+// required fixed32 num_log_heads = 13;
+inline bool ServerConfig_Master::_internal_has_num_log_heads() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_num_log_heads() const {
+  return _internal_has_num_log_heads();
+}
+inline void ServerConfig_Master::clear_num_log_heads() {
+  _impl_.num_log_heads_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint32_t ServerConfig_Master::_internal_num_log_heads() const {
+  return _impl_.num_log_heads_;
+}
+inline uint32_t ServerConfig_Master::num_log_heads() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.num_log_heads)
+  return _internal_num_log_heads();
+}
+inline void ServerConfig_Master::_internal_set_num_log_heads(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.num_log_heads_ = value;
+}
+inline void ServerConfig_Master::set_num_log_heads(uint32_t value) {
+  _internal_set_num_log_heads(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.num_log_heads)
+}
+
+// required fixed32 sync_group_commit_micros = 14;
+inline bool ServerConfig_Master::_internal_has_sync_group_commit_micros() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_sync_group_commit_micros() const {
+  return _internal_has_sync_group_commit_micros();
+}
+inline void ServerConfig_Master::clear_sync_group_commit_micros() {
+  _impl_.sync_group_commit_micros_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline uint32_t ServerConfig_Master::_internal_sync_group_commit_micros() const {
+  return _impl_.sync_group_commit_micros_;
+}
+inline uint32_t ServerConfig_Master::sync_group_commit_micros() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.sync_group_commit_micros)
+  return _internal_sync_group_commit_micros();
+}
+inline void ServerConfig_Master::_internal_set_sync_group_commit_micros(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.sync_group_commit_micros_ = value;
+}
+inline void ServerConfig_Master::set_sync_group_commit_micros(uint32_t value) {
+  _internal_set_sync_group_commit_micros(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.sync_group_commit_micros)
+}
+
+// required bool segregate_hot_writes = 15;
+inline bool ServerConfig_Master::_internal_has_segregate_hot_writes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_segregate_hot_writes() const {
+  return _internal_has_segregate_hot_writes();
+}
+inline void ServerConfig_Master::clear_segregate_hot_writes() {
+  _impl_.segregate_hot_writes_ = false;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline bool ServerConfig_Master::_internal_segregate_hot_writes() const {
+  return _impl_.segregate_hot_writes_;
+}
+inline bool ServerConfig_Master::segregate_hot_writes() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.segregate_hot_writes)
+  return _internal_segregate_hot_writes();
+}
+inline void ServerConfig_Master::_internal_set_segregate_hot_writes(bool value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.segregate_hot_writes_ = value;
+}
+inline void ServerConfig_Master::set_segregate_hot_writes(bool value) {
+  _internal_set_segregate_hot_writes(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.segregate_hot_writes)
+}
+
+// required fixed32 cold_compression_seconds = 16;
+inline bool ServerConfig_Master::_internal_has_cold_compression_seconds() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_cold_compression_seconds() const {
+  return _internal_has_cold_compression_seconds();
+}
+inline void ServerConfig_Master::clear_cold_compression_seconds() {
+  _impl_.cold_compression_seconds_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint32_t ServerConfig_Master::_internal_cold_compression_seconds() const {
+  return _impl_.cold_compression_seconds_;
+}
+inline uint32_t ServerConfig_Master::cold_compression_seconds() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.cold_compression_seconds)
+  return _internal_cold_compression_seconds();
+}
+inline void ServerConfig_Master::_internal_set_cold_compression_seconds(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.cold_compression_seconds_ = value;
+}
+inline void ServerConfig_Master::set_cold_compression_seconds(uint32_t value) {
+  _internal_set_cold_compression_seconds(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.cold_compression_seconds)
+}
+
+// required fixed32 recovery_replay_threads = 17;
+inline bool ServerConfig_Master::_internal_has_recovery_replay_threads() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_recovery_replay_threads() const {
+  return _internal_has_recovery_replay_threads();
+}
+inline void ServerConfig_Master::clear_recovery_replay_threads() {
+  _impl_.recovery_replay_threads_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline uint32_t ServerConfig_Master::_internal_recovery_replay_threads() const {
+  return _impl_.recovery_replay_threads_;
+}
+inline uint32_t ServerConfig_Master::recovery_replay_threads() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.recovery_replay_threads)
+  return _internal_recovery_replay_threads();
+}
+inline void ServerConfig_Master::_internal_set_recovery_replay_threads(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.recovery_replay_threads_ = value;
+}
+inline void ServerConfig_Master::set_recovery_replay_threads(uint32_t value) {
+  _internal_set_recovery_replay_threads(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.recovery_replay_threads)
+}
+
+// required bool chain_replication = 18;
+inline bool ServerConfig_Master::_internal_has_chain_replication() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_chain_replication() const {
+  return _internal_has_chain_replication();
+}
+inline void ServerConfig_Master::clear_chain_replication() {
+  _impl_.chain_replication_ = false;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline bool ServerConfig_Master::_internal_chain_replication() const {
+  return _impl_.chain_replication_;
+}
+inline bool ServerConfig_Master::chain_replication() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.chain_replication)
+  return _internal_chain_replication();
+}
+inline void ServerConfig_Master::_internal_set_chain_replication(bool value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.chain_replication_ = value;
+}
+inline void ServerConfig_Master::set_chain_replication(bool value) {
+  _internal_set_chain_replication(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.chain_replication)
+}
+
+// required bool coalesce_backup_writes = 19;
+inline bool ServerConfig_Master::_internal_has_coalesce_backup_writes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool ServerConfig_Master::has_coalesce_backup_writes() const {
+  return _internal_has_coalesce_backup_writes();
+}
+inline void ServerConfig_Master::clear_coalesce_backup_writes() {
+  _impl_.coalesce_backup_writes_ = false;
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline bool ServerConfig_Master::_internal_coalesce_backup_writes() const {
+  return _impl_.coalesce_backup_writes_;
+}
+inline bool ServerConfig_Master::coalesce_backup_writes() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Master.coalesce_backup_writes)
+  return _internal_coalesce_backup_writes();
+}
+inline void ServerConfig_Master::_internal_set_coalesce_backup_writes(bool value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.coalesce_backup_writes_ = value;
+}
+inline void ServerConfig_Master::set_coalesce_backup_writes(bool value) {
+  _internal_set_coalesce_backup_writes(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Master.coalesce_backup_writes)
+}
+
+// -------------------------------------------------------------------
+
+// ServerConfig_Backup
+
+// required bool gc = 1;
+inline bool ServerConfig_Backup::_internal_has_gc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_gc() const {
+  return _internal_has_gc();
+}
+inline void ServerConfig_Backup::clear_gc() {
+  _impl_.gc_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool ServerConfig_Backup::_internal_gc() const {
+  return _impl_.gc_;
+}
+inline bool ServerConfig_Backup::gc() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.gc)
+  return _internal_gc();
+}
+inline void ServerConfig_Backup::_internal_set_gc(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.gc_ = value;
+}
+inline void ServerConfig_Backup::set_gc(bool value) {
+  _internal_set_gc(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.gc)
+}
+
+// required bool in_memory = 2;
+inline bool ServerConfig_Backup::_internal_has_in_memory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_in_memory() const {
+  return _internal_has_in_memory();
+}
+inline void ServerConfig_Backup::clear_in_memory() {
+  _impl_.in_memory_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool ServerConfig_Backup::_internal_in_memory() const {
+  return _impl_.in_memory_;
+}
+inline bool ServerConfig_Backup::in_memory() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.in_memory)
+  return _internal_in_memory();
+}
+inline void ServerConfig_Backup::_internal_set_in_memory(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.in_memory_ = value;
+}
+inline void ServerConfig_Backup::set_in_memory(bool value) {
+  _internal_set_in_memory(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.in_memory)
+}
+
+// required fixed32 num_segment_frames = 3;
+inline bool ServerConfig_Backup::_internal_has_num_segment_frames() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_num_segment_frames() const {
+  return _internal_has_num_segment_frames();
+}
+inline void ServerConfig_Backup::clear_num_segment_frames() {
+  _impl_.num_segment_frames_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t ServerConfig_Backup::_internal_num_segment_frames() const {
+  return _impl_.num_segment_frames_;
+}
+inline uint32_t ServerConfig_Backup::num_segment_frames() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.num_segment_frames)
+  return _internal_num_segment_frames();
+}
+inline void ServerConfig_Backup::_internal_set_num_segment_frames(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.num_segment_frames_ = value;
+}
+inline void ServerConfig_Backup::set_num_segment_frames(uint32_t value) {
+  _internal_set_num_segment_frames(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.num_segment_frames)
+}
+
+// required fixed32 max_non_volatile_buffers = 4;
+inline bool ServerConfig_Backup::_internal_has_max_non_volatile_buffers() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_max_non_volatile_buffers() const {
+  return _internal_has_max_non_volatile_buffers();
+}
+inline void ServerConfig_Backup::clear_max_non_volatile_buffers() {
+  _impl_.max_non_volatile_buffers_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ServerConfig_Backup::_internal_max_non_volatile_buffers() const {
+  return _impl_.max_non_volatile_buffers_;
+}
+inline uint32_t ServerConfig_Backup::max_non_volatile_buffers() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.max_non_volatile_buffers)
+  return _internal_max_non_volatile_buffers();
+}
+inline void ServerConfig_Backup::_internal_set_max_non_volatile_buffers(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.max_non_volatile_buffers_ = value;
+}
+inline void ServerConfig_Backup::set_max_non_volatile_buffers(uint32_t value) {
+  _internal_set_max_non_volatile_buffers(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.max_non_volatile_buffers)
+}
+
+// required fixed32 max_recovery_replicas = 20;
+inline bool ServerConfig_Backup::_internal_has_max_recovery_replicas() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_max_recovery_replicas() const {
+  return _internal_has_max_recovery_replicas();
+}
+inline void ServerConfig_Backup::clear_max_recovery_replicas() {
+  _impl_.max_recovery_replicas_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint32_t ServerConfig_Backup::_internal_max_recovery_replicas() const {
+  return _impl_.max_recovery_replicas_;
+}
+inline uint32_t ServerConfig_Backup::max_recovery_replicas() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.max_recovery_replicas)
+  return _internal_max_recovery_replicas();
+}
+inline void ServerConfig_Backup::_internal_set_max_recovery_replicas(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.max_recovery_replicas_ = value;
+}
+inline void ServerConfig_Backup::set_max_recovery_replicas(uint32_t value) {
+  _internal_set_max_recovery_replicas(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.max_recovery_replicas)
+}
+
+// optional string file = 5;
+inline bool ServerConfig_Backup::_internal_has_file() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_file() const {
+  return _internal_has_file();
+}
+inline void ServerConfig_Backup::clear_file() {
+  _impl_.file_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ServerConfig_Backup::file() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.file)
+  return _internal_file();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerConfig_Backup::set_file(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.file_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.file)
+}
+inline std::string* ServerConfig_Backup::mutable_file() {
+  std::string* _s = _internal_mutable_file();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerConfig.Backup.file)
+  return _s;
+}
+inline const std::string& ServerConfig_Backup::_internal_file() const {
+  return _impl_.file_.Get();
+}
+inline void ServerConfig_Backup::_internal_set_file(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.file_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerConfig_Backup::_internal_mutable_file() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.file_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerConfig_Backup::release_file() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerConfig.Backup.file)
+  if (!_internal_has_file()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.file_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_.IsDefault()) {
+    _impl_.file_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerConfig_Backup::set_allocated_file(std::string* file) {
+  if (file != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.file_.SetAllocated(file, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_.IsDefault()) {
+    _impl_.file_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerConfig.Backup.file)
+}
+
+// required int32 strategy = 6;
+inline bool ServerConfig_Backup::_internal_has_strategy() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_strategy() const {
+  return _internal_has_strategy();
+}
+inline void ServerConfig_Backup::clear_strategy() {
+  _impl_.strategy_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t ServerConfig_Backup::_internal_strategy() const {
+  return _impl_.strategy_;
+}
+inline int32_t ServerConfig_Backup::strategy() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.strategy)
+  return _internal_strategy();
+}
+inline void ServerConfig_Backup::_internal_set_strategy(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.strategy_ = value;
+}
+inline void ServerConfig_Backup::set_strategy(int32_t value) {
+  _internal_set_strategy(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.strategy)
+}
+
+// required fixed32 mock_speed = 7;
+inline bool ServerConfig_Backup::_internal_has_mock_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_mock_speed() const {
+  return _internal_has_mock_speed();
+}
+inline void ServerConfig_Backup::clear_mock_speed() {
+  _impl_.mock_speed_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t ServerConfig_Backup::_internal_mock_speed() const {
+  return _impl_.mock_speed_;
+}
+inline uint32_t ServerConfig_Backup::mock_speed() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.mock_speed)
+  return _internal_mock_speed();
+}
+inline void ServerConfig_Backup::_internal_set_mock_speed(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.mock_speed_ = value;
+}
+inline void ServerConfig_Backup::set_mock_speed(uint32_t value) {
+  _internal_set_mock_speed(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.mock_speed)
+}
+
+// required fixed64 write_rate_limit = 8;
+inline bool ServerConfig_Backup::_internal_has_write_rate_limit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_write_rate_limit() const {
+  return _internal_has_write_rate_limit();
+}
+inline void ServerConfig_Backup::clear_write_rate_limit() {
+  _impl_.write_rate_limit_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t ServerConfig_Backup::_internal_write_rate_limit() const {
+  return _impl_.write_rate_limit_;
+}
+inline uint64_t ServerConfig_Backup::write_rate_limit() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.write_rate_limit)
+  return _internal_write_rate_limit();
+}
+inline void ServerConfig_Backup::_internal_set_write_rate_limit(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.write_rate_limit_ = value;
+}
+inline void ServerConfig_Backup::set_write_rate_limit(uint64_t value) {
+  _internal_set_write_rate_limit(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.write_rate_limit)
+}
+
+// required fixed32 recovery_build_threads = 9;
+inline bool ServerConfig_Backup::_internal_has_recovery_build_threads() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_recovery_build_threads() const {
+  return _internal_has_recovery_build_threads();
+}
+inline void ServerConfig_Backup::clear_recovery_build_threads() {
+  _impl_.recovery_build_threads_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint32_t ServerConfig_Backup::_internal_recovery_build_threads() const {
+  return _impl_.recovery_build_threads_;
+}
+inline uint32_t ServerConfig_Backup::recovery_build_threads() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.recovery_build_threads)
+  return _internal_recovery_build_threads();
+}
+inline void ServerConfig_Backup::_internal_set_recovery_build_threads(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.recovery_build_threads_ = value;
+}
+inline void ServerConfig_Backup::set_recovery_build_threads(uint32_t value) {
+  _internal_set_recovery_build_threads(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.recovery_build_threads)
+}
+
+// required bool io_uring = 10;
+inline bool ServerConfig_Backup::_internal_has_io_uring() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_io_uring() const {
+  return _internal_has_io_uring();
+}
+inline void ServerConfig_Backup::clear_io_uring() {
+  _impl_.io_uring_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool ServerConfig_Backup::_internal_io_uring() const {
+  return _impl_.io_uring_;
+}
+inline bool ServerConfig_Backup::io_uring() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.io_uring)
+  return _internal_io_uring();
+}
+inline void ServerConfig_Backup::_internal_set_io_uring(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.io_uring_ = value;
+}
+inline void ServerConfig_Backup::set_io_uring(bool value) {
+  _internal_set_io_uring(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.io_uring)
+}
+
+// required bool persistent_memory = 11;
+inline bool ServerConfig_Backup::_internal_has_persistent_memory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool ServerConfig_Backup::has_persistent_memory() const {
+  return _internal_has_persistent_memory();
+}
+inline void ServerConfig_Backup::clear_persistent_memory() {
+  _impl_.persistent_memory_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool ServerConfig_Backup::_internal_persistent_memory() const {
+  return _impl_.persistent_memory_;
+}
+inline bool ServerConfig_Backup::persistent_memory() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.Backup.persistent_memory)
+  return _internal_persistent_memory();
+}
+inline void ServerConfig_Backup::_internal_set_persistent_memory(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.persistent_memory_ = value;
+}
+inline void ServerConfig_Backup::set_persistent_memory(bool value) {
+  _internal_set_persistent_memory(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.Backup.persistent_memory)
+}
+
+// -------------------------------------------------------------------
+
+// ServerConfig
+
+// required string coordinator_locator = 1;
+inline bool ServerConfig::_internal_has_coordinator_locator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_coordinator_locator() const {
+  return _internal_has_coordinator_locator();
+}
+inline void ServerConfig::clear_coordinator_locator() {
+  _impl_.coordinator_locator_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ServerConfig::coordinator_locator() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.coordinator_locator)
+  return _internal_coordinator_locator();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerConfig::set_coordinator_locator(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.coordinator_locator_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.coordinator_locator)
+}
+inline std::string* ServerConfig::mutable_coordinator_locator() {
+  std::string* _s = _internal_mutable_coordinator_locator();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerConfig.coordinator_locator)
+  return _s;
+}
+inline const std::string& ServerConfig::_internal_coordinator_locator() const {
+  return _impl_.coordinator_locator_.Get();
+}
+inline void ServerConfig::_internal_set_coordinator_locator(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.coordinator_locator_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerConfig::_internal_mutable_coordinator_locator() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.coordinator_locator_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerConfig::release_coordinator_locator() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerConfig.coordinator_locator)
+  if (!_internal_has_coordinator_locator()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.coordinator_locator_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.coordinator_locator_.IsDefault()) {
+    _impl_.coordinator_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerConfig::set_allocated_coordinator_locator(std::string* coordinator_locator) {
+  if (coordinator_locator != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.coordinator_locator_.SetAllocated(coordinator_locator, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.coordinator_locator_.IsDefault()) {
+    _impl_.coordinator_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerConfig.coordinator_locator)
+}
+
+// required string local_locator = 2;
+inline bool ServerConfig::_internal_has_local_locator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_local_locator() const {
+  return _internal_has_local_locator();
+}
+inline void ServerConfig::clear_local_locator() {
+  _impl_.local_locator_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ServerConfig::local_locator() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.local_locator)
+  return _internal_local_locator();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerConfig::set_local_locator(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.local_locator_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.local_locator)
+}
+inline std::string* ServerConfig::mutable_local_locator() {
+  std::string* _s = _internal_mutable_local_locator();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerConfig.local_locator)
+  return _s;
+}
+inline const std::string& ServerConfig::_internal_local_locator() const {
+  return _impl_.local_locator_.Get();
+}
+inline void ServerConfig::_internal_set_local_locator(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.local_locator_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerConfig::_internal_mutable_local_locator() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.local_locator_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerConfig::release_local_locator() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerConfig.local_locator)
+  if (!_internal_has_local_locator()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.local_locator_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.local_locator_.IsDefault()) {
+    _impl_.local_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerConfig::set_allocated_local_locator(std::string* local_locator) {
+  if (local_locator != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.local_locator_.SetAllocated(local_locator, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.local_locator_.IsDefault()) {
+    _impl_.local_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerConfig.local_locator)
+}
+
+// required string cluster_name = 3;
+inline bool ServerConfig::_internal_has_cluster_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_cluster_name() const {
+  return _internal_has_cluster_name();
+}
+inline void ServerConfig::clear_cluster_name() {
+  _impl_.cluster_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& ServerConfig::cluster_name() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.cluster_name)
+  return _internal_cluster_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerConfig::set_cluster_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.cluster_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.cluster_name)
+}
+inline std::string* ServerConfig::mutable_cluster_name() {
+  std::string* _s = _internal_mutable_cluster_name();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerConfig.cluster_name)
+  return _s;
+}
+inline const std::string& ServerConfig::_internal_cluster_name() const {
+  return _impl_.cluster_name_.Get();
+}
+inline void ServerConfig::_internal_set_cluster_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.cluster_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerConfig::_internal_mutable_cluster_name() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.cluster_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerConfig::release_cluster_name() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerConfig.cluster_name)
+  if (!_internal_has_cluster_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.cluster_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cluster_name_.IsDefault()) {
+    _impl_.cluster_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerConfig::set_allocated_cluster_name(std::string* cluster_name) {
+  if (cluster_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.cluster_name_.SetAllocated(cluster_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cluster_name_.IsDefault()) {
+    _impl_.cluster_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerConfig.cluster_name)
+}
+
+// required string services = 4;
+inline bool ServerConfig::_internal_has_services() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_services() const {
+  return _internal_has_services();
+}
+inline void ServerConfig::clear_services() {
+  _impl_.services_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& ServerConfig::services() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.services)
+  return _internal_services();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerConfig::set_services(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.services_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.services)
+}
+inline std::string* ServerConfig::mutable_services() {
+  std::string* _s = _internal_mutable_services();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerConfig.services)
+  return _s;
+}
+inline const std::string& ServerConfig::_internal_services() const {
+  return _impl_.services_.Get();
+}
+inline void ServerConfig::_internal_set_services(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.services_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerConfig::_internal_mutable_services() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.services_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerConfig::release_services() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerConfig.services)
+  if (!_internal_has_services()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.services_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.services_.IsDefault()) {
+    _impl_.services_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerConfig::set_allocated_services(std::string* services) {
+  if (services != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.services_.SetAllocated(services, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.services_.IsDefault()) {
+    _impl_.services_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerConfig.services)
+}
+
+// required bool detect_failures = 5;
+inline bool ServerConfig::_internal_has_detect_failures() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_detect_failures() const {
+  return _internal_has_detect_failures();
+}
+inline void ServerConfig::clear_detect_failures() {
+  _impl_.detect_failures_ = false;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline bool ServerConfig::_internal_detect_failures() const {
+  return _impl_.detect_failures_;
+}
+inline bool ServerConfig::detect_failures() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.detect_failures)
+  return _internal_detect_failures();
+}
+inline void ServerConfig::_internal_set_detect_failures(bool value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.detect_failures_ = value;
+}
+inline void ServerConfig::set_detect_failures(bool value) {
+  _internal_set_detect_failures(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.detect_failures)
+}
+
+// required bool pin_memory = 6;
+inline bool ServerConfig::_internal_has_pin_memory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_pin_memory() const {
+  return _internal_has_pin_memory();
+}
+inline void ServerConfig::clear_pin_memory() {
+  _impl_.pin_memory_ = false;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline bool ServerConfig::_internal_pin_memory() const {
+  return _impl_.pin_memory_;
+}
+inline bool ServerConfig::pin_memory() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.pin_memory)
+  return _internal_pin_memory();
+}
+inline void ServerConfig::_internal_set_pin_memory(bool value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.pin_memory_ = value;
+}
+inline void ServerConfig::set_pin_memory(bool value) {
+  _internal_set_pin_memory(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.pin_memory)
+}
+
+// required fixed32 segment_size = 7;
+inline bool ServerConfig::_internal_has_segment_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_segment_size() const {
+  return _internal_has_segment_size();
+}
+inline void ServerConfig::clear_segment_size() {
+  _impl_.segment_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t ServerConfig::_internal_segment_size() const {
+  return _impl_.segment_size_;
+}
+inline uint32_t ServerConfig::segment_size() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.segment_size)
+  return _internal_segment_size();
+}
+inline void ServerConfig::_internal_set_segment_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.segment_size_ = value;
+}
+inline void ServerConfig::set_segment_size(uint32_t value) {
+  _internal_set_segment_size(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.segment_size)
+}
+
+// required fixed32 seglet_size = 8;
+inline bool ServerConfig::_internal_has_seglet_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_seglet_size() const {
+  return _internal_has_seglet_size();
+}
+inline void ServerConfig::clear_seglet_size() {
+  _impl_.seglet_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t ServerConfig::_internal_seglet_size() const {
+  return _impl_.seglet_size_;
+}
+inline uint32_t ServerConfig::seglet_size() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.seglet_size)
+  return _internal_seglet_size();
+}
+inline void ServerConfig::_internal_set_seglet_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.seglet_size_ = value;
+}
+inline void ServerConfig::set_seglet_size(uint32_t value) {
+  _internal_set_seglet_size(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.seglet_size)
+}
+
+// required fixed32 max_object_data_size = 9;
+inline bool ServerConfig::_internal_has_max_object_data_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_max_object_data_size() const {
+  return _internal_has_max_object_data_size();
+}
+inline void ServerConfig::clear_max_object_data_size() {
+  _impl_.max_object_data_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t ServerConfig::_internal_max_object_data_size() const {
+  return _impl_.max_object_data_size_;
+}
+inline uint32_t ServerConfig::max_object_data_size() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.max_object_data_size)
+  return _internal_max_object_data_size();
+}
+inline void ServerConfig::_internal_set_max_object_data_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.max_object_data_size_ = value;
+}
+inline void ServerConfig::set_max_object_data_size(uint32_t value) {
+  _internal_set_max_object_data_size(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.max_object_data_size)
+}
+
+// required fixed32 max_object_key_size = 10;
+inline bool ServerConfig::_internal_has_max_object_key_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_max_object_key_size() const {
+  return _internal_has_max_object_key_size();
+}
+inline void ServerConfig::clear_max_object_key_size() {
+  _impl_.max_object_key_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint32_t ServerConfig::_internal_max_object_key_size() const {
+  return _impl_.max_object_key_size_;
+}
+inline uint32_t ServerConfig::max_object_key_size() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.max_object_key_size)
+  return _internal_max_object_key_size();
+}
+inline void ServerConfig::_internal_set_max_object_key_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.max_object_key_size_ = value;
+}
+inline void ServerConfig::set_max_object_key_size(uint32_t value) {
+  _internal_set_max_object_key_size(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.max_object_key_size)
+}
+
+// required fixed32 max_cores = 11;
+inline bool ServerConfig::_internal_has_max_cores() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_max_cores() const {
+  return _internal_has_max_cores();
+}
+inline void ServerConfig::clear_max_cores() {
+  _impl_.max_cores_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline uint32_t ServerConfig::_internal_max_cores() const {
+  return _impl_.max_cores_;
+}
+inline uint32_t ServerConfig::max_cores() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.max_cores)
+  return _internal_max_cores();
+}
+inline void ServerConfig::_internal_set_max_cores(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.max_cores_ = value;
+}
+inline void ServerConfig::set_max_cores(uint32_t value) {
+  _internal_set_max_cores(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.max_cores)
+}
+
+// required fixed32 dispatch_threads = 14;
+inline bool ServerConfig::_internal_has_dispatch_threads() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_dispatch_threads() const {
+  return _internal_has_dispatch_threads();
+}
+inline void ServerConfig::clear_dispatch_threads() {
+  _impl_.dispatch_threads_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline uint32_t ServerConfig::_internal_dispatch_threads() const {
+  return _impl_.dispatch_threads_;
+}
+inline uint32_t ServerConfig::dispatch_threads() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.dispatch_threads)
+  return _internal_dispatch_threads();
+}
+inline void ServerConfig::_internal_set_dispatch_threads(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.dispatch_threads_ = value;
+}
+inline void ServerConfig::set_dispatch_threads(uint32_t value) {
+  _internal_set_dispatch_threads(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.dispatch_threads)
+}
+
+// required bool inline_short_rpcs = 15;
+inline bool ServerConfig::_internal_has_inline_short_rpcs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_inline_short_rpcs() const {
+  return _internal_has_inline_short_rpcs();
+}
+inline void ServerConfig::clear_inline_short_rpcs() {
+  _impl_.inline_short_rpcs_ = false;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline bool ServerConfig::_internal_inline_short_rpcs() const {
+  return _impl_.inline_short_rpcs_;
+}
+inline bool ServerConfig::inline_short_rpcs() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.inline_short_rpcs)
+  return _internal_inline_short_rpcs();
+}
+inline void ServerConfig::_internal_set_inline_short_rpcs(bool value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.inline_short_rpcs_ = value;
+}
+inline void ServerConfig::set_inline_short_rpcs(bool value) {
+  _internal_set_inline_short_rpcs(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.inline_short_rpcs)
+}
+
+// required bool elastic_worker_cores = 16;
+inline bool ServerConfig::_internal_has_elastic_worker_cores() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_elastic_worker_cores() const {
+  return _internal_has_elastic_worker_cores();
+}
+inline void ServerConfig::clear_elastic_worker_cores() {
+  _impl_.elastic_worker_cores_ = false;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline bool ServerConfig::_internal_elastic_worker_cores() const {
+  return _impl_.elastic_worker_cores_;
+}
+inline bool ServerConfig::elastic_worker_cores() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.elastic_worker_cores)
+  return _internal_elastic_worker_cores();
+}
+inline void ServerConfig::_internal_set_elastic_worker_cores(bool value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.elastic_worker_cores_ = value;
+}
+inline void ServerConfig::set_elastic_worker_cores(bool value) {
+  _internal_set_elastic_worker_cores(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.elastic_worker_cores)
+}
+
+// required string rpc_class_weights = 17;
+inline bool ServerConfig::_internal_has_rpc_class_weights() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_rpc_class_weights() const {
+  return _internal_has_rpc_class_weights();
+}
+inline void ServerConfig::clear_rpc_class_weights() {
+  _impl_.rpc_class_weights_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& ServerConfig::rpc_class_weights() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.rpc_class_weights)
+  return _internal_rpc_class_weights();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerConfig::set_rpc_class_weights(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.rpc_class_weights_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.rpc_class_weights)
+}
+inline std::string* ServerConfig::mutable_rpc_class_weights() {
+  std::string* _s = _internal_mutable_rpc_class_weights();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerConfig.rpc_class_weights)
+  return _s;
+}
+inline const std::string& ServerConfig::_internal_rpc_class_weights() const {
+  return _impl_.rpc_class_weights_.Get();
+}
+inline void ServerConfig::_internal_set_rpc_class_weights(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.rpc_class_weights_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerConfig::_internal_mutable_rpc_class_weights() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.rpc_class_weights_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerConfig::release_rpc_class_weights() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerConfig.rpc_class_weights)
+  if (!_internal_has_rpc_class_weights()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.rpc_class_weights_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rpc_class_weights_.IsDefault()) {
+    _impl_.rpc_class_weights_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerConfig::set_allocated_rpc_class_weights(std::string* rpc_class_weights) {
+  if (rpc_class_weights != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.rpc_class_weights_.SetAllocated(rpc_class_weights, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rpc_class_weights_.IsDefault()) {
+    _impl_.rpc_class_weights_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerConfig.rpc_class_weights)
+}
+
+// required fixed32 background_rpc_limit = 18;
+inline bool ServerConfig::_internal_has_background_rpc_limit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool ServerConfig::has_background_rpc_limit() const {
+  return _internal_has_background_rpc_limit();
+}
+inline void ServerConfig::clear_background_rpc_limit() {
+  _impl_.background_rpc_limit_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline uint32_t ServerConfig::_internal_background_rpc_limit() const {
+  return _impl_.background_rpc_limit_;
+}
+inline uint32_t ServerConfig::background_rpc_limit() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.background_rpc_limit)
+  return _internal_background_rpc_limit();
+}
+inline void ServerConfig::_internal_set_background_rpc_limit(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.background_rpc_limit_ = value;
+}
+inline void ServerConfig::set_background_rpc_limit(uint32_t value) {
+  _internal_set_background_rpc_limit(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerConfig.background_rpc_limit)
+}
+
+// optional .RAMCloud.ProtoBuf.ServerConfig.Master master = 12;
+inline bool ServerConfig::_internal_has_master() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.master_ != nullptr);
+  return value;
+}
+inline bool ServerConfig::has_master() const {
+  return _internal_has_master();
+}
+inline void ServerConfig::clear_master() {
+  if (_impl_.master_ != nullptr) _impl_.master_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::RAMCloud::ProtoBuf::ServerConfig_Master& ServerConfig::_internal_master() const {
+  const ::RAMCloud::ProtoBuf::ServerConfig_Master* p = _impl_.master_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::ServerConfig_Master&>(
+      ::RAMCloud::ProtoBuf::_ServerConfig_Master_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::ServerConfig_Master& ServerConfig::master() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.master)
+  return _internal_master();
+}
+inline void ServerConfig::unsafe_arena_set_allocated_master(
+    ::RAMCloud::ProtoBuf::ServerConfig_Master* master) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.master_);
+  }
+  _impl_.master_ = master;
+  if (master) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.ServerConfig.master)
+}
+inline ::RAMCloud::ProtoBuf::ServerConfig_Master* ServerConfig::release_master() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::RAMCloud::ProtoBuf::ServerConfig_Master* temp = _impl_.master_;
+  _impl_.master_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::ServerConfig_Master* ServerConfig::unsafe_arena_release_master() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerConfig.master)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::RAMCloud::ProtoBuf::ServerConfig_Master* temp = _impl_.master_;
+  _impl_.master_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::ServerConfig_Master* ServerConfig::_internal_mutable_master() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.master_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerConfig_Master>(GetArenaForAllocation());
+    _impl_.master_ = p;
+  }
+  return _impl_.master_;
+}
+inline ::RAMCloud::ProtoBuf::ServerConfig_Master* ServerConfig::mutable_master() {
+  ::RAMCloud::ProtoBuf::ServerConfig_Master* _msg = _internal_mutable_master();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerConfig.master)
+  return _msg;
+}
+inline void ServerConfig::set_allocated_master(::RAMCloud::ProtoBuf::ServerConfig_Master* master) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.master_;
+  }
+  if (master) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(master);
+    if (message_arena != submessage_arena) {
+      master = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, master, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.master_ = master;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerConfig.master)
+}
+
+// optional .RAMCloud.ProtoBuf.ServerConfig.Backup backup = 13;
+inline bool ServerConfig::_internal_has_backup() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.backup_ != nullptr);
+  return value;
+}
+inline bool ServerConfig::has_backup() const {
+  return _internal_has_backup();
+}
+inline void ServerConfig::clear_backup() {
+  if (_impl_.backup_ != nullptr) _impl_.backup_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::RAMCloud::ProtoBuf::ServerConfig_Backup& ServerConfig::_internal_backup() const {
+  const ::RAMCloud::ProtoBuf::ServerConfig_Backup* p = _impl_.backup_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::ServerConfig_Backup&>(
+      ::RAMCloud::ProtoBuf::_ServerConfig_Backup_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::ServerConfig_Backup& ServerConfig::backup() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerConfig.backup)
+  return _internal_backup();
+}
+inline void ServerConfig::unsafe_arena_set_allocated_backup(
+    ::RAMCloud::ProtoBuf::ServerConfig_Backup* backup) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.backup_);
+  }
+  _impl_.backup_ = backup;
+  if (backup) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.ServerConfig.backup)
+}
+inline ::RAMCloud::ProtoBuf::ServerConfig_Backup* ServerConfig::release_backup() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::RAMCloud::ProtoBuf::ServerConfig_Backup* temp = _impl_.backup_;
+  _impl_.backup_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::ServerConfig_Backup* ServerConfig::unsafe_arena_release_backup() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerConfig.backup)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::RAMCloud::ProtoBuf::ServerConfig_Backup* temp = _impl_.backup_;
+  _impl_.backup_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::ServerConfig_Backup* ServerConfig::_internal_mutable_backup() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.backup_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerConfig_Backup>(GetArenaForAllocation());
+    _impl_.backup_ = p;
+  }
+  return _impl_.backup_;
+}
+inline ::RAMCloud::ProtoBuf::ServerConfig_Backup* ServerConfig::mutable_backup() {
+  ::RAMCloud::ProtoBuf::ServerConfig_Backup* _msg = _internal_mutable_backup();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerConfig.backup)
+  return _msg;
+}
+inline void ServerConfig::set_allocated_backup(::RAMCloud::ProtoBuf::ServerConfig_Backup* backup) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.backup_;
+  }
+  if (backup) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(backup);
+    if (message_arena != submessage_arena) {
+      backup = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, backup, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.backup_ = backup;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerConfig.backup)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ServerConfig_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,906 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerList.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ServerList_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ServerList_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ServerList_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ServerList_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ServerList_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class ServerList;
+struct ServerListDefaultTypeInternal;
+extern ServerListDefaultTypeInternal _ServerList_default_instance_;
+class ServerList_Entry;
+struct ServerList_EntryDefaultTypeInternal;
+extern ServerList_EntryDefaultTypeInternal _ServerList_Entry_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::ServerList* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerList>(Arena*);
+template<> ::RAMCloud::ProtoBuf::ServerList_Entry* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerList_Entry>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+enum ServerList_Type : int {
+  ServerList_Type_FULL_LIST = 0,
+  ServerList_Type_UPDATE = 1
+};
+bool ServerList_Type_IsValid(int value);
+constexpr ServerList_Type ServerList_Type_Type_MIN = ServerList_Type_FULL_LIST;
+constexpr ServerList_Type ServerList_Type_Type_MAX = ServerList_Type_UPDATE;
+constexpr int ServerList_Type_Type_ARRAYSIZE = ServerList_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ServerList_Type_descriptor();
+template<typename T>
+inline const std::string& ServerList_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ServerList_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ServerList_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ServerList_Type_descriptor(), enum_t_value);
+}
+inline bool ServerList_Type_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ServerList_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ServerList_Type>(
+    ServerList_Type_descriptor(), name, value);
+}
+// ===================================================================
+
+class ServerList_Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerList.Entry) */ {
+ public:
+  inline ServerList_Entry() : ServerList_Entry(nullptr) {}
+  ~ServerList_Entry() override;
+  explicit PROTOBUF_CONSTEXPR ServerList_Entry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerList_Entry(const ServerList_Entry& from);
+  ServerList_Entry(ServerList_Entry&& from) noexcept
+    : ServerList_Entry() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerList_Entry& operator=(const ServerList_Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerList_Entry& operator=(ServerList_Entry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerList_Entry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerList_Entry* internal_default_instance() {
+    return reinterpret_cast<const ServerList_Entry*>(
+               &_ServerList_Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ServerList_Entry& a, ServerList_Entry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerList_Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerList_Entry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerList_Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerList_Entry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerList_Entry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerList_Entry& from) {
+    ServerList_Entry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerList_Entry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerList.Entry";
+  }
+  protected:
+  explicit ServerList_Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceLocatorFieldNumber = 3,
+    kServerIdFieldNumber = 2,
+    kServicesFieldNumber = 1,
+    kExpectedReadMbytesPerSecFieldNumber = 5,
+    kReplicationIdFieldNumber = 7,
+    kStatusFieldNumber = 6,
+  };
+  // required string service_locator = 3;
+  bool has_service_locator() const;
+  private:
+  bool _internal_has_service_locator() const;
+  public:
+  void clear_service_locator();
+  const std::string& service_locator() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_locator(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_locator();
+  PROTOBUF_NODISCARD std::string* release_service_locator();
+  void set_allocated_service_locator(std::string* service_locator);
+  private:
+  const std::string& _internal_service_locator() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_locator(const std::string& value);
+  std::string* _internal_mutable_service_locator();
+  public:
+
+  // required fixed64 server_id = 2;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // required fixed32 services = 1;
+  bool has_services() const;
+  private:
+  bool _internal_has_services() const;
+  public:
+  void clear_services();
+  uint32_t services() const;
+  void set_services(uint32_t value);
+  private:
+  uint32_t _internal_services() const;
+  void _internal_set_services(uint32_t value);
+  public:
+
+  // required fixed32 expected_read_mbytes_per_sec = 5;
+  bool has_expected_read_mbytes_per_sec() const;
+  private:
+  bool _internal_has_expected_read_mbytes_per_sec() const;
+  public:
+  void clear_expected_read_mbytes_per_sec();
+  uint32_t expected_read_mbytes_per_sec() const;
+  void set_expected_read_mbytes_per_sec(uint32_t value);
+  private:
+  uint32_t _internal_expected_read_mbytes_per_sec() const;
+  void _internal_set_expected_read_mbytes_per_sec(uint32_t value);
+  public:
+
+  // required fixed64 replication_id = 7;
+  bool has_replication_id() const;
+  private:
+  bool _internal_has_replication_id() const;
+  public:
+  void clear_replication_id();
+  uint64_t replication_id() const;
+  void set_replication_id(uint64_t value);
+  private:
+  uint64_t _internal_replication_id() const;
+  void _internal_set_replication_id(uint64_t value);
+  public:
+
+  // required fixed32 status = 6;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  uint32_t status() const;
+  void set_status(uint32_t value);
+  private:
+  uint32_t _internal_status() const;
+  void _internal_set_status(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerList.Entry)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_locator_;
+    uint64_t server_id_;
+    uint32_t services_;
+    uint32_t expected_read_mbytes_per_sec_;
+    uint64_t replication_id_;
+    uint32_t status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerList_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerList) */ {
+ public:
+  inline ServerList() : ServerList(nullptr) {}
+  ~ServerList() override;
+  explicit PROTOBUF_CONSTEXPR ServerList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerList(const ServerList& from);
+  ServerList(ServerList&& from) noexcept
+    : ServerList() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerList& operator=(const ServerList& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerList& operator=(ServerList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerList* internal_default_instance() {
+    return reinterpret_cast<const ServerList*>(
+               &_ServerList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ServerList& a, ServerList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerList& from) {
+    ServerList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerList* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerList";
+  }
+  protected:
+  explicit ServerList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ServerList_Entry Entry;
+
+  typedef ServerList_Type Type;
+  static constexpr Type FULL_LIST =
+    ServerList_Type_FULL_LIST;
+  static constexpr Type UPDATE =
+    ServerList_Type_UPDATE;
+  static inline bool Type_IsValid(int value) {
+    return ServerList_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    ServerList_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    ServerList_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    ServerList_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return ServerList_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return ServerList_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return ServerList_Type_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServerFieldNumber = 1,
+    kVersionNumberFieldNumber = 2,
+    kTypeFieldNumber = 3,
+  };
+  // repeated .RAMCloud.ProtoBuf.ServerList.Entry server = 1;
+  int server_size() const;
+  private:
+  int _internal_server_size() const;
+  public:
+  void clear_server();
+  ::RAMCloud::ProtoBuf::ServerList_Entry* mutable_server(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerList_Entry >*
+      mutable_server();
+  private:
+  const ::RAMCloud::ProtoBuf::ServerList_Entry& _internal_server(int index) const;
+  ::RAMCloud::ProtoBuf::ServerList_Entry* _internal_add_server();
+  public:
+  const ::RAMCloud::ProtoBuf::ServerList_Entry& server(int index) const;
+  ::RAMCloud::ProtoBuf::ServerList_Entry* add_server();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerList_Entry >&
+      server() const;
+
+  // required fixed64 version_number = 2;
+  bool has_version_number() const;
+  private:
+  bool _internal_has_version_number() const;
+  public:
+  void clear_version_number();
+  uint64_t version_number() const;
+  void set_version_number(uint64_t value);
+  private:
+  uint64_t _internal_version_number() const;
+  void _internal_set_version_number(uint64_t value);
+  public:
+
+  // required .RAMCloud.ProtoBuf.ServerList.Type type = 3;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::RAMCloud::ProtoBuf::ServerList_Type type() const;
+  void set_type(::RAMCloud::ProtoBuf::ServerList_Type value);
+  private:
+  ::RAMCloud::ProtoBuf::ServerList_Type _internal_type() const;
+  void _internal_set_type(::RAMCloud::ProtoBuf::ServerList_Type value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerList)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerList_Entry > server_;
+    uint64_t version_number_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerList_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ServerList_Entry
+
+// required fixed32 services = 1;
+inline bool ServerList_Entry::_internal_has_services() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerList_Entry::has_services() const {
+  return _internal_has_services();
+}
+inline void ServerList_Entry::clear_services() {
+  _impl_.services_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ServerList_Entry::_internal_services() const {
+  return _impl_.services_;
+}
+inline uint32_t ServerList_Entry::services() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerList.Entry.services)
+  return _internal_services();
+}
+inline void ServerList_Entry::_internal_set_services(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.services_ = value;
+}
+inline void ServerList_Entry::set_services(uint32_t value) {
+  _internal_set_services(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerList.Entry.services)
+}
+
+// required fixed64 server_id = 2;
+inline bool ServerList_Entry::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerList_Entry::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void ServerList_Entry::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ServerList_Entry::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t ServerList_Entry::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerList.Entry.server_id)
+  return _internal_server_id();
+}
+inline void ServerList_Entry::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.server_id_ = value;
+}
+inline void ServerList_Entry::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerList.Entry.server_id)
+}
+
+// required string service_locator = 3;
+inline bool ServerList_Entry::_internal_has_service_locator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerList_Entry::has_service_locator() const {
+  return _internal_has_service_locator();
+}
+inline void ServerList_Entry::clear_service_locator() {
+  _impl_.service_locator_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ServerList_Entry::service_locator() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerList.Entry.service_locator)
+  return _internal_service_locator();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerList_Entry::set_service_locator(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.service_locator_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerList.Entry.service_locator)
+}
+inline std::string* ServerList_Entry::mutable_service_locator() {
+  std::string* _s = _internal_mutable_service_locator();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerList.Entry.service_locator)
+  return _s;
+}
+inline const std::string& ServerList_Entry::_internal_service_locator() const {
+  return _impl_.service_locator_.Get();
+}
+inline void ServerList_Entry::_internal_set_service_locator(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.service_locator_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerList_Entry::_internal_mutable_service_locator() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.service_locator_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerList_Entry::release_service_locator() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerList.Entry.service_locator)
+  if (!_internal_has_service_locator()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.service_locator_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerList_Entry::set_allocated_service_locator(std::string* service_locator) {
+  if (service_locator != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.service_locator_.SetAllocated(service_locator, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerList.Entry.service_locator)
+}
+
+// required fixed32 expected_read_mbytes_per_sec = 5;
+inline bool ServerList_Entry::_internal_has_expected_read_mbytes_per_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ServerList_Entry::has_expected_read_mbytes_per_sec() const {
+  return _internal_has_expected_read_mbytes_per_sec();
+}
+inline void ServerList_Entry::clear_expected_read_mbytes_per_sec() {
+  _impl_.expected_read_mbytes_per_sec_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t ServerList_Entry::_internal_expected_read_mbytes_per_sec() const {
+  return _impl_.expected_read_mbytes_per_sec_;
+}
+inline uint32_t ServerList_Entry::expected_read_mbytes_per_sec() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerList.Entry.expected_read_mbytes_per_sec)
+  return _internal_expected_read_mbytes_per_sec();
+}
+inline void ServerList_Entry::_internal_set_expected_read_mbytes_per_sec(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.expected_read_mbytes_per_sec_ = value;
+}
+inline void ServerList_Entry::set_expected_read_mbytes_per_sec(uint32_t value) {
+  _internal_set_expected_read_mbytes_per_sec(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerList.Entry.expected_read_mbytes_per_sec)
+}
+
+// required fixed32 status = 6;
+inline bool ServerList_Entry::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ServerList_Entry::has_status() const {
+  return _internal_has_status();
+}
+inline void ServerList_Entry::clear_status() {
+  _impl_.status_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t ServerList_Entry::_internal_status() const {
+  return _impl_.status_;
+}
+inline uint32_t ServerList_Entry::status() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerList.Entry.status)
+  return _internal_status();
+}
+inline void ServerList_Entry::_internal_set_status(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.status_ = value;
+}
+inline void ServerList_Entry::set_status(uint32_t value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerList.Entry.status)
+}
+
+// required fixed64 replication_id = 7;
+inline bool ServerList_Entry::_internal_has_replication_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ServerList_Entry::has_replication_id() const {
+  return _internal_has_replication_id();
+}
+inline void ServerList_Entry::clear_replication_id() {
+  _impl_.replication_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t ServerList_Entry::_internal_replication_id() const {
+  return _impl_.replication_id_;
+}
+inline uint64_t ServerList_Entry::replication_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerList.Entry.replication_id)
+  return _internal_replication_id();
+}
+inline void ServerList_Entry::_internal_set_replication_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.replication_id_ = value;
+}
+inline void ServerList_Entry::set_replication_id(uint64_t value) {
+  _internal_set_replication_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerList.Entry.replication_id)
+}
+
+// -------------------------------------------------------------------
+
+// ServerList
+
+// repeated .RAMCloud.ProtoBuf.ServerList.Entry server = 1;
+inline int ServerList::_internal_server_size() const {
+  return _impl_.server_.size();
+}
+inline int ServerList::server_size() const {
+  return _internal_server_size();
+}
+inline void ServerList::clear_server() {
+  _impl_.server_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::ServerList_Entry* ServerList::mutable_server(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerList.server)
+  return _impl_.server_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerList_Entry >*
+ServerList::mutable_server() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.ServerList.server)
+  return &_impl_.server_;
+}
+inline const ::RAMCloud::ProtoBuf::ServerList_Entry& ServerList::_internal_server(int index) const {
+  return _impl_.server_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::ServerList_Entry& ServerList::server(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerList.server)
+  return _internal_server(index);
+}
+inline ::RAMCloud::ProtoBuf::ServerList_Entry* ServerList::_internal_add_server() {
+  return _impl_.server_.Add();
+}
+inline ::RAMCloud::ProtoBuf::ServerList_Entry* ServerList::add_server() {
+  ::RAMCloud::ProtoBuf::ServerList_Entry* _add = _internal_add_server();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.ServerList.server)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerList_Entry >&
+ServerList::server() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.ServerList.server)
+  return _impl_.server_;
+}
+
+// required fixed64 version_number = 2;
+inline bool ServerList::_internal_has_version_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerList::has_version_number() const {
+  return _internal_has_version_number();
+}
+inline void ServerList::clear_version_number() {
+  _impl_.version_number_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t ServerList::_internal_version_number() const {
+  return _impl_.version_number_;
+}
+inline uint64_t ServerList::version_number() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerList.version_number)
+  return _internal_version_number();
+}
+inline void ServerList::_internal_set_version_number(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_number_ = value;
+}
+inline void ServerList::set_version_number(uint64_t value) {
+  _internal_set_version_number(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerList.version_number)
+}
+
+// required .RAMCloud.ProtoBuf.ServerList.Type type = 3;
+inline bool ServerList::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerList::has_type() const {
+  return _internal_has_type();
+}
+inline void ServerList::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::RAMCloud::ProtoBuf::ServerList_Type ServerList::_internal_type() const {
+  return static_cast< ::RAMCloud::ProtoBuf::ServerList_Type >(_impl_.type_);
+}
+inline ::RAMCloud::ProtoBuf::ServerList_Type ServerList::type() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerList.type)
+  return _internal_type();
+}
+inline void ServerList::_internal_set_type(::RAMCloud::ProtoBuf::ServerList_Type value) {
+  assert(::RAMCloud::ProtoBuf::ServerList_Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void ServerList::set_type(::RAMCloud::ProtoBuf::ServerList_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerList.type)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::RAMCloud::ProtoBuf::ServerList_Type> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::RAMCloud::ProtoBuf::ServerList_Type>() {
+  return ::RAMCloud::ProtoBuf::ServerList_Type_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ServerList_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,712 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerStatistics.proto
+
+#include "ServerStatistics.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR ServerStatistics_TabletEntry::ServerStatistics_TabletEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.start_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.number_read_and_writes_)*/uint64_t{0u}} {}
+struct ServerStatistics_TabletEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatistics_TabletEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatistics_TabletEntryDefaultTypeInternal() {}
+  union {
+    ServerStatistics_TabletEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatistics_TabletEntryDefaultTypeInternal _ServerStatistics_TabletEntry_default_instance_;
+PROTOBUF_CONSTEXPR ServerStatistics::ServerStatistics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tabletentry_)*/{}
+  , /*decltype(_impl_.spin_lock_stats_)*/nullptr} {}
+struct ServerStatisticsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatisticsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatisticsDefaultTypeInternal() {}
+  union {
+    ServerStatistics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatisticsDefaultTypeInternal _ServerStatistics_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_ServerStatistics_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ServerStatistics_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ServerStatistics_2eproto = nullptr;
+
+const uint32_t TableStruct_ServerStatistics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_.table_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_.start_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_.end_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry, _impl_.number_read_and_writes_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics, _impl_.tabletentry_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::ServerStatistics, _impl_.spin_lock_stats_),
+  ~0u,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry)},
+  { 14, 22, -1, sizeof(::RAMCloud::ProtoBuf::ServerStatistics)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_ServerStatistics_TabletEntry_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_ServerStatistics_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ServerStatistics_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026ServerStatistics.proto\022\021RAMCloud.Proto"
+  "Buf\032\030SpinLockStatistics.proto\"\212\002\n\020Server"
+  "Statistics\022D\n\013tabletentry\030\001 \003(\0132/.RAMClo"
+  "ud.ProtoBuf.ServerStatistics.TabletEntry"
+  "\022>\n\017spin_lock_stats\030\002 \002(\0132%.RAMCloud.Pro"
+  "toBuf.SpinLockStatistics\032p\n\013TabletEntry\022"
+  "\020\n\010table_id\030\001 \002(\004\022\026\n\016start_key_hash\030\002 \002("
+  "\004\022\024\n\014end_key_hash\030\003 \002(\004\022!\n\026number_read_a"
+  "nd_writes\030\004 \001(\004:\0010"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_ServerStatistics_2eproto_deps[1] = {
+  &::descriptor_table_SpinLockStatistics_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_ServerStatistics_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ServerStatistics_2eproto = {
+    false, false, 338, descriptor_table_protodef_ServerStatistics_2eproto,
+    "ServerStatistics.proto",
+    &descriptor_table_ServerStatistics_2eproto_once, descriptor_table_ServerStatistics_2eproto_deps, 1, 2,
+    schemas, file_default_instances, TableStruct_ServerStatistics_2eproto::offsets,
+    file_level_metadata_ServerStatistics_2eproto, file_level_enum_descriptors_ServerStatistics_2eproto,
+    file_level_service_descriptors_ServerStatistics_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ServerStatistics_2eproto_getter() {
+  return &descriptor_table_ServerStatistics_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ServerStatistics_2eproto(&descriptor_table_ServerStatistics_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerStatistics_TabletEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerStatistics_TabletEntry>()._impl_._has_bits_);
+  static void set_has_table_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_start_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_end_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_number_read_and_writes(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+ServerStatistics_TabletEntry::ServerStatistics_TabletEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+}
+ServerStatistics_TabletEntry::ServerStatistics_TabletEntry(const ServerStatistics_TabletEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerStatistics_TabletEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_id_){}
+    , decltype(_impl_.start_key_hash_){}
+    , decltype(_impl_.end_key_hash_){}
+    , decltype(_impl_.number_read_and_writes_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.table_id_, &from._impl_.table_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.number_read_and_writes_) -
+    reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.number_read_and_writes_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+}
+
+inline void ServerStatistics_TabletEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_id_){uint64_t{0u}}
+    , decltype(_impl_.start_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.end_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.number_read_and_writes_){uint64_t{0u}}
+  };
+}
+
+ServerStatistics_TabletEntry::~ServerStatistics_TabletEntry() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerStatistics_TabletEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ServerStatistics_TabletEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerStatistics_TabletEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.table_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.number_read_and_writes_) -
+        reinterpret_cast<char*>(&_impl_.table_id_)) + sizeof(_impl_.number_read_and_writes_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerStatistics_TabletEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 table_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_table_id(&has_bits);
+          _impl_.table_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 start_key_hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_start_key_hash(&has_bits);
+          _impl_.start_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end_key_hash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_end_key_hash(&has_bits);
+          _impl_.end_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 number_read_and_writes = 4 [default = 0];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_number_read_and_writes(&has_bits);
+          _impl_.number_read_and_writes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerStatistics_TabletEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 table_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_table_id(), target);
+  }
+
+  // required uint64 start_key_hash = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_start_key_hash(), target);
+  }
+
+  // required uint64 end_key_hash = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_end_key_hash(), target);
+  }
+
+  // optional uint64 number_read_and_writes = 4 [default = 0];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_number_read_and_writes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  return target;
+}
+
+size_t ServerStatistics_TabletEntry::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  size_t total_size = 0;
+
+  if (_internal_has_table_id()) {
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+  }
+
+  if (_internal_has_start_key_hash()) {
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+  }
+
+  if (_internal_has_end_key_hash()) {
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+  }
+
+  return total_size;
+}
+size_t ServerStatistics_TabletEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 table_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_table_id());
+
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint64 number_read_and_writes = 4 [default = 0];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000008u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_number_read_and_writes());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStatistics_TabletEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerStatistics_TabletEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStatistics_TabletEntry::GetClassData() const { return &_class_data_; }
+
+
+void ServerStatistics_TabletEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerStatistics_TabletEntry*>(&to_msg);
+  auto& from = static_cast<const ServerStatistics_TabletEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.table_id_ = from._impl_.table_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.start_key_hash_ = from._impl_.start_key_hash_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.end_key_hash_ = from._impl_.end_key_hash_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.number_read_and_writes_ = from._impl_.number_read_and_writes_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerStatistics_TabletEntry::CopyFrom(const ServerStatistics_TabletEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerStatistics_TabletEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ServerStatistics_TabletEntry::InternalSwap(ServerStatistics_TabletEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerStatistics_TabletEntry, _impl_.number_read_and_writes_)
+      + sizeof(ServerStatistics_TabletEntry::_impl_.number_read_and_writes_)
+      - PROTOBUF_FIELD_OFFSET(ServerStatistics_TabletEntry, _impl_.table_id_)>(
+          reinterpret_cast<char*>(&_impl_.table_id_),
+          reinterpret_cast<char*>(&other->_impl_.table_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStatistics_TabletEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerStatistics_2eproto_getter, &descriptor_table_ServerStatistics_2eproto_once,
+      file_level_metadata_ServerStatistics_2eproto[0]);
+}
+
+// ===================================================================
+
+class ServerStatistics::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ServerStatistics>()._impl_._has_bits_);
+  static const ::RAMCloud::ProtoBuf::SpinLockStatistics& spin_lock_stats(const ServerStatistics* msg);
+  static void set_has_spin_lock_stats(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::RAMCloud::ProtoBuf::SpinLockStatistics&
+ServerStatistics::_Internal::spin_lock_stats(const ServerStatistics* msg) {
+  return *msg->_impl_.spin_lock_stats_;
+}
+void ServerStatistics::clear_spin_lock_stats() {
+  if (_impl_.spin_lock_stats_ != nullptr) _impl_.spin_lock_stats_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+ServerStatistics::ServerStatistics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.ServerStatistics)
+}
+ServerStatistics::ServerStatistics(const ServerStatistics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerStatistics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tabletentry_){from._impl_.tabletentry_}
+    , decltype(_impl_.spin_lock_stats_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_spin_lock_stats()) {
+    _this->_impl_.spin_lock_stats_ = new ::RAMCloud::ProtoBuf::SpinLockStatistics(*from._impl_.spin_lock_stats_);
+  }
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.ServerStatistics)
+}
+
+inline void ServerStatistics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tabletentry_){arena}
+    , decltype(_impl_.spin_lock_stats_){nullptr}
+  };
+}
+
+ServerStatistics::~ServerStatistics() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.ServerStatistics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerStatistics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tabletentry_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.spin_lock_stats_;
+}
+
+void ServerStatistics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerStatistics::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.ServerStatistics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tabletentry_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.spin_lock_stats_ != nullptr);
+    _impl_.spin_lock_stats_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerStatistics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .RAMCloud.ProtoBuf.ServerStatistics.TabletEntry tabletentry = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_tabletentry(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.SpinLockStatistics spin_lock_stats = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_spin_lock_stats(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerStatistics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.ServerStatistics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.ServerStatistics.TabletEntry tabletentry = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tabletentry_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tabletentry(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .RAMCloud.ProtoBuf.SpinLockStatistics spin_lock_stats = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::spin_lock_stats(this),
+        _Internal::spin_lock_stats(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.ServerStatistics)
+  return target;
+}
+
+size_t ServerStatistics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.ServerStatistics)
+  size_t total_size = 0;
+
+  // required .RAMCloud.ProtoBuf.SpinLockStatistics spin_lock_stats = 2;
+  if (_internal_has_spin_lock_stats()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.spin_lock_stats_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.ServerStatistics.TabletEntry tabletentry = 1;
+  total_size += 1UL * this->_internal_tabletentry_size();
+  for (const auto& msg : this->_impl_.tabletentry_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStatistics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerStatistics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStatistics::GetClassData() const { return &_class_data_; }
+
+
+void ServerStatistics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerStatistics*>(&to_msg);
+  auto& from = static_cast<const ServerStatistics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.ServerStatistics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.tabletentry_.MergeFrom(from._impl_.tabletentry_);
+  if (from._internal_has_spin_lock_stats()) {
+    _this->_internal_mutable_spin_lock_stats()->::RAMCloud::ProtoBuf::SpinLockStatistics::MergeFrom(
+        from._internal_spin_lock_stats());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerStatistics::CopyFrom(const ServerStatistics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.ServerStatistics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerStatistics::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.tabletentry_))
+    return false;
+  if (_internal_has_spin_lock_stats()) {
+    if (!_impl_.spin_lock_stats_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ServerStatistics::InternalSwap(ServerStatistics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.tabletentry_.InternalSwap(&other->_impl_.tabletentry_);
+  swap(_impl_.spin_lock_stats_, other->_impl_.spin_lock_stats_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStatistics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ServerStatistics_2eproto_getter, &descriptor_table_ServerStatistics_2eproto_once,
+      file_level_metadata_ServerStatistics_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::ServerStatistics*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::ServerStatistics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::ServerStatistics >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
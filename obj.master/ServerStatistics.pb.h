@@ -0,0 +1,729 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerStatistics.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ServerStatistics_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ServerStatistics_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "SpinLockStatistics.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ServerStatistics_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ServerStatistics_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ServerStatistics_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class ServerStatistics;
+struct ServerStatisticsDefaultTypeInternal;
+extern ServerStatisticsDefaultTypeInternal _ServerStatistics_default_instance_;
+class ServerStatistics_TabletEntry;
+struct ServerStatistics_TabletEntryDefaultTypeInternal;
+extern ServerStatistics_TabletEntryDefaultTypeInternal _ServerStatistics_TabletEntry_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::ServerStatistics* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerStatistics>(Arena*);
+template<> ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerStatistics_TabletEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry) */ {
+ public:
+  inline ServerStatistics_TabletEntry() : ServerStatistics_TabletEntry(nullptr) {}
+  ~ServerStatistics_TabletEntry() override;
+  explicit PROTOBUF_CONSTEXPR ServerStatistics_TabletEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStatistics_TabletEntry(const ServerStatistics_TabletEntry& from);
+  ServerStatistics_TabletEntry(ServerStatistics_TabletEntry&& from) noexcept
+    : ServerStatistics_TabletEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStatistics_TabletEntry& operator=(const ServerStatistics_TabletEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStatistics_TabletEntry& operator=(ServerStatistics_TabletEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStatistics_TabletEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStatistics_TabletEntry* internal_default_instance() {
+    return reinterpret_cast<const ServerStatistics_TabletEntry*>(
+               &_ServerStatistics_TabletEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ServerStatistics_TabletEntry& a, ServerStatistics_TabletEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStatistics_TabletEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStatistics_TabletEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStatistics_TabletEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStatistics_TabletEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStatistics_TabletEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerStatistics_TabletEntry& from) {
+    ServerStatistics_TabletEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStatistics_TabletEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerStatistics.TabletEntry";
+  }
+  protected:
+  explicit ServerStatistics_TabletEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableIdFieldNumber = 1,
+    kStartKeyHashFieldNumber = 2,
+    kEndKeyHashFieldNumber = 3,
+    kNumberReadAndWritesFieldNumber = 4,
+  };
+  // required uint64 table_id = 1;
+  bool has_table_id() const;
+  private:
+  bool _internal_has_table_id() const;
+  public:
+  void clear_table_id();
+  uint64_t table_id() const;
+  void set_table_id(uint64_t value);
+  private:
+  uint64_t _internal_table_id() const;
+  void _internal_set_table_id(uint64_t value);
+  public:
+
+  // required uint64 start_key_hash = 2;
+  bool has_start_key_hash() const;
+  private:
+  bool _internal_has_start_key_hash() const;
+  public:
+  void clear_start_key_hash();
+  uint64_t start_key_hash() const;
+  void set_start_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_start_key_hash() const;
+  void _internal_set_start_key_hash(uint64_t value);
+  public:
+
+  // required uint64 end_key_hash = 3;
+  bool has_end_key_hash() const;
+  private:
+  bool _internal_has_end_key_hash() const;
+  public:
+  void clear_end_key_hash();
+  uint64_t end_key_hash() const;
+  void set_end_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_end_key_hash() const;
+  void _internal_set_end_key_hash(uint64_t value);
+  public:
+
+  // optional uint64 number_read_and_writes = 4 [default = 0];
+  bool has_number_read_and_writes() const;
+  private:
+  bool _internal_has_number_read_and_writes() const;
+  public:
+  void clear_number_read_and_writes();
+  uint64_t number_read_and_writes() const;
+  void set_number_read_and_writes(uint64_t value);
+  private:
+  uint64_t _internal_number_read_and_writes() const;
+  void _internal_set_number_read_and_writes(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t table_id_;
+    uint64_t start_key_hash_;
+    uint64_t end_key_hash_;
+    uint64_t number_read_and_writes_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerStatistics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStatistics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerStatistics) */ {
+ public:
+  inline ServerStatistics() : ServerStatistics(nullptr) {}
+  ~ServerStatistics() override;
+  explicit PROTOBUF_CONSTEXPR ServerStatistics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStatistics(const ServerStatistics& from);
+  ServerStatistics(ServerStatistics&& from) noexcept
+    : ServerStatistics() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStatistics& operator=(const ServerStatistics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStatistics& operator=(ServerStatistics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStatistics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStatistics* internal_default_instance() {
+    return reinterpret_cast<const ServerStatistics*>(
+               &_ServerStatistics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ServerStatistics& a, ServerStatistics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStatistics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStatistics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStatistics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStatistics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStatistics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerStatistics& from) {
+    ServerStatistics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStatistics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerStatistics";
+  }
+  protected:
+  explicit ServerStatistics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ServerStatistics_TabletEntry TabletEntry;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTabletentryFieldNumber = 1,
+    kSpinLockStatsFieldNumber = 2,
+  };
+  // repeated .RAMCloud.ProtoBuf.ServerStatistics.TabletEntry tabletentry = 1;
+  int tabletentry_size() const;
+  private:
+  int _internal_tabletentry_size() const;
+  public:
+  void clear_tabletentry();
+  ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* mutable_tabletentry(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >*
+      mutable_tabletentry();
+  private:
+  const ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry& _internal_tabletentry(int index) const;
+  ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* _internal_add_tabletentry();
+  public:
+  const ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry& tabletentry(int index) const;
+  ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* add_tabletentry();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >&
+      tabletentry() const;
+
+  // required .RAMCloud.ProtoBuf.SpinLockStatistics spin_lock_stats = 2;
+  bool has_spin_lock_stats() const;
+  private:
+  bool _internal_has_spin_lock_stats() const;
+  public:
+  void clear_spin_lock_stats();
+  const ::RAMCloud::ProtoBuf::SpinLockStatistics& spin_lock_stats() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::SpinLockStatistics* release_spin_lock_stats();
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* mutable_spin_lock_stats();
+  void set_allocated_spin_lock_stats(::RAMCloud::ProtoBuf::SpinLockStatistics* spin_lock_stats);
+  private:
+  const ::RAMCloud::ProtoBuf::SpinLockStatistics& _internal_spin_lock_stats() const;
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* _internal_mutable_spin_lock_stats();
+  public:
+  void unsafe_arena_set_allocated_spin_lock_stats(
+      ::RAMCloud::ProtoBuf::SpinLockStatistics* spin_lock_stats);
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* unsafe_arena_release_spin_lock_stats();
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerStatistics)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry > tabletentry_;
+    ::RAMCloud::ProtoBuf::SpinLockStatistics* spin_lock_stats_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerStatistics_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ServerStatistics_TabletEntry
+
+// required uint64 table_id = 1;
+inline bool ServerStatistics_TabletEntry::_internal_has_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerStatistics_TabletEntry::has_table_id() const {
+  return _internal_has_table_id();
+}
+inline void ServerStatistics_TabletEntry::clear_table_id() {
+  _impl_.table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t ServerStatistics_TabletEntry::_internal_table_id() const {
+  return _impl_.table_id_;
+}
+inline uint64_t ServerStatistics_TabletEntry::table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.table_id)
+  return _internal_table_id();
+}
+inline void ServerStatistics_TabletEntry::_internal_set_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.table_id_ = value;
+}
+inline void ServerStatistics_TabletEntry::set_table_id(uint64_t value) {
+  _internal_set_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.table_id)
+}
+
+// required uint64 start_key_hash = 2;
+inline bool ServerStatistics_TabletEntry::_internal_has_start_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerStatistics_TabletEntry::has_start_key_hash() const {
+  return _internal_has_start_key_hash();
+}
+inline void ServerStatistics_TabletEntry::clear_start_key_hash() {
+  _impl_.start_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ServerStatistics_TabletEntry::_internal_start_key_hash() const {
+  return _impl_.start_key_hash_;
+}
+inline uint64_t ServerStatistics_TabletEntry::start_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.start_key_hash)
+  return _internal_start_key_hash();
+}
+inline void ServerStatistics_TabletEntry::_internal_set_start_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.start_key_hash_ = value;
+}
+inline void ServerStatistics_TabletEntry::set_start_key_hash(uint64_t value) {
+  _internal_set_start_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.start_key_hash)
+}
+
+// required uint64 end_key_hash = 3;
+inline bool ServerStatistics_TabletEntry::_internal_has_end_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerStatistics_TabletEntry::has_end_key_hash() const {
+  return _internal_has_end_key_hash();
+}
+inline void ServerStatistics_TabletEntry::clear_end_key_hash() {
+  _impl_.end_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ServerStatistics_TabletEntry::_internal_end_key_hash() const {
+  return _impl_.end_key_hash_;
+}
+inline uint64_t ServerStatistics_TabletEntry::end_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.end_key_hash)
+  return _internal_end_key_hash();
+}
+inline void ServerStatistics_TabletEntry::_internal_set_end_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.end_key_hash_ = value;
+}
+inline void ServerStatistics_TabletEntry::set_end_key_hash(uint64_t value) {
+  _internal_set_end_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.end_key_hash)
+}
+
+// optional uint64 number_read_and_writes = 4 [default = 0];
+inline bool ServerStatistics_TabletEntry::_internal_has_number_read_and_writes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ServerStatistics_TabletEntry::has_number_read_and_writes() const {
+  return _internal_has_number_read_and_writes();
+}
+inline void ServerStatistics_TabletEntry::clear_number_read_and_writes() {
+  _impl_.number_read_and_writes_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t ServerStatistics_TabletEntry::_internal_number_read_and_writes() const {
+  return _impl_.number_read_and_writes_;
+}
+inline uint64_t ServerStatistics_TabletEntry::number_read_and_writes() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.number_read_and_writes)
+  return _internal_number_read_and_writes();
+}
+inline void ServerStatistics_TabletEntry::_internal_set_number_read_and_writes(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.number_read_and_writes_ = value;
+}
+inline void ServerStatistics_TabletEntry::set_number_read_and_writes(uint64_t value) {
+  _internal_set_number_read_and_writes(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerStatistics.TabletEntry.number_read_and_writes)
+}
+
+// -------------------------------------------------------------------
+
+// ServerStatistics
+
+// repeated .RAMCloud.ProtoBuf.ServerStatistics.TabletEntry tabletentry = 1;
+inline int ServerStatistics::_internal_tabletentry_size() const {
+  return _impl_.tabletentry_.size();
+}
+inline int ServerStatistics::tabletentry_size() const {
+  return _internal_tabletentry_size();
+}
+inline void ServerStatistics::clear_tabletentry() {
+  _impl_.tabletentry_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* ServerStatistics::mutable_tabletentry(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerStatistics.tabletentry)
+  return _impl_.tabletentry_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >*
+ServerStatistics::mutable_tabletentry() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.ServerStatistics.tabletentry)
+  return &_impl_.tabletentry_;
+}
+inline const ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry& ServerStatistics::_internal_tabletentry(int index) const {
+  return _impl_.tabletentry_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry& ServerStatistics::tabletentry(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.tabletentry)
+  return _internal_tabletentry(index);
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* ServerStatistics::_internal_add_tabletentry() {
+  return _impl_.tabletentry_.Add();
+}
+inline ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* ServerStatistics::add_tabletentry() {
+  ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry* _add = _internal_add_tabletentry();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.ServerStatistics.tabletentry)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerStatistics_TabletEntry >&
+ServerStatistics::tabletentry() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.ServerStatistics.tabletentry)
+  return _impl_.tabletentry_;
+}
+
+// required .RAMCloud.ProtoBuf.SpinLockStatistics spin_lock_stats = 2;
+inline bool ServerStatistics::_internal_has_spin_lock_stats() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.spin_lock_stats_ != nullptr);
+  return value;
+}
+inline bool ServerStatistics::has_spin_lock_stats() const {
+  return _internal_has_spin_lock_stats();
+}
+inline const ::RAMCloud::ProtoBuf::SpinLockStatistics& ServerStatistics::_internal_spin_lock_stats() const {
+  const ::RAMCloud::ProtoBuf::SpinLockStatistics* p = _impl_.spin_lock_stats_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::SpinLockStatistics&>(
+      ::RAMCloud::ProtoBuf::_SpinLockStatistics_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::SpinLockStatistics& ServerStatistics::spin_lock_stats() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerStatistics.spin_lock_stats)
+  return _internal_spin_lock_stats();
+}
+inline void ServerStatistics::unsafe_arena_set_allocated_spin_lock_stats(
+    ::RAMCloud::ProtoBuf::SpinLockStatistics* spin_lock_stats) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.spin_lock_stats_);
+  }
+  _impl_.spin_lock_stats_ = spin_lock_stats;
+  if (spin_lock_stats) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.ServerStatistics.spin_lock_stats)
+}
+inline ::RAMCloud::ProtoBuf::SpinLockStatistics* ServerStatistics::release_spin_lock_stats() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* temp = _impl_.spin_lock_stats_;
+  _impl_.spin_lock_stats_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::SpinLockStatistics* ServerStatistics::unsafe_arena_release_spin_lock_stats() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerStatistics.spin_lock_stats)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* temp = _impl_.spin_lock_stats_;
+  _impl_.spin_lock_stats_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::SpinLockStatistics* ServerStatistics::_internal_mutable_spin_lock_stats() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.spin_lock_stats_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::SpinLockStatistics>(GetArenaForAllocation());
+    _impl_.spin_lock_stats_ = p;
+  }
+  return _impl_.spin_lock_stats_;
+}
+inline ::RAMCloud::ProtoBuf::SpinLockStatistics* ServerStatistics::mutable_spin_lock_stats() {
+  ::RAMCloud::ProtoBuf::SpinLockStatistics* _msg = _internal_mutable_spin_lock_stats();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerStatistics.spin_lock_stats)
+  return _msg;
+}
+inline void ServerStatistics::set_allocated_spin_lock_stats(::RAMCloud::ProtoBuf::SpinLockStatistics* spin_lock_stats) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.spin_lock_stats_);
+  }
+  if (spin_lock_stats) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(spin_lock_stats));
+    if (message_arena != submessage_arena) {
+      spin_lock_stats = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, spin_lock_stats, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.spin_lock_stats_ = spin_lock_stats;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerStatistics.spin_lock_stats)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ServerStatistics_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,672 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SpinLockStatistics.proto
+
+#include "SpinLockStatistics.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR SpinLockStatistics_Lock::SpinLockStatistics_Lock(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.acquisitions_)*/uint64_t{0u}
+  , /*decltype(_impl_.contended_acquisitions_)*/uint64_t{0u}
+  , /*decltype(_impl_.contended_nsec_)*/uint64_t{0u}} {}
+struct SpinLockStatistics_LockDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpinLockStatistics_LockDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpinLockStatistics_LockDefaultTypeInternal() {}
+  union {
+    SpinLockStatistics_Lock _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpinLockStatistics_LockDefaultTypeInternal _SpinLockStatistics_Lock_default_instance_;
+PROTOBUF_CONSTEXPR SpinLockStatistics::SpinLockStatistics(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.locks_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SpinLockStatisticsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpinLockStatisticsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpinLockStatisticsDefaultTypeInternal() {}
+  union {
+    SpinLockStatistics _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpinLockStatisticsDefaultTypeInternal _SpinLockStatistics_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_SpinLockStatistics_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_SpinLockStatistics_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_SpinLockStatistics_2eproto = nullptr;
+
+const uint32_t TableStruct_SpinLockStatistics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::SpinLockStatistics_Lock, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::SpinLockStatistics_Lock, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::SpinLockStatistics_Lock, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::SpinLockStatistics_Lock, _impl_.acquisitions_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::SpinLockStatistics_Lock, _impl_.contended_acquisitions_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::SpinLockStatistics_Lock, _impl_.contended_nsec_),
+  0,
+  1,
+  2,
+  3,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::SpinLockStatistics, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::SpinLockStatistics, _impl_.locks_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::RAMCloud::ProtoBuf::SpinLockStatistics_Lock)},
+  { 14, -1, -1, sizeof(::RAMCloud::ProtoBuf::SpinLockStatistics)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_SpinLockStatistics_Lock_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_SpinLockStatistics_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_SpinLockStatistics_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\030SpinLockStatistics.proto\022\021RAMCloud.Pro"
+  "toBuf\"\263\001\n\022SpinLockStatistics\0229\n\005locks\030\001 "
+  "\003(\0132*.RAMCloud.ProtoBuf.SpinLockStatisti"
+  "cs.Lock\032b\n\004Lock\022\014\n\004name\030\001 \002(\t\022\024\n\014acquisi"
+  "tions\030\002 \002(\006\022\036\n\026contended_acquisitions\030\003 "
+  "\002(\006\022\026\n\016contended_nsec\030\004 \002(\006"
+  ;
+static ::_pbi::once_flag descriptor_table_SpinLockStatistics_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_SpinLockStatistics_2eproto = {
+    false, false, 227, descriptor_table_protodef_SpinLockStatistics_2eproto,
+    "SpinLockStatistics.proto",
+    &descriptor_table_SpinLockStatistics_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_SpinLockStatistics_2eproto::offsets,
+    file_level_metadata_SpinLockStatistics_2eproto, file_level_enum_descriptors_SpinLockStatistics_2eproto,
+    file_level_service_descriptors_SpinLockStatistics_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_SpinLockStatistics_2eproto_getter() {
+  return &descriptor_table_SpinLockStatistics_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_SpinLockStatistics_2eproto(&descriptor_table_SpinLockStatistics_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class SpinLockStatistics_Lock::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SpinLockStatistics_Lock>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_acquisitions(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_contended_acquisitions(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_contended_nsec(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+SpinLockStatistics_Lock::SpinLockStatistics_Lock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.SpinLockStatistics.Lock)
+}
+SpinLockStatistics_Lock::SpinLockStatistics_Lock(const SpinLockStatistics_Lock& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpinLockStatistics_Lock* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.acquisitions_){}
+    , decltype(_impl_.contended_acquisitions_){}
+    , decltype(_impl_.contended_nsec_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.acquisitions_, &from._impl_.acquisitions_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.contended_nsec_) -
+    reinterpret_cast<char*>(&_impl_.acquisitions_)) + sizeof(_impl_.contended_nsec_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.SpinLockStatistics.Lock)
+}
+
+inline void SpinLockStatistics_Lock::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.acquisitions_){uint64_t{0u}}
+    , decltype(_impl_.contended_acquisitions_){uint64_t{0u}}
+    , decltype(_impl_.contended_nsec_){uint64_t{0u}}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SpinLockStatistics_Lock::~SpinLockStatistics_Lock() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.SpinLockStatistics.Lock)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SpinLockStatistics_Lock::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void SpinLockStatistics_Lock::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SpinLockStatistics_Lock::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.SpinLockStatistics.Lock)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.acquisitions_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.contended_nsec_) -
+        reinterpret_cast<char*>(&_impl_.acquisitions_)) + sizeof(_impl_.contended_nsec_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SpinLockStatistics_Lock::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.SpinLockStatistics.Lock.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 acquisitions = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_acquisitions(&has_bits);
+          _impl_.acquisitions_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 contended_acquisitions = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_contended_acquisitions(&has_bits);
+          _impl_.contended_acquisitions_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 contended_nsec = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_contended_nsec(&has_bits);
+          _impl_.contended_nsec_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SpinLockStatistics_Lock::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.SpinLockStatistics.Lock)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.SpinLockStatistics.Lock.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // required fixed64 acquisitions = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_acquisitions(), target);
+  }
+
+  // required fixed64 contended_acquisitions = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_contended_acquisitions(), target);
+  }
+
+  // required fixed64 contended_nsec = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_contended_nsec(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.SpinLockStatistics.Lock)
+  return target;
+}
+
+size_t SpinLockStatistics_Lock::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.SpinLockStatistics.Lock)
+  size_t total_size = 0;
+
+  if (_internal_has_name()) {
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  if (_internal_has_acquisitions()) {
+    // required fixed64 acquisitions = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_contended_acquisitions()) {
+    // required fixed64 contended_acquisitions = 3;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_contended_nsec()) {
+    // required fixed64 contended_nsec = 4;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t SpinLockStatistics_Lock::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.SpinLockStatistics.Lock)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+
+    // required fixed64 acquisitions = 2;
+    total_size += 1 + 8;
+
+    // required fixed64 contended_acquisitions = 3;
+    total_size += 1 + 8;
+
+    // required fixed64 contended_nsec = 4;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpinLockStatistics_Lock::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpinLockStatistics_Lock::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpinLockStatistics_Lock::GetClassData() const { return &_class_data_; }
+
+
+void SpinLockStatistics_Lock::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpinLockStatistics_Lock*>(&to_msg);
+  auto& from = static_cast<const SpinLockStatistics_Lock&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.SpinLockStatistics.Lock)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.acquisitions_ = from._impl_.acquisitions_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.contended_acquisitions_ = from._impl_.contended_acquisitions_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.contended_nsec_ = from._impl_.contended_nsec_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SpinLockStatistics_Lock::CopyFrom(const SpinLockStatistics_Lock& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.SpinLockStatistics.Lock)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SpinLockStatistics_Lock::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SpinLockStatistics_Lock::InternalSwap(SpinLockStatistics_Lock* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SpinLockStatistics_Lock, _impl_.contended_nsec_)
+      + sizeof(SpinLockStatistics_Lock::_impl_.contended_nsec_)
+      - PROTOBUF_FIELD_OFFSET(SpinLockStatistics_Lock, _impl_.acquisitions_)>(
+          reinterpret_cast<char*>(&_impl_.acquisitions_),
+          reinterpret_cast<char*>(&other->_impl_.acquisitions_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SpinLockStatistics_Lock::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SpinLockStatistics_2eproto_getter, &descriptor_table_SpinLockStatistics_2eproto_once,
+      file_level_metadata_SpinLockStatistics_2eproto[0]);
+}
+
+// ===================================================================
+
+class SpinLockStatistics::_Internal {
+ public:
+};
+
+SpinLockStatistics::SpinLockStatistics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.SpinLockStatistics)
+}
+SpinLockStatistics::SpinLockStatistics(const SpinLockStatistics& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpinLockStatistics* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.locks_){from._impl_.locks_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.SpinLockStatistics)
+}
+
+inline void SpinLockStatistics::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.locks_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SpinLockStatistics::~SpinLockStatistics() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.SpinLockStatistics)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SpinLockStatistics::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.locks_.~RepeatedPtrField();
+}
+
+void SpinLockStatistics::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SpinLockStatistics::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.SpinLockStatistics)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.locks_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SpinLockStatistics::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .RAMCloud.ProtoBuf.SpinLockStatistics.Lock locks = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_locks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SpinLockStatistics::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.SpinLockStatistics)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.SpinLockStatistics.Lock locks = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_locks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_locks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.SpinLockStatistics)
+  return target;
+}
+
+size_t SpinLockStatistics::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.SpinLockStatistics)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.SpinLockStatistics.Lock locks = 1;
+  total_size += 1UL * this->_internal_locks_size();
+  for (const auto& msg : this->_impl_.locks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpinLockStatistics::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpinLockStatistics::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpinLockStatistics::GetClassData() const { return &_class_data_; }
+
+
+void SpinLockStatistics::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpinLockStatistics*>(&to_msg);
+  auto& from = static_cast<const SpinLockStatistics&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.SpinLockStatistics)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.locks_.MergeFrom(from._impl_.locks_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SpinLockStatistics::CopyFrom(const SpinLockStatistics& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.SpinLockStatistics)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SpinLockStatistics::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.locks_))
+    return false;
+  return true;
+}
+
+void SpinLockStatistics::InternalSwap(SpinLockStatistics* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.locks_.InternalSwap(&other->_impl_.locks_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SpinLockStatistics::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SpinLockStatistics_2eproto_getter, &descriptor_table_SpinLockStatistics_2eproto_once,
+      file_level_metadata_SpinLockStatistics_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::SpinLockStatistics*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::SpinLockStatistics >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::SpinLockStatistics >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
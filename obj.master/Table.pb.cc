@@ -0,0 +1,2917 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Table.proto
+
+#include "Table.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR Table_Tablet::Table_Tablet(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.start_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.state_)*/0
+  , /*decltype(_impl_.ctime_log_head_offset_)*/0u
+  , /*decltype(_impl_.ctime_log_head_id_)*/uint64_t{0u}} {}
+struct Table_TabletDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Table_TabletDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Table_TabletDefaultTypeInternal() {}
+  union {
+    Table_Tablet _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Table_TabletDefaultTypeInternal _Table_Tablet_default_instance_;
+PROTOBUF_CONSTEXPR Table_Split::Table_Split(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.split_key_hash_)*/uint64_t{0u}} {}
+struct Table_SplitDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Table_SplitDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Table_SplitDefaultTypeInternal() {}
+  union {
+    Table_Split _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Table_SplitDefaultTypeInternal _Table_Split_default_instance_;
+PROTOBUF_CONSTEXPR Table_Reassign::Table_Reassign(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.start_key_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_key_hash_)*/uint64_t{0u}} {}
+struct Table_ReassignDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Table_ReassignDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Table_ReassignDefaultTypeInternal() {}
+  union {
+    Table_Reassign _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Table_ReassignDefaultTypeInternal _Table_Reassign_default_instance_;
+PROTOBUF_CONSTEXPR Table_Index_Indexlet::Table_Index_Indexlet(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.first_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.first_not_owned_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.backing_table_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}} {}
+struct Table_Index_IndexletDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Table_Index_IndexletDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Table_Index_IndexletDefaultTypeInternal() {}
+  union {
+    Table_Index_Indexlet _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Table_Index_IndexletDefaultTypeInternal _Table_Index_Indexlet_default_instance_;
+PROTOBUF_CONSTEXPR Table_Index::Table_Index(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.indexlet_)*/{}
+  , /*decltype(_impl_.index_id_)*/0u} {}
+struct Table_IndexDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Table_IndexDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Table_IndexDefaultTypeInternal() {}
+  union {
+    Table_Index _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Table_IndexDefaultTypeInternal _Table_Index_default_instance_;
+PROTOBUF_CONSTEXPR Table_ReassignIndexlet::Table_ReassignIndexlet(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.first_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.first_not_owned_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.server_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.backing_table_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.index_id_)*/0u} {}
+struct Table_ReassignIndexletDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Table_ReassignIndexletDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Table_ReassignIndexletDefaultTypeInternal() {}
+  union {
+    Table_ReassignIndexlet _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Table_ReassignIndexletDefaultTypeInternal _Table_ReassignIndexlet_default_instance_;
+PROTOBUF_CONSTEXPR Table::Table(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tablet_)*/{}
+  , /*decltype(_impl_.index_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.split_)*/nullptr
+  , /*decltype(_impl_.reassign_)*/nullptr
+  , /*decltype(_impl_.reassign_indexlet_)*/nullptr
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.sequence_number_)*/uint64_t{0u}
+  , /*decltype(_impl_.created_)*/false
+  , /*decltype(_impl_.deleted_)*/false} {}
+struct TableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TableDefaultTypeInternal() {}
+  union {
+    Table _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TableDefaultTypeInternal _Table_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_Table_2eproto[7];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_Table_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Table_2eproto = nullptr;
+
+const uint32_t TableStruct_Table_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Tablet, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Tablet, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Tablet, _impl_.start_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Tablet, _impl_.end_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Tablet, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Tablet, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Tablet, _impl_.ctime_log_head_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Tablet, _impl_.ctime_log_head_offset_),
+  0,
+  1,
+  3,
+  2,
+  5,
+  4,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Split, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Split, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Split, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Split, _impl_.split_key_hash_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Reassign, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Reassign, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Reassign, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Reassign, _impl_.start_key_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Reassign, _impl_.end_key_hash_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Index_Indexlet, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Index_Indexlet, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Index_Indexlet, _impl_.first_key_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Index_Indexlet, _impl_.first_not_owned_key_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Index_Indexlet, _impl_.backing_table_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Index_Indexlet, _impl_.server_id_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Index, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Index, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Index, _impl_.index_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_Index, _impl_.indexlet_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_ReassignIndexlet, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_ReassignIndexlet, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_ReassignIndexlet, _impl_.server_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_ReassignIndexlet, _impl_.index_id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_ReassignIndexlet, _impl_.first_key_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_ReassignIndexlet, _impl_.first_not_owned_key_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table_ReassignIndexlet, _impl_.backing_table_id_),
+  2,
+  4,
+  0,
+  1,
+  3,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _impl_.tablet_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _impl_.sequence_number_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _impl_.created_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _impl_.deleted_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _impl_.split_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _impl_.reassign_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Table, _impl_.reassign_indexlet_),
+  0,
+  4,
+  ~0u,
+  5,
+  6,
+  7,
+  1,
+  2,
+  ~0u,
+  3,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::RAMCloud::ProtoBuf::Table_Tablet)},
+  { 18, 26, -1, sizeof(::RAMCloud::ProtoBuf::Table_Split)},
+  { 28, 37, -1, sizeof(::RAMCloud::ProtoBuf::Table_Reassign)},
+  { 40, 50, -1, sizeof(::RAMCloud::ProtoBuf::Table_Index_Indexlet)},
+  { 54, 62, -1, sizeof(::RAMCloud::ProtoBuf::Table_Index)},
+  { 64, 75, -1, sizeof(::RAMCloud::ProtoBuf::Table_ReassignIndexlet)},
+  { 80, 96, -1, sizeof(::RAMCloud::ProtoBuf::Table)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_Table_Tablet_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_Table_Split_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_Table_Reassign_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_Table_Index_Indexlet_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_Table_Index_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_Table_ReassignIndexlet_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_Table_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_Table_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\013Table.proto\022\021RAMCloud.ProtoBuf\"\227\010\n\005Tab"
+  "le\022\014\n\004name\030\001 \002(\t\022\n\n\002id\030\002 \002(\004\022/\n\006tablet\030\003"
+  " \003(\0132\037.RAMCloud.ProtoBuf.Table.Tablet\022\027\n"
+  "\017sequence_number\030\004 \002(\004\022\017\n\007created\030\005 \001(\010\022"
+  "\017\n\007deleted\030\006 \001(\010\022-\n\005split\030\007 \001(\0132\036.RAMClo"
+  "ud.ProtoBuf.Table.Split\0223\n\010reassign\030\010 \001("
+  "\0132!.RAMCloud.ProtoBuf.Table.Reassign\022-\n\005"
+  "index\030\t \003(\0132\036.RAMCloud.ProtoBuf.Table.In"
+  "dex\022D\n\021reassign_indexlet\030\n \001(\0132).RAMClou"
+  "d.ProtoBuf.Table.ReassignIndexlet\032\351\001\n\006Ta"
+  "blet\022\026\n\016start_key_hash\030\001 \002(\004\022\024\n\014end_key_"
+  "hash\030\002 \002(\004\0224\n\005state\030\003 \002(\0162%.RAMCloud.Pro"
+  "toBuf.Table.Tablet.State\022\021\n\tserver_id\030\004 "
+  "\002(\006\022\031\n\021ctime_log_head_id\030\005 \002(\004\022\035\n\025ctime_"
+  "log_head_offset\030\006 \002(\r\".\n\005State\022\n\n\006NORMAL"
+  "\020\000\022\016\n\nRECOVERING\020\001\022\t\n\005BOGUS\020\002\0322\n\005Split\022\021"
+  "\n\tserver_id\030\001 \002(\006\022\026\n\016split_key_hash\030\002 \002("
+  "\004\032K\n\010Reassign\022\021\n\tserver_id\030\001 \002(\006\022\026\n\016star"
+  "t_key_hash\030\002 \002(\004\022\024\n\014end_key_hash\030\003 \002(\004\032\275"
+  "\001\n\005Index\022\020\n\010index_id\030\001 \002(\r\0229\n\010indexlet\030\002"
+  " \003(\0132\'.RAMCloud.ProtoBuf.Table.Index.Ind"
+  "exlet\032g\n\010Indexlet\022\021\n\tfirst_key\030\001 \002(\t\022\033\n\023"
+  "first_not_owned_key\030\002 \002(\t\022\030\n\020backing_tab"
+  "le_id\030\003 \002(\004\022\021\n\tserver_id\030\004 \002(\006\032\201\001\n\020Reass"
+  "ignIndexlet\022\021\n\tserver_id\030\001 \002(\006\022\020\n\010index_"
+  "id\030\002 \002(\r\022\021\n\tfirst_key\030\003 \002(\014\022\033\n\023first_not"
+  "_owned_key\030\004 \002(\014\022\030\n\020backing_table_id\030\005 \002"
+  "(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_Table_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_Table_2eproto = {
+    false, false, 1082, descriptor_table_protodef_Table_2eproto,
+    "Table.proto",
+    &descriptor_table_Table_2eproto_once, nullptr, 0, 7,
+    schemas, file_default_instances, TableStruct_Table_2eproto::offsets,
+    file_level_metadata_Table_2eproto, file_level_enum_descriptors_Table_2eproto,
+    file_level_service_descriptors_Table_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Table_2eproto_getter() {
+  return &descriptor_table_Table_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Table_2eproto(&descriptor_table_Table_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Table_Tablet_State_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_Table_2eproto);
+  return file_level_enum_descriptors_Table_2eproto[0];
+}
+bool Table_Tablet_State_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Table_Tablet_State Table_Tablet::NORMAL;
+constexpr Table_Tablet_State Table_Tablet::RECOVERING;
+constexpr Table_Tablet_State Table_Tablet::BOGUS;
+constexpr Table_Tablet_State Table_Tablet::State_MIN;
+constexpr Table_Tablet_State Table_Tablet::State_MAX;
+constexpr int Table_Tablet::State_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Table_Tablet::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Table_Tablet>()._impl_._has_bits_);
+  static void set_has_start_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_end_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_state(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_ctime_log_head_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_ctime_log_head_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000003f) ^ 0x0000003f) != 0;
+  }
+};
+
+Table_Tablet::Table_Tablet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.Table.Tablet)
+}
+Table_Tablet::Table_Tablet(const Table_Tablet& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Table_Tablet* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_key_hash_){}
+    , decltype(_impl_.end_key_hash_){}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.ctime_log_head_offset_){}
+    , decltype(_impl_.ctime_log_head_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.start_key_hash_, &from._impl_.start_key_hash_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ctime_log_head_id_) -
+    reinterpret_cast<char*>(&_impl_.start_key_hash_)) + sizeof(_impl_.ctime_log_head_id_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.Table.Tablet)
+}
+
+inline void Table_Tablet::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.end_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+    , decltype(_impl_.state_){0}
+    , decltype(_impl_.ctime_log_head_offset_){0u}
+    , decltype(_impl_.ctime_log_head_id_){uint64_t{0u}}
+  };
+}
+
+Table_Tablet::~Table_Tablet() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.Table.Tablet)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Table_Tablet::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Table_Tablet::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Table_Tablet::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.Table.Tablet)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    ::memset(&_impl_.start_key_hash_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.ctime_log_head_id_) -
+        reinterpret_cast<char*>(&_impl_.start_key_hash_)) + sizeof(_impl_.ctime_log_head_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Table_Tablet::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 start_key_hash = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_start_key_hash(&has_bits);
+          _impl_.start_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end_key_hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_end_key_hash(&has_bits);
+          _impl_.end_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .RAMCloud.ProtoBuf.Table.Tablet.State state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::RAMCloud::ProtoBuf::Table_Tablet_State_IsValid(val))) {
+            _internal_set_state(static_cast<::RAMCloud::ProtoBuf::Table_Tablet_State>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 server_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 ctime_log_head_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_ctime_log_head_id(&has_bits);
+          _impl_.ctime_log_head_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 ctime_log_head_offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_ctime_log_head_offset(&has_bits);
+          _impl_.ctime_log_head_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Table_Tablet::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.Table.Tablet)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 start_key_hash = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_start_key_hash(), target);
+  }
+
+  // required uint64 end_key_hash = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_end_key_hash(), target);
+  }
+
+  // required .RAMCloud.ProtoBuf.Table.Tablet.State state = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_state(), target);
+  }
+
+  // required fixed64 server_id = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_server_id(), target);
+  }
+
+  // required uint64 ctime_log_head_id = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_ctime_log_head_id(), target);
+  }
+
+  // required uint32 ctime_log_head_offset = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_ctime_log_head_offset(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.Table.Tablet)
+  return target;
+}
+
+size_t Table_Tablet::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.Table.Tablet)
+  size_t total_size = 0;
+
+  if (_internal_has_start_key_hash()) {
+    // required uint64 start_key_hash = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+  }
+
+  if (_internal_has_end_key_hash()) {
+    // required uint64 end_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+  }
+
+  if (_internal_has_server_id()) {
+    // required fixed64 server_id = 4;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_state()) {
+    // required .RAMCloud.ProtoBuf.Table.Tablet.State state = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+  }
+
+  if (_internal_has_ctime_log_head_offset()) {
+    // required uint32 ctime_log_head_offset = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ctime_log_head_offset());
+  }
+
+  if (_internal_has_ctime_log_head_id()) {
+    // required uint64 ctime_log_head_id = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ctime_log_head_id());
+  }
+
+  return total_size;
+}
+size_t Table_Tablet::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.Table.Tablet)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000003f) ^ 0x0000003f) == 0) {  // All required fields are present.
+    // required uint64 start_key_hash = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+
+    // required uint64 end_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+
+    // required fixed64 server_id = 4;
+    total_size += 1 + 8;
+
+    // required .RAMCloud.ProtoBuf.Table.Tablet.State state = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+
+    // required uint32 ctime_log_head_offset = 6;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ctime_log_head_offset());
+
+    // required uint64 ctime_log_head_id = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ctime_log_head_id());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Table_Tablet::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Table_Tablet::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Table_Tablet::GetClassData() const { return &_class_data_; }
+
+
+void Table_Tablet::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Table_Tablet*>(&to_msg);
+  auto& from = static_cast<const Table_Tablet&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.Table.Tablet)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.start_key_hash_ = from._impl_.start_key_hash_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.end_key_hash_ = from._impl_.end_key_hash_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.state_ = from._impl_.state_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.ctime_log_head_offset_ = from._impl_.ctime_log_head_offset_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.ctime_log_head_id_ = from._impl_.ctime_log_head_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Table_Tablet::CopyFrom(const Table_Tablet& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.Table.Tablet)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Table_Tablet::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Table_Tablet::InternalSwap(Table_Tablet* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Table_Tablet, _impl_.ctime_log_head_id_)
+      + sizeof(Table_Tablet::_impl_.ctime_log_head_id_)
+      - PROTOBUF_FIELD_OFFSET(Table_Tablet, _impl_.start_key_hash_)>(
+          reinterpret_cast<char*>(&_impl_.start_key_hash_),
+          reinterpret_cast<char*>(&other->_impl_.start_key_hash_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Table_Tablet::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Table_2eproto_getter, &descriptor_table_Table_2eproto_once,
+      file_level_metadata_Table_2eproto[0]);
+}
+
+// ===================================================================
+
+class Table_Split::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Table_Split>()._impl_._has_bits_);
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_split_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Table_Split::Table_Split(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.Table.Split)
+}
+Table_Split::Table_Split(const Table_Split& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Table_Split* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.split_key_hash_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.server_id_, &from._impl_.server_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.split_key_hash_) -
+    reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.split_key_hash_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.Table.Split)
+}
+
+inline void Table_Split::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+    , decltype(_impl_.split_key_hash_){uint64_t{0u}}
+  };
+}
+
+Table_Split::~Table_Split() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.Table.Split)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Table_Split::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Table_Split::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Table_Split::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.Table.Split)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.server_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.split_key_hash_) -
+        reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.split_key_hash_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Table_Split::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed64 server_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 split_key_hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_split_key_hash(&has_bits);
+          _impl_.split_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Table_Split::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.Table.Split)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed64 server_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_server_id(), target);
+  }
+
+  // required uint64 split_key_hash = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_split_key_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.Table.Split)
+  return target;
+}
+
+size_t Table_Split::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.Table.Split)
+  size_t total_size = 0;
+
+  if (_internal_has_server_id()) {
+    // required fixed64 server_id = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_split_key_hash()) {
+    // required uint64 split_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_split_key_hash());
+  }
+
+  return total_size;
+}
+size_t Table_Split::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.Table.Split)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required fixed64 server_id = 1;
+    total_size += 1 + 8;
+
+    // required uint64 split_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_split_key_hash());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Table_Split::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Table_Split::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Table_Split::GetClassData() const { return &_class_data_; }
+
+
+void Table_Split::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Table_Split*>(&to_msg);
+  auto& from = static_cast<const Table_Split&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.Table.Split)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.split_key_hash_ = from._impl_.split_key_hash_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Table_Split::CopyFrom(const Table_Split& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.Table.Split)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Table_Split::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Table_Split::InternalSwap(Table_Split* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Table_Split, _impl_.split_key_hash_)
+      + sizeof(Table_Split::_impl_.split_key_hash_)
+      - PROTOBUF_FIELD_OFFSET(Table_Split, _impl_.server_id_)>(
+          reinterpret_cast<char*>(&_impl_.server_id_),
+          reinterpret_cast<char*>(&other->_impl_.server_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Table_Split::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Table_2eproto_getter, &descriptor_table_Table_2eproto_once,
+      file_level_metadata_Table_2eproto[1]);
+}
+
+// ===================================================================
+
+class Table_Reassign::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Table_Reassign>()._impl_._has_bits_);
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_start_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_end_key_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+Table_Reassign::Table_Reassign(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.Table.Reassign)
+}
+Table_Reassign::Table_Reassign(const Table_Reassign& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Table_Reassign* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.start_key_hash_){}
+    , decltype(_impl_.end_key_hash_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.server_id_, &from._impl_.server_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_key_hash_) -
+    reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.end_key_hash_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.Table.Reassign)
+}
+
+inline void Table_Reassign::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+    , decltype(_impl_.start_key_hash_){uint64_t{0u}}
+    , decltype(_impl_.end_key_hash_){uint64_t{0u}}
+  };
+}
+
+Table_Reassign::~Table_Reassign() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.Table.Reassign)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Table_Reassign::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Table_Reassign::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Table_Reassign::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.Table.Reassign)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.server_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.end_key_hash_) -
+        reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.end_key_hash_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Table_Reassign::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed64 server_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 start_key_hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_start_key_hash(&has_bits);
+          _impl_.start_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 end_key_hash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_end_key_hash(&has_bits);
+          _impl_.end_key_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Table_Reassign::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.Table.Reassign)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed64 server_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_server_id(), target);
+  }
+
+  // required uint64 start_key_hash = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_start_key_hash(), target);
+  }
+
+  // required uint64 end_key_hash = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_end_key_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.Table.Reassign)
+  return target;
+}
+
+size_t Table_Reassign::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.Table.Reassign)
+  size_t total_size = 0;
+
+  if (_internal_has_server_id()) {
+    // required fixed64 server_id = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_start_key_hash()) {
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+  }
+
+  if (_internal_has_end_key_hash()) {
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+  }
+
+  return total_size;
+}
+size_t Table_Reassign::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.Table.Reassign)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required fixed64 server_id = 1;
+    total_size += 1 + 8;
+
+    // required uint64 start_key_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_start_key_hash());
+
+    // required uint64 end_key_hash = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_end_key_hash());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Table_Reassign::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Table_Reassign::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Table_Reassign::GetClassData() const { return &_class_data_; }
+
+
+void Table_Reassign::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Table_Reassign*>(&to_msg);
+  auto& from = static_cast<const Table_Reassign&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.Table.Reassign)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.start_key_hash_ = from._impl_.start_key_hash_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.end_key_hash_ = from._impl_.end_key_hash_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Table_Reassign::CopyFrom(const Table_Reassign& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.Table.Reassign)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Table_Reassign::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Table_Reassign::InternalSwap(Table_Reassign* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Table_Reassign, _impl_.end_key_hash_)
+      + sizeof(Table_Reassign::_impl_.end_key_hash_)
+      - PROTOBUF_FIELD_OFFSET(Table_Reassign, _impl_.server_id_)>(
+          reinterpret_cast<char*>(&_impl_.server_id_),
+          reinterpret_cast<char*>(&other->_impl_.server_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Table_Reassign::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Table_2eproto_getter, &descriptor_table_Table_2eproto_once,
+      file_level_metadata_Table_2eproto[2]);
+}
+
+// ===================================================================
+
+class Table_Index_Indexlet::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Table_Index_Indexlet>()._impl_._has_bits_);
+  static void set_has_first_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_first_not_owned_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_backing_table_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+Table_Index_Indexlet::Table_Index_Indexlet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.Table.Index.Indexlet)
+}
+Table_Index_Indexlet::Table_Index_Indexlet(const Table_Index_Indexlet& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Table_Index_Indexlet* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.first_key_){}
+    , decltype(_impl_.first_not_owned_key_){}
+    , decltype(_impl_.backing_table_id_){}
+    , decltype(_impl_.server_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.first_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_first_key()) {
+    _this->_impl_.first_key_.Set(from._internal_first_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.first_not_owned_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_first_not_owned_key()) {
+    _this->_impl_.first_not_owned_key_.Set(from._internal_first_not_owned_key(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.backing_table_id_, &from._impl_.backing_table_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.server_id_) -
+    reinterpret_cast<char*>(&_impl_.backing_table_id_)) + sizeof(_impl_.server_id_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.Table.Index.Indexlet)
+}
+
+inline void Table_Index_Indexlet::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.first_key_){}
+    , decltype(_impl_.first_not_owned_key_){}
+    , decltype(_impl_.backing_table_id_){uint64_t{0u}}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+  };
+  _impl_.first_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.first_not_owned_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Table_Index_Indexlet::~Table_Index_Indexlet() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.Table.Index.Indexlet)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Table_Index_Indexlet::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.first_key_.Destroy();
+  _impl_.first_not_owned_key_.Destroy();
+}
+
+void Table_Index_Indexlet::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Table_Index_Indexlet::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.Table.Index.Indexlet)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.first_key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.first_not_owned_key_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.backing_table_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.server_id_) -
+        reinterpret_cast<char*>(&_impl_.backing_table_id_)) + sizeof(_impl_.server_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Table_Index_Indexlet::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string first_key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_first_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.Table.Index.Indexlet.first_key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string first_not_owned_key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_first_not_owned_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.Table.Index.Indexlet.first_not_owned_key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 backing_table_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_backing_table_id(&has_bits);
+          _impl_.backing_table_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 server_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Table_Index_Indexlet::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.Table.Index.Indexlet)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string first_key = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_first_key().data(), static_cast<int>(this->_internal_first_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.Table.Index.Indexlet.first_key");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_first_key(), target);
+  }
+
+  // required string first_not_owned_key = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_first_not_owned_key().data(), static_cast<int>(this->_internal_first_not_owned_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.Table.Index.Indexlet.first_not_owned_key");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_first_not_owned_key(), target);
+  }
+
+  // required uint64 backing_table_id = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_backing_table_id(), target);
+  }
+
+  // required fixed64 server_id = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_server_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.Table.Index.Indexlet)
+  return target;
+}
+
+size_t Table_Index_Indexlet::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.Table.Index.Indexlet)
+  size_t total_size = 0;
+
+  if (_internal_has_first_key()) {
+    // required string first_key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_first_key());
+  }
+
+  if (_internal_has_first_not_owned_key()) {
+    // required string first_not_owned_key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_first_not_owned_key());
+  }
+
+  if (_internal_has_backing_table_id()) {
+    // required uint64 backing_table_id = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_backing_table_id());
+  }
+
+  if (_internal_has_server_id()) {
+    // required fixed64 server_id = 4;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t Table_Index_Indexlet::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.Table.Index.Indexlet)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required string first_key = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_first_key());
+
+    // required string first_not_owned_key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_first_not_owned_key());
+
+    // required uint64 backing_table_id = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_backing_table_id());
+
+    // required fixed64 server_id = 4;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Table_Index_Indexlet::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Table_Index_Indexlet::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Table_Index_Indexlet::GetClassData() const { return &_class_data_; }
+
+
+void Table_Index_Indexlet::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Table_Index_Indexlet*>(&to_msg);
+  auto& from = static_cast<const Table_Index_Indexlet&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.Table.Index.Indexlet)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_first_key(from._internal_first_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_first_not_owned_key(from._internal_first_not_owned_key());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.backing_table_id_ = from._impl_.backing_table_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Table_Index_Indexlet::CopyFrom(const Table_Index_Indexlet& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.Table.Index.Indexlet)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Table_Index_Indexlet::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Table_Index_Indexlet::InternalSwap(Table_Index_Indexlet* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.first_key_, lhs_arena,
+      &other->_impl_.first_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.first_not_owned_key_, lhs_arena,
+      &other->_impl_.first_not_owned_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Table_Index_Indexlet, _impl_.server_id_)
+      + sizeof(Table_Index_Indexlet::_impl_.server_id_)
+      - PROTOBUF_FIELD_OFFSET(Table_Index_Indexlet, _impl_.backing_table_id_)>(
+          reinterpret_cast<char*>(&_impl_.backing_table_id_),
+          reinterpret_cast<char*>(&other->_impl_.backing_table_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Table_Index_Indexlet::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Table_2eproto_getter, &descriptor_table_Table_2eproto_once,
+      file_level_metadata_Table_2eproto[3]);
+}
+
+// ===================================================================
+
+class Table_Index::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Table_Index>()._impl_._has_bits_);
+  static void set_has_index_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+Table_Index::Table_Index(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.Table.Index)
+}
+Table_Index::Table_Index(const Table_Index& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Table_Index* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.indexlet_){from._impl_.indexlet_}
+    , decltype(_impl_.index_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.index_id_ = from._impl_.index_id_;
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.Table.Index)
+}
+
+inline void Table_Index::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.indexlet_){arena}
+    , decltype(_impl_.index_id_){0u}
+  };
+}
+
+Table_Index::~Table_Index() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.Table.Index)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Table_Index::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.indexlet_.~RepeatedPtrField();
+}
+
+void Table_Index::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Table_Index::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.Table.Index)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.indexlet_.Clear();
+  _impl_.index_id_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Table_Index::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 index_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_index_id(&has_bits);
+          _impl_.index_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .RAMCloud.ProtoBuf.Table.Index.Indexlet indexlet = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_indexlet(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Table_Index::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.Table.Index)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 index_id = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_index_id(), target);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.Table.Index.Indexlet indexlet = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_indexlet_size()); i < n; i++) {
+    const auto& repfield = this->_internal_indexlet(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.Table.Index)
+  return target;
+}
+
+size_t Table_Index::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.Table.Index)
+  size_t total_size = 0;
+
+  // required uint32 index_id = 1;
+  if (_internal_has_index_id()) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index_id());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.Table.Index.Indexlet indexlet = 2;
+  total_size += 1UL * this->_internal_indexlet_size();
+  for (const auto& msg : this->_impl_.indexlet_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Table_Index::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Table_Index::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Table_Index::GetClassData() const { return &_class_data_; }
+
+
+void Table_Index::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Table_Index*>(&to_msg);
+  auto& from = static_cast<const Table_Index&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.Table.Index)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.indexlet_.MergeFrom(from._impl_.indexlet_);
+  if (from._internal_has_index_id()) {
+    _this->_internal_set_index_id(from._internal_index_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Table_Index::CopyFrom(const Table_Index& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.Table.Index)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Table_Index::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.indexlet_))
+    return false;
+  return true;
+}
+
+void Table_Index::InternalSwap(Table_Index* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.indexlet_.InternalSwap(&other->_impl_.indexlet_);
+  swap(_impl_.index_id_, other->_impl_.index_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Table_Index::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Table_2eproto_getter, &descriptor_table_Table_2eproto_once,
+      file_level_metadata_Table_2eproto[4]);
+}
+
+// ===================================================================
+
+class Table_ReassignIndexlet::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Table_ReassignIndexlet>()._impl_._has_bits_);
+  static void set_has_server_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_index_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_first_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_first_not_owned_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_backing_table_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+Table_ReassignIndexlet::Table_ReassignIndexlet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.Table.ReassignIndexlet)
+}
+Table_ReassignIndexlet::Table_ReassignIndexlet(const Table_ReassignIndexlet& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Table_ReassignIndexlet* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.first_key_){}
+    , decltype(_impl_.first_not_owned_key_){}
+    , decltype(_impl_.server_id_){}
+    , decltype(_impl_.backing_table_id_){}
+    , decltype(_impl_.index_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.first_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_first_key()) {
+    _this->_impl_.first_key_.Set(from._internal_first_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.first_not_owned_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_first_not_owned_key()) {
+    _this->_impl_.first_not_owned_key_.Set(from._internal_first_not_owned_key(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.server_id_, &from._impl_.server_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.index_id_) -
+    reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.index_id_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.Table.ReassignIndexlet)
+}
+
+inline void Table_ReassignIndexlet::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.first_key_){}
+    , decltype(_impl_.first_not_owned_key_){}
+    , decltype(_impl_.server_id_){uint64_t{0u}}
+    , decltype(_impl_.backing_table_id_){uint64_t{0u}}
+    , decltype(_impl_.index_id_){0u}
+  };
+  _impl_.first_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.first_not_owned_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Table_ReassignIndexlet::~Table_ReassignIndexlet() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.Table.ReassignIndexlet)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Table_ReassignIndexlet::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.first_key_.Destroy();
+  _impl_.first_not_owned_key_.Destroy();
+}
+
+void Table_ReassignIndexlet::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Table_ReassignIndexlet::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.Table.ReassignIndexlet)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.first_key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.first_not_owned_key_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000001cu) {
+    ::memset(&_impl_.server_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.index_id_) -
+        reinterpret_cast<char*>(&_impl_.server_id_)) + sizeof(_impl_.index_id_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Table_ReassignIndexlet::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed64 server_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_server_id(&has_bits);
+          _impl_.server_id_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 index_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_index_id(&has_bits);
+          _impl_.index_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes first_key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_first_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes first_not_owned_key = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_first_not_owned_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 backing_table_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_backing_table_id(&has_bits);
+          _impl_.backing_table_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Table_ReassignIndexlet::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.Table.ReassignIndexlet)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed64 server_id = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_server_id(), target);
+  }
+
+  // required uint32 index_id = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_index_id(), target);
+  }
+
+  // required bytes first_key = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_first_key(), target);
+  }
+
+  // required bytes first_not_owned_key = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_first_not_owned_key(), target);
+  }
+
+  // required uint64 backing_table_id = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_backing_table_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.Table.ReassignIndexlet)
+  return target;
+}
+
+size_t Table_ReassignIndexlet::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.Table.ReassignIndexlet)
+  size_t total_size = 0;
+
+  if (_internal_has_first_key()) {
+    // required bytes first_key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_first_key());
+  }
+
+  if (_internal_has_first_not_owned_key()) {
+    // required bytes first_not_owned_key = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_first_not_owned_key());
+  }
+
+  if (_internal_has_server_id()) {
+    // required fixed64 server_id = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_backing_table_id()) {
+    // required uint64 backing_table_id = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_backing_table_id());
+  }
+
+  if (_internal_has_index_id()) {
+    // required uint32 index_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index_id());
+  }
+
+  return total_size;
+}
+size_t Table_ReassignIndexlet::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.Table.ReassignIndexlet)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required bytes first_key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_first_key());
+
+    // required bytes first_not_owned_key = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_first_not_owned_key());
+
+    // required fixed64 server_id = 1;
+    total_size += 1 + 8;
+
+    // required uint64 backing_table_id = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_backing_table_id());
+
+    // required uint32 index_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index_id());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Table_ReassignIndexlet::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Table_ReassignIndexlet::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Table_ReassignIndexlet::GetClassData() const { return &_class_data_; }
+
+
+void Table_ReassignIndexlet::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Table_ReassignIndexlet*>(&to_msg);
+  auto& from = static_cast<const Table_ReassignIndexlet&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.Table.ReassignIndexlet)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_first_key(from._internal_first_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_first_not_owned_key(from._internal_first_not_owned_key());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.server_id_ = from._impl_.server_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.backing_table_id_ = from._impl_.backing_table_id_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.index_id_ = from._impl_.index_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Table_ReassignIndexlet::CopyFrom(const Table_ReassignIndexlet& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.Table.ReassignIndexlet)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Table_ReassignIndexlet::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Table_ReassignIndexlet::InternalSwap(Table_ReassignIndexlet* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.first_key_, lhs_arena,
+      &other->_impl_.first_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.first_not_owned_key_, lhs_arena,
+      &other->_impl_.first_not_owned_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Table_ReassignIndexlet, _impl_.index_id_)
+      + sizeof(Table_ReassignIndexlet::_impl_.index_id_)
+      - PROTOBUF_FIELD_OFFSET(Table_ReassignIndexlet, _impl_.server_id_)>(
+          reinterpret_cast<char*>(&_impl_.server_id_),
+          reinterpret_cast<char*>(&other->_impl_.server_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Table_ReassignIndexlet::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Table_2eproto_getter, &descriptor_table_Table_2eproto_once,
+      file_level_metadata_Table_2eproto[5]);
+}
+
+// ===================================================================
+
+class Table::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Table>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_sequence_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_created(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_deleted(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::RAMCloud::ProtoBuf::Table_Split& split(const Table* msg);
+  static void set_has_split(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::RAMCloud::ProtoBuf::Table_Reassign& reassign(const Table* msg);
+  static void set_has_reassign(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::RAMCloud::ProtoBuf::Table_ReassignIndexlet& reassign_indexlet(const Table* msg);
+  static void set_has_reassign_indexlet(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000031) ^ 0x00000031) != 0;
+  }
+};
+
+const ::RAMCloud::ProtoBuf::Table_Split&
+Table::_Internal::split(const Table* msg) {
+  return *msg->_impl_.split_;
+}
+const ::RAMCloud::ProtoBuf::Table_Reassign&
+Table::_Internal::reassign(const Table* msg) {
+  return *msg->_impl_.reassign_;
+}
+const ::RAMCloud::ProtoBuf::Table_ReassignIndexlet&
+Table::_Internal::reassign_indexlet(const Table* msg) {
+  return *msg->_impl_.reassign_indexlet_;
+}
+Table::Table(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.Table)
+}
+Table::Table(const Table& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Table* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tablet_){from._impl_.tablet_}
+    , decltype(_impl_.index_){from._impl_.index_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.split_){nullptr}
+    , decltype(_impl_.reassign_){nullptr}
+    , decltype(_impl_.reassign_indexlet_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.sequence_number_){}
+    , decltype(_impl_.created_){}
+    , decltype(_impl_.deleted_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_split()) {
+    _this->_impl_.split_ = new ::RAMCloud::ProtoBuf::Table_Split(*from._impl_.split_);
+  }
+  if (from._internal_has_reassign()) {
+    _this->_impl_.reassign_ = new ::RAMCloud::ProtoBuf::Table_Reassign(*from._impl_.reassign_);
+  }
+  if (from._internal_has_reassign_indexlet()) {
+    _this->_impl_.reassign_indexlet_ = new ::RAMCloud::ProtoBuf::Table_ReassignIndexlet(*from._impl_.reassign_indexlet_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.deleted_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.deleted_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.Table)
+}
+
+inline void Table::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tablet_){arena}
+    , decltype(_impl_.index_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.split_){nullptr}
+    , decltype(_impl_.reassign_){nullptr}
+    , decltype(_impl_.reassign_indexlet_){nullptr}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.sequence_number_){uint64_t{0u}}
+    , decltype(_impl_.created_){false}
+    , decltype(_impl_.deleted_){false}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Table::~Table() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.Table)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Table::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tablet_.~RepeatedPtrField();
+  _impl_.index_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.split_;
+  if (this != internal_default_instance()) delete _impl_.reassign_;
+  if (this != internal_default_instance()) delete _impl_.reassign_indexlet_;
+}
+
+void Table::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Table::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.Table)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tablet_.Clear();
+  _impl_.index_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.split_ != nullptr);
+      _impl_.split_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.reassign_ != nullptr);
+      _impl_.reassign_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.reassign_indexlet_ != nullptr);
+      _impl_.reassign_indexlet_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f0u) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.deleted_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.deleted_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Table::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "RAMCloud.ProtoBuf.Table.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .RAMCloud.ProtoBuf.Table.Tablet tablet = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_tablet(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 sequence_number = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_sequence_number(&has_bits);
+          _impl_.sequence_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool created = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_created(&has_bits);
+          _impl_.created_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool deleted = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_deleted(&has_bits);
+          _impl_.deleted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .RAMCloud.ProtoBuf.Table.Split split = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_split(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .RAMCloud.ProtoBuf.Table.Reassign reassign = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reassign(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .RAMCloud.ProtoBuf.Table.Index index = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_index(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .RAMCloud.ProtoBuf.Table.ReassignIndexlet reassign_indexlet = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reassign_indexlet(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Table::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.Table)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "RAMCloud.ProtoBuf.Table.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // required uint64 id = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_id(), target);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.Table.Tablet tablet = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tablet_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tablet(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // required uint64 sequence_number = 4;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_sequence_number(), target);
+  }
+
+  // optional bool created = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_created(), target);
+  }
+
+  // optional bool deleted = 6;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_deleted(), target);
+  }
+
+  // optional .RAMCloud.ProtoBuf.Table.Split split = 7;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::split(this),
+        _Internal::split(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .RAMCloud.ProtoBuf.Table.Reassign reassign = 8;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::reassign(this),
+        _Internal::reassign(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.Table.Index index = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_index_size()); i < n; i++) {
+    const auto& repfield = this->_internal_index(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .RAMCloud.ProtoBuf.Table.ReassignIndexlet reassign_indexlet = 10;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::reassign_indexlet(this),
+        _Internal::reassign_indexlet(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.Table)
+  return target;
+}
+
+size_t Table::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.Table)
+  size_t total_size = 0;
+
+  if (_internal_has_name()) {
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  if (_internal_has_id()) {
+    // required uint64 id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  if (_internal_has_sequence_number()) {
+    // required uint64 sequence_number = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence_number());
+  }
+
+  return total_size;
+}
+size_t Table::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.Table)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000031) ^ 0x00000031) == 0) {  // All required fields are present.
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+
+    // required uint64 id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+
+    // required uint64 sequence_number = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence_number());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.Table.Tablet tablet = 3;
+  total_size += 1UL * this->_internal_tablet_size();
+  for (const auto& msg : this->_impl_.tablet_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.Table.Index index = 9;
+  total_size += 1UL * this->_internal_index_size();
+  for (const auto& msg : this->_impl_.index_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000eu) {
+    // optional .RAMCloud.ProtoBuf.Table.Split split = 7;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.split_);
+    }
+
+    // optional .RAMCloud.ProtoBuf.Table.Reassign reassign = 8;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.reassign_);
+    }
+
+    // optional .RAMCloud.ProtoBuf.Table.ReassignIndexlet reassign_indexlet = 10;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.reassign_indexlet_);
+    }
+
+  }
+  if (cached_has_bits & 0x000000c0u) {
+    // optional bool created = 5;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool deleted = 6;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Table::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Table::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Table::GetClassData() const { return &_class_data_; }
+
+
+void Table::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Table*>(&to_msg);
+  auto& from = static_cast<const Table&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.Table)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.tablet_.MergeFrom(from._impl_.tablet_);
+  _this->_impl_.index_.MergeFrom(from._impl_.index_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_split()->::RAMCloud::ProtoBuf::Table_Split::MergeFrom(
+          from._internal_split());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_reassign()->::RAMCloud::ProtoBuf::Table_Reassign::MergeFrom(
+          from._internal_reassign());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_reassign_indexlet()->::RAMCloud::ProtoBuf::Table_ReassignIndexlet::MergeFrom(
+          from._internal_reassign_indexlet());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.sequence_number_ = from._impl_.sequence_number_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.created_ = from._impl_.created_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.deleted_ = from._impl_.deleted_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Table::CopyFrom(const Table& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.Table)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Table::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.tablet_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.index_))
+    return false;
+  if (_internal_has_split()) {
+    if (!_impl_.split_->IsInitialized()) return false;
+  }
+  if (_internal_has_reassign()) {
+    if (!_impl_.reassign_->IsInitialized()) return false;
+  }
+  if (_internal_has_reassign_indexlet()) {
+    if (!_impl_.reassign_indexlet_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Table::InternalSwap(Table* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.tablet_.InternalSwap(&other->_impl_.tablet_);
+  _impl_.index_.InternalSwap(&other->_impl_.index_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Table, _impl_.deleted_)
+      + sizeof(Table::_impl_.deleted_)
+      - PROTOBUF_FIELD_OFFSET(Table, _impl_.split_)>(
+          reinterpret_cast<char*>(&_impl_.split_),
+          reinterpret_cast<char*>(&other->_impl_.split_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Table::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Table_2eproto_getter, &descriptor_table_Table_2eproto_once,
+      file_level_metadata_Table_2eproto[6]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::Table_Tablet*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::Table_Tablet >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::Table_Tablet >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::Table_Split*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::Table_Split >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::Table_Split >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::Table_Reassign*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::Table_Reassign >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::Table_Reassign >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::Table_Index_Indexlet*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::Table_Index_Indexlet >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::Table_Index_Indexlet >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::Table_Index*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::Table_Index >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::Table_Index >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::Table_ReassignIndexlet*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::Table_ReassignIndexlet >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::Table_ReassignIndexlet >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::Table*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::Table >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::Table >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
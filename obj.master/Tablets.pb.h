@@ -0,0 +1,945 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Tablets.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_Tablets_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_Tablets_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_Tablets_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_Tablets_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Tablets_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class Tablets;
+struct TabletsDefaultTypeInternal;
+extern TabletsDefaultTypeInternal _Tablets_default_instance_;
+class Tablets_Tablet;
+struct Tablets_TabletDefaultTypeInternal;
+extern Tablets_TabletDefaultTypeInternal _Tablets_Tablet_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::Tablets* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Tablets>(Arena*);
+template<> ::RAMCloud::ProtoBuf::Tablets_Tablet* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Tablets_Tablet>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+enum Tablets_Tablet_State : int {
+  Tablets_Tablet_State_NORMAL = 0,
+  Tablets_Tablet_State_RECOVERING = 1
+};
+bool Tablets_Tablet_State_IsValid(int value);
+constexpr Tablets_Tablet_State Tablets_Tablet_State_State_MIN = Tablets_Tablet_State_NORMAL;
+constexpr Tablets_Tablet_State Tablets_Tablet_State_State_MAX = Tablets_Tablet_State_RECOVERING;
+constexpr int Tablets_Tablet_State_State_ARRAYSIZE = Tablets_Tablet_State_State_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Tablets_Tablet_State_descriptor();
+template<typename T>
+inline const std::string& Tablets_Tablet_State_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Tablets_Tablet_State>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Tablets_Tablet_State_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Tablets_Tablet_State_descriptor(), enum_t_value);
+}
+inline bool Tablets_Tablet_State_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Tablets_Tablet_State* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Tablets_Tablet_State>(
+    Tablets_Tablet_State_descriptor(), name, value);
+}
+// ===================================================================
+
+class Tablets_Tablet final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Tablets.Tablet) */ {
+ public:
+  inline Tablets_Tablet() : Tablets_Tablet(nullptr) {}
+  ~Tablets_Tablet() override;
+  explicit PROTOBUF_CONSTEXPR Tablets_Tablet(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Tablets_Tablet(const Tablets_Tablet& from);
+  Tablets_Tablet(Tablets_Tablet&& from) noexcept
+    : Tablets_Tablet() {
+    *this = ::std::move(from);
+  }
+
+  inline Tablets_Tablet& operator=(const Tablets_Tablet& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Tablets_Tablet& operator=(Tablets_Tablet&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Tablets_Tablet& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Tablets_Tablet* internal_default_instance() {
+    return reinterpret_cast<const Tablets_Tablet*>(
+               &_Tablets_Tablet_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Tablets_Tablet& a, Tablets_Tablet& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Tablets_Tablet* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Tablets_Tablet* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Tablets_Tablet* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Tablets_Tablet>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Tablets_Tablet& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Tablets_Tablet& from) {
+    Tablets_Tablet::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Tablets_Tablet* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Tablets.Tablet";
+  }
+  protected:
+  explicit Tablets_Tablet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Tablets_Tablet_State State;
+  static constexpr State NORMAL =
+    Tablets_Tablet_State_NORMAL;
+  static constexpr State RECOVERING =
+    Tablets_Tablet_State_RECOVERING;
+  static inline bool State_IsValid(int value) {
+    return Tablets_Tablet_State_IsValid(value);
+  }
+  static constexpr State State_MIN =
+    Tablets_Tablet_State_State_MIN;
+  static constexpr State State_MAX =
+    Tablets_Tablet_State_State_MAX;
+  static constexpr int State_ARRAYSIZE =
+    Tablets_Tablet_State_State_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  State_descriptor() {
+    return Tablets_Tablet_State_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& State_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, State>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function State_Name.");
+    return Tablets_Tablet_State_Name(enum_t_value);
+  }
+  static inline bool State_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      State* value) {
+    return Tablets_Tablet_State_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceLocatorFieldNumber = 6,
+    kTableIdFieldNumber = 1,
+    kStartKeyHashFieldNumber = 2,
+    kEndKeyHashFieldNumber = 3,
+    kServerIdFieldNumber = 5,
+    kStateFieldNumber = 4,
+    kCtimeLogHeadOffsetFieldNumber = 9,
+    kUserDataFieldNumber = 7,
+    kCtimeLogHeadIdFieldNumber = 8,
+  };
+  // optional string service_locator = 6;
+  bool has_service_locator() const;
+  private:
+  bool _internal_has_service_locator() const;
+  public:
+  void clear_service_locator();
+  const std::string& service_locator() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_locator(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_locator();
+  PROTOBUF_NODISCARD std::string* release_service_locator();
+  void set_allocated_service_locator(std::string* service_locator);
+  private:
+  const std::string& _internal_service_locator() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_locator(const std::string& value);
+  std::string* _internal_mutable_service_locator();
+  public:
+
+  // required uint64 table_id = 1;
+  bool has_table_id() const;
+  private:
+  bool _internal_has_table_id() const;
+  public:
+  void clear_table_id();
+  uint64_t table_id() const;
+  void set_table_id(uint64_t value);
+  private:
+  uint64_t _internal_table_id() const;
+  void _internal_set_table_id(uint64_t value);
+  public:
+
+  // required uint64 start_key_hash = 2;
+  bool has_start_key_hash() const;
+  private:
+  bool _internal_has_start_key_hash() const;
+  public:
+  void clear_start_key_hash();
+  uint64_t start_key_hash() const;
+  void set_start_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_start_key_hash() const;
+  void _internal_set_start_key_hash(uint64_t value);
+  public:
+
+  // required uint64 end_key_hash = 3;
+  bool has_end_key_hash() const;
+  private:
+  bool _internal_has_end_key_hash() const;
+  public:
+  void clear_end_key_hash();
+  uint64_t end_key_hash() const;
+  void set_end_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_end_key_hash() const;
+  void _internal_set_end_key_hash(uint64_t value);
+  public:
+
+  // optional fixed64 server_id = 5;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // required .RAMCloud.ProtoBuf.Tablets.Tablet.State state = 4;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  ::RAMCloud::ProtoBuf::Tablets_Tablet_State state() const;
+  void set_state(::RAMCloud::ProtoBuf::Tablets_Tablet_State value);
+  private:
+  ::RAMCloud::ProtoBuf::Tablets_Tablet_State _internal_state() const;
+  void _internal_set_state(::RAMCloud::ProtoBuf::Tablets_Tablet_State value);
+  public:
+
+  // required uint32 ctime_log_head_offset = 9;
+  bool has_ctime_log_head_offset() const;
+  private:
+  bool _internal_has_ctime_log_head_offset() const;
+  public:
+  void clear_ctime_log_head_offset();
+  uint32_t ctime_log_head_offset() const;
+  void set_ctime_log_head_offset(uint32_t value);
+  private:
+  uint32_t _internal_ctime_log_head_offset() const;
+  void _internal_set_ctime_log_head_offset(uint32_t value);
+  public:
+
+  // optional fixed64 user_data = 7;
+  bool has_user_data() const;
+  private:
+  bool _internal_has_user_data() const;
+  public:
+  void clear_user_data();
+  uint64_t user_data() const;
+  void set_user_data(uint64_t value);
+  private:
+  uint64_t _internal_user_data() const;
+  void _internal_set_user_data(uint64_t value);
+  public:
+
+  // required uint64 ctime_log_head_id = 8;
+  bool has_ctime_log_head_id() const;
+  private:
+  bool _internal_has_ctime_log_head_id() const;
+  public:
+  void clear_ctime_log_head_id();
+  uint64_t ctime_log_head_id() const;
+  void set_ctime_log_head_id(uint64_t value);
+  private:
+  uint64_t _internal_ctime_log_head_id() const;
+  void _internal_set_ctime_log_head_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Tablets.Tablet)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_locator_;
+    uint64_t table_id_;
+    uint64_t start_key_hash_;
+    uint64_t end_key_hash_;
+    uint64_t server_id_;
+    int state_;
+    uint32_t ctime_log_head_offset_;
+    uint64_t user_data_;
+    uint64_t ctime_log_head_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Tablets_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Tablets final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Tablets) */ {
+ public:
+  inline Tablets() : Tablets(nullptr) {}
+  ~Tablets() override;
+  explicit PROTOBUF_CONSTEXPR Tablets(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Tablets(const Tablets& from);
+  Tablets(Tablets&& from) noexcept
+    : Tablets() {
+    *this = ::std::move(from);
+  }
+
+  inline Tablets& operator=(const Tablets& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Tablets& operator=(Tablets&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Tablets& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Tablets* internal_default_instance() {
+    return reinterpret_cast<const Tablets*>(
+               &_Tablets_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Tablets& a, Tablets& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Tablets* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Tablets* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Tablets* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Tablets>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Tablets& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Tablets& from) {
+    Tablets::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Tablets* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Tablets";
+  }
+  protected:
+  explicit Tablets(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Tablets_Tablet Tablet;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTabletFieldNumber = 1,
+  };
+  // repeated .RAMCloud.ProtoBuf.Tablets.Tablet tablet = 1;
+  int tablet_size() const;
+  private:
+  int _internal_tablet_size() const;
+  public:
+  void clear_tablet();
+  ::RAMCloud::ProtoBuf::Tablets_Tablet* mutable_tablet(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Tablets_Tablet >*
+      mutable_tablet();
+  private:
+  const ::RAMCloud::ProtoBuf::Tablets_Tablet& _internal_tablet(int index) const;
+  ::RAMCloud::ProtoBuf::Tablets_Tablet* _internal_add_tablet();
+  public:
+  const ::RAMCloud::ProtoBuf::Tablets_Tablet& tablet(int index) const;
+  ::RAMCloud::ProtoBuf::Tablets_Tablet* add_tablet();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Tablets_Tablet >&
+      tablet() const;
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Tablets)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Tablets_Tablet > tablet_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Tablets_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Tablets_Tablet
+
+// required uint64 table_id = 1;
+inline bool Tablets_Tablet::_internal_has_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Tablets_Tablet::has_table_id() const {
+  return _internal_has_table_id();
+}
+inline void Tablets_Tablet::clear_table_id() {
+  _impl_.table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Tablets_Tablet::_internal_table_id() const {
+  return _impl_.table_id_;
+}
+inline uint64_t Tablets_Tablet::table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Tablets.Tablet.table_id)
+  return _internal_table_id();
+}
+inline void Tablets_Tablet::_internal_set_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.table_id_ = value;
+}
+inline void Tablets_Tablet::set_table_id(uint64_t value) {
+  _internal_set_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Tablets.Tablet.table_id)
+}
+
+// required uint64 start_key_hash = 2;
+inline bool Tablets_Tablet::_internal_has_start_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Tablets_Tablet::has_start_key_hash() const {
+  return _internal_has_start_key_hash();
+}
+inline void Tablets_Tablet::clear_start_key_hash() {
+  _impl_.start_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Tablets_Tablet::_internal_start_key_hash() const {
+  return _impl_.start_key_hash_;
+}
+inline uint64_t Tablets_Tablet::start_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Tablets.Tablet.start_key_hash)
+  return _internal_start_key_hash();
+}
+inline void Tablets_Tablet::_internal_set_start_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.start_key_hash_ = value;
+}
+inline void Tablets_Tablet::set_start_key_hash(uint64_t value) {
+  _internal_set_start_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Tablets.Tablet.start_key_hash)
+}
+
+// required uint64 end_key_hash = 3;
+inline bool Tablets_Tablet::_internal_has_end_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Tablets_Tablet::has_end_key_hash() const {
+  return _internal_has_end_key_hash();
+}
+inline void Tablets_Tablet::clear_end_key_hash() {
+  _impl_.end_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t Tablets_Tablet::_internal_end_key_hash() const {
+  return _impl_.end_key_hash_;
+}
+inline uint64_t Tablets_Tablet::end_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Tablets.Tablet.end_key_hash)
+  return _internal_end_key_hash();
+}
+inline void Tablets_Tablet::_internal_set_end_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.end_key_hash_ = value;
+}
+inline void Tablets_Tablet::set_end_key_hash(uint64_t value) {
+  _internal_set_end_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Tablets.Tablet.end_key_hash)
+}
+
+// required .RAMCloud.ProtoBuf.Tablets.Tablet.State state = 4;
+inline bool Tablets_Tablet::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Tablets_Tablet::has_state() const {
+  return _internal_has_state();
+}
+inline void Tablets_Tablet::clear_state() {
+  _impl_.state_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::RAMCloud::ProtoBuf::Tablets_Tablet_State Tablets_Tablet::_internal_state() const {
+  return static_cast< ::RAMCloud::ProtoBuf::Tablets_Tablet_State >(_impl_.state_);
+}
+inline ::RAMCloud::ProtoBuf::Tablets_Tablet_State Tablets_Tablet::state() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Tablets.Tablet.state)
+  return _internal_state();
+}
+inline void Tablets_Tablet::_internal_set_state(::RAMCloud::ProtoBuf::Tablets_Tablet_State value) {
+  assert(::RAMCloud::ProtoBuf::Tablets_Tablet_State_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.state_ = value;
+}
+inline void Tablets_Tablet::set_state(::RAMCloud::ProtoBuf::Tablets_Tablet_State value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Tablets.Tablet.state)
+}
+
+// optional fixed64 server_id = 5;
+inline bool Tablets_Tablet::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Tablets_Tablet::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void Tablets_Tablet::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t Tablets_Tablet::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t Tablets_Tablet::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Tablets.Tablet.server_id)
+  return _internal_server_id();
+}
+inline void Tablets_Tablet::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.server_id_ = value;
+}
+inline void Tablets_Tablet::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Tablets.Tablet.server_id)
+}
+
+// optional string service_locator = 6;
+inline bool Tablets_Tablet::_internal_has_service_locator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Tablets_Tablet::has_service_locator() const {
+  return _internal_has_service_locator();
+}
+inline void Tablets_Tablet::clear_service_locator() {
+  _impl_.service_locator_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Tablets_Tablet::service_locator() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Tablets.Tablet.service_locator)
+  return _internal_service_locator();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Tablets_Tablet::set_service_locator(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.service_locator_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Tablets.Tablet.service_locator)
+}
+inline std::string* Tablets_Tablet::mutable_service_locator() {
+  std::string* _s = _internal_mutable_service_locator();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Tablets.Tablet.service_locator)
+  return _s;
+}
+inline const std::string& Tablets_Tablet::_internal_service_locator() const {
+  return _impl_.service_locator_.Get();
+}
+inline void Tablets_Tablet::_internal_set_service_locator(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.service_locator_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Tablets_Tablet::_internal_mutable_service_locator() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.service_locator_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Tablets_Tablet::release_service_locator() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Tablets.Tablet.service_locator)
+  if (!_internal_has_service_locator()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.service_locator_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Tablets_Tablet::set_allocated_service_locator(std::string* service_locator) {
+  if (service_locator != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.service_locator_.SetAllocated(service_locator, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Tablets.Tablet.service_locator)
+}
+
+// optional fixed64 user_data = 7;
+inline bool Tablets_Tablet::_internal_has_user_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Tablets_Tablet::has_user_data() const {
+  return _internal_has_user_data();
+}
+inline void Tablets_Tablet::clear_user_data() {
+  _impl_.user_data_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t Tablets_Tablet::_internal_user_data() const {
+  return _impl_.user_data_;
+}
+inline uint64_t Tablets_Tablet::user_data() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Tablets.Tablet.user_data)
+  return _internal_user_data();
+}
+inline void Tablets_Tablet::_internal_set_user_data(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.user_data_ = value;
+}
+inline void Tablets_Tablet::set_user_data(uint64_t value) {
+  _internal_set_user_data(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Tablets.Tablet.user_data)
+}
+
+// required uint64 ctime_log_head_id = 8;
+inline bool Tablets_Tablet::_internal_has_ctime_log_head_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Tablets_Tablet::has_ctime_log_head_id() const {
+  return _internal_has_ctime_log_head_id();
+}
+inline void Tablets_Tablet::clear_ctime_log_head_id() {
+  _impl_.ctime_log_head_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t Tablets_Tablet::_internal_ctime_log_head_id() const {
+  return _impl_.ctime_log_head_id_;
+}
+inline uint64_t Tablets_Tablet::ctime_log_head_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Tablets.Tablet.ctime_log_head_id)
+  return _internal_ctime_log_head_id();
+}
+inline void Tablets_Tablet::_internal_set_ctime_log_head_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.ctime_log_head_id_ = value;
+}
+inline void Tablets_Tablet::set_ctime_log_head_id(uint64_t value) {
+  _internal_set_ctime_log_head_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Tablets.Tablet.ctime_log_head_id)
+}
+
+// required uint32 ctime_log_head_offset = 9;
+inline bool Tablets_Tablet::_internal_has_ctime_log_head_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Tablets_Tablet::has_ctime_log_head_offset() const {
+  return _internal_has_ctime_log_head_offset();
+}
+inline void Tablets_Tablet::clear_ctime_log_head_offset() {
+  _impl_.ctime_log_head_offset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t Tablets_Tablet::_internal_ctime_log_head_offset() const {
+  return _impl_.ctime_log_head_offset_;
+}
+inline uint32_t Tablets_Tablet::ctime_log_head_offset() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Tablets.Tablet.ctime_log_head_offset)
+  return _internal_ctime_log_head_offset();
+}
+inline void Tablets_Tablet::_internal_set_ctime_log_head_offset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.ctime_log_head_offset_ = value;
+}
+inline void Tablets_Tablet::set_ctime_log_head_offset(uint32_t value) {
+  _internal_set_ctime_log_head_offset(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Tablets.Tablet.ctime_log_head_offset)
+}
+
+// -------------------------------------------------------------------
+
+// Tablets
+
+// repeated .RAMCloud.ProtoBuf.Tablets.Tablet tablet = 1;
+inline int Tablets::_internal_tablet_size() const {
+  return _impl_.tablet_.size();
+}
+inline int Tablets::tablet_size() const {
+  return _internal_tablet_size();
+}
+inline void Tablets::clear_tablet() {
+  _impl_.tablet_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::Tablets_Tablet* Tablets::mutable_tablet(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Tablets.tablet)
+  return _impl_.tablet_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Tablets_Tablet >*
+Tablets::mutable_tablet() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.Tablets.tablet)
+  return &_impl_.tablet_;
+}
+inline const ::RAMCloud::ProtoBuf::Tablets_Tablet& Tablets::_internal_tablet(int index) const {
+  return _impl_.tablet_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::Tablets_Tablet& Tablets::tablet(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Tablets.tablet)
+  return _internal_tablet(index);
+}
+inline ::RAMCloud::ProtoBuf::Tablets_Tablet* Tablets::_internal_add_tablet() {
+  return _impl_.tablet_.Add();
+}
+inline ::RAMCloud::ProtoBuf::Tablets_Tablet* Tablets::add_tablet() {
+  ::RAMCloud::ProtoBuf::Tablets_Tablet* _add = _internal_add_tablet();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.Tablets.tablet)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Tablets_Tablet >&
+Tablets::tablet() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.Tablets.tablet)
+  return _impl_.tablet_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::RAMCloud::ProtoBuf::Tablets_Tablet_State> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::RAMCloud::ProtoBuf::Tablets_Tablet_State>() {
+  return ::RAMCloud::ProtoBuf::Tablets_Tablet_State_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_Tablets_2eproto
+// RAMCloud pragma [GCCWARN=0]
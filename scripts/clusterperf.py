@@ -922,6 +922,7 @@ graph_tests = [
     Test("writeDistWorkload", workloadDist),
     Test("writeInterference", default),
     Test("writeThroughput", readThroughput),
+    Test("workloadRamp", readThroughput),
     Test("workloadThroughput", readThroughput),
     Test("migrateLoaded", migrateLoaded),
 ]
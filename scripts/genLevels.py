@@ -42,6 +42,7 @@ import sys
 # the Opcode enum in WireFormat.h.
 
 callees = {
+    "BACKUP_WRITE":          ["BACKUP_CHAIN_WRITE"],
     "COORD_SPLIT_AND_MIGRATE_INDEXLET":
                              ["SPLIT_AND_MIGRATE_INDEXLET",
                               "TAKE_TABLET_OWNERSHIP",
@@ -51,32 +52,36 @@ callees = {
     "CREATE_TABLE":          ["TAKE_TABLET_OWNERSHIP"],
     "DROP_INDEX":            ["DROP_TABLET_OWNERSHIP"],
     "DROP_TABLE":            ["TAKE_TABLET_OWNERSHIP"],
-    "FILL_WITH_TEST_DATA":   ["BACKUP_WRITE"],
-    "GET_HEAD_OF_LOG":       ["BACKUP_WRITE"],
+    "FILL_WITH_TEST_DATA":   ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
+    "GET_HEAD_OF_LOG":       ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
     "HINT_SERVER_CRASHED":   ["PING"],
-    "INCREMENT":             ["BACKUP_WRITE"],
-    "INSERT_INDEX_ENTRY":    ["BACKUP_WRITE"],
+    "INCREMENT":             ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
+    "INSERT_INDEX_ENTRY":    ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
     "MIGRATE_TABLET":        ["RECEIVE_MIGRATION_DATA",
                               "REASSIGN_TABLET_OWNERSHIP"],
-    "MULTI_OP":              ["BACKUP_WRITE", "INSERT_INDEX_ENTRY",
+    "MULTI_OP":              ["BACKUP_MULTI_WRITE", "BACKUP_WRITE",
+                              "INSERT_INDEX_ENTRY",
                               "REMOVE_INDEX_ENTRY"],
-    "READ":                  ["BACKUP_WRITE"],
-    "READ_HASHES":           ["BACKUP_WRITE"],
-    "READ_KEYS_AND_VALUE":   ["BACKUP_WRITE"],
+    "READ":                  ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
+    "READ_HASHES":           ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
+    "READ_KEYS_AND_VALUE":   ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
     "REASSIGN_TABLET_OWNERSHIP": ["TAKE_TABLET_OWNERSHIP"],
-    "RECEIVE_MIGRATION_DATA":["BACKUP_WRITE"],
-    "RECOVER":               ["BACKUP_GETRECOVERYDATA", "BACKUP_WRITE"],
-    "REMOVE":                ["BACKUP_WRITE", "REMOVE_INDEX_ENTRY"],
-    "REMOVE_INDEX_ENTRY":    ["BACKUP_WRITE"],
+    "RECEIVE_MIGRATION_DATA":["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
+    "RECOVER":               ["BACKUP_GETRECOVERYDATA",
+                              "BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
+    "REMOVE":                ["BACKUP_MULTI_WRITE", "BACKUP_WRITE",
+                              "REMOVE_INDEX_ENTRY"],
+    "REMOVE_INDEX_ENTRY":    ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
     "SERVER_CONTROL_ALL":    ["SERVER_CONTROL"],
     "SPLIT_AND_MIGRATE_INDEXLET":
                              ["RECEIVE_MIGRATION_DATA"],
-    "TAKE_TABLET_OWNERSHIP": ["BACKUP_WRITE"],
-    "TX_DECISION":           ["BACKUP_WRITE"],
-    "TX_HINT_FAILED":        ["BACKUP_WRITE"],
-    "TX_PREPARE":            ["BACKUP_WRITE"],
-    "TX_REQUEST_ABORT":      ["BACKUP_WRITE"],
-    "WRITE":                 ["BACKUP_WRITE", "INSERT_INDEX_ENTRY",
+    "TAKE_TABLET_OWNERSHIP": ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
+    "TX_DECISION":           ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
+    "TX_HINT_FAILED":        ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
+    "TX_PREPARE":            ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
+    "TX_REQUEST_ABORT":      ["BACKUP_MULTI_WRITE", "BACKUP_WRITE"],
+    "WRITE":                 ["BACKUP_MULTI_WRITE", "BACKUP_WRITE",
+                              "INSERT_INDEX_ENTRY",
                               "REMOVE_INDEX_ENTRY"],
 }
 
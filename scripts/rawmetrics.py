@@ -280,6 +280,8 @@ backup.metric('storageWriteCount', 'number of segment writes to disk')
 backup.metric('storageWriteBytes', 'bytes written to disk')
 backup.metric('storageWriteTicks', 'time writing to disk')
 backup.metric('filterTicks', 'time filtering segments')
+backup.metric('filterBytes',
+    'bytes of replica data filtered into recovery segments')
 backup.metric('primaryLoadCount', 'number of primary segments requested')
 backup.metric('secondaryLoadCount', 'number of secondary segments requested')
 backup.metric('storageType', '1 = in-memory, 2 = on-disk')
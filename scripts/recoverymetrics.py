@@ -480,6 +480,8 @@ def makeReport(data):
                 storageTypeStr = 'memory'
             elif storageType == 2:
                 storageTypeStr = 'disk'
+            elif storageType == 3:
+                storageTypeStr = 'persistent memory'
             else:
                 storageTypeStr = 'unknown (%s)' % storageType
         summary.line('Storage type', storageTypeStr)
@@ -795,6 +797,16 @@ def makeReport(data):
                  'backup.readingDataTicks')
     backup_ticks('Reading replicas from disk',
                  'backup.storageReadTicks')
+    backupSection.line('Recovery segment build throughput',
+        on_backups(lambda b: (b.backup.filterBytes / 2**20) /
+                             recoveryTime),
+        unit='MB/s',
+        summaryFns=[AVG, MIN, SUM])
+    backupSection.line('Build throughput per filtering thread',
+        on_backups(lambda b: (b.backup.filterBytes / 2**20) /
+                             (b.backup.filterTicks / b.clockFrequency)),
+        unit='MB/s',
+        summaryFns=[AVG, MIN])
     backupSection.line('getRecoveryData completions',
         on_backups(lambda b: b.backup.readCompletionCount))
     backupSection.line('getRecoveryData retry fraction',
@@ -24,6 +24,9 @@
 
 namespace RAMCloud {
 
+__thread AbstractLog* AbstractLog::unsyncedHotLog = NULL;
+__thread bool AbstractLog::severalUnsyncedHotLogs = false;
+
 /**
  * Constructor for AbstractLog.
  *
@@ -39,21 +42,34 @@ namespace RAMCloud {
  *      Segments durable.
  * \param segmentSize
  *      The size, in bytes, of segments this log will use.
+ * \param numHeads
+ *      Number of segments this log will append to concurrently. See
+ *      AbstractLog::Head.
+ * \param hotHead
+ *      If true, one more head is added, which only receives appends made with
+ *      the "hot" flag set.
  */
 AbstractLog::AbstractLog(LogEntryHandlers* entryHandlers,
                          SegmentManager* segmentManager,
                          ReplicaManager* replicaManager,
-                         uint32_t segmentSize)
+                         uint32_t segmentSize,
+                         uint32_t numHeads,
+                         bool hotHead)
     : entryHandlers(entryHandlers),
       segmentManager(segmentManager),
       replicaManager(replicaManager),
       segmentSize(segmentSize),
-      head(NULL),
-      appendLock("AbstractLog::appendLock"),
+      numHeads(std::max(1U, numHeads) + (hotHead ? 1U : 0U)),
+      hasHotHead(hotHead),
+      heads(new Head[this->numHeads]),
+      allocLock("AbstractLog::allocLock"),
       totalLiveBytes(0),
       maxLiveBytes(0),
       metrics()
 {
+    for (uint32_t i = 0; i < this->numHeads; i++)
+        heads[i].index = i;
+
     SegletAllocator& alloc = segmentManager->getAllocator();
     maxLiveBytes = static_cast<uint64_t>(0.95 * alloc.getSegletSize() *
             static_cast<double>(alloc.getTotalCount(SegletAllocator::DEFAULT)));
@@ -74,45 +90,58 @@ AbstractLog::AbstractLog(LogEntryHandlers* entryHandlers,
  *      are also returned here.
  * \param numAppends
  *      Number of entries in the appends array.
+ * \param hot
+ *      True if the caller expects these entries to be superseded soon. If the
+ *      log has a hot head, they are appended to it rather than to the calling
+ *      thread's head.
  * \return
  *      True if the append succeeded, false if there was insufficient space
  *      to complete the operation.
  */
 bool
-AbstractLog::append(AppendVector* appends, uint32_t numAppends)
+AbstractLog::append(AppendVector* appends, uint32_t numAppends, bool hot)
 {
-    CycleCounter<uint64_t> _(&metrics.totalAppendTicks);
-    SpinLock::Guard lock(appendLock);
+    CycleCounter<std::atomic<uint64_t>> _(&metrics.totalAppendTicks);
+    Head& head = (hot && hasHotHead) ? heads[numHeads - 1] :
+                                       getHeadForThread();
+    SpinLock::Guard lock(head.appendLock);
     metrics.totalAppendCalls++;
 
     uint32_t lengths[numAppends];
     for (uint32_t i = 0; i < numAppends; i++)
         lengths[i] = appends[i].buffer.size();
 
-    if (head == NULL || !head->hasSpaceFor(lengths, numAppends)) {
-        if (!allocNewWritableHead())
+    if (head.segment == NULL ||
+            !head.segment->hasSpaceFor(lengths, numAppends)) {
+        if (!allocNewWritableHead(head))
             return false;
     }
 
-    if (head->isEmergencyHead)
+    if (head.segment->isEmergencyHead)
         return false;
 
-    if (!head->hasSpaceFor(lengths, numAppends))
+    if (!head.segment->hasSpaceFor(lengths, numAppends))
         throw FatalError(HERE, "too much data to append to one segment");
 
-    LogSegment* headBefore = head;
+    LogSegment* headBefore = head.segment;
     for (uint32_t i = 0; i < numAppends; i++) {
         bool enoughSpace = append(lock,
+                                  head,
                                   appends[i].type,
                                   appends[i].buffer,
                                   &appends[i].reference);
         if (!enoughSpace)
             throw FatalError(HERE, "Guaranteed append managed to fail");
     }
-    if (head != headBefore) {
-        assert(head == headBefore);
+    if (head.segment != headBefore) {
+        assert(head.segment == headBefore);
     }
 
+    if (&head == getHotHead()) {
+        if (unsyncedHotLog != NULL && unsyncedHotLog != this)
+            severalUnsyncedHotLogs = true;
+        unsyncedHotLog = this;
+    }
     return true;
 }
 
@@ -133,22 +162,24 @@ bool
 AbstractLog::append(Buffer *logBuffer, Reference *references,
                     uint32_t numEntries)
 {
-    CycleCounter<uint64_t> _(&metrics.totalAppendTicks);
-    SpinLock::Guard lock(appendLock);
+    CycleCounter<std::atomic<uint64_t>> _(&metrics.totalAppendTicks);
+    Head& head = getHeadForThread();
+    SpinLock::Guard lock(head.appendLock);
     metrics.totalAppendCalls++;
 
-    if (head == NULL || !head->hasSpaceFor(logBuffer->size())) {
-        if (!allocNewWritableHead())
+    if (head.segment == NULL ||
+            !head.segment->hasSpaceFor(logBuffer->size())) {
+        if (!allocNewWritableHead(head))
             return false;
     }
 
-    if (head->isEmergencyHead)
+    if (head.segment->isEmergencyHead)
         return false;
 
-    if (!head->hasSpaceFor(logBuffer->size()))
+    if (!head.segment->hasSpaceFor(logBuffer->size()))
         throw FatalError(HERE, "too much data to append to one segment");
 
-    LogSegment* headBefore = head;
+    LogSegment* headBefore = head.segment;
 
     // Makes sense to call getRange on the entire logBuffer here because
     // everything n the buffer has to be written out before this function
@@ -163,6 +194,7 @@ AbstractLog::append(Buffer *logBuffer, Reference *references,
     uint32_t offset = 0;
     for (uint32_t i = 0; i < numEntries; i++) {
         bool enoughSpace = append(lock,
+                                  head,
                                   buffer + offset,
                                   &entryLength,
                                   &references[i]);
@@ -171,8 +203,8 @@ AbstractLog::append(Buffer *logBuffer, Reference *references,
         offset+= entryLength;
     }
 
-    if (head != headBefore) {
-        assert(head == headBefore);
+    if (head.segment != headBefore) {
+        assert(head.segment == headBefore);
     }
 
     return true;
@@ -223,6 +255,11 @@ AbstractLog::getMetrics(ProtoBuf::LogMetrics& m)
     m.set_total_bytes_appended(metrics.totalBytesAppended);
     m.set_total_metadata_bytes_appended(metrics.totalMetadataBytesAppended);
 
+    Segment::DecompressionMetrics& dm = Segment::decompressionMetrics;
+    m.set_total_decompressed_entries(dm.totalEntries);
+    m.set_total_decompressed_bytes(dm.totalBytes);
+    m.set_total_decompression_ticks(dm.totalTicks);
+
     segmentManager->getMetrics(*m.mutable_segment_metrics());
     segmentManager->getAllocator().getMetrics(*m.mutable_seglet_metrics());
 }
@@ -352,7 +389,9 @@ AbstractLog::getSegment(Reference reference)
  * data may or may not have been made durable.
  *
  * \param lock
- *      Ensures that the caller holds the monitor lock; not actually used.
+ *      Ensures that the caller holds the head's appendLock; not actually used.
+ * \param head
+ *      The head to append to.
  * \param type
  *      Type of the entry. See LogEntryTypes.h.
  * \param buffer
@@ -372,13 +411,14 @@ AbstractLog::getSegment(Reference reference)
  */
 bool
 AbstractLog::append(const SpinLock::Guard& lock,
+            Head& head,
             LogEntryType type,
             const void* buffer,
             uint32_t length,
             Reference* outReference,
-            uint64_t* outTickCounter)
+            std::atomic<uint64_t>* outTickCounter)
 {
-    CycleCounter<uint64_t> _(outTickCounter);
+    CycleCounter<std::atomic<uint64_t>> _(outTickCounter);
 
     // Note that we do not increment metrics.totalAppendCalls here, but rather
     // in the public methods that invoke this. The reason is that we consider
@@ -386,21 +426,21 @@ AbstractLog::append(const SpinLock::Guard& lock,
     // times) to be a single call.
 
     // This is only possible once after construction.
-    if (head == NULL) {
-        if (!allocNewWritableHead())
+    if (head.segment == NULL) {
+        if (!allocNewWritableHead(head))
             throw FatalError(HERE, "Could not allocate initial head segment");
     }
 
     // Try to append. If we can't, try to allocate a new head to get more space.
     Reference reference;
-    uint32_t bytesUsedBefore = head->getAppendedLength();
-    bool enoughSpace = head->append(type, buffer, length, &reference);
+    uint32_t bytesUsedBefore = head.segment->getAppendedLength();
+    bool enoughSpace = head.segment->append(type, buffer, length, &reference);
     if (!enoughSpace) {
-        if (!allocNewWritableHead())
+        if (!allocNewWritableHead(head))
             return false;
 
-        bytesUsedBefore = head->getAppendedLength();
-        if (!head->append(type, buffer, length, &reference)) {
+        bytesUsedBefore = head.segment->getAppendedLength();
+        if (!head.segment->append(type, buffer, length, &reference)) {
             LOG(ERROR, "Entry too big to append to log: %u bytes of type %d",
                 length, static_cast<int>(type));
             throw FatalError(HERE, "Entry too big to append to log");
@@ -410,11 +450,12 @@ AbstractLog::append(const SpinLock::Guard& lock,
     if (outReference != NULL)
         *outReference = reference;
 
-    uint32_t lengthWithMetadata = head->getAppendedLength() - bytesUsedBefore;
+    uint32_t lengthWithMetadata =
+        head.segment->getAppendedLength() - bytesUsedBefore;
 
     // Update log statistics so that the cleaner can make intelligent decisions
     // when trying to reclaim memory.
-    head->trackNewEntry(type, lengthWithMetadata);
+    head.segment->trackNewEntry(type, lengthWithMetadata);
     if (type == LOG_ENTRY_TYPE_OBJ ||
         type == LOG_ENTRY_TYPE_RPCRESULT ||
         type == LOG_ENTRY_TYPE_PREP ||
@@ -435,7 +476,9 @@ AbstractLog::append(const SpinLock::Guard& lock,
  * data may or may not have been made durable.
  *
  * \param lock
- *      Ensures that the caller holds the monitor lock; not actually used.
+ *      Ensures that the caller holds the head's appendLock; not actually used.
+ * \param head
+ *      The head to append to.
  * \param buffer
  *      Pointer to buffer containing the entry to be appended.
  * \param[out] entryLength
@@ -454,12 +497,13 @@ AbstractLog::append(const SpinLock::Guard& lock,
  */
 bool
 AbstractLog::append(const SpinLock::Guard& lock,
+            Head& head,
             const void* buffer,
             uint32_t *entryLength,
             Reference* outReference,
-            uint64_t* outTickCounter)
+            std::atomic<uint64_t>* outTickCounter)
 {
-    CycleCounter<uint64_t> _(outTickCounter);
+    CycleCounter<std::atomic<uint64_t>> _(outTickCounter);
 
     // Note that we do not increment metrics.totalAppendCalls here, but rather
     // in the public methods that invoke this. The reason is that we consider
@@ -467,8 +511,8 @@ AbstractLog::append(const SpinLock::Guard& lock,
     // times) to be a single call.
 
     // This is only possible once after construction.
-    if (head == NULL) {
-        if (!allocNewWritableHead())
+    if (head.segment == NULL) {
+        if (!allocNewWritableHead(head))
             throw FatalError(HERE, "Could not allocate initial head segment");
     }
 
@@ -476,15 +520,16 @@ AbstractLog::append(const SpinLock::Guard& lock,
     Reference reference;
     LogEntryType type;
     uint32_t entryDataLength = 0;
-    uint32_t bytesUsedBefore = head->getAppendedLength();
-    bool enoughSpace = head->append(buffer, &entryDataLength,
+    uint32_t bytesUsedBefore = head.segment->getAppendedLength();
+    bool enoughSpace = head.segment->append(buffer, &entryDataLength,
                                     &type, &reference);
     if (!enoughSpace) {
-        if (!allocNewWritableHead())
+        if (!allocNewWritableHead(head))
             return false;
 
-        bytesUsedBefore = head->getAppendedLength();
-        if (!head->append(buffer, &entryDataLength, &type, &reference)) {
+        bytesUsedBefore = head.segment->getAppendedLength();
+        if (!head.segment->append(buffer, &entryDataLength,
+                                  &type, &reference)) {
             LOG(ERROR, "Entry too big to append to log: %u bytes of type %d",
                 entryDataLength, static_cast<int>(type));
             throw FatalError(HERE, "Entry too big to append to log");
@@ -494,14 +539,15 @@ AbstractLog::append(const SpinLock::Guard& lock,
     if (outReference != NULL)
         *outReference = reference;
 
-    uint32_t lengthWithMetadata = head->getAppendedLength() - bytesUsedBefore;
+    uint32_t lengthWithMetadata =
+        head.segment->getAppendedLength() - bytesUsedBefore;
 
     if (entryLength)
         *entryLength = lengthWithMetadata;
 
     // Update log statistics so that the cleaner can make intelligent decisions
     // when trying to reclaim memory.
-    head->trackNewEntry(type, lengthWithMetadata);
+    head.segment->trackNewEntry(type, lengthWithMetadata);
     if (type == LOG_ENTRY_TYPE_OBJ ||
         type == LOG_ENTRY_TYPE_RPCRESULT ||
         type == LOG_ENTRY_TYPE_PREP ||
@@ -523,7 +569,9 @@ AbstractLog::append(const SpinLock::Guard& lock,
  * data may or may not have been made durable.
  *
  * \param lock
- *      Ensures that the caller holds the monitor lock; not actually used.
+ *      Ensures that the caller holds the head's appendLock; not actually used.
+ * \param head
+ *      The head to append to.
  * \param type
  *      Type of the entry. See LogEntryTypes.h.
  * \param buffer
@@ -541,12 +589,14 @@ AbstractLog::append(const SpinLock::Guard& lock,
  */
 bool
 AbstractLog::append(const SpinLock::Guard& lock,
+            Head& head,
             LogEntryType type,
             Buffer& buffer,
             Reference* outReference,
-            uint64_t* outTickCounter)
+            std::atomic<uint64_t>* outTickCounter)
 {
     return append(lock,
+                  head,
                   type,
                   buffer.getRange(0, buffer.size()),
                   buffer.size(),
@@ -555,26 +605,32 @@ AbstractLog::append(const SpinLock::Guard& lock,
 }
 
 /**
- * Allocate a new head segment, changing the ``head'' field. If the allocation
- * succeeds and the allocated segment is writable (that is, not an emergency
- * head segment), return true. Otherwise, return false.
+ * Allocate a new segment for the given head, changing its ``segment'' field.
+ * If the allocation succeeds and the allocated segment is writable (that is,
+ * not an emergency head segment), return true. Otherwise, return false.
  *
  * This method centralizes a bit of subtle logic shared between the append
- * methods (the ``head'' field should never be NULL after the first segment
+ * methods (the ``segment'' field should never be NULL after the first segment
  * has been allocated).
+ *
+ * \param head
+ *      The head to allocate a new segment for. The caller must hold its
+ *      appendLock.
  */
 bool
-AbstractLog::allocNewWritableHead()
+AbstractLog::allocNewWritableHead(Head& head)
 {
-    LogSegment* newHead = allocNextSegment(false);
+    LogSegment* newHead = allocNextSegment(false, head.index);
     if (newHead != NULL)
-        head = newHead;
+        head.segment = newHead;
+
+    SpinLock::Guard _(allocLock);
 
     // If we're entirely out of memory or were allocated an emergency head
     // segment due to memory pressure, we can't service the append. Return
     // failure and let the client retry. Hopefully the cleaner will free up
     // more memory soon.
-    if (newHead == NULL || head->isEmergencyHead) {
+    if (newHead == NULL || head.segment->isEmergencyHead) {
         if (!metrics.noSpaceTimer)
             metrics.noSpaceTimer.construct(&metrics.totalNoSpaceTicks);
         RAMCLOUD_CLOG(NOTICE, "No clean segments available; deferring "
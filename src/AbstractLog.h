@@ -17,6 +17,7 @@
 #define RAMCLOUD_ABSTRACTLOG_H
 
 #include <atomic>
+#include <memory>
 #include <stdint.h>
 #include <unordered_map>
 #include <vector>
@@ -25,6 +26,7 @@
 #include "LogEntryTypes.h"
 #include "Segment.h"
 #include "SpinLock.h"
+#include "ThreadId.h"
 #include "ReplicaManager.h"
 #include "HashTable.h"
 
@@ -53,6 +55,12 @@ class PerfStats;
  * failed master during replay. See the Log and SideLog documentation for more
  * details.
  *
+ * An AbstractLog may append to several segments at once (see Head). Each
+ * thread always appends to the same one, so threads appending to different
+ * heads do not contend with one another. Optionally, one extra head is set
+ * aside for entries the caller expects to be overwritten soon ("hot" data),
+ * so that they fill segments of their own.
+ *
  * This class is thread-safe.
  */
 class AbstractLog {
@@ -105,10 +113,12 @@ class AbstractLog {
     AbstractLog(LogEntryHandlers* entryHandlers,
                 SegmentManager* segmentManager,
                 ReplicaManager* replicaManager,
-                uint32_t segmentSize);
+                uint32_t segmentSize,
+                uint32_t numHeads = 1,
+                bool hotHead = false);
     virtual ~AbstractLog() { }
 
-    bool append(AppendVector* appends, uint32_t numAppends);
+    bool append(AppendVector* appends, uint32_t numAppends, bool hot = false);
     bool append(Buffer* logBuffer, Reference *references, uint32_t numEntries);
     void free(Reference reference);
     void getMetrics(ProtoBuf::LogMetrics& m);
@@ -140,9 +150,11 @@ class AbstractLog {
            uint32_t length,
            Reference* outReference = NULL)
     {
-        SpinLock::Guard lock(appendLock);
+        Head& head = getHeadForThread();
+        SpinLock::Guard lock(head.appendLock);
         metrics.totalAppendCalls++;
         return append(lock,
+                      head,
                       type,
                       buffer,
                       length,
@@ -158,9 +170,11 @@ class AbstractLog {
            Buffer& buffer,
            Reference* outReference = NULL)
     {
-        SpinLock::Guard lock(appendLock);
+        Head& head = getHeadForThread();
+        SpinLock::Guard lock(head.appendLock);
         metrics.totalAppendCalls++;
         return append(lock,
+                      head,
                       type,
                       buffer.getRange(0, buffer.size()),
                       buffer.size(),
@@ -170,6 +184,78 @@ class AbstractLog {
 
 
   PROTECTED:
+    /**
+     * One of the segments this log is currently appending to, along with the
+     * locks that serialize appends to it and syncs of it. Most logs have a
+     * single head, but the Log may be configured with several (see
+     * ServerConfig::Master::numLogHeads) so that worker threads appending in
+     * parallel do not all queue on one lock. In that case each head is the
+     * start of a separate chain of segments, and each chain is replicated to
+     * backups independently of the others.
+     */
+    class Head {
+      public:
+        Head()
+            : segment(NULL),
+              index(0),
+              appendLock("AbstractLog::appendLock"),
+              syncLock("AbstractLog::syncLock")
+        {
+        }
+
+        /// Current segment being appended to. Whatever this points to is owned
+        /// by SegmentManager, which is responsible for its eventual
+        /// deallocation. This pointer is NULL until the first segment for
+        /// this head is allocated, but it will never be NULL again after that.
+        ///
+        /// In the Log subclass, this is an actual head of the log. In the
+        /// SideLog subclass, there is not quite the same concept of a log head.
+        /// In that case, this is simply the segment currently being appended
+        /// to.
+        LogSegment* segment;
+
+        /// Position of this head in AbstractLog::heads.
+        uint32_t index;
+
+        /// Lock taken around log append operations. This ensures that parallel
+        /// writers do not modify the head segment concurrently. The sync()
+        /// method also uses this lock to get a consistent view of the head
+        /// segment in the presence of multiple appending threads.
+        SpinLock appendLock;
+
+        /// Lock used by the Log subclass to serialize calls to
+        /// ReplicatedSegment::sync() on this head's segments. If both this
+        /// lock and #appendLock need to be taken, this one must be acquired
+        /// first to avoid deadlock.
+        SpinLock syncLock;
+
+        DISALLOW_COPY_AND_ASSIGN(Head);
+    };
+
+    /**
+     * Return the head that the calling thread appends to. A given thread
+     * always gets the same head, so a thread that appends and then syncs
+     * its head will have made its own appends durable.
+     */
+    Head&
+    getHeadForThread()
+    {
+        uint32_t numThreadHeads = hasHotHead ? numHeads - 1 : numHeads;
+        if (numThreadHeads == 1)
+            return heads[0];
+        return heads[ThreadId::get() % numThreadHeads];
+    }
+
+    /**
+     * Return the head reserved for hot entries, or NULL if this log doesn't
+     * have one. It is always the last entry in #heads.
+     */
+    Head*
+    getHotHead()
+    {
+        return hasHotHead ? &heads[numHeads - 1] : NULL;
+    }
+
     LogSegment* getSegment(Reference reference);
 
     /**
@@ -188,29 +274,36 @@ class AbstractLog {
      *      block indefinitely if necessary. If false, the method must return
      *      immediately and may provide a NULL pointer if no segment is
      *      available.
+     * \param headIndex
+     *      Index in #heads of the head the segment is being allocated for.
+     *      The caller must hold that head's appendLock.
      * \return
      *      A new LogSegment pointer. If mustNotFail is true, this is guaranteed
      *      to be non-NULL.
      */
-    virtual LogSegment* allocNextSegment(bool mustNotFail) = 0;
+    virtual LogSegment* allocNextSegment(bool mustNotFail,
+                                         uint32_t headIndex) = 0;
 
     bool append(const SpinLock::Guard& lock,
+                Head& head,
                 LogEntryType type,
                 const void* data,
                 uint32_t length,
                 Reference* outReference = NULL,
-                uint64_t* outTickCounter = NULL);
+                std::atomic<uint64_t>* outTickCounter = NULL);
     bool append(const SpinLock::Guard& lock,
+                Head& head,
                 const void* data,
                 uint32_t *entryLength = NULL,
                 Reference* outReference = NULL,
-                uint64_t* outTickCounter = NULL);
+                std::atomic<uint64_t>* outTickCounter = NULL);
     bool append(const SpinLock::Guard& lock,
+                Head& head,
                 LogEntryType type,
                 Buffer& buffer,
                 Reference* outReference = NULL,
-                uint64_t* outTickCounter = NULL);
-    bool allocNewWritableHead();
+                std::atomic<uint64_t>* outTickCounter = NULL);
+    bool allocNewWritableHead(Head& head);
 
     /// Various handlers for entries appended to this log. Used to obtain
     /// timestamps and to relocate entries during cleaning.
@@ -232,21 +325,32 @@ class AbstractLog {
     /// space each memory segment may contain.
     uint32_t segmentSize;
 
-    /// Current segment being appended to. Whatever this points to is owned by
-    /// SegmentManager, which is responsible for its eventual deallocation.
-    /// This pointer will be initalized to NULL in the constructor, but once
-    /// the first segment is allocated it will never be NULL again.
-    ///
-    /// In the Log subclass, this is the actual head of the log. In the SideLog
-    /// subclass, there is not quite the same concept of a log head. In that
-    /// case, this is simply the segment currently being appended to.
-    LogSegment* head;
-
-    /// Lock taken around log append operations. This ensures that parallel
-    /// writers do not modify the head segment concurrently. The sync()
-    /// method also uses this lock to get a consistent view of the head
-    /// segment in the presence of multiple appending threads.
-    SpinLock appendLock;
+    /// Number of entries in #heads, including the hot head (if any). Always
+    /// at least 1.
+    uint32_t numHeads;
+
+    /// True if the last entry in #heads only receives hot appends; see
+    /// getHotHead().
+    bool hasHotHead;
+
+    /// The segments currently being appended to; see Head. Appending threads
+    /// are spread across these by getHeadForThread().
+    std::unique_ptr<Head[]> heads;
+
+    /// Serializes updates to metrics.noSpaceTimer and maxLiveBytes when
+    /// several heads allocate new segments at the same time.
+    SpinLock allocLock;
+
+    /// The log whose hot head the calling thread has appended to since it
+    /// last synced that log, or NULL. Log::sync() uses this to skip the hot
+    /// head when the thread has nothing there to make durable.
+    static __thread AbstractLog* unsyncedHotLog;
+
+    /// True once the calling thread has had unsynced hot appends in more
+    /// than one log at a time; every log then syncs its hot head on each
+    /// sync() from this thread. This never happens on a master, which has a
+    /// single Log.
+    static __thread bool severalUnsyncedHotLogs;
 
     // Total amount of log space occupied by long-term data such as
     // objects. Excludes data that can eventually be cleaned, such
@@ -298,14 +402,17 @@ class AbstractLog {
             new(this) Metrics{};
         }
 
+        // The append counters below are atomic because a log with several
+        // heads updates them under different Head::appendLocks.
+
         /// Total number of times any of the public append() methods have been
         /// called.
-        uint64_t totalAppendCalls;
+        std::atomic<uint64_t> totalAppendCalls;
 
         /// Total number of cpu cycles spent appending data. Includes any
         /// synchronous replication time, but does not include waiting for
         /// the log lock.
-        uint64_t totalAppendTicks;
+        std::atomic<uint64_t> totalAppendTicks;
 
         /// Total number of ticks spent out of memory and unable to service
         /// append operations.
@@ -318,12 +425,12 @@ class AbstractLog {
 
         /// Total number of useful user bytes appended to the log. This does not
         /// include any segment metadata.
-        uint64_t totalBytesAppended;
+        std::atomic<uint64_t> totalBytesAppended;
 
         /// Total number of metadata bytes appended to the log. This, plus the
         /// #totalBytesAppended value is equal to the grand total of bytes
         /// appended to the log.
-        uint64_t totalMetadataBytesAppended;
+        std::atomic<uint64_t> totalMetadataBytesAppended;
     } metrics;
 
     DISALLOW_COPY_AND_ASSIGN(AbstractLog);
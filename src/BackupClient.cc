@@ -602,6 +602,12 @@ BackupClient::writeSegment(Context* context,
  *      Whether this particular replica should be loaded and filtered at the
  *      start of master recovery (as opposed to having it loaded and filtered
  *      on demand. May be reset on each subsequent write.
+ * \param chain
+ *      Backups (in order) that \a backupId should pass this write on to;
+ *      see wait(). Writes reaching them are never marked primary. May be
+ *      NULL if \a chainLength is 0.
+ * \param chainLength
+ *      Number of entries in \a chain.
  */
 WriteSegmentRpc::WriteSegmentRpc(Context* context,
                                  ServerId backupId,
@@ -614,7 +620,9 @@ WriteSegmentRpc::WriteSegmentRpc(Context* context,
                                  const SegmentCertificate* certificate,
                                  bool open,
                                  bool close,
-                                 bool primary)
+                                 bool primary,
+                                 const ServerId* chain,
+                                 uint32_t chainLength)
     : ServerIdRpcWrapper(context, backupId,
                          sizeof(WireFormat::BackupWrite::Response))
 {
@@ -633,23 +641,187 @@ WriteSegmentRpc::WriteSegmentRpc(Context* context,
     reqHdr->open = open;
     reqHdr->close = close;
     reqHdr->primary = primary;
+    reqHdr->chainLength = downCast<uint8_t>(chainLength);
+    for (uint32_t i = 0; i < chainLength; i++)
+        request.emplaceAppend<uint64_t>(chain[i].getId());
     if (segment)
         segment->appendToBuffer(request, offset, length);
     CycleCounter<RawMetric> _(&metrics->master.replicationPostingWriteRpcTicks);
     send();
 }
 
+/**
+ * Used by a backup to pass a write it received on to another backup in a
+ * replication chain. This is sent as a BACKUP_CHAIN_WRITE, which the
+ * receiving backup stores without forwarding it any further.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param backupId
+ *      The backup in the chain to pass the write on to.
+ * \param forwardedHeader
+ *      Header of the write request the backup received; everything but the
+ *      chain is copied from it.
+ * \param data
+ *      Request payload of the write the backup received.
+ * \param dataOffset
+ *      Offset in \a data of the bytes to write; forwardedHeader->length bytes
+ *      are sent, without copying them, so \a data must outlive this RPC.
+ */
+WriteSegmentRpc::WriteSegmentRpc(Context* context,
+        ServerId backupId,
+        const WireFormat::BackupWrite::Request* forwardedHeader,
+        Buffer* data, uint32_t dataOffset)
+    : ServerIdRpcWrapper(context, backupId,
+                         sizeof(WireFormat::BackupChainWrite::Response))
+{
+    WireFormat::BackupChainWrite::Request* reqHdr(
+            allocHeader<WireFormat::BackupChainWrite>(backupId));
+    reqHdr->masterId = forwardedHeader->masterId;
+    reqHdr->segmentId = forwardedHeader->segmentId;
+    reqHdr->segmentEpoch = forwardedHeader->segmentEpoch;
+    reqHdr->offset = forwardedHeader->offset;
+    reqHdr->length = forwardedHeader->length;
+    reqHdr->certificateIncluded = forwardedHeader->certificateIncluded;
+    reqHdr->certificate = forwardedHeader->certificate;
+    reqHdr->open = forwardedHeader->open;
+    reqHdr->close = forwardedHeader->close;
+    reqHdr->primary = false;
+    reqHdr->chainLength = 0;
+    request.appendExternal(data, dataOffset, forwardedHeader->length);
+    send();
+}
+
 /**
  * Wait for a writeSegment RPC to complete.
  *
+ * \return
+ *      The number of backups in the chain given to the constructor (counting
+ *      from the first) that are known to have stored the write; those after
+ *      it may or may not have.
+ *
  * \throw ServerNotUpException
  *      The intended server for this RPC is not part of the cluster;
  *      if it ever existed, it has since crashed.
  */
-void
+uint32_t
 WriteSegmentRpc::wait()
 {
     waitAndCheckErrors();
+    return getResponseHeader<WireFormat::BackupWrite>()->chainAcked;
+}
+
+/**
+ * Start assembling an RPC carrying several writes to \a backupId. Nothing
+ * is sent until send() is called.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param backupId
+ *      The id of the backup to which the writes are sent.
+ * \param masterId
+ *      The id of the master to which all of the replicas belong.
+ */
+MultiWriteSegmentRpc::MultiWriteSegmentRpc(Context* context,
+                                           ServerId backupId,
+                                           ServerId masterId)
+    : ServerIdRpcWrapper(context, backupId,
+                         sizeof(WireFormat::BackupMultiWrite::Response))
+    , writeCount(0)
+    , dataBytes(0)
+    , primaryWrite(false)
+{
+    WireFormat::BackupMultiWrite::Request* reqHdr(
+            allocHeader<WireFormat::BackupMultiWrite>(backupId));
+    reqHdr->masterId = masterId.getId();
+    reqHdr->count = 0;
+}
+
+/**
+ * Add a write to the RPC. Must be called before send(). The arguments are
+ * the same as for the WriteSegmentRpc constructor.
+ *
+ * \return
+ *      Index of the write; pass it to wait() to collect its result.
+ */
+uint32_t
+MultiWriteSegmentRpc::addWrite(uint64_t segmentId,
+                               uint64_t segmentEpoch,
+                               const Segment* segment,
+                               uint32_t offset,
+                               uint32_t length,
+                               const SegmentCertificate* certificate,
+                               bool open,
+                               bool close,
+                               bool primary)
+{
+    assert(!isSent());
+    WireFormat::BackupMultiWrite::Part* part =
+            request.emplaceAppend<WireFormat::BackupMultiWrite::Part>();
+    part->segmentId = segmentId;
+    part->segmentEpoch = segmentEpoch;
+    part->offset = offset;
+    part->length = length;
+    part->certificateIncluded = (certificate != NULL);
+    if (part->certificateIncluded)
+        part->certificate = *certificate;
+    else
+        part->certificate = SegmentCertificate();
+    part->open = open;
+    part->close = close;
+    part->primary = primary;
+    if (segment)
+        segment->appendToBuffer(request, offset, length);
+    else
+        part->length = 0;
+    dataBytes += part->length;
+    primaryWrite |= primary;
+
+    WireFormat::BackupMultiWrite::Request* reqHdr =
+            request.getStart<WireFormat::BackupMultiWrite::Request>();
+    reqHdr->count = ++writeCount;
+    return writeCount - 1;
+}
+
+/**
+ * Send the RPC with all of the writes added so far.
+ */
+void
+MultiWriteSegmentRpc::send()
+{
+    CycleCounter<RawMetric> _(&metrics->master.replicationPostingWriteRpcTicks);
+    ServerIdRpcWrapper::send();
+}
+
+/**
+ * Wait for the RPC to complete and return the result of one of its writes.
+ * May be called any number of times, for the same or different writes.
+ *
+ * \param index
+ *      Value returned by addWrite() for the write of interest.
+ *
+ * \throw ServerNotUpException
+ *      The intended server for this RPC is not part of the cluster;
+ *      if it ever existed, it has since crashed.
+ * \throw ClientException
+ *      The backup rejected the whole RPC (for example, with
+ *      CallerNotInClusterException) or this particular write (with any
+ *      of the exceptions writeSegment can throw).
+ */
+void
+MultiWriteSegmentRpc::wait(uint32_t index)
+{
+    waitAndCheckErrors();
+    const WireFormat::BackupMultiWrite::Response* respHdr =
+            getResponseHeader<WireFormat::BackupMultiWrite>();
+    if (index >= respHdr->count)
+        throw ResponseFormatError(HERE);
+    const Status* status = response->getOffset<Status>(
+            sizeof32(*respHdr) + index * sizeof32(Status));
+    if (status == NULL)
+        throw MessageTooShortError(HERE);
+    if (*status != STATUS_OK)
+        ClientException::throwException(HERE, *status);
 }
 
 } // namespace RAMCloud
@@ -191,14 +191,61 @@ class WriteSegmentRpc : public ServerIdRpcWrapper {
                     uint64_t segmentId, uint64_t segmentEpoch,
                     const Segment* segment, uint32_t offset, uint32_t length,
                     const SegmentCertificate* certificate,
-                    bool open, bool close, bool primary);
+                    bool open, bool close, bool primary,
+                    const ServerId* chain = NULL, uint32_t chainLength = 0);
+    WriteSegmentRpc(Context* context, ServerId backupId,
+                    const WireFormat::BackupWrite::Request* forwardedHeader,
+                    Buffer* data, uint32_t dataOffset);
     ~WriteSegmentRpc() {}
-    void wait();
+    uint32_t wait();
 
   PRIVATE:
     DISALLOW_COPY_AND_ASSIGN(WriteSegmentRpc);
 };
 
+/**
+ * Carries several writes from one master to one backup, possibly to
+ * different replicas, in a single RPC. Unlike other wrappers this isn't sent
+ * on construction: writes are added with addWrite() until send() is called,
+ * and the result of each is collected separately with wait().
+ */
+class MultiWriteSegmentRpc : public ServerIdRpcWrapper {
+  public:
+    MultiWriteSegmentRpc(Context* context, ServerId backupId,
+                         ServerId masterId);
+    ~MultiWriteSegmentRpc() {}
+    uint32_t addWrite(uint64_t segmentId, uint64_t segmentEpoch,
+                      const Segment* segment, uint32_t offset,
+                      uint32_t length, const SegmentCertificate* certificate,
+                      bool open, bool close, bool primary);
+    void send();
+    void wait(uint32_t index);
+
+    /// Number of writes added so far.
+    uint32_t getWriteCount() { return writeCount; }
+
+    /// Bytes of segment data carried by the writes added so far.
+    uint32_t getDataBytes() { return dataBytes; }
+
+    /// True once send() has been called; no more writes may be added.
+    bool isSent() { return getState() != NOT_STARTED; }
+
+    /// True if any write added so far is to a primary replica.
+    bool hasPrimaryWrite() { return primaryWrite; }
+
+  PRIVATE:
+    /// Number of writes added so far.
+    uint32_t writeCount;
+
+    /// Bytes of segment data carried by the writes added so far.
+    uint32_t dataBytes;
+
+    /// True if any write added so far is to a primary replica.
+    bool primaryWrite;
+
+    DISALLOW_COPY_AND_ASSIGN(MultiWriteSegmentRpc);
+};
+
 /**
  * This class implements RPC requests that are sent to backup servers
  * to manage segment replicas. The class contains only static methods,
@@ -15,6 +15,7 @@
 
 #include "BackupMasterRecovery.h"
 #include "BackupService.h"
+#include "LogDigest.h"
 #include "Object.h"
 #include "RecoverySegmentBuilder.h"
 #include "ShortMacros.h"
@@ -57,13 +58,18 @@ SpinLock BackupMasterRecovery::deletionMutex
  *     The maximum number of replicas and frames to have in memory at any given
  *     point during recovery. This number will determine the size of this
  *     recovery's CyclicReplicaBuffer.
+ * \param buildThreads
+ *     Number of threads that should construct recovery segments from loaded
+ *     replicas. With one, the task queue thread builds them; with more, this
+ *     many dedicated threads filter different replicas in parallel.
  */
 BackupMasterRecovery::BackupMasterRecovery(TaskQueue& taskQueue,
                                            uint64_t recoveryId,
                                            ServerId crashedMasterId,
                                            uint32_t segmentSize,
                                            uint32_t readSpeed,
-                                           uint32_t maxReplicasInMemory)
+                                           uint32_t maxReplicasInMemory,
+                                           uint32_t buildThreads)
     : Task(taskQueue)
     , recoveryId(recoveryId)
     , crashedMasterId(crashedMasterId)
@@ -83,6 +89,9 @@ BackupMasterRecovery::BackupMasterRecovery(TaskQueue& taskQueue,
     , buildingStartTicks()
     , testingExtractDigest()
     , testingSkipBuild()
+    , numBuildThreads(std::max(buildThreads, 1u))
+    , buildThreads()
+    , stopBuilding(false)
     , destroyer(taskQueue, this)
     , pendingDeletion(false)
 {
@@ -93,6 +102,9 @@ BackupMasterRecovery::BackupMasterRecovery(TaskQueue& taskQueue,
  * distinct task to clean up the BackupMasterRecovery instance.
  */
 BackupMasterRecovery::~BackupMasterRecovery() {
+    replicaBuffer.stopBuilders();
+    foreach (std::thread& thread, buildThreads)
+        thread.join();
     LOG(NOTICE, "Freeing recovery state on backup for crashed master %s "
             "(recovery %lu), including %lu filtered replicas",
             crashedMasterId.toString().c_str(), recoveryId,
@@ -193,25 +205,58 @@ BackupMasterRecovery::start(const std::vector<BackupStorage::FrameRef>& frames,
         {
             continue;
         }
-        // This shouldn't block since the backup keeps all open segments
-        // in memory (it even reloads them into memory upon restarts).
-        void* replicaData = replica.frame->load();
-        bool foundDigest = false;
-        if (testingExtractDigest) {
-            foundDigest =
-                (*testingExtractDigest)(replica.metadata->segmentId,
-                                        &logDigest, &tableStatsDigest);
-        } else {
-            foundDigest =
-                RecoverySegmentBuilder::extractDigest(replicaData, segmentSize,
-                    replica.metadata->certificate, &logDigest,
-                    &tableStatsDigest);
-        }
-        if (foundDigest) {
+        if (extractDigest(replica, &logDigest, &tableStatsDigest)) {
             logDigestSegmentId = replica.metadata->segmentId;
             logDigestSegmentEpoch = replica.metadata->segmentEpoch;
         }
     }
+
+    // If the master had several log heads, the head of one of them may have
+    // stayed open while the others rolled over many times, so the lowest
+    // digest can be missing the newest segments; only the digest of the
+    // newest open replica is certain to name them all. Such digests list the
+    // concurrent heads, which is how we tell that the log had several.
+    uint64_t newestSegmentId = logDigestSegmentId;
+    uint64_t newestSegmentEpoch = logDigestSegmentEpoch;
+    Buffer newestDigest;
+    Buffer newestTableStats;
+    foreach (auto& replica, replicas) {
+        if (logDigestSegmentId == ~0lu || replica.metadata->closed)
+            continue;
+        if (newestSegmentId > replica.metadata->segmentId)
+            continue;
+        if (newestSegmentId == replica.metadata->segmentId &&
+            newestSegmentEpoch >= replica.metadata->segmentEpoch)
+        {
+            continue;
+        }
+        if (extractDigest(replica, &newestDigest, &newestTableStats)) {
+            newestSegmentId = replica.metadata->segmentId;
+            newestSegmentEpoch = replica.metadata->segmentEpoch;
+        }
+    }
+    if (newestSegmentId != logDigestSegmentId ||
+        newestSegmentEpoch != logDigestSegmentEpoch) {
+        bool concurrentHeads = false;
+        try {
+            LogDigest digest(newestDigest.getRange(0, newestDigest.size()),
+                             newestDigest.size());
+            concurrentHeads = digest.hasConcurrentHeads();
+        } catch (const LogDigestException& e) {
+            // Leave it to the coordinator to find a valid digest.
+        }
+        if (concurrentHeads) {
+            logDigest.reset();
+            logDigest.appendCopy(newestDigest.getRange(0, newestDigest.size()),
+                                 newestDigest.size());
+            tableStatsDigest.reset();
+            tableStatsDigest.appendCopy(
+                newestTableStats.getRange(0, newestTableStats.size()),
+                newestTableStats.size());
+            logDigestSegmentId = newestSegmentId;
+            logDigestSegmentEpoch = newestSegmentEpoch;
+        }
+    }
     if (logDigestSegmentId != ~0lu) {
         LOG(NOTICE, "Found log digest in replica for segment %lu",
             logDigestSegmentId);
@@ -257,6 +302,10 @@ BackupMasterRecovery::setPartitionsAndSchedule(
 
     LOG(DEBUG, "Kicked off building recovery segments");
     buildingStartTicks = Cycles::rdtsc();
+    if (numBuildThreads > 1) {
+        for (uint32_t i = 0; i < numBuildThreads; i++)
+            buildThreads.emplace_back(buildThreadMain, this);
+    }
     schedule();
 }
 
@@ -408,7 +457,8 @@ BackupMasterRecovery::getRecoveryId()
  * bufferNext()) and building the next recovery segment from a previously loaded
  * replica (see buildNext()). Invoked by a task queue in a separate thread from
  * the backup worker thread so building recovery segments is done in the
- * background.
+ * background. If there are #buildThreads, they do the building instead, and
+ * this only wakes them when a replica has finished loading.
  */
 void
 BackupMasterRecovery::performTask()
@@ -420,11 +470,60 @@ BackupMasterRecovery::performTask()
     }
 
     replicaBuffer.bufferNext();
-    replicaBuffer.buildNext();
+    if (numBuildThreads > 1)
+        replicaBuffer.wakeBuilders();
+    else
+        replicaBuffer.buildNext();
 }
 
 // - private -
 
+/**
+ * Main loop of the threads that construct recovery segments. Each
+ * repeatedly claims and filters the next loaded replica in #replicaBuffer,
+ * sleeping while there is none (see CyclicReplicaBuffer::buildNext()), until
+ * the recovery is destroyed. Meanwhile the task queue thread keeps loading
+ * replicas into the buffer.
+ *
+ * \param recovery
+ *      The recovery whose replicas this thread filters.
+ */
+void
+BackupMasterRecovery::buildThreadMain(BackupMasterRecovery* recovery)
+{
+    while (recovery->replicaBuffer.buildNext(true)) {}
+}
+
+/**
+ * Extract the log digest and table stats digest from a replica, if it has
+ * them. Used by start().
+ *
+ * \param replica
+ *      Replica to look in; it is loaded into memory if it isn't already
+ *      (this shouldn't block, since backups keep all open replicas in
+ *      memory).
+ * \param[out] digestBuffer
+ *      If the replica has a log digest it is returned here.
+ * \param[out] tableStatsBuffer
+ *      If the replica has a log digest, its table stats digest is returned
+ *      here.
+ * \return
+ *      True if the replica contained a log digest.
+ */
+bool
+BackupMasterRecovery::extractDigest(Replica& replica,
+                                    Buffer* digestBuffer,
+                                    Buffer* tableStatsBuffer)
+{
+    void* replicaData = replica.frame->load();
+    if (testingExtractDigest) {
+        return (*testingExtractDigest)(replica.metadata->segmentId,
+                                       digestBuffer, tableStatsBuffer);
+    }
+    return RecoverySegmentBuilder::extractDigest(replicaData, segmentSize,
+        replica.metadata->certificate, digestBuffer, tableStatsBuffer);
+}
+
 /**
  * Append replica information and the log digest (if any) to \a responseBuffer
  * and populate \a response with the corresponding details about the
@@ -487,6 +586,7 @@ BackupMasterRecovery::Replica::Replica(const BackupStorage::FrameRef& frame)
     , recoverySegments()
     , recoveryException()
     , built()
+    , building()
     , lastAccessTime(0)
     , refCount(0)
     , fetchCount(0)
@@ -528,6 +628,7 @@ BackupMasterRecovery::CyclicReplicaBuffer::CyclicReplicaBuffer(
         uint32_t maxReplicasInMemory, uint32_t segmentSize, uint32_t readSpeed,
         BackupMasterRecovery* recovery)
     : mutex("cyclicReplicaBuffeMutex")
+    , replicaReady()
     , maxReplicasInMemory(maxReplicasInMemory)
     , inMemoryReplicas()
     , oldestReplicaIdx(0)
@@ -682,7 +783,8 @@ BackupMasterRecovery::CyclicReplicaBuffer::bufferNext()
          */
         Replica* replicaToRemove = inMemoryReplicas[oldestReplicaIdx];
 
-        if (!replicaToRemove->built || replicaToRemove->fetchCount == 0 ||
+        if (!replicaToRemove->built || replicaToRemove->building ||
+            replicaToRemove->fetchCount == 0 ||
             replicaToRemove->refCount > 0) {
             // This replica isn't eligible for eviction yet.
             return false;
@@ -711,6 +813,7 @@ BackupMasterRecovery::CyclicReplicaBuffer::bufferNext()
     // Read the next replica from disk.
     nextReplica->frame->startLoading();
     replicaDeque->pop_front();
+    replicaReady.notify_all();
 
     LOG(DEBUG, "Added replica <%s,%lu> to the recovery buffer",
         recovery->crashedMasterId.toString().c_str(),
@@ -722,7 +825,8 @@ BackupMasterRecovery::CyclicReplicaBuffer::bufferNext()
  * This method constructs recovery segments for the oldest replica in the buffer
  * that has been read from disk but not already partitioned. It should be called
  * periodically during recovery to partition the replicas being read into the
- * buffer by bufferNext().
+ * buffer by bufferNext(). It may be called from several threads at once; each
+ * call claims a different replica (see Replica::building).
  *
  * After this method completes exactly one of replica.recoverySegments or
  * replica.recoveryException should be set. Notice: both of these are
@@ -734,26 +838,30 @@ BackupMasterRecovery::CyclicReplicaBuffer::bufferNext()
  * indicates to them that they need to find the recovery segment on another
  * backup).
  *
+ * \param wait
+ *     If true and no replica is ready to partition, sleep until one is (see
+ *     #replicaReady) or until stopBuilders() is called. Used by the
+ *     recovery's build threads.
  * \return
  *     True if a replica was partitioned (or an exception occurred while trying
  *     to partition a replica), and false if there were no replicas eligible to
- *     partition.
+ *     partition (with \a wait, only once stopBuilders() has been called).
  */
 bool
-BackupMasterRecovery::CyclicReplicaBuffer::buildNext()
+BackupMasterRecovery::CyclicReplicaBuffer::buildNext(bool wait)
 {
     Replica* replicaToBuild = NULL;
     {
-        // Find the next loaded, unbuilt replica.
-        SpinLock::Guard lock(mutex);
-        for (size_t i = 0; i < inMemoryReplicas.size(); i++) {
-            size_t idx = (i + oldestReplicaIdx) % inMemoryReplicas.size();
-            Replica* candidate = inMemoryReplicas[idx];
-            if (candidate->frame->isLoaded() && !candidate->built) {
-                replicaToBuild = candidate;
+        // Find the next loaded, unbuilt replica no other thread is building.
+        std::unique_lock<SpinLock> lock(mutex);
+        while (true) {
+            replicaToBuild = findReplicaToBuild();
+            if (replicaToBuild != NULL || !wait || recovery->stopBuilding)
                 break;
-            }
+            replicaReady.wait(lock);
         }
+        if (replicaToBuild != NULL)
+            replicaToBuild->building = true;
     }
 
     if (!replicaToBuild) {
@@ -764,11 +872,14 @@ BackupMasterRecovery::CyclicReplicaBuffer::buildNext()
     replicaToBuild->recoverySegments.reset();
 
     void* replicaData = replicaToBuild->frame->load();
+
+    // RawMetrics are atomic, so builders on several threads can add to
+    // filterTicks and filterBytes directly.
     CycleCounter<RawMetric> _(&metrics->backup.filterTicks);
 
     // Recovery segments for this replica data are constructed by splitting data
-    // among them according to #partitions. If we move to multiple worker
-    // threads then replicas will need to be locked for this filtering.
+    // among them according to #partitions. The replica was claimed above, so
+    // no other thread touches it until #building is cleared.
     std::unique_ptr<Segment[]> recoverySegments(
         new Segment[recovery->numPartitions]);
     uint64_t start = Cycles::rdtsc();
@@ -792,6 +903,8 @@ BackupMasterRecovery::CyclicReplicaBuffer::buildNext()
             new SegmentRecoveryFailedException(HERE));
         Fence::sfence();
         replicaToBuild->built = true;
+        SpinLock::Guard lock(mutex);
+        replicaToBuild->building = false;
         return true;
     }
 
@@ -805,9 +918,58 @@ BackupMasterRecovery::CyclicReplicaBuffer::buildNext()
     replicaToBuild->built = true;
     replicaToBuild->lastAccessTime = Cycles::rdtsc();
     replicaToBuild->frame->unload();
+    metrics->backup.filterBytes +=
+        replicaToBuild->metadata->certificate.segmentLength;
+    SpinLock::Guard lock(mutex);
+    replicaToBuild->building = false;
     return true;
 }
 
+/**
+ * Wake the threads waiting in buildNext() if a replica in the buffer has
+ * finished loading and is ready to be partitioned. Loads complete in the
+ * storage layer without any notification, so the task queue thread calls
+ * this each time it runs while the recovery has build threads.
+ */
+void
+BackupMasterRecovery::CyclicReplicaBuffer::wakeBuilders()
+{
+    SpinLock::Guard lock(mutex);
+    if (findReplicaToBuild() != NULL)
+        replicaReady.notify_all();
+}
+
+/**
+ * Tell the threads building recovery segments to exit once they finish the
+ * replica they are working on, and wake any that are waiting in buildNext().
+ */
+void
+BackupMasterRecovery::CyclicReplicaBuffer::stopBuilders()
+{
+    SpinLock::Guard lock(mutex);
+    recovery->stopBuilding = true;
+    replicaReady.notify_all();
+}
+
+/**
+ * Return the oldest replica in the buffer that is loaded but neither built
+ * nor being built by another thread, or NULL if there is none. Must be
+ * called with #mutex held.
+ */
+BackupMasterRecovery::Replica*
+BackupMasterRecovery::CyclicReplicaBuffer::findReplicaToBuild()
+{
+    for (size_t i = 0; i < inMemoryReplicas.size(); i++) {
+        size_t idx = (i + oldestReplicaIdx) % inMemoryReplicas.size();
+        Replica* candidate = inMemoryReplicas[idx];
+        if (!candidate->built && !candidate->building &&
+                candidate->frame->isLoaded()) {
+            return candidate;
+        }
+    }
+    return NULL;
+}
+
 /**
  * Useful for debugging. Prints out the replicas currently in the buffer along
  * with information about whether it is loaded, built, and/or fetched. An arrow
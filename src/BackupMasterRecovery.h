@@ -16,6 +16,10 @@
 #ifndef RAMCLOUD_BACKUPMASTERRECOVERY_H
 #define RAMCLOUD_BACKUPMASTERRECOVERY_H
 
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+
 #include "Common.h"
 #include "BackupStorage.h"
 #include "Log.h"
@@ -72,10 +76,13 @@ class TaskKiller : public Task {
  * 2) Calls to performTask() are serialized.
  * 3) FrameRefs delivered to start() remain valid until destruction.
  *
- * Both primary and secondary replicas are ONLY filtered by the task queue
- * thread serially. The only difference between primary and secondary replicas
- * is that primary replicas are loaded automatically and secondary replicas are
- * not loaded until they are requested.
+ * Replicas are filtered by the task queue thread and, if the recovery was
+ * given more than one build thread, by additional threads of its own; each
+ * replica is claimed by exactly one thread (see Replica::building), so
+ * different replicas are filtered concurrently while the task queue thread
+ * keeps disk reads going. The only difference between primary and secondary
+ * replicas is that primary replicas are loaded automatically and secondary
+ * replicas are not loaded until they are requested.
  *
  * The number of replicas in memory at any given time is limited to prevent
  * out-of-memory errors. In the case of extreme speed differences between
@@ -99,7 +106,8 @@ class BackupMasterRecovery : public Task {
                          ServerId crashedMasterId,
                          uint32_t segmentSize,
                          uint32_t readSpeed,
-                         uint32_t maxReplicasInMemory);
+                         uint32_t maxReplicasInMemory,
+                         uint32_t buildThreads = 1);
     ~BackupMasterRecovery();
     void start(const std::vector<BackupStorage::FrameRef>& frames,
                Buffer* buffer,
@@ -119,6 +127,9 @@ class BackupMasterRecovery : public Task {
                                StartResponse* response);
     struct Replica;
     bool getLogDigest(Replica& replica, Buffer* digestBuffer);
+    bool extractDigest(Replica& replica, Buffer* digestBuffer,
+                       Buffer* tableStatsBuffer);
+    static void buildThreadMain(BackupMasterRecovery* recovery);
 
     /**
      * Which master recovery this is for. The coordinator may schedule
@@ -168,10 +179,11 @@ class BackupMasterRecovery : public Task {
      * used in the recovery as close to what is on storage as possible in
      * an attempt to reduce surprises. Once the replica has been filtered
      * either #recoverySegments or #recoveryException is populated.
-     * Concurrency on these replicas is hairy. Both primary and secondary
-     * replicas are ALWAYS filtered by the task queue thread. There is only
-     * locking when a replica's access data is being altered by
-     * CyclicReplicaBuffer; once #built is set the backup worker thread can
+     * Concurrency on these replicas is hairy. A replica is filtered by
+     * whichever build thread (or the task queue thread) claims it first by
+     * setting #building. There is only locking when a replica's access data
+     * or #building is being altered by CyclicReplicaBuffer; once #built is
+     * set the backup worker thread can
      * safely check #recoverySegments and #recoveryException (after an lfence,
      * which it does ONLY in BackupMasterRecovery::getRecoverySegment()).
      */
@@ -227,6 +239,15 @@ class BackupMasterRecovery : public Task {
          */
         bool built;
 
+        /**
+         * Set while some thread is constructing the recovery segments for
+         * this replica, so that no other thread picks it up in
+         * CyclicReplicaBuffer::buildNext() and bufferNext() doesn't evict it
+         * before its frame has been unloaded. Only accessed with the
+         * CyclicReplicaBuffer's mutex held.
+         */
+        bool building;
+
         /**
          * Used by CyclicReplicaBuffer to keep track of the last time
          * information from this replica was sent to a recovery master. See
@@ -314,7 +335,9 @@ class BackupMasterRecovery : public Task {
         enum Priority { NORMAL, HIGH };
         void enqueue(Replica* replica, Priority priority);
         bool bufferNext();
-        bool buildNext();
+        bool buildNext(bool wait = false);
+        void wakeBuilders();
+        void stopBuilders();
 
         void logState();
 
@@ -354,11 +377,21 @@ class BackupMasterRecovery : public Task {
         };
 
       PRIVATE:
+        Replica* findReplicaToBuild();
+
         /**
          * Used to lock all operations on this buffer.
          */
         SpinLock mutex;
 
+        /**
+         * Signaled when a replica in the buffer may have become ready to
+         * build: by bufferNext() when it adds one and by wakeBuilders() once
+         * one has finished loading. Also signaled by stopBuilders(). Threads
+         * in buildNext() wait on this when nothing is ready to build.
+         */
+        std::condition_variable_any replicaReady;
+
         /**
          * The maximum number of replicas with data in memory at any given time.
          */
@@ -474,6 +507,27 @@ class BackupMasterRecovery : public Task {
      */
     bool testingSkipBuild;
 
+    /**
+     * Number of threads that should construct recovery segments. With one,
+     * the task queue thread builds them in performTask(). With more,
+     * setPartitionsAndSchedule() starts this many #buildThreads to build
+     * replicas concurrently, and the task queue thread only loads replicas
+     * and wakes the build threads when one is ready.
+     */
+    uint32_t numBuildThreads;
+
+    /**
+     * The extra threads building recovery segments, if any. Joined in the
+     * destructor.
+     */
+    std::vector<std::thread> buildThreads;
+
+    /**
+     * Set by the destructor (through CyclicReplicaBuffer::stopBuilders())
+     * to tell #buildThreads to exit.
+     */
+    std::atomic<bool> stopBuilding;
+
     /**
      * The Task that is scheduled to delete this BackupMasterRecovery when it
      * is no longer needed.
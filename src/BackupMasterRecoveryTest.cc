@@ -16,6 +16,7 @@
 #include "TestUtil.h"
 #include "BackupMasterRecovery.h"
 #include "InMemoryStorage.h"
+#include "LogDigest.h"
 #include "LogEntryTypes.h"
 #include "ProtoBuf.h"
 #include "ShortMacros.h"
@@ -242,6 +243,47 @@ TEST_F(BackupMasterRecoveryTest, start) {
                                         - 11));
 }
 
+namespace {
+// Digests for a master with two log heads: segment 92 stayed open while the
+// other head rolled over to 95.
+bool mockExtractConcurrentHeadsDigest(uint64_t segmentId,
+                                      Buffer* digestBuffer,
+                                      Buffer* tableStatsBuffer) {
+    static LogDigest oldDigest, newDigest;
+    if (oldDigest.size() == 0) {
+        oldDigest.addSegmentId(92);
+        newDigest.addSegmentId(93);
+        newDigest.addSegmentId(95);
+        newDigest.addConcurrentHead(92);
+    }
+    if (segmentId != 92lu && segmentId != 95lu)
+        return false;
+    digestBuffer->reset();
+    (segmentId == 92lu ? oldDigest : newDigest).appendToBuffer(*digestBuffer);
+    tableStatsBuffer->reset();
+    tableStatsBuffer->appendExternal("tableStats", 11);
+    return true;
+}
+}
+
+TEST_F(BackupMasterRecoveryTest, start_concurrentHeads) {
+    mockMetadata(91, true, true);
+    mockMetadata(92, false);
+    mockMetadata(95, false);
+    recovery->testingExtractDigest = &mockExtractConcurrentHeadsDigest;
+    Buffer buffer;
+    auto response = buffer.emplaceAppend<BackupMasterRecovery::StartResponse>();
+    recovery->start(frames, &buffer, response);
+    EXPECT_EQ(95lu, response->digestSegmentId);
+    EXPECT_EQ(195u, response->digestSegmentEpoch);
+
+    LogDigest digest(recovery->logDigest.getRange(0,
+                                                  recovery->logDigest.size()),
+                     recovery->logDigest.size());
+    EXPECT_EQ(3u, digest.size());
+    EXPECT_TRUE(digest.hasConcurrentHeads());
+}
+
 TEST_F(BackupMasterRecoveryTest, setPartitionsAndSchedule) {
     recovery.construct(taskQueue, 456lu, ServerId{99, 0},
                        segmentSize, readSpeed, maxReplicasInMemory);
@@ -301,6 +343,37 @@ TEST_F(BackupMasterRecoveryTest, setPartitionsAndSchedule) {
     EXPECT_TRUE(recovery->isScheduled());
 }
 
+TEST_F(BackupMasterRecoveryTest, setPartitionsAndSchedule_buildThreads) {
+    recovery.construct(taskQueue, 456lu, ServerId{99, 0},
+                       segmentSize, readSpeed, maxReplicasInMemory, 3);
+    mockMetadata(88, true, true);
+    mockMetadata(89, true, true);
+    mockMetadata(90, true, true);
+    recovery->testingExtractDigest = &mockExtractDigest;
+    recovery->testingSkipBuild = true;
+    recovery->start(frames, NULL, NULL);
+    recovery->setPartitionsAndSchedule(partitions);
+    EXPECT_EQ(3u, recovery->buildThreads.size());
+
+    // Only load replicas into the buffer; the build threads should filter
+    // them without the task queue thread's help.
+    while (recovery->replicaBuffer.bufferNext()) {}
+    for (int i = 0; i < 1000; i++) {
+        Fence::lfence();
+        if (recovery->replicas.at(0).built &&
+                recovery->replicas.at(1).built &&
+                recovery->replicas.at(2).built)
+            break;
+        usleep(1000);
+    }
+    foreach (auto& replica, recovery->replicas) {
+        EXPECT_TRUE(replica.built);
+        EXPECT_FALSE(replica.building);
+        EXPECT_TRUE(replica.recoverySegments);
+    }
+    recovery.destroy();
+}
+
 TEST_F(BackupMasterRecoveryTest, getRecoverySegment) {
     mockMetadata(88); // secondary
     mockMetadata(89, true, true); // primary
@@ -512,6 +585,43 @@ TEST_F(BackupMasterRecoveryTest, CyclicReplicaBuffer_buildNext) {
     TestLog::reset();
 }
 
+TEST_F(BackupMasterRecoveryTest, CyclicReplicaBuffer_buildNext_skipClaimed) {
+    mockMetadata(88, true, true);
+    mockMetadata(89, true, true);
+    recovery->testingSkipBuild = true;
+    recovery->start(frames, NULL, NULL);
+    recovery->replicaBuffer.bufferNext();
+    recovery->replicaBuffer.bufferNext();
+
+    // Pretend another thread is already building the oldest replica.
+    BackupMasterRecovery::Replica* claimed =
+        recovery->replicaBuffer.inMemoryReplicas.at(0);
+    claimed->building = true;
+    EXPECT_TRUE(recovery->replicaBuffer.buildNext());
+    EXPECT_FALSE(claimed->built);
+    BackupMasterRecovery::Replica* other =
+        recovery->replicaBuffer.inMemoryReplicas.at(1);
+    EXPECT_TRUE(other->built);
+    EXPECT_FALSE(other->building);
+    EXPECT_FALSE(recovery->replicaBuffer.buildNext());
+}
+
+TEST_F(BackupMasterRecoveryTest, CyclicReplicaBuffer_buildNext_wait) {
+    mockMetadata(88, true, true);
+    recovery->testingSkipBuild = true;
+    recovery->start(frames, NULL, NULL);
+    recovery->replicaBuffer.bufferNext();
+
+    // A ready replica is built without waiting.
+    EXPECT_TRUE(recovery->replicaBuffer.buildNext(true));
+    EXPECT_TRUE(recovery->replicas.at(0).built);
+
+    // Once stopped, waiting builders give up rather than sleep.
+    recovery->replicaBuffer.stopBuilders();
+    EXPECT_TRUE(recovery->stopBuilding);
+    EXPECT_FALSE(recovery->replicaBuffer.buildNext(true));
+}
+
 TEST_F(BackupMasterRecoveryTest, buildRecoverySegments_buildThrows) {
     mockMetadata(88, true, true);
     recovery->start(frames, NULL, NULL);
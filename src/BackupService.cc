@@ -22,6 +22,7 @@
 #include "ServerConfig.h"
 #include "ShortMacros.h"
 #include "MultiFileStorage.h"
+#include "PersistentMemoryStorage.h"
 #include "Status.h"
 
 namespace RAMCloud {
@@ -63,6 +64,12 @@ BackupService::BackupService(Context* context,
         storage.reset(new InMemoryStorage(config->segmentSize,
                                           config->backup.numSegmentFrames,
                                           config->backup.writeRateLimit));
+    } else if (config->backup.persistentMemory) {
+        storage.reset(new PersistentMemoryStorage(
+                config->segmentSize,
+                config->backup.numSegmentFrames,
+                config->backup.writeRateLimit,
+                config->backup.file.c_str()));
     } else {
         size_t maxWriteBuffers = config->backup.maxNonVolatileBuffers;
         if (maxWriteBuffers == 0) {
@@ -78,7 +85,8 @@ BackupService::BackupService(Context* context,
                                            config->backup.writeRateLimit,
                                            maxWriteBuffers,
                                            config->backup.file.c_str(),
-                                           O_DIRECT | O_SYNC));
+                                           O_DIRECT | O_SYNC,
+                                           config->backup.ioUring));
     }
     if (storage->getMetadataSize() < sizeof(BackupReplicaMetadata))
         DIE("Storage metadata block too small to hold BackupReplicaMetadata");
@@ -215,6 +223,14 @@ BackupService::dispatch(WireFormat::Opcode opcode, Rpc* rpc)
             callHandler<WireFormat::BackupWrite, BackupService,
                         &BackupService::writeSegment>(rpc);
             break;
+        case WireFormat::BackupMultiWrite::opcode:
+            callHandler<WireFormat::BackupMultiWrite, BackupService,
+                        &BackupService::multiWriteSegment>(rpc);
+            break;
+        case WireFormat::BackupChainWrite::opcode:
+            callHandler<WireFormat::BackupChainWrite, BackupService,
+                        &BackupService::chainWriteSegment>(rpc);
+            break;
         default:
             throw UnimplementedRequestError(HERE);
     }
@@ -474,12 +490,14 @@ BackupService::startReadingData(
     }
     BackupMasterRecovery* recovery;
     if (mustCreateRecovery) {
-        recovery = new BackupMasterRecovery(taskQueue,
-                                            reqHdr->recoveryId,
-                                            crashedMasterId,
-                                            segmentSize,
-                                            readSpeed,
-                                            config->backup.maxRecoveryReplicas);
+        recovery = new BackupMasterRecovery(
+                taskQueue,
+                reqHdr->recoveryId,
+                crashedMasterId,
+                segmentSize,
+                readSpeed,
+                config->backup.maxRecoveryReplicas,
+                config->backup.recoveryBuildThreads);
         recoveries[crashedMasterId] = recovery;
     }
     recovery = recoveries[crashedMasterId];
@@ -569,10 +587,139 @@ BackupService::writeSegment(const WireFormat::BackupWrite::Request* reqHdr,
                             Rpc* rpc)
 {
     ServerId masterId(reqHdr->masterId);
-    uint64_t segmentId = reqHdr->segmentId;
+    checkWriterIsUp(masterId);
+
+    // Chain replication: pass the write on to the other backups in the
+    // chain before storing it here, so that all of them proceed in parallel.
+    // They get BACKUP_CHAIN_WRITEs, which sit a level below BACKUP_WRITE and
+    // are never forwarded again, so this worker can safely block on them.
+    uint32_t dataOffset = sizeof32(*reqHdr);
+    uint32_t chainLength = reqHdr->chainLength;
+    Tub<WriteSegmentRpc> forwards[chainLength];
+    respHdr->chainAcked = 0;
+    if (chainLength > 0) {
+        uint32_t chainBytes = chainLength * sizeof32(uint64_t);
+        const uint64_t* chain = static_cast<const uint64_t*>(
+                rpc->requestPayload->getRange(dataOffset, chainBytes));
+        if (chain == NULL)
+            throw MessageTooShortError(HERE);
+        dataOffset += chainBytes;
+        for (uint32_t i = 0; i < chainLength; i++) {
+            forwards[i].construct(context, ServerId(chain[i]), reqHdr,
+                                  rpc->requestPayload, dataOffset);
+        }
+    }
+
+    writeReplica(masterId, reqHdr->segmentId, reqHdr->segmentEpoch,
+                 reqHdr->offset, reqHdr->length,
+                 reqHdr->open, reqHdr->close, reqHdr->primary,
+                 reqHdr->certificateIncluded ? &reqHdr->certificate : NULL,
+                 rpc->requestPayload, dataOffset);
+
+    respHdr->chainAcked = waitForForwardedWrites(forwards, chainLength);
+}
+
+/**
+ * Store a write that another backup received in a BACKUP_WRITE and passed
+ * on to this one as part of a replication chain; see writeSegment(). Unlike
+ * writeSegment(), this never forwards the write: that is what keeps
+ * BACKUP_CHAIN_WRITE a leaf in the RPC level hierarchy (see RpcLevel).
+ *
+ * \param reqHdr
+ *      Header of the Rpc request; as for writeSegment(), but its chain must
+ *      be empty.
+ * \param respHdr
+ *      Header for the Rpc response.
+ * \param rpc
+ *      The Rpc being serviced, used for access to the opaque bytes to
+ *      be written which follow reqHdr.
+ *
+ * \throw RequestFormatError
+ *      If the request names a chain.
+ */
+void
+BackupService::chainWriteSegment(
+        const WireFormat::BackupChainWrite::Request* reqHdr,
+        WireFormat::BackupChainWrite::Response* respHdr,
+        Rpc* rpc)
+{
+    ServerId masterId(reqHdr->masterId);
+    checkWriterIsUp(masterId);
+    respHdr->chainAcked = 0;
+    if (reqHdr->chainLength != 0)
+        throw RequestFormatError(HERE);
+
+    writeReplica(masterId, reqHdr->segmentId, reqHdr->segmentEpoch,
+                 reqHdr->offset, reqHdr->length,
+                 reqHdr->open, reqHdr->close, false,
+                 reqHdr->certificateIncluded ? &reqHdr->certificate : NULL,
+                 rpc->requestPayload, sizeof32(*reqHdr));
+}
+
+/**
+ * Perform several writes from one master, possibly to different replicas,
+ * in a single RPC; masters coalesce small writes to the same backup this
+ * way to cut the number of RPCs they send (see
+ * ReplicatedSegment::writeBatches). Each write is handled exactly as
+ * writeSegment() would handle it on its own, and in order. A write that
+ * fails doesn't affect the others: the response carries a status for each.
+ *
+ * \param reqHdr
+ *      Header of the Rpc request; the writes follow it.
+ * \param respHdr
+ *      Header for the Rpc response.
+ * \param rpc
+ *      The Rpc being serviced, used for access to the writes and their data
+ *      and to return their statuses.
+ */
+void
+BackupService::multiWriteSegment(
+        const WireFormat::BackupMultiWrite::Request* reqHdr,
+        WireFormat::BackupMultiWrite::Response* respHdr,
+        Rpc* rpc)
+{
+    ServerId masterId(reqHdr->masterId);
+    checkWriterIsUp(masterId);
+
+    uint32_t offset = sizeof32(*reqHdr);
+    respHdr->count = 0;
+    for (uint32_t i = 0; i < reqHdr->count; i++) {
+        const WireFormat::BackupMultiWrite::Part* part =
+            rpc->requestPayload->getOffset<
+                WireFormat::BackupMultiWrite::Part>(offset);
+        if (part == NULL)
+            throw MessageTooShortError(HERE);
+        offset += sizeof32(*part);
+        if (rpc->requestPayload->size() < offset + part->length)
+            throw MessageTooShortError(HERE);
 
+        Status status = STATUS_OK;
+        try {
+            writeReplica(masterId, part->segmentId, part->segmentEpoch,
+                         part->offset, part->length,
+                         part->open, part->close, part->primary,
+                         part->certificateIncluded ? &part->certificate : NULL,
+                         rpc->requestPayload, offset);
+        } catch (const ClientException& e) {
+            status = e.status;
+        }
+        rpc->replyPayload->emplaceAppend<Status>(status);
+        respHdr->count++;
+        offset += part->length;
+    }
+}
+
+/**
+ * Reject writes from a master that this backup's server list says isn't
+ * part of the cluster. See "Zombies" in designNotes.
+ *
+ * \throw CallerNotInClusterException
+ *      If \a masterId isn't up.
+ */
+void
+BackupService::checkWriterIsUp(ServerId masterId)
+{
     if  (!context->serverList->isUp(masterId) && !testingSkipCallerIdCheck) {
-        // See "Zombies" in designNotes.
         LOG(WARNING, "Received backup write request from server %s which is "
             "not in server list version %lu:\n%s",
             masterId.toString().c_str(),
@@ -580,13 +727,56 @@ BackupService::writeSegment(const WireFormat::BackupWrite::Request* reqHdr,
             context->serverList->toString().c_str());
         throw CallerNotInClusterException(HERE);
     }
+}
+
+/**
+ * Open, append to, and/or close a replica on behalf of writeSegment() or
+ * multiWriteSegment(); see writeSegment() for the details.
+ *
+ * \param masterId
+ *      Master the replica belongs to.
+ * \param segmentId
+ *      Segment the replica is of.
+ * \param segmentEpoch
+ *      Epoch of the segment as of this write.
+ * \param offset
+ *      Offset into the replica to write at.
+ * \param length
+ *      Bytes to write.
+ * \param open
+ *      Whether to open the replica first.
+ * \param close
+ *      Whether to close the replica afterwards.
+ * \param primary
+ *      Whether the replica is a primary replica.
+ * \param certificate
+ *      If non-NULL, the certificate to store with the replica after
+ *      this write.
+ * \param source
+ *      Buffer holding the data to write.
+ * \param sourceOffset
+ *      Offset in \a source of the data to write.
+ *
+ * \throw BackupSegmentOverflowException
+ *      If the write request is beyond the end of the segment.
+ * \throw BackupBadSegmentIdException
+ *      If the segment is not open.
+ */
+void
+BackupService::writeReplica(ServerId masterId, uint64_t segmentId,
+                            uint64_t segmentEpoch, uint32_t offset,
+                            uint32_t length, bool open, bool close,
+                            bool primary,
+                            const SegmentCertificate* certificate,
+                            Buffer* source, uint32_t sourceOffset)
+{
     auto frameIt = frames.find({masterId, segmentId});
     BackupStorage::FrameRef frame;
     if (frameIt != frames.end())
         frame = frameIt->second;
 
     if (frame && !frame->wasAppendedToByCurrentProcess()) {
-        if (reqHdr->open) {
+        if (open) {
             // We get here if a backup crashes, restarts, reloads a
             // replica from disk, and then the master detects the crash and
             // tries to re-replicate the segment that lost a replica on
@@ -606,7 +796,7 @@ BackupService::writeSegment(const WireFormat::BackupWrite::Request* reqHdr,
     }
 
     // Perform open, if any.
-    if (reqHdr->open && !frame) {
+    if (open && !frame) {
         LOG(DEBUG, "Opening <%s,%lu>", masterId.toString().c_str(),
             segmentId);
         frame = storage->open(config->backup.sync, masterId, segmentId);
@@ -633,28 +823,61 @@ BackupService::writeSegment(const WireFormat::BackupWrite::Request* reqHdr,
         }
         CycleCounter<RawMetric> __(&metrics->backup.writeCopyTicks);
         Tub<BackupReplicaMetadata> metadata;
-        if (reqHdr->certificateIncluded) {
-            metadata.construct(reqHdr->certificate,
+        if (certificate) {
+            metadata.construct(*certificate,
                                masterId.getId(), segmentId,
                                segmentSize,
-                               reqHdr->segmentEpoch,
-                               reqHdr->close, reqHdr->primary);
+                               segmentEpoch,
+                               close, primary);
         }
-        frame->append(*rpc->requestPayload, sizeof(*reqHdr),
-                      reqHdr->length, reqHdr->offset,
+        frame->append(*source, sourceOffset, length, offset,
                       metadata.get(), sizeof(*metadata));
-        metrics->backup.writeCopyBytes += reqHdr->length;
-        PerfStats::threadStats.backupBytesReceived += reqHdr->length;
-        bytesWritten += reqHdr->length;
+        metrics->backup.writeCopyBytes += length;
+        PerfStats::threadStats.backupBytesReceived += length;
+        bytesWritten += length;
     }
 
     // Perform close, if any.
-    if (reqHdr->close) {
+    if (close) {
         LOG(DEBUG, "Closing <%s,%lu>", masterId.toString().c_str(), segmentId);
         frame->close();
     }
 }
 
+/**
+ * Wait for the writes that writeSegment() passed on to the other backups in
+ * a replication chain.
+ *
+ * \param forwards
+ *      The forwarded writes, one per backup in the chain, in chain order.
+ * \param count
+ *      Number of entries in \a forwards.
+ * \return
+ *      Number of backups, counting from the start of the chain, that are
+ *      known to have stored the write, for the response to the master. The
+ *      master writes to the rest of the chain itself, so the count stops at
+ *      the first backup that failed even if later ones succeeded.
+ */
+uint8_t
+BackupService::waitForForwardedWrites(Tub<WriteSegmentRpc> forwards[],
+                                      uint32_t count)
+{
+    uint8_t acked = 0;
+    bool broken = false;
+    for (uint32_t i = 0; i < count; i++) {
+        try {
+            forwards[i]->wait();
+            if (!broken)
+                acked++;
+        } catch (const ClientException& e) {
+            LOG(NOTICE, "Couldn't forward write down the replication chain: "
+                "%s", e.toSymbol());
+            broken = true;
+        }
+    }
+    return acked;
+}
+
 /**
  * Runs garbage collection tasks.
  */
@@ -72,6 +72,20 @@ class BackupService : public Service
     void writeSegment(const WireFormat::BackupWrite::Request* req,
                       WireFormat::BackupWrite::Response* resp,
                       Rpc* rpc);
+    void multiWriteSegment(const WireFormat::BackupMultiWrite::Request* req,
+                           WireFormat::BackupMultiWrite::Response* resp,
+                           Rpc* rpc);
+    void chainWriteSegment(const WireFormat::BackupChainWrite::Request* req,
+                           WireFormat::BackupChainWrite::Response* resp,
+                           Rpc* rpc);
+    void checkWriterIsUp(ServerId masterId);
+    void writeReplica(ServerId masterId, uint64_t segmentId,
+                      uint64_t segmentEpoch, uint32_t offset,
+                      uint32_t length, bool open, bool close, bool primary,
+                      const SegmentCertificate* certificate,
+                      Buffer* source, uint32_t sourceOffset);
+    uint8_t waitForForwardedWrites(Tub<WriteSegmentRpc> forwards[],
+                                   uint32_t count);
     void gcMain();
     void initOnceEnlisted();
     void trackerChangesEnqueued();
@@ -480,6 +480,109 @@ TEST_F(BackupServiceTest, writeSegment_epochStored) {
                  static_cast<char*>(frameIt->second->load()) + 10);
 }
 
+TEST_F(BackupServiceTest, writeSegment_chain) {
+    Server* server2 = cluster->addServer(config);
+    server2->backup->testingSkipCallerIdCheck = true;
+    Server* server3 = cluster->addServer(config);
+    server3->backup->testingSkipCallerIdCheck = true;
+    openSegment({99, 0}, 88);
+    Segment opening;
+    SegmentCertificate certificate;
+    uint32_t length = opening.getAppendedLength(&certificate);
+    BackupClient::writeSegment(&context, server2->serverId, {99, 0}, 88, 0,
+                               &opening, 0, length, &certificate,
+                               true, false, false);
+    BackupClient::writeSegment(&context, server3->serverId, {99, 0}, 88, 0,
+                               &opening, 0, length, &certificate,
+                               true, false, false);
+
+    Segment segment;
+    segment.copyIn(10, "test", 5);
+    ServerId chain[] = { server2->serverId, server3->serverId };
+    WriteSegmentRpc rpc(&context, backupId, {99, 0}, 88, 0, &segment, 10, 5,
+                        &certificate, false, false, true, chain, 2);
+    EXPECT_EQ(2u, rpc.wait());
+    auto frameIt = backup->frames.find({{99, 0}, 88});
+    EXPECT_STREQ("test",
+                 static_cast<char*>(frameIt->second->load()) + 10);
+    foreach (Server* server, (std::vector<Server*>{server2, server3})) {
+        frameIt = server->backup->frames.find({{99, 0}, 88});
+        EXPECT_STREQ("test",
+                     static_cast<char*>(frameIt->second->load()) + 10);
+        EXPECT_FALSE(toMetadata(frameIt->second->getMetadata())->primary);
+    }
+}
+
+TEST_F(BackupServiceTest, writeSegment_chainForwardFails) {
+    Server* server2 = cluster->addServer(config);
+    server2->backup->testingSkipCallerIdCheck = true;
+    Server* server3 = cluster->addServer(config);
+    server3->backup->testingSkipCallerIdCheck = true;
+    openSegment({99, 0}, 88);
+    Segment opening;
+    SegmentCertificate certificate;
+    uint32_t length = opening.getAppendedLength(&certificate);
+    BackupClient::writeSegment(&context, server3->serverId, {99, 0}, 88, 0,
+                               &opening, 0, length, &certificate,
+                               true, false, false);
+
+    // server2 never opened the replica, so the chain breaks at its first
+    // backup; server3's copy doesn't count even though it succeeds.
+    Segment segment;
+    segment.copyIn(10, "test", 5);
+    ServerId chain[] = { server2->serverId, server3->serverId };
+    TestLog::reset();
+    WriteSegmentRpc rpc(&context, backupId, {99, 0}, 88, 0, &segment, 10, 5,
+                        &certificate, false, false, true, chain, 2);
+    EXPECT_EQ(0u, rpc.wait());
+    EXPECT_EQ("waitForForwardedWrites: Couldn't forward write down the "
+              "replication chain: STATUS_BACKUP_BAD_SEGMENT_ID",
+              TestLog::get());
+    auto frameIt = backup->frames.find({{99, 0}, 88});
+    EXPECT_STREQ("test",
+                 static_cast<char*>(frameIt->second->load()) + 10);
+    frameIt = server3->backup->frames.find({{99, 0}, 88});
+    EXPECT_STREQ("test",
+                 static_cast<char*>(frameIt->second->load()) + 10);
+}
+
+TEST_F(BackupServiceTest, chainWriteSegment) {
+    openSegment({99, 0}, 88);
+    WireFormat::BackupWrite::Request forwarded;
+    forwarded.masterId = 99;
+    forwarded.segmentId = 88;
+    forwarded.offset = 10;
+    forwarded.length = 5;
+    forwarded.primary = true;
+    Buffer data;
+    data.appendCopy("test", 5);
+    WriteSegmentRpc rpc(&context, backupId, &forwarded, &data, 0);
+    EXPECT_EQ(WireFormat::BACKUP_CHAIN_WRITE,
+              rpc.request.getStart<WireFormat::RequestCommonWithId>()->opcode);
+    EXPECT_EQ(0u, rpc.wait());
+    auto frameIt = backup->frames.find({{99, 0}, 88});
+    EXPECT_STREQ("test",
+                 static_cast<char*>(frameIt->second->load()) + 10);
+    EXPECT_FALSE(toMetadata(frameIt->second->getMetadata())->primary);
+}
+
+TEST_F(BackupServiceTest, chainWriteSegment_chainNotAllowed) {
+    openSegment({99, 0}, 88);
+    Buffer request, response;
+    WireFormat::BackupChainWrite::Request* reqHdr =
+            request.emplaceAppend<WireFormat::BackupChainWrite::Request>();
+    reqHdr->common.opcode = WireFormat::BACKUP_CHAIN_WRITE;
+    reqHdr->common.service = WireFormat::BACKUP_SERVICE;
+    reqHdr->common.targetId = backupId.getId();
+    reqHdr->masterId = 99;
+    reqHdr->segmentId = 88;
+    reqHdr->chainLength = 1;
+    request.emplaceAppend<uint64_t>(backupId.getId());
+    Service::Rpc rpc(NULL, &request, &response);
+    EXPECT_THROW(backup->dispatch(WireFormat::BACKUP_CHAIN_WRITE, &rpc),
+                 RequestFormatError);
+}
+
 TEST_F(BackupServiceTest, writeSegment_segmentNotOpen) {
     EXPECT_THROW(
         writeRawString({99, 0}, 88, 10, "test"),
@@ -580,6 +683,66 @@ TEST_F(BackupServiceTest, writeSegment_openSegmentOutOfStorage) {
         BackupOpenRejectedException);
 }
 
+TEST_F(BackupServiceTest, multiWriteSegment) {
+    Segment opening;
+    SegmentCertificate certificate;
+    uint32_t length = opening.getAppendedLength(&certificate);
+    Segment segment;
+    segment.copyIn(10, "test", 5);
+
+    MultiWriteSegmentRpc rpc(&context, backupId, {99, 0});
+    EXPECT_EQ(0u, rpc.addWrite(88, 0, &opening, 0, length, &certificate,
+                               true, false, true));
+    EXPECT_EQ(1u, rpc.addWrite(89, 0, &opening, 0, length, &certificate,
+                               true, false, false));
+    EXPECT_EQ(2u, rpc.addWrite(88, 0, &segment, 10, 5, &certificate,
+                               false, true, true));
+    EXPECT_EQ(3u, rpc.getWriteCount());
+    EXPECT_EQ(2 * length + 5, rpc.getDataBytes());
+    EXPECT_FALSE(rpc.isSent());
+    rpc.send();
+    EXPECT_TRUE(rpc.isSent());
+    for (uint32_t i = 0; i < 3; i++)
+        rpc.wait(i);
+
+    auto frameIt = backup->frames.find({{99, 0}, 88});
+    ASSERT_NE(backup->frames.end(), frameIt);
+    EXPECT_STREQ("test",
+                 static_cast<char*>(frameIt->second->load()) + 10);
+    EXPECT_TRUE(toMetadata(frameIt->second->getMetadata())->closed);
+    frameIt = backup->frames.find({{99, 0}, 89});
+    ASSERT_NE(backup->frames.end(), frameIt);
+    EXPECT_FALSE(toMetadata(frameIt->second->getMetadata())->primary);
+    EXPECT_FALSE(toMetadata(frameIt->second->getMetadata())->closed);
+}
+
+TEST_F(BackupServiceTest, multiWriteSegment_checkCallerId) {
+    backup->testingSkipCallerIdCheck = false;
+    MultiWriteSegmentRpc rpc(&context, backupId, {99, 0});
+    rpc.addWrite(88, 0, NULL, 0, 0, NULL, true, false, true);
+    rpc.send();
+    EXPECT_THROW(rpc.wait(0), CallerNotInClusterException);
+    EXPECT_EQ(backup->frames.end(), backup->frames.find({{99, 0}, 88}));
+}
+
+TEST_F(BackupServiceTest, multiWriteSegment_oneWriteFails) {
+    openSegment({99, 0}, 88);
+    Segment segment;
+    segment.copyIn(10, "test", 5);
+    SegmentCertificate certificate;
+
+    MultiWriteSegmentRpc rpc(&context, backupId, {99, 0});
+    rpc.addWrite(87, 0, &segment, 10, 5, &certificate, false, false, true);
+    rpc.addWrite(88, 0, &segment, 10, 5, &certificate, false, false, true);
+    rpc.send();
+    EXPECT_THROW(rpc.wait(0), BackupBadSegmentIdException);
+    rpc.wait(1);
+    EXPECT_THROW(rpc.wait(2), ResponseFormatError);
+    auto frameIt = backup->frames.find({{99, 0}, 88});
+    EXPECT_STREQ("test",
+                 static_cast<char*>(frameIt->second->load()) + 10);
+}
+
 TEST_F(BackupServiceTest, GarbageCollectDownServerTask) {
     openSegment({99, 0}, 88);
     openSegment({99, 0}, 89);
@@ -38,6 +38,38 @@ BackupStorage::BackupStorage(size_t segmentSize,
  */
 uint32_t
 BackupStorage::benchmark(BackupStrategy backupStrategy)
+{
+    uint32_t minRead;
+    uint32_t avgRead;
+    measureReadSpeed(&minRead, &avgRead);
+
+    LOG(NOTICE, "Backup storage speeds (min): %u MB/s read", minRead);
+    LOG(NOTICE, "Backup storage speeds (avg): %u MB/s read,", avgRead);
+
+    if (backupStrategy == RANDOM_REFINE_MIN) {
+        LOG(NOTICE, "RANDOM_REFINE_MIN BackupStrategy selected");
+        return minRead;
+    } else if (backupStrategy == RANDOM_REFINE_AVG) {
+        LOG(NOTICE, "RANDOM_REFINE_AVG BackupStrategy selected");
+        return avgRead;
+    } else if (backupStrategy == EVEN_DISTRIBUTION) {
+        LOG(NOTICE, "EVEN_SELECTION BackupStrategy selected");
+        return 100;
+    } else {
+        DIE("Bad BackupStrategy selected");
+    }
+}
+
+/**
+ * Time loading a number of freshly written replicas; used by benchmark().
+ *
+ * \param[out] minRead
+ *      Set to the slowest read speed seen, in MB/s.
+ * \param[out] avgRead
+ *      Set to the average read speed, in MB/s.
+ */
+void
+BackupStorage::measureReadSpeed(uint32_t* minRead, uint32_t* avgRead)
 {
     const uint32_t count = 16;
     uint32_t readSpeeds[count];
@@ -56,30 +88,13 @@ BackupStorage::benchmark(BackupStrategy backupStrategy)
                             segmentSize * 1000UL * 1000 * 1000 /
                             (1 << 20) / ns);
     }
-    uint32_t minRead = *std::min_element(readSpeeds,
-                                         readSpeeds + count);
-    uint32_t avgRead = ({
+    *minRead = *std::min_element(readSpeeds, readSpeeds + count);
+    *avgRead = ({
         uint32_t sum = 0;
         foreach (uint32_t speed, readSpeeds)
             sum += speed;
         sum / count;
     });
-
-    LOG(NOTICE, "Backup storage speeds (min): %u MB/s read", minRead);
-    LOG(NOTICE, "Backup storage speeds (avg): %u MB/s read,", avgRead);
-
-    if (backupStrategy == RANDOM_REFINE_MIN) {
-        LOG(NOTICE, "RANDOM_REFINE_MIN BackupStrategy selected");
-        return minRead;
-    } else if (backupStrategy == RANDOM_REFINE_AVG) {
-        LOG(NOTICE, "RANDOM_REFINE_AVG BackupStrategy selected");
-        return avgRead;
-    } else if (backupStrategy == EVEN_DISTRIBUTION) {
-        LOG(NOTICE, "EVEN_SELECTION BackupStrategy selected");
-        return 100;
-    } else {
-        DIE("Bad BackupStrategy selected");
-    }
 }
 
 /**
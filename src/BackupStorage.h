@@ -55,7 +55,8 @@ struct BackupStorageException : public Exception {
  * Subclasses store replica data (along with some higher-level provided
  * metadata) and allow them to be retrieved later. Subclasses may have
  * different durability properties. This includes MultiFileStorage for
- * storing and recovering from disk and InMemoryStorage for storing and
+ * storing and recovering from disk, PersistentMemoryStorage for storing and
+ * recovering from persistent memory, and InMemoryStorage for storing and
  * recovering from RAM.
  */
 class BackupStorage {
@@ -442,7 +443,8 @@ class BackupStorage {
     virtual void fry() = 0;
 
     /// See #storageType.
-    enum class Type { UNKNOWN = 0, MEMORY = 1, DISK = 2 };
+    enum class Type { UNKNOWN = 0, MEMORY = 1, DISK = 2,
+                      PERSISTENT_MEMORY = 3 };
 
   PROTECTED:
     /**
@@ -460,6 +462,8 @@ class BackupStorage {
      */
     BackupStorage(size_t segmentSize, Type storageType, size_t writeRateLimit);
 
+    void measureReadSpeed(uint32_t* minRead, uint32_t* avgRead);
+
     /// Maximum length in bytes of a replica.
     size_t segmentSize;
 
@@ -15,6 +15,10 @@
 
 // RAMCloud pragma [CPPLINT=0]
 
+#if __PCLMUL__
+#include <wmmintrin.h>
+#endif
+
 #include "Crc32C.h"
 #include "Logger.h"
 #include "ShortMacros.h"
@@ -36,6 +40,95 @@ haveSse42() {
         LOG(DEBUG, "Processor does not have SSE 4.2");
     return ret;
 }
+
+bool
+havePclmul() {
+    uint32_t a, b, c, d;
+    CPUID(1, a, b, c, d);
+    return (c & (1 << 1)) != 0;
+}
+
+/// The CRC32C polynomial, bit-reflected. In this representation bit 31 is
+/// the coefficient of x^0 and bit 0 that of x^31.
+const uint32_t POLY = 0x82f63b78;
+
+/**
+ * Multiply two polynomials modulo POLY, without the help of any special
+ * instructions.
+ */
+uint32_t
+multiplyModPoly(uint32_t a, uint32_t b)
+{
+    uint32_t product = 0;
+    for (uint32_t bit = 1U << 31; bit != 0; bit >>= 1) {
+        if (a & bit)
+            product ^= b;
+        b = (b & 1) ? (b >> 1) ^ POLY : b >> 1;
+    }
+    return product;
+}
+
+/**
+ * Return x^n modulo POLY.
+ */
+uint32_t
+xPowModPoly(uint64_t n)
+{
+    uint32_t result = 1U << 31;         // x^0
+    uint32_t square = 1U << 30;         // x^1
+    while (n != 0) {
+        if (n & 1)
+            result = multiplyModPoly(result, square);
+        square = multiplyModPoly(square, square);
+        n >>= 1;
+    }
+    return result;
+}
+
+/**
+ * The constants needed to advance a CRC over a run of zero bytes, as if the
+ * bytes had been fed through the crc32 instruction. Combining the streams of
+ * Crc32C::updateInterleaved() needs this: the CRC of a stream that was
+ * computed starting from zero is folded into the CRC of the preceding data
+ * advanced over the stream's length.
+ */
+struct ZeroShift {
+    explicit ZeroShift(uint64_t bytes)
+        : clmulConstant(xPowModPoly(8 * bytes - 33))
+        , softwareConstant(xPowModPoly(8 * bytes))
+    {
+    }
+
+    /**
+     * Return crc advanced over the number of zero bytes this object was
+     * constructed with.
+     */
+    uint32_t
+    apply(uint32_t crc, bool useClmul) const
+    {
+#if __PCLMUL__ && __SSE4_2__
+        // The 64-bit carry-less product of crc and x^(8n-33) is reduced
+        // modulo POLY by the crc32 instruction, which multiplies by x^32;
+        // one more factor of x comes from the product of two bit-reflected
+        // values being one bit short of 64 bits.
+        if (useClmul) {
+            __m128i product = _mm_clmulepi64_si128(
+                    _mm_cvtsi32_si128(static_cast<int>(crc)),
+                    _mm_cvtsi32_si128(static_cast<int>(clmulConstant)), 0);
+            return downCast<uint32_t>(__builtin_ia32_crc32di(0,
+                    static_cast<uint64_t>(_mm_cvtsi128_si64(product))));
+        }
+#endif
+        return multiplyModPoly(crc, softwareConstant);
+    }
+
+    /// x^(8n-33) modulo POLY, for use with the PCLMULQDQ instruction.
+    const uint32_t clmulConstant;
+
+    /// x^(8n) modulo POLY, for use with multiplyModPoly().
+    const uint32_t softwareConstant;
+};
+
 } // anonymous namespace
 
 #if __SSE4_2__
@@ -44,6 +137,73 @@ bool Crc32C::haveHardware = haveSse42();
 bool Crc32C::haveHardware = false;
 #endif
 
+#if __PCLMUL__
+bool Crc32C::haveClmul = havePclmul();
+#else
+bool Crc32C::haveClmul = false;
+#endif
+
+/**
+ * Checksum as much of the start of the given memory as possible by splitting
+ * it into three consecutive streams, each of which gets its own chain of
+ * crc32 instructions. The chains are independent, so the processor overlaps
+ * them and the instructions' latency is hidden. The streams' CRCs are then
+ * combined into the accumulated result.
+ *
+ * Must only be called if the machine has the crc32 instruction.
+ *
+ * \param buffer
+ *      A pointer to the memory to be checksummed.
+ * \param bytes
+ *      The number of bytes of memory available to checksum.
+ * \return
+ *      The number of bytes at the start of buffer that were added to the
+ *      checksum: a multiple of 3 * SHORT_STREAM_BYTES. The caller must
+ *      checksum the rest.
+ */
+uint32_t
+Crc32C::updateInterleaved(const void* buffer, uint32_t bytes)
+{
+#if __SSE4_2__
+    static const ZeroShift longStreamShift(LONG_STREAM_BYTES);
+    static const ZeroShift shortStreamShift(SHORT_STREAM_BYTES);
+
+    const uint8_t* start = static_cast<const uint8_t*>(buffer);
+    const uint8_t* p = start;
+    uint32_t remaining = bytes;
+    uint32_t crc = result;
+
+    const uint32_t streamSizes[] = { LONG_STREAM_BYTES, SHORT_STREAM_BYTES };
+    const ZeroShift* shifts[] = { &longStreamShift, &shortStreamShift };
+    for (int i = 0; i < 2; i++) {
+        uint32_t streamBytes = streamSizes[i];
+        while (remaining >= 3 * streamBytes) {
+            const uint64_t* a = reinterpret_cast<const uint64_t*>(p);
+            const uint64_t* b = a + streamBytes / 8;
+            const uint64_t* c = b + streamBytes / 8;
+            uint64_t crcA = crc;
+            uint64_t crcB = 0;
+            uint64_t crcC = 0;
+            for (uint32_t j = 0; j < streamBytes / 8; j++) {
+                crcA = __builtin_ia32_crc32di(crcA, a[j]);
+                crcB = __builtin_ia32_crc32di(crcB, b[j]);
+                crcC = __builtin_ia32_crc32di(crcC, c[j]);
+            }
+            crc = shifts[i]->apply(downCast<uint32_t>(crcA), haveClmul) ^
+                  downCast<uint32_t>(crcB);
+            crc = shifts[i]->apply(crc, haveClmul) ^ downCast<uint32_t>(crcC);
+            p += 3 * streamBytes;
+            remaining -= 3 * streamBytes;
+        }
+    }
+
+    result = crc;
+    return downCast<uint32_t>(p - start);
+#else
+    throw FatalError(HERE, "SSE 4.2 was not enabled at compile-time");
+#endif /* __SSE4_2__ */
+}
+
 } // namespace RAMCloud
 
 namespace Crc32CSlicingBy8 {
@@ -108,6 +108,63 @@ TEST_P(Crc32CTest, accumulatedVaried) {
     }
 }
 
+/**
+ * Fill a buffer with pseudo-random bytes, for checksumming inputs longer
+ * than #input.
+ */
+static void
+fillRandom(uint8_t* buffer, uint32_t length)
+{
+    uint64_t x = 88172645463325252UL;
+    for (uint32_t i = 0; i < length; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        buffer[i] = static_cast<uint8_t>(x);
+    }
+}
+
+TEST_P(Crc32CTest, interleaved) {
+    // Lengths around the points where the hardware implementation switches
+    // between three streams of 8 KB, three of 256 bytes, and one stream.
+    static const uint32_t lengths[] = {
+        767, 768, 769, 3 * 8192 - 1, 3 * 8192, 3 * 8192 + 3 * 256 + 7,
+        2 * 3 * 8192 + 100
+    };
+    static uint8_t data[2 * 3 * 8192 + 200];
+    fillRandom(data, sizeof32(data));
+
+    foreach (uint32_t length, lengths) {
+        for (uint32_t offset = 0; offset < 4; offset += 3) {
+            Crc32C reference(true);
+            reference.update(data + offset, length);
+            EXPECT_EQ(reference.getResult(),
+                      Crc32C(forceSoftware).update(data + offset, length)
+                                           .getResult())
+                << "length " << length << ", offset " << offset;
+        }
+    }
+
+    // Accumulating across calls gives the same result.
+    Crc32C whole(forceSoftware);
+    whole.update(data, 3 * 8192 + 1000);
+    Crc32C pieces(forceSoftware);
+    pieces.update(data, 1000).update(data + 1000, 3 * 8192);
+    EXPECT_EQ(whole.getResult(), pieces.getResult());
+}
+
+TEST_P(Crc32CTest, interleaved_withoutClmul) {
+    static uint8_t data[3 * 8192 + 3 * 256];
+    fillRandom(data, sizeof32(data));
+    uint32_t expected = Crc32C(true).update(data, sizeof32(data)).getResult();
+
+    bool haveClmul = Crc32C::haveClmul;
+    Crc32C::haveClmul = false;
+    EXPECT_EQ(expected,
+              Crc32C(forceSoftware).update(data, sizeof32(data)).getResult());
+    Crc32C::haveClmul = haveClmul;
+}
+
 TEST_P(Crc32CTest, updateFromBuffer) {
     char buf[8192];
 
@@ -126,6 +183,27 @@ TEST_P(Crc32CTest, updateFromBuffer) {
     EXPECT_EQ(c.result, d.result);
 }
 
+TEST_P(Crc32CTest, updateFromBuffer_unevenChunks) {
+    static uint8_t data[3000];
+    fillRandom(data, sizeof32(data));
+    uint32_t expected = Crc32C(true).update(data, sizeof32(data)).getResult();
+
+    // Chunk lengths that leave every possible number of bytes over after
+    // the last whole 8-byte word, including chunks shorter than a word.
+    Buffer buffer;
+    uint32_t offset = 0;
+    for (uint32_t length = 1; offset < sizeof(data); length += 3) {
+        length = std::min(length, sizeof32(data) - offset);
+        buffer.appendExternal(data + offset, length);
+        offset += length;
+    }
+    EXPECT_LT(20U, buffer.getNumberChunks());
+
+    EXPECT_EQ(expected, Crc32C(forceSoftware).update(buffer).getResult());
+    EXPECT_EQ(Crc32C(true).update(data + 5, 2990).getResult(),
+              Crc32C(forceSoftware).update(buffer, 5, 2990).getResult());
+}
+
 TEST_P(Crc32CTest, assignmentOperator) {
     Crc32C a;
     a.update(&a, sizeof(a));
@@ -72,7 +72,7 @@ Dispatch::Dispatch(bool hasDedicatedThread)
     , readyEvents(0)
     , fileInvocationSerial(0)
     , timerMutex("Dispatch::timerMutex")
-    , timers()
+    , timers(Cycles::rdtsc())
     , earliestTriggerTime(0)
     , ownerId(ThreadId::get())
     , mutex("Dispatch::mutex")
@@ -124,8 +124,8 @@ Dispatch::~Dispatch()
     readyFd = -1;
     {
         std::lock_guard<SpinLock> lock(timerMutex);
-        while (timers.size() > 0) {
-            Timer* t = timers.back();
+        Timer* t;
+        while ((t = timers.any()) != NULL) {
             t->stopInternal(lock);
             t->owner = NULL;
         }
@@ -233,8 +233,8 @@ Dispatch::poll()
     }
     if (currentTime >= earliestTriggerTime) {
         std::lock_guard<SpinLock> lock(timerMutex);
-        // Looks like a timer may have triggered. Check all the timers and
-        // invoke any that have triggered.
+        // Looks like a timer may have triggered. Collect all the timers
+        // that have triggered, then invoke them.
         //
         // There are two goals here:
         // * Invoke every timer that has triggered.
@@ -242,44 +242,25 @@ Dispatch::poll()
         //   handler for a timer reschedules the timer in the past, don't
         //   run it a second time; otherwise an infinite loop could result).
         //
-        // The goals are (mostly) met by processing the Timers in reverse
-        // order (highest array element first). If the handler for one
-        // timer A stops another timer B, this could cause a timer C that
-        // was already processed to move into B's slot in the timers
-        // vector, which could cause it to be invoked multiple times.
-        // However, we can't get stuck: i drops by 1 in each iteration
-        // through the loop.
-        for (int i = downCast<int>(timers.size()) - 1 ; i >= 0; --i) {
-            Timer* timer = timers[i];
-            if (timer->triggerTime <= currentTime) {
-                timer->stopInternal(lock);
-                {
-                    // Release the lock while the handler is running,
-                    // to avoid deadlocks.
-                    Unlock<SpinLock> unlock(timerMutex);
-                    timer->handleTimerEvent();
-                }
-                result++;
-                if (i >= downCast<int>(timers.size())) {
-                    // A whole bunch of timers got deleted while this
-                    // handler was running; make sure we keep i inside
-                    // the bounds of the array.
-                    i = downCast<int>(timers.size());
-                }
-            }
-        }
-
-        // Compute a new value for earliestTriggerTime. Can't do this
-        // in the loop above, because one timer handler could delete
-        // another, which can rearrange the list and cause us to miss
-        // a trigger time.
-        earliestTriggerTime = ~(0ull);
-        for (uint32_t i = 0; i < timers.size(); i++) {
-            Timer* timer = timers[i];
-            if (timer->triggerTime < earliestTriggerTime) {
-                earliestTriggerTime = timer->triggerTime;
+        // Both are met because the triggered timers are removed from the
+        // wheel by advance before any handlers run: a timer restarted by a
+        // handler goes back into the wheel, where it won't be found until
+        // the next call to this method. If one handler stops (or deletes)
+        // another timer that has triggered but hasn't run yet, the other
+        // timer is removed from the wheel's list of expired timers, so it
+        // won't run.
+        timers.advance(currentTime);
+        Timer* timer;
+        while ((timer = timers.popExpired()) != NULL) {
+            {
+                // Release the lock while the handler is running,
+                // to avoid deadlocks.
+                Unlock<SpinLock> unlock(timerMutex);
+                timer->handleTimerEvent();
             }
+            result++;
         }
+        earliestTriggerTime = timers.nextCheckTime();
     }
     iteration++;
     return result;
@@ -674,7 +655,7 @@ Dispatch::fdIsReady(int fd)
  *      Dispatch object that will manage this timer.
  */
 Dispatch::Timer::Timer(Dispatch* dispatch)
-    : owner(dispatch), triggerTime(0), slot(-1)
+    : owner(dispatch), triggerTime(0), slot(-1), links()
 {
 }
 
@@ -688,7 +669,7 @@ Dispatch::Timer::Timer(Dispatch* dispatch)
  *      returned by #Cycles::rdtsc).
  */
 Dispatch::Timer::Timer(Dispatch* dispatch, uint64_t cycles)
-        : owner(dispatch), triggerTime(0), slot(-1)
+        : owner(dispatch), triggerTime(0), slot(-1), links()
 {
     start(cycles);
 }
@@ -737,11 +718,11 @@ Dispatch::Timer::start(uint64_t rdtscTime)
     }
     std::lock_guard<SpinLock> lock(owner->timerMutex);
 
-    triggerTime = rdtscTime;
-    if (slot < 0) {
-        slot = downCast<unsigned>(owner->timers.size());
-        owner->timers.push_back(this);
+    if (slot >= 0) {
+        owner->timers.remove(this);
     }
+    triggerTime = rdtscTime;
+    owner->timers.insert(this);
     if (triggerTime < owner->earliestTriggerTime) {
         owner->earliestTriggerTime = triggerTime;
     }
@@ -757,19 +738,10 @@ Dispatch::Timer::start(uint64_t rdtscTime)
 void
 Dispatch::Timer::stopInternal(std::lock_guard<SpinLock>& lock)
 {
-    // Remove this Timer from the timers vector by overwriting its slot
-    // with the timer that used to be the last one in the vector.
-    //
-    // Note: this approach using a vector is reentrant.  It is safe
-    // to delete a Timer while executing a timer callback, which means
-    // that Dispatch::poll is in the middle of scanning the list of all
-    // Timers; the worst that will happen is that the Timer that got
-    // moved may be invoked twice in the current scan (but only if it
-    // ran, rescheduled itself, and its new trigger time has passed).
-    owner->timers[slot] = owner->timers.back();
-    owner->timers[slot]->slot = slot;
-    owner->timers.pop_back();
-    slot = -1;
+    // Note: it is safe to delete a Timer while executing a timer
+    // callback, even if Dispatch::poll has found that this Timer has
+    // triggered but hasn't invoked it yet: it won't be invoked.
+    owner->timers.remove(this);
 }
 
 /**
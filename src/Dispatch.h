@@ -29,6 +29,7 @@
 #include "Tub.h"
 #include "SpinLock.h"
 #include "Syscall.h"
+#include "TimerWheel.h"
 
 namespace RAMCloud {
 
@@ -213,14 +214,18 @@ class Dispatch {
         /// valid if slot >= 0.
         uint64_t triggerTime;
 
-        /// If >= 0 this timer is running, and the value contains the
-        /// index of this Timer in Dispatch::timers. <0 means this
-        /// timer is not currently running, and isn't in Dispatch::timers.
-        /// Among other things, this value allows a timer to be deleted
-        /// without having to scan all the entries in timers.
+        /// If >= 0 this timer is running, and the value identifies its
+        /// location in Dispatch::timers. <0 means this timer is not
+        /// currently running, and isn't in Dispatch::timers. Among other
+        /// things, this value allows a timer to be deleted without having
+        /// to search for it.
         int slot;
 
+        /// Used to link this Timer into Dispatch::timers.
+        IntrusiveListHook links;
+
         friend class Dispatch;
+        friend class TimerWheel<Timer>;
         DISALLOW_COPY_AND_ASSIGN(Timer);
     };
 
@@ -299,13 +304,14 @@ class Dispatch {
     // earliestTriggerTime.
     SpinLock timerMutex;
 
-    // Keeps track of all of the timers that are currently active.  We
-    // don't use an intrusive list here because it isn't reentrant: we need
-    // to add/remove elements while the dispatcher is traversing the list.
-    std::vector<Timer*> timers;
+    // Keeps track of all of the timers that are currently active. Timers
+    // can be started and stopped (including from timer handlers) in
+    // constant time, no matter how many are running.
+    TimerWheel<Timer> timers;
 
     // Optimization for timers: no timer will trigger sooner than this time
-    // (measured in cycles).
+    // (measured in cycles), so there is no need to check #timers before
+    // then.
     uint64_t earliestTriggerTime;
 
     // Unique identifier (as returned by ThreadId::get) for the thread that
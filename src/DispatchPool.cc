@@ -0,0 +1,310 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "DispatchPool.h"
+#include "PerfStats.h"
+#include "ServiceLocator.h"
+#include "ShortMacros.h"
+#include "TransportManager.h"
+#include "WorkerManager.h"
+
+namespace RAMCloud {
+
+__thread DispatchThread* DispatchThread::currentThread = NULL;
+
+/**
+ * Start a DispatchThread and wait until its transports are listening.
+ *
+ * \param serverContext
+ *      The server's main Context; its WorkerManager must already exist.
+ * \param localLocators
+ *      Locators for the transports this thread should listen on. They
+ *      must be able to share their addresses with the server's main
+ *      listening transports (see DispatchPool).
+ * \param index
+ *      Identifies this thread in log messages.
+ *
+ * \throw Exception
+ *      The thread couldn't create its transports.
+ */
+DispatchThread::DispatchThread(Context* serverContext,
+                               const string& localLocators, uint32_t index)
+    : serverContext(serverContext)
+    , localLocators(localLocators)
+    , index(index)
+    , requests()
+    , replies()
+    , deferredRequests()
+    , deferredReplies()
+    , outstandingRpcs(0)
+    , state(STARTING)
+    , startError()
+    , thread()
+{
+    thread.construct(threadMain, this);
+    while (state.load() == STARTING) {
+        std::this_thread::yield();
+    }
+    if (state.load() == FAILED) {
+        thread->join();
+        thread.destroy();
+        throw Exception(HERE, format("Dispatch thread %u couldn't start: %s",
+                                     index, startError.c_str()));
+    }
+}
+
+/**
+ * Stop the thread once replies have been sent for all of the requests it
+ * has received. Must be invoked in the main dispatch thread, which is
+ * polled here until the thread has exited.
+ */
+DispatchThread::~DispatchThread()
+{
+    if (!thread) {
+        return;
+    }
+    state.store(EXITING);
+    while (state.load() != EXITED) {
+        serverContext->dispatch->poll();
+    }
+    thread->join();
+}
+
+/**
+ * Invoked (via WorkerManager::handleRpc) by this thread's transports when
+ * a request has arrived: passes it to the main dispatch thread to be
+ * serviced.
+ *
+ * \param rpc
+ *      The incoming request. Its reply will be sent from this thread.
+ */
+void
+DispatchThread::forwardRequest(Transport::ServerRpc* rpc)
+{
+    assert(currentThread == this);
+    rpc->dispatchThread = this;
+    outstandingRpcs++;
+    if (!deferredRequests.empty() || !requests.put(rpc)) {
+        deferredRequests.push_back(rpc);
+    }
+}
+
+/**
+ * Invoked in the main dispatch thread once an RPC received by this thread
+ * is ready for its reply: hands it back to this thread, which will send
+ * the reply.
+ *
+ * \param rpc
+ *      An RPC previously passed to #forwardRequest.
+ */
+void
+DispatchThread::returnReply(Transport::ServerRpc* rpc)
+{
+    if (!deferredReplies.empty() || !replies.put(rpc)) {
+        deferredReplies.push_back(rpc);
+    }
+}
+
+/**
+ * Top-level method for the thread: creates this thread's Context and
+ * listening transports, then polls its Dispatch until told to exit.
+ *
+ * \param thread
+ *      The DispatchThread this thread runs for.
+ */
+void
+DispatchThread::threadMain(DispatchThread* thread)
+{
+    currentThread = thread;
+    PerfStats::registerStats(&PerfStats::threadStats);
+    try {
+        // The Context has to be created here: a Dispatch belongs to the
+        // thread that creates it.
+        Context context(true);
+        context.transportManager->setSessionTimeout(
+                thread->serverContext->transportManager->getSessionTimeout());
+        context.transportManager->initialize(thread->localLocators.c_str());
+        ReplyPoller replyPoller(context.dispatch, thread);
+        LOG(NOTICE, "Dispatch thread %u listening on %s", thread->index,
+            context.transportManager->getListeningLocatorsString().c_str());
+
+        // The transports pass incoming requests to context.workerManager;
+        // WorkerManager::handleRpc sends them back to #forwardRequest. It
+        // belongs to the server's Context, so it mustn't be deleted along
+        // with this one.
+        context.workerManager = thread->serverContext->workerManager;
+        thread->state.store(RUNNING);
+        try {
+            while (thread->state.load() == RUNNING ||
+                    thread->outstandingRpcs > 0) {
+                context.dispatch->poll();
+            }
+        } catch (...) {
+            context.workerManager = NULL;
+            throw;
+        }
+        context.workerManager = NULL;
+    } catch (std::exception& e) {
+        if (thread->state.load() == STARTING) {
+            thread->startError = e.what();
+            thread->state.store(FAILED);
+            return;
+        }
+        LOG(ERROR, "dispatch thread %u: %s", thread->index, e.what());
+        throw; // will likely call std::terminate()
+    }
+    thread->state.store(EXITED);
+}
+
+/**
+ * Invoked in the main dispatch thread: hands requests that have arrived
+ * on this thread to the WorkerManager.
+ *
+ * \return
+ *      1 if at least one request was found, 0 otherwise.
+ */
+int
+DispatchThread::pollRequests()
+{
+    int foundWork = 0;
+    Transport::ServerRpc* rpc;
+    while ((rpc = requests.get()) != NULL) {
+        serverContext->workerManager->handleRpc(rpc);
+        foundWork = 1;
+    }
+    return foundWork;
+}
+
+/**
+ * Invoked in the main dispatch thread: retries passing back replies that
+ * didn't fit in #replies when they were ready.
+ *
+ * \return
+ *      1 if at least one reply was passed back, 0 otherwise.
+ */
+int
+DispatchThread::flushReplies()
+{
+    int foundWork = 0;
+    while (!deferredReplies.empty() && replies.put(deferredReplies.front())) {
+        deferredReplies.pop_front();
+        foundWork = 1;
+    }
+    return foundWork;
+}
+
+/**
+ * Invoked by this thread's Dispatch: sends replies passed back from the
+ * main dispatch thread and retries deferred requests.
+ */
+int
+DispatchThread::ReplyPoller::poll()
+{
+    int foundWork = 0;
+    while (!owner->deferredRequests.empty() &&
+            owner->requests.put(owner->deferredRequests.front())) {
+        owner->deferredRequests.pop_front();
+        foundWork = 1;
+    }
+    Transport::ServerRpc* rpc;
+    while ((rpc = owner->replies.get()) != NULL) {
+        owner->outstandingRpcs--;
+        rpc->sendReply();
+        foundWork = 1;
+    }
+    return foundWork;
+}
+
+/**
+ * Start the extra dispatch threads for a server.
+ *
+ * \param context
+ *      The server's main Context; its WorkerManager must already exist.
+ * \param localLocators
+ *      The locators the server is listening on (as returned by
+ *      TransportManager::getListeningLocatorsString). Each thread listens
+ *      on those that have the option "reusePort=1"; the others are served
+ *      by the main dispatch thread only.
+ * \param numThreads
+ *      Number of threads to start in addition to the main dispatch thread.
+ *
+ * \throw Exception
+ *      None of the locators can be shared, or a thread couldn't create its
+ *      transports.
+ */
+DispatchPool::DispatchPool(Context* context, const string& localLocators,
+                           uint32_t numThreads)
+    : Dispatch::Poller(context->dispatch, "DispatchPool")
+    , context(context)
+    , threads()
+{
+    string sharedLocators;
+    foreach (const ServiceLocator& locator,
+             ServiceLocator::parseServiceLocators(localLocators)) {
+        if (!locator.getOption<bool>("reusePort", false)) {
+            continue;
+        }
+        if (!sharedLocators.empty())
+            sharedLocators += ";";
+        sharedLocators += locator.getOriginalString();
+    }
+    if (sharedLocators.empty()) {
+        throw Exception(HERE, format("Extra dispatch threads need a locator "
+                "with reusePort=1 to listen on, but '%s' has none",
+                localLocators.c_str()));
+    }
+
+    try {
+        for (uint32_t i = 1; i <= numThreads; i++) {
+            threads.push_back(new DispatchThread(context, sharedLocators, i));
+        }
+    } catch (...) {
+        while (!threads.empty()) {
+            delete threads.back();
+            threads.pop_back();
+        }
+        throw;
+    }
+}
+
+/**
+ * Stop all of the threads; see DispatchThread::~DispatchThread.
+ */
+DispatchPool::~DispatchPool()
+{
+    // Each thread stays in #threads until it has exited, since deleting it
+    // polls the main Dispatch, which invokes our poll method.
+    while (!threads.empty()) {
+        delete threads.back();
+        threads.pop_back();
+    }
+}
+
+/**
+ * Invoked by the main Dispatch: passes requests from the threads to the
+ * WorkerManager and replies back to the threads.
+ */
+int
+DispatchPool::poll()
+{
+    int foundWork = 0;
+    foreach (DispatchThread* thread, threads) {
+        foundWork |= thread->pollRequests();
+        foundWork |= thread->flushReplies();
+    }
+    return foundWork;
+}
+
+} // namespace RAMCloud
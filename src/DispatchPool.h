@@ -0,0 +1,255 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_DISPATCHPOOL_H
+#define RAMCLOUD_DISPATCHPOOL_H
+
+#include <deque>
+#include <thread>
+
+#include "Common.h"
+#include "Atomic.h"
+#include "Dispatch.h"
+#include "Fence.h"
+#include "Transport.h"
+#include "Tub.h"
+
+namespace RAMCloud {
+
+/**
+ * A DispatchThread is an extra dispatch thread on a server: it has its own
+ * Context (and hence its own Dispatch and TransportManager) and its own
+ * listening transports, so that receiving and transmitting packets for the
+ * RPCs arriving on those transports happens off the main dispatch thread.
+ *
+ * Incoming requests are passed to the main dispatch thread, which still
+ * owns the WorkerManager, and replies come back the same way; in both
+ * directions the handoff is a single-producer single-consumer ring, so no
+ * locks are needed. The transports of a DispatchThread are only ever
+ * touched by that thread: the Pollers, Files and Timers they create belong
+ * to its Dispatch, and isDispatchThread() on that Dispatch is true only in
+ * this thread. Everything else on the server (WorkerTimers, service
+ * timers, outgoing RPCs) stays on the main Dispatch.
+ *
+ * DispatchThreads are created and owned by a DispatchPool.
+ */
+class DispatchThread {
+  public:
+    DispatchThread(Context* serverContext, const string& localLocators,
+                   uint32_t index);
+    ~DispatchThread();
+    void forwardRequest(Transport::ServerRpc* rpc);
+    void returnReply(Transport::ServerRpc* rpc);
+
+    /**
+     * Returns the DispatchThread running in the calling thread, or NULL if
+     * the caller isn't one (in particular, in the main dispatch thread).
+     */
+    static DispatchThread*
+    current()
+    {
+        return currentThread;
+    }
+
+    /**
+     * A fixed-size ring of RPCs passed from one thread to exactly one
+     * other. An empty slot is NULL; the producer fills the slot at
+     * #putIndex once it is empty and the consumer empties the slot at
+     * #getIndex once it is full, so each index is only ever touched by one
+     * of the two threads.
+     */
+    class RpcRing {
+      public:
+        RpcRing()
+            : slots()
+            , getIndex(0)
+            , pad()
+            , putIndex(0)
+        {
+            for (uint32_t i = 0; i < SLOTS; i++) {
+                slots[i] = NULL;
+            }
+        }
+
+        /**
+         * Append an RPC to the ring; must only be invoked by the producer.
+         *
+         * \return
+         *      False means the ring was full and the RPC wasn't added.
+         */
+        bool
+        put(Transport::ServerRpc* rpc)
+        {
+            if (slots[putIndex] != NULL) {
+                return false;
+            }
+            // Make sure the consumer sees everything written to the RPC
+            // before it sees the RPC itself.
+            Fence::leave();
+            slots[putIndex] = rpc;
+            putIndex = (putIndex + 1) % SLOTS;
+            return true;
+        }
+
+        /**
+         * Remove the oldest RPC from the ring; must only be invoked by the
+         * consumer.
+         *
+         * \return
+         *      The RPC, or NULL if the ring was empty.
+         */
+        Transport::ServerRpc*
+        get()
+        {
+            Transport::ServerRpc* rpc = slots[getIndex];
+            if (rpc == NULL) {
+                return NULL;
+            }
+            Fence::enter();
+            slots[getIndex] = NULL;
+            getIndex = (getIndex + 1) % SLOTS;
+            return rpc;
+        }
+
+      PRIVATE:
+        /// Number of entries in #slots; when this many RPCs are waiting the
+        /// producer has to hold on to any more itself.
+        static const uint32_t SLOTS = 256;
+
+        /// The RPCs in transit; NULL means the slot is empty.
+        Transport::ServerRpc* volatile slots[SLOTS];
+
+        /// Index in #slots of the next RPC the consumer will take.
+        uint32_t getIndex;
+
+        // Keeps the indexes of the two threads on separate cache lines.
+        char pad[CACHE_LINE_SIZE];
+
+        /// Index in #slots where the producer will put the next RPC.
+        uint32_t putIndex;
+
+        DISALLOW_COPY_AND_ASSIGN(RpcRing);
+    };
+
+  PRIVATE:
+    /**
+     * Runs in this thread's Dispatch: sends the replies that the main
+     * dispatch thread has handed back, and retries requests that didn't
+     * fit in #requests.
+     */
+    class ReplyPoller : public Dispatch::Poller {
+      public:
+        ReplyPoller(Dispatch* dispatch, DispatchThread* owner)
+            : Dispatch::Poller(dispatch, "DispatchThread::ReplyPoller")
+            , owner(owner)
+        {}
+        int poll();
+
+      PRIVATE:
+        /// The thread whose replies this object sends.
+        DispatchThread* owner;
+        DISALLOW_COPY_AND_ASSIGN(ReplyPoller);
+    };
+
+    static void threadMain(DispatchThread* thread);
+    int pollRequests();
+    int flushReplies();
+
+    /// Values for #state.
+    enum { STARTING, RUNNING, FAILED, EXITING, EXITED };
+
+    /// The server's main Context, whose WorkerManager runs the RPCs this
+    /// thread receives.
+    Context* serverContext;
+
+    /// The locators this thread's transports listen on.
+    const string localLocators;
+
+    /// Identifies this thread among those in its DispatchPool (for
+    /// logging).
+    const uint32_t index;
+
+    /// Requests passed from this thread to the main dispatch thread.
+    RpcRing requests;
+
+    /// Serviced RPCs passed from the main dispatch thread back to this
+    /// thread so it can send their replies.
+    RpcRing replies;
+
+    /// Requests that arrived while #requests was full, in arrival order.
+    /// Only accessed by this thread.
+    std::deque<Transport::ServerRpc*> deferredRequests;
+
+    /// Replies that were returned while #replies was full, in order.
+    /// Only accessed by the main dispatch thread.
+    std::deque<Transport::ServerRpc*> deferredReplies;
+
+    /// Number of requests this thread has forwarded whose replies have not
+    /// yet been sent. Only accessed by this thread.
+    uint64_t outstandingRpcs;
+
+    /// One of STARTING, RUNNING, FAILED, EXITING or EXITED: the
+    /// constructor waits for the thread to leave STARTING and the
+    /// destructor sets EXITING then waits for EXITED.
+    Atomic<int> state;
+
+    /// If the thread couldn't start (state FAILED), describes why.
+    string startError;
+
+    /// The thread itself.
+    Tub<std::thread> thread;
+
+    /// The DispatchThread running in the current thread, if any.
+    static __thread DispatchThread* currentThread;
+
+    friend class DispatchPool;
+    DISALLOW_COPY_AND_ASSIGN(DispatchThread);
+};
+
+/**
+ * A DispatchPool runs one or more DispatchThreads alongside the main
+ * dispatch thread of a server, so that network processing for incoming
+ * RPCs is spread over several cores. Each DispatchThread listens on its own
+ * copy of the server's listening transports; this only works for
+ * transports whose driver can share a port between sockets, which at
+ * present means UdpDriver locators with the "reusePort=1" option (the
+ * kernel then spreads clients across the sockets, and all packets from a
+ * given client arrive at the same socket).
+ *
+ * The pool itself is a Poller on the main Dispatch: it collects requests
+ * from the DispatchThreads and hands them to WorkerManager::handleRpc, and
+ * it pushes replies back to the threads that WorkerManager couldn't return
+ * immediately.
+ */
+class DispatchPool : public Dispatch::Poller {
+  public:
+    DispatchPool(Context* context, const string& localLocators,
+                 uint32_t numThreads);
+    ~DispatchPool();
+    int poll();
+
+  PRIVATE:
+    /// The server's main Context.
+    Context* context;
+
+    /// The extra dispatch threads; owned by this object.
+    std::vector<DispatchThread*> threads;
+
+    DISALLOW_COPY_AND_ASSIGN(DispatchPool);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_DISPATCHPOOL_H
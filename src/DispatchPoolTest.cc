@@ -0,0 +1,128 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "DispatchPool.h"
+#include "MockService.h"
+#include "MockWrapper.h"
+#include "TransportManager.h"
+#include "WorkerManager.h"
+
+namespace RAMCloud {
+
+class DispatchPoolTest : public ::testing::Test {
+  public:
+    Context context;
+    Tub<WorkerManager> manager;
+    MockService service;
+    TestLog::Enable logEnabler;
+
+    DispatchPoolTest()
+        : context()
+        , manager()
+        , service()
+        , logEnabler()
+    {
+        manager.construct(&context, 2);
+        context.workerManager = manager.get();
+        context.services[WireFormat::BACKUP_SERVICE] = &service;
+    }
+
+    ~DispatchPoolTest()
+    {
+        manager.destroy();
+        context.workerManager = NULL;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(DispatchPoolTest);
+};
+
+TEST_F(DispatchPoolTest, RpcRing) {
+    DispatchThread::RpcRing ring;
+    EXPECT_TRUE(ring.get() == NULL);
+
+    Transport::ServerRpc* rpcs[DispatchThread::RpcRing::SLOTS];
+    for (uint32_t i = 0; i < DispatchThread::RpcRing::SLOTS; i++) {
+        rpcs[i] = reinterpret_cast<Transport::ServerRpc*>(
+                static_cast<uintptr_t>(8 * (i + 1)));
+        EXPECT_TRUE(ring.put(rpcs[i]));
+    }
+    EXPECT_FALSE(ring.put(rpcs[0]));
+
+    EXPECT_EQ(rpcs[0], ring.get());
+    EXPECT_TRUE(ring.put(rpcs[0]));
+    for (uint32_t i = 1; i < DispatchThread::RpcRing::SLOTS; i++) {
+        EXPECT_EQ(rpcs[i], ring.get());
+    }
+    EXPECT_EQ(rpcs[0], ring.get());
+    EXPECT_TRUE(ring.get() == NULL);
+}
+
+TEST_F(DispatchPoolTest, constructor_noSharedLocator) {
+    string message;
+    try {
+        DispatchPool pool(&context, "basic+udp:host=localhost,port=11141", 1);
+    } catch (Exception& e) {
+        message = e.message;
+    }
+    EXPECT_EQ("Extra dispatch threads need a locator with reusePort=1 to "
+              "listen on, but 'basic+udp:host=localhost,port=11141' has none",
+              message);
+}
+
+TEST_F(DispatchPoolTest, constructor_threadCantListen) {
+    // The port is taken by a socket that doesn't allow sharing.
+    context.transportManager->initialize(
+            "basic+udp:host=localhost,port=11142");
+    string message;
+    try {
+        DispatchPool pool(&context,
+                "tcp:host=localhost,port=11143;"
+                "basic+udp:host=localhost,port=11142,reusePort=1", 2);
+    } catch (Exception& e) {
+        message = e.message;
+    }
+    EXPECT_TRUE(TestUtil::matchesPosixRegex(
+            "Dispatch thread 1 couldn't start: .*UdpDriver couldn't bind",
+            message));
+}
+
+TEST_F(DispatchPoolTest, requestAndReply) {
+    DispatchPool pool(&context,
+            "basic+udp:host=localhost,port=11144,reusePort=1", 2);
+    EXPECT_EQ(2u, pool.threads.size());
+
+    Context clientContext;
+    Transport::SessionRef session = clientContext.transportManager->
+            getSession("basic+udp:host=localhost,port=11144");
+    MockWrapper rpc;
+    rpc.request.emplaceAppend<uint32_t>(0x10000);
+    rpc.request.emplaceAppend<uint32_t>(3);
+    rpc.request.emplaceAppend<uint32_t>(4);
+    session->sendRequest(&rpc.request, &rpc.response, &rpc);
+
+    // Both dispatchers are polled from here; the request is received and
+    // the reply sent by one of the pool's threads.
+    for (int i = 0; i < 1000 && rpc.completedCount == 0; i++) {
+        context.dispatch->poll();
+        clientContext.dispatch->poll();
+        usleep(1000);
+    }
+    EXPECT_STREQ("completed: 1, failed: 0", rpc.getState());
+    EXPECT_EQ("rpc: 0x10000 3 4", service.log);
+    EXPECT_EQ("0x10001 4 5", TestUtil::toString(&rpc.response));
+}
+
+}  // namespace RAMCloud
@@ -13,6 +13,8 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <immintrin.h>
+
 #include "Common.h"
 #include "HashTable.h"
 
@@ -152,8 +154,11 @@ HashTable::Entry::pack(uint64_t hash, bool chain, uint64_t ptr)
  * Construct an empty set of candidates.
  */
 HashTable::Candidates::Candidates()
-    : bucket(NULL)
+    : hashTable(NULL)
+    , bucket(NULL)
+    , oldBucket(NULL)
     , index()
+    , matches(0)
     , secondaryHash()
 {
 }
@@ -162,13 +167,27 @@ HashTable::Candidates::Candidates()
  * Initialize a candidate object for searching the given bucket in the hash
  * table. This will scan the bucket for the first reference that matches the
  * given secondaryHash.
+ *
+ * \param hashTable
+ *      The table the buckets belong to.
+ * \param cl
+ *      The bucket to search.
+ * \param oldCl
+ *      If the table is being resized, the bucket in the old bucket array to
+ *      search after \a cl. Otherwise NULL.
+ * \param secondaryHash
+ *      The secondary hash bits of the key being looked up.
  */
 void
-HashTable::Candidates::init(CacheLine* cl, uint64_t secondaryHash)
+HashTable::Candidates::init(HashTable* hashTable, CacheLine* cl,
+                            CacheLine* oldCl, uint64_t secondaryHash)
 {
+    this->hashTable = hashTable;
     bucket = cl;
+    oldBucket = oldCl;
     index = -1;
     this->secondaryHash = secondaryHash;
+    matches = matchEntries(bucket, secondaryHash);
     next();
 }
 
@@ -184,6 +203,25 @@ HashTable::Candidates::getReference()
     return bucket->entries[index].getReference();
 }
 
+/**
+ * Obtain the reference for the candidate currently pointed to by the
+ * iterator, tolerating concurrent modification of the table. Unlike
+ * #getReference, this may be used by a reader that doesn't hold the lock
+ * serializing updates to the bucket (and later checks that no update took
+ * place): if the entry was cleared or turned into a chain pointer after
+ * the iterator matched it, 0 is returned.
+ */
+uint64_t
+HashTable::Candidates::peekReference()
+{
+    if (bucket == NULL)
+        return 0;
+    Entry entry = bucket->entries[index];
+    if (entry.isAvailable() || entry.getChainPointer() != NULL)
+        return 0;
+    return entry.getReference();
+}
+
 /**
  * Replace the reference currently pointed to by the iterator. This is
  * used to change what a key refers to in the table.
@@ -202,8 +240,10 @@ HashTable::Candidates::setReference(uint64_t reference)
 void
 HashTable::Candidates::remove()
 {
-    if (bucket != NULL)
+    if (bucket != NULL) {
         bucket->entries[index].clear();
+        hashTable->numEntries--;
+    }
 }
 
 /**
@@ -213,32 +253,36 @@ void
 HashTable::Candidates::next()
 {
     while (true) {
-        // Not found in the cache line, see if there's a chain to
-        // another cache line.
-        if (index == ENTRIES_PER_CACHE_LINE && bucket != NULL) {
-            Entry* entry = &bucket->entries[ENTRIES_PER_CACHE_LINE - 1];
-            bucket = entry->getChainPointer();
-            index = -1;
+        // #matches was computed for the whole cache line when we entered
+        // it, so finding the next candidate is just a matter of finding the
+        // next set bit.
+        if (matches != 0) {
+            index = BitOps::findFirstSet(matches) - 1;
+            matches &= matches - 1;
+            return;
         }
 
+        // Already past the end of the chain (or never started one).
         if (bucket == NULL)
             return;
 
-        // Resume in the current cache line.
-        index++;
-        Entry* candidate = &bucket->entries[index];
-        while (index < ENTRIES_PER_CACHE_LINE) {
-            if (candidate->hashMatches(secondaryHash)) {
-                // The hash within the hash table entry matches, so with
-                // high probability this is the pointer we're looking
-                // for. We'll report this index to the user of this
-                // class in the next getReference() call so that they
-                // can verify the match.
-                return;
-            }
-            candidate++;
-            index++;
+        // Not found in the cache line, see if there's a chain to
+        // another cache line.
+        Entry* entry = &bucket->entries[ENTRIES_PER_CACHE_LINE - 1];
+        bucket = entry->getChainPointer();
+
+        // If a resize is in progress, entries that haven't been rehashed yet
+        // are still in the old bucket array; search there next.
+        if (bucket == NULL) {
+            bucket = oldBucket;
+            oldBucket = NULL;
+        }
+
+        if (bucket == NULL) {
+            index = ENTRIES_PER_CACHE_LINE;
+            return;
         }
+        matches = matchEntries(bucket, secondaryHash);
     }
 }
 
@@ -257,12 +301,25 @@ HashTable::Candidates::isDone()
  * \param[in] numBuckets
  *      The number of buckets in the new hash table. This should be a power
  *      of two.
+ * \param[in] keyHashFunction
+ *      Function that returns the key hash of the element named by a
+ *      reference. Only needed if the table is going to be resized.
+ * \param[in] keyHashCookie
+ *      Opaque argument passed to \a keyHashFunction.
  * \throw Exception
  *      An exception is thrown if numBuckets is 0.
  */
-HashTable::HashTable(uint64_t numBuckets)
+HashTable::HashTable(uint64_t numBuckets,
+                     KeyHashFunction keyHashFunction,
+                     void* keyHashCookie)
     : numBuckets(BitOps::powerOfTwoLessOrEqual(numBuckets))
     , buckets(this->numBuckets * sizeof(CacheLine))
+    , numOldBuckets(0)
+    , oldBuckets()
+    , spareBuckets()
+    , keyHashFunction(keyHashFunction)
+    , keyHashCookie(keyHashCookie)
+    , numEntries(0)
 {
     if (numBuckets != this->numBuckets) {
         RAMCLOUD_LOG(DEBUG,
@@ -279,11 +336,28 @@ HashTable::HashTable(uint64_t numBuckets)
  * Destructor for HashTable.
  */
 HashTable::~HashTable()
+{
+    freeOverflowLines(buckets.get(), numBuckets);
+    if (oldBuckets)
+        freeOverflowLines(oldBuckets->get(), numOldBuckets);
+}
+
+/**
+ * Free all of the overflow cache lines chained onto the buckets of a bucket
+ * array. The chain pointers in the array itself are cleared.
+ *
+ * \param bucketArray
+ *      The first bucket of the array.
+ * \param numBuckets
+ *      Number of buckets in the array.
+ */
+void
+HashTable::freeOverflowLines(CacheLine* bucketArray, uint64_t numBuckets)
 {
     uint32_t lastEntryIndex = ENTRIES_PER_CACHE_LINE - 1;
 
     for (uint64_t i = 0; i < numBuckets; ++i) {
-        CacheLine* currBucket = &buckets.get()[i];
+        CacheLine* currBucket = &bucketArray[i];
 
         // Skip the first bucket and break the chain
         Entry* last = &currBucket->entries[lastEntryIndex];
@@ -320,7 +394,12 @@ HashTable::lookup(KeyHash keyHash, Candidates& candidates)
     // caller as it examines possible candidates.
     uint64_t secondaryHash;
     CacheLine *bucket = findBucket(keyHash, &secondaryHash);
-    candidates.init(bucket, secondaryHash);
+    CacheLine *oldBucket = NULL;
+    if (oldBuckets) {
+        oldBucket = &oldBuckets->get()[
+                findBucketIndex(numOldBuckets, keyHash, &secondaryHash)];
+    }
+    candidates.init(this, bucket, oldBucket, secondaryHash);
 }
 
 /**
@@ -330,6 +409,9 @@ HashTable::lookup(KeyHash keyHash, Candidates& candidates)
  * exist (in other words, it will not replace a key). It is up to the caller
  * to ensure that the key was first removed, if necessary.
  *
+ * If the table is being resized, the element is always inserted into the new
+ * bucket array.
+ *
  * \param[in] keyHash
  *      Hash of the key naming the element to insert.
  * \param[in] reference
@@ -339,8 +421,28 @@ void
 HashTable::insert(KeyHash keyHash, uint64_t reference)
 {
     uint64_t secondaryHash;
+    uint64_t bucketIndex = findBucketIndex(numBuckets, keyHash, &secondaryHash);
+    insertIntoBucket(bucketIndex, secondaryHash, reference);
+    numEntries++;
+}
+
+/**
+ * Store a reference in the first free entry of a bucket of #buckets,
+ * allocating an overflow cache line if the bucket is full.
+ *
+ * \param bucketIndex
+ *      Index of the bucket in #buckets.
+ * \param secondaryHash
+ *      The secondary hash bits of the element's key.
+ * \param reference
+ *      Reference to the element.
+ */
+void
+HashTable::insertIntoBucket(uint64_t bucketIndex, uint64_t secondaryHash,
+                            uint64_t reference)
+{
     int overflowBuckets = 0;
-    CacheLine* bucket = findBucket(keyHash, &secondaryHash);
+    CacheLine* bucket = &buckets.get()[bucketIndex];
     while (true) {
         Entry* entry = bucket->entries;
         for (size_t i = 0; i < ENTRIES_PER_CACHE_LINE; i++) {
@@ -359,14 +461,17 @@ HashTable::insert(KeyHash keyHash, uint64_t reference)
         if (bucket == NULL) {
             // no empty space found, allocate a new cache line
             RAMCLOUD_CLOG(NOTICE, "Allocating overflow bucket %d for index %lu",
-                    overflowBuckets,
-                    findBucketIndex(numBuckets, keyHash, &secondaryHash));
+                    overflowBuckets, bucketIndex);
             void *buf = Memory::xmemalign(HERE, sizeof(CacheLine),
                                           sizeof(CacheLine));
             bucket = static_cast<CacheLine *>(buf);
             bucket->entries[0] = *last;
             for (size_t i = 1; i < ENTRIES_PER_CACHE_LINE; i++)
                 bucket->entries[i].clear();
+            // Lock-free readers (see Candidates::peekReference) may follow
+            // the chain pointer as soon as it is set, so the new cache line
+            // must be initialized first.
+            std::atomic_thread_fence(std::memory_order_release);
             last->setChainPointer(bucket);
         }
     }
@@ -381,6 +486,8 @@ HashTable::insert(KeyHash keyHash, uint64_t reference)
  *      An opaque parameter to pass to the callback function.
  * \param bucket
  *      An index into the HashTable's buckets.  Must be < #numBuckets.
+ *      If the table is being resized, elements that belong in this bucket
+ *      but still live in the old bucket array are included.
  * \return
  *      The total number of callbacks fired (i.e. the number of elements
  *      in the HashTable).
@@ -389,14 +496,58 @@ uint64_t
 HashTable::forEachInBucket(void (*callback)(uint64_t, void *),
                            void *cookie,
                            uint64_t bucket)
+{
+    uint64_t numCalls = forEachInChain(&buckets.get()[bucket],
+                                       callback, cookie, ALL_BUCKETS);
+    if (oldBuckets) {
+        // When growing, exactly one old bucket feeds this bucket; when
+        // shrinking, every old bucket congruent to it modulo numBuckets does.
+        for (uint64_t i = bucket & (numOldBuckets - 1); i < numOldBuckets;
+                i += numBuckets) {
+            numCalls += forEachInChain(&oldBuckets->get()[i],
+                                       callback, cookie, bucket);
+        }
+    }
+    return numCalls;
+}
+
+/**
+ * Apply the given callback function to each element stored in a chain of
+ * cache lines.
+ *
+ * \param cl
+ *      The first cache line of the chain.
+ * \param callback
+ *      The callback to fire on each element.
+ * \param cookie
+ *      An opaque parameter to pass to the callback function.
+ * \param onlyBucket
+ *      If not ALL_BUCKETS, only elements whose key maps to this bucket of
+ *      #buckets are visited (used for chains in #oldBuckets).
+ * \return
+ *      The number of callbacks fired.
+ */
+uint64_t
+HashTable::forEachInChain(CacheLine* cl,
+                          void (*callback)(uint64_t, void *),
+                          void *cookie,
+                          uint64_t onlyBucket)
 {
     uint64_t numCalls = 0;
-    CacheLine *cl = &buckets.get()[bucket];
     while (1) {
         for (uint32_t j = 0; j < ENTRIES_PER_CACHE_LINE; j++) {
             Entry *e = &cl->entries[j];
             if (!e->isAvailable() && e->getChainPointer() == NULL) {
-                callback(e->getReference(), cookie);
+                uint64_t reference = e->getReference();
+                if (onlyBucket != ALL_BUCKETS) {
+                    uint64_t unused;
+                    KeyHash keyHash = keyHashFunction(reference, keyHashCookie);
+                    if (findBucketIndex(numBuckets, keyHash, &unused) !=
+                            onlyBucket) {
+                        continue;
+                    }
+                }
+                callback(reference, cookie);
                 numCalls++;
             }
         }
@@ -461,7 +612,8 @@ HashTable::entriesPerCacheLine()
 }
 
 /**
- * Returns the number of buckets allocated to the table.
+ * Returns the number of buckets allocated to the table. While the table is
+ * being resized, this is the size of the new bucket array.
  */
 uint64_t
 HashTable::getNumBuckets() const
@@ -469,6 +621,323 @@ HashTable::getNumBuckets() const
     return numBuckets;
 }
 
+/**
+ * Compare every entry of a cache line against a secondary hash, one entry
+ * at a time. This is the fallback for machines without SSE4.2.
+ *
+ * \param cl
+ *      The cache line to search.
+ * \param secondaryHash
+ *      The secondary hash bits of the key being looked up.
+ * \return
+ *      A mask with bit i set if entry i of \a cl holds a reference whose
+ *      secondary hash is \a secondaryHash.
+ */
+uint32_t
+HashTable::matchEntriesScalar(const CacheLine* cl, uint64_t secondaryHash)
+{
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < ENTRIES_PER_CACHE_LINE; i++) {
+        if (cl->entries[i].hashMatches(secondaryHash))
+            mask |= 1u << i;
+    }
+    return mask;
+}
+
+/*
+ * The vectorized versions below compare packed Entry words directly (see
+ * Entry::pack): a word holds a matching reference if its top 17 bits are the
+ * secondary hash followed by a clear chain bit, and it isn't 0 (an empty
+ * entry, which would otherwise match a secondary hash of 0).
+ */
+
+/// Bits of a packed Entry holding the secondary hash and the chain flag.
+static const uint64_t HASH_AND_CHAIN_BITS = 0xffff800000000000UL;
+
+/**
+ * Same as #matchEntriesScalar, but compares two entries per instruction using
+ * SSE4.2 (64-bit compares came with SSE4.1). Only call this if
+ * #isMatchImplementationSupported says so.
+ */
+__attribute__((target("sse4.2")))
+uint32_t
+HashTable::matchEntriesSse42(const CacheLine* cl, uint64_t secondaryHash)
+{
+    static_assert(ENTRIES_PER_CACHE_LINE == 8,
+                  "matchEntriesSse42 assumes 8 entries per cache line");
+    const __m128i* words = reinterpret_cast<const __m128i*>(cl->entries);
+    __m128i bits = _mm_set1_epi64x(HASH_AND_CHAIN_BITS);
+    __m128i wanted = _mm_set1_epi64x(secondaryHash << 48);
+    __m128i zero = _mm_setzero_si128();
+
+    uint32_t mask = 0;
+    for (int i = 0; i < 4; i++) {
+        __m128i v = _mm_loadu_si128(&words[i]);
+        __m128i hit = _mm_cmpeq_epi64(_mm_and_si128(v, bits), wanted);
+        __m128i empty = _mm_cmpeq_epi64(v, zero);
+        hit = _mm_andnot_si128(empty, hit);
+        mask |= downCast<uint32_t>(
+                _mm_movemask_pd(_mm_castsi128_pd(hit))) << (2 * i);
+    }
+    return mask;
+}
+
+/**
+ * Same as #matchEntriesScalar, but compares four entries per instruction
+ * using AVX2. Only call this if #isMatchImplementationSupported says so.
+ */
+__attribute__((target("avx2")))
+uint32_t
+HashTable::matchEntriesAvx2(const CacheLine* cl, uint64_t secondaryHash)
+{
+    static_assert(ENTRIES_PER_CACHE_LINE == 8,
+                  "matchEntriesAvx2 assumes 8 entries per cache line");
+    const __m256i* words = reinterpret_cast<const __m256i*>(cl->entries);
+    __m256i bits = _mm256_set1_epi64x(HASH_AND_CHAIN_BITS);
+    __m256i wanted = _mm256_set1_epi64x(secondaryHash << 48);
+    __m256i zero = _mm256_setzero_si256();
+
+    uint32_t mask = 0;
+    for (int i = 0; i < 2; i++) {
+        __m256i v = _mm256_loadu_si256(&words[i]);
+        __m256i hit = _mm256_cmpeq_epi64(_mm256_and_si256(v, bits), wanted);
+        __m256i empty = _mm256_cmpeq_epi64(v, zero);
+        hit = _mm256_andnot_si256(empty, hit);
+        mask |= downCast<uint32_t>(
+                _mm256_movemask_pd(_mm256_castsi256_pd(hit))) << (4 * i);
+    }
+    return mask;
+}
+
+/**
+ * Return whether this machine can run a given MatchImplementation.
+ */
+bool
+HashTable::isMatchImplementationSupported(MatchImplementation implementation)
+{
+    switch (implementation) {
+    case MATCH_SCALAR:
+        return true;
+    case MATCH_SSE42:
+        return __builtin_cpu_supports("sse4.2");
+    case MATCH_AVX2:
+        return __builtin_cpu_supports("avx2");
+    }
+    return false;
+}
+
+namespace {
+/**
+ * Pick the fastest way of matching secondary hashes that this machine
+ * supports. Used to initialize HashTable::matchEntries.
+ */
+HashTable::MatchImplementation
+fastestMatchImplementation()
+{
+    __builtin_cpu_init();
+    HashTable::MatchImplementation implementations[] = {
+        HashTable::MATCH_AVX2, HashTable::MATCH_SSE42
+    };
+    for (HashTable::MatchImplementation implementation : implementations) {
+        if (HashTable::setMatchImplementation(implementation))
+            return implementation;
+    }
+    return HashTable::MATCH_SCALAR;
+}
+} // anonymous namespace
+
+// matchEntries starts out (statically) as the scalar version, so lookups
+// work even during static initialization; it is upgraded once the CPU has
+// been probed.
+HashTable::MatchFunction HashTable::matchEntries =
+        HashTable::matchEntriesScalar;
+static HashTable::MatchImplementation initialMatchImplementation
+        __attribute__((unused)) = fastestMatchImplementation();
+
+/**
+ * Choose how lookups compare secondary hashes. By default the fastest
+ * implementation the machine supports is used; this exists mostly so that
+ * tests and benchmarks can compare them. It affects all HashTables and must
+ * not be called while any HashTable is in use.
+ *
+ * \param implementation
+ *      The implementation to use from now on.
+ * \return
+ *      False if this machine doesn't support \a implementation, in which case
+ *      nothing changed. True otherwise.
+ */
+bool
+HashTable::setMatchImplementation(MatchImplementation implementation)
+{
+    if (!isMatchImplementationSupported(implementation))
+        return false;
+    switch (implementation) {
+    case MATCH_SCALAR:
+        matchEntries = matchEntriesScalar;
+        break;
+    case MATCH_SSE42:
+        matchEntries = matchEntriesSse42;
+        break;
+    case MATCH_AVX2:
+        matchEntries = matchEntriesAvx2;
+        break;
+    }
+    return true;
+}
+
+/**
+ * Return the MatchImplementation currently used by lookups.
+ */
+HashTable::MatchImplementation
+HashTable::getMatchImplementation()
+{
+    if (matchEntries == matchEntriesAvx2)
+        return MATCH_AVX2;
+    if (matchEntries == matchEntriesSse42)
+        return MATCH_SSE42;
+    return MATCH_SCALAR;
+}
+
+/**
+ * Returns the number of references currently stored in the table.
+ */
+uint64_t
+HashTable::getNumEntries() const
+{
+    return numEntries.load(std::memory_order_relaxed);
+}
+
+/**
+ * Allocate the bucket array for a subsequent call to #startResize. This
+ * is split from #startResize because allocating (and zeroing) a large
+ * array is slow and doesn't need exclusive access to the table.
+ *
+ * \param newNumBuckets
+ *      Number of buckets the table should have once resized. It is rounded
+ *      down to a power of two.
+ * \throw Exception
+ *      An exception is thrown if the table has no KeyHashFunction, or if
+ *      newNumBuckets is 0.
+ */
+void
+HashTable::prepareResize(uint64_t newNumBuckets)
+{
+    if (keyHashFunction == NULL)
+        throw Exception(HERE, "HashTable can't be resized without a "
+                        "KeyHashFunction");
+    newNumBuckets = BitOps::powerOfTwoLessOrEqual(newNumBuckets);
+    if (newNumBuckets == 0)
+        throw Exception(HERE, "HashTable numBuckets == 0?!");
+    spareBuckets.construct(newNumBuckets * sizeof(CacheLine));
+}
+
+/**
+ * Put the bucket array allocated by #prepareResize into service. After this
+ * returns, new elements are inserted into the new array, and lookups search
+ * both arrays until every bucket of the old array has been passed to
+ * #rehashBucket and #finishResize has been called.
+ *
+ * The caller must ensure that no other thread is accessing the table while
+ * this method runs.
+ *
+ * \throw Exception
+ *      An exception is thrown if a resize is already in progress or
+ *      #prepareResize wasn't called.
+ */
+void
+HashTable::startResize()
+{
+    if (oldBuckets)
+        throw Exception(HERE, "HashTable is already being resized");
+    if (!spareBuckets)
+        throw Exception(HERE, "HashTable::prepareResize wasn't called");
+
+    oldBuckets.construct(0);
+    oldBuckets->swap(buckets);
+    buckets.swap(*spareBuckets);
+    spareBuckets.destroy();
+    numOldBuckets = numBuckets;
+    numBuckets = buckets.length / sizeof(CacheLine);
+}
+
+/**
+ * Move every element in one bucket of the old bucket array into the new
+ * bucket array. Overflow cache lines of the old bucket aren't freed until
+ * #finishResize, so that iterators running concurrently never touch freed
+ * memory.
+ *
+ * The caller must hold whatever lock serializes access to the elements of
+ * this bucket; since bucket counts are powers of two, those are the same
+ * elements as in the new buckets they move to, provided both arrays have
+ * at least as many buckets as the caller has locks.
+ *
+ * \param oldBucket
+ *      Index of the bucket in the old array. Must be < #getNumOldBuckets().
+ * \return
+ *      The number of elements moved.
+ */
+uint64_t
+HashTable::rehashBucket(uint64_t oldBucket)
+{
+    assert(oldBuckets && oldBucket < numOldBuckets);
+
+    uint64_t numMoved = 0;
+    CacheLine* cl = &oldBuckets->get()[oldBucket];
+    while (cl != NULL) {
+        for (uint32_t i = 0; i < ENTRIES_PER_CACHE_LINE; i++) {
+            Entry* e = &cl->entries[i];
+            if (e->isAvailable() || e->getChainPointer() != NULL)
+                continue;
+
+            uint64_t reference = e->getReference();
+            KeyHash keyHash = keyHashFunction(reference, keyHashCookie);
+            uint64_t secondaryHash;
+            uint64_t bucketIndex = findBucketIndex(numBuckets, keyHash,
+                                                   &secondaryHash);
+            insertIntoBucket(bucketIndex, secondaryHash, reference);
+            e->clear();
+            numMoved++;
+        }
+        cl = cl->entries[ENTRIES_PER_CACHE_LINE - 1].getChainPointer();
+    }
+    return numMoved;
+}
+
+/**
+ * Complete a resize by releasing the old bucket array. Every bucket of the
+ * old array must already have been passed to #rehashBucket.
+ *
+ * The caller must ensure that no other thread is accessing the table while
+ * this method runs.
+ */
+void
+HashTable::finishResize()
+{
+    assert(oldBuckets);
+    freeOverflowLines(oldBuckets->get(), numOldBuckets);
+    oldBuckets.destroy();
+    numOldBuckets = 0;
+}
+
+/**
+ * Returns true if #startResize has been called but #finishResize hasn't.
+ */
+bool
+HashTable::isResizing() const
+{
+    return oldBuckets;
+}
+
+/**
+ * Returns the number of buckets in the array being drained by a resize, or
+ * 0 if the table isn't being resized.
+ */
+uint64_t
+HashTable::getNumOldBuckets() const
+{
+    return numOldBuckets;
+}
+
 /**
  * Find the bucket index corresponding to a particular key.
  * This also calculates the secondary hash bits used to disambiguate entries
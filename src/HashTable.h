@@ -16,6 +16,8 @@
 #ifndef RAMCLOUD_HASHTABLE_H
 #define RAMCLOUD_HASHTABLE_H
 
+#include <atomic>
+
 #include "Common.h"
 #include "BitOps.h"
 #include "CycleCounter.h"
@@ -23,6 +25,7 @@
 #include "Memory.h"
 #include "MurmurHash3.h"
 #include "Key.h"
+#include "Tub.h"
 
 namespace RAMCloud {
 
@@ -39,6 +42,15 @@ namespace RAMCloud {
  *
  * This code is not thread-safe.
  *
+ * The table can be resized while it is in use (see #prepareResize(),
+ * #startResize(), #rehashBucket(), and #finishResize()). During a resize the
+ * table keeps two bucket arrays: new entries are always inserted into the new
+ * array, lookups search the new array and then the old one, and entries are
+ * moved from the old array to the new one a bucket at a time. Since entries
+ * only keep 16 bits of their key hash, the table must be given a
+ * KeyHashFunction that can recompute the full hash from a reference in order
+ * to be resized.
+ *
  * \section impl Implementation Details
  *
  * The HashTable is an array of #buckets, indexed by the hash of the two
@@ -100,6 +112,8 @@ class HashTable {
          *
          * Because the exact format is subject to change, you should always set
          * this using #pack() and access its contained fields using #unpack().
+         * The vectorized HashTable::matchEntries implementations are the one
+         * exception: they compare the packed words directly.
          */
         uint64_t value;
 
@@ -194,20 +208,34 @@ class HashTable {
       public:
         Candidates();
         uint64_t getReference();
+        uint64_t peekReference();
         void setReference(uint64_t reference);
         void remove();
         void next();
         bool isDone();
 
       PRIVATE:
-        void init(CacheLine* cl, uint64_t secondaryHash);
+        void init(HashTable* hashTable, CacheLine* cl, CacheLine* oldCl,
+                  uint64_t secondaryHash);
+
+        /// The table that #bucket belongs to.
+        HashTable* hashTable;
 
         /// Pointer to the hash table bucket we're currently iterating over.
         CacheLine* bucket;
 
+        /// If the table is being resized, the bucket in the old bucket array
+        /// that may still hold entries for the key. It is iterated over once
+        /// the chain starting at #bucket has been exhausted. NULL otherwise.
+        CacheLine* oldBucket;
+
         /// Index into bucket we're currently iterating over.
         uint32_t index;
 
+        /// Bit i is set if entry i of #bucket matches #secondaryHash and
+        /// hasn't been returned yet (see HashTable::matchEntries).
+        uint32_t matches;
+
         /// This iterator only returns references to entries that share this
         /// secondaryHash. All others cannot possibly be matches. This helps
         /// to reduce the number of candidates whose keys are extracted from
@@ -217,7 +245,17 @@ class HashTable {
         friend class HashTable;
     };
 
-    explicit HashTable(uint64_t numBuckets);
+    /**
+     * Function used while resizing to compute the full key hash of the
+     * element named by a reference. Buckets only keep the secondary hash
+     * bits, so the table can't tell on its own where an entry belongs in a
+     * bucket array of a different size.
+     */
+    typedef KeyHash (*KeyHashFunction)(uint64_t reference, void* cookie);
+
+    explicit HashTable(uint64_t numBuckets,
+                       KeyHashFunction keyHashFunction = NULL,
+                       void* keyHashCookie = NULL);
     ~HashTable();
     void lookup(KeyHash keyHash, Candidates& candidates);
     void insert(KeyHash keyHash, uint64_t reference);
@@ -229,10 +267,33 @@ class HashTable {
     static uint32_t bytesPerCacheLine();
     static uint32_t entriesPerCacheLine();
     uint64_t getNumBuckets() const;
+    uint64_t getNumEntries() const;
     static uint64_t findBucketIndex(uint64_t numBuckets,
                                     KeyHash keyHash,
                                     uint64_t *secondaryHash);
 
+    /**
+     * Ways of comparing all the entries of a cache line against a secondary
+     * hash at once. See #setMatchImplementation().
+     */
+    enum MatchImplementation {
+        /// Compare one entry at a time; works everywhere.
+        MATCH_SCALAR,
+        /// Compare two entries per SSE4.2 instruction.
+        MATCH_SSE42,
+        /// Compare four entries per AVX2 instruction.
+        MATCH_AVX2,
+    };
+    static bool setMatchImplementation(MatchImplementation implementation);
+    static MatchImplementation getMatchImplementation();
+
+    void prepareResize(uint64_t newNumBuckets);
+    void startResize();
+    uint64_t rehashBucket(uint64_t oldBucket);
+    void finishResize();
+    bool isResizing() const;
+    uint64_t getNumOldBuckets() const;
+
   PRIVATE:
 
     // forward declarations
@@ -242,9 +303,43 @@ class HashTable {
     CacheLine * findBucket(KeyHash keyHash, uint64_t *secondaryHash);
 
     /**
-     * The number of buckets allocated to the table.
+     * Signature of the functions that compare every entry in a cache line
+     * against a secondary hash. The result has bit i set if entry i holds a
+     * reference (not a chain pointer, not empty) with that secondary hash.
+     */
+    typedef uint32_t (*MatchFunction)(const CacheLine* cl,
+                                      uint64_t secondaryHash);
+    static uint32_t matchEntriesScalar(const CacheLine* cl,
+                                       uint64_t secondaryHash);
+    static uint32_t matchEntriesSse42(const CacheLine* cl,
+                                      uint64_t secondaryHash);
+    static uint32_t matchEntriesAvx2(const CacheLine* cl,
+                                     uint64_t secondaryHash);
+    static bool isMatchImplementationSupported(
+            MatchImplementation implementation);
+
+    /// The fastest MatchFunction this machine supports, chosen at startup.
+    static MatchFunction matchEntries;
+    uint64_t forEachInChain(CacheLine* cl,
+                            void (*callback)(uint64_t, void *),
+                            void *cookie,
+                            uint64_t onlyBucket);
+    void insertIntoBucket(uint64_t bucketIndex, uint64_t secondaryHash,
+                          uint64_t reference);
+    static void freeOverflowLines(CacheLine* bucketArray,
+                                  uint64_t numBuckets);
+
+    /**
+     * Value for the \a onlyBucket parameter of #forEachInChain indicating
+     * that every entry in the chain should be visited.
      */
-    const uint64_t numBuckets;
+    static const uint64_t ALL_BUCKETS = ~0UL;
+
+    /**
+     * The number of buckets allocated to the table. If the table is being
+     * resized, this is the size of the new bucket array.
+     */
+    uint64_t numBuckets;
 
     /**
      * The array of buckets.
@@ -252,6 +347,38 @@ class HashTable {
      */
     LargeBlockOfMemory<CacheLine> buckets;
 
+    /**
+     * The number of buckets in #oldBuckets. 0 unless the table is being
+     * resized.
+     */
+    uint64_t numOldBuckets;
+
+    /**
+     * While the table is being resized, this holds the bucket array being
+     * drained. Entries are moved out of it by #rehashBucket; it is freed by
+     * #finishResize.
+     */
+    Tub<LargeBlockOfMemory<CacheLine>> oldBuckets;
+
+    /**
+     * The bucket array allocated by #prepareResize, waiting to be put into
+     * service by #startResize.
+     */
+    Tub<LargeBlockOfMemory<CacheLine>> spareBuckets;
+
+    /// Used to compute the full hash of an entry when resizing. May be NULL,
+    /// in which case the table cannot be resized.
+    KeyHashFunction keyHashFunction;
+
+    /// Opaque argument passed to #keyHashFunction.
+    void* keyHashCookie;
+
+    /**
+     * The number of references currently stored in the table. Used to decide
+     * when the table should be resized.
+     */
+    std::atomic<uint64_t> numEntries;
+
     friend void hashTableBenchmark(uint64_t nkeys, uint64_t nlines);
     DISALLOW_COPY_AND_ASSIGN(HashTable);
 };
@@ -581,6 +581,54 @@ TEST_F(HashTableTest, findBucket) {
     EXPECT_EQ(secondaryHash, hashValue >> 48);
 }
 
+TEST_F(HashTableTest, matchEntries) {
+    HashTable::CacheLine cl;
+    cl.entries[0].setReference(0xbeefUL, 0x1UL);
+    cl.entries[1].clear();
+    cl.entries[2].setReference(0UL, 0x2UL);
+    cl.entries[3].setReference(0xbeefUL, 0x3UL);
+    cl.entries[4].setReference(0xfeedUL, 0x4UL);
+    cl.entries[5].setReference(0xbeefUL, 0x7fffffffffffUL);
+    cl.entries[6].clear();
+    cl.entries[7].setChainPointer(
+            reinterpret_cast<HashTable::CacheLine*>(0x1UL));
+
+    HashTable::MatchImplementation implementations[] = {
+        HashTable::MATCH_SCALAR, HashTable::MATCH_SSE42, HashTable::MATCH_AVX2
+    };
+    HashTable::MatchImplementation original =
+            HashTable::getMatchImplementation();
+    foreach (HashTable::MatchImplementation implementation, implementations) {
+        if (!HashTable::setMatchImplementation(implementation))
+            continue;
+        EXPECT_EQ(implementation, HashTable::getMatchImplementation());
+        EXPECT_EQ(0x29u, HashTable::matchEntries(&cl, 0xbeefUL));
+        EXPECT_EQ(0x10u, HashTable::matchEntries(&cl, 0xfeedUL));
+        EXPECT_EQ(0x04u, HashTable::matchEntries(&cl, 0UL));
+        EXPECT_EQ(0u, HashTable::matchEntries(&cl, 0x1234UL));
+    }
+    HashTable::setMatchImplementation(original);
+}
+
+TEST_F(HashTableTest, setMatchImplementation) {
+    HashTable::MatchImplementation original =
+            HashTable::getMatchImplementation();
+    EXPECT_TRUE(HashTable::setMatchImplementation(HashTable::MATCH_SCALAR));
+    EXPECT_EQ(HashTable::MATCH_SCALAR, HashTable::getMatchImplementation());
+
+    // Lookups that walk chained cache lines must work either way.
+    setup(0, HashTable::ENTRIES_PER_CACHE_LINE * 5);
+    string key = format("%u", (HashTable::ENTRIES_PER_CACHE_LINE - 1) * 2);
+    EXPECT_EQ(&entryAt(&ht, 2, 0),
+              findBucketAndLookupEntry(&ht, 0, key.c_str(),
+                    downCast<uint16_t>(key.length())));
+
+    HashTable::setMatchImplementation(original);
+    EXPECT_EQ(&entryAt(&ht, 2, 0),
+              findBucketAndLookupEntry(&ht, 0, key.c_str(),
+                    downCast<uint16_t>(key.length())));
+}
+
 /**
  * Test #RAMCloud::HashTable::lookupEntry() when the key is not
  * found.
@@ -673,6 +721,20 @@ TEST_F(HashTableTest, lookup) {
 }
 
 #if 0
+TEST_F(HashTableTest, Candidates_nextPastEnd) {
+    HashTable::Candidates unused;
+    unused.next();
+    EXPECT_TRUE(unused.isDone());
+
+    HashTable ht(1);
+    HashTable::Candidates candidates;
+    ht.lookup(0, candidates);
+    EXPECT_TRUE(candidates.isDone());
+    candidates.next();
+    EXPECT_TRUE(candidates.isDone());
+    EXPECT_EQ(0UL, candidates.getReference());
+}
+
 TEST_F(HashTableTest, remove) {
     HashTable ht(1);
 
@@ -821,4 +883,120 @@ TEST_F(HashTableTest, forEach) {
         EXPECT_EQ(1U, checkoff[i].count);
 }
 
+static KeyHash
+test_resize_keyHash(uint64_t ref, void *cookie)
+{
+    TestObject* obj = reinterpret_cast<TestObject*>(ref);
+    Key key(obj->tableId, obj->stringKeyPtr, obj->stringKeyLength);
+    return key.getHash();
+}
+
+/**
+ * Fill a resizable table with arrayLen objects, resize it to newNumBuckets
+ * and check that every object can be found at each step of the resize.
+ */
+static void
+resizeAndCheck(HashTableTest* test, uint64_t oldNumBuckets,
+               uint64_t newNumBuckets)
+{
+    HashTable ht(oldNumBuckets, test_resize_keyHash);
+    const uint32_t arrayLen = 256;
+    TestObject objects[arrayLen];
+    uint64_t outRef;
+
+    for (uint32_t i = 0; i < arrayLen; i++) {
+        objects[i].setKey(format("%u", i));
+        Key key(0, objects[i].stringKeyPtr, objects[i].stringKeyLength);
+        test->replace(&ht, key, objects[i].u64Address());
+    }
+    EXPECT_EQ(arrayLen, ht.getNumEntries());
+
+    ht.prepareResize(newNumBuckets);
+    EXPECT_FALSE(ht.isResizing());
+    ht.startResize();
+    EXPECT_TRUE(ht.isResizing());
+    EXPECT_EQ(newNumBuckets, ht.getNumBuckets());
+    EXPECT_EQ(oldNumBuckets, ht.getNumOldBuckets());
+
+    uint64_t moved = 0;
+    for (uint64_t b = 0; b < ht.getNumOldBuckets(); b++) {
+        // Everything must be reachable no matter which buckets have
+        // been rehashed so far.
+        for (uint32_t i = 0; i < arrayLen; i++) {
+            Key key(0, objects[i].stringKeyPtr, objects[i].stringKeyLength);
+            EXPECT_TRUE(test->lookup(&ht, key, outRef));
+            EXPECT_EQ(objects[i].u64Address(), outRef);
+        }
+        EXPECT_EQ(arrayLen, ht.forEach(test_forEach_callback,
+                                       reinterpret_cast<void *>(57)));
+        moved += ht.rehashBucket(b);
+    }
+    EXPECT_EQ(arrayLen, moved);
+
+    ht.finishResize();
+    EXPECT_FALSE(ht.isResizing());
+    EXPECT_EQ(0UL, ht.getNumOldBuckets());
+    for (uint32_t i = 0; i < arrayLen; i++) {
+        Key key(0, objects[i].stringKeyPtr, objects[i].stringKeyLength);
+        EXPECT_TRUE(test->lookup(&ht, key, outRef));
+        EXPECT_EQ(objects[i].u64Address(), outRef);
+        EXPECT_EQ(oldNumBuckets, objects[i].count);
+    }
+    EXPECT_EQ(arrayLen, ht.getNumEntries());
+}
+
+TEST_F(HashTableTest, resize_grow) {
+    resizeAndCheck(this, 4, 32);
+}
+
+TEST_F(HashTableTest, resize_shrink) {
+    resizeAndCheck(this, 32, 4);
+}
+
+TEST_F(HashTableTest, resize_insertAndRemoveWhileResizing) {
+    HashTable ht(2, test_resize_keyHash);
+    TestObject a(0, "a");
+    TestObject a2(0, "a");
+    TestObject b(0, "b");
+    Key aKey(a.tableId, a.stringKeyPtr, a.stringKeyLength);
+    Key bKey(b.tableId, b.stringKeyPtr, b.stringKeyLength);
+    uint64_t outRef;
+
+    replace(&ht, aKey, a.u64Address());
+    ht.prepareResize(8);
+    ht.startResize();
+
+    // New keys go to the new bucket array; old ones stay put until their
+    // bucket is rehashed, but can still be updated and removed.
+    replace(&ht, bKey, b.u64Address());
+    EXPECT_TRUE(lookup(&ht, bKey, outRef));
+    EXPECT_TRUE(replace(&ht, aKey, a2.u64Address()));
+    EXPECT_TRUE(lookup(&ht, aKey, outRef));
+    EXPECT_EQ(a2.u64Address(), outRef);
+    EXPECT_EQ(2UL, ht.getNumEntries());
+
+    HashTable::Candidates candidates;
+    ht.lookup(aKey.getHash(), candidates);
+    candidates.remove();
+    EXPECT_FALSE(lookup(&ht, aKey, outRef));
+    EXPECT_EQ(1UL, ht.getNumEntries());
+
+    for (uint64_t i = 0; i < ht.getNumOldBuckets(); i++)
+        EXPECT_EQ(0UL, ht.rehashBucket(i));
+    ht.finishResize();
+    EXPECT_TRUE(lookup(&ht, bKey, outRef));
+}
+
+TEST_F(HashTableTest, resize_errors) {
+    HashTable noHashFunction(2);
+    EXPECT_THROW(noHashFunction.prepareResize(4), Exception);
+
+    HashTable ht(2, test_resize_keyHash);
+    EXPECT_THROW(ht.startResize(), Exception);
+    ht.prepareResize(4);
+    ht.startResize();
+    ht.prepareResize(8);
+    EXPECT_THROW(ht.startResize(), Exception);
+}
+
 } // namespace RAMCloud
@@ -0,0 +1,323 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include "IoUring.h"
+
+namespace RAMCloud {
+
+namespace {
+/**
+ * Returns a pointer \a offset bytes into \a base.
+ */
+template<typename T>
+T*
+at(void* base, uint32_t offset)
+{
+    return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+/**
+ * Map part of a ring into memory.
+ */
+void*
+mapRing(int ringFd, size_t length, off_t offset)
+{
+    void* p = mmap(NULL, length, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, ringFd, offset);
+    if (p == MAP_FAILED)
+        throw IoUringException(HERE, "Couldn't map io_uring", errno);
+    return p;
+}
+}
+
+/**
+ * Create an io_uring for doing IO on a set of files.
+ *
+ * \param fds
+ *      Descriptors of the files that requests will refer to (by index). They
+ *      must stay open for the life of this object.
+ * \param entries
+ *      Size of the submission queue; the kernel rounds this up to a power
+ *      of two. A single call to perform() may have more requests than this,
+ *      but they are then split across several system calls.
+ * \throw IoUringException
+ *      The kernel doesn't support io_uring (or it is disabled).
+ */
+IoUring::IoUring(const std::vector<int>& fds, uint32_t entries)
+    : ringFd(-1)
+    , fds(fds)
+    , fixedFiles(false)
+    , sqRing(NULL)
+    , sqRingBytes(0)
+    , cqRing(NULL)
+    , cqRingBytes(0)
+    , sqes(NULL)
+    , sqesBytes(0)
+    , sqHead(NULL)
+    , sqTail(NULL)
+    , sqMask(0)
+    , sqEntries(0)
+    , sqArray(NULL)
+    , cqHead(NULL)
+    , cqTail(NULL)
+    , cqMask(0)
+    , cqes(NULL)
+    , mutex()
+    , reaping(false)
+    , completed()
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ringFd = downCast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (ringFd < 0)
+        throw IoUringException(HERE, "Couldn't create io_uring", errno);
+
+    sqRingBytes = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cqRingBytes = params.cq_off.cqes +
+                  params.cq_entries * sizeof(struct io_uring_cqe);
+    sqesBytes = params.sq_entries * sizeof(struct io_uring_sqe);
+    try {
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            sqRingBytes = std::max(sqRingBytes, cqRingBytes);
+            sqRing = mapRing(ringFd, sqRingBytes, IORING_OFF_SQ_RING);
+            cqRing = sqRing;
+        } else {
+            sqRing = mapRing(ringFd, sqRingBytes, IORING_OFF_SQ_RING);
+            cqRing = mapRing(ringFd, cqRingBytes, IORING_OFF_CQ_RING);
+        }
+        sqes = static_cast<struct io_uring_sqe*>(
+                mapRing(ringFd, sqesBytes, IORING_OFF_SQES));
+    } catch (...) {
+        release();
+        throw;
+    }
+
+    sqHead = at<uint32_t>(sqRing, params.sq_off.head);
+    sqTail = at<uint32_t>(sqRing, params.sq_off.tail);
+    sqMask = *at<uint32_t>(sqRing, params.sq_off.ring_mask);
+    sqEntries = *at<uint32_t>(sqRing, params.sq_off.ring_entries);
+    sqArray = at<uint32_t>(sqRing, params.sq_off.array);
+    cqHead = at<uint32_t>(cqRing, params.cq_off.head);
+    cqTail = at<uint32_t>(cqRing, params.cq_off.tail);
+    cqMask = *at<uint32_t>(cqRing, params.cq_off.ring_mask);
+    cqes = at<struct io_uring_cqe>(cqRing, params.cq_off.cqes);
+
+    // Registering the files is only an optimization; carry on without it
+    // if the kernel won't allow it.
+    fixedFiles = syscall(__NR_io_uring_register, ringFd,
+                         IORING_REGISTER_FILES, this->fds.data(),
+                         downCast<uint32_t>(this->fds.size())) == 0;
+}
+
+/**
+ * Release the ring. No calls to perform() may be in progress.
+ */
+IoUring::~IoUring()
+{
+    release();
+}
+
+/**
+ * Returns true if the kernel supports io_uring and allows this process to
+ * use it.
+ */
+bool
+IoUring::isSupported()
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = downCast<int>(syscall(__NR_io_uring_setup, 1, &params));
+    if (fd < 0)
+        return false;
+    close(fd);
+    return true;
+}
+
+// - private -
+
+/**
+ * Unmap the rings and close #ringFd; used by the destructor and if the
+ * constructor fails part way through.
+ */
+void
+IoUring::release()
+{
+    if (sqes != NULL)
+        munmap(sqes, sqesBytes);
+    if (cqRing != NULL && cqRing != sqRing)
+        munmap(cqRing, cqRingBytes);
+    if (sqRing != NULL)
+        munmap(sqRing, sqRingBytes);
+    if (ringFd >= 0)
+        close(ringFd);
+    sqes = NULL;
+    cqRing = NULL;
+    sqRing = NULL;
+    ringFd = -1;
+}
+
+/**
+ * Perform a batch of reads and writes, all of which are submitted to the
+ * kernel at once, and return once all of them have finished. The operations
+ * may be carried out in any order and concurrently.
+ *
+ * \param requests
+ *      Operations to perform; the result field of each is filled in.
+ * \param count
+ *      Number of entries in \a requests.
+ * \throw IoUringException
+ *      The kernel rejected the requests. Errors from individual reads and
+ *      writes are reported through their results instead.
+ */
+void
+IoUring::perform(Request* requests, uint32_t count)
+{
+    Lock lock(mutex);
+    uint32_t pending = count;
+    uint32_t queued = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        requests[i].pending = &pending;
+        while (!queue(&requests[i])) {
+            // The submission queue is full; hand what is queued so far to
+            // the kernel to make room.
+            enter(queued, 0, 0);
+            queued = 0;
+        }
+        queued++;
+    }
+    enter(queued, 0, 0);
+
+    while (pending > 0) {
+        if (reaping) {
+            completed.wait(lock);
+            continue;
+        }
+        reaping = true;
+        lock.unlock();
+        try {
+            enter(0, 1, IORING_ENTER_GETEVENTS);
+        } catch (...) {
+            lock.lock();
+            reaping = false;
+            completed.notify_all();
+            throw;
+        }
+        lock.lock();
+        reap();
+        reaping = false;
+        completed.notify_all();
+    }
+}
+
+/**
+ * Add a request to the submission queue without telling the kernel about
+ * it. Must be called with #mutex held.
+ *
+ * \param request
+ *      Request to add.
+ * \return
+ *      False if the submission queue is full.
+ */
+bool
+IoUring::queue(Request* request)
+{
+    uint32_t tail = *sqTail;
+    if (tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries)
+        return false;
+
+    uint32_t index = tail & sqMask;
+    struct io_uring_sqe* sqe = &sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = request->write ? IORING_OP_WRITE : IORING_OP_READ;
+    if (fixedFiles) {
+        sqe->fd = downCast<int>(request->fileIndex);
+        sqe->flags = IOSQE_FIXED_FILE;
+    } else {
+        sqe->fd = fds[request->fileIndex];
+    }
+    sqe->addr = reinterpret_cast<uint64_t>(request->buf);
+    sqe->len = request->length;
+    sqe->off = request->offset;
+    sqe->user_data = reinterpret_cast<uint64_t>(request);
+    sqArray[index] = index;
+    __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * Call io_uring_enter(2), retrying if it is interrupted or can only accept
+ * some of the submissions. Must be called with #mutex held if
+ * \a toSubmit is non-zero.
+ *
+ * \param toSubmit
+ *      Number of queued submissions to hand to the kernel.
+ * \param minComplete
+ *      Wait until at least this many completions are available.
+ * \param flags
+ *      Flags for io_uring_enter(2).
+ * \return
+ *      Number of submissions the kernel accepted.
+ */
+uint32_t
+IoUring::enter(uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+{
+    uint32_t submitted = 0;
+    do {
+        long r = syscall(__NR_io_uring_enter, ringFd, toSubmit - submitted,
+                         minComplete, flags, NULL, 0);
+        if (r < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EBUSY) {
+                // The completion queue is full. When submitting, the caller
+                // holds the lock, so drain it here to let the kernel make
+                // progress; a thread only waiting just tries again.
+                if (toSubmit > 0) {
+                    reap();
+                    completed.notify_all();
+                }
+                continue;
+            }
+            throw IoUringException(HERE, "io_uring_enter failed", errno);
+        }
+        submitted += downCast<uint32_t>(r);
+        minComplete = 0;
+    } while (submitted < toSubmit);
+    return submitted;
+}
+
+/**
+ * Hand out all available completions to the requests they belong to.
+ * Must be called with #mutex held.
+ */
+void
+IoUring::reap()
+{
+    uint32_t head = *cqHead;
+    while (head != __atomic_load_n(cqTail, __ATOMIC_ACQUIRE)) {
+        struct io_uring_cqe* cqe = &cqes[head & cqMask];
+        Request* request = reinterpret_cast<Request*>(cqe->user_data);
+        request->result = cqe->res;
+        --*request->pending;
+        head++;
+    }
+    __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+}
+
+} // namespace RAMCloud
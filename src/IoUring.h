@@ -0,0 +1,146 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_IOURING_H
+#define RAMCLOUD_IOURING_H
+
+#include <condition_variable>
+#include <mutex>
+
+#include "Common.h"
+#include "Exception.h"
+
+// Defined in <linux/io_uring.h>, which isn't included here because it drags
+// in macros (such as BLOCK_SIZE) that clash with names used elsewhere.
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace RAMCloud {
+
+/**
+ * Thrown if an io_uring can't be created or the kernel rejects a call on it.
+ */
+struct IoUringException : public Exception {
+    IoUringException(const CodeLocation& where, string msg, int errNo)
+        : Exception(where, msg, errNo) {}
+};
+
+/**
+ * Performs reads and writes on a fixed set of files through a Linux io_uring.
+ * Compared to POSIX aio (which glibc emulates with a pool of helper threads
+ * and one system call per operation) all of the operations in a call to
+ * perform() are handed to the kernel with a single system call and no extra
+ * threads are involved. The files are registered with the ring so the kernel
+ * doesn't need to look up their descriptors for each operation.
+ *
+ * This talks to the kernel directly rather than through liburing, so it only
+ * needs the kernel headers; Linux 5.6 or later is needed at runtime.
+ *
+ * This class is thread-safe: concurrent calls to perform() share the ring
+ * and whichever thread is waiting for completions hands them out to the
+ * others.
+ */
+class IoUring {
+  public:
+    /**
+     * Describes one read or write passed to perform().
+     */
+    struct Request {
+        /// True to write #buf to the file, false to read into #buf.
+        bool write;
+
+        /// Index (in the vector given to the constructor) of the file.
+        uint32_t fileIndex;
+
+        /// Data to write or where to put data read.
+        void* buf;
+
+        /// Number of bytes to transfer.
+        uint32_t length;
+
+        /// Offset in the file to start at.
+        uint64_t offset;
+
+        /// Set by perform(): number of bytes transferred or a negated errno.
+        int32_t result;
+
+        /// Used by IoUring to count the operations of a call to perform()
+        /// that haven't completed.
+        uint32_t* pending;
+    };
+
+    IoUring(const std::vector<int>& fds, uint32_t entries);
+    ~IoUring();
+    void perform(Request* requests, uint32_t count);
+    static bool isSupported();
+
+  PRIVATE:
+    bool queue(Request* request);
+    uint32_t enter(uint32_t toSubmit, uint32_t minComplete, uint32_t flags);
+    void reap();
+    void release();
+
+    typedef std::unique_lock<std::mutex> Lock;
+
+    /// File descriptor for the ring.
+    int ringFd;
+
+    /// Descriptors of the files requests refer to.
+    std::vector<int> fds;
+
+    /// True if #fds have been registered with the ring.
+    bool fixedFiles;
+
+    /// Memory shared with the kernel holding the submission ring and (if
+    /// the kernel supports IORING_FEAT_SINGLE_MMAP) the completion ring.
+    void* sqRing;
+    size_t sqRingBytes;
+
+    /// Memory shared with the kernel holding the completion ring; the same
+    /// as #sqRing if the kernel maps both at once.
+    void* cqRing;
+    size_t cqRingBytes;
+
+    /// Submission queue entries, indexed by #sqArray.
+    struct io_uring_sqe* sqes;
+    size_t sqesBytes;
+
+    /// Pointers into #sqRing and #cqRing; see io_uring_setup(2).
+    uint32_t* sqHead;
+    uint32_t* sqTail;
+    uint32_t sqMask;
+    uint32_t sqEntries;
+    uint32_t* sqArray;
+    uint32_t* cqHead;
+    uint32_t* cqTail;
+    uint32_t cqMask;
+    struct io_uring_cqe* cqes;
+
+    /// Protects the rings and all of the fields below.
+    std::mutex mutex;
+
+    /// True while a thread is waiting in the kernel for completions;
+    /// other threads wait on #completed instead.
+    bool reaping;
+
+    /// Notified whenever completions have been handed out.
+    std::condition_variable completed;
+
+    DISALLOW_COPY_AND_ASSIGN(IoUring);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_IOURING_H
@@ -0,0 +1,162 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <thread>
+
+#include "TestUtil.h"
+#include "IoUring.h"
+
+namespace RAMCloud {
+
+class IoUringTest : public ::testing::Test {
+  public:
+    const char* filePath1;
+    const char* filePath2;
+    std::vector<int> fds;
+
+    IoUringTest()
+        : filePath1("/tmp/ramcloud-io-uring-test-delete-this-1")
+        , filePath2("/tmp/ramcloud-io-uring-test-delete-this-2")
+        , fds()
+    {
+        fds.push_back(::open(filePath1, O_CREAT | O_RDWR | O_TRUNC, 0666));
+        fds.push_back(::open(filePath2, O_CREAT | O_RDWR | O_TRUNC, 0666));
+    }
+
+    ~IoUringTest()
+    {
+        foreach (int fd, fds)
+            close(fd);
+        unlink(filePath1);
+        unlink(filePath2);
+    }
+
+    IoUring::Request
+    request(bool write, uint32_t fileIndex, void* buf, uint32_t length,
+            uint64_t offset)
+    {
+        IoUring::Request r;
+        r.write = write;
+        r.fileIndex = fileIndex;
+        r.buf = buf;
+        r.length = length;
+        r.offset = offset;
+        r.result = 0;
+        r.pending = NULL;
+        return r;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(IoUringTest);
+};
+
+TEST_F(IoUringTest, perform) {
+    if (!IoUring::isSupported())
+        return;
+    IoUring ring(fds, 4);
+    char out1[] = "hello";
+    char out2[] = "world";
+    IoUring::Request writes[] = {
+        request(true, 0, out1, 6, 0),
+        request(true, 1, out2, 6, 100),
+    };
+    ring.perform(writes, 2);
+    EXPECT_EQ(6, writes[0].result);
+    EXPECT_EQ(6, writes[1].result);
+
+    char in1[6] = {};
+    char in2[6] = {};
+    char in3[6] = {};
+    IoUring::Request reads[] = {
+        request(false, 0, in1, 6, 0),
+        request(false, 1, in2, 6, 100),
+        request(false, 1, in3, 6, 1000),
+    };
+    ring.perform(reads, 3);
+    EXPECT_EQ(6, reads[0].result);
+    EXPECT_STREQ("hello", in1);
+    EXPECT_EQ(6, reads[1].result);
+    EXPECT_STREQ("world", in2);
+    // Past the end of the file.
+    EXPECT_EQ(0, reads[2].result);
+}
+
+TEST_F(IoUringTest, perform_moreRequestsThanEntries) {
+    if (!IoUring::isSupported())
+        return;
+    IoUring ring(fds, 2);
+    char data[20];
+    IoUring::Request requests[20];
+    for (uint32_t i = 0; i < 20; i++) {
+        data[i] = static_cast<char>('a' + i);
+        requests[i] = request(true, i % 2, &data[i], 1, i);
+    }
+    ring.perform(requests, 20);
+    for (uint32_t i = 0; i < 20; i++)
+        EXPECT_EQ(1, requests[i].result);
+
+    char in[20] = {};
+    for (uint32_t i = 0; i < 20; i++)
+        requests[i] = request(false, i % 2, &in[i], 1, i);
+    ring.perform(requests, 20);
+    for (uint32_t i = 0; i < 20; i++)
+        EXPECT_EQ(data[i], in[i]);
+}
+
+TEST_F(IoUringTest, perform_error) {
+    if (!IoUring::isSupported())
+        return;
+    IoUring ring(fds, 4);
+    IoUring::Request r = request(false, 0, NULL, 6, 0);
+    const char data[] = "x";
+    ASSERT_EQ(1, pwrite(fds[0], data, 1, 0));
+    ring.perform(&r, 1);
+    EXPECT_EQ(-EFAULT, r.result);
+}
+
+namespace {
+void
+performMany(IoUring* ring, uint32_t fileIndex, int* failures)
+{
+    for (uint32_t i = 0; i < 100; i++) {
+        uint64_t value = i;
+        IoUring::Request r;
+        r.write = true;
+        r.fileIndex = fileIndex;
+        r.buf = &value;
+        r.length = sizeof(value);
+        r.offset = i * sizeof(value);
+        ring->perform(&r, 1);
+        if (r.result != sizeof(value))
+            (*failures)++;
+    }
+}
+}
+
+TEST_F(IoUringTest, perform_concurrent) {
+    if (!IoUring::isSupported())
+        return;
+    IoUring ring(fds, 2);
+    int failures[4] = {};
+    std::thread threads[4];
+    for (uint32_t i = 0; i < 4; i++)
+        threads[i] = std::thread(performMany, &ring, i % 2, &failures[i]);
+    for (uint32_t i = 0; i < 4; i++) {
+        threads[i].join();
+        EXPECT_EQ(0, failures[i]);
+    }
+}
+
+} // namespace RAMCloud
@@ -57,8 +57,10 @@ struct LargeBlockOfMemory {
         , block(static_cast<T*>(mmapGigabyteAligned(length, MAP_ANONYMOUS)))
     {
         if (block == MAP_FAILED) {
-            if (length == 0)
+            if (length == 0) {
+                block = NULL;
                 return;
+            }
             throw FatalError(HERE,
                              format("Could not allocate %lu bytes", length),
                              errno);
@@ -63,10 +63,15 @@ Log::Log(Context* context,
     : AbstractLog(entryHandlers,
                   segmentManager,
                   replicaManager,
-                  config->segmentSize),
+                  config->segmentSize,
+                  config->master.numLogHeads,
+                  config->master.segregateHotWrites),
       context(context),
       cleaner(NULL),
-      syncLock("Log::syncLock"),
+      groupCommitMaxWait(Cycles::fromNanoseconds(
+            1000UL * config->master.syncGroupCommitMicros)),
+      groupCommits(new GroupCommit[numHeads]),
+      testingGroupCommitPoll(NULL),
       metrics()
 {
     cleaner = new LogCleaner(context,
@@ -81,6 +86,8 @@ Log::Log(Context* context,
  */
 Log::~Log()
 {
+    if (unsyncedHotLog == this)
+        unsyncedHotLog = NULL;
     delete cleaner;
 }
 
@@ -115,16 +122,34 @@ Log::getMetrics(ProtoBuf::LogMetrics& m)
     AbstractLog::getMetrics(m);
     m.set_total_sync_calls(metrics.totalSyncCalls);
     m.set_total_sync_ticks(metrics.totalSyncTicks);
+    {
+        SpinLock::Guard _(metrics.lock);
+        metrics.syncBatchSizeHistogram.serialize(
+            *m.mutable_sync_batch_size_histogram());
+        metrics.syncWaitHistogram.serialize(*m.mutable_sync_wait_histogram());
+    }
     cleaner->getMetrics(*m.mutable_cleaner_metrics());
 }
 
 /**
- * Return the position of the current log head.
+ * Return the position of the current log head. If the log has several heads,
+ * this is the lowest position of any of them: every entry appended after this
+ * method returns is guaranteed to be at this position or beyond.
  */
 LogPosition
 Log::getHead() {
-    SpinLock::Guard _(appendLock);
-    return LogPosition(head->id, head->getAppendedLength());
+    Tub<LogPosition> position;
+    for (uint32_t i = 0; i < numHeads; i++) {
+        SpinLock::Guard _(heads[i].appendLock);
+        LogSegment* segment = heads[i].segment;
+        if (segment == NULL)
+            continue;
+        LogPosition headPosition(segment->id, segment->getAppendedLength());
+        if (!position || headPosition < *position)
+            position.construct(headPosition);
+    }
+    assert(position);
+    return *position;
 }
 
 /**
@@ -143,6 +168,16 @@ Log::getHead() {
  * started waiting. This lets us batch backup writes and improve throughput for
  * small entries.
  *
+ * If group commit is enabled (see waitForGroupCommit()), the thread that
+ * does the syncing may first wait briefly for other threads to arrive so that
+ * their appends are replicated together with ours.
+ *
+ * If the log has several heads, only the head the calling thread appends to
+ * (and the hot head, if this thread has appended to it since its last sync)
+ * is synced. That covers every append this thread has made, which is what
+ * callers need; use syncTo() to make an entry appended by another thread
+ * durable.
+ *
  * An alternative to batching writes would have been to pipeline replication
  * RPCs to backups. That would probably also work just fine, but results in
  * more RPCs and is more complicated (we'd need to keep track of various RPCs
@@ -154,20 +189,53 @@ void
 Log::sync()
 {
     CycleCounter<uint64_t> __(&PerfStats::threadStats.logSyncCycles);
-
-    Tub<SpinLock::Guard> lock;
-    lock.construct(appendLock);
     metrics.totalSyncCalls++;
 
-    // The only time 'head' should be NULL is after construction and before the
-    // initial call to this method. Even if we run out of memory in the future,
-    // head will remain valid.
-    if (head == NULL) {
-        assert(metrics.totalSyncCalls == 1);
-        if (!allocNewWritableHead())
+    Head& head = getHeadForThread();
+    sync(head);
+
+    // Hot appends from this thread went to the hot head instead; leave it
+    // alone unless this thread has appended there since its last sync.
+    Head* hotHead = getHotHead();
+    if (hotHead != NULL && hotHead != &head &&
+            (unsyncedHotLog == this || severalUnsyncedHotLogs)) {
+        sync(*hotHead);
+        if (unsyncedHotLog == this)
+            unsyncedHotLog = NULL;
+    }
+}
+
+/**
+ * Sync one of the log's heads to backups. This does the work for sync(); see
+ * that method for details.
+ *
+ * \param head
+ *      The head to sync.
+ */
+void
+Log::sync(Head& head)
+{
+    GroupCommit& group = groupCommits[head.index];
+    Tub<SpinLock::Guard> lock;
+    lock.construct(head.appendLock);
+
+    // The only time 'head.segment' should be NULL is after construction and
+    // before the initial call to this method (or, with several heads, before
+    // the first use of this head). Even if we run out of memory in the future,
+    // it will remain valid. The hot head is left alone until something is
+    // appended to it.
+    if (head.segment == NULL) {
+        if (&head == getHotHead()) {
+            TEST_LOG("sync not needed: nothing appended to hot head");
+            return;
+        }
+        assert(numHeads > 1 || metrics.totalSyncCalls == 1);
+        if (!allocNewWritableHead(head))
             throw FatalError(HERE, "Could not allocate initial head segment");
     }
 
+    recordSyncArrival(group);
+
     // Get the current log offset and assume this is the point we want to sync
     // to. It may include more data than our thread's previous appends due to
     // races between the append() call and this sync(), but it's both unlikely
@@ -175,28 +243,37 @@ Log::sync()
     // sometimes when the log really is synced up to our appends, but this logic
     // mistakes additional data from other threads' appends as stuff we care
     // about.
-    uint32_t appendedLength = head->getAppendedLength();
+    uint32_t appendedLength = head.segment->getAppendedLength();
 
     // Concurrent appends may cause the head segment to change while we wait
     // for another thread to finish syncing, so save the segment associated
     // with the appendedLength we just acquired.
-    LogSegment* originalHead = head;
+    LogSegment* originalHead = head.segment;
 
     // We have a consistent view of the current head segment, so drop the append
     // lock and grab the sync lock. This allows other writers to append to the
-    // log while we wait. Once we grab the sync lock, take the append lock again
-    // to ensure our new view of the head is consistent.
+    // log while we wait. The syncedLength field is only modified with the
+    // sync lock held.
     lock.destroy();
-    SpinLock::Guard _(syncLock);
-    lock.construct(appendLock);
+    SpinLock::Guard _(head.syncLock);
 
     // See if we still have work to do. It's possible that another thread
     // already did the syncing we needed for us.
     if (appendedLength > originalHead->syncedLength) {
-        // Get the latest segment length and certificate. This allows us to
-        // batch up other appends that came in while we were waiting.
+        // Give other threads that are about to sync a chance to append first,
+        // so that one round of backup writes covers all of them.
+        uint64_t waitTicks = waitForGroupCommit(group);
+
+        // Take the append lock again to ensure our new view of the head is
+        // consistent, then get the latest segment length and certificate.
+        // This allows us to batch up other appends that came in while we were
+        // waiting.
+        lock.construct(head.appendLock);
         SegmentCertificate certificate;
         appendedLength = originalHead->getAppendedLength(&certificate);
+        uint64_t arrivals = group.arrivals.load(std::memory_order_relaxed);
+        uint64_t batchSize = arrivals - group.arrivalsAtLastSync;
+        group.arrivalsAtLastSync = arrivals;
 
         // Drop the append lock. We don't want to block other appending threads
         // while we sync.
@@ -204,6 +281,13 @@ Log::sync()
 
         originalHead->replicatedSegment->sync(appendedLength, &certificate);
         originalHead->syncedLength = appendedLength;
+
+        {
+            SpinLock::Guard __(metrics.lock);
+            metrics.syncBatchSizeHistogram.storeSample(batchSize);
+            metrics.syncWaitHistogram.storeSample(
+                Cycles::toMicroseconds(waitTicks));
+        }
         TEST_LOG("log synced");
     } else {
         TEST_LOG("sync not needed: already fully replicated");
@@ -242,36 +326,52 @@ Log::syncTo(Log::Reference reference)
     // See if we still have work to do. It's possible that another thread
     // already did the syncing we needed for us.
     if (desiredSyncedLength > segment->syncedLength) {
-        SpinLock::Guard _(syncLock);
-        // Check whether we need to sync once again after grabbing the syncLock.
-        // Previous sync may have synced the desired portion already.
-        if (desiredSyncedLength <= segment->syncedLength) {
-            return;
+        // If the segment is still the head of one of our chains, syncing that
+        // head is enough. Otherwise it has been closed and its replication is
+        // queued already, so forcing a sync of the head that followed it will
+        // also make sure that it is fully replicated. We don't keep track of
+        // which chain it came from, so sync all of them in that case.
+        bool synced = false;
+        bool isHead = false;
+        for (uint32_t i = 0; i < numHeads; i++) {
+            if (heads[i].segment == segment) {
+                synced = syncHead(heads[i], segment, desiredSyncedLength);
+                isHead = true;
+                break;
+            }
         }
-
-        Tub<SpinLock::Guard> lock;
-        lock.construct(appendLock);
-
-        // Get the latest segment length and certificate. This allows us to
-        // batch up other appends that came in while we were waiting.
-        SegmentCertificate certificate;
-        // If segment != head, segment must have been closed and its replication
-        // is queued already. Forcing sync of head segment will also make sure
-        // that the closed segment is fully replicated.
-        uint32_t appendedLength = head->getAppendedLength(&certificate);
-
-        // Drop the append lock. We don't want to block other appending
-        // threads while we sync.
-        lock.destroy();
-
-        head->replicatedSegment->sync(appendedLength, &certificate);
-        head->syncedLength = appendedLength;
-        TEST_LOG("log synced");
+        if (!isHead) {
+            for (uint32_t i = 0; i < numHeads; i++) {
+                if (syncHead(heads[i], segment, desiredSyncedLength))
+                    synced = true;
+            }
+        }
+        if (synced)
+            TEST_LOG("log synced");
         return;
     }
     TEST_LOG("sync not needed: entry is already replicated");
 }
 
+/**
+ * Return true if the given log entry is already fully replicated, so that
+ * syncTo() would return without waiting for backups. Callers that must not
+ * block (for example, the dispatch thread) use this to decide whether they
+ * can complete an operation themselves.
+ */
+bool
+Log::isSynced(Log::Reference reference)
+{
+    LogSegment* segment = getSegment(reference);
+    if (segment->closedCommitted.load(std::memory_order_relaxed))
+        return true;
+
+    uint32_t offset = segment->getOffset(reference);
+    uint32_t lengthWithMetadata;
+    segment->getEntry(offset, NULL, &lengthWithMetadata);
+    return offset + lengthWithMetadata <= segment->syncedLength;
+}
+
 /**
  * Force the log to roll over to a new head and return the new log position.
  * At the instant of the new head segment's creation, it will have the highest
@@ -287,25 +387,42 @@ Log::syncTo(Log::Reference reference)
  * want to recover that data if a failure occurrs. Fortunately, its data would
  * be at strictly lower positions in the log, so it's easy to filter during
  * recovery.
+ *
+ * If the log has several heads, all of them that are in use are rolled over
+ * and the position of the first new head is returned. Every later append lands
+ * in one of the new head segments, so it is at or beyond that position.
  */
 LogPosition
 Log::rollHeadOver()
 {
-    SpinLock::Guard lock(syncLock);
-    SpinLock::Guard lock2(appendLock);
+    std::vector<std::unique_lock<SpinLock>> locks;
+    for (uint32_t i = 0; i < numHeads; i++)
+        locks.emplace_back(heads[i].syncLock);
+    for (uint32_t i = 0; i < numHeads; i++)
+        locks.emplace_back(heads[i].appendLock);
 
     // Allocate the new head and sync the log. This will ensure that the
     // position returned is stable on backups. This is paricularly important
     // for SideLog::commit(), which rolls the head over to inject a SideLog
     // into the main log (by adding segments to a new log digest and syncing
     // that to disk). See RAM-489.
-    head = allocNextSegment(true);
-    SegmentCertificate certificate;
-    uint32_t appendedLength = head->getAppendedLength(&certificate);
-    head->replicatedSegment->sync(appendedLength, &certificate);
-    head->syncedLength = appendedLength;
+    Tub<LogPosition> position;
+    for (uint32_t i = 0; i < numHeads; i++) {
+        Head& head = heads[i];
+        if (head.segment == NULL && i != 0)
+            continue;
+
+        head.segment = allocNextSegment(true, i);
+        SegmentCertificate certificate;
+        uint32_t appendedLength = head.segment->getAppendedLength(&certificate);
+        head.segment->replicatedSegment->sync(appendedLength, &certificate);
+        head.segment->syncedLength = appendedLength;
+
+        if (!position)
+            position.construct(head.segment->id, appendedLength);
+    }
 
-    return LogPosition(head->id, head->getAppendedLength());
+    return *position;
 }
 
 /******************************************************************************
@@ -316,22 +433,138 @@ Log::rollHeadOver()
  * Allocate a new head segment for the log. This is used by the AbstractLog
  * superclass when a new segment is needed.
  *
- * This method must be called with the AbstractLog's appendLock held.
+ * This method must be called with the head's appendLock held.
  *
  * \param mustNotFail
  *      If true, this method must return a valid LogSegment pointer and may
  *      block as long as needed. If false, it should return immediately with
  *      a NULL pointer if no segments are available.
+ * \param headIndex
+ *      Index of the head the new segment will replace.
  */
 LogSegment*
-Log::allocNextSegment(bool mustNotFail)
+Log::allocNextSegment(bool mustNotFail, uint32_t headIndex)
+{
+    assert(!heads[headIndex].appendLock.try_lock());
+
+    if (mustNotFail) {
+        return segmentManager->allocHeadSegment(SegmentManager::MUST_NOT_FAIL,
+                                                headIndex);
+    } else {
+        return segmentManager->allocHeadSegment(SegmentManager::EMPTY,
+                                                headIndex);
+    }
+}
+
+/**
+ * Note that sync() has been called on a head. This maintains the estimate
+ * of how frequently syncs arrive that waitForGroupCommit() relies on.
+ *
+ * This method must be called with the head's appendLock held, after the
+ * caller's appends.
+ *
+ * \param group
+ *      Group commit state for the head being synced.
+ */
+void
+Log::recordSyncArrival(GroupCommit& group)
+{
+    uint64_t now = Cycles::rdtsc();
+    uint64_t last = group.lastArrival.load(std::memory_order_relaxed);
+    if (last != 0) {
+        uint64_t gap = now - last;
+        uint64_t average = group.averageGap.load(std::memory_order_relaxed);
+        if (average == ~0UL)
+            average = gap;
+        else
+            average = average - average / 8 + gap / 8;
+        group.averageGap.store(average, std::memory_order_relaxed);
+    }
+    group.lastArrival.store(now, std::memory_order_relaxed);
+    group.arrivals.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * Implement group commit for sync(): called by the thread that is about to
+ * replicate a head, with the head's syncLock held, to give other threads that
+ * will soon sync the same head a chance to append first. The wait adapts to
+ * the rate at which syncs have been arriving. It ends as soon as no new sync
+ * has arrived for about as long as the average gap between syncs, and is
+ * skipped entirely if syncs arrive less often than the maximum wait, so
+ * lightly-loaded servers see no added latency. It never lasts longer than
+ * #groupCommitMaxWait.
+ *
+ * \param group
+ *      Group commit state for the head being synced.
+ * \return
+ *      The number of Cycles::rdtsc() ticks spent waiting.
+ */
+uint64_t
+Log::waitForGroupCommit(GroupCommit& group)
 {
-    assert(!appendLock.try_lock());
+    uint64_t averageGap = group.averageGap.load(std::memory_order_relaxed);
+    if (groupCommitMaxWait == 0 || averageGap >= groupCommitMaxWait)
+        return 0;
+
+    uint64_t start = Cycles::rdtsc();
+    uint64_t lastArrival = start;
+    uint64_t arrivals = group.arrivals.load(std::memory_order_relaxed);
+    uint64_t now = start;
+    while (now - start < groupCommitMaxWait &&
+           now - lastArrival <= averageGap) {
+        if (testingGroupCommitPoll != NULL)
+            testingGroupCommitPoll(group);
+        uint64_t current = group.arrivals.load(std::memory_order_relaxed);
+        if (current != arrivals) {
+            arrivals = current;
+            lastArrival = now;
+        }
+        now = Cycles::rdtsc();
+    }
+    return now - start;
+}
+
+/**
+ * Sync the current segment of one of the log's heads to backups, unless
+ * another thread has already made the given segment durable up to the
+ * given length. Used by syncTo().
+ *
+ * \param head
+ *      The head whose current segment is to be synced.
+ * \param segment
+ *      The segment containing the entry the caller wants to be durable.
+ * \param desiredSyncedLength
+ *      Offset in \a segment up to which the caller needs it to be durable.
+ * \return
+ *      True if this call synced the head, false if there was nothing to do.
+ */
+bool
+Log::syncHead(Head& head, LogSegment* segment, uint32_t desiredSyncedLength)
+{
+    SpinLock::Guard _(head.syncLock);
+    // Check whether we need to sync once again after grabbing the syncLock.
+    // Previous sync may have synced the desired portion already.
+    if (desiredSyncedLength <= segment->syncedLength)
+        return false;
+
+    Tub<SpinLock::Guard> lock;
+    lock.construct(head.appendLock);
+    LogSegment* current = head.segment;
+    if (current == NULL)
+        return false;
+
+    // Get the latest segment length and certificate. This allows us to
+    // batch up other appends that came in while we were waiting.
+    SegmentCertificate certificate;
+    uint32_t appendedLength = current->getAppendedLength(&certificate);
+
+    // Drop the append lock. We don't want to block other appending
+    // threads while we sync.
+    lock.destroy();
 
-    if (mustNotFail)
-        return segmentManager->allocHeadSegment(SegmentManager::MUST_NOT_FAIL);
-    else
-        return segmentManager->allocHeadSegment();
+    current->replicatedSegment->sync(appendedLength, &certificate);
+    current->syncedLength = appendedLength;
+    return true;
 }
 
 } // namespace
@@ -22,6 +22,7 @@
 
 #include "AbstractLog.h"
 #include "BoostIntrusive.h"
+#include "Histogram.h"
 #include "LogEntryTypes.h"
 #include "LogEntryHandlers.h"
 #include "Segment.h"
@@ -63,10 +64,18 @@ class ServerConfig;
  * replicated. If the data must be made durable before continuing, code must
  * explicitly invoke the sync() method to flush all previous appends to backups.
  *
- * This class is thread-safe. Multiple threads may invoke append() in parallel,
- * but all appends are serialized by a single SpinLock. The sync() method will
- * batch multiple append operations to backups to improve throughput, especially
- * when individual entries are small.
+ * This class is thread-safe. Multiple threads may invoke append() in parallel.
+ * By default all appends are serialized by a single SpinLock. If the server is
+ * configured with several log heads (ServerConfig::Master::numLogHeads), each
+ * thread appends to one of several concurrently open head segments instead,
+ * and only threads sharing a head are serialized. The log is then a
+ * collection of interleaved segment chains that are replicated independently
+ * and tied together by the log digest (see LogDigest). The sync() method will
+ * batch multiple append operations to backups to improve throughput,
+ * especially when individual entries are small. If configured to (see
+ * ServerConfig::Master::syncGroupCommitMicros), it will also briefly hold
+ * back replication when syncs are arriving quickly so that more of them are
+ * covered by each backup write.
  */
 class Log : public AbstractLog {
   public:
@@ -83,10 +92,49 @@ class Log : public AbstractLog {
     void getMetrics(ProtoBuf::LogMetrics& m);
     void sync();
     void syncTo(Log::Reference reference);
+    bool isSynced(Log::Reference reference);
     LogPosition rollHeadOver();
 
   PRIVATE:
-    LogSegment* allocNextSegment(bool mustNotFail);
+    /**
+     * Group commit state for one of the log's heads. Used by sync() to
+     * estimate how quickly syncs are arriving on the head, and so how long
+     * it is worth waiting for more of them before replicating.
+     */
+    class GroupCommit {
+      public:
+        GroupCommit()
+            : arrivals(0),
+              lastArrival(0),
+              averageGap(~0UL),
+              arrivalsAtLastSync(0)
+        {
+        }
+
+        /// Total number of sync() calls on this head. Only incremented while
+        /// holding the head's appendLock, after the caller's appends.
+        std::atomic<uint64_t> arrivals;
+
+        /// Cycles::rdtsc() time of the most recent sync() call on this head.
+        std::atomic<uint64_t> lastArrival;
+
+        /// Exponentially-weighted moving average of the number of cycles
+        /// between consecutive sync() calls on this head.
+        std::atomic<uint64_t> averageGap;
+
+        /// Value of #arrivals when the head was last replicated. Protected
+        /// by the head's syncLock.
+        uint64_t arrivalsAtLastSync;
+
+        DISALLOW_COPY_AND_ASSIGN(GroupCommit);
+    };
+
+    LogSegment* allocNextSegment(bool mustNotFail, uint32_t headIndex);
+    void recordSyncArrival(GroupCommit& group);
+    uint64_t waitForGroupCommit(GroupCommit& group);
+    void sync(Head& head);
+    bool syncHead(Head& head, LogSegment* segment,
+                  uint32_t desiredSyncedLength);
 
     INTRUSIVE_LIST_TYPEDEF(LogSegment, listEntries) SegmentList;
 
@@ -100,14 +148,18 @@ class Log : public AbstractLog {
     /// method.
     LogCleaner* cleaner;
 
-    /// Lock used to serialize calls to ReplicatedSegment::sync(). This both
-    /// protects the ReplicatedSegment from concurrent access and queues up
-    /// syncs in the log so that multiple appends can be flushed to backups
-    /// in the same RPC.
-    ///
-    /// If both this lock and the AbstractLog::appendLock need to be taken,
-    /// this one must be acquired first to avoid deadlock.
-    SpinLock syncLock;
+    /// Longest time, in Cycles::rdtsc() ticks, that sync() will wait for
+    /// other syncs to arrive before replicating. 0 disables group commit.
+    /// See ServerConfig::Master::syncGroupCommitMicros.
+    uint64_t groupCommitMaxWait;
+
+    /// Group commit state for each entry in AbstractLog::heads.
+    std::unique_ptr<GroupCommit[]> groupCommits;
+
+    /// If non-NULL, invoked by waitForGroupCommit() each time it polls for
+    /// new arrivals, so that unit tests can advance Cycles::mockTscValue and
+    /// simulate syncs from other threads.
+    void (*testingGroupCommitPoll)(GroupCommit& group);
 
     /// Various event counters and performance measurements taken during log
     /// operation.
@@ -116,6 +168,9 @@ class Log : public AbstractLog {
         Metrics()
             : totalSyncCalls(0)
             , totalSyncTicks(0)
+            , lock("Log::Metrics::lock")
+            , syncBatchSizeHistogram(256, 1)
+            , syncWaitHistogram(1000, 1)
         {
         }
 
@@ -124,6 +179,18 @@ class Log : public AbstractLog {
 
         /// Total number of cpu cycles spent syncing appended log entries.
         uint64_t totalSyncTicks;
+
+        /// Protects the histograms below, which may be updated by threads
+        /// syncing different heads at the same time.
+        SpinLock lock;
+
+        /// Number of sync() calls whose appends were covered by each
+        /// replication of a head to backups.
+        Histogram syncBatchSizeHistogram;
+
+        /// Time, in microseconds, that each replication of a head was held
+        /// back waiting for more syncs to arrive (see waitForGroupCommit()).
+        Histogram syncWaitHistogram;
     } metrics;
 
     friend class LogIterator;
@@ -61,6 +61,7 @@ LogCleaner::LogCleaner(Context* context,
       writeCostThreshold(config->master.cleanerWriteCostThreshold),
       disableInMemoryCleaning(config->master.disableInMemoryCleaning),
       numThreads(config->master.cleanerThreadCount),
+      coldCompressionSeconds(config->master.coldCompressionSeconds),
       segletSize(config->segletSize),
       segmentSize(config->segmentSize),
       activeThreads(0),
@@ -329,6 +330,10 @@ LogCleaner::doMemoryCleaning()
     assert(survivor != NULL);
     waitTicks.stop();
 
+    // Compaction doesn't mix data from different segments, so a cold
+    // segment compacts into another cold one.
+    survivor->cold = segment->cold;
+
     localMetrics.totalBytesInCompactedSegments +=
         segment->getSegletsAllocated() * segletSize;
     uint32_t liveScannedEntryTotalLengths[TOTAL_LOG_ENTRY_TYPES] = { 0 };
@@ -354,7 +359,8 @@ LogCleaner::doMemoryCleaning()
                                           reference,
                                           survivor,
                                           &localMetrics,
-                                          &bytesAppended);
+                                          &bytesAppended,
+                                          segment->cold);
             if (expect_false(s == RELOCATION_FAILED))
                 throw FatalError(HERE, "Entry didn't fit into survivor!");
 
@@ -600,6 +606,11 @@ LogCleaner::getSortedEntries(LogSegmentVector& segmentsToClean,
             segment->getMemoryUtilization());
         onDiskMetrics.cleanedSegmentDiskHistogram.storeSample(
             segment->getDiskUtilization());
+        if (segment->cold) {
+            localMetrics->totalColdSegmentsCleaned++;
+            onDiskMetrics.cleanedColdSegmentMemoryHistogram.storeSample(
+                segment->getMemoryUtilization());
+        }
     }
 
     TEST_LOG("%lu entries extracted from %lu segments",
@@ -611,6 +622,10 @@ LogCleaner::getSortedEntries(LogSegmentVector& segmentsToClean,
  * survivor segments in order and alert their owning module (MasterService,
  * usually), that they've been relocated.
  *
+ * If coldCompressionSeconds is set, entries older than that are written to
+ * survivors of their own, with any objects among them compressed. Since the
+ * entries are sorted by age, the cold ones all come first.
+ *
  * \param entries
  *      Vector the entries from segments being cleaned that may need to be
  *      relocated.
@@ -637,18 +652,30 @@ LogCleaner::relocateLiveEntries(EntryVector& entries,
     uint32_t currentLiveEntries[TOTAL_LOG_ENTRY_TYPES] = { 0 };
     uint32_t currentLiveEntryLengths[TOTAL_LOG_ENTRY_TYPES] = { 0 };
 
+    uint32_t now = WallTime::secondsTimestamp();
+    uint32_t coldCutoff = 0;
+    if (coldCompressionSeconds != 0 && now >= coldCompressionSeconds)
+        coldCutoff = now - coldCompressionSeconds;
+
     foreach (Entry& entry, entries) {
         Buffer buffer;
         LogEntryType type = entry.reference.getEntry(
             &segmentManager.getAllocator(), &buffer);
         Log::Reference reference = entry.reference;
         uint32_t bytesAppended = 0;
+
+        // Entries without a timestamp (0) are never considered cold. Offering
+        // the relocator no survivor when its temperature doesn't match makes
+        // a live entry fail, which starts a new survivor below.
+        bool cold = entry.timestamp != 0 && entry.timestamp <= coldCutoff;
+        bool survivorMatches = survivor != NULL && survivor->cold == cold;
         RelocStatus s = relocateEntry(type,
                                       buffer,
                                       reference,
-                                      survivor,
+                                      survivorMatches ? survivor : NULL,
                                       localMetrics,
-                                      &bytesAppended);
+                                      &bytesAppended,
+                                      cold);
 
         if (expect_false(s == RELOCATION_FAILED)) {
             if (survivor != NULL) {
@@ -673,13 +700,17 @@ LogCleaner::relocateLiveEntries(EntryVector& entries,
             assert(survivor != NULL);
             waitTicks.stop();
             outSurvivors.push_back(survivor);
+            survivor->cold = cold;
+            if (cold)
+                localMetrics->totalColdSurvivorsCreated++;
 
             s = relocateEntry(type,
                               buffer,
                               reference,
                               survivor,
                               localMetrics,
-                              &bytesAppended);
+                              &bytesAppended,
+                              cold);
             if (s == RELOCATION_FAILED)
                 throw FatalError(HERE, "Entry didn't fit into empty survivor!");
         }
@@ -692,6 +723,11 @@ LogCleaner::relocateLiveEntries(EntryVector& entries,
                 buffer.size();
             currentLiveEntries[type]++;
             currentLiveEntryLengths[type] += bytesAppended;
+            if (cold) {
+                localMetrics->totalColdEntriesRelocated++;
+                localMetrics->totalColdBytesBeforeCompression += buffer.size();
+                localMetrics->totalColdBytesAfterCompression += bytesAppended;
+            }
         }
 
         totalEntryBytesAppended += bytesAppended;
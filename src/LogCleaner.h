@@ -295,6 +295,9 @@ class LogCleaner {
      * \param outBytesAppended
      *      The total number of bytes appended during relocation (including any
      *      metadata) is returned in this counter. Must not be NULL.
+     * \param compress
+     *      If true, a relocated object is compressed in the survivor (see
+     *      Segment::appendCompressed).
      * \return
      *      Returns true if the operation succeeded (the entry was successfully
      *      relocated or was not needed and no relocation was performed).
@@ -309,9 +312,10 @@ class LogCleaner {
                   Log::Reference reference,
                   LogSegment* survivor,
                   T* metrics,
-                  uint32_t* outBytesAppended)
+                  uint32_t* outBytesAppended,
+                  bool compress = false)
     {
-        LogEntryRelocator relocator(survivor, buffer.size());
+        LogEntryRelocator relocator(survivor, buffer.size(), compress);
         *outBytesAppended = 0;
 
         {
@@ -369,6 +373,11 @@ class LogCleaner {
     /// keep up with higher write rates and memory utilizations.
     const int numThreads;
 
+    /// Entries written at least this many seconds before a disk cleaning
+    /// pass are considered cold: they're relocated to survivor segments of
+    /// their own and objects among them are compressed. 0 disables this.
+    uint32_t coldCompressionSeconds;
+
     /// Size of each seglet in bytes. Used to calculate the best segment for in-
     /// memory cleaning.
     uint32_t segletSize;
@@ -262,7 +262,13 @@ class OnDisk {
           lastRunTimestamp(0),
           cleanedSegmentMemoryHistogram(101, 1),
           cleanedSegmentDiskHistogram(101, 1),
-          allSegmentsDiskHistogram(101, 1)
+          allSegmentsDiskHistogram(101, 1),
+          totalColdSegmentsCleaned(0),
+          totalColdSurvivorsCreated(0),
+          totalColdEntriesRelocated(0),
+          totalColdBytesBeforeCompression(0),
+          totalColdBytesAfterCompression(0),
+          cleanedColdSegmentMemoryHistogram(101, 1)
     {
         memset(totalEntriesScanned, 0, sizeof(totalEntriesScanned));
         memset(totalLiveEntriesScanned, 0, sizeof(totalLiveEntriesScanned));
@@ -324,6 +330,15 @@ class OnDisk {
             *m.mutable_cleaned_segment_disk_histogram());
         allSegmentsDiskHistogram.serialize(
             *m.mutable_all_segments_disk_histogram());
+        m.set_total_cold_segments_cleaned(totalColdSegmentsCleaned);
+        m.set_total_cold_survivors_created(totalColdSurvivorsCreated);
+        m.set_total_cold_entries_relocated(totalColdEntriesRelocated);
+        m.set_total_cold_bytes_before_compression(
+            totalColdBytesBeforeCompression);
+        m.set_total_cold_bytes_after_compression(
+            totalColdBytesAfterCompression);
+        cleanedColdSegmentMemoryHistogram.serialize(
+            *m.mutable_cleaned_cold_segment_memory_histogram());
     }
 
     /**
@@ -372,6 +387,11 @@ class OnDisk {
         MERGE_FIELD(relocationAppendTicks);
         MERGE_FIELD(closeSurvivorTicks);
         MERGE_FIELD(survivorSyncTicks);
+        MERGE_FIELD(totalColdSegmentsCleaned);
+        MERGE_FIELD(totalColdSurvivorsCreated);
+        MERGE_FIELD(totalColdEntriesRelocated);
+        MERGE_FIELD(totalColdBytesBeforeCompression);
+        MERGE_FIELD(totalColdBytesAfterCompression);
 #undef MERGE_FIELD
     }
 
@@ -533,6 +553,32 @@ class OnDisk {
     /// Histogram of disk space utilizations for all segments prior to running
     /// a disk cleaner pass. Includes segments chosen to clean in that pass.
     Histogram allSegmentsDiskHistogram;
+
+    /// Total number of cleaned segments that held only cold (compressed)
+    /// data. Also counted in totalSegmentsCleaned.
+    CounterType totalColdSegmentsCleaned;
+
+    /// Total number of survivor segments created to hold cold data. Also
+    /// counted in totalSurvivorsCreated.
+    CounterType totalColdSurvivorsCreated;
+
+    /// Total number of live entries relocated into cold survivor segments.
+    CounterType totalColdEntriesRelocated;
+
+    /// Total uncompressed length of the entries counted in
+    /// totalColdEntriesRelocated.
+    CounterType totalColdBytesBeforeCompression;
+
+    /// Total number of bytes (including segment metadata) appended to cold
+    /// survivor segments for the entries in totalColdEntriesRelocated.
+    /// Divide totalColdBytesBeforeCompression by this to get the average
+    /// compression ratio.
+    CounterType totalColdBytesAfterCompression;
+
+    /// Like cleanedSegmentMemoryHistogram, but only for cold segments. Cold
+    /// data is rarely overwritten, so these segments should be much fuller
+    /// than the rest when cleaned.
+    Histogram cleanedColdSegmentMemoryHistogram;
 };
 
 /**
@@ -320,6 +320,42 @@ TEST_F(LogCleanerTest, doDiskCleaning) {
         TestLog::get());
 }
 
+TEST_F(LogCleanerTest, relocateLiveEntries_cold) {
+    entryHandlers.attemptToRelocate = true;
+    cleaner.coldCompressionSeconds = 100;
+    LogSegment* s = segmentManager.allocHeadSegment();
+    string data(1000, 'x');
+    Log::Reference oldReference, newReference;
+    s->append(LOG_ENTRY_TYPE_OBJ, data.data(), 1000, &oldReference);
+    s->append(LOG_ENTRY_TYPE_OBJ, data.data(), 1000, &newReference);
+
+    // Entries come sorted by age, so the cold ones are first.
+    LogCleaner::EntryVector entries;
+    entries.push_back(LogCleaner::Entry(oldReference, 1));
+    entries.push_back(LogCleaner::Entry(newReference,
+                                        WallTime::secondsTimestamp()));
+
+    LogSegmentVector survivors;
+    LogCleanerMetrics::OnDisk<uint64_t> metrics;
+    cleaner.relocateLiveEntries(entries, survivors, &metrics);
+    ASSERT_EQ(2U, survivors.size());
+    EXPECT_TRUE(survivors[0]->cold);
+    EXPECT_FALSE(survivors[1]->cold);
+
+    EXPECT_EQ(1U, metrics.totalColdSurvivorsCreated);
+    EXPECT_EQ(1U, metrics.totalColdEntriesRelocated);
+    EXPECT_EQ(1000U, metrics.totalColdBytesBeforeCompression);
+    EXPECT_GT(100U, metrics.totalColdBytesAfterCompression);
+
+    Buffer buffer;
+    SegmentIterator it(*survivors[0]);
+    while (it.getType() != LOG_ENTRY_TYPE_OBJ)
+        it.next();
+    EXPECT_EQ(LOG_ENTRY_TYPE_COMPRESSED, it.currentHeader.getType());
+    it.appendToBuffer(buffer);
+    EXPECT_EQ(data, TestUtil::toString(&buffer));
+}
+
 // The tests below were disabled a long time ago by Steve Rumble and
 // never got reworked to reflect his changes, so they are currently
 // broken.
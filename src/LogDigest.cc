@@ -13,18 +13,23 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <algorithm>
+
 #include "Common.h"
 #include "ShortMacros.h"
 #include "LogDigest.h"
 
 namespace RAMCloud {
 
+const uint64_t LogDigest::CONCURRENT_HEADS_MARKER;
+
 /**
  * Create a new, empty log digest.
  */
 LogDigest::LogDigest()
     : header(),
       segmentIds(),
+      markerIndex(0),
       checksum()
 {
     header.checksum = checksum.getResult();
@@ -37,6 +42,7 @@ LogDigest::LogDigest()
 LogDigest::LogDigest(const void* buffer, uint32_t length)
     : header(),
       segmentIds(),
+      markerIndex(0),
       checksum()
 {
     Crc32C actualChecksum;
@@ -60,6 +66,8 @@ LogDigest::LogDigest(const void* buffer, uint32_t length)
         actualChecksum.update(&ids[i], sizeof(ids[i]));
         segmentIds.push_back(ids[i]);
     }
+    markerIndex = std::find(segmentIds.begin(), segmentIds.end(),
+                            CONCURRENT_HEADS_MARKER) - segmentIds.begin();
 
     if (actualChecksum.getResult() != header.checksum) {
         LOG(WARNING, "invalid digest checksum (computed 0x%08x, expect 0x%08x",
@@ -69,14 +77,29 @@ LogDigest::LogDigest(const void* buffer, uint32_t length)
 }
 
 /**
- * Add a segment id to this LogDigest.
+ * Add a segment id to this LogDigest. Must not be called after
+ * addConcurrentHead().
  */
 void
 LogDigest::addSegmentId(uint64_t id)
 {
-    segmentIds.push_back(id);
-    checksum.update(&segmentIds.back(), sizeof(segmentIds.back()));
-    header.checksum = checksum.getResult();
+    assert(markerIndex == segmentIds.size());
+    append(id);
+    markerIndex = segmentIds.size();
+}
+
+/**
+ * Add the id of a segment that is the head of another of the log's streams
+ * (see AbstractLog::Head) to this LogDigest. The segment is part of the log
+ * like those added with addSegmentId(), but isConcurrentHead() will return
+ * true for it.
+ */
+void
+LogDigest::addConcurrentHead(uint64_t id)
+{
+    if (markerIndex == segmentIds.size())
+        append(CONCURRENT_HEADS_MARKER);
+    append(id);
 }
 
 /**
@@ -85,7 +108,9 @@ LogDigest::addSegmentId(uint64_t id)
 uint32_t
 LogDigest::size() const
 {
-    return downCast<uint32_t>(segmentIds.size());
+    if (markerIndex == segmentIds.size())
+        return downCast<uint32_t>(segmentIds.size());
+    return downCast<uint32_t>(segmentIds.size() - 1);
 }
 
 /**
@@ -94,10 +119,33 @@ LogDigest::size() const
 uint64_t
 LogDigest::operator[](size_t index) const
 {
-    assert(index < segmentIds.size());
+    assert(index < size());
+    if (index >= markerIndex)
+        index++;
     return segmentIds[index];
 }
 
+/**
+ * Return true if the N'th segment id stored in this digest was added with
+ * addConcurrentHead().
+ */
+bool
+LogDigest::isConcurrentHead(size_t index) const
+{
+    assert(index < size());
+    return index >= markerIndex;
+}
+
+/**
+ * Return true if any ids were added with addConcurrentHead(), which means
+ * the log this digest belongs to has several heads.
+ */
+bool
+LogDigest::hasConcurrentHeads() const
+{
+    return markerIndex < segmentIds.size();
+}
+
 /**
  * Append this digest to the given buffer, typically so that it can be sent
  * via RPC or appended to a log. This method does no copying, so it should
@@ -113,4 +161,15 @@ LogDigest::appendToBuffer(Buffer& buffer) const
         downCast<uint32_t>(sizeof(segmentIds.front()) * segmentIds.size()));
 }
 
+/**
+ * Add a 64-bit word to the serialized form of this digest.
+ */
+void
+LogDigest::append(uint64_t word)
+{
+    segmentIds.push_back(word);
+    checksum.update(&segmentIds.back(), sizeof(segmentIds.back()));
+    header.checksum = checksum.getResult();
+}
+
 } // namespace RAMCloud
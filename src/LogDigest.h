@@ -36,17 +36,31 @@ struct LogDigestException : public Exception {
  * only find copies of all segments referenced by the head's LogDigest. If it
  * finds them all (and they pass checksums), it knows it has the complete log.
  *
+ * A log with several heads (see AbstractLog::Head) also records which of the
+ * segments were the heads of the log's other streams when the digest was
+ * written. These are still open; recovery uses them to detect that one of
+ * those streams has moved on to a newer segment that can't be found.
  */
 class LogDigest {
   public:
     LogDigest();
     LogDigest(const void* buffer, uint32_t length);
     void addSegmentId(uint64_t id);
+    void addConcurrentHead(uint64_t id);
     uint32_t size() const;
     uint64_t operator[](size_t index) const;
+    bool isConcurrentHead(size_t index) const;
+    bool hasConcurrentHeads() const;
     void appendToBuffer(Buffer& buffer) const;
 
   PRIVATE:
+    void append(uint64_t word);
+
+    /// When serialized, the ids added with addConcurrentHead() follow
+    /// this value, which is never a valid segment id. Digests without
+    /// concurrent heads don't contain it.
+    static const uint64_t CONCURRENT_HEADS_MARKER = ~0UL;
+
     /**
      * When serialized in a buffer, the log digest starts with this header.
      */
@@ -58,9 +72,15 @@ class LogDigest {
     /// added.
     Header header;
 
-    /// Vector containing all of the segment ids added to this digest.
+    /// Vector containing all of the segment ids added to this digest, in
+    /// serialized form (that is, including CONCURRENT_HEADS_MARKER, if any
+    /// concurrent heads were added).
     vector<uint64_t> segmentIds;
 
+    /// Index in #segmentIds of CONCURRENT_HEADS_MARKER. Equal to the size
+    /// of #segmentIds if there is no marker.
+    size_t markerIndex;
+
     /// Current accumulated checksum. Updated each time a new segment id is
     /// added.
     Crc32C checksum;
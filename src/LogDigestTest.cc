@@ -112,6 +112,41 @@ TEST_F(LogDigestTest, addSegmentId_and_index_operator)
     }
 }
 
+TEST_F(LogDigestTest, addConcurrentHead)
+{
+    LogDigest d;
+    d.addSegmentId(5);
+    d.addSegmentId(9);
+    d.addConcurrentHead(7);
+    d.addConcurrentHead(8);
+    EXPECT_EQ(4U, d.size());
+    EXPECT_EQ(5U, d[0]);
+    EXPECT_EQ(9U, d[1]);
+    EXPECT_EQ(7U, d[2]);
+    EXPECT_EQ(8U, d[3]);
+    EXPECT_FALSE(d.isConcurrentHead(1));
+    EXPECT_TRUE(d.isConcurrentHead(2));
+    EXPECT_TRUE(d.isConcurrentHead(3));
+
+    // The marker survives serialization.
+    Buffer buffer;
+    d.appendToBuffer(buffer);
+    EXPECT_EQ(4U + 8 * 5, buffer.size());
+    LogDigest d2(buffer.getRange(0, buffer.size()), buffer.size());
+    EXPECT_EQ(4U, d2.size());
+    EXPECT_EQ(9U, d2[1]);
+    EXPECT_EQ(7U, d2[2]);
+    EXPECT_FALSE(d2.isConcurrentHead(1));
+    EXPECT_TRUE(d2.isConcurrentHead(2));
+    EXPECT_TRUE(d2.hasConcurrentHeads());
+
+    // Digests without concurrent heads are unchanged.
+    LogDigest d3;
+    d3.addSegmentId(5);
+    EXPECT_FALSE(d3.isConcurrentHead(0));
+    EXPECT_FALSE(d3.hasConcurrentHeads());
+}
+
 TEST_F(LogDigestTest, appendToBuffer)
 {
     LogDigest d;
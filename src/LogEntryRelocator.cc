@@ -31,11 +31,17 @@ namespace RAMCloud {
  *      expects (it should always write an entry that is at most as large as
  *      the one being relocated; typically it is exactly the entry being
  *      relocated).
+ * \param compress
+ *      If true, an object appended is compressed when that saves space. This
+ *      is used when the cleaner writes survivor segments of cold data. Other
+ *      entry types are small and are never compressed.
  */
 LogEntryRelocator::LogEntryRelocator(LogSegment* segment,
-                                     uint32_t maximumLength)
+                                     uint32_t maximumLength,
+                                     bool compress)
     : segment(segment),
       maximumLength(maximumLength),
+      compress(compress),
       reference(),
       outOfSpace(false),
       didAppend(false),
@@ -78,7 +84,12 @@ LogEntryRelocator::append(LogEntryType type, Buffer& buffer)
     }
 
     uint32_t priorLength = segment->getAppendedLength();
-    if (!segment->append(type, buffer, &reference)) {
+    bool appended;
+    if (compress && type == LOG_ENTRY_TYPE_OBJ)
+        appended = segment->appendCompressed(type, buffer, &reference);
+    else
+        appended = segment->append(type, buffer, &reference);
+    if (!appended) {
         outOfSpace = true;
         return false;
     }
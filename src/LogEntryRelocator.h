@@ -50,7 +50,9 @@ namespace RAMCloud {
  */
 class LogEntryRelocator {
   public:
-    LogEntryRelocator(LogSegment* segment, uint32_t maximumLength);
+    LogEntryRelocator(LogSegment* segment,
+                      uint32_t maximumLength,
+                      bool compress = false);
     bool append(LogEntryType type, Buffer& buffer);
     Log::Reference getNewReference();
     uint64_t getAppendTicks();
@@ -67,6 +69,10 @@ class LogEntryRelocator {
     /// no larger than the original (typically it is exactly the original).
     uint32_t maximumLength;
 
+    /// If true, objects are compressed as they are appended (see
+    /// Segment::appendCompressed).
+    bool compress;
+
     /// If an append was done this reference points to it.
     Log::Reference reference;
 
@@ -57,6 +57,7 @@ TEST_F(LogEntryRelocatorTest, constructor) {
     LogEntryRelocator r(NULL, 50);
     EXPECT_EQ(static_cast<LogSegment*>(NULL), r.segment);
     EXPECT_EQ(50U, r.maximumLength);
+    EXPECT_FALSE(r.compress);
     EXPECT_FALSE(r.outOfSpace);
     EXPECT_FALSE(r.didAppend);
     EXPECT_EQ(0U, r.appendTicks);
@@ -100,6 +101,28 @@ TEST_F(LogEntryRelocatorTest, append) {
     //EXPECT_EQ(s->liveBytes, bytesBefore); XXXXX
 }
 
+TEST_F(LogEntryRelocatorTest, append_compress) {
+    LogSegment* s = segmentManager.allocHeadSegment();
+    string data(500, 'x');
+    Buffer buffer;
+    buffer.appendExternal(data.data(), 500);
+
+    LogEntryRelocator r(s, 500, true);
+    EXPECT_TRUE(r.append(LOG_ENTRY_TYPE_OBJ, buffer));
+    EXPECT_GT(100U, r.getTotalBytesAppended());
+    Log::Reference reference = r.getNewReference();
+    EXPECT_EQ(LOG_ENTRY_TYPE_COMPRESSED,
+              s->getEntryHeader(s->getOffset(reference)).getType());
+    Buffer readBack;
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, s->getEntry(reference, &readBack));
+    EXPECT_EQ(data, TestUtil::toString(&readBack));
+
+    // Only objects are compressed.
+    LogEntryRelocator r2(s, 500, true);
+    EXPECT_TRUE(r2.append(LOG_ENTRY_TYPE_OBJTOMB, buffer));
+    EXPECT_EQ(503U, r2.getTotalBytesAppended());
+}
+
 TEST_F(LogEntryRelocatorTest, getNewReference_noAppend) {
     LogEntryRelocator r(NULL, 50);
     EXPECT_THROW(r.getNewReference(), FatalError);
@@ -50,6 +50,8 @@ toString(LogEntryType type)
         return "Transaction Decision Record";
     case LOG_ENTRY_TYPE_TXPLIST:
         return "Transaction Participant List Record";
+    case LOG_ENTRY_TYPE_COMPRESSED:
+        return "Compressed Entry";
     default:
         return "<<Unknown>>";
     }
@@ -61,6 +61,12 @@ enum LogEntryType {
     /// See ParticipantList
     LOG_ENTRY_TYPE_TXPLIST,
 
+    /// Wraps another entry whose contents were compressed by the cleaner.
+    /// Segment and SegmentIterator unwrap these transparently, so only code
+    /// that looks at raw EntryHeaders should ever see this type. See
+    /// Segment::appendCompressed.
+    LOG_ENTRY_TYPE_COMPRESSED,
+
     /// Not a type, but rather the total number of types we have defined.
     /// This is currently restricted by the lower 6 bits in a uint8_t field
     /// in Segment.h's Segment::EntryHeader. RAMCloud will probably collapse
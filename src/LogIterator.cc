@@ -48,7 +48,7 @@ LogIterator::LogIterator(Log& log)
       done(false),
       headReached(false)
 {
-    if (log.head == NULL) {
+    if (getNewestHead() == NULL) {
         // Log is empty; not sure this should ever happen in practice.
         done = true;
     }
@@ -77,8 +77,9 @@ LogIterator::next()
         // updates and given any operations in progress a chance to complete.
         // That means that all of the relevant entries are now present
         // in the log. Record the current log head position: it will
-        // define the end of the iteration.
-        lastSegment = log.head;
+        // define the end of the iteration. If the log has several heads,
+        // the iteration must cover all of them.
+        lastSegment = getNewestHead();
         SegmentCertificate dummy;
         lastSegmentLength = lastSegment->getAppendedLength(&dummy);
 
@@ -120,8 +121,9 @@ LogIterator::next()
         }
     }
 
-    if (segmentList.back() == log.head) {
-        headReached = true;
+    for (uint32_t i = 0; i < log.numHeads; i++) {
+        if (segmentList.back() == log.heads[i].segment)
+            headReached = true;
     }
 
     LogSegment* nextSegment = segmentList.back();
@@ -198,6 +200,23 @@ LogIterator::setBufferTo(Buffer& buffer)
  * PRIVATE METHODS
  ******************************************************************************/
 
+/**
+ * Return the log's head segment with the highest identifier (there is only
+ * one unless the log has several heads), or NULL if no head segment has been
+ * allocated yet.
+ */
+LogSegment*
+LogIterator::getNewestHead()
+{
+    LogSegment* newest = NULL;
+    for (uint32_t i = 0; i < log.numHeads; i++) {
+        LogSegment* segment = log.heads[i].segment;
+        if (segment != NULL && (newest == NULL || segment->id > newest->id))
+            newest = segment;
+    }
+    return newest;
+}
+
 /**
  * (Re-)Populate our internal list of active segments by querying the
  * SegmentManager for any active segments with IDs greater than or equal to the
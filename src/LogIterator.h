@@ -93,6 +93,7 @@ class LogIterator {
         }
     };
 
+    LogSegment* getNewestHead();
     void populateSegmentList(uint64_t nextSegmentId);
 
     /// Reference to the Log we're iterating.
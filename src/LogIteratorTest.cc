@@ -96,7 +96,7 @@ TEST_F(LogIteratorTest, constructor_singleSegmentLog) {
 
 TEST_F(LogIteratorTest, constructor_multiSegmentLog) {
     l.sync();
-    while (l.head == NULL || l.head->id == 1)
+    while (l.heads[0].segment == NULL || l.heads[0].segment->id == 1)
         l.append(LOG_ENTRY_TYPE_OBJ, data, sizeof(data));
     l.sync();
 
@@ -133,7 +133,7 @@ TEST_F(LogIteratorTest, next_computeLastSegment) {
     // Create one full segment and one incomplete segment in the log,
     // then iterate until the current head is reached.
     int writeCount = 0;
-    while (l.head == NULL || l.head->id < 2) {
+    while (l.heads[0].segment == NULL || l.heads[0].segment->id < 2) {
         l.append(LOG_ENTRY_TYPE_OBJ, data, sizeof(data));
         writeCount++;
     }
@@ -152,7 +152,7 @@ TEST_F(LogIteratorTest, next_computeLastSegment) {
     // then add yet more objects to the third segment. Then check how
     // far we can iterate (iteration must not include the third collection of
     // objects).
-    while (l.head->id < 3) {
+    while (l.heads[0].segment->id < 3) {
         l.append(LOG_ENTRY_TYPE_OBJ, data, sizeof(data));
         writeCount++;
     }
@@ -179,13 +179,13 @@ TEST_F(LogIteratorTest, next_multipleSegments) {
     // Create 3 segments in the log, count the objects in each
     // segment (only 1 object in the last segment).
     int seg1Count = 0, seg2Count = 0;
-    while (l.head == NULL || l.head->id < 2) {
+    while (l.heads[0].segment == NULL || l.heads[0].segment->id < 2) {
         l.append(LOG_ENTRY_TYPE_OBJ, data, sizeof(data));
         seg1Count++;
     }
     seg1Count--;                // Most recent object is in 2nd segment
     seg2Count = 1;
-    while (l.head->id < 3) {
+    while (l.heads[0].segment->id < 3) {
         l.append(LOG_ENTRY_TYPE_OBJ, data, sizeof(data));
         seg2Count++;
     }
@@ -220,7 +220,7 @@ TEST_F(LogIteratorTest, next_setLimitForHeadSegment) {
     int writeCount = 1;
     LogIterator i(l);
     EXPECT_TRUE(i.onHead());
-    while (l.head->id < 2) {
+    while (l.heads[0].segment->id < 2) {
         l.append(LOG_ENTRY_TYPE_OBJ, data, sizeof(data));
         writeCount++;
     }
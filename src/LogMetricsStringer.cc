@@ -268,6 +268,23 @@ LogMetricsStringer::getDiskCleanerMetrics()
         d(wrote) / elapsedTime / 1024 / 1024,
         d(wrote) / cleanerTime / 1024 / 1024);
 
+    Histogram coldMemoryUtil(
+        onDiskMetrics.cleaned_cold_segment_memory_histogram());
+    s += ls + format("  Cold Segments Cleaned:         %lu (%lu survivors "
+        "created; avg %lu%% memory util)\n",
+        onDiskMetrics.total_cold_segments_cleaned(),
+        onDiskMetrics.total_cold_survivors_created(),
+        coldMemoryUtil.getAverage());
+
+    uint64_t coldBefore = onDiskMetrics.total_cold_bytes_before_compression();
+    uint64_t coldAfter = onDiskMetrics.total_cold_bytes_after_compression();
+    s += ls + format("  Cold Entries Compressed:       %lu (%.2f MB -> "
+        "%.2f MB; ratio %.2f)\n",
+        onDiskMetrics.total_cold_entries_relocated(),
+        d(coldBefore) / 1024 / 1024,
+        d(coldAfter) / 1024 / 1024,
+        d(coldBefore) / d(coldAfter));
+
     s += ls + getSegmentEntriesScanned(&onDiskMetrics, cleanerTime);
 
     s += ls + format("  Total Time:                    %.3f sec "
@@ -500,11 +517,27 @@ LogMetricsStringer::getLogMetrics()
     s += ls + format("    Avg Per Operation (RPC):     %.2f us\n",
         syncTime * 1.0e6 / d(logMetrics->total_sync_calls()));
 
+    Histogram syncBatchSize(logMetrics->sync_batch_size_histogram());
+    Histogram syncWait(logMetrics->sync_wait_histogram());
+    s += ls + format("    Avg Syncs Per Replication:   %lu (max %lu)\n",
+        syncBatchSize.getAverage(), syncBatchSize.getMax());
+    s += ls + format("    Avg Group Commit Wait:       %lu us (max %lu us)\n",
+        syncWait.getAverage(), syncWait.getMax());
+
     double noMemTime = Cycles::toSeconds(logMetrics->total_no_space_ticks(),
                                          serverHz);
     s += ls + format("  Time Out of Memory:            %.3f sec (%.2f%%)\n",
         noMemTime, 100.0 * noMemTime / elapsedTime);
 
+    uint64_t decompressed = logMetrics->total_decompressed_entries();
+    double decompressTime = Cycles::toSeconds(
+        logMetrics->total_decompression_ticks(), serverHz);
+    s += ls + format("  Compressed Entries Read:       %lu (%.2f MB)\n",
+        decompressed,
+        d(logMetrics->total_decompressed_bytes()) / 1024 / 1024);
+    s += ls + format("    Avg Decompression Time:      %.2f us\n",
+        decompressTime * 1.0e6 / d(decompressed));
+
     s += ls + format("  Total (Dead or Alive) Entry Counts in All Segments:\n");
 
     const ProtoBuf::LogMetrics_SegmentMetrics& sm =
@@ -539,6 +572,17 @@ LogMetricsStringer::getLogMetrics()
         onDisk,
         100 * static_cast<double>(onDisk) / static_cast<double>(logSegments));
 
+    const ProtoBuf::LogMetrics_SegletMetrics& segletMetrics =
+        logMetrics->seglet_metrics();
+    uint64_t cacheAllocs = segletMetrics.local_cache_allocs();
+    uint64_t cacheRefills = segletMetrics.local_cache_refills();
+    s += ls + format("  Seglet Allocs From Core Cache: %.2f%% "
+        "(%lu refills, %lu spills, %lu flushes)\n",
+        100.0 * d(cacheAllocs) / d(cacheAllocs + cacheRefills),
+        cacheRefills,
+        segletMetrics.local_cache_spills(),
+        segletMetrics.local_cache_flushes());
+
     return s;
 }
 
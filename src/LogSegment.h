@@ -84,6 +84,7 @@ class LogSegment : public Segment {
           segmentSize(segmentSize),
           creationTimestamp(creationTimestamp),
           isEmergencyHead(isEmergencyHead),
+          cold(false),
           cleanedEpoch(0),
           cachedCleaningCostBenefitScore(0),
           cachedCompactionCostBenefitScore(0),
@@ -247,6 +248,13 @@ class LogSegment : public Segment {
     /// that is expected to live longer.
     const bool isEmergencyHead;
 
+    /// If true, this is a survivor segment the cleaner filled only with
+    /// entries older than the master's coldCompressionSeconds, compressing
+    /// the objects among them. The cleaner keeps such segments (and their
+    /// compacted and cleaned successors) apart from warmer data. Set only
+    /// before the segment is handed back to the SegmentManager.
+    bool cold;
+
     /// The epoch value when cleaning was completed on this segment. Once no
     /// more RPCs in the system exist with epochs less than or equal to this,
     /// there can be no more outstanding references into the segment and its
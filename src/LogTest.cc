@@ -13,6 +13,8 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <thread>
+
 #include "TestUtil.h"
 
 #include "Segment.h"
@@ -149,7 +151,7 @@ TEST_F(LogTest, constructor) {
                                    &masterTableMetadata);
     Log l2(&context, &serverConfig, &entryHandlers,
            &segmentManager2, &replicaManager);
-    EXPECT_EQ(static_cast<LogSegment*>(NULL), l2.head);
+    EXPECT_EQ(static_cast<LogSegment*>(NULL), l2.heads[0].segment);
     EXPECT_NE(static_cast<LogCleaner*>(NULL), l2.cleaner);
 }
 
@@ -196,7 +198,8 @@ TEST_F(LogTest, enableCleaner_and_disableCleaner) {
 
 TEST_F(LogTest, getHead) {
     EXPECT_EQ(l.getHead(),
-            LogPosition(l.head->id, l.head->getAppendedLength()));
+            LogPosition(l.heads[0].segment->id,
+                        l.heads[0].segment->getAppendedLength()));
     LogPosition oldPos = l.getHead();
     l.append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
     EXPECT_LT(oldPos, l.getHead());
@@ -216,11 +219,13 @@ TEST_F(LogTest, sync) {
 
     TestLog::reset();
     l.append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
-    EXPECT_NE(l.head->syncedLength, l.head->getAppendedLength());
+    EXPECT_NE(l.heads[0].segment->syncedLength,
+              l.heads[0].segment->getAppendedLength());
     l.sync();
     EXPECT_EQ("sync: syncing segment 1 to offset 84 | sync: log synced",
         TestLog::get());
-    EXPECT_EQ(l.head->syncedLength, l.head->getAppendedLength());
+    EXPECT_EQ(l.heads[0].segment->syncedLength,
+              l.heads[0].segment->getAppendedLength());
 
     TestLog::reset();
     l.sync();
@@ -231,8 +236,8 @@ TEST_F(LogTest, sync) {
     TestLog::reset();
     l.append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
     {
-        SpinLock::Guard lock(l.appendLock);
-        l.allocNewWritableHead();
+        SpinLock::Guard lock(l.heads[0].appendLock);
+        l.allocNewWritableHead(l.heads[0]);
     }
     l.sync();
     EXPECT_EQ("sync: syncing segment 2 to offset 88 | sync: log synced",
@@ -241,6 +246,88 @@ TEST_F(LogTest, sync) {
     EXPECT_EQ(5U, l.metrics.totalSyncCalls);
 }
 
+TEST_F(LogTest, sync_groupCommitMetrics) {
+    l.append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
+    l.sync();
+
+    // Pretend another thread appended and is waiting to sync as well.
+    l.append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
+    l.recordSyncArrival(l.groupCommits[0]);
+    l.append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
+    l.sync();
+    l.sync();
+    // The constructor's sync also replicated the head.
+    EXPECT_EQ(3U, l.metrics.syncBatchSizeHistogram.getTotalSamples());
+    EXPECT_EQ(3U, l.metrics.syncWaitHistogram.getTotalSamples());
+    EXPECT_EQ(0U, l.metrics.syncWaitHistogram.getMax());
+
+    ProtoBuf::LogMetrics m;
+    l.getMetrics(m);
+    Histogram batchSizes(m.sync_batch_size_histogram());
+    EXPECT_EQ(3U, batchSizes.getTotalSamples());
+    EXPECT_EQ(2U, batchSizes.getMax());
+}
+
+TEST_F(LogTest, recordSyncArrival) {
+    Log::GroupCommit& group = l.groupCommits[0];
+    uint64_t arrivals = group.arrivals;
+    Cycles::mockTscValue = 1000;
+    l.recordSyncArrival(group);
+    EXPECT_EQ(arrivals + 1, group.arrivals);
+    EXPECT_EQ(1000U, group.lastArrival.load());
+
+    // The first gap measured becomes the average.
+    group.averageGap = ~0UL;
+    Cycles::mockTscValue = 1800;
+    l.recordSyncArrival(group);
+    EXPECT_EQ(800U, group.averageGap.load());
+
+    // Later gaps move the average by an eighth of the difference.
+    Cycles::mockTscValue = 10600;
+    l.recordSyncArrival(group);
+    EXPECT_EQ(1800U, group.averageGap.load());
+    EXPECT_EQ(10600U, group.lastArrival.load());
+    Cycles::mockTscValue = 0;
+}
+
+// Number of sync arrivals advanceGroupCommitClock simulates on each poll.
+static uint64_t arrivalsPerPoll;
+
+// Invoked by waitForGroupCommit each time it polls: moves the mock clock
+// forward 10 ticks.
+static void
+advanceGroupCommitClock(Log::GroupCommit& group)
+{
+    Cycles::mockTscValue += 10;
+    group.arrivals += arrivalsPerPoll;
+}
+
+TEST_F(LogTest, waitForGroupCommit) {
+    Log::GroupCommit& group = l.groupCommits[0];
+    l.testingGroupCommitPoll = advanceGroupCommitClock;
+    Cycles::mockTscValue = 1000;
+
+    // Disabled.
+    l.groupCommitMaxWait = 0;
+    group.averageGap = 0;
+    EXPECT_EQ(0U, l.waitForGroupCommit(group));
+
+    // Syncs arrive too infrequently to be worth waiting for.
+    l.groupCommitMaxWait = 1000;
+    group.averageGap = 2000;
+    EXPECT_EQ(0U, l.waitForGroupCommit(group));
+
+    // Nothing arrives within the average gap.
+    arrivalsPerPoll = 0;
+    group.averageGap = 100;
+    EXPECT_EQ(110U, l.waitForGroupCommit(group));
+
+    // Syncs keep arriving: the wait is cut off at the maximum.
+    arrivalsPerPoll = 1;
+    EXPECT_EQ(1000U, l.waitForGroupCommit(group));
+    Cycles::mockTscValue = 0;
+}
+
 TEST_F(LogSyncTest, syncTo) {
     TestLog::Enable _(syncFilter);
     l->sync();
@@ -250,15 +337,18 @@ TEST_F(LogSyncTest, syncTo) {
     TestLog::reset();
     Log::Reference reference, reference2;
     l->append(LOG_ENTRY_TYPE_OBJ, "hi", 2, &reference);
-    EXPECT_NE(l->head->syncedLength, l->head->getAppendedLength());
+    EXPECT_NE(l->heads[0].segment->syncedLength,
+              l->heads[0].segment->getAppendedLength());
     l->syncTo(reference);
     EXPECT_EQ("sync: syncing segment 1 to offset 84 | syncTo: log synced",
         TestLog::get());
-    EXPECT_EQ(l->head->syncedLength, l->head->getAppendedLength());
+    EXPECT_EQ(l->heads[0].segment->syncedLength,
+              l->heads[0].segment->getAppendedLength());
 
     TestLog::reset();
     l->append(LOG_ENTRY_TYPE_OBJ, "ho", 2, &reference2);
-    EXPECT_NE(l->head->syncedLength, l->head->getAppendedLength());
+    EXPECT_NE(l->heads[0].segment->syncedLength,
+              l->heads[0].segment->getAppendedLength());
     l->syncTo(reference);
     EXPECT_EQ("syncTo: sync not needed: entry is already replicated",
         TestLog::get());
@@ -266,8 +356,8 @@ TEST_F(LogSyncTest, syncTo) {
     // Test sync if preceding segment is not closed durably.
     TestLog::reset();
     {
-        SpinLock::Guard lock(l->appendLock);
-        l->allocNewWritableHead();
+        SpinLock::Guard lock(l->heads[0].appendLock);
+        l->allocNewWritableHead(l->heads[0]);
     }
     EXPECT_FALSE(l->getSegment(reference2)->closedCommitted);
     l->syncTo(reference2);
@@ -280,18 +370,156 @@ TEST_F(LogSyncTest, syncTo) {
 
 TEST_F(LogTest, rollHeadOver) {
     LogPosition oldPos = LogPosition(0, 0);
-    LogSegment* oldHead = l.head;
+    LogSegment* oldHead = l.heads[0].segment;
     EXPECT_LT(oldPos, l.rollHeadOver());
-    EXPECT_NE(oldHead, l.head);
+    EXPECT_NE(oldHead, l.heads[0].segment);
 
-    oldPos = LogPosition(l.head->id, l.head->getAppendedLength());
-    oldHead = l.head;
+    oldPos = LogPosition(l.heads[0].segment->id,
+                         l.heads[0].segment->getAppendedLength());
+    oldHead = l.heads[0].segment;
     EXPECT_LT(oldPos, l.rollHeadOver());
-    EXPECT_NE(oldHead, l.head);
+    EXPECT_NE(oldHead, l.heads[0].segment);
+}
+
+TEST_F(LogTest, multipleHeads) {
+    serverConfig.master.numLogHeads = 2;
+    SegletAllocator allocator2(&serverConfig);
+    SegmentManager segmentManager2(&context, &serverConfig, &serverId,
+                                   allocator2, replicaManager,
+                                   &masterTableMetadata);
+    Log l2(&context, &serverConfig, &entryHandlers,
+           &segmentManager2, &replicaManager);
+    EXPECT_EQ(2U, l2.numHeads);
+    EXPECT_EQ(&l2.heads[ThreadId::get() % 2], &l2.getHeadForThread());
+
+    Log::Reference reference0, reference1;
+    {
+        SpinLock::Guard lock(l2.heads[0].appendLock);
+        EXPECT_TRUE(l2.append(lock, l2.heads[0], LOG_ENTRY_TYPE_OBJ,
+                              "hi", 2, &reference0));
+    }
+    {
+        SpinLock::Guard lock(l2.heads[1].appendLock);
+        EXPECT_TRUE(l2.append(lock, l2.heads[1], LOG_ENTRY_TYPE_OBJ,
+                              "ho", 2, &reference1));
+    }
+    LogSegment* head0 = l2.heads[0].segment;
+    LogSegment* head1 = l2.heads[1].segment;
+    EXPECT_EQ(1U, head0->id);
+    EXPECT_EQ(2U, head1->id);
+    EXPECT_EQ(head0, l2.getSegment(reference0));
+    EXPECT_EQ(head1, l2.getSegment(reference1));
+    EXPECT_EQ(head0, segmentManager2.getHeadSegment(0));
+    EXPECT_EQ(head1, segmentManager2.getHeadSegment(1));
+
+    // The lowest head is the position of the log.
+    EXPECT_EQ(LogPosition(1, head0->getAppendedLength()), l2.getHead());
+
+    TestLog::Enable _(syncFilter);
+    EXPECT_NE(head1->syncedLength, head1->getAppendedLength());
+    l2.syncTo(reference1);
+    EXPECT_EQ("sync: syncing segment 2 to offset 100 | syncTo: log synced",
+        TestLog::get());
+    EXPECT_EQ(head1->syncedLength, head1->getAppendedLength());
+    EXPECT_NE(head0->syncedLength, head0->getAppendedLength());
+
+    // Rolling over replaces every head.
+    LogPosition position = l2.rollHeadOver();
+    EXPECT_EQ(3U, l2.heads[0].segment->id);
+    EXPECT_EQ(4U, l2.heads[1].segment->id);
+    EXPECT_EQ(LogPosition(3, l2.heads[0].segment->getAppendedLength()),
+              position);
+    EXPECT_TRUE(head0->closed);
+    EXPECT_TRUE(head1->closed);
+}
+
+static void
+appendManyTimes(Log* log, int count)
+{
+    for (int i = 0; i < count; i++)
+        log->append(LOG_ENTRY_TYPE_OBJ, "hi", 2);
+}
+
+TEST_F(LogTest, multipleHeads_concurrentAppendMetrics) {
+    serverConfig.master.numLogHeads = 2;
+    SegletAllocator allocator2(&serverConfig);
+    SegmentManager segmentManager2(&context, &serverConfig, &serverId,
+                                   allocator2, replicaManager,
+                                   &masterTableMetadata);
+    Log l2(&context, &serverConfig, &entryHandlers,
+           &segmentManager2, &replicaManager);
+    {
+        // Make sure both heads exist before the threads race on them.
+        SpinLock::Guard lock0(l2.heads[0].appendLock);
+        l2.append(lock0, l2.heads[0], LOG_ENTRY_TYPE_OBJ, "hi", 2);
+        SpinLock::Guard lock1(l2.heads[1].appendLock);
+        l2.append(lock1, l2.heads[1], LOG_ENTRY_TYPE_OBJ, "hi", 2);
+    }
+
+    std::thread threads[4];
+    for (int i = 0; i < 4; i++)
+        threads[i] = std::thread(appendManyTimes, &l2, 100);
+    for (int i = 0; i < 4; i++)
+        threads[i].join();
+    EXPECT_EQ(400UL, static_cast<AbstractLog&>(l2).metrics.totalAppendCalls);
+}
+
+TEST_F(LogTest, hotHead) {
+    serverConfig.master.segregateHotWrites = true;
+    SegletAllocator allocator2(&serverConfig);
+    SegmentManager segmentManager2(&context, &serverConfig, &serverId,
+                                   allocator2, replicaManager,
+                                   &masterTableMetadata);
+    Log l2(&context, &serverConfig, &entryHandlers,
+           &segmentManager2, &replicaManager);
+    EXPECT_EQ(2U, l2.numHeads);
+    EXPECT_TRUE(l2.hasHotHead);
+    EXPECT_EQ(&l2.heads[1], l2.getHotHead());
+    EXPECT_EQ(&l2.heads[0], &l2.getHeadForThread());
+    EXPECT_EQ(static_cast<Log::Head*>(NULL), l.getHotHead());
+
+    // Nothing is allocated for the hot head until it's appended to, and
+    // it isn't synced until this thread has appended to it.
+    TestLog::Enable _(syncFilter);
+    l2.sync();
+    EXPECT_EQ("sync: syncing segment 1 to offset 80 | sync: log synced",
+              TestLog::get());
+    EXPECT_EQ(static_cast<LogSegment*>(NULL), l2.heads[1].segment);
+    TestLog::reset();
+
+    Log::AppendVector cold, hot;
+    cold.type = hot.type = LOG_ENTRY_TYPE_OBJ;
+    cold.buffer.appendExternal("cold", 4);
+    hot.buffer.appendExternal("hot", 3);
+    EXPECT_TRUE(l2.append(&cold, 1));
+    EXPECT_TRUE(l2.append(&hot, 1, true));
+    EXPECT_EQ(l2.heads[0].segment, l2.getSegment(cold.reference));
+    EXPECT_EQ(l2.heads[1].segment, l2.getSegment(hot.reference));
+    EXPECT_EQ(l2.heads[1].segment, segmentManager2.getHeadSegment(1));
+
+    // A hot append on a log without a hot head goes to the usual head.
+    EXPECT_TRUE(l.append(&hot, 1, true));
+    EXPECT_EQ(l.heads[0].segment, l.getSegment(hot.reference));
+
+    // Syncing covers both heads.
+    EXPECT_EQ(&l2, Log::unsyncedHotLog);
+    TestLog::reset();
+    l2.sync();
+    EXPECT_EQ("sync: syncing segment 1 to offset 86 | sync: log synced | "
+              "sync: syncing segment 2 to offset 101 | sync: log synced",
+              TestLog::get());
+    EXPECT_TRUE(Log::unsyncedHotLog == NULL);
+
+    // Once synced, the hot head is left alone until the next hot append.
+    EXPECT_TRUE(l2.append(&cold, 1));
+    TestLog::reset();
+    l2.sync();
+    EXPECT_EQ("sync: syncing segment 1 to offset 92 | sync: log synced",
+              TestLog::get());
 }
 
 TEST_F(LogTest, allocNextSegment) {
-    SpinLock::Guard _(l.appendLock);
+    SpinLock::Guard _(l.heads[0].appendLock);
 
     LogSegment* segment = segmentManager.allocSideSegment(0, NULL);
     EXPECT_NE(static_cast<LogSegment*>(NULL), segment);
@@ -300,11 +528,11 @@ TEST_F(LogTest, allocNextSegment) {
     }
 
     // if SegmentManager is tapped, should return NULL
-    EXPECT_EQ(static_cast<LogSegment*>(NULL), l.allocNextSegment(false));
+    EXPECT_EQ(static_cast<LogSegment*>(NULL), l.allocNextSegment(false, 0));
 
     // if we specify to block until we have space, it should return an
     // emergency head segment
-    LogSegment* emergency = l.allocNextSegment(true);
+    LogSegment* emergency = l.allocNextSegment(true, 0);
     EXPECT_NE(static_cast<LogSegment*>(NULL), emergency);
     EXPECT_TRUE(emergency->isEmergencyHead);
 
@@ -312,7 +540,7 @@ TEST_F(LogTest, allocNextSegment) {
     // even if the blocking flag
     segment->replicatedSegment->close();
     segmentManager.free(segment);
-    EXPECT_EQ(segment, l.allocNextSegment(true));
+    EXPECT_EQ(segment, l.allocNextSegment(true, 0));
 }
 
 } // namespace RAMCloud
@@ -0,0 +1,255 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "LzCodec.h"
+
+namespace RAMCloud {
+
+/**
+ * Write a length that didn't fit in its 4-bit token field: a run of 255s
+ * followed by the remainder.
+ *
+ * \return
+ *      Pointer just past the bytes written.
+ */
+static inline uint8_t*
+writeLengthExtension(uint8_t* op, uint32_t length)
+{
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = downCast<uint8_t>(length);
+    return op;
+}
+
+/**
+ * Read a length extension written by writeLengthExtension and add it to
+ * *length.
+ *
+ * \return
+ *      False if the input ended before the extension did.
+ */
+static inline bool
+readLengthExtension(const uint8_t** ip, const uint8_t* end, uint32_t* length)
+{
+    uint8_t byte;
+    do {
+        if (*ip >= end)
+            return false;
+        byte = *(*ip)++;
+        *length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+/**
+ * Append one token (a run of literals followed by an optional match) to
+ * the compressed output.
+ *
+ * \param op
+ *      Where to write the token.
+ * \param opEnd
+ *      First byte past the end of the output buffer.
+ * \param literals
+ *      The literal bytes.
+ * \param literalLength
+ *      Number of literal bytes.
+ * \param offset
+ *      Distance back to the start of the match, or 0 if the token has no
+ *      match (the last token of a block).
+ * \param matchLength
+ *      Length of the match; ignored if offset is 0.
+ * \return
+ *      Pointer just past the bytes written, or NULL if they would not fit.
+ */
+static inline uint8_t*
+writeToken(uint8_t* op, uint8_t* opEnd, const uint8_t* literals,
+           uint32_t literalLength, uint32_t offset, uint32_t matchLength)
+{
+    // The token's match length field holds matchLength - 4 (the minimum).
+    uint32_t matchCode = offset ? matchLength - 4 : 0;
+    uint64_t needed = 1 + literalLength;
+    if (literalLength >= 15)
+        needed += (literalLength - 15) / 255 + 1;
+    if (offset)
+        needed += 2 + (matchCode >= 15 ? (matchCode - 15) / 255 + 1 : 0);
+    if (needed > static_cast<uint64_t>(opEnd - op))
+        return NULL;
+
+    uint8_t* token = op++;
+    *token = downCast<uint8_t>((std::min(literalLength, 15U) << 4) |
+                               std::min(matchCode, 15U));
+    if (literalLength >= 15)
+        op = writeLengthExtension(op, literalLength - 15);
+    memcpy(op, literals, literalLength);
+    op += literalLength;
+
+    if (offset) {
+        *op++ = downCast<uint8_t>(offset & 0xff);
+        *op++ = downCast<uint8_t>(offset >> 8);
+        if (matchCode >= 15)
+            op = writeLengthExtension(op, matchCode - 15);
+    }
+    return op;
+}
+
+/**
+ * Compress a block of data.
+ *
+ * \param input
+ *      The data to compress.
+ * \param inputLength
+ *      Number of bytes at input.
+ * \param[out] output
+ *      The compressed block is written here.
+ * \param outputCapacity
+ *      Size of the output buffer. Callers that only want to keep the result
+ *      if it saves space can pass something less than inputLength.
+ * \return
+ *      The number of bytes written to output, or 0 if the compressed block
+ *      would not have fit in outputCapacity bytes.
+ */
+uint32_t
+LzCodec::compress(const void* input, uint32_t inputLength,
+                  void* output, uint32_t outputCapacity)
+{
+    const uint8_t* in = static_cast<const uint8_t*>(input);
+    uint8_t* op = static_cast<uint8_t*>(output);
+    uint8_t* opEnd = op + outputCapacity;
+
+    // Position of the last 4-byte sequence seen with each hash value. A
+    // stale or colliding entry is harmless: candidates are always verified.
+    uint32_t table[1 << HASH_BITS];
+    memset(table, 0, sizeof(table));
+
+    uint32_t anchor = 0;
+    uint32_t pos = 1;
+    if (inputLength > MATCH_START_LIMIT) {
+        uint32_t matchStartLimit = inputLength - MATCH_START_LIMIT;
+        uint32_t matchEndLimit = inputLength - LAST_LITERALS;
+        while (pos < matchStartLimit) {
+            uint32_t sequence;
+            memcpy(&sequence, in + pos, sizeof(sequence));
+            uint32_t hash = (sequence * 2654435761U) >> (32 - HASH_BITS);
+            uint32_t candidate = table[hash];
+            table[hash] = pos;
+
+            uint32_t candidateSequence;
+            memcpy(&candidateSequence, in + candidate,
+                   sizeof(candidateSequence));
+            if (pos - candidate > MAX_OFFSET ||
+                    candidateSequence != sequence) {
+                pos++;
+                continue;
+            }
+
+            uint32_t matchLength = MIN_MATCH;
+            while (pos + matchLength < matchEndLimit &&
+                    in[candidate + matchLength] == in[pos + matchLength]) {
+                matchLength++;
+            }
+
+            op = writeToken(op, opEnd, in + anchor, pos - anchor,
+                            pos - candidate, matchLength);
+            if (op == NULL)
+                return 0;
+            pos += matchLength;
+            anchor = pos;
+        }
+    }
+
+    op = writeToken(op, opEnd, in + anchor, inputLength - anchor, 0, 0);
+    if (op == NULL)
+        return 0;
+    return downCast<uint32_t>(op - static_cast<uint8_t*>(output));
+}
+
+/**
+ * Decompress a block produced by compress(). The input is checked as it is
+ * decoded, so a corrupt block is reported rather than overrunning either
+ * buffer.
+ *
+ * \param input
+ *      The compressed block.
+ * \param inputLength
+ *      Number of bytes in the compressed block.
+ * \param[out] output
+ *      The decompressed data is written here.
+ * \param outputLength
+ *      Exact number of bytes the block decompresses to.
+ * \return
+ *      True if the block decoded to exactly outputLength bytes; false if it
+ *      is corrupt.
+ */
+bool
+LzCodec::decompress(const void* input, uint32_t inputLength,
+                    void* output, uint32_t outputLength)
+{
+    const uint8_t* ip = static_cast<const uint8_t*>(input);
+    const uint8_t* ipEnd = ip + inputLength;
+    uint8_t* out = static_cast<uint8_t*>(output);
+    uint32_t pos = 0;
+
+    while (ip < ipEnd) {
+        uint8_t token = *ip++;
+
+        uint32_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLengthExtension(&ip, ipEnd,
+                                                        &literalLength))
+            return false;
+        if (literalLength > static_cast<uint64_t>(ipEnd - ip) ||
+                literalLength > outputLength - pos)
+            return false;
+        memcpy(out + pos, ip, literalLength);
+        ip += literalLength;
+        pos += literalLength;
+
+        // The last token has no match.
+        if (ip == ipEnd)
+            break;
+
+        if (ipEnd - ip < 2)
+            return false;
+        uint32_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > pos)
+            return false;
+
+        uint32_t matchLength = token & 15;
+        if (matchLength == 15 && !readLengthExtension(&ip, ipEnd,
+                                                      &matchLength))
+            return false;
+        matchLength += MIN_MATCH;
+        if (matchLength > outputLength - pos)
+            return false;
+
+        // Matches may overlap the bytes they produce (e.g. a run of one
+        // repeated byte has offset 1), so copy forwards a byte at a time
+        // unless the source lies entirely behind the destination.
+        const uint8_t* match = out + pos - offset;
+        if (offset >= matchLength) {
+            memcpy(out + pos, match, matchLength);
+        } else {
+            for (uint32_t i = 0; i < matchLength; i++)
+                out[pos + i] = match[i];
+        }
+        pos += matchLength;
+    }
+
+    return pos == outputLength;
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,69 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_LZCODEC_H
+#define RAMCLOUD_LZCODEC_H
+
+#include "Common.h"
+
+namespace RAMCloud {
+
+/**
+ * A small, fast LZ77 block compressor used to shrink cold log entries (see
+ * Segment::appendCompressed). It favours speed over compression ratio: a
+ * single hash probe is made per input position and there is no entropy
+ * coding, so compression runs at hundreds of MB/s and decompression at
+ * memory speed.
+ *
+ * The encoded format is the LZ4 block format: a sequence of tokens, each
+ * giving a run of literal bytes followed by a back-reference (a 16-bit
+ * offset into the output already produced and a length of at least
+ * MIN_MATCH bytes). The last token has literals only. Nothing in the output
+ * records the uncompressed length; callers must store it themselves.
+ *
+ * All methods are static and thread-safe.
+ */
+class LzCodec {
+  public:
+    static uint32_t compress(const void* input, uint32_t inputLength,
+                             void* output, uint32_t outputCapacity);
+    static bool decompress(const void* input, uint32_t inputLength,
+                           void* output, uint32_t outputLength);
+
+  PRIVATE:
+    /// Shortest back-reference the format can express.
+    static const uint32_t MIN_MATCH = 4;
+
+    /// The last few bytes of every block are always encoded as literals,
+    /// which lets the decoder copy a match without checking for the end
+    /// of its input on every byte.
+    static const uint32_t LAST_LITERALS = 5;
+
+    /// No match may start within this many bytes of the end of a block.
+    static const uint32_t MATCH_START_LIMIT = 12;
+
+    /// Back-references are encoded in 16 bits.
+    static const uint32_t MAX_OFFSET = 65535;
+
+    /// Log2 of the number of entries in the table of recently seen
+    /// 4-byte sequences used to find matches.
+    static const uint32_t HASH_BITS = 12;
+
+    DISALLOW_COPY_AND_ASSIGN(LzCodec);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_LZCODEC_H
@@ -0,0 +1,129 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any purpose
+ * with or without fee is hereby granted, provided that the above copyright
+ * notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER
+ * RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF
+ * CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "LzCodec.h"
+
+namespace RAMCloud {
+
+class LzCodecTest : public ::testing::Test {
+  public:
+    char compressed[10000];
+    char decompressed[10000];
+
+    LzCodecTest()
+        : compressed(),
+          decompressed()
+    {
+    }
+
+    /**
+     * Compress and decompress the given string, returning the compressed
+     * length, or 0 if either step failed or the data didn't survive.
+     */
+    uint32_t
+    roundTrip(const string& s)
+    {
+        uint32_t length = downCast<uint32_t>(s.size());
+        uint32_t n = LzCodec::compress(s.data(), length, compressed,
+                                       sizeof32(compressed));
+        if (n == 0)
+            return 0;
+        if (!LzCodec::decompress(compressed, n, decompressed, length))
+            return 0;
+        if (memcmp(s.data(), decompressed, length) != 0)
+            return 0;
+        return n;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(LzCodecTest);
+};
+
+TEST_F(LzCodecTest, compress_empty) {
+    EXPECT_EQ(1U, LzCodec::compress("", 0, compressed, 1));
+    EXPECT_EQ(0, compressed[0]);
+    EXPECT_TRUE(LzCodec::decompress(compressed, 1, decompressed, 0));
+}
+
+TEST_F(LzCodecTest, compress_shortInputIsLiterals) {
+    EXPECT_EQ(13U, roundTrip("abcabcabcabc"));
+}
+
+TEST_F(LzCodecTest, compress_repetitive) {
+    string s;
+    for (int i = 0; i < 100; i++)
+        s += "the quick brown fox ";
+    uint32_t n = roundTrip(s);
+    EXPECT_LT(0U, n);
+    EXPECT_GT(50U, n);
+
+    // A long run of one byte needs a match that overlaps its own output.
+    EXPECT_EQ(30U, roundTrip(string(5000, 'x')));
+}
+
+TEST_F(LzCodecTest, compress_incompressible) {
+    string s;
+    uint64_t x = 88172645463325252UL;
+    for (int i = 0; i < 1000; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        s += static_cast<char>(x);
+    }
+    uint32_t n = roundTrip(s);
+    EXPECT_LE(1000U, n);
+
+    // Refuses to produce output that doesn't fit.
+    EXPECT_EQ(0U, LzCodec::compress(s.data(), 1000, compressed, 999));
+}
+
+TEST_F(LzCodecTest, compress_outputTooSmall) {
+    string s(5000, 'x');
+    uint32_t n = roundTrip(s);
+    EXPECT_EQ(0U, LzCodec::compress(s.data(), 5000, compressed, n - 1));
+    EXPECT_EQ(n, LzCodec::compress(s.data(), 5000, compressed, n));
+}
+
+TEST_F(LzCodecTest, decompress_corrupt) {
+    string s;
+    for (int i = 0; i < 100; i++)
+        s += "the quick brown fox ";
+    uint32_t n = LzCodec::compress(s.data(), 2000, compressed,
+                                   sizeof32(compressed));
+
+    // Wrong expected length.
+    EXPECT_FALSE(LzCodec::decompress(compressed, n, decompressed, 1999));
+    EXPECT_FALSE(LzCodec::decompress(compressed, n, decompressed, 2001));
+
+    // Truncated input.
+    EXPECT_FALSE(LzCodec::decompress(compressed, n - 1, decompressed, 2000));
+
+    // Offset reaching back before the start of the output.
+    compressed[0] = 0x10;
+    compressed[1] = 'a';
+    compressed[2] = 2;
+    compressed[3] = 0;
+    EXPECT_FALSE(LzCodec::decompress(compressed, 4, decompressed, 10));
+
+    // Zero offset.
+    compressed[2] = 0;
+    EXPECT_FALSE(LzCodec::decompress(compressed, 4, decompressed, 10));
+
+    // Literal run longer than the input.
+    compressed[0] = 0x50;
+    EXPECT_FALSE(LzCodec::decompress(compressed, 4, decompressed, 10));
+}
+
+}  // namespace RAMCloud
@@ -32,6 +32,7 @@
 #include "ProtoBuf.h"
 #include "RawMetrics.h"
 #include "Segment.h"
+#include "SegmentReplayer.h"
 #include "ServerRpcPool.h"
 #include "ShortMacros.h"
 #include "TableStats.h"
@@ -433,6 +434,10 @@ MasterService::enumerate(const WireFormat::Enumerate::Request* reqHdr,
     EnumerationIterator iter(*rpc->requestPayload,
             downCast<uint32_t>(sizeof(*reqHdr)), reqHdr->iteratorBytes);
 
+    // Enumeration walks the hash table without taking bucket locks, so keep
+    // it from being resized underneath us.
+    ObjectManager::ResizeProtector resizeProtector(&objectManager);
+
     // Put at most maxPayloadBytes of enumerated objects in the reply. This
     // limit is used to leave enough room in the reply buffer for the response
     // header and also the serialized iteration state at the end of enumeration.
@@ -1248,6 +1253,44 @@ MasterService::multiOp(const WireFormat::MultiOp::Request* reqHdr,
     }
 }
 
+/**
+ * Helper for multiRead and multiIncrement: prefetch the objects named by the
+ * next few parts of a MultiOp request, so that reading them one at a time
+ * afterwards doesn't take a fresh cache miss per object.
+ *
+ * \param requestPayload
+ *      The MultiOp request.
+ * \param reqOffset
+ *      Offset in requestPayload of the first part to prefetch.
+ * \param numParts
+ *      Number of parts remaining in the request, starting at reqOffset.
+ *      At most ObjectManager::MAX_PREFETCH_BATCH of them are prefetched.
+ *      Malformed parts end the batch early; the caller will report them.
+ */
+template<typename Part>
+void
+MasterService::prefetchMultiOpObjects(Buffer* requestPayload,
+        uint32_t reqOffset, uint32_t numParts)
+{
+    KeyHash keyHashes[ObjectManager::MAX_PREFETCH_BATCH];
+    uint32_t numHashes = 0;
+    while (numHashes < numParts &&
+            numHashes < ObjectManager::MAX_PREFETCH_BATCH) {
+        const Part* part = requestPayload->getOffset<Part>(reqOffset);
+        if (part == NULL)
+            break;
+        reqOffset += sizeof32(Part);
+        const void* stringKey = requestPayload->getRange(reqOffset,
+                part->keyLength);
+        if (stringKey == NULL)
+            break;
+        reqOffset += part->keyLength;
+        keyHashes[numHashes++] = Key::getHash(part->tableId, stringKey,
+                part->keyLength);
+    }
+    objectManager.prefetchObjects(keyHashes, numHashes);
+}
+
 /**
  * Top-level server method to handle the MULTI_INCREMENT request.
  *
@@ -1280,6 +1323,12 @@ MasterService::multiIncrement(const WireFormat::MultiOp::Request* reqHdr,
     // Each iteration extracts one request from request rpc, increments the
     // corresponding object, and appends the response to the response rpc.
     for (uint32_t i = 0; i < numRequests; i++) {
+        if (i % ObjectManager::MAX_PREFETCH_BATCH == 0) {
+            prefetchMultiOpObjects<
+                    WireFormat::MultiOp::Request::IncrementPart>(
+                    rpc->requestPayload, reqOffset, numRequests - i);
+        }
+
         const WireFormat::MultiOp::Request::IncrementPart *currentReq =
             rpc->requestPayload->getOffset<
                 WireFormat::MultiOp::Request::IncrementPart>(reqOffset);
@@ -1375,6 +1424,11 @@ MasterService::multiRead(const WireFormat::MultiOp::Request* reqHdr,
             break;
         }
 
+        if (i % ObjectManager::MAX_PREFETCH_BATCH == 0) {
+            prefetchMultiOpObjects<WireFormat::MultiOp::Request::ReadPart>(
+                    rpc->requestPayload, reqOffset, numRequests - i);
+        }
+
         const WireFormat::MultiOp::Request::ReadPart *currentReq =
                 rpc->requestPayload->getOffset<
                 WireFormat::MultiOp::Request::ReadPart>(reqOffset);
@@ -1737,7 +1791,8 @@ MasterService::read(const WireFormat::Read::Request* reqHdr,
     bool valueOnly = true;
     uint32_t initialLength = rpc->replyPayload->size();
     respHdr->common.status = objectManager.readObject(
-            key, rpc->replyPayload, &rejectRules, &respHdr->version, valueOnly);
+            key, rpc->replyPayload, &rejectRules, &respHdr->version, valueOnly,
+            rpc->mustNotBlock ? &rpc->wouldBlock : NULL);
 
     if (respHdr->common.status != STATUS_OK)
         return;
@@ -1783,7 +1838,8 @@ MasterService::readKeysAndValue(
     RejectRules rejectRules = reqHdr->rejectRules;
     uint32_t initialLength = rpc->replyPayload->size();
     respHdr->common.status = objectManager.readObject(
-            key, rpc->replyPayload, &rejectRules, &respHdr->version);
+            key, rpc->replyPayload, &rejectRules, &respHdr->version, false,
+            rpc->mustNotBlock ? &rpc->wouldBlock : NULL);
 
     if (respHdr->common.status != STATUS_OK)
         return;
@@ -3324,12 +3380,12 @@ class RecoveryTask {
         , masterId(masterId)
         , partitionId(partitionId)
         , replica(replica)
-        , response()
+        , response(new Buffer())
         , startTime(Cycles::rdtsc())
         , rpc()
     {
         rpc.construct(context, replica.backupId, recoveryId, masterId,
-                replica.segmentId, partitionId, &response);
+                replica.segmentId, partitionId, response.get());
     }
     ~RecoveryTask()
     {
@@ -3341,16 +3397,18 @@ class RecoveryTask {
     }
     void resend() {
         LOG(DEBUG, "Resend %lu", replica.segmentId);
-        response.reset();
+        response->reset();
         rpc.construct(context, replica.backupId, recoveryId, masterId,
-                replica.segmentId, partitionId, &response);
+                replica.segmentId, partitionId, response.get());
     }
     Context* context;
     uint64_t recoveryId;
     ServerId masterId;
     uint64_t partitionId;
     MasterService::Replica& replica;
-    Buffer response;
+    /// Heap-allocated so that, once the RPC completes, the recovery segment
+    /// can be handed off to a SegmentReplayer without copying it.
+    std::unique_ptr<Buffer> response;
     const uint64_t startTime;
     Tub<GetRecoveryDataRpc> rpc;
     DISALLOW_COPY_AND_ASSIGN(RecoveryTask);
@@ -3503,6 +3561,19 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
     // durable.
     SideLog sideLog(objectManager.getLog());
 
+    // With more than one replay thread, segments are instead handed to these
+    // threads as they arrive and replayed into a SideLog per thread, while
+    // this thread goes on fetching. A segment stays in runningSet until its
+    // replay finishes, so a failed replay can be retried from another
+    // replica just like a failed fetch.
+    Tub<SegmentReplayer> replayer;
+    std::unordered_map<uint64_t, Replica*> replaying;
+    bool replayFailed = false;
+    if (config->master.recoveryReplayThreads > 1) {
+        replayer.construct(&objectManager,
+                config->master.recoveryReplayThreads, &nextNodeIdMap);
+    }
+
     // Start RPCs
     auto replicaIt = notStarted;
     foreach (auto& task, tasks) {
@@ -3539,13 +3610,52 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
         segmentIdToBackups.insert({replica.segmentId, &replica});
     }
 
-    while (activeRequests) {
-        if (!readStallTicks)
+    while (activeRequests || !replaying.empty()) {
+        if (!readStallTicks && activeRequests)
             readStallTicks.construct(&metrics->master.segmentReadStallTicks);
         objectManager.getReplicaManager()->proceed();
-        foreach (auto& task, tasks) {
-            if (!task)
+
+        uint64_t replayedSegmentId;
+        std::exception_ptr replayFailure;
+        while (replayer &&
+                replayer->getCompleted(&replayedSegmentId, &replayFailure)) {
+            Replica& replica = *replaying[replayedSegmentId];
+            replaying.erase(replayedSegmentId);
+            runningSet.erase(replayedSegmentId);
+            if (!replayFailure) {
+                // Mark this and any other entries for this segment as OK.
+                foreach (auto it, segmentIdToBackups.equal_range(
+                        replayedSegmentId)) {
+                    it.second->state = Replica::State::OK;
+                }
                 continue;
+            }
+            try {
+                std::rethrow_exception(replayFailure);
+            } catch (const SegmentIteratorException& e) {
+                LOG(WARNING, "Recovery segment for segment %lu corrupted; "
+                        "trying next backup: %s", replayedSegmentId,
+                        e.what());
+            } catch (const ClientException& e) {
+                LOG(WARNING, "Replay of segment %lu from %s failed, trying "
+                        "next backup; failure was: %s", replayedSegmentId,
+                        context->serverList->toString(
+                                replica.backupId).c_str(),
+                        e.str().c_str());
+            }
+            replica.state = Replica::State::FAILED;
+            replayFailed = true;
+        }
+
+        foreach (auto& task, tasks) {
+            if (!task) {
+                if (!replayFailed)
+                    continue;
+                // This channel ran out of replicas to fetch, but a failed
+                // replay may have left one to fetch again.
+                ++activeRequests;
+                goto startNextTask;
+            }
             if (!task->rpc->isReady())
                 continue;
             readStallTicks.destroy();
@@ -3604,27 +3714,37 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
                             &task - &tasks[0]);
                 }
 
-                uint32_t responseLen = task->response.size();
+                uint32_t responseLen = task->response->size();
                 metrics->master.segmentReadByteCount += responseLen;
                 uint64_t startUseful = Cycles::rdtsc();
-                SegmentIterator it(task->response.getRange(0, responseLen),
+                SegmentIterator it(task->response->getRange(0, responseLen),
                         responseLen, certificate);
                 it.checkMetadataIntegrity();
-                if (LOG_RECOVERY_REPLICATION_RPC_TIMING) {
-                    LOG(DEBUG, "@%7lu: Replaying segment %lu with length %u",
-                            Cycles::toMicroseconds(Cycles::rdtsc() -
-                                    ReplicatedSegment::recoveryStart),
-                            task->replica.segmentId, responseLen);
-                }
-                objectManager.replaySegment(&sideLog, it, &nextNodeIdMap);
-                usefulTime += Cycles::rdtsc() - startUseful;
-                TEST_LOG("Segment %lu replay complete",
-                         task->replica.segmentId);
-                if (LOG_RECOVERY_REPLICATION_RPC_TIMING) {
-                    LOG(DEBUG, "@%7lu: Replaying segment %lu done",
-                            Cycles::toMicroseconds(Cycles::rdtsc() -
-                                    ReplicatedSegment::recoveryStart),
+                if (replayer) {
+                    replayer->replay(task->response.release(), certificate,
                             task->replica.segmentId);
+                    replaying[task->replica.segmentId] = &task->replica;
+                    usefulTime += Cycles::rdtsc() - startUseful;
+                    task.destroy();
+                    goto startNextTask;
+                } else {
+                    if (LOG_RECOVERY_REPLICATION_RPC_TIMING) {
+                        LOG(DEBUG, "@%7lu: Replaying segment %lu with "
+                                "length %u",
+                                Cycles::toMicroseconds(Cycles::rdtsc() -
+                                        ReplicatedSegment::recoveryStart),
+                                task->replica.segmentId, responseLen);
+                    }
+                    objectManager.replaySegment(&sideLog, it, &nextNodeIdMap);
+                    usefulTime += Cycles::rdtsc() - startUseful;
+                    TEST_LOG("Segment %lu replay complete",
+                             task->replica.segmentId);
+                    if (LOG_RECOVERY_REPLICATION_RPC_TIMING) {
+                        LOG(DEBUG, "@%7lu: Replaying segment %lu done",
+                                Cycles::toMicroseconds(Cycles::rdtsc() -
+                                        ReplicatedSegment::recoveryStart),
+                                task->replica.segmentId);
+                    }
                 }
 
                 runningSet.erase(task->replica.segmentId);
@@ -3669,6 +3789,7 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
 
             task.destroy();
 
+          startNextTask:
             // move notStarted up as far as possible
             while (notStarted != replicasEnd &&
                     notStarted->state != Replica::State::NOT_STARTED) {
@@ -3700,9 +3821,16 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
             if (!task)
                 --activeRequests;
         }
+        replayFailed = false;
     }
     readStallTicks.destroy();
 
+    if (replayer) {
+        uint64_t startUseful = Cycles::rdtsc();
+        replayer->sync();
+        usefulTime += Cycles::rdtsc() - startUseful;
+    }
+
     detectSegmentRecoveryFailure(masterId, partitionId, replicas);
 
     {
@@ -3716,7 +3844,10 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
                 0 - metrics->transport.infiniband.transmitActiveTicks;
         metrics->master.logSyncPostingWriteRpcTicks =
                 0 - metrics->master.replicationPostingWriteRpcTicks;
-        sideLog.commit();
+        if (replayer)
+            replayer->commit();
+        else
+            sideLog.commit();
         metrics->master.logSyncBytes += metrics->transport.transmit.byteCount;
         metrics->master.logSyncTransmitCopyTicks +=
                 metrics->transport.transmit.copyTicks;
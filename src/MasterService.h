@@ -236,6 +236,9 @@ class MasterService : public Service {
     void multiRemove(const WireFormat::MultiOp::Request* reqHdr,
                 WireFormat::MultiOp::Response* respHdr,
                 Rpc* rpc);
+    template<typename Part>
+    void prefetchMultiOpObjects(Buffer* requestPayload, uint32_t reqOffset,
+                uint32_t numParts);
     void multiWrite(const WireFormat::MultiOp::Request* reqHdr,
                 WireFormat::MultiOp::Response* respHdr,
                 Rpc* rpc);
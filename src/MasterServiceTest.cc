@@ -1328,7 +1328,8 @@ TEST_F(MasterServiceTest, migrateTablet_movingData) {
     master2Log->sync();
 
     LogPosition master2HeadPositionBefore = LogPosition(
-            master2Log->head->id, master2Log->head->getAppendedLength());
+            master2Log->heads[0].segment->id,
+            master2Log->heads[0].segment->getAppendedLength());
 
     // JIRA Issue: RAM-441: Without the syncCoordinatorServerList() call in
     // cluster.addServer(..) above, this crashes since the CoordinatorServerList
@@ -1354,7 +1355,8 @@ TEST_F(MasterServiceTest, migrateTablet_movingData) {
     // migration, but less than the current log position (since we added
     // data).
     LogPosition master2HeadPositionAfter = LogPosition(
-            master2Log->head->id, master2Log->head->getAppendedLength());
+            master2Log->heads[0].segment->id,
+            master2Log->heads[0].segment->getAppendedLength());
     LogPosition ctimeCoord =
             cluster.coordinator->tableManager.getTablet(tbl, 0).ctime;
     EXPECT_GT(ctimeCoord, master2HeadPositionBefore);
@@ -1905,6 +1907,42 @@ TEST_F(MasterServiceTest, read_basics) {
     EXPECT_EQ(6U, value.size());
 }
 
+TEST_F(MasterServiceTest, read_mustNotBlock) {
+    // Written directly, so the object isn't replicated yet.
+    Key key(1, "0", 1);
+    Buffer value;
+    Object obj(key, "abcdef", 6, 0, 0, value);
+    EXPECT_EQ(STATUS_OK, service->objectManager.writeObject(obj, 0, 0));
+
+    Buffer request, response;
+    WireFormat::Read::Request* reqHdr =
+            request.emplaceAppend<WireFormat::Read::Request>();
+    memset(reqHdr, 0, sizeof(*reqHdr));
+    reqHdr->tableId = 1;
+    reqHdr->keyLength = 1;
+    request.appendCopy("0", 1);
+    WireFormat::Read::Response* respHdr =
+            response.emplaceAppend<WireFormat::Read::Response>();
+    memset(respHdr, 0, sizeof(*respHdr));
+
+    // Executed by the dispatch thread: the read would wait for replication,
+    // so it gives up.
+    Service::Rpc rpc(NULL, &request, &response);
+    rpc.mustNotBlock = true;
+    service->read(reqHdr, respHdr, &rpc);
+    EXPECT_TRUE(rpc.wouldBlock);
+
+    // A worker syncs the object and completes the read.
+    response.truncate(sizeof(*respHdr));
+    memset(respHdr, 0, sizeof(*respHdr));
+    Service::Rpc workerRpc(NULL, &request, &response);
+    service->read(reqHdr, respHdr, &workerRpc);
+    EXPECT_FALSE(workerRpc.wouldBlock);
+    EXPECT_EQ(STATUS_OK, respHdr->common.status);
+    EXPECT_EQ(6U, respHdr->length);
+    EXPECT_EQ("abcdef", TestUtil::toString(&response, sizeof32(*respHdr), 6));
+}
+
 TEST_F(MasterServiceTest, readKeysAndValue_basics) {
     uint64_t tableId1 = 1;
     ObjectBuffer keysAndValue;
@@ -4679,13 +4717,14 @@ class MasterRecoverTest : public ::testing::Test {
     { }
 
     MasterService*
-    createMasterService()
+    createMasterService(uint32_t recoveryReplayThreads = 1)
     {
         ServerConfig config = ServerConfig::forTesting();
         config.localLocator = "mock:host=master";
         config.services = {WireFormat::MASTER_SERVICE,
                 WireFormat::ADMIN_SERVICE};
         config.master.numReplicas = 2;
+        config.master.recoveryReplayThreads = recoveryReplayThreads;
         return cluster.addServer(config)->master.get();
     }
 
@@ -4767,6 +4806,43 @@ TEST_F(MasterRecoverTest, recover) {
             "recover: Segment 87 replay complete"));
 }
 
+TEST_F(MasterRecoverTest, recover_parallelReplay) {
+    MasterService* master = createMasterService(3);
+
+    Context context2;
+    ServerList serverList2(&context2);
+    context2.transportManager->registerMock(&cluster.transport);
+    serverList2.testingAdd({backup1Id, "mock:host=backup1",
+            {WireFormat::BACKUP_SERVICE, WireFormat::ADMIN_SERVICE},
+            100, ServerStatus::UP});
+    ServerId serverId(99, 0);
+    ReplicaManager mgr(&context2, &serverId, 1, false, false);
+    MasterServiceTest::writeRecoverableSegment(&context, mgr, serverId, 99, 87);
+    MasterServiceTest::writeRecoverableSegment(&context, mgr, serverId, 99, 88);
+
+    ProtoBuf::RecoveryPartition recoveryPartition;
+    createRecoveryPartition(recoveryPartition);
+    BackupClient::startReadingData(&context, backup1Id, 456lu, ServerId(99));
+    BackupClient::StartPartitioningReplicas(&context, backup1Id, 456lu,
+            ServerId(99), &recoveryPartition);
+
+    vector<MasterService::Replica> replicas {
+        { backup1Id.getId(), 87 },
+        { backup1Id.getId(), 88 },
+    };
+
+    MockRandom __(1); // triggers deterministic rand().
+    TestLog::Enable _("replayThreadEntry", NULL);
+    std::unordered_map<uint64_t, uint64_t> nextNodeIdMap;
+    master->recover(456lu, ServerId(99, 0), 0, replicas, nextNodeIdMap);
+    EXPECT_NE(string::npos, TestLog::get().find(
+            "replayThreadEntry: Segment 87 replay complete"));
+    EXPECT_NE(string::npos, TestLog::get().find(
+            "replayThreadEntry: Segment 88 replay complete"));
+    foreach (const auto& replica, replicas)
+        EXPECT_EQ(MasterService::Replica::State::OK, replica.state);
+}
+
 TEST_F(MasterRecoverTest, failedToRecoverAll) {
     MasterService* master = createMasterService();
 
@@ -55,6 +55,10 @@ class MockService : public Service {
             if (inputValue == 54322) {
                 throw RetryException(HERE, 100, 200, "server overloaded");
             }
+            if (inputValue == 54323 && rpc->mustNotBlock) {
+                rpc->wouldBlock = true;
+                return;
+            }
             rpc->replyPayload->emplaceAppend<int32_t>(inputValue+1);
         }
         int secondWord = *(rpc->requestPayload->getOffset<int>(4));
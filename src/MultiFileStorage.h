@@ -20,6 +20,7 @@
 
 #include "Common.h"
 #include "BackupStorage.h"
+#include "IoUring.h"
 #include "PriorityTaskQueue.h"
 
 namespace RAMCloud {
@@ -228,7 +229,8 @@ class MultiFileStorage : public BackupStorage {
                      size_t writeRateLimit,
                      size_t maxNonVolatileBuffers,
                      const char* filePaths,
-                     int openFlags = 0);
+                     int openFlags = 0,
+                     bool useIoUring = false);
     ~MultiFileStorage();
 
     FrameRef open(bool sync, ServerId masterId, uint64_t segmentId);
@@ -269,6 +271,14 @@ class MultiFileStorage : public BackupStorage {
     void unlockedWrite(Frame::Lock& lock, void* buf, size_t count,
                        size_t frameIndex, off_t offsetInFrame,
                        void* metadataBuf, size_t metadataCount);
+    void aioRead(void* buf, size_t frameIndex, bool usingDevNull);
+    void ioUringRead(void* buf, size_t frameIndex, bool usingDevNull);
+    void aioWrite(void* buf, size_t count, size_t frameIndex,
+                  off_t offsetInFrame, void* metadataBuf,
+                  size_t metadataCount, uint64_t start);
+    void ioUringWrite(void* buf, size_t count, size_t frameIndex,
+                      off_t offsetInFrame, void* metadataBuf,
+                      size_t metadataCount, uint64_t start);
 
     void reserveSpace(int fd);
     Tub<Superblock> tryLoadSuperblock(uint32_t superblockFrame);
@@ -359,6 +369,28 @@ class MultiFileStorage : public BackupStorage {
      */
     std::stack<void*, std::vector<void*>> buffers;
 
+    /**
+     * If the constructor was asked to use io_uring and the kernel supports
+     * it, replica reads and writes go through this rather than POSIX aio.
+     * Empty otherwise.
+     *
+     * Submissions are batched only within a single Frame: #ioQueue runs
+     * one Frame task at a time and each performWrite() or performRead()
+     * waits for its own requests before the next Frame is considered.
+     * Writes for different Frames are never combined into one
+     * io_uring_enter() call. Doing that would require #ioQueue to pull
+     * several tasks at once and finish each Frame's bookkeeping
+     * (committedLength, buffer release, rescheduling) as its completions
+     * arrive.
+     */
+    Tub<IoUring> ioUring;
+
+    /**
+     * True if reads and writes should currently use #ioUring; cleared
+     * briefly by benchmark() to time POSIX aio for comparison.
+     */
+    bool ioUringEnabled;
+
     DISALLOW_COPY_AND_ASSIGN(MultiFileStorage);
 };
 
@@ -654,6 +654,56 @@ TEST_F(MultiFileStorageTest, Frame_performWriteSmokeTestOffsets) {
               TestLog::get());
 }
 
+TEST_F(MultiFileStorageTest, unlockedWrite_ioUring) {
+    if (!IoUring::isSupported())
+        return;
+    // Same as unlockedWriteMiddleOfSegment, but with IO through io_uring.
+    size_t dataLen1 = BLOCK_SIZE + BLOCK_SIZE / 2;
+    size_t dataLen2 = BLOCK_SIZE;
+    Memory::unique_ptr_free data(
+        Memory::xmemalign(HERE, getpagesize(), segmentSize),
+        std::free);
+    memset(data.get(), 'x', dataLen1);
+    memset(static_cast<char*>(data.get()) + dataLen1, 'y', dataLen2);
+    static_cast<char*>(data.get())[dataLen1 + dataLen2] = '\0';
+
+    size_t metadataLen = storage1->getMetadataSize();
+    Memory::unique_ptr_free metadata(
+        Memory::xmemalign(HERE, getpagesize(), metadataLen),
+        std::free);
+    memset(metadata.get(), 'z', metadataLen - 1);
+    static_cast<char*>(metadata.get())[metadataLen - 1] = '\0';
+
+    Buffer source;
+    source.appendExternal(data.get(), segmentSize);
+
+    Frame::testingSkipRealIo = false;
+
+    for (size_t i = 0; i < storages.size(); i++) {
+        storages[i]->ioUring.construct(storages[i]->fds, 4);
+        storages[i]->ioUringEnabled = true;
+        BackupStorage::FrameRef frameRef = storages[i]->open(false,
+                ServerId(), 0);
+        Frame* frame = static_cast<Frame*>(frameRef.get());
+        frame->append(source, 0, dataLen1, 0, metadata.get(), metadataLen);
+        storages[i]->quiesce();
+        frame->append(source, dataLen1, dataLen2 + 1, dataLen1, NULL, 0);
+        while (!frame->isSynced());
+
+        // Force a read from disk.
+        frame->buffer.reset();
+        {
+            Frame::Lock lock(frame->storage->mutex);
+            frame->loadRequested = true;
+            frame->performRead(lock);
+        }
+        char* replica = bytes(frame->load());
+        EXPECT_STREQ(bytes(data.get()), replica);
+        char* metadataRead = bytes(const_cast<void*>(frame->getMetadata()));
+        EXPECT_STREQ(bytes(metadata.get()), metadataRead);
+    }
+}
+
 TEST_F(MultiFileStorageTest, Frame_performRead) {
     BackupStorage::FrameRef frameRef = storage1->open(false, ServerId(), 0);
     Frame* frame = static_cast<Frame*>(frameRef.get());
@@ -20,6 +20,7 @@
 #include "EnumerationIterator.h"
 #include "IndexletManager.h"
 #include "LogEntryRelocator.h"
+#include "LogProtector.h"
 #include "ObjectManager.h"
 #include "Object.h"
 #include "PerfStats.h"
@@ -86,20 +87,40 @@ ObjectManager::ObjectManager(Context* context, ServerId* serverId,
     , replicaManager(context, serverId,
                      config->master.numReplicas,
                      config->master.useMinCopysets,
-                     config->master.allowLocalBackup)
+                     config->master.allowLocalBackup,
+                     config->master.chainReplication,
+                     config->master.coalesceBackupWrites)
     , segmentManager(context, config, serverId,
                      allocator, replicaManager, masterTableMetadata)
     , log(context, config, this, &segmentManager, &replicaManager)
-    , objectMap(config->master.hashTableBytes / HashTable::bytesPerCacheLine())
+    , objectMap(config->master.hashTableBytes / HashTable::bytesPerCacheLine(),
+                getReferenceKeyHash, this)
+    , updateFrequencies()
     , anyWrites(false)
     , hashTableBucketLocks()
+    , hashTableBucketVersions()
+    , optimisticReadsDisabled(false)
     , lockTable(1000, log)
     , mutex("ObjectManager::mutex")
     , tombstoneRemover(this, &objectMap)
     , tombstoneProtectorCount(0)
+    , hashTableResizer(this,
+            config->master.hashTableBytes / HashTable::bytesPerCacheLine(),
+            config->master.maxHashTableBytes / HashTable::bytesPerCacheLine())
+    , resizeProtectorCount(0)
+    , preparedOpReplayLock("ObjectManager::preparedOpReplayLock")
 {
-    for (size_t i = 0; i < arrayLength(hashTableBucketLocks); i++)
+    for (size_t i = 0; i < arrayLength(hashTableBucketLocks); i++) {
         hashTableBucketLocks[i].setName("hashTableBucketLock");
+        hashTableBucketVersions[i] = 0;
+    }
+
+    if (config->master.segregateHotWrites) {
+        // 64K counters per row (256 KB in all) keep collisions rare for the
+        // working sets we care about; a key overwritten four times within
+        // the last ~650K writes is considered hot.
+        updateFrequencies.construct(1U << 16, downCast<uint8_t>(4));
+    }
 }
 
 /**
@@ -145,6 +166,9 @@ ObjectManager::initOnceEnlisted()
 
     if (!config->master.disableLogCleaner)
         log.enableCleaner();
+
+    if (hashTableResizer.isEnabled())
+        hashTableResizer.start(0);
 }
 
 /**
@@ -200,6 +224,18 @@ ObjectManager::readHashes(const uint64_t tableId, uint32_t reqNumHashes,
     for (*respNumHashes = 0; *respNumHashes < reqNumHashes;
             *respNumHashes += 1) {
 
+        // Prefetch the next batch of objects before reading any of them,
+        // so that their cache misses overlap.
+        if (*respNumHashes % MAX_PREFETCH_BATCH == 0) {
+            KeyHash batch[MAX_PREFETCH_BATCH];
+            uint32_t batchSize = reqNumHashes - *respNumHashes;
+            if (batchSize > MAX_PREFETCH_BATCH)
+                batchSize = MAX_PREFETCH_BATCH;
+            pKHashes->copy(pKHashesOffset, batchSize * sizeof32(KeyHash),
+                           batch);
+            prefetchObjects(batch, batchSize);
+        }
+
         pKHash = *(pKHashes->getOffset<uint64_t>(pKHashesOffset));
         pKHashesOffset += sizeof32(pKHash);
 
@@ -297,6 +333,69 @@ ObjectManager::prefetchHashTableBucket(SegmentIterator* it)
     }
 }
 
+/**
+ * Bring the hash table buckets and log entries for a batch of objects into
+ * the cache ahead of reading them (e.g., with readObject()). Reading objects
+ * one at a time takes two dependent cache misses per object (the bucket,
+ * then the log entry); this method issues the misses for all of the objects
+ * together, in two stages, so that they overlap.
+ *
+ * This is purely a performance hint: nothing is looked up or returned, and
+ * objects may be modified or removed between this call and the subsequent
+ * reads, which do their own (normally lock-free) lookups. No bucket locks
+ * are taken here; the buckets are scanned the same way #lookupOptimistically
+ * does, and a bucket that is being updated is simply skipped.
+ *
+ * \param keyHashes
+ *      Key hashes of the objects that are about to be read.
+ * \param numHashes
+ *      Number of entries in keyHashes. Batches larger than
+ *      MAX_PREFETCH_BATCH are likely to evict their own early entries from
+ *      the cache before they are read.
+ */
+void
+ObjectManager::prefetchObjects(const KeyHash* keyHashes, uint32_t numHashes)
+{
+    // Stage 1: start loading every bucket.
+    for (uint32_t i = 0; i < numHashes; i++)
+        objectMap.prefetchBucket(keyHashes[i]);
+
+    // Scanning the buckets without locks is only safe while the bucket
+    // array can't be switched by a resize (see readObject). The fence
+    // orders the check after the RPC's epoch was recorded.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (optimisticReadsDisabled.load(std::memory_order_acquire))
+        return;
+
+    // Stage 2: start loading the log entries referenced from every bucket.
+    // By the time we scan the first bucket its miss should have overlapped
+    // with all the others. Prefetches can't fault, so a stale reference
+    // costs at most a wasted cache line; the version checks only keep us
+    // from following a chain while it is being modified.
+    uint64_t numLocks = arrayLength(hashTableBucketLocks);
+    for (uint32_t i = 0; i < numHashes; i++) {
+        uint64_t unused;
+        uint64_t bucket = HashTable::findBucketIndex(
+                objectMap.getNumBuckets(), keyHashes[i], &unused);
+        std::atomic<uint64_t>& bucketVersion =
+                hashTableBucketVersions[bucket & (numLocks - 1)];
+        uint64_t startVersion = bucketVersion.load(std::memory_order_acquire);
+        if ((startVersion & 1) != 0)
+            continue;
+        HashTable::Candidates candidates;
+        objectMap.lookup(keyHashes[i], candidates);
+        while (!candidates.isDone()) {
+            Log::Reference reference(candidates.peekReference());
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (bucketVersion.load(std::memory_order_relaxed) != startVersion)
+                break;
+            if (reference.toInteger() != 0)
+                reference.prefetchEntry();
+            candidates.next();
+        }
+    }
+}
+
 /**
  * Read an object previously written to this ObjectManager.
  *
@@ -314,6 +413,11 @@ ObjectManager::prefetchHashTableBucket(SegmentIterator* it)
  * \param valueOnly
  *      If true, then only the value portion of the object is written to
  *      outBuffer. Otherwise, keys and value are written to outBuffer.
+ * \param[out] wouldBlock
+ *      If non-NULL, the read must not block: if it would have to wait for a
+ *      hash table bucket lock or for the object to be replicated, true is
+ *      stored here and STATUS_RETRY is returned without reading anything.
+ *      Otherwise false is stored here.
  * \return
  *      Returns STATUS_OK if the lookup succeeded and the reject rules did not
  *      preclude this read. Other status values indicate different failures
@@ -322,20 +426,51 @@ ObjectManager::prefetchHashTableBucket(SegmentIterator* it)
 Status
 ObjectManager::readObject(Key& key, Buffer* outBuffer,
                 RejectRules* rejectRules, uint64_t* outVersion,
-                bool valueOnly)
+                bool valueOnly, bool* wouldBlock)
 {
+    if (wouldBlock != NULL)
+        *wouldBlock = false;
+
+    // Number of times to try reading without the bucket lock before giving
+    // up and taking it, so that readers can't be starved by a stream of
+    // updates to their bucket.
+    const int maxOptimisticAttempts = 3;
+
     objectMap.prefetchBucket(key.getHash());
-    HashTableBucketLock lock(*this, key);
 
     // If the tablet doesn't exist in the NORMAL state, we must plead ignorance.
     if (!tabletManager->checkAndIncrementReadCount(key))
         return STATUS_UNKNOWN_TABLET;
 
+    // Reads don't modify the hash table, so first try to look the object up
+    // without taking the bucket lock: taking it would serialize readers of
+    // hot keys with one another. Note that the check of
+    // #optimisticReadsDisabled must follow the RPC's epoch being recorded
+    // (see HashTableResizer::optimisticReadersDrained); the locking done by
+    // checkAndIncrementReadCount above orders the two.
     Buffer buffer;
     LogEntryType type;
     uint64_t version;
     Log::Reference reference;
-    bool found = lookup(lock, key, type, buffer, &version, &reference);
+    bool found = false;
+    bool looked = false;
+    if (!optimisticReadsDisabled.load(std::memory_order_acquire)) {
+        for (int i = 0; i < maxOptimisticAttempts && !looked; i++) {
+            looked = lookupOptimistically(key, type, buffer, &version,
+                                          &reference, &found);
+        }
+    }
+    if (!looked && wouldBlock != NULL) {
+        HashTableBucketLock lock(*this, key, std::try_to_lock);
+        if (!lock.ownsLock()) {
+            *wouldBlock = true;
+            return STATUS_RETRY;
+        }
+        found = lookup(lock, key, type, buffer, &version, &reference);
+    } else if (!looked) {
+        HashTableBucketLock lock(*this, key);
+        found = lookup(lock, key, type, buffer, &version, &reference);
+    }
     if (!found || type != LOG_ENTRY_TYPE_OBJ)
         return STATUS_OBJECT_DOESNT_EXIST;
 
@@ -349,6 +484,10 @@ ObjectManager::readObject(Key& key, Buffer* outBuffer,
     }
 
     // Ensure the object being read is replicated durably.
+    if (wouldBlock != NULL && !log.isSynced(reference)) {
+        *wouldBlock = true;
+        return STATUS_RETRY;
+    }
     log.syncTo(reference);
 
     Object object(buffer);
@@ -480,6 +619,7 @@ ObjectManager::removeObject(Key& key, RejectRules* rejectRules,
 
     TableStats::increment(masterTableMetadata,
                           tablet.tableId,
+                          key.getHash(),
                           appends[0].buffer.size() + appends[1].buffer.size(),
                           rpcResult ? 2 : 1);
     segmentManager.raiseSafeVersion(object.getVersion() + 1);
@@ -496,6 +636,8 @@ ObjectManager::removeObject(Key& key, RejectRules* rejectRules,
 void
 ObjectManager::removeOrphanedObjects()
 {
+    // A resize could move entries into buckets we have already passed.
+    ResizeProtector resizeProtector(this);
     for (uint64_t i = 0; i < objectMap.getNumBuckets(); i++) {
         HashTableBucketLock lock(*this, i);
         CleanupParameters params = { this , &lock };
@@ -705,6 +847,7 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
                     tombstoneAppendCount++;
                     TableStats::increment(masterTableMetadata,
                             key.getTableId(),
+                            key.getHash(),
                             tombstoneBuffer.size(),
                             1);
 
@@ -726,6 +869,7 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
                                 &newObjReference);
                 TableStats::increment(masterTableMetadata,
                                       key.getTableId(),
+                                      key.getHash(),
                                       it.getLength(),
                                       1);
             }
@@ -816,6 +960,7 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
                     tombstoneAppendCount++;
                     TableStats::increment(masterTableMetadata,
                             key.getTableId(),
+                            key.getHash(),
                             tombstoneBuffer.size(),
                             1);
 
@@ -860,6 +1005,7 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
             tombstoneAppendCount++;
             TableStats::increment(masterTableMetadata,
                     key.getTableId(),
+                    key.getHash(),
                     buffer.size(),
                     1);
             replace(lock, key, newTombReference);
@@ -959,6 +1105,7 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
                              op.header.rpcId);
             }
 
+            SpinLock::Guard preparedOpGuard(preparedOpReplayLock);
             HashTableBucketLock lock(*this, key);
 
             uint64_t minSuccessor = 0;
@@ -1017,6 +1164,7 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
                              opTomb.header.rpcId);
             }
 
+            SpinLock::Guard preparedOpGuard(preparedOpReplayLock);
             if (!transactionManager->isOpDeleted(opTomb.header.clientLeaseId,
                                                  opTomb.header.rpcId) &&
                 !transactionManager->getOp(opTomb.header.clientLeaseId,
@@ -1292,7 +1440,12 @@ ObjectManager::writeObject(Object& newObject, RejectRules* rejectRules,
         appends[rpcResultIndex].type = LOG_ENTRY_TYPE_RPCRESULT;
     }
 
-    if (!log.append(appends, (tombstone ? 2 : 1) + (rpcResult ? 1 : 0))) {
+    // Objects whose keys are overwritten often go to the log's hot head, so
+    // that they don't keep segments full of colder data from emptying out.
+    bool hot = updateFrequencies &&
+               updateFrequencies->recordUpdate(key.getHash());
+
+    if (!log.append(appends, (tombstone ? 2 : 1) + (rpcResult ? 1 : 0), hot)) {
         // The log is out of space. Tell the client to retry and hope
         // that the cleaner makes space soon.
         throw RetryException(HERE, 1000, 2000, "Must wait for cleaner");
@@ -1341,6 +1494,7 @@ ObjectManager::writeObject(Object& newObject, RejectRules* rejectRules,
 
         TableStats::increment(masterTableMetadata,
                               tablet.tableId,
+                              key.getHash(),
                               byteCount,
                               recordCount);
     }
@@ -1925,6 +2079,7 @@ ObjectManager::commitRemove(PreparedOp& op,
 
         TableStats::increment(masterTableMetadata,
                               tombstone.getTableId(),
+                              key.getHash(),
                               byteCount,
                               recordCount);
     }
@@ -2052,6 +2207,7 @@ ObjectManager::commitWrite(PreparedOp& op,
 
     TableStats::increment(masterTableMetadata,
                           prepOpTombstone.header.tableId,
+                          key.getHash(),
                           byteCount,
                           recordCount);
     ++PerfStats::threadStats.writeCount;
@@ -2167,6 +2323,7 @@ ObjectManager::flushEntriesToLog(Buffer *logBuffer, uint32_t& numEntries)
             tabletManager->incrementWriteCount(key);
             TableStats::increment(masterTableMetadata,
                                   tableId,
+                                  key.getHash(),
                                   entryLength, 1);
 
         } else if (type == LOG_ENTRY_TYPE_OBJTOMB) {
@@ -2199,6 +2356,7 @@ ObjectManager::flushEntriesToLog(Buffer *logBuffer, uint32_t& numEntries)
             tabletManager->incrementWriteCount(key);
             TableStats::increment(masterTableMetadata,
                                   tableId,
+                                  key.getHash(),
                                   entryLength, 1);
 
         }
@@ -2455,6 +2613,7 @@ ObjectManager::TombstoneRemover::TombstoneRemover(
                 HashTable* objectMap)
     : WorkerTimer(objectManager->context->dispatch)
     , currentBucket(0)
+    , walkNumBuckets(objectMap->getNumBuckets())
     , objectManager(objectManager)
     , objectMap(objectMap)
 {
@@ -2467,6 +2626,15 @@ ObjectManager::TombstoneRemover::TombstoneRemover(
 void
 ObjectManager::TombstoneRemover::handleTimerEvent()
 {
+    // The scan spans many firings, so it can't keep the hash table from
+    // being resized in between. Entries only move between buckets when the
+    // number of buckets changes; if it has, start the scan over.
+    ResizeProtector resizeProtector(objectManager);
+    if (objectMap->getNumBuckets() != walkNumBuckets) {
+        walkNumBuckets = objectMap->getNumBuckets();
+        currentBucket = 0;
+    }
+
     for (int i = 0; i < 100; i++) {
         if (currentBucket >= objectMap->getNumBuckets()) {
             LOG(NOTICE, "Tombstone cleanup complete");
@@ -2513,6 +2681,215 @@ ObjectManager::TombstoneProtector::~TombstoneProtector()
     }
 }
 
+/**
+ * Construct a HashTableResizer. The resizer does nothing until it is started.
+ *
+ * \param objectManager
+ *      The ObjectManager whose #objectMap will be resized.
+ * \param minBuckets
+ *      The table will never shrink below this many buckets (normally the
+ *      size it was created with).
+ * \param maxBuckets
+ *      The table will never grow beyond this many buckets. If this is not
+ *      larger than minBuckets, resizing is disabled.
+ */
+ObjectManager::HashTableResizer::HashTableResizer(
+                ObjectManager* objectManager,
+                uint64_t minBuckets,
+                uint64_t maxBuckets)
+    : WorkerTimer(objectManager->context->dispatch)
+    , objectManager(objectManager)
+    , minBuckets(minBuckets ? BitOps::powerOfTwoLessOrEqual(minBuckets) : 0)
+    , maxBuckets(maxBuckets ? BitOps::powerOfTwoLessOrEqual(maxBuckets) : 0)
+    , targetNumBuckets(0)
+    , nextOldBucket(0)
+    , drainEpoch(0)
+{
+    uint64_t numLocks = arrayLength(objectManager->hashTableBucketLocks);
+    if (maxBuckets > minBuckets && minBuckets < numLocks) {
+        LOG(WARNING, "Hash table too small to be resized (%lu buckets, "
+            "need at least %lu); resizing disabled", minBuckets, numLocks);
+        this->maxBuckets = 0;
+    }
+}
+
+/**
+ * Return whether the resizer was configured to do anything at all.
+ */
+bool
+ObjectManager::HashTableResizer::isEnabled() const
+{
+    return maxBuckets > minBuckets;
+}
+
+/**
+ * Decide how many buckets the hash table should have, given the number of
+ * entries currently in it. The table doubles when it is more than 3/4 full
+ * and halves when it is less than 1/8 full, which leaves enough hysteresis
+ * that it won't bounce between two sizes.
+ */
+uint64_t
+ObjectManager::HashTableResizer::chooseNumBuckets()
+{
+    HashTable& objectMap = objectManager->objectMap;
+    uint64_t numBuckets = objectMap.getNumBuckets();
+    uint64_t capacity = numBuckets * HashTable::entriesPerCacheLine();
+    uint64_t numEntries = objectMap.getNumEntries();
+
+    if (numEntries > capacity / 4 * 3 && numBuckets < maxBuckets)
+        return numBuckets * 2;
+    if (numEntries < capacity / 8 && numBuckets > minBuckets)
+        return numBuckets / 2;
+    return numBuckets;
+}
+
+/**
+ * Returns true once no RPC that could have started a lock-free lookup
+ * before optimistic reads were disabled (at #drainEpoch) is still running.
+ * Until then, such a lookup might be walking the current bucket array, so
+ * the arrays mustn't be switched.
+ */
+bool
+ObjectManager::HashTableResizer::optimisticReadersDrained()
+{
+    uint64_t earliestEpoch;
+    {
+        Dispatch::Lock lock(objectManager->context->dispatch);
+        earliestEpoch = LogProtector::getEarliestOutstandingEpoch(
+                            Transport::ServerRpc::READ_ACTIVITY);
+    }
+    return earliestEpoch > drainEpoch;
+}
+
+/**
+ * Start or finish a resize of the hash table. Both require that nobody else
+ * be using the table, so this acquires every bucket lock.
+ *
+ * \param starting
+ *      True means call HashTable::startResize, false means call
+ *      HashTable::finishResize.
+ * \return
+ *      False if a ResizeProtector exists, in which case nothing was done
+ *      and the caller should try again later. True otherwise.
+ */
+bool
+ObjectManager::HashTableResizer::switchBucketArrays(bool starting)
+{
+    SpinLock::Guard guard(objectManager->mutex);
+    if (objectManager->resizeProtectorCount > 0)
+        return false;
+
+    UnnamedSpinLock* locks = objectManager->hashTableBucketLocks;
+    size_t numLocks = arrayLength(objectManager->hashTableBucketLocks);
+    for (size_t i = 0; i < numLocks; i++)
+        locks[i].lock();
+    if (starting)
+        objectManager->objectMap.startResize();
+    else
+        objectManager->objectMap.finishResize();
+    for (size_t i = 0; i < numLocks; i++)
+        locks[i].unlock();
+    return true;
+}
+
+/**
+ * Check whether the hash table needs resizing and, if it is being resized,
+ * move the entries in a few buckets to the new bucket array. Then reschedule
+ * ourselves, so we don't lock out other WorkerTimers for a long time.
+ */
+void
+ObjectManager::HashTableResizer::handleTimerEvent()
+{
+    // How long to wait between checks of the table's load factor, and
+    // before retrying a blocked switch of the bucket arrays.
+    const uint64_t checkIntervalMicros = 100000;
+    const uint64_t retryIntervalMicros = 1000;
+
+    HashTable& objectMap = objectManager->objectMap;
+    if (!objectMap.isResizing()) {
+        if (targetNumBuckets == 0) {
+            uint64_t newNumBuckets = chooseNumBuckets();
+            if (newNumBuckets == objectMap.getNumBuckets()) {
+                start(Cycles::rdtsc() +
+                      Cycles::fromMicroseconds(checkIntervalMicros));
+                return;
+            }
+            objectMap.prepareResize(newNumBuckets);
+            targetNumBuckets = newNumBuckets;
+
+            // Lock-free readers don't synchronize with the switch of bucket
+            // arrays, so stop new ones from starting and wait out the rest.
+            // They are allowed again once the resize is finished.
+            objectManager->optimisticReadsDisabled = true;
+            drainEpoch = LogProtector::incrementCurrentEpoch() - 1;
+        }
+
+        if (!optimisticReadersDrained() || !switchBucketArrays(true)) {
+            start(Cycles::rdtsc() +
+                  Cycles::fromMicroseconds(retryIntervalMicros));
+            return;
+        }
+        LOG(NOTICE, "Resizing hash table from %lu to %lu buckets "
+            "(%lu entries)", objectMap.getNumOldBuckets(),
+            objectMap.getNumBuckets(), objectMap.getNumEntries());
+        targetNumBuckets = 0;
+        nextOldBucket = 0;
+    }
+
+    uint64_t numOldBuckets = objectMap.getNumOldBuckets();
+    {
+        // Moving entries while an enumeration walks the table could make it
+        // skip them, so hold off while any ResizeProtector exists.
+        SpinLock::Guard guard(objectManager->mutex);
+        if (objectManager->resizeProtectorCount > 0) {
+            start(Cycles::rdtsc() +
+                  Cycles::fromMicroseconds(retryIntervalMicros));
+            return;
+        }
+        for (int i = 0; i < 100 && nextOldBucket < numOldBuckets; i++) {
+            HashTableBucketLock lock(*objectManager, nextOldBucket);
+            objectMap.rehashBucket(nextOldBucket);
+            ++nextOldBucket;
+        }
+    }
+
+    if (nextOldBucket >= numOldBuckets) {
+        if (!switchBucketArrays(false)) {
+            start(Cycles::rdtsc() +
+                  Cycles::fromMicroseconds(retryIntervalMicros));
+            return;
+        }
+        objectManager->optimisticReadsDisabled = false;
+        LOG(NOTICE, "Hash table resize to %lu buckets complete",
+            objectMap.getNumBuckets());
+    }
+
+    // Either more buckets remain to be rehashed or the table may need to be
+    // resized again; run again after any other WorkerTimers that are ready.
+    start(0);
+}
+
+/**
+ * Constructor for ResizeProtectors. The HashTableResizer pauses (without
+ * abandoning a resize in progress) until all protectors are gone.
+ */
+ObjectManager::ResizeProtector::ResizeProtector(
+        ObjectManager* objectManager)
+    : objectManager(objectManager)
+{
+    SpinLock::Guard guard(objectManager->mutex);
+    ++objectManager->resizeProtectorCount;
+}
+
+/**
+ * Destructor for ResizeProtectors.
+ */
+ObjectManager::ResizeProtector::~ResizeProtector()
+{
+    SpinLock::Guard guard(objectManager->mutex);
+    --objectManager->resizeProtectorCount;
+}
+
 /**
  * Produce a human-readable description of the contents of a segment.
  * Intended primarily for use in unit tests.
@@ -2738,6 +3115,119 @@ ObjectManager::lookup(HashTableBucketLock& lock, Key& key,
     return false;
 }
 
+/**
+ * Look up an object or tombstone like #lookup does, but without holding the
+ * key's HashTableBucketLock. Instead, the bucket's entry in
+ * #hashTableBucketVersions is checked before any reference found in the hash
+ * table is followed into the log; if the bucket was being or has been
+ * updated since the lookup started, the lookup is abandoned. Log entries
+ * never change once written and their memory isn't reused while the calling
+ * RPC is running, so a reference that was in the table while no update was
+ * in progress can safely be used after the check.
+ *
+ * The caller must ensure that #objectMap isn't resized while this method
+ * runs (see #optimisticReadsDisabled).
+ *
+ * \param key
+ *      The key being looked up.
+ * \param[out] outType
+ *      The type of the log entry found.
+ * \param[out] buffer
+ *      Buffer to append the log entry to.
+ * \param[out] outVersion
+ *      If non-NULL, the version of the object or tombstone is returned here.
+ * \param[out] outReference
+ *      If non-NULL, the log reference of the entry is returned here.
+ * \param[out] outFound
+ *      Set to true if the key was found, false otherwise. Only valid when
+ *      this method returns true.
+ * \return
+ *      True if the lookup completed without interference, in which case the
+ *      results are exactly what #lookup would have produced at some point
+ *      during the call. False means a concurrent update to the bucket got
+ *      in the way and nothing was returned; the caller should try again or
+ *      fall back to #lookup.
+ */
+bool
+ObjectManager::lookupOptimistically(Key& key, LogEntryType& outType,
+                Buffer& buffer, uint64_t* outVersion,
+                Log::Reference* outReference, bool* outFound)
+{
+    uint64_t unused;
+    uint64_t bucket = HashTable::findBucketIndex(objectMap.getNumBuckets(),
+                                                 key.getHash(), &unused);
+    uint64_t numLocks = arrayLength(hashTableBucketLocks);
+    std::atomic<uint64_t>& bucketVersion =
+            hashTableBucketVersions[bucket & (numLocks - 1)];
+
+    uint64_t startVersion = bucketVersion.load(std::memory_order_acquire);
+    if ((startVersion & 1) != 0)
+        return false;
+
+    HashTable::Candidates candidates;
+    objectMap.lookup(key.getHash(), candidates);
+    while (true) {
+        Log::Reference candidateRef(candidates.isDone() ? 0 :
+                                    candidates.peekReference());
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (bucketVersion.load(std::memory_order_relaxed) != startVersion)
+            return false;
+        if (candidates.isDone())
+            break;
+        if (candidateRef.toInteger() == 0) {
+            candidates.next();
+            continue;
+        }
+
+        Buffer candidateBuffer;
+        LogEntryType type = log.getEntry(candidateRef, candidateBuffer);
+        Key candidateKey(type, candidateBuffer);
+        if (key == candidateKey) {
+            outType = type;
+            buffer.append(&candidateBuffer);
+            if (outVersion != NULL) {
+                if (type == LOG_ENTRY_TYPE_OBJ) {
+                    Object o(candidateBuffer);
+                    *outVersion = o.getVersion();
+                } else {
+                    ObjectTombstone o(candidateBuffer);
+                    *outVersion = o.getObjectVersion();
+                }
+            }
+            if (outReference != NULL)
+                *outReference = candidateRef;
+            *outFound = true;
+            return true;
+        }
+
+        candidates.next();
+    }
+
+    *outFound = false;
+    return true;
+}
+
+/**
+ * Implementation of HashTable::KeyHashFunction for #objectMap: compute the
+ * full key hash of the object or tombstone a hash table reference refers to.
+ * Used when resizing the table.
+ *
+ * \param reference
+ *      Log reference stored in the hash table.
+ * \param cookie
+ *      The ObjectManager that owns the hash table.
+ */
+KeyHash
+ObjectManager::getReferenceKeyHash(uint64_t reference, void* cookie)
+{
+    ObjectManager* objectManager = reinterpret_cast<ObjectManager*>(cookie);
+    Buffer buffer;
+    LogEntryType type = objectManager->log.getEntry(Log::Reference(reference),
+                                                    buffer);
+    Key key(type, buffer);
+    return key.getHash();
+}
+
 /**
  * Remove an object from the hash table, if it exists in it. Return whether or
  * not it was found and removed.
@@ -2865,6 +3355,7 @@ ObjectManager::removeIfTombstone(uint64_t maybeTomb, void *cookie)
 void
 ObjectManager::removeTombstones()
 {
+    ResizeProtector resizeProtector(this);
     for (uint64_t i = 0; i < objectMap.getNumBuckets(); i++) {
         HashTableBucketLock lock(*this, i);
         CleanupParameters params = { this , &lock };
@@ -2969,6 +3460,7 @@ ObjectManager::relocateObject(Buffer& oldBuffer, Log::Reference oldReference,
     // the stats accordingly.
     TableStats::decrement(masterTableMetadata,
                           key.getTableId(),
+                          key.getHash(),
                           oldBuffer.size(),
                           1);
 }
@@ -3211,6 +3703,7 @@ ObjectManager::relocateTombstone(Buffer& oldBuffer, Log::Reference oldReference,
         // Tombstone will be dropped/"cleaned" so stats should be updated.
         TableStats::decrement(masterTableMetadata,
                               tomb.getTableId(),
+                              key.getHash(),
                               oldBuffer.size(),
                               1);
     }
@@ -16,6 +16,8 @@
 #ifndef RAMCLOUD_OBJECTMANAGER_H
 #define RAMCLOUD_OBJECTMANAGER_H
 
+#include <mutex>
+
 #include "Common.h"
 #include "Log.h"
 #include "SideLog.h"
@@ -37,6 +39,7 @@
 #include "TxRecoveryManager.h"
 #include "MasterTableMetadata.h"
 #include "UnackedRpcResults.h"
+#include "UpdateFrequencySketch.h"
 #include "LockTable.h"
 
 namespace RAMCloud {
@@ -69,14 +72,22 @@ class ObjectManager : public LogEntryHandlers,
     virtual void freeLogEntry(Log::Reference ref);
     void initOnceEnlisted();
 
+    /**
+     * The maximum number of key hashes worth passing to a single
+     * prefetchObjects() call; callers reading more objects than this should
+     * prefetch them in batches of this size.
+     */
+    static const uint32_t MAX_PREFETCH_BATCH = 32;
+
     void readHashes(const uint64_t tableId, uint32_t reqNumHashes,
                 Buffer* pKHashes, uint32_t initialPKHashesOffset,
                 uint32_t maxLength, Buffer* response, uint32_t* respNumHashes,
                 uint32_t* numObjects);
     void prefetchHashTableBucket(SegmentIterator* it);
+    void prefetchObjects(const KeyHash* keyHashes, uint32_t numHashes);
     Status readObject(Key& key, Buffer* outBuffer,
                 RejectRules* rejectRules, uint64_t* outVersion,
-                bool valueOnly = false);
+                bool valueOnly = false, bool* wouldBlock = NULL);
     Status removeObject(Key& key, RejectRules* rejectRules,
                 uint64_t* outVersion, Buffer* removedObjBuffer = NULL,
                 RpcResult* rpcResult = NULL, uint64_t* rpcResultPtr = NULL);
@@ -154,6 +165,24 @@ class ObjectManager : public LogEntryHandlers,
         DISALLOW_COPY_AND_ASSIGN(TombstoneProtector);
     };
 
+    /**
+     * An object of this class must be held by any activity that walks the
+     * hash table without holding bucket locks (e.g., enumeration). While
+     * there exist any of these objects, the hash table won't be resized and
+     * no entries are moved between bucket arrays.
+     */
+    class ResizeProtector {
+      public:
+        explicit ResizeProtector(ObjectManager* objectManager);
+        ~ResizeProtector();
+
+      PRIVATE:
+        // Saved copy of the constructor argument.
+        ObjectManager* objectManager;
+
+        DISALLOW_COPY_AND_ASSIGN(ResizeProtector);
+    };
+
   PRIVATE:
     /**
      * An instance of this class locks the bucket of the hash table that a given
@@ -164,6 +193,12 @@ class ObjectManager : public LogEntryHandlers,
      * belonging to that key. ObjectManager maintains a number of fine-grained
      * locks to reduce the likelihood of contention between operations on
      * different keys (see ObjectManager::hashTableBucketLocks).
+     *
+     * Every holder of the lock is assumed to modify the bucket, so the
+     * lock's entry in ObjectManager::hashTableBucketVersions is made odd
+     * while it is held and advanced again when it is released. Readers
+     * that don't take the lock use this to detect conflicting updates
+     * (see ObjectManager::lookupOptimistically).
      */
     class HashTableBucketLock {
       public:
@@ -178,6 +213,7 @@ class ObjectManager : public LogEntryHandlers,
          */
         HashTableBucketLock(ObjectManager& objectManager, Key& key)
             : lock(NULL)
+            , version(NULL)
         {
             uint64_t unused;
             uint64_t bucket = HashTable::findBucketIndex(
@@ -186,6 +222,28 @@ class ObjectManager : public LogEntryHandlers,
             takeBucketLock(objectManager, bucket);
         }
 
+        /**
+         * This constructor finds the bucket a given key maps to in the hash
+         * table and acquires the lock only if nobody else holds it. Use
+         * ownsLock() to find out whether it did.
+         *
+         * \param objectManager
+         *      The ObjectManager that owns the hash table bucket to lock.
+         * \param key
+         *      Key whose corresponding bucket in the hash table will be locked.
+         */
+        HashTableBucketLock(ObjectManager& objectManager, Key& key,
+                            std::try_to_lock_t)
+            : lock(NULL)
+            , version(NULL)
+        {
+            uint64_t unused;
+            uint64_t bucket = HashTable::findBucketIndex(
+                        objectManager.objectMap.getNumBuckets(),
+                        key.getHash(), &unused);
+            takeBucketLock(objectManager, bucket, true);
+        }
+
         /**
          * This constructor acquires the lock for a particular bucket index
          * in the hash table.
@@ -197,40 +255,75 @@ class ObjectManager : public LogEntryHandlers,
          */
         HashTableBucketLock(ObjectManager& objectManager, uint64_t bucket)
             : lock(NULL)
+            , version(NULL)
         {
             takeBucketLock(objectManager, bucket);
         }
 
+        /// Return false if a try-lock constructor found the lock taken.
+        bool ownsLock() const
+        {
+            return lock != NULL;
+        }
+
         ~HashTableBucketLock()
         {
+            if (lock == NULL)
+                return;
+
+            // Make the version even again only once all of our updates to
+            // the bucket are visible.
+            version->store(version->load(std::memory_order_relaxed) + 1,
+                           std::memory_order_release);
             lock->unlock();
         }
 
       PRIVATE:
         /**
          * Helper method that actually acquires the appropriate bucket lock.
-         * Used by both constructors.
+         * Used by all of the constructors.
          *
          * \param objectManager
          *      The ObjectManager that owns the hash table bucket to lock.
          * \param bucket
          *      Index of the hash table bucket to lock.
+         * \param tryOnly
+         *      True means give up, leaving #lock NULL, if the lock is held.
          */
         void
-        takeBucketLock(ObjectManager& objectManager, uint64_t bucket)
+        takeBucketLock(ObjectManager& objectManager, uint64_t bucket,
+                       bool tryOnly = false)
         {
             assert(lock == NULL);
             uint32_t numLocks = arrayLength(objectManager.hashTableBucketLocks);
             assert(BitOps::isPowerOfTwo(numLocks));
             uint64_t lockIndex = bucket & (numLocks - 1);
-            lock = &objectManager.hashTableBucketLocks[lockIndex];
-            lock->lock();
+            SpinLock* bucketLock =
+                    &objectManager.hashTableBucketLocks[lockIndex];
+            if (tryOnly) {
+                if (!bucketLock->try_lock())
+                    return;
+            } else {
+                bucketLock->lock();
+            }
+            lock = bucketLock;
+
+            // The version must be seen to be odd before any of our updates
+            // to the bucket are.
+            version = &objectManager.hashTableBucketVersions[lockIndex];
+            version->store(version->load(std::memory_order_relaxed) + 1,
+                           std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
         }
 
         /// The hash table bucket spinlock this object acquired in the
         /// constructor and will release in the destructor.
         SpinLock* lock;
 
+        /// The entry of ObjectManager::hashTableBucketVersions that
+        /// corresponds to #lock.
+        std::atomic<uint64_t>* version;
+
         DISALLOW_COPY_AND_ASSIGN(HashTableBucketLock);
     };
 
@@ -262,6 +355,10 @@ class ObjectManager : public LogEntryHandlers,
         /// Which bucket of #objectMap should be cleaned out next.
         uint64_t currentBucket;
 
+        /// Number of buckets #objectMap had when #currentBucket was last
+        /// checked. If a resize changes it, the scan restarts at bucket 0.
+        uint64_t walkNumBuckets;
+
         /// The ObjectManager that owns the hash table to remove tombstones
         /// from in the #recoveryCleanup callback.
         ObjectManager* objectManager;
@@ -274,15 +371,66 @@ class ObjectManager : public LogEntryHandlers,
         DISALLOW_COPY_AND_ASSIGN(TombstoneRemover);
     };
 
+    /**
+     * This object executes in the background (as a WorkerTimer) to grow or
+     * shrink #objectMap when the number of entries in it changes. A resize
+     * rehashes a few buckets at a time, each under its bucket lock, so reads
+     * and writes proceed while it runs. Only switching bucket arrays at the
+     * start and end of a resize briefly takes every bucket lock.
+     *
+     * Resizing relies on every bucket array having at least as many buckets
+     * as there are #hashTableBucketLocks: the lock for a key is then
+     * determined by low-order key hash bits that all array sizes share.
+     */
+    class HashTableResizer : public WorkerTimer {
+      public:
+        HashTableResizer(ObjectManager* objectManager,
+                        uint64_t minBuckets, uint64_t maxBuckets);
+        void handleTimerEvent();
+        bool isEnabled() const;
+
+      PRIVATE:
+        uint64_t chooseNumBuckets();
+        bool optimisticReadersDrained();
+        bool switchBucketArrays(bool starting);
+
+        /// The ObjectManager whose #objectMap is resized.
+        ObjectManager* objectManager;
+
+        /// The table never shrinks below this many buckets.
+        uint64_t minBuckets;
+
+        /// The table never grows beyond this many buckets.
+        uint64_t maxBuckets;
+
+        /// If non-zero, the size passed to HashTable::prepareResize for a
+        /// resize that couldn't start yet.
+        uint64_t targetNumBuckets;
+
+        /// Next bucket of the old bucket array to rehash.
+        uint64_t nextOldBucket;
+
+        /// The log epoch current when optimistic reads were disabled for
+        /// the resize being prepared. The bucket arrays can't be switched
+        /// until every RPC that started at or before this epoch is done.
+        uint64_t drainEpoch;
+
+        DISALLOW_COPY_AND_ASSIGN(HashTableResizer);
+    };
+
     static string dumpSegment(Segment* segment);
     uint32_t getObjectTimestamp(Buffer& buffer);
     uint32_t getTombstoneTimestamp(Buffer& buffer);
     uint32_t getTxDecisionRecordTimestamp(Buffer& buffer);
+    static KeyHash getReferenceKeyHash(uint64_t reference, void* cookie);
     bool lookup(HashTableBucketLock& lock, Key& key,
                 LogEntryType& outType, Buffer& buffer,
                 uint64_t* outVersion = NULL,
                 Log::Reference* outReference = NULL,
                 HashTable::Candidates* outCandidates = NULL);
+    bool lookupOptimistically(Key& key, LogEntryType& outType, Buffer& buffer,
+                uint64_t* outVersion, Log::Reference* outReference,
+                bool* outFound);
     friend void recoveryCleanup(uint64_t maybeTomb, void *cookie);
     bool remove(HashTableBucketLock& lock, Key& key);
     static void removeIfOrphanedObject(uint64_t reference, void *cookie);
@@ -378,6 +526,14 @@ class ObjectManager : public LogEntryHandlers,
      */
     HashTable objectMap;
 
+    /**
+     * Estimates how often each key has been overwritten recently, so that
+     * writeObject() can send frequently overwritten objects to the log's hot
+     * head. Only constructed if ServerConfig::Master::segregateHotWrites is
+     * set.
+     */
+    Tub<UpdateFrequencySketch> updateFrequencies;
+
     /**
      * Used to identify the first write request, so that we can initialize
      * connections to all backups at that time (this is a temporary kludge
@@ -394,13 +550,30 @@ class ObjectManager : public LogEntryHandlers,
      */
     UnnamedSpinLock hashTableBucketLocks[1024];
 
+    /**
+     * One sequence number for each of #hashTableBucketLocks. It is odd
+     * while the lock is held and is advanced each time the lock is taken
+     * or released (see HashTableBucketLock). readObject() uses this to
+     * read without taking the lock: if a version is even and unchanged
+     * across a lookup, no update to the bucket overlapped the lookup.
+     */
+    std::atomic<uint64_t> hashTableBucketVersions[1024];
+
+    /**
+     * True means lock-free reads in readObject() must not be attempted,
+     * because #hashTableResizer is about to switch #objectMap's bucket
+     * arrays, or has and hasn't finished the resize yet.
+     */
+    std::atomic<bool> optimisticReadsDisabled;
+
     /**
      * Locks objects during transactions.
      */
     LockTable lockTable;
 
     /**
-     * Protects access to tombstoneRemover and tombstoneProtectorCount.
+     * Protects access to tombstoneRemover, tombstoneProtectorCount, and
+     * resizeProtectorCount.
      */
     SpinLock mutex;
 
@@ -416,6 +589,25 @@ class ObjectManager : public LogEntryHandlers,
      */
     int tombstoneProtectorCount;
 
+    /**
+     * Grows and shrinks #objectMap in the background, if enabled.
+     */
+    HashTableResizer hashTableResizer;
+
+    /**
+     * Number of ResizeProtector objects that currently exist for this
+     * ObjectManager. Protected by #mutex.
+     */
+    int resizeProtectorCount;
+
+    /**
+     * Serializes replaySegment()'s handling of prepared operations and their
+     * tombstones. TransactionManager is checked and updated in separate
+     * steps for these, so segments replayed in parallel (see
+     * SegmentReplayer) must not interleave them.
+     */
+    SpinLock preparedOpReplayLock;
+
     friend class CleanerCompactionBenchmark;
     friend class ObjectManagerBenchmark;
 
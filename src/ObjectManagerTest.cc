@@ -81,6 +81,11 @@ class ObjectManagerTest : public ::testing::Test,
         tabletManager.addTablet(0, 0, ~0UL, TabletManager::NORMAL);
     }
 
+    ~ObjectManagerTest()
+    {
+        WorkerTimer::disableTimerHandlers = false;
+    }
+
     /**
      * Build a properly formatted segment containing a single object. This
      * segment may be passed directly to the ObjectManager::replaySegment()
@@ -614,6 +619,109 @@ TEST_F(ObjectManagerTest, readObject) {
         tabletManager.toString());
 }
 
+TEST_F(ObjectManagerTest, readObject_withoutLockFreeLookup) {
+    Buffer buffer;
+    Key key(0, "1", 1);
+    storeObject(key, "hi", 93);
+    uint64_t numLocks = arrayLength(objectManager.hashTableBucketLocks);
+    uint64_t unused;
+    uint64_t lockIndex = HashTable::findBucketIndex(
+            objectManager.objectMap.getNumBuckets(), key.getHash(), &unused) &
+            (numLocks - 1);
+    std::atomic<uint64_t>& bucketVersion =
+            objectManager.hashTableBucketVersions[lockIndex];
+
+    // An update seems to be in progress forever: fall back to the lock.
+    bucketVersion = 1;
+    uint64_t version;
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key, &buffer, 0, &version));
+    EXPECT_EQ(93UL, version);
+    EXPECT_EQ(3UL, bucketVersion);
+    bucketVersion = 0;
+
+    // Lock-free reads disabled.
+    objectManager.optimisticReadsDisabled = true;
+    buffer.reset();
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key, &buffer, 0, &version));
+    EXPECT_EQ(93UL, version);
+    EXPECT_EQ(2UL, bucketVersion);
+    objectManager.optimisticReadsDisabled = false;
+
+    // The usual case doesn't touch the lock.
+    buffer.reset();
+    EXPECT_EQ(STATUS_OK,
+              objectManager.readObject(key, &buffer, 0, &version, true));
+    EXPECT_EQ(2UL, bucketVersion);
+    EXPECT_EQ("hi", TestUtil::toString(&buffer));
+}
+
+TEST_F(ObjectManagerTest, readObject_wouldBlock) {
+    Buffer buffer;
+    Key key(0, "1", 1);
+    Log::Reference reference = storeObject(key, "hi", 93);
+    uint64_t version;
+    bool wouldBlock = false;
+
+    // Not replicated yet: reading it would have to wait for backups.
+    EXPECT_FALSE(objectManager.log.isSynced(reference));
+    EXPECT_EQ(STATUS_RETRY, objectManager.readObject(key, &buffer, 0,
+            &version, true, &wouldBlock));
+    EXPECT_TRUE(wouldBlock);
+    EXPECT_EQ(0U, buffer.size());
+
+    objectManager.log.sync();
+    EXPECT_TRUE(objectManager.log.isSynced(reference));
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key, &buffer, 0,
+            &version, true, &wouldBlock));
+    EXPECT_FALSE(wouldBlock);
+    EXPECT_EQ("hi", TestUtil::toString(&buffer));
+
+    // The bucket lock is needed but held by someone else.
+    objectManager.optimisticReadsDisabled = true;
+    buffer.reset();
+    {
+        ObjectManager::HashTableBucketLock lock(objectManager, key);
+        EXPECT_EQ(STATUS_RETRY, objectManager.readObject(key, &buffer, 0,
+                &version, true, &wouldBlock));
+        EXPECT_TRUE(wouldBlock);
+    }
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key, &buffer, 0,
+            &version, true, &wouldBlock));
+    EXPECT_FALSE(wouldBlock);
+    objectManager.optimisticReadsDisabled = false;
+}
+
+TEST_F(ObjectManagerTest, prefetchObjects) {
+    Buffer buffer;
+    Key key1(0, "1", 1);
+    storeObject(key1, "hi", 93);
+    Key key2(0, "2", 1);
+    storeTombstone(key2);
+    Key key3(0, "3", 1);
+
+    // Prefetching is only a hint: it mustn't read log entries or count as
+    // a read, whether or not the objects exist.
+    TestLog::Enable _;
+    KeyHash keyHashes[] = { key1.getHash(), key2.getHash(), key3.getHash() };
+    objectManager.prefetchObjects(keyHashes, arrayLength(keyHashes));
+    objectManager.prefetchObjects(keyHashes, 0);
+
+    // While a resize may switch bucket arrays, only buckets are prefetched.
+    objectManager.optimisticReadsDisabled = true;
+    objectManager.prefetchObjects(keyHashes, arrayLength(keyHashes));
+    objectManager.optimisticReadsDisabled = false;
+    EXPECT_EQ("", TestLog::get());
+    EXPECT_EQ("{ tableId: 0 startKeyHash: 0 "
+              "endKeyHash: 18446744073709551615 state: 0 reads: 0 writes: 0 }",
+              tabletManager.toString());
+
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key1, &buffer, 0, 0));
+    EXPECT_EQ(STATUS_OBJECT_DOESNT_EXIST,
+              objectManager.readObject(key2, &buffer, 0, 0));
+    EXPECT_EQ(STATUS_OBJECT_DOESNT_EXIST,
+              objectManager.readObject(key3, &buffer, 0, 0));
+}
+
 static bool
 antiGetEntryFilter(string s)
 {
@@ -830,7 +938,7 @@ TEST_F(ObjectManagerTest, replaySegment_tombstoneSynthesis) {
     it.construct(&seg[0], len, certificate);
     objectManager.replaySegment(&sl, *it);
     verifyRecoveryObject(key0, "new");
-    it.construct(*sl.head);
+    it.construct(*sl.heads[0].segment);
     while (it->getType() != LOG_ENTRY_TYPE_OBJ)
         it->next();
     it->next();
@@ -867,7 +975,7 @@ TEST_F(ObjectManagerTest, replaySegment_tombstoneSegmentId) {
     it.construct(&seg[0], len, certificate);
     objectManager.replaySegment(&sl, *it);
 
-    it.construct(*sl.head);
+    it.construct(*sl.heads[0].segment);
     while (it->getType() != LOG_ENTRY_TYPE_OBJTOMB)
         it->next();
     dataBuffer.reset();
@@ -1643,6 +1751,35 @@ TEST_F(ObjectManagerTest, writeObject) {
     objectManager.getLog()->totalLiveBytes = original;
 }
 
+TEST_F(ObjectManagerTest, writeObject_updateFrequencies) {
+    tabletManager.addTablet(1, 0, ~0UL, TabletManager::NORMAL);
+    Key key(1, "a", 1);
+    Buffer buffer;
+    Object obj(key, "value", 5, 0, 0, buffer);
+
+    // Not tracked unless hot writes are segregated.
+    EXPECT_FALSE(objectManager.updateFrequencies);
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(obj, 0, 0));
+
+    objectManager.updateFrequencies.construct(1024, downCast<uint8_t>(2));
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(obj, 0, 0));
+    EXPECT_EQ(1, objectManager.updateFrequencies->estimate(key.getHash()));
+    EXPECT_EQ(STATUS_OK, objectManager.writeObject(obj, 0, 0));
+    EXPECT_EQ(2, objectManager.updateFrequencies->estimate(key.getHash()));
+
+    // With no hot head, hot objects stay in the regular head.
+    LogEntryType type;
+    Buffer value;
+    Log::Reference reference;
+    {
+        ObjectManager::HashTableBucketLock lock(objectManager, key);
+        EXPECT_TRUE(objectManager.lookup(lock, key, type, value, NULL,
+                                         &reference));
+    }
+    EXPECT_EQ(objectManager.log.heads[0].segment,
+              objectManager.log.getSegment(reference));
+}
+
 TEST_F(ObjectManagerTest, writeObject_returnRemovedObj) {
     tabletManager.addTablet(1, 0, ~0UL, TabletManager::NORMAL);
     Key key(1, "a", 1);
@@ -2211,6 +2348,48 @@ TEST_F(ObjectManagerTest, TombstoneRemover_handleTimerEvent_doWork) {
     }
 }
 
+TEST_F(ObjectManagerTest, TombstoneRemover_handleTimerEvent_resizedMidWalk) {
+    WorkerTimer::disableTimerHandlers = true;
+    objectManager.hashTableResizer.stop();
+    LogEntryType type;
+    Buffer buffer;
+    ObjectManager::HashTableResizer& resizer = objectManager.hashTableResizer;
+    uint64_t numBuckets = objectManager.objectMap.getNumBuckets();
+    uint64_t unused;
+
+    // Find a key in the upper half of the table, which a shrink moves down
+    // into a bucket the scan has already passed.
+    string keyString;
+    uint64_t bucket = 0;
+    for (int i = 0; bucket < numBuckets / 2; i++) {
+        keyString = format("key%d", i);
+        Key key(0, keyString.c_str(), downCast<uint16_t>(keyString.size()));
+        bucket = HashTable::findBucketIndex(numBuckets, key.getHash(),
+                                            &unused);
+    }
+    Key key(0, keyString.c_str(), downCast<uint16_t>(keyString.size()));
+    storeTombstone(key);
+
+    objectManager.tombstoneRemover.currentBucket = bucket % (numBuckets / 2);
+    objectManager.tombstoneRemover.handleTimerEvent();
+    EXPECT_LT(bucket % (numBuckets / 2),
+              objectManager.tombstoneRemover.currentBucket);
+
+    resizer.minBuckets = numBuckets / 2;
+    resizer.maxBuckets = numBuckets;
+    do {
+        resizer.handleTimerEvent();
+    } while (objectManager.objectMap.isResizing());
+    EXPECT_EQ(numBuckets / 2, objectManager.objectMap.getNumBuckets());
+
+    while (objectManager.tombstoneRemover.currentBucket <
+            objectManager.objectMap.getNumBuckets()) {
+        objectManager.tombstoneRemover.handleTimerEvent();
+    }
+    ObjectManager::HashTableBucketLock lock(objectManager, key);
+    EXPECT_FALSE(objectManager.lookup(lock, key, type, buffer, 0, 0));
+}
+
 TEST_F(ObjectManagerTest, TombstoneProtector) {
     TestLog::Enable logEnabler("handleTimerEvent");
     Tub<ObjectManager::TombstoneProtector> protector1, protector2;
@@ -2242,6 +2421,118 @@ TEST_F(ObjectManagerTest, TombstoneProtector) {
             TestLog::get());
 }
 
+TEST_F(ObjectManagerTest, HashTableResizer_constructor) {
+    TestLog::Enable logEnabler("HashTableResizer");
+    ObjectManager::HashTableResizer disabled(&objectManager, 16384, 0);
+    EXPECT_FALSE(disabled.isEnabled());
+
+    ObjectManager::HashTableResizer enabled(&objectManager, 16384, 40000);
+    EXPECT_TRUE(enabled.isEnabled());
+    EXPECT_EQ(32768lu, enabled.maxBuckets);
+    EXPECT_EQ("", TestLog::get());
+
+    ObjectManager::HashTableResizer tooSmall(&objectManager, 512, 4096);
+    EXPECT_FALSE(tooSmall.isEnabled());
+    EXPECT_EQ("HashTableResizer: Hash table too small to be resized "
+              "(512 buckets, need at least 1024); resizing disabled",
+              TestLog::get());
+}
+
+TEST_F(ObjectManagerTest, HashTableResizer_handleTimerEvent) {
+    LogEntryType type;
+    Buffer buffer;
+    // This test drives the resizer directly, so keep its timer from
+    // firing on a worker thread at the same time.
+    WorkerTimer::disableTimerHandlers = true;
+    objectManager.hashTableResizer.stop();
+    TestLog::Enable logEnabler("handleTimerEvent");
+    ObjectManager::HashTableResizer& resizer = objectManager.hashTableResizer;
+    uint64_t numBuckets = objectManager.objectMap.getNumBuckets();
+
+    Key key1(0, "key1", 4);
+    storeObject(key1, "value1", 1);
+    Key key2(0, "key2", 4);
+    storeObject(key2, "value2", 2);
+
+    // The table is nearly empty, so it should shrink.
+    resizer.minBuckets = numBuckets / 2;
+    resizer.maxBuckets = numBuckets;
+
+    // A ResizeProtector keeps the resize from starting.
+    Tub<ObjectManager::ResizeProtector> protector;
+    protector.construct(&objectManager);
+    resizer.handleTimerEvent();
+    EXPECT_FALSE(objectManager.objectMap.isResizing());
+    EXPECT_EQ(numBuckets / 2, resizer.targetNumBuckets);
+    EXPECT_TRUE(resizer.isRunning());
+    EXPECT_EQ("", TestLog::get());
+    EXPECT_TRUE(objectManager.optimisticReadsDisabled);
+    protector.destroy();
+
+    resizer.handleTimerEvent();
+    EXPECT_TRUE(objectManager.objectMap.isResizing());
+    EXPECT_EQ(0lu, resizer.targetNumBuckets);
+    EXPECT_EQ(100lu, resizer.nextOldBucket);
+    EXPECT_EQ(format("handleTimerEvent: Resizing hash table from %lu to %lu "
+                     "buckets (2 entries)", numBuckets, numBuckets / 2),
+              TestLog::get());
+    TestLog::reset();
+
+    // Objects must stay visible throughout the resize.
+    while (objectManager.objectMap.isResizing()) {
+        {
+            ObjectManager::HashTableBucketLock lock(objectManager, key1);
+            EXPECT_TRUE(objectManager.lookup(lock, key1, type, buffer, 0, 0));
+        }
+        {
+            ObjectManager::HashTableBucketLock lock(objectManager, key2);
+            EXPECT_TRUE(objectManager.lookup(lock, key2, type, buffer, 0, 0));
+        }
+        resizer.handleTimerEvent();
+    }
+    EXPECT_EQ(format("handleTimerEvent: Hash table resize to %lu buckets "
+                     "complete", numBuckets / 2), TestLog::get());
+    EXPECT_EQ(numBuckets / 2, objectManager.objectMap.getNumBuckets());
+    EXPECT_EQ(2lu, objectManager.objectMap.getNumEntries());
+    EXPECT_FALSE(objectManager.optimisticReadsDisabled);
+    {
+        ObjectManager::HashTableBucketLock lock(objectManager, key1);
+        EXPECT_TRUE(objectManager.lookup(lock, key1, type, buffer, 0, 0));
+    }
+
+    // Now at the minimum size, so nothing more to do.
+    TestLog::reset();
+    resizer.handleTimerEvent();
+    EXPECT_FALSE(objectManager.objectMap.isResizing());
+    EXPECT_EQ("", TestLog::get());
+}
+
+TEST_F(ObjectManagerTest, HashTableResizer_waitForOptimisticReaders) {
+    WorkerTimer::disableTimerHandlers = true;
+    objectManager.hashTableResizer.stop();
+    ObjectManager::HashTableResizer& resizer = objectManager.hashTableResizer;
+    uint64_t numBuckets = objectManager.objectMap.getNumBuckets();
+    resizer.minBuckets = numBuckets / 2;
+    resizer.maxBuckets = numBuckets;
+
+    // An activity (such as a read RPC) that started before the resize was
+    // prepared could be walking the bucket array.
+    LogProtector::Activity activity;
+    activity.start(Transport::ServerRpc::READ_ACTIVITY);
+    resizer.handleTimerEvent();
+    EXPECT_TRUE(objectManager.optimisticReadsDisabled);
+    EXPECT_FALSE(objectManager.objectMap.isResizing());
+    EXPECT_TRUE(resizer.isRunning());
+
+    // Later activities don't hold up the resize.
+    activity.stop();
+    LogProtector::Activity laterActivity;
+    laterActivity.start(Transport::ServerRpc::READ_ACTIVITY);
+    resizer.handleTimerEvent();
+    EXPECT_TRUE(objectManager.objectMap.isResizing());
+    laterActivity.stop();
+}
+
 TEST_F(ObjectManagerTest, lookup_object) {
     Key key(1, "1", 1);
     Buffer buffer;
@@ -2275,6 +2566,58 @@ TEST_F(ObjectManagerTest, lookup_object) {
     EXPECT_EQ(reference, r);
 }
 
+TEST_F(ObjectManagerTest, lookupOptimistically) {
+    Key key(1, "1", 1);
+    Buffer buffer;
+    LogEntryType type;
+    uint64_t version;
+    Log::Reference reference;
+    bool found = true;
+
+    EXPECT_TRUE(objectManager.lookupOptimistically(key, type, buffer,
+                &version, &reference, &found));
+    EXPECT_FALSE(found);
+
+    Log::Reference stored = storeObject(key, "value", 15);
+    EXPECT_TRUE(objectManager.lookupOptimistically(key, type, buffer,
+                &version, &reference, &found));
+    EXPECT_TRUE(found);
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, type);
+    EXPECT_EQ(15U, version);
+    EXPECT_EQ(stored, reference);
+    Object o(buffer);
+    EXPECT_EQ("value", string(reinterpret_cast<const char*>(o.getValue()),
+                              o.getValueLength()));
+
+    // Fails while the bucket is locked (and so perhaps being updated).
+    ObjectManager::HashTableBucketLock lock(objectManager, key);
+    EXPECT_FALSE(objectManager.lookupOptimistically(key, type, buffer,
+                &version, &reference, &found));
+}
+
+TEST_F(ObjectManagerTest, HashTableBucketLock_version) {
+    Key key(1, "1", 1);
+    uint64_t numLocks = arrayLength(objectManager.hashTableBucketLocks);
+    uint64_t unused;
+    uint64_t lockIndex = HashTable::findBucketIndex(
+            objectManager.objectMap.getNumBuckets(), key.getHash(), &unused) &
+            (numLocks - 1);
+    std::atomic<uint64_t>& bucketVersion =
+            objectManager.hashTableBucketVersions[lockIndex];
+
+    bucketVersion = 0;
+    {
+        ObjectManager::HashTableBucketLock lock(objectManager, key);
+        EXPECT_EQ(1UL, bucketVersion);
+    }
+    EXPECT_EQ(2UL, bucketVersion);
+    {
+        ObjectManager::HashTableBucketLock lock(objectManager, lockIndex);
+        EXPECT_EQ(3UL, bucketVersion);
+    }
+    EXPECT_EQ(4UL, bucketVersion);
+}
+
 TEST_F(ObjectManagerTest, lookup_tombstone) {
     Key key(1, "1", 1);
     Buffer buffer;
@@ -2585,11 +2928,12 @@ TEST_F(ObjectManagerTest, keyPointsAtReference) {
     obj.assembleForLog(objBuffer);
     sl.append(LOG_ENTRY_TYPE_OBJ, objBuffer);
 
-    it.construct(*sl.head);
+    it.construct(*sl.heads[0].segment);
     while (it->getType() != LOG_ENTRY_TYPE_OBJ)
         it->next();
 
-    Log::Reference reference = sl.head->getReference(it->getOffset());
+    Log::Reference reference =
+        sl.heads[0].segment->getReference(it->getOffset());
     EXPECT_FALSE(objectManager.keyPointsAtReference(
                 key, reference));
 
@@ -92,6 +92,20 @@ PerfStats::collectStats(PerfStats* total)
         total->logSyncCycles += stats->logSyncCycles;
         total->segmentUnopenedCycles += stats->segmentUnopenedCycles;
         total->workerActiveCycles += stats->workerActiveCycles;
+        total->inlineRpcs += stats->inlineRpcs;
+        total->inlineRpcCycles += stats->inlineRpcCycles;
+        total->inlineRpcsDeferred += stats->inlineRpcsDeferred;
+        total->workerCoreCycles += stats->workerCoreCycles;
+        for (int c = 0; c < RPC_CLASSES; c++) {
+            total->rpcClassCount[c] += stats->rpcClassCount[c];
+            total->rpcClassWaitCycles[c] += stats->rpcClassWaitCycles[c];
+            total->rpcClassLatencyCycles[c] +=
+                    stats->rpcClassLatencyCycles[c];
+            for (int b = 0; b < RPC_LATENCY_BUCKETS; b++) {
+                total->rpcClassLatencyHistogram[c][b] +=
+                        stats->rpcClassLatencyHistogram[c][b];
+            }
+        }
         total->btreeNodeReads += stats->btreeNodeReads;
         total->btreeNodeWrites += stats->btreeNodeWrites;
         total->btreeBytesRead += stats->btreeBytesRead;
@@ -160,6 +174,29 @@ PerfStats::printClusterStats(Buffer* first, Buffer* second)
                 diff["readObjectBytes"][i] + diff["readKeyBytes"][i]);
         diff["writeBytesObjectsAndKeys"].push_back(
                 diff["writeObjectBytes"][i] + diff["writeKeyBytes"][i]);
+        double cyclesPerMicro = diff["cyclesPerSecond"][i]*1e-06;
+        for (int c = 0; c < RPC_CLASSES; c++) {
+            diff[format("rpcClassWaitMicros%d", c)].push_back(
+                    diff[format("rpcClassWaitCycles%d", c)][i]
+                    / cyclesPerMicro);
+            diff[format("rpcClassLatencyMicros%d", c)].push_back(
+                    diff[format("rpcClassLatencyCycles%d", c)][i]
+                    / cyclesPerMicro);
+
+            // 99th-percentile latency: the upper bound of the histogram
+            // bucket containing it.
+            double count = diff[format("rpcClassCount%d", c)][i];
+            double sum = 0;
+            double p99 = 0;
+            for (int b = 0; (b < RPC_LATENCY_BUCKETS) && (count > 0); b++) {
+                sum += diff[format("rpcClassLatencyHistogram%d.%d", c, b)][i];
+                if (sum >= 0.99*count) {
+                    p99 = static_cast<double>(1 << b);
+                    break;
+                }
+            }
+            diff[format("rpcClassP99Micros%d", c)].push_back(p99);
+        }
     }
 
     result.append(format("%-30s %s\n", "Server index",
@@ -173,6 +210,36 @@ PerfStats::printClusterStats(Buffer* first, Buffer* second)
     result.append(format("%-30s %s\n", "Worker load factor",
             formatMetricRatio(&diff, "workerActiveCycles", "collectionTime",
             " %8.3f").c_str()));
+    result.append(format("%-30s %s\n", "Worker cores allocated",
+            formatMetricRatio(&diff, "workerCoreCycles", "collectionTime",
+            " %8.3f").c_str()));
+    result.append(format("%-30s %s\n", "Inline RPC load factor",
+            formatMetricRatio(&diff, "inlineRpcCycles", "collectionTime",
+            " %8.3f").c_str()));
+    result.append(format("%-30s %s\n", "Inline RPCs (K)",
+            formatMetric(&diff, "inlineRpcs", " %8.1f", 1e-3).c_str()));
+    result.append(format("%-30s %s\n", "Inline RPCs deferred (K)",
+            formatMetric(&diff, "inlineRpcsDeferred", " %8.1f", 1e-3).c_str()));
+
+    const char* classNames[RPC_CLASSES] =
+            {"Interactive", "Normal", "Background"};
+    for (int c = 0; c < RPC_CLASSES; c++) {
+        result.append(format("\n%s RPCs:\n", classNames[c]));
+        result.append(format("%-30s %s\n", "  RPCs (K)",
+                formatMetric(&diff, format("rpcClassCount%d", c).c_str(),
+                " %8.1f", 1e-3).c_str()));
+        result.append(format("%-30s %s\n", "  Average wait (us)",
+                formatMetricRatio(&diff,
+                format("rpcClassWaitMicros%d", c).c_str(),
+                format("rpcClassCount%d", c).c_str(), " %8.1f").c_str()));
+        result.append(format("%-30s %s\n", "  Average latency (us)",
+                formatMetricRatio(&diff,
+                format("rpcClassLatencyMicros%d", c).c_str(),
+                format("rpcClassCount%d", c).c_str(), " %8.1f").c_str()));
+        result.append(format("%-30s %s\n", "  99% latency (us, <=)",
+                formatMetric(&diff, format("rpcClassP99Micros%d", c).c_str(),
+                " %8.0f").c_str()));
+    }
 
     result.append("\nReads:\n");
     result.append(format("%-30s %s\n", "  Objects read (K)",
@@ -372,6 +439,27 @@ PerfStats::clusterDiff(Buffer* before, Buffer* after,
         ADD_METRIC(writeKeyBytes);
         ADD_METRIC(dispatchActiveCycles);
         ADD_METRIC(workerActiveCycles);
+        ADD_METRIC(inlineRpcs);
+        ADD_METRIC(inlineRpcCycles);
+        ADD_METRIC(inlineRpcsDeferred);
+        ADD_METRIC(workerCoreCycles);
+        for (int c = 0; c < RPC_CLASSES; c++) {
+            (*diff)[format("rpcClassCount%d", c)].push_back(
+                    static_cast<double>(p2.rpcClassCount[c]
+                    - p1.rpcClassCount[c]));
+            (*diff)[format("rpcClassWaitCycles%d", c)].push_back(
+                    static_cast<double>(p2.rpcClassWaitCycles[c]
+                    - p1.rpcClassWaitCycles[c]));
+            (*diff)[format("rpcClassLatencyCycles%d", c)].push_back(
+                    static_cast<double>(p2.rpcClassLatencyCycles[c]
+                    - p1.rpcClassLatencyCycles[c]));
+            for (int b = 0; b < RPC_LATENCY_BUCKETS; b++) {
+                (*diff)[format("rpcClassLatencyHistogram%d.%d", c, b)]
+                        .push_back(static_cast<double>(
+                        p2.rpcClassLatencyHistogram[c][b]
+                        - p1.rpcClassLatencyHistogram[c][b]));
+            }
+        }
         ADD_METRIC(btreeNodeReads);
         ADD_METRIC(btreeNodeWrites);
         ADD_METRIC(btreeBytesRead);
@@ -89,6 +89,51 @@ struct PerfStats {
     /// as a worker.
     uint64_t workerActiveCycles;
 
+    /// Total number of RPCs executed inline by the thread that received
+    /// them, rather than by a worker (see WorkerManager::runInline).
+    uint64_t inlineRpcs;
+
+    /// Total time (in Cycles::rdtsc ticks) spent executing RPCs inline;
+    /// included in dispatchActiveCycles, not workerActiveCycles.
+    uint64_t inlineRpcCycles;
+
+    /// Total number of RPCs that were eligible to run inline but were
+    /// handed to a worker because the inline time budget was used up or
+    /// because the dispatch thread would have had to block.
+    uint64_t inlineRpcsDeferred;
+
+    /// Integral over time of the number of cores the WorkerManager lets
+    /// workers occupy (busy or polling), in core-Cycles::rdtsc ticks;
+    /// divided by collectionTime this gives the average number of cores
+    /// allocated to workers.
+    uint64_t workerCoreCycles;
+
+    /// Number of RPC scheduling classes (WorkerManager::RpcClass) with
+    /// separate statistics below.
+    static const int RPC_CLASSES = 3;
+
+    /// Number of buckets in rpcClassLatencyHistogram. Bucket i counts
+    /// RPCs whose latency was less than 2^i microseconds (and at least
+    /// 2^(i-1) microseconds, for i > 0); the last bucket also holds all
+    /// longer RPCs.
+    static const int RPC_LATENCY_BUCKETS = 20;
+
+    /// For each RPC class: total number of RPCs executed by workers.
+    uint64_t rpcClassCount[RPC_CLASSES];
+
+    /// For each RPC class: total time (in Cycles::rdtsc ticks) that RPCs
+    /// spent waiting for a worker thread.
+    uint64_t rpcClassWaitCycles[RPC_CLASSES];
+
+    /// For each RPC class: total time (in Cycles::rdtsc ticks) from when
+    /// RPCs were received by the WorkerManager until their replies were
+    /// sent.
+    uint64_t rpcClassLatencyCycles[RPC_CLASSES];
+
+    /// For each RPC class: a histogram of the latencies included in
+    /// rpcClassLatencyCycles, used to estimate tail latency.
+    uint64_t rpcClassLatencyHistogram[RPC_CLASSES][RPC_LATENCY_BUCKETS];
+
     //--------------------------------------------------------------------
     // Statistics for index operations. Only one copy of PerfStats is
     // kept for all indexing structures, so the numbers below are
@@ -130,7 +175,7 @@ struct PerfStats {
     uint64_t logBytesAppended;
 
     /// Number of replication RPCs made to the primary replica of a head
-    /// segment.
+    /// segment. A coalesced RPC carrying several primary writes counts once.
     uint64_t replicationRpcs;
 
     /// Total time (in cycles) spent by worker threads waiting for log
@@ -47,6 +47,8 @@ class PerfStatsTest : public ::testing::Test {
         stats->readObjectBytes = 3*value;
         stats->writeObjectBytes = 4*value;
         stats->temp5 = 5*value;
+        stats->rpcClassCount[1] = 6*value;
+        stats->rpcClassLatencyHistogram[2][3] = 7*value;
     }
 
     // Fills a PerfStats::Diff with sample data.
@@ -161,6 +163,21 @@ TEST_F(PerfStatsTest, collectStats) {
     EXPECT_EQ(220u, total.writeCount);
 }
 
+TEST_F(PerfStatsTest, collectStats_rpcClasses) {
+    PerfStats::registerStats(&stats);
+    stats.rpcClassCount[2] = 3;
+    stats.rpcClassLatencyHistogram[1][4] = 5;
+    PerfStats stats2;
+    PerfStats::registerStats(&stats2);
+    stats2.rpcClassCount[2] = 30;
+    stats2.rpcClassLatencyHistogram[1][4] = 50;
+    PerfStats total;
+    PerfStats::collectStats(&total);
+    EXPECT_EQ(33u, total.rpcClassCount[2]);
+    EXPECT_EQ(0u, total.rpcClassCount[0]);
+    EXPECT_EQ(55u, total.rpcClassLatencyHistogram[1][4]);
+}
+
 TEST_F(PerfStatsTest, clusterDiff_findMatchingData) {
     // Test code that skips entries where either before or after
     // data is missing.
@@ -193,6 +210,9 @@ TEST_F(PerfStatsTest, clusterDiff_collectMetrics) {
     EXPECT_EQ(5000.0, diff["temp5"][0]);
     EXPECT_EQ(15000.0, diff["temp5"][1]);
     EXPECT_EQ(10000.0, diff["temp5"][2]);
+    EXPECT_EQ(6000.0, diff["rpcClassCount1"][0]);
+    EXPECT_EQ(12000.0, diff["rpcClassCount1"][2]);
+    EXPECT_EQ(7000.0, diff["rpcClassLatencyHistogram2.3"][0]);
 }
 
 TEST_F(PerfStatsTest, parseStats_basics) {
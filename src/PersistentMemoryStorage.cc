@@ -0,0 +1,908 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#include "PersistentMemoryStorage.h"
+#include "BackupMasterRecovery.h"
+#include "ClientException.h"
+#include "CycleCounter.h"
+#include "Fence.h"
+#include "ShortMacros.h"
+
+// Older C libraries don't define these; the values are from the kernel's
+// <linux/mman.h> (Linux 4.15 and later).
+#ifndef MAP_SHARED_VALIDATE
+#define MAP_SHARED_VALIDATE 0x03
+#endif
+#ifndef MAP_SYNC
+#define MAP_SYNC 0x80000
+#endif
+
+namespace RAMCloud {
+
+// --- PersistentMemoryStorage::Frame ---
+
+/**
+ * Create a Frame associated with a region of the mapped file that may hold
+ * a replica.
+ */
+PersistentMemoryStorage::Frame::Frame(PersistentMemoryStorage* storage,
+                                      size_t frameIndex)
+    : storage(storage)
+    , frameIndex(frameIndex)
+    , appendMutex()
+    , isOpen()
+    , isClosed()
+    , appendedToByCurrentProcess()
+    , loadRequested()
+    , metadata(new char[METADATA_SIZE])
+    , metadataVersion(0)
+    , metadataSlot(1)
+{
+    memset(metadata.get(), '\0', METADATA_SIZE);
+
+    // Pick up where the metadata versions in the file left off, even if
+    // the metadata isn't loaded, so that new metadata always supersedes it.
+    for (uint32_t slot = 0; slot < 2; ++slot) {
+        const MetadataSlot* stored = storage->metadataSlot(frameIndex, slot);
+        if (checkMetadataSlot(stored) && stored->version >= metadataVersion) {
+            metadataVersion = stored->version;
+            metadataSlot = slot;
+        }
+    }
+}
+
+/**
+ * Returns true if append has been called on this frame during the life of this
+ * process; returns false otherwise. This includes across free()/open() cycles.
+ * This is used by the backup replica garbage collector to determine whether it
+ * might have missed a BackupFree rpc from a master, in which case it has to
+ * query the master for the replica status. This is "appended to" rather than
+ * "opened by" because of benchmark(); benchmark "opens" replicas and loads them
+ * but doesn't do any. Masters open and append data in a single rpc, so this
+ * is a fine proxy.
+ */
+bool
+PersistentMemoryStorage::Frame::wasAppendedToByCurrentProcess()
+{
+    return appendedToByCurrentProcess;
+}
+
+/**
+ * Reloads metadata from the mapped file into memory; only used when
+ * restarting a backup from storage. After this call returns getMetadata()
+ * will return the metadata in the newer of the frame's intact metadata slots
+ * (or zeroes if neither is intact) up until the first call to open() on this
+ * frame. This can only be safely called immediately after frame is
+ * constructed (NOT opened), before any methods are called on it.
+ */
+void
+PersistentMemoryStorage::Frame::loadMetadata()
+{
+    const MetadataSlot* stored = storage->metadataSlot(frameIndex,
+                                                       metadataSlot);
+    if (metadataVersion > 0 && checkMetadataSlot(stored))
+        memcpy(metadata.get(), stored->metadata, METADATA_SIZE);
+    else
+        memset(metadata.get(), '\0', METADATA_SIZE);
+}
+
+/**
+ * Return a pointer to the most recently appended metadata for this frame.
+ * Warning: Concurrent calls to append modify the metadata that the return
+ * of this method points to. In practice it should only be called when the
+ * frame isn't accepting appends (either it was just constructed or one of
+ * close, load, or free has already been called on it). Used only during
+ * backup restart and master recovery to extract details about the replica
+ * in this frame without loading the frame.
+ */
+const void*
+PersistentMemoryStorage::Frame::getMetadata()
+{
+    return metadata.get();
+}
+
+/**
+ * The replica is always in memory, so this only prevents any further
+ * append() calls from being accepted.
+ */
+void
+PersistentMemoryStorage::Frame::startLoading()
+{
+    Lock lock(storage->mutex);
+    loadRequested = true;
+}
+
+/**
+ * Returns true if calling load() would not block. Always returns false if
+ * startLoading() or load() hasn't been called.
+ */
+bool
+PersistentMemoryStorage::Frame::isLoaded()
+{
+    Lock lock(storage->mutex);
+    if (!loadRequested)
+        return false;
+    // An append accepted before the load request may still be copying
+    // into the mapping; load() waits for it.
+    Lock appendLock(appendMutex, std::try_to_lock);
+    return appendLock.owns_lock();
+}
+
+/**
+ * Return a pointer to the replica data for recovery, which is read in place
+ * from the mapping. Prevents any further append() calls from being
+ * accepted, then blocks only until an append that was already in progress
+ * has finished copying its data into the mapping.
+ */
+void*
+PersistentMemoryStorage::Frame::load()
+{
+    startLoading();
+    Lock appendLock(appendMutex);
+    return storage->frameData(frameIndex);
+}
+
+/**
+ * Has no effect for PersistentMemoryStorage; there is no buffer to release.
+ */
+void
+PersistentMemoryStorage::Frame::unload()
+{
+}
+
+/**
+ * Append data to frame and update metadata. Both are durable in the mapped
+ * file when this returns: the data is flushed and fenced before the metadata
+ * is written, so the metadata never describes data that didn't make it.
+ *
+ * Idempotence: the caller must guarantee duplicated calls provide identical
+ * arguments.
+ *
+ * append() after a load() or a close() throws an exception to
+ * the master performing the append since it is either an error by the master
+ * or the master has crashed.
+ *
+ * \param source
+ *      Buffer contained the data to be copied into the frame.
+ * \param sourceOffset
+ *      Offset into \a source where data should be copied from.
+ * \param length
+ *      Bytes to copy to the frame starting at \a sourceOffset in \a source.
+ * \param destinationOffset
+ *      Offset into the frame where the source data should be copied.
+ * \param metadata
+ *      Metadata which should be written to storage immediately after the data
+ *      appended is written. May be NULL if there is no updated metadata to
+ *      commit to storage along with this data.
+ * \param metadataLength
+ *      Bytes of metadata pointed to by \a metadata. Ignored if \a metadata
+ *      is NULL.
+ */
+void
+PersistentMemoryStorage::Frame::append(Buffer& source,
+                                       size_t sourceOffset,
+                                       size_t length,
+                                       size_t destinationOffset,
+                                       const void* metadata,
+                                       size_t metadataLength)
+{
+    Lock lock(storage->mutex);
+    CycleCounter<uint64_t> ticks;
+    if (!isOpen) {
+        LOG(WARNING, "Tried to append to a frame but it wasn't "
+            "open on this backup; this can happen legitimately if a master's "
+            "rpc system retried a closing write rpc.");
+        throw BackupBadSegmentIdException(HERE);
+    }
+    if (loadRequested) {
+        LOG(NOTICE, "Tried to append to a frame but it was already enqueued "
+            "for load for recovery; calling master is probably already dead");
+        throw BackupBadSegmentIdException(HERE);
+    }
+    // Three conditions because overflow is possible on addition.
+    if (length > storage->segmentSize ||
+        destinationOffset > storage->segmentSize ||
+        length + destinationOffset > storage->segmentSize)
+    {
+        LOG(ERROR, "Out-of-bounds appended attempted on storage frame: "
+            "offset %lu, length %lu, segmentSize %lu ",
+            destinationOffset, length, storage->segmentSize);
+        throw BackupSegmentOverflowException(HERE);
+    }
+    if (metadataLength > METADATA_SIZE) {
+        LOG(ERROR, "Tried to append to a frame with metadata of length %lu "
+            "but storage only allows max length of %d",
+            metadataLength, METADATA_SIZE);
+        throw BackupSegmentOverflowException(HERE);
+    }
+
+    appendedToByCurrentProcess = true;
+    Lock appendLock(appendMutex);
+    lock.unlock();
+
+    char* destination = storage->frameData(frameIndex) + destinationOffset;
+    source.copy(downCast<uint32_t>(sourceOffset),
+                downCast<uint32_t>(length),
+                destination);
+    storage->persist(destination, length);
+
+    if (metadata)
+        writeMetadata(metadata, metadataLength);
+
+    storage->sleepToThrottleWrites(length + metadataLength, ticks.stop());
+}
+
+/**
+ * Mark this frame as closed. Calls to close after a call to load() throw
+ * BackupBadSegmentIdException which should kill the calling master; in this
+ * case recovery has already started for them so they are likely already dead.
+ */
+void
+PersistentMemoryStorage::Frame::close()
+{
+    Lock lock(storage->mutex);
+    if (isClosed)
+        return;
+    if (loadRequested) {
+        LOG(NOTICE, "Tried to close a frame but it was already enqueued "
+            "for load for recovery; calling master is probably already dead");
+        throw BackupBadSegmentIdException(HERE);
+    }
+    isOpen = false;
+    isClosed = true;
+}
+
+// See BackupStorage.h for documentation.
+void
+PersistentMemoryStorage::Frame::reopen(size_t length)
+{
+    // The replica is already in the mapping and durable up to length; the
+    // frame could be open or closed depending on state when it crashed.
+    Lock _(storage->mutex);
+    isOpen = true;
+    isClosed = false;
+    loadRequested = false;
+}
+
+/**
+ * Do not call; see BackupStorage::freeFrame().
+ * Make this frame available for reuse; data previously stored in this frame
+ * may or may not be part of future recoveries. It does not modify storage,
+ * only in-memory bookkeeping structures, so a previously freed frame will not
+ * be free on restart until higher-level backup code explicitly free them after
+ * it determines it is not needed. Blocks until any ongoing append to the
+ * frame completes.
+ */
+void
+PersistentMemoryStorage::Frame::free()
+{
+    Lock lock(storage->mutex);
+    Lock appendLock(appendMutex);
+    isOpen = false;
+    isClosed = false;
+    loadRequested = false;
+    memset(metadata.get(), '\0', METADATA_SIZE);
+    storage->freeMap[frameIndex] = 1;
+}
+
+// - private -
+
+/**
+ * Open the frame, resetting its state to accept appends for a new replica.
+ * Open is not synchronous itself. Even after return from open() if this
+ * backup crashes it may find the replica which was formerly stored in this
+ * frame or metadata for the former replica and data for the newly open replica.
+ * Recovery is expected to address these consistency issues with the checksums.
+ *
+ * Idempotence: Duplicate calls to open() are ignored until the frame is freed.
+ * Calling open() after the frame is freed will reset this frame for reuse
+ * with an new replica.
+ */
+void
+PersistentMemoryStorage::Frame::open()
+{
+    Lock _(storage->mutex);
+    if (isOpen || isClosed)
+        return;
+    isOpen = true;
+    isClosed = false;
+    memset(metadata.get(), '\0', METADATA_SIZE);
+    loadRequested = false;
+}
+
+/**
+ * Durably store new metadata for this frame in whichever of its two slots
+ * doesn't hold the current metadata, so that the current metadata survives
+ * if this is interrupted. Must be called with #appendMutex held.
+ *
+ * \param metadata
+ *      Metadata to store.
+ * \param metadataLength
+ *      Bytes of \a metadata; the rest of the slot is zeroed.
+ */
+void
+PersistentMemoryStorage::Frame::writeMetadata(const void* metadata,
+                                              size_t metadataLength)
+{
+    uint32_t slot = metadataSlot ^ 1;
+    MetadataSlot* stored = storage->metadataSlot(frameIndex, slot);
+    stored->version = metadataVersion + 1;
+    memcpy(stored->metadata, metadata, metadataLength);
+    memset(stored->metadata + metadataLength, '\0',
+           METADATA_SIZE - metadataLength);
+    Crc32C crc;
+    crc.update(&stored->version, sizeof(stored->version));
+    crc.update(stored->metadata, sizeof(stored->metadata));
+    stored->checksum = crc.getResult();
+    storage->persist(stored, sizeof(*stored));
+
+    metadataSlot = slot;
+    ++metadataVersion;
+    memcpy(this->metadata.get(), metadata, metadataLength);
+}
+
+// --- PersistentMemoryStorage ---
+
+/**
+ * Create a PersistentMemoryStorage.
+ *
+ * \param segmentSize
+ *      The size in bytes of the segments this storage will deal with.
+ * \param frameCount
+ *      The number of segments this storage can store simultaneously.
+ * \param writeRateLimit
+ *      When specified, writes to this storage instance should be
+ *      limited to at most the given rate (in megabytes per second).
+ *      The special value 0 turns off throttling.
+ * \param filePath
+ *      Path to the file or DAX device to map. A regular file is extended
+ *      if it is too small to hold \a frameCount frames.
+ * \throw BackupStorageException
+ *      The file couldn't be opened, extended, or mapped.
+ */
+PersistentMemoryStorage::PersistentMemoryStorage(size_t segmentSize,
+                                                 size_t frameCount,
+                                                 size_t writeRateLimit,
+                                                 const char* filePath)
+    : BackupStorage(segmentSize, Type::PERSISTENT_MEMORY, writeRateLimit)
+    , mutex()
+    , superblock()
+    , lastSuperblockFrame(1)
+    , frames()
+    , frameCount(frameCount)
+    , freeMap(frameCount)
+    , lastAllocatedFrame(FreeMap::npos)
+    , fd(-1)
+    , mappingBytes(0)
+    , mapping(NULL)
+    , mapSync(false)
+    , flushInstruction(chooseFlushInstruction())
+{
+    assert(filePath);
+    freeMap.set();
+    mappingBytes = offsetOfFrame(frameCount);
+
+    fd = ::open(filePath, O_CREAT | O_RDWR, 0666);
+    if (fd == -1) {
+        int e = errno;
+        LOG(ERROR, "Failed to open backup storage file %s: %s",
+            filePath, strerror(e));
+        throw BackupStorageException(HERE,
+            format("Failed to open backup storage file %s", filePath), e);
+    }
+
+    try {
+        reserveSpace(filePath);
+
+        void* p = mmap(NULL, mappingBytes, PROT_READ | PROT_WRITE,
+                       MAP_SHARED_VALIDATE | MAP_SYNC, fd, 0);
+        if (p != MAP_FAILED) {
+            mapSync = true;
+        } else {
+            LOG(NOTICE, "Backup storage file %s doesn't support MAP_SYNC "
+                "(%s); it isn't on persistent memory, so appends will be "
+                "made durable with msync", filePath, strerror(errno));
+            p = mmap(NULL, mappingBytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     fd, 0);
+            if (p == MAP_FAILED) {
+                throw BackupStorageException(HERE,
+                    format("Couldn't map backup storage file %s", filePath),
+                    errno);
+            }
+        }
+        mapping = static_cast<char*>(p);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+
+    for (size_t frame = 0; frame < frameCount; ++frame)
+        frames.emplace_back(this, frame);
+
+    LOG(NOTICE, "Backup storage mapped with %lu bytes available; allocated "
+            "%lu frame(s) with %lu bytes per frame (MAP_SYNC %s)",
+            frameCount * segmentSize, frameCount, segmentSize,
+            mapSync ? "on" : "off");
+}
+
+/// Unmap and close the file.
+PersistentMemoryStorage::~PersistentMemoryStorage()
+{
+    if (munmap(mapping, mappingBytes) == -1)
+        LOG(ERROR, "Couldn't unmap backup storage: %s", strerror(errno));
+    if (::close(fd) == -1)
+        LOG(ERROR, "Couldn't close backup storage: %s", strerror(errno));
+}
+
+/**
+ * Allocate a frame on storage, resetting its state to accept appends for a new
+ * replica. Open is not synchronous itself. Even after return from open() if
+ * this backup crashes it may find the replica which was formerly stored in
+ * this frame or metadata for the former replica and data for the newly open
+ * replica. Recovery is expected to address these consistency issues with the
+ * checksums.
+ *
+ * This call is NOT idempotent since it allocates and return resources to
+ * the caller. The caller must take care not to lose frames. Any returned
+ * frame which is not freed may be leaked until the backup (or the creating
+ * master crashes). For example, the BackupService will need to guarantee that
+ * any returned frame is associated with a particular replica and that future
+ * RPCs requesting the creation of that replica reuse the returned frame.
+ *
+ * \param sync
+ *      Ignored for PersistentMemoryStorage. All append() calls are durable
+ *      before they return.
+ * \param masterId
+ *      The server that owns the segment associated with this replica.
+ * \param segmentId
+ *      Unique identifier (in the log of masterId) of the segment
+ *      associated with this replica.
+ * \return
+ *      Reference to a frame through which handles all IO for a single
+ *      replica. Maintains a reference count; when destroyed if the
+ *      reference count drops to zero the frame will be freed for reuse with
+ *      another replica.
+ */
+BackupStorage::FrameRef
+PersistentMemoryStorage::open(bool sync, ServerId masterId, uint64_t segmentId)
+{
+    Lock lock(mutex);
+    FreeMap::size_type next = freeMap.find_next(lastAllocatedFrame);
+    if (next == FreeMap::npos) {
+        next = freeMap.find_first();
+        if (next == FreeMap::npos) {
+            RAMCLOUD_CLOG(WARNING, "Master tried to open a storage frame "
+                "but there are no frames free (all %lu frames are in use); "
+                "rejecting", frameCount);
+            throw BackupOpenRejectedException(HERE);
+        }
+    }
+    lastAllocatedFrame = next;
+    size_t frameIndex = next;
+    assert(freeMap[frameIndex] == 1);
+    freeMap[frameIndex] = 0;
+    Frame* frame = &frames[frameIndex];
+    lock.unlock();
+    frame->open();
+    return {frame, BackupStorage::freeFrame};
+}
+
+/**
+ * Returns the maximum number of bytes of metadata that can be stored
+ * which each append(). Also, how many bytes of getMetadata() are safe
+ * for access after getMetadata() calls, though returned data may or may
+ * not contain valid or meaningful (or even consistent with the
+ * replica) metadata.
+ */
+size_t
+PersistentMemoryStorage::getMetadataSize()
+{
+    return METADATA_SIZE;
+}
+
+/**
+ * Marks ALL storage frames as allocated, initializes frame state based on
+ * metadata if its metadata is valid, and blows away any in-memory copies of
+ * metadata. This should only be performed at backup startup. The caller is
+ * reponsible for freeing the frames if the metadata indicates the replica data
+ * stored there isn't useful.
+ *
+ * \return
+ *      Pointer to every frame which has various uses depending on the
+ *      metadata that is found in that frame. BackupService code is expected
+ *      to examine the metadata and either free the frame or take note of the
+ *      metadata in the frame for potential use in future recoveries.
+ */
+std::vector<BackupStorage::FrameRef>
+PersistentMemoryStorage::loadAllMetadata()
+{
+    std::vector<FrameRef> ret;
+    ret.reserve(frames.size());
+    foreach (Frame& frame, frames) {
+        frame.loadMetadata();
+        assert(freeMap[frame.frameIndex] == 1);
+        freeMap[frame.frameIndex] = 0;
+
+        const BackupReplicaMetadata* metadata =
+                static_cast<const BackupReplicaMetadata*>(frame.getMetadata());
+        if (metadata->checkIntegrity()) {
+            frame.isClosed = metadata->closed;
+            frame.isOpen = !metadata->closed;
+        }
+
+        ret.push_back({&frame, BackupStorage::freeFrame});
+    }
+    return ret;
+}
+
+/**
+ * Overwrite the stored superblock with new information that future
+ * backups reusing this storage will need (in the case of this backup's
+ * demise).
+ * This is done safely so that a failure in the middle of the update
+ * will leave either the old superblock or the new.
+ *
+ * \param serverId
+ *      The server id of the process as assigned by the coordinator.
+ *      It is persisted for the benefit of future processes reusing this
+ *      storage.
+ * \param clusterName
+ *      Controls the reuse of replicas stored on this backup.  'Tags'
+ *      replicas created on this backup with this cluster name.  This has
+ *      two effects.  First, any replicas found in storage are discarded
+ *      unless they are tagged with an identical cluster name. Second, any
+ *      replicas created by the backup process will only be reused by future
+ *      backup processes if the cluster name on the stored replica matches
+ *      the cluster name of future process. The name '__unnamed__' is
+ *      special and never matches any cluster name (even itself), so it
+ *      guarantees all stored replicas are discarded on start and that all
+ *      replicas created by this process are discarded by future backups.
+ *      This is convenient for testing.
+ * \param frameSkipMask
+ *      Used for testing. This storage keeps two superblock images and
+ *      overwrites the older first then the newer in the case a failure
+ *      occurs in the middle of writing. Setting frameSkipMask to 0x1
+ *      skips writing the first superblock image, 0x2 skips the second,
+ *      and 0x3 skips both.
+ */
+void
+PersistentMemoryStorage::resetSuperblock(ServerId serverId,
+                                         const string& clusterName,
+                                         const uint32_t frameSkipMask)
+{
+    Superblock newSuperblock =
+        Superblock(superblock.version + 1, serverId, clusterName.c_str());
+    Crc32C crc;
+    crc.update(&newSuperblock, sizeof(newSuperblock));
+    Crc32C::ResultType checksum = crc.getResult();
+
+    // Overwrite the two superblock images starting with the older one.
+    for (uint32_t i = 0; i < 2; ++i) {
+        const uint32_t nextFrame = (lastSuperblockFrame + 1) % 2;
+        if (!((frameSkipMask >> nextFrame) & 0x01)) {
+            SuperblockSlot* slot = superblockSlot(nextFrame);
+            slot->superblock = newSuperblock;
+            slot->checksum = checksum;
+            persist(slot, sizeof(*slot));
+            LOG(DEBUG, "Superblock frame %u written", nextFrame);
+        }
+        lastSuperblockFrame = nextFrame;
+    }
+
+    superblock = newSuperblock;
+}
+
+/**
+ * Read both stored superblock images and return the most up-to-date
+ * and complete superblock since the last resetSuperblock().
+ *
+ * \return
+ *      The most up-to-date complete superblock found on storage.  If no
+ *      superblock can be found a default superblock is returned which
+ *      indicates no prior backup instance left behind intelligible
+ *      traces of life on storage.
+ */
+BackupStorage::Superblock
+PersistentMemoryStorage::loadSuperblock()
+{
+    Tub<Superblock> left = tryLoadSuperblock(0);
+    Tub<Superblock> right = tryLoadSuperblock(1);
+
+    bool chooseLeft = false;
+    if (left && right) {
+        chooseLeft = left->version >= right->version;
+    } else if (!left && !right) {
+        LOG(WARNING,
+            "Backup couldn't find existing superblock; "
+            "starting as fresh backup.");
+        right.construct();
+        chooseLeft = false;
+    } else {
+        chooseLeft = left;
+    }
+
+    if (chooseLeft) {
+        superblock = *left;
+        lastSuperblockFrame = 0;
+    } else {
+        superblock = *right;
+        lastSuperblockFrame = 1;
+    }
+
+    LOG(DEBUG,
+        "Reloading backup superblock (version %lu, superblockFrame %u) "
+        "from previous run", superblock.version, lastSuperblockFrame);
+    LOG(DEBUG, "Prior backup had ServerId %s",
+        ServerId(superblock.serverId).toString().c_str());
+    LOG(DEBUG, "Prior backup had cluster name '%s'", superblock.clusterName);
+
+    return superblock;
+}
+
+/**
+ * No-op for PersistentMemoryStorage: append() doesn't return until the data
+ * it was given is durable.
+ */
+void
+PersistentMemoryStorage::quiesce()
+{
+}
+
+/**
+ * Scribble on all the metadata slots of all the storage frames to prevent
+ * what is already stored from being reused in future runs.
+ * Only safe immedately after this class is instantiated, before it is used
+ * to allocate or perform operations on frames.
+ * Called whenever the cluster name changes from what is stored in
+ * the superblock to prevent replicas already on storage from getting
+ * confused for ones written by the starting up backup process.
+ */
+void
+PersistentMemoryStorage::fry()
+{
+    foreach (Frame& frame, frames) {
+        for (uint32_t slot = 0; slot < 2; ++slot) {
+            MetadataSlot* stored = metadataSlot(frame.frameIndex, slot);
+            memset(stored, 0, sizeof(*stored));
+            persist(stored, sizeof(*stored));
+        }
+        frame.metadataVersion = 0;
+        frame.metadataSlot = 1;
+        memset(frame.metadata.get(), '\0', METADATA_SIZE);
+    }
+}
+
+// - private -
+
+/**
+ * Find the best instruction this CPU has for writing a cache line back to
+ * memory: CLWB leaves the line in the cache, CLFLUSHOPT evicts it but can
+ * run concurrently with other flushes, and CLFLUSH is always available.
+ */
+PersistentMemoryStorage::FlushInstruction
+PersistentMemoryStorage::chooseFlushInstruction()
+{
+    uint32_t eax, ebx, ecx, edx;
+    __asm__ __volatile__("cpuid"
+        : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+        : "a" (0U));
+    if (eax < 7)
+        return CLFLUSH;
+    __asm__ __volatile__("cpuid"
+        : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+        : "a" (7U), "c" (0U));
+    if (ebx & (1U << 24))
+        return CLWB;
+    if (ebx & (1U << 23))
+        return CLFLUSHOPT;
+    return CLFLUSH;
+}
+
+/**
+ * Returns true if the checksum of a stored metadata slot matches its
+ * contents (an all-zero slot, as left by fry(), never matches).
+ */
+bool
+PersistentMemoryStorage::checkMetadataSlot(const MetadataSlot* slot)
+{
+    if (slot->version == 0)
+        return false;
+    Crc32C crc;
+    crc.update(&slot->version, sizeof(slot->version));
+    crc.update(slot->metadata, sizeof(slot->metadata));
+    return slot->checksum == crc.getResult();
+}
+
+/**
+ * Returns the offset into the file where the region for a frame starts.
+ * Each region holds the replica data (padded out to a cache line) followed
+ * by the frame's two metadata slots, padded out to a page. The first region
+ * follows the two superblock images.
+ *
+ * \param frameIndex
+ *      Frame to find the region of; frameCount gives the size of the file.
+ */
+size_t
+PersistentMemoryStorage::offsetOfFrame(size_t frameIndex) const
+{
+    const size_t slotBytes =
+        (sizeof(MetadataSlot) + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+    const size_t dataBytes =
+        (segmentSize + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+    const size_t frameBytes =
+        (dataBytes + 2 * slotBytes + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+    return PAGE_SIZE + frameIndex * frameBytes;
+}
+
+/// Returns the start of the replica data for a frame in the mapping.
+char*
+PersistentMemoryStorage::frameData(size_t frameIndex) const
+{
+    return mapping + offsetOfFrame(frameIndex);
+}
+
+/**
+ * Returns one of the two metadata slots for a frame in the mapping.
+ *
+ * \param frameIndex
+ *      Frame whose metadata slot is wanted.
+ * \param slot
+ *      0 or 1.
+ */
+PersistentMemoryStorage::MetadataSlot*
+PersistentMemoryStorage::metadataSlot(size_t frameIndex, uint32_t slot) const
+{
+    const size_t slotBytes =
+        (sizeof(MetadataSlot) + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+    const size_t dataBytes =
+        (segmentSize + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+    return reinterpret_cast<MetadataSlot*>(
+            frameData(frameIndex) + dataBytes + slot * slotBytes);
+}
+
+/**
+ * Returns one of the two superblock images in the mapping; both fit in the
+ * first page of the file.
+ *
+ * \param superblockFrame
+ *      0 or 1.
+ */
+PersistentMemoryStorage::SuperblockSlot*
+PersistentMemoryStorage::superblockSlot(uint32_t superblockFrame) const
+{
+    static_assert(2 * sizeof(SuperblockSlot) <= PAGE_SIZE,
+                  "Superblock images don't fit in the first page");
+    const size_t slotBytes =
+        (sizeof(SuperblockSlot) + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+    return reinterpret_cast<SuperblockSlot*>(
+            mapping + superblockFrame * slotBytes);
+}
+
+/**
+ * Make stores to a range of the mapping durable. With MAP_SYNC this writes
+ * back the cache lines covering the range and fences, so that the stores
+ * have reached persistent memory when it returns; otherwise it msyncs the
+ * pages covering the range.
+ *
+ * \param start
+ *      First byte of the range.
+ * \param length
+ *      Bytes in the range.
+ */
+void
+PersistentMemoryStorage::persist(const void* start, size_t length)
+{
+    if (length == 0)
+        return;
+    uintptr_t begin = reinterpret_cast<uintptr_t>(start);
+    uintptr_t end = begin + length;
+
+    if (!mapSync) {
+        begin &= ~uintptr_t(PAGE_SIZE - 1);
+        if (msync(reinterpret_cast<void*>(begin), end - begin, MS_SYNC) == -1)
+            DIE("Failed to flush backup storage; cannot continue safely: %s",
+                strerror(errno));
+        return;
+    }
+
+    for (uintptr_t line = begin & ~uintptr_t(CACHE_LINE_SIZE - 1);
+         line < end; line += CACHE_LINE_SIZE) {
+        volatile char* p = reinterpret_cast<volatile char*>(line);
+        // CLWB and CLFLUSHOPT are spelled as prefixed XSAVEOPT and CLFLUSH
+        // so that assemblers that don't know them still work.
+        switch (flushInstruction) {
+        case CLWB:
+            __asm__ __volatile__(".byte 0x66; xsaveopt %0" : "+m" (*p));
+            break;
+        case CLFLUSHOPT:
+            __asm__ __volatile__(".byte 0x66; clflush %0" : "+m" (*p));
+            break;
+        case CLFLUSH:
+            __asm__ __volatile__("clflush %0" : "+m" (*p));
+            break;
+        }
+    }
+    Fence::sfence();
+}
+
+/**
+ * Extend the file to hold all of the frames if it is a regular file that is
+ * too short, allocating the space so that later stores to the mapping can't
+ * fail for lack of it. Devices are assumed to be large enough.
+ *
+ * \throw BackupStorageException
+ *      If space for frameCount segments of segmentSize cannot be reserved.
+ */
+void
+PersistentMemoryStorage::reserveSpace(const char* filePath)
+{
+    struct stat st;
+    if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode))
+        return;
+    if (downCast<size_t>(st.st_size) >= mappingBytes)
+        return;
+
+    LOG(DEBUG, "Reserving %lu bytes of log space", mappingBytes);
+    int r = posix_fallocate(fd, 0, mappingBytes);
+    if (r != 0) {
+        throw BackupStorageException(HERE,
+                format("Couldn't reserve storage space for backup in %s",
+                       filePath), r);
+    }
+}
+
+/**
+ * Try to read one of the stored superblock images.
+ *
+ * \param superblockFrame
+ *      Which of the two superblock images to read.
+ * \return
+ *      The superblock stored at \a superblockFrame if its stored checksum
+ *      was correct; otherwise the returned value is empty.
+ */
+Tub<BackupStorage::Superblock>
+PersistentMemoryStorage::tryLoadSuperblock(uint32_t superblockFrame)
+{
+    SuperblockSlot slot = *superblockSlot(superblockFrame);
+    Superblock& superblock = slot.superblock;
+
+    Crc32C crc;
+    crc.update(&superblock, sizeof(superblock));
+    uint32_t checksum = crc.getResult();
+
+    // Check stored checksum against the computed checksum for stored data.
+    if (slot.checksum != checksum) {
+        LOG(NOTICE, "Stored superblock had a bad checksum: "
+            "stored checksum was %x, but stored data had checksum %x",
+            slot.checksum, checksum);
+        return {};
+    }
+    char& endOfName =
+        superblock.clusterName[sizeof(superblock.clusterName) - 1];
+    if (endOfName != '\0')
+        DIE("Stored superblock's cluster name should end in \\0; "
+            "this should never happen unless there is a software bug");
+
+    return { superblock };
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,278 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_PERSISTENTMEMORYSTORAGE_H
+#define RAMCLOUD_PERSISTENTMEMORYSTORAGE_H
+
+#include <deque>
+
+#include "Common.h"
+#include "BackupStorage.h"
+#include "Crc32C.h"
+#include "MultiFileStorage.h"
+
+namespace RAMCloud {
+
+/**
+ * A BackupStorage backend which keeps replicas in a file that is mapped into
+ * memory, meant for a file on a DAX filesystem (or a DAX device) backed by
+ * byte-addressable persistent memory such as NVDIMMs. Appends copy data
+ * straight into the mapping and make it durable with cache line flushes and
+ * a fence before returning, so there are no write system calls, no staging
+ * buffers, and no IO thread; recovery reads replicas in place.
+ *
+ * If the file can't be mapped with MAP_SYNC (it isn't on a DAX filesystem;
+ * tmpfs, for example) the mapping goes through the page cache and appends
+ * are made durable with msync() instead. This works on any file, which is
+ * what the unit tests rely on, but gives none of the latency benefits.
+ *
+ * The file holds two superblock images followed by one region for each
+ * frame. Each frame region holds the replica data and two metadata slots
+ * which are written alternately, so that a crash part way through a metadata
+ * update (persistent memory only guarantees 8-byte atomic writes) leaves the
+ * previous metadata intact.
+ */
+class PersistentMemoryStorage : public BackupStorage {
+  public:
+    /**
+     * Represents the region of the mapped file which holds a single replica.
+     * PersistentMemoryStorage keeps exactly one frame for each such region.
+     * Frames get reused for different replicas making a frame something of a
+     * state machine.
+     *
+     * Backups open() frames, append() data, and then close() them. When the
+     * replica is no longer needed free() releases the frame for reuse by
+     * another replica, for which, the same cycle will be repeated.
+     * See PersistentMemoryStorage::open() to allocate and open a Frame.
+     */
+    class Frame : public BackupStorage::Frame {
+      PUBLIC:
+        typedef std::unique_lock<std::mutex> Lock;
+
+        Frame(PersistentMemoryStorage* storage, size_t frameIndex);
+
+        bool wasAppendedToByCurrentProcess();
+
+        void loadMetadata();
+        const void* getMetadata();
+
+        void startLoading();
+        bool isLoaded();
+        bool currentlyOpen() { return isOpen; }
+        void* load();
+        void unload();
+
+        void append(Buffer& source,
+                    size_t sourceOffset,
+                    size_t length,
+                    size_t destinationOffset,
+                    const void* metadata,
+                    size_t metadataLength);
+        void close();
+        void reopen(size_t length);
+        void free();
+
+      PRIVATE:
+        void open();
+        void writeMetadata(const void* metadata, size_t metadataLength);
+
+        /// Storage where this frame resides.
+        PersistentMemoryStorage* storage;
+
+        /// Index of the frame in #storage.frames and in the mapped file.
+        const size_t frameIndex;
+
+        /**
+         * Held while data and metadata are being copied into and flushed
+         * from the mapping, which is done without holding the storage mutex
+         * so that appends to different frames proceed in parallel. Lock
+         * after the storage mutex if both are needed.
+         */
+        std::mutex appendMutex;
+
+        /**
+         * Tracks whether a replica has been opened (either initially or
+         * since the time of the last free). False if #isClosed.
+         */
+        bool isOpen;
+
+        /**
+         * Tracks whether a replica has been closed (either initially or
+         * since the time of the last free). False if #isOpen.
+         */
+        bool isClosed;
+
+        /**
+         * Tracks whether append has been called on this frame during the
+         * life of this process. This includes across free()/open() cycles.
+         * This is used by the backup replica garbage collector to determine
+         * whether it might have missed a BackupFree rpc from a master, in
+         * which case it has to query the master for the replica status.
+         * This is "appended to" rather than "opened by" because of benchmark();
+         * benchmark "opens" replicas and loads them but doesn't do any.
+         * Masters open and append data in a single rpc, so this is a fine
+         * proxy.
+         */
+        bool appendedToByCurrentProcess;
+
+        /**
+         * True if the replica data has been requested. Used to reject
+         * appends after load requests and by isLoaded().
+         */
+        bool loadRequested;
+
+        /**
+         * Metadata given on the most recent call to append. Starts zeroed
+         * on construction. Reset to the metadata stored in the mapped file
+         * if loadMetadata() is called (only safe before doing any other
+         * operations).
+         */
+        std::unique_ptr<char[]> metadata;
+
+        /**
+         * Version stored in the newest metadata slot for this frame in the
+         * mapped file; the next metadata written gets a higher one.
+         */
+        uint64_t metadataVersion;
+
+        /// Which of the two metadata slots holds #metadataVersion.
+        uint32_t metadataSlot;
+
+        // ONLY for open() and the fields used by loadAllMetadata(); please
+        // try not to touch other details of frames in
+        // PersistentMemoryStorage (or elsewhere).
+        friend class PersistentMemoryStorage;
+        DISALLOW_COPY_AND_ASSIGN(Frame);
+    };
+
+    PersistentMemoryStorage(size_t segmentSize,
+                            size_t frameCount,
+                            size_t writeRateLimit,
+                            const char* filePath);
+    ~PersistentMemoryStorage();
+
+    FrameRef open(bool sync, ServerId masterId, uint64_t segmentId);
+    size_t getMetadataSize();
+    std::vector<FrameRef> loadAllMetadata();
+    void resetSuperblock(ServerId serverId,
+                         const string& clusterName,
+                         uint32_t frameSkipMask = 0);
+    Superblock loadSuperblock();
+    void quiesce();
+    void fry();
+
+  PRIVATE:
+    /// Maximum size of metadata for each frame.
+    enum { METADATA_SIZE = MultiFileStorage::METADATA_SIZE };
+
+    /// Alignment of frame regions in the mapped file.
+    enum { PAGE_SIZE = 4096 };
+
+    /**
+     * Format of each of the two metadata slots of a frame in the mapped file.
+     */
+    struct MetadataSlot {
+        /// Larger in the more recently written slot.
+        uint64_t version;
+
+        /// Covers #version and #metadata; detects torn slots.
+        Crc32C::ResultType checksum;
+
+        /// Metadata given to Frame::append().
+        char metadata[METADATA_SIZE];
+    } __attribute__((packed));
+
+    /**
+     * Format of each of the two superblock images in the mapped file.
+     */
+    struct SuperblockSlot {
+        Superblock superblock;
+
+        /// Covers #superblock; detects torn images.
+        Crc32C::ResultType checksum;
+    } __attribute__((packed));
+
+    /// Instruction used to write cache lines back to persistent memory.
+    enum FlushInstruction { CLFLUSH, CLFLUSHOPT, CLWB };
+
+    static FlushInstruction chooseFlushInstruction();
+    static bool checkMetadataSlot(const MetadataSlot* slot);
+
+    size_t offsetOfFrame(size_t frameIndex) const;
+    char* frameData(size_t frameIndex) const;
+    MetadataSlot* metadataSlot(size_t frameIndex, uint32_t slot) const;
+    SuperblockSlot* superblockSlot(uint32_t superblockFrame) const;
+    void persist(const void* start, size_t length);
+    void reserveSpace(const char* filePath);
+    Tub<Superblock> tryLoadSuperblock(uint32_t superblockFrame);
+
+    /// Protects concurrent operations on storage and all of its frames.
+    std::mutex mutex;
+    typedef std::unique_lock<std::mutex> Lock;
+
+    /// Holds the most recent image of the superblock.
+    Superblock superblock;
+
+    /// Tracks which of the superblock frames was most recently written.
+    uint32_t lastSuperblockFrame;
+
+    /**
+     * Frame for each region of the mapped file which can hold a replica.
+     * Frames get reused for different replicas making a frame something of
+     * a state machine, but are all created and destroyed along with the
+     * storage instance.
+     */
+    std::deque<Frame> frames;
+
+    /// The number of replicas this storage can store simultaneously.
+    const size_t frameCount;
+
+    /// Type of the freeMap.  A bitmap.
+    typedef boost::dynamic_bitset<> FreeMap;
+    /// Keeps a bit set for each frame in frames indicating if it is free.
+    FreeMap freeMap;
+
+    /**
+     * Track the last used segment frame so they can be used in FIFO.
+     * This gives recovery dump tools a much better chance at recovering
+     * data since old data is destroyed from storage first rather than new.
+     */
+    FreeMap::size_type lastAllocatedFrame;
+
+    /// Descriptor of the mapped file.
+    int fd;
+
+    /// Bytes of the file that are mapped; enough for all of the frames.
+    size_t mappingBytes;
+
+    /// Start of the mapping of the file.
+    char* mapping;
+
+    /**
+     * True if the file was mapped with MAP_SYNC, in which case flushing
+     * cache lines makes stores durable. Otherwise the mapping goes through
+     * the page cache and persist() has to msync() instead.
+     */
+    bool mapSync;
+
+    /// The best cache line flush instruction this CPU supports.
+    FlushInstruction flushInstruction;
+
+    DISALLOW_COPY_AND_ASSIGN(PersistentMemoryStorage);
+};
+
+} // namespace RAMCloud
+
+#endif
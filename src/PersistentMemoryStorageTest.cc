@@ -0,0 +1,424 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "BackupMasterRecovery.h"
+#include "PersistentMemoryStorage.h"
+#include "StringUtil.h"
+
+namespace RAMCloud {
+
+class PersistentMemoryStorageTest : public ::testing::Test {
+  public:
+    typedef char* bytes;
+    typedef PersistentMemoryStorage::Frame Frame;
+
+    const char* test;
+    uint32_t testLength;
+    Buffer testSource;
+    uint32_t segmentFrames;
+    uint32_t segmentSize;
+    const char* filePath;
+    Tub<PersistentMemoryStorage> storage;
+
+    PersistentMemoryStorageTest()
+        : test("test")
+        , testLength(downCast<uint32_t>(strlen(test)))
+        , testSource()
+        , segmentFrames(4)
+        , segmentSize(1000)
+        // tmpfs, if it's there, is closest to what this storage is for.
+        , filePath(access("/dev/shm", W_OK) == 0
+                ? "/dev/shm/ramcloud-pmem-storage-test-delete-this"
+                : "/tmp/ramcloud-pmem-storage-test-delete-this")
+        , storage()
+    {
+        Logger::get().setLogLevels(SILENT_LOG_LEVEL);
+        testSource.appendExternal(test, testLength + 1);
+        unlink(filePath);
+        storage.construct(segmentSize, segmentFrames, 0, filePath);
+    }
+
+    ~PersistentMemoryStorageTest()
+    {
+        storage.destroy();
+        unlink(filePath);
+    }
+
+    /// Simulate a restart of the backup by mapping the file afresh.
+    void
+    restart()
+    {
+        storage.destroy();
+        storage.construct(segmentSize, segmentFrames, 0, filePath);
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(PersistentMemoryStorageTest);
+};
+
+TEST_F(PersistentMemoryStorageTest, Frame_constructor) {
+    BackupStorage::FrameRef frameRef = storage->open(true, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 0, 0, test, testLength + 1);
+    frame->append(testSource, 0, 0, 0, test, testLength + 1);
+    frame->append(testSource, 0, 0, 0, test, testLength + 1);
+    EXPECT_EQ(3u, frame->metadataVersion);
+    EXPECT_EQ(0u, frame->metadataSlot);
+    restart();
+    EXPECT_EQ(3u, storage->frames[0].metadataVersion);
+    EXPECT_EQ(0u, storage->frames[0].metadataSlot);
+    EXPECT_EQ(0u, storage->frames[1].metadataVersion);
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_loadMetadata) {
+    BackupStorage::FrameRef frameRef = storage->open(true, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 0, 0, test, testLength + 1);
+    frame->free();
+    frame->loadMetadata();
+    char* metadata = bytes(const_cast<void*>(frame->getMetadata()));
+    EXPECT_STREQ(test, metadata);
+
+    restart();
+    storage->frames[0].loadMetadata();
+    metadata = bytes(const_cast<void*>(storage->frames[0].getMetadata()));
+    EXPECT_STREQ(test, metadata);
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_loadMetadataTornSlot) {
+    BackupStorage::FrameRef frameRef = storage->open(true, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 0, 0, "old", 4);
+    frame->append(testSource, 0, 0, 0, "new", 4);
+    // Damage the newer slot, as if the backup crashed while writing it.
+    storage->metadataSlot(0, frame->metadataSlot)->metadata[0] = 'x';
+    restart();
+    storage->frames[0].loadMetadata();
+    EXPECT_STREQ("old", bytes(const_cast<void*>(
+                                storage->frames[0].getMetadata())));
+    EXPECT_EQ(1u, storage->frames[0].metadataVersion);
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_loadMetadataNoneStored) {
+    storage->frames[0].loadMetadata();
+    const char* metadata = static_cast<const char*>(
+            storage->frames[0].getMetadata());
+    EXPECT_EQ(0, metadata[0]);
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_load) {
+    BackupStorage::FrameRef frameRef = storage->open(true, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, testSource.size(),
+                  0, test, testLength + 1);
+    frame->close();
+    EXPECT_FALSE(frame->isLoaded());
+    char* replica = bytes(frame->load());
+    EXPECT_TRUE(frame->loadRequested);
+    EXPECT_TRUE(frame->isLoaded());
+    EXPECT_EQ(storage->frameData(0), replica);
+    EXPECT_STREQ(test, replica);
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_isLoaded_appendInProgress) {
+    BackupStorage::FrameRef frameRef = storage->open(true, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->startLoading();
+    EXPECT_TRUE(frame->isLoaded());
+    frame->appendMutex.lock();
+    EXPECT_FALSE(frame->isLoaded());
+    frame->appendMutex.unlock();
+    EXPECT_TRUE(frame->isLoaded());
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_appendNotOpen) {
+    BackupStorage::FrameRef frameRef = storage->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 0, 0, NULL, 0);
+    frame->close();
+    EXPECT_THROW(frame->append(testSource, 0, 0, 0, NULL, 0),
+                 BackupBadSegmentIdException);
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_appendLoading) {
+    BackupStorage::FrameRef frameRef = storage->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 0, 0, NULL, 0);
+    frame->load();
+    EXPECT_THROW(frame->append(testSource, 0, 0, 0, NULL, 0),
+                 BackupBadSegmentIdException);
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_appendOutOfBounds) {
+    BackupStorage::FrameRef frameRef = storage->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 1, segmentSize - 1, NULL, 0);
+    EXPECT_THROW(frame->append(testSource, 0, 1, segmentSize, NULL, 0),
+                 BackupSegmentOverflowException);
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_appendMetadataTooBig) {
+    BackupStorage::FrameRef frameRef = storage->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    char metadata[PersistentMemoryStorage::METADATA_SIZE + 1] = {};
+    frame->append(testSource, 0, 0, 0, metadata,
+                  PersistentMemoryStorage::METADATA_SIZE);
+    EXPECT_THROW(frame->append(testSource, 0, 0, 0, metadata,
+                               PersistentMemoryStorage::METADATA_SIZE + 1),
+                 BackupSegmentOverflowException);
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_appendSurvivesRestart) {
+    BackupStorage::FrameRef frameRef = storage->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    Buffer source;
+    source.appendExternal("0123456789", 10);
+    frame->append(source, 6, 4, 6, test, testLength + 1);
+    frame->append(source, 0, 6, 0, test, testLength + 1);
+    EXPECT_TRUE(frame->wasAppendedToByCurrentProcess());
+    frameRef.reset();
+
+    restart();
+    // Read the file rather than the mapping.
+    char data[10];
+    int fd = open(filePath, O_RDONLY);
+    ASSERT_NE(-1, fd);
+    EXPECT_EQ(10, pread(fd, data, sizeof(data), storage->offsetOfFrame(0)));
+    close(fd);
+    EXPECT_EQ("0123456789", string(data, 10));
+    EXPECT_FALSE(storage->frames[0].wasAppendedToByCurrentProcess());
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_writeMetadata) {
+    BackupStorage::FrameRef frameRef = storage->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 0, 0, "abc", 4);
+    EXPECT_EQ(1u, frame->metadataVersion);
+    EXPECT_EQ(0u, frame->metadataSlot);
+    frame->append(testSource, 0, 0, 0, "de", 3);
+    EXPECT_EQ(2u, frame->metadataVersion);
+    EXPECT_EQ(1u, frame->metadataSlot);
+
+    auto* older = storage->metadataSlot(0, 0);
+    auto* newer = storage->metadataSlot(0, 1);
+    EXPECT_EQ(1u, older->version);
+    EXPECT_STREQ("abc", older->metadata);
+    EXPECT_TRUE(PersistentMemoryStorage::checkMetadataSlot(older));
+    EXPECT_EQ(2u, newer->version);
+    EXPECT_STREQ("de", newer->metadata);
+    EXPECT_EQ(0, newer->metadata[3]);
+    EXPECT_TRUE(PersistentMemoryStorage::checkMetadataSlot(newer));
+    EXPECT_STREQ("de", static_cast<const char*>(frame->getMetadata()));
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_close) {
+    BackupStorage::FrameRef frameRef = storage->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->close();
+    EXPECT_FALSE(frame->isOpen);
+    EXPECT_TRUE(frame->isClosed);
+    frame->close();
+    frame->load();
+    frame->isClosed = false;
+    EXPECT_THROW(frame->close(), BackupBadSegmentIdException);
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_free) {
+    BackupStorage::FrameRef frameRef = storage->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 0, 0, test, testLength + 1);
+    EXPECT_FALSE(storage->freeMap[0]);
+    frameRef.reset();
+    EXPECT_TRUE(storage->freeMap[0]);
+    EXPECT_FALSE(frame->isOpen);
+    EXPECT_FALSE(frame->isClosed);
+    EXPECT_EQ(0, static_cast<const char*>(frame->getMetadata())[0]);
+    // Storage itself is untouched.
+    EXPECT_STREQ(test, storage->metadataSlot(0, frame->metadataSlot)->metadata);
+}
+
+TEST_F(PersistentMemoryStorageTest, Frame_reopen) {
+    BackupStorage::FrameRef frameRef = storage->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, testSource.size(), 0, NULL, 0);
+    frame->close();
+    frame->load();
+    frame->reopen(testSource.size());
+    EXPECT_TRUE(frame->isOpen);
+    EXPECT_FALSE(frame->isClosed);
+    EXPECT_FALSE(frame->loadRequested);
+    frame->append(testSource, 0, testSource.size(), testSource.size(),
+                  NULL, 0);
+    EXPECT_STREQ(test, storage->frameData(0) + testSource.size());
+}
+
+TEST_F(PersistentMemoryStorageTest, constructor) {
+    EXPECT_EQ(BackupStorage::Type::PERSISTENT_MEMORY, storage->storageType);
+    EXPECT_EQ(4u, storage->frames.size());
+    struct stat st;
+    ASSERT_EQ(0, stat(filePath, &st));
+    EXPECT_EQ(storage->offsetOfFrame(segmentFrames),
+              downCast<size_t>(st.st_size));
+}
+
+TEST_F(PersistentMemoryStorageTest, constructorOpenFails) {
+    storage.destroy();
+    EXPECT_THROW(PersistentMemoryStorage(segmentSize, segmentFrames, 0,
+                                         "/nonexistent/file"),
+                 BackupStorageException);
+}
+
+TEST_F(PersistentMemoryStorageTest, open) {
+    BackupStorage::FrameRef frameRef = storage->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    EXPECT_EQ(&storage->frames[0], frame);
+    EXPECT_TRUE(frame->isOpen);
+    EXPECT_FALSE(storage->freeMap[0]);
+}
+
+TEST_F(PersistentMemoryStorageTest, open_ensureFifoUse) {
+    BackupStorage::FrameRef frame = storage->open(false, ServerId(), 0);
+    EXPECT_EQ(&storage->frames[0], frame.get());
+    frame.reset();
+    frame = storage->open(false, ServerId(), 0);
+    EXPECT_EQ(&storage->frames[1], frame.get());
+}
+
+TEST_F(PersistentMemoryStorageTest, open_noFreeFrames) {
+    std::vector<BackupStorage::FrameRef> frames;
+    for (uint32_t i = 0; i < segmentFrames; ++i)
+        frames.push_back(storage->open(false, ServerId(), 0));
+    EXPECT_THROW(storage->open(false, ServerId(), 0),
+                 BackupOpenRejectedException);
+}
+
+TEST_F(PersistentMemoryStorageTest, loadAllMetadata) {
+    SegmentCertificate certificate;
+    Buffer empty;
+    {
+        BackupReplicaMetadata open(certificate, 99, 87, segmentSize, 0,
+                                   false, false);
+        BackupReplicaMetadata closed(certificate, 99, 88, segmentSize, 0,
+                                     true, false);
+        BackupStorage::FrameRef frame0 = storage->open(true, ServerId(), 0);
+        frame0->append(empty, 0, 0, 0, &open, sizeof(open));
+        BackupStorage::FrameRef frame1 = storage->open(true, ServerId(), 0);
+        frame1->append(empty, 0, 0, 0, &closed, sizeof(closed));
+    }
+
+    restart();
+    auto frames = storage->loadAllMetadata();
+    EXPECT_EQ(segmentFrames, frames.size());
+    EXPECT_FALSE(storage->freeMap.any());
+    EXPECT_TRUE(storage->frames[0].isOpen);
+    EXPECT_FALSE(storage->frames[0].isClosed);
+    EXPECT_FALSE(storage->frames[1].isOpen);
+    EXPECT_TRUE(storage->frames[1].isClosed);
+    EXPECT_FALSE(storage->frames[2].isOpen);
+    EXPECT_FALSE(storage->frames[2].isClosed);
+    auto* metadata = static_cast<const BackupReplicaMetadata*>(
+            frames[1]->getMetadata());
+    EXPECT_EQ(88u, metadata->segmentId);
+}
+
+TEST_F(PersistentMemoryStorageTest, resetSuperblock) {
+    for (uint32_t expectedVersion = 1; expectedVersion < 3; ++expectedVersion) {
+        storage->resetSuperblock({9999, expectedVersion}, "hasso");
+        for (uint32_t frame = 0; frame < 2; ++frame) {
+            auto superblock = storage->tryLoadSuperblock(frame);
+            ASSERT_TRUE(superblock);
+            EXPECT_EQ(ServerId(9999, expectedVersion),
+                      superblock->getServerId());
+            EXPECT_STREQ("hasso", superblock->getClusterName());
+            EXPECT_EQ(expectedVersion, superblock->version);
+            EXPECT_EQ(expectedVersion, storage->superblock.version);
+            EXPECT_EQ(1u, storage->lastSuperblockFrame);
+        }
+    }
+}
+
+TEST_F(PersistentMemoryStorageTest, loadSuperblockAfterRestart) {
+    storage->resetSuperblock({9998, 1}, "gruuuu");
+    restart();
+    auto superblock = storage->loadSuperblock();
+    EXPECT_EQ(ServerId(9998, 1), superblock.getServerId());
+    EXPECT_STREQ("gruuuu", superblock.getClusterName());
+    EXPECT_EQ(1u, superblock.version);
+    EXPECT_EQ(0u, storage->lastSuperblockFrame);
+}
+
+TEST_F(PersistentMemoryStorageTest, loadSuperblockRightGreater) {
+    // "0x2" means skip writing superblock frame 1.
+    storage->resetSuperblock({9996, 2}, "fruuuu", 0x2);
+    // "0x1" means skip writing superblock frame 0.
+    storage->resetSuperblock({9996, 1}, "gruuuu", 0x1);
+    auto superblock = storage->loadSuperblock();
+    EXPECT_EQ(ServerId(9996, 1), superblock.getServerId());
+    EXPECT_STREQ("gruuuu", superblock.getClusterName());
+    EXPECT_EQ(2u, superblock.version);
+    EXPECT_EQ(1u, storage->lastSuperblockFrame);
+}
+
+namespace {
+bool loadSuperblockFilter(string s) { return s == "loadSuperblock"; }
+}
+
+TEST_F(PersistentMemoryStorageTest, loadSuperblockNoneFound) {
+    TestLog::Enable _(loadSuperblockFilter);
+    auto superblock = storage->loadSuperblock();
+    EXPECT_TRUE(StringUtil::startsWith(TestLog::get(),
+                "loadSuperblock: Backup couldn't find existing superblock;"));
+    EXPECT_EQ(ServerId(), superblock.getServerId());
+    EXPECT_STREQ("__unnamed__", superblock.getClusterName());
+    EXPECT_EQ(0u, superblock.version);
+}
+
+TEST_F(PersistentMemoryStorageTest, tryLoadSuperblockBadChecksum) {
+    storage->resetSuperblock({9994, 1}, "fhqwhgads");
+    storage->superblockSlot(0)->superblock.clusterName[0] = ' ';
+    TestLog::Enable _;
+    EXPECT_FALSE(storage->tryLoadSuperblock(0));
+    EXPECT_TRUE(StringUtil::startsWith(TestLog::get(),
+                "tryLoadSuperblock: Stored superblock had a bad checksum"));
+    EXPECT_TRUE(storage->tryLoadSuperblock(1));
+}
+
+TEST_F(PersistentMemoryStorageTest, fry) {
+    BackupStorage::FrameRef frameRef = storage->open(true, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(testSource, 0, 0, 0, test, testLength + 1);
+    frameRef.reset();
+    storage->fry();
+    EXPECT_EQ(0u, frame->metadataVersion);
+    restart();
+    storage->frames[0].loadMetadata();
+    EXPECT_EQ(0u, storage->frames[0].metadataVersion);
+    EXPECT_EQ(0, static_cast<const char*>(
+                    storage->frames[0].getMetadata())[0]);
+}
+
+TEST_F(PersistentMemoryStorageTest, persist_mapSync) {
+    // There's usually no persistent memory to test against, but the cache
+    // line flushes work on any mapping.
+    storage->mapSync = true;
+    BackupStorage::FrameRef frameRef = storage->open(true, ServerId(), 0);
+    frameRef->append(testSource, 0, testSource.size(), 63, test,
+                     testLength + 1);
+    EXPECT_STREQ(test, storage->frameData(0) + 63);
+    storage->flushInstruction = PersistentMemoryStorage::CLFLUSH;
+    storage->persist(storage->frameData(0), segmentSize);
+}
+
+} // namespace RAMCloud
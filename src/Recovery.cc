@@ -105,7 +105,9 @@ Recovery::~Recovery()
  * Splits tablets to ensure all tablets are less than the byte and record count
  * limits for a partition.  This will be called on the tablets to be recovered
  * before they are partitioned.  If a tablet is split, the resulting tablets
- * will be (best effort) the same "size" in both byte and record count.
+ * will be (best effort) the same "size" in both byte and record count: if the
+ * estimator has a histogram for the tablet's table the split points follow
+ * the histogram, otherwise the tablet is split into equal key hash ranges.
  *
  * \param tablets
  *      Pointer to vector of tablets to be split.  Modified to reflect any
@@ -164,7 +166,37 @@ Recovery::splitTablets(vector<Tablet> *tablets,
         // Recompute tabletCount in case it changed.
         tabletCount = splits + 1;
 
-        if (tabletCount > 1) {
+        if (tabletCount > 1 && estimator->hasHistogram(tablet->tableId)) {
+            // Cut the tablet wherever the next piece reaches an even share of
+            // what is left, so that skewed tables still yield even pieces.
+            Tablet remainder = *tablet;
+            for (uint64_t piecesLeft = tabletCount; piecesLeft > 1;
+                    piecesLeft--) {
+                TableStats::Estimator::Estimate left =
+                        estimator->estimate(&remainder);
+                TableStats::Estimator::Estimate share =
+                        {left.byteCount / piecesLeft,
+                         left.recordCount / piecesLeft};
+                if (share.byteCount == 0 && share.recordCount == 0)
+                    break;
+                uint64_t splitKeyHash =
+                        estimator->findSplitKeyHash(&remainder, share);
+                if (splitKeyHash >= remainder.endKeyHash)
+                    break;
+                if (remainder.startKeyHash == startKeyHash) {
+                    tablets->at(i).endKeyHash = splitKeyHash;
+                } else {
+                    Tablet temp = remainder;
+                    temp.endKeyHash = splitKeyHash;
+                    tablets->push_back(temp);
+                }
+                remainder.startKeyHash = splitKeyHash + 1;
+                tableManager->splitRecoveringTablet(remainder.tableId,
+                                                    remainder.startKeyHash);
+            }
+            if (remainder.startKeyHash != startKeyHash)
+                tablets->push_back(remainder);
+        } else if (tabletCount > 1) {
             // Since the full key range is not always a multiple of the number
             // of desired tablets, some tablets may be 1 key range larger than
             // others.  We determine the number of "big" tablets needed by
@@ -283,12 +315,41 @@ struct Partition {
         recordCount += estimate.recordCount;
     }
 };
+
+/**
+ * A tablet along with its estimated size. Used by partitionTablets to place
+ * tablets largest first.
+ */
+struct SizedTablet {
+    Tablet* tablet;                             //< The tablet.
+    TableStats::Estimator::Estimate estimate;   //< Its estimated size.
+    double usage;   //< Fraction of a partition it fills; see Partition::usage.
+
+    SizedTablet(Tablet* tablet, TableStats::Estimator::Estimate estimate)
+        : tablet(tablet)
+        , estimate(estimate)
+        , usage()
+    {
+        Partition partition(0);
+        partition.add(estimate);
+        usage = partition.usage();
+    }
+
+    /**
+     * Orders tablets from largest to smallest.
+     */
+    bool operator<(const SizedTablet& other) const {
+        return usage > other.usage;
+    }
+};
 }
 
 /**
  * Divides the tablets belonging to a master into partitions, where the number
  * of bytes and number of records in each partition is limited (to ensure fast
- * crash recovery) and there are as few partitions as possible.
+ * crash recovery) and there are as few partitions as possible. Partitions are
+ * kept as evenly loaded as possible, since the slowest recovery master
+ * determines how long recovery takes.
  *
  * Partitions are set by serializing the tablet entry into dataToRecover and
  * setting partitionId in the entry's "user_data".
@@ -324,46 +385,56 @@ Recovery::partitionTablets(vector<Tablet> tablets,
 
     splitTablets(&tablets, estimator);
 
-    // An "open" partition has been partially assigned to but is not full.
-    std::vector<Partition> openPartitions;
+    // Start with as many partitions as the total size of the tablets
+    // requires, then place the biggest tablets first, each into the least
+    // loaded partition it fits in. Only open another partition when a tablet
+    // fits in none of them.
+    std::vector<SizedTablet> sizedTablets;
+    uint64_t totalBytes = 0;
+    uint64_t totalRecords = 0;
     foreach (Tablet& tablet, tablets) {
-        bool done = false;
-        size_t numOpenPartitions = openPartitions.size();
-        // From a few ramdomly selected open partitions, assign the tablet to
-        // the first open partition that fits.  If none of these partitions fit,
-        // create a new partition.
-        for (size_t i = 0; i < std::min(numOpenPartitions, 5lu); i++) {
-            size_t j = generateRandom() % numOpenPartitions;
-            Partition& partition = openPartitions[j];
-            if (partition.fits(estimator->estimate(&tablet))) {
-                partition.add(estimator->estimate(&tablet));
-                ProtoBuf::Tablets::Tablet& entry =
-                                            *dataToRecover.add_tablet();
-                tablet.serialize(entry);
-                entry.set_user_data(partition.partitionId);
-                // If the partition is mostly full, remove the partition
-                if (partition.usage() > 0.9) {
-                    partition = openPartitions.back();
-                    openPartitions.pop_back();
+        sizedTablets.emplace_back(&tablet, estimator->estimate(&tablet));
+        totalBytes += sizedTablets.back().estimate.byteCount;
+        totalRecords += sizedTablets.back().estimate.recordCount;
+    }
+    std::stable_sort(sizedTablets.begin(), sizedTablets.end());
+
+    uint64_t minPartitions = std::max(
+        (totalBytes + Recovery::PARTITION_MAX_BYTES - 1)
+            / Recovery::PARTITION_MAX_BYTES,
+        (totalRecords + Recovery::PARTITION_MAX_RECORDS - 1)
+            / Recovery::PARTITION_MAX_RECORDS);
+    minPartitions = std::min(minPartitions, uint64_t(tablets.size()));
+    std::vector<Partition> partitions;
+    for (uint64_t i = 0; i < minPartitions; i++)
+        partitions.emplace_back(numPartitions++);
+
+    foreach (SizedTablet& sizedTablet, sizedTablets) {
+        Partition* best = NULL;
+        foreach (Partition& partition, partitions) {
+            if (!partition.fits(sizedTablet.estimate))
+                continue;
+            if (best == NULL || partition.usage() < best->usage())
+                best = &partition;
+        }
+        if (best == NULL) {
+            // Too big for any partition. Give it an empty one if there is
+            // one left (it is over the limit either way), else a new one.
+            foreach (Partition& partition, partitions) {
+                if (partition.byteCount == 0 && partition.recordCount == 0) {
+                    best = &partition;
+                    break;
                 }
-                done = true;
-                break;
             }
         }
-        if (!done) {
-            // This tablet did not fit in any of the open partitions we tried,
-            // so make a new partition.
-            Partition partition(numPartitions++);
-            partition.add(estimator->estimate(&tablet));
-            ProtoBuf::Tablets::Tablet& entry = *dataToRecover.add_tablet();
-            tablet.serialize(entry);
-            entry.set_user_data(partition.partitionId);
-            // If the partition still has room for more tablets, add it to the
-            // available set of partitions.
-            if (partition.usage() <= 0.9) {
-                openPartitions.push_back(partition);
-            }
+        if (best == NULL) {
+            partitions.emplace_back(numPartitions++);
+            best = &partitions.back();
         }
+        best->add(sizedTablet.estimate);
+        ProtoBuf::Tablets::Tablet& entry = *dataToRecover.add_tablet();
+        sizedTablet.tablet->serialize(entry);
+        entry.set_user_data(best->partitionId);
     }
 }
 
@@ -637,7 +708,8 @@ BackupStartPartitionTask::wait()
  *
  * \return
  *      True if at least one replica is available on some backup for
- *      every segment mentioned in the log digest.
+ *      every segment mentioned in the log digest, and none of the other
+ *      concurrent log heads named in the digest has been closed.
  */
 bool
 verifyLogComplete(Tub<BackupStartTask> tasks[],
@@ -645,12 +717,17 @@ verifyLogComplete(Tub<BackupStartTask> tasks[],
                  const LogDigest& digest)
 {
     std::unordered_set<uint64_t> replicaSet;
+    std::unordered_set<uint64_t> closedSet;
     for (size_t i = 0; i < taskCount; ++i) {
-        foreach (auto replica, tasks[i]->result.replicas)
+        foreach (auto replica, tasks[i]->result.replicas) {
             replicaSet.insert(replica.segmentId);
+            if (replica.closed)
+                closedSet.insert(replica.segmentId);
+        }
     }
 
     uint32_t missing = 0;
+    uint32_t closedHeads = 0;
     for (uint32_t i = 0; i < digest.size(); i++) {
         uint64_t id = digest[i];
         if (!contains(replicaSet, id)) {
@@ -661,6 +738,21 @@ verifyLogComplete(Tub<BackupStartTask> tasks[],
                     "found among available backups", id);
             }
             missing++;
+            continue;
+        }
+
+        // Earlier heads of the log (including earlier heads of the stream
+        // the digest itself belongs to) are expected to be closed. But the
+        // concurrent heads were the latest heads of the master's other
+        // streams when the digest was written, and one of them is closed
+        // only once a newer head follows it, with a newer digest than this
+        // one. That newer head and whatever was appended to it are lost.
+        if (digest.isConcurrentHead(i) && contains(closedSet, id)) {
+            if (closedHeads == 0) {
+                LOG(NOTICE, "Concurrent log head %lu listed in the log digest "
+                    "was closed, but no newer digest was found", id);
+            }
+            closedHeads++;
         }
     }
 
@@ -669,8 +761,13 @@ verifyLogComplete(Tub<BackupStartTask> tasks[],
             "%u segments in the digest but not available from backups",
             missing);
     }
+    if (closedHeads) {
+        LOG(NOTICE, "%u concurrent log heads in the digest have been "
+            "replaced by heads that are not available from backups",
+            closedHeads);
+    }
 
-    return !missing;
+    return !missing && !closedHeads;
 }
 
 /**
@@ -684,47 +781,66 @@ verifyLogComplete(Tub<BackupStartTask> tasks[],
  * be considered due to min open segment id/epoch filtering, see
  * BackupStartTask::filterOutInvalidReplicas()).
  *
+ * The exception is a master whose log had several heads (which is known
+ * because its digests name concurrent heads, see LogDigest): the head of one
+ * of its streams may stay open while the others roll over many times, so
+ * the digest from the replica with the highest segment id is used instead;
+ * it is the only one certain to name every segment.
+ *
  * \param tasks
  *      Already run tasks holding the results of startReadingData calls
  *      to all of the available backups.
  * \param taskCount
  *      Number of elements in #tasks.
  * \return
- *      Triple of segment id of the replica from which the log digest was
- *      taken, the log digest itself, and a pointer to the table stats buffer.
+ *      Tuple of segment id of the replica from which the log digest was
+ *      taken, the log digest itself, a pointer to the table stats buffer,
+ *      and the length of the table stats buffer.
  *      Empty if no log digest is found.
  */
-Tub<std::tuple<uint64_t, LogDigest, TableStats::Digest*>>
+Tub<std::tuple<uint64_t, LogDigest, TableStats::Digest*, uint32_t>>
 findLogDigest(Tub<BackupStartTask> tasks[], size_t taskCount)
 {
-    uint64_t headId = ~0ul;
-    void* headBuffer = NULL;
-    uint32_t headBufferLength = 0;
-    TableStats::Digest* tableStatsBuffer = NULL;
+    const StartReadingDataRpc::Result* lowest = NULL;
+    const StartReadingDataRpc::Result* highest = NULL;
 
     for (size_t i = 0; i < taskCount; ++i) {
         const auto& result = tasks[i]->result;
         if (!result.logDigestBuffer)
             continue;
-        if (result.logDigestSegmentId < headId) {
-            headBuffer = result.logDigestBuffer.get();
-            headBufferLength = result.logDigestBytes;
-            headId = result.logDigestSegmentId;
-            if (result.tableStatsBytes >= sizeof(TableStats::Digest)) {
-                // The buffer is returned as a pointer into an object inside
-                // "tasks".  This task object should live throughout the scope
-                // of this method's caller.
-                tableStatsBuffer = reinterpret_cast<TableStats::Digest*>
-                                            (result.tableStatsBuffer.get());
-            }
-        }
+        if (lowest == NULL ||
+                result.logDigestSegmentId < lowest->logDigestSegmentId)
+            lowest = &result;
+        if (highest == NULL ||
+                result.logDigestSegmentId > highest->logDigestSegmentId)
+            highest = &result;
     }
 
-    if (headId == ~(0lu))
+    if (lowest == NULL)
         return {};
-    return {std::make_tuple(headId,
-                            LogDigest(headBuffer, headBufferLength),
-                            tableStatsBuffer)};
+
+    const StartReadingDataRpc::Result* head = lowest;
+    if (highest != lowest) {
+        LogDigest highestDigest(highest->logDigestBuffer.get(),
+                                highest->logDigestBytes);
+        if (highestDigest.hasConcurrentHeads())
+            head = highest;
+    }
+
+    // The buffer is returned as a pointer into an object inside "tasks".
+    // This task object should live throughout the scope of this method's
+    // caller.
+    TableStats::Digest* tableStatsBuffer = NULL;
+    uint32_t tableStatsBytes = 0;
+    if (head->tableStatsBytes >= sizeof(TableStats::Digest)) {
+        tableStatsBuffer = reinterpret_cast<TableStats::Digest*>
+                                    (head->tableStatsBuffer.get());
+        tableStatsBytes = head->tableStatsBytes;
+    }
+    return {std::make_tuple(head->logDigestSegmentId,
+                            LogDigest(head->logDigestBuffer.get(),
+                                      head->logDigestBytes),
+                            tableStatsBuffer, tableStatsBytes)};
 }
 
 /// Used in buildReplicaMap().
@@ -883,6 +999,7 @@ Recovery::startBackups()
     // is live.  backupStartTasks is on this methods stack and is live for
     // the scope for this method.
     TableStats::Digest* tableStats = std::get<2>(*digestInfo.get());
+    uint32_t tableStatsBytes = std::get<3>(*digestInfo.get());
 
     LOG(NOTICE, "Segment %lu is the head of the log", headId);
 
@@ -897,7 +1014,7 @@ Recovery::startBackups()
     }
 
     /* Broadcast 2: partition replicas into tablets for recovery masters */
-    TableStats::Estimator estimator(tableStats);
+    TableStats::Estimator estimator(tableStats, tableStatsBytes);
     partitionTablets(tablets, &estimator);
     LOG(NOTICE, "Partition Scheme for Recovery:\n%s",
                 dataToRecover.DebugString().c_str());
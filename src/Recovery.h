@@ -99,7 +99,7 @@ class BackupStartPartitionTask {
 bool verifyLogComplete(Tub<BackupStartTask> tasks[],
                        size_t taskCount,
                        const LogDigest& digest);
-Tub<std::tuple<uint64_t, LogDigest, TableStats::Digest*>>
+Tub<std::tuple<uint64_t, LogDigest, TableStats::Digest*, uint32_t>>
 findLogDigest(Tub<BackupStartTask> tasks[], size_t taskCount);
 vector<WireFormat::Recover::Replica> buildReplicaMap(
     Tub<BackupStartTask> tasks[], size_t taskCount,
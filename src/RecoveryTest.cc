@@ -309,6 +309,62 @@ TEST_F(RecoveryTest, splitTablets_basic) {
     tablet = NULL;
 }
 
+TEST_F(RecoveryTest, splitTablets_histogram) {
+    // A table with a histogram is split where its data is, not into equal
+    // key hash ranges.
+    Lock lock(mutex);     // To trick TableManager internal calls.
+    Tub<Recovery> recovery;
+    Recovery::Owner* own = static_cast<Recovery::Owner*>(NULL);
+    tableManager.testCreateTable("t1", 1);
+    tableManager.testAddTablet({1,  0,  ~0UL, {99, 0}, Tablet::RECOVERING, {}});
+    recovery.construct(&context, taskQueue, &tableManager, &tracker, own,
+                       ServerId(99), recoveryInfo);
+    auto tablets = tableManager.markAllTabletsRecovering(ServerId(99));
+
+    // All of the table's data is in the first histogram bucket.
+    double tableBytes = 2.5 * Recovery::PARTITION_MAX_BYTES;
+    char buffer[sizeof(TableStats::DigestHeader) +
+                sizeof(TableStats::DigestEntry) +
+                sizeof(TableStats::DigestHistograms) +
+                sizeof(TableStats::DigestHistogram)];
+    memset(buffer, 0, sizeof(buffer));
+    TableStats::Digest* digest = reinterpret_cast<TableStats::Digest*>(buffer);
+    digest->header.entryCount = 1;
+    digest->entries[0].tableId = 1;
+    digest->entries[0].bytesPerKeyHash = tableBytes / (double(~0UL) + 1);
+    digest->entries[0].recordsPerKeyHash = 0;
+    TableStats::DigestHistograms* histograms =
+            reinterpret_cast<TableStats::DigestHistograms*>(
+            &digest->entries[1]);
+    histograms->histogramCount = 1;
+    histograms->histograms[0].tableId = 1;
+    histograms->histograms[0].bytesPerKeyHash[0] = float(tableBytes /
+            double(TableStats::histogramBucketWidth));
+
+    TableStats::Estimator e(digest, sizeof32(buffer));
+    EXPECT_TRUE(e.valid);
+    EXPECT_TRUE(e.hasHistogram(1));
+
+    recovery->splitTablets(&tablets, &e);
+    ASSERT_EQ(3u, tablets.size());
+
+    EXPECT_EQ(0u, tablets[0].startKeyHash);
+    EXPECT_GT(TableStats::histogramBucketWidth / 2, tablets[0].endKeyHash);
+    EXPECT_EQ(tablets[0].endKeyHash + 1, tablets[1].startKeyHash);
+    EXPECT_GT(TableStats::histogramBucketWidth, tablets[1].endKeyHash);
+    EXPECT_EQ(tablets[1].endKeyHash + 1, tablets[2].startKeyHash);
+    EXPECT_EQ(~0UL, tablets[2].endKeyHash);
+
+    foreach (Tablet& tablet, tablets) {
+        TableStats::Estimator::Estimate estimate = e.estimate(&tablet);
+        EXPECT_NEAR(tableBytes / 3, double(estimate.byteCount),
+                    tableBytes * 0.001);
+        Tablet* found = tableManager.testFindTablet(1u, tablet.startKeyHash);
+        ASSERT_TRUE(found != NULL);
+        EXPECT_EQ(tablet.endKeyHash, found->endKeyHash);
+    }
+}
+
 TEST_F(RecoveryTest, splitTablets_byte_dominated) {
     // Ensure the tablet count can be determined by the byte count.
     Lock lock(mutex);     // To trick TableManager internal calls.
@@ -932,6 +988,33 @@ TEST_F(RecoveryTest, verifyLogComplete) {
     EXPECT_TRUE(verifyLogComplete(tasks, 1, digest));
 }
 
+TEST_F(RecoveryTest, verifyLogComplete_closedConcurrentHead) {
+    LogDigest digest;
+    digest.addSegmentId(10);
+    digest.addSegmentId(12);
+    digest.addConcurrentHead(11);
+
+    Tub<BackupStartTask> tasks[1];
+    Recovery recovery(&context, taskQueue, &tableManager, &tracker, NULL,
+            {1, 0}, recoveryInfo);
+    tasks[0].construct(&recovery, ServerId(2, 0));
+    auto& segments = tasks[0]->result.replicas;
+
+    TestLog::Enable _;
+    segments = {{10, 0, true}, {11, 0, true}, {12, 0, false}};
+    EXPECT_FALSE(verifyLogComplete(tasks, 1, digest));
+    EXPECT_EQ(
+        "verifyLogComplete: Concurrent log head 11 listed in the log digest "
+            "was closed, but no newer digest was found | "
+        "verifyLogComplete: 1 concurrent log heads in the digest have been "
+            "replaced by heads that are not available from backups",
+        TestLog::get());
+
+    // Earlier heads, such as 10, are expected to be closed.
+    segments = {{10, 0, true}, {11, 0, false}, {12, 0, false}};
+    EXPECT_TRUE(verifyLogComplete(tasks, 1, digest));
+}
+
 TEST_F(RecoveryTest, findLogDigest) {
     recoveryInfo.set_min_open_segment_id(10);
     recoveryInfo.set_min_open_segment_epoch(1);
@@ -975,6 +1058,14 @@ TEST_F(RecoveryTest, findLogDigest) {
     EXPECT_EQ(10lu, std::get<0>(*digest.get()));
     EXPECT_EQ(0u, std::get<1>(*digest.get())[0]);
 
+    result1.logDigestSegmentId = 11;
+    // Two log digests, later one has a higher segment id: with a single log
+    // head the lowest is still used.
+    digest = findLogDigest(tasks, 2);
+    ASSERT_TRUE(digest);
+    EXPECT_EQ(10lu, std::get<0>(*digest.get()));
+    EXPECT_EQ(0u, std::get<1>(*digest.get())[0]);
+
     result1.logDigestSegmentId = 9;
     // Two log digests, later one has a lower segment id.
     digest = findLogDigest(tasks, 2);
@@ -983,6 +1074,45 @@ TEST_F(RecoveryTest, findLogDigest) {
     EXPECT_EQ(1u, std::get<1>(*digest.get())[0]);
 }
 
+TEST_F(RecoveryTest, findLogDigest_multipleHeads) {
+    Tub<BackupStartTask> tasks[2];
+    Recovery recovery(&context, taskQueue, &tableManager, &tracker, NULL,
+            {1, 0}, recoveryInfo);
+    tasks[0].construct(&recovery, ServerId(2, 0));
+    tasks[1].construct(&recovery, ServerId(3, 0));
+
+    // Segment 10 is an old head that stayed open while the log's other
+    // head rolled over to segment 12.
+    LogDigest oldDigest, newDigest;
+    oldDigest.addSegmentId(10);
+    newDigest.addSegmentId(11);
+    newDigest.addSegmentId(12);
+    newDigest.addConcurrentHead(10);
+    Buffer oldBuffer, newBuffer;
+    oldDigest.appendToBuffer(oldBuffer);
+    newDigest.appendToBuffer(newBuffer);
+
+    auto& result0 = tasks[0]->result;
+    result0.logDigestBytes = oldBuffer.size();
+    result0.logDigestBuffer =
+        std::unique_ptr<char[]>(new char[oldBuffer.size()]);
+    result0.logDigestSegmentId = 10;
+    oldBuffer.copy(0, oldBuffer.size(), result0.logDigestBuffer.get());
+
+    auto& result1 = tasks[1]->result;
+    result1.logDigestBytes = newBuffer.size();
+    result1.logDigestBuffer =
+        std::unique_ptr<char[]>(new char[newBuffer.size()]);
+    result1.logDigestSegmentId = 12;
+    newBuffer.copy(0, newBuffer.size(), result1.logDigestBuffer.get());
+
+    auto digest = findLogDigest(tasks, 2);
+    ASSERT_TRUE(digest);
+    EXPECT_EQ(12lu, std::get<0>(*digest.get()));
+    EXPECT_EQ(3u, std::get<1>(*digest.get()).size());
+    EXPECT_TRUE(std::get<1>(*digest.get()).isConcurrentHead(2));
+}
+
 TEST_F(RecoveryTest, buildReplicaMap) {
     Tub<BackupStartTask> tasks[2];
     Recovery recovery(&context, taskQueue, &tableManager, &tracker, NULL,
@@ -41,12 +41,21 @@ namespace RAMCloud {
  *      replication.
  * \param allowLocalBackup
  *      Specifies whether to allow replication to the local backup.
+ * \param chainReplication
+ *      If true, backups forward replication writes to each other along a
+ *      chain rather than the master sending every write to every backup;
+ *      see ReplicatedSegment::chainReplication.
+ * \param coalesceWrites
+ *      If true, writes to the same backup (from different segments) are
+ *      coalesced into fewer RPCs; see ReplicatedSegment::writeBatches.
  */
 ReplicaManager::ReplicaManager(Context* context,
                                const ServerId* masterId,
                                uint32_t numReplicas,
                                bool useMinCopysets,
-                               bool allowLocalBackup)
+                               bool allowLocalBackup,
+                               bool chainReplication,
+                               bool coalesceWrites)
     : context(context)
     , numReplicas(numReplicas)
     , backupSelector()
@@ -62,6 +71,9 @@ ReplicaManager::ReplicaManager(Context* context,
     , replicationCounter()
     , useMinCopysets(useMinCopysets)
     , allowLocalBackup(allowLocalBackup)
+    , chainReplication(chainReplication)
+    , coalesceWrites(coalesceWrites)
+    , writeBatches()
 {
     if (useMinCopysets) {
         backupSelector.reset(new MinCopysetsBackupSelector(context, masterId,
@@ -423,6 +435,9 @@ ReplicaManager::allocateSegment(const Lock& lock,
                                  dataMutex, segmentId, segment,
                                  isLogHead, *masterId, numReplicas,
                                  &replicationCounter);
+    replicatedSegment->chainReplication = chainReplication;
+    if (coalesceWrites)
+        replicatedSegment->writeBatches = &writeBatches;
     replicatedSegmentList.push_back(*replicatedSegment);
 
     // ReplicatedSegment's constructor has scheduled the open.
@@ -446,6 +461,10 @@ ReplicaManager::handleBackupFailure(ServerId failedId)
     LOG(NOTICE, "Handling backup failure of serverId %s",
         failedId.toString().c_str());
 
+    // Writes still waiting to go out to the failed backup never will; the
+    // segments they are for start over with new replicas.
+    writeBatches.erase(failedId.getId());
+
     foreach (auto& segment, replicatedSegmentList)
         segment.handleBackupFailure(failedId, useMinCopysets);
 }
@@ -68,7 +68,9 @@ class ReplicaManager
                    const ServerId* masterId,
                    uint32_t numReplicas,
                    bool useMinCopysets,
-                   bool allowLocalBackup);
+                   bool allowLocalBackup,
+                   bool chainReplication = false,
+                   bool coalesceWrites = false);
     ~ReplicaManager();
 
     bool isIdle();
@@ -200,6 +202,25 @@ class ReplicaManager
      */
     bool allowLocalBackup;
 
+    /**
+     * Specifies whether segments use chain replication; see
+     * ReplicatedSegment::chainReplication.
+     */
+    bool chainReplication;
+
+    /**
+     * Specifies whether segments coalesce writes to the same backup into
+     * one RPC; see ReplicatedSegment::writeBatches.
+     */
+    bool coalesceWrites;
+
+    /**
+     * Coalesced write RPCs that segments are still adding writes to; shared
+     * by all segments if #coalesceWrites. See
+     * ReplicatedSegment::writeBatches.
+     */
+    ReplicatedSegment::WriteBatchMap writeBatches;
+
   PUBLIC:
     // Only used by BackupFailureMonitor.
     void handleBackupFailure(ServerId failedId);
@@ -325,9 +325,9 @@ TEST_F(ReplicaManagerTest, endToEndBackupRecovery) {
     // if the wait occurs before the failure notification gets processed this
     // will be trivially true.
     log.append(LOG_ENTRY_TYPE_OBJ, buf, sizeof(buf));
-    log.head->replicatedSegment->schedule();
+    log.heads[0].segment->replicatedSegment->schedule();
     ASSERT_FALSE(mgr->isIdle());
-    ASSERT_EQ(2u, log.head->id);
+    ASSERT_EQ(2u, log.heads[0].segment->id);
 
     ServerConfig config = ServerConfig::forTesting();
     config.services = {WireFormat::BACKUP_SERVICE,
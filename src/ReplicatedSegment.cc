@@ -123,6 +123,8 @@ ReplicatedSegment::ReplicatedSegment(Context* context,
     , listEntries()
     , replicationCounter(replicationCounter)
     , unopenedStartCycles(Cycles::rdtsc())
+    , chainReplication(false)
+    , writeBatches(NULL)
     , replicas(numReplicas)
 {
     openLen = segment->getAppendedLength(&openingWriteCertificate);
@@ -181,8 +183,17 @@ ReplicatedSegment::free()
     // the checksum stored in the replica metadata keeps this safe; if garbage
     // is sent it will not be used during recovery.
     foreach (auto& replica, replicas) {
-        if (!replica.isActive || !replica.writeRpc)
+        if (!replica.isActive || !replica.writeInProgress())
             continue;
+        if (replica.batchedWrite) {
+            // Coalesced writes can't be canceled without affecting the other
+            // writes in the same RPC. Instead, make sure the RPC is on its
+            // way now, rather than going out after the free, while the
+            // segment's memory is still intact; performFree() waits for it
+            // before freeing the replica.
+            sendBatchedWrite(replica);
+            continue;
+        }
         replica.writeRpc->cancel();
         replica.writeRpc.destroy();
         --writeRpcsInFlight;
@@ -309,8 +320,13 @@ ReplicatedSegment::handleBackupFailure(ServerId failedId, bool useMinCopysets)
             ++metrics->master.openReplicaRecoveries;
         }
 
-        if (replica.writeRpc)
+        if (replica.writeInProgress()) {
             --writeRpcsInFlight;
+            // Replicas waiting on a chain through this backup have to be
+            // written to directly now.
+            if (replicaIsPrimary(replica))
+                finishChain(0);
+        }
         if (replica.freeRpc)
             --freeRpcsInFlight;
         replica.reset(true);
@@ -671,9 +687,23 @@ ReplicatedSegment::performFree(Replica& replica)
             schedule();
             return;
         }
-        if (replica.writeRpc) {
-            // Impossible by construction. See free().
-            assert(false);
+        if (replica.writeInProgress()) {
+            // Only coalesced writes can still be outstanding; see free().
+            // Wait for the write so the free can't overtake it.
+            assert(replica.batchedWrite && replica.batchedWrite->isSent());
+            if (!replica.batchedWrite->isReady()) {
+                schedule();
+                return;
+            }
+            try {
+                replica.batchedWrite->wait(replica.batchIndex);
+            } catch (const ClientException& e) {
+                // The replica is about to be freed anyway.
+            }
+            replica.batchedWrite.reset();
+            --writeRpcsInFlight;
+            schedule();
+            return;
         } else {
             // Issue a free rpc for this replica, reschedule to wait on it.
             replica.freeRpc.construct(context, replica.backupId,
@@ -702,6 +732,12 @@ ReplicatedSegment::performWrite(Replica& replica)
         return;
     }
 
+    if (replica.chainPosition != 0) {
+        // The primary replica's write RPC is carrying this replica's data
+        // down a chain; the primary stays scheduled until it finishes.
+        return;
+    }
+
     if (!replica.isActive) {
         // This replica does not exist yet. Choose a backup.
         // Selection of a backup is separated from the send of the open rpc
@@ -740,12 +776,26 @@ ReplicatedSegment::performWrite(Replica& replica)
         // for scheduling the task.
     }
 
-    if (replica.writeRpc) {
+    if (replica.batchedWrite && !replica.batchedWrite->isSent()) {
+        // Other segments have had their chance to add writes to the same
+        // backup since this replica's write was added; send them all.
+        sendBatchedWrite(replica);
+        schedule();
+        return;
+    }
+
+    if (replica.writeInProgress()) {
         // This replica has a write request outstanding to a backup.
-        if (replica.writeRpc->isReady()) {
+        bool ready = replica.writeRpc ? replica.writeRpc->isReady()
+                                      : replica.batchedWrite->isReady();
+        if (ready) {
             // Wait for it to complete if it is ready.
             try {
-                replica.writeRpc->wait();
+                uint32_t chainAcked = 0;
+                if (replica.writeRpc)
+                    chainAcked = replica.writeRpc->wait();
+                else
+                    replica.batchedWrite->wait(replica.batchIndex);
                 TEST_LOG("Write RPC finished for replica slot %ld",
                          &replica - &replicas[0]);
                 if (replica.acked.open && !replica.sent.open) {
@@ -762,6 +812,7 @@ ReplicatedSegment::performWrite(Replica& replica)
                     // constraints during recovery of lost replicas.
                     replica.committed.open = replica.acked.open;
                 }
+                finishChain(chainAcked);
                 if (getCommitted().open && followingSegment)
                     followingSegment->precedingSegmentOpenCommitted = true;
                 if (getCommitted().close) {
@@ -800,9 +851,14 @@ ReplicatedSegment::performWrite(Replica& replica)
                     "%s with status %s",
                     segmentId, replica.backupId.toString().c_str(),
                     statusToSymbol(e.status));
+                finishChain(0);
                 throw;
             }
+            // Any replicas still waiting on a chain (because the write
+            // failed) get their data sent directly instead.
+            finishChain(0);
             replica.writeRpc.destroy();
+            replica.batchedWrite.reset();
             --writeRpcsInFlight;
             if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
                 LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write <- %7u "
@@ -856,13 +912,8 @@ ReplicatedSegment::performWrite(Replica& replica)
 
             TEST_LOG("Sending open to backup %s",
                      replica.backupId.toString().c_str());
-            replica.writeRpc.construct(context, replica.backupId,
-                                       masterId, segmentId, queued.epoch,
-                                       segment, 0, length, certificateToSend,
-                                       true, false, replicaIsPrimary(replica));
-            if (replicaIsPrimary(replica)) {
-                PerfStats::threadStats.replicationRpcs++;
-            }
+            sendWrite(replica, 0, length, certificateToSend, true, false,
+                      NULL, 0);
             ++writeRpcsInFlight;
             if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
                 LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write -> %7u+%7u "
@@ -934,17 +985,15 @@ ReplicatedSegment::performWrite(Replica& replica)
                 return;
             }
 
+            ServerId chain[replicas.numElements];
+            uint32_t chainLength = 0;
+            if (chainReplication && replicaIsPrimary(replica))
+                chainLength = startChain(replica, chain);
+
             TEST_LOG("Sending write to backup %s",
                      replica.backupId.toString().c_str());
-            replica.writeRpc.construct(context, replica.backupId, masterId,
-                                       segmentId, queued.epoch,
-                                       segment, offset, length,
-                                       certificateToSend,
-                                       false, sendClose,
-                                       replicaIsPrimary(replica));
-            if (replicaIsPrimary(replica)) {
-                PerfStats::threadStats.replicationRpcs++;
-            }
+            sendWrite(replica, offset, length, certificateToSend, false,
+                      sendClose, &chain[0], chainLength);
             ++writeRpcsInFlight;
             if (LOG_RECOVERY_REPLICATION_RPC_TIMING && recoveryStart) {
                 LOG(DEBUG, "@%7lu: Replica <%s,%lu,%lu> write -> %7u+%7u "
@@ -957,6 +1006,12 @@ ReplicatedSegment::performWrite(Replica& replica)
             replica.sent.bytes += length;
             replica.sent.epoch = queued.epoch;
             replica.sent.close = sendClose;
+            foreach (auto& chained, replicas) {
+                if (chained.chainPosition == 0)
+                    continue;
+                chained.sent = replica.sent;
+                chained.sentCertificate = replica.sentCertificate;
+            }
             schedule();
             return;
         } else {
@@ -969,6 +1024,148 @@ ReplicatedSegment::performWrite(Replica& replica)
     assert(false); // Unreachable by construction
 }
 
+/**
+ * Start a write to a replica: either send it in an RPC of its own or, if
+ * #writeBatches is set, add it to the RPC being assembled for the replica's
+ * backup. Either way the replica waits for the write in performWrite().
+ *
+ * \param replica
+ *      Replica to write to; must not have a write outstanding.
+ * \param offset
+ *      Offset in the segment of the data to send.
+ * \param length
+ *      Bytes of data to send.
+ * \param certificate
+ *      Certificate to send along with the data, or NULL for none.
+ * \param open
+ *      Whether this is the opening write for the replica.
+ * \param close
+ *      Whether this is the closing write for the replica.
+ * \param chain
+ *      Backups the replica's backup should forward the write to; see
+ *      startChain(). Writes with a chain are always sent on their own.
+ * \param chainLength
+ *      Number of entries in \a chain.
+ */
+void
+ReplicatedSegment::sendWrite(Replica& replica, uint32_t offset,
+                             uint32_t length,
+                             const SegmentCertificate* certificate,
+                             bool open, bool close,
+                             const ServerId* chain, uint32_t chainLength)
+{
+    assert(!replica.writeInProgress());
+    bool primary = replicaIsPrimary(replica);
+    if (writeBatches == NULL || chainLength > 0) {
+        replica.writeRpc.construct(context, replica.backupId, masterId,
+                                   segmentId, queued.epoch, segment,
+                                   offset, length, certificate, open, close,
+                                   primary, chain, chainLength);
+        if (primary)
+            PerfStats::threadStats.replicationRpcs++;
+        return;
+    }
+
+    std::shared_ptr<MultiWriteSegmentRpc>& batch =
+            (*writeBatches)[replica.backupId.getId()];
+    if (batch && batch->getDataBytes() + length > maxBytesPerWriteRpc) {
+        // Too big to ride along; send what has been coalesced so far and
+        // start over.
+        batch->send();
+        batch.reset();
+    }
+    if (!batch) {
+        batch = std::make_shared<MultiWriteSegmentRpc>(context,
+                                                       replica.backupId,
+                                                       masterId);
+    }
+    // Count the batch once, when its first primary write joins it, no
+    // matter which replica opened it.
+    if (primary && !batch->hasPrimaryWrite())
+        PerfStats::threadStats.replicationRpcs++;
+    replica.batchIndex = batch->addWrite(segmentId, queued.epoch, segment,
+                                         offset, length, certificate,
+                                         open, close, primary);
+    replica.batchedWrite = batch;
+}
+
+/**
+ * Send the coalesced RPC carrying a replica's write, if it hasn't been sent
+ * already, and stop other writes from being added to it.
+ *
+ * \param replica
+ *      Replica whose write was added to a batch by sendWrite().
+ */
+void
+ReplicatedSegment::sendBatchedWrite(Replica& replica)
+{
+    assert(replica.batchedWrite);
+    if (replica.batchedWrite->isSent())
+        return;
+    auto it = writeBatches->find(replica.backupId.getId());
+    if (it != writeBatches->end() && it->second == replica.batchedWrite)
+        writeBatches->erase(it);
+    replica.batchedWrite->send();
+}
+
+/**
+ * Choose the replicas whose data can ride along with the next write to the
+ * primary replica: those that have been sent (and have acknowledged)
+ * exactly what the primary has, so the same write brings them up to date.
+ * Each one chosen has its Replica::chainPosition set.
+ *
+ * \param primary
+ *      The primary replica, which is about to be sent a write.
+ * \param[out] chain
+ *      Filled in with the backups of the chosen replicas, in chain order.
+ *      Must have room for one entry per replica.
+ * \return
+ *      The number of replicas chosen.
+ */
+uint32_t
+ReplicatedSegment::startChain(Replica& primary, ServerId chain[])
+{
+    uint32_t chainLength = 0;
+    foreach (auto& replica, replicas) {
+        if (&replica == &primary || !replica.isActive ||
+            replica.writeInProgress() ||
+            !replica.committed.open || replica.sent != primary.sent ||
+            replica.acked != replica.sent) {
+            continue;
+        }
+        chain[chainLength++] = replica.backupId;
+        replica.chainPosition = chainLength;
+    }
+    return chainLength;
+}
+
+/**
+ * Called when the primary replica's chained write RPC is done with: record
+ * the progress of the replicas that were in the chain and release them to
+ * send their own writes again.
+ *
+ * \param chainAcked
+ *      Number of replicas (counting from the start of the chain) whose
+ *      backups stored the write. The rest go back to their acknowledged
+ *      progress, so that the data will be resent to them directly.
+ */
+void
+ReplicatedSegment::finishChain(uint32_t chainAcked)
+{
+    foreach (auto& replica, replicas) {
+        if (replica.chainPosition == 0)
+            continue;
+        if (replica.chainPosition <= chainAcked) {
+            replica.acked = replica.sent;
+            if (replica.sentCertificate)
+                replica.committed = replica.acked;
+        } else {
+            replica.sent = replica.acked;
+        }
+        replica.chainPosition = 0;
+    }
+}
+
 /**
  * Prints a ton of internal state of the replica. Useful for diagnosing why
  * a particular segment's replication is stuck.
@@ -1001,7 +1198,7 @@ ReplicatedSegment::dumpProgress()
             replica.acked.open, replica.acked.bytes, replica.acked.close,
             replica.committed.open, replica.committed.bytes,
             replica.committed.close,
-            bool(replica.writeRpc)));
+            replica.writeInProgress()));
     }
     LOG(NOTICE, "\n%s", info.c_str());
 }
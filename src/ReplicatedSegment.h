@@ -93,6 +93,14 @@ class ReplicatedSegment : public Task {
         virtual ~Deleter() {}
     };
 
+    /**
+     * Coalesced write RPCs that are still accepting writes, at most one per
+     * backup, keyed by the backup's server id; see #writeBatches.
+     */
+    typedef std::unordered_map<uint64_t,
+                               std::shared_ptr<MultiWriteSegmentRpc>>
+            WriteBatchMap;
+
   PRIVATE:
     /**
      * For internal use; represents "how much" of a segment or replica.
@@ -230,8 +238,11 @@ class ReplicatedSegment : public Task {
             , sent()
             , freeRpc()
             , writeRpc()
+            , batchedWrite()
+            , batchIndex(0)
             , replacesLostReplica(false)
             , sentCertificate(false)
+            , chainPosition(0)
         {}
 
         ~Replica() {
@@ -314,6 +325,21 @@ class ReplicatedSegment : public Task {
         /// The outstanding write operation to this backup, if any.
         Tub<WriteSegmentRpc> writeRpc;
 
+        /**
+         * If a write to this replica was coalesced with others to the same
+         * backup (see ReplicatedSegment::writeBatches), the RPC carrying it;
+         * used instead of #writeRpc. The RPC may not have been sent yet.
+         */
+        std::shared_ptr<MultiWriteSegmentRpc> batchedWrite;
+
+        /// Index of this replica's write within #batchedWrite.
+        uint32_t batchIndex;
+
+        /// True if a write to this replica is outstanding, in either form.
+        bool writeInProgress() const {
+            return writeRpc || batchedWrite;
+        }
+
         // Fields below survive across failed()/start() calls.
 
         /**
@@ -333,6 +359,16 @@ class ReplicatedSegment : public Task {
          */
         bool sentCertificate;
 
+        /**
+         * If non-zero, the write described by #sent was handed to the
+         * primary replica's backup to pass on (see
+         * ReplicatedSegment::chainReplication) rather than sent directly,
+         * and this is the replica's position in that chain (1 for the first
+         * backup after the primary's). The replica waits for the
+         * primary's write RPC instead of sending its own.
+         */
+        uint32_t chainPosition;
+
         DISALLOW_COPY_AND_ASSIGN(Replica);
     };
 
@@ -390,6 +426,12 @@ class ReplicatedSegment : public Task {
     void performTask();
     void performFree(Replica& replica);
     void performWrite(Replica& replica);
+    void sendWrite(Replica& replica, uint32_t offset, uint32_t length,
+                   const SegmentCertificate* certificate, bool open,
+                   bool close, const ServerId* chain, uint32_t chainLength);
+    void sendBatchedWrite(Replica& replica);
+    uint32_t startChain(Replica& primary, ServerId chain[]);
+    void finishChain(uint32_t chainAcked);
 
     void dumpProgress();
 
@@ -610,6 +652,29 @@ class ReplicatedSegment : public Task {
      */
     uint64_t unopenedStartCycles;
 
+    /**
+     * If true, data writes are sent only to the primary replica's backup,
+     * which passes them on to the other replicas' backups in parallel
+     * (chain replication), so the master sends each byte once rather than
+     * once per replica. Only replicas that are exactly caught up with the
+     * primary join a chain; opens and writes to replicas that are behind
+     * (for example, replacements for lost replicas) are sent directly.
+     * Set by ReplicaManager.
+     */
+    bool chainReplication;
+
+    /**
+     * If non-NULL, writes to replicas that aren't part of a chain are not
+     * sent in RPCs of their own; instead writes to the same backup are
+     * coalesced into a single MultiWriteSegmentRpc, which stays in this
+     * map, accepting further writes (from this and other segments), until
+     * one of the replicas it carries a write for is next performed. Under
+     * load that is after every other scheduled segment has had its turn,
+     * which cuts the number of RPCs without holding writes back much. Shared
+     * by all of the segments of a ReplicaManager, which sets it.
+     */
+    WriteBatchMap* writeBatches;
+
     /**
      * An array of #ReplicaManager::replica backups on which the segment is
      * (being) replicated.
@@ -274,6 +274,49 @@ TEST_F(ReplicatedSegmentTest, freeWriteRpcInProgress) {
     reset();
 }
 
+TEST_F(ReplicatedSegmentTest, freeCoalescedWriteInProgress) {
+    ReplicatedSegment::WriteBatchMap writeBatches;
+    segment->writeBatches = &writeBatches;
+    transport.setInput("0 1 0"); // open first replica
+    transport.setInput("0 1 0"); // open second replica
+    transport.setInput("0 1 0"); // close first replica
+    transport.setInput("0 1 0"); // close second replica
+    segment->close();
+    segment->sync();
+    EXPECT_TRUE(segment->getCommitted().close);
+    EXPECT_TRUE(writeBatches.empty());
+
+    // Simulate a write started (say, to replace a lost replica) after
+    // free() synced but before it took the lock; it is still waiting for
+    // other writes to join its batch.
+    segment->sendWrite(segment->replicas[0], 0, openLen, NULL, true, false,
+                       NULL, 0);
+    ++writeRpcsInFlight;
+    std::shared_ptr<MultiWriteSegmentRpc> batch =
+            segment->replicas[0].batchedWrite;
+    EXPECT_FALSE(batch->isSent());
+    EXPECT_EQ(1u, writeBatches.size());
+
+    // The batch must go out now, and not be left behind for other segments
+    // to send after the replica is freed.
+    transport.setInput("0 1 0");
+    segment->free();
+    EXPECT_TRUE(batch->isSent());
+    EXPECT_TRUE(writeBatches.empty());
+    EXPECT_TRUE(segment->replicas[0].writeInProgress());
+    EXPECT_EQ(1u, writeRpcsInFlight);
+
+    taskQueue.performTask(); // reap the write
+    EXPECT_FALSE(segment->replicas[0].writeInProgress());
+    EXPECT_FALSE(segment->replicas[0].freeRpc);
+    EXPECT_TRUE(segment->replicas[1].freeRpc);
+    EXPECT_EQ(0u, writeRpcsInFlight);
+
+    taskQueue.performTask();
+    EXPECT_TRUE(segment->replicas[0].freeRpc);
+    reset();
+}
+
 TEST_F(ReplicatedSegmentTest, isSynced) {
     EXPECT_FALSE(segment->isSynced());
     segment->replicas[0].isActive = segment->replicas[1].isActive = true;
@@ -1379,6 +1422,219 @@ TEST_F(ReplicatedSegmentTest, performWriteRpcIsReady) {
     reset();
 }
 
+TEST_F(ReplicatedSegmentTest, performWriteChainReplication) {
+    segment->chainReplication = true;
+    transport.setInput("0 0"); // open
+    transport.setInput("0 0"); // open
+    transport.setInput("0 1"); // chained write, forwarded to one backup
+
+    taskQueue.performTask(); // send opens
+    taskQueue.performTask(); // reap opens
+    transport.clearOutput();
+
+    createSegment->logSegment.head = openLen + 10; // write queued
+    segment->close();
+    SegmentCertificate certificate;
+    createSegment->logSegment.getAppendedLength(&certificate);
+    taskQueue.performTask(); // send chained write
+
+    WrReq request{{BACKUP_WRITE, BACKUP_SERVICE, 0},
+                  999, 888, 0, 10, 10, false, true, true, true, certificate};
+    request.chainLength = 1;
+    char payload[sizeof(uint64_t) + 10];
+    uint64_t backupId = backupId2.getId();
+    memcpy(payload, &backupId, sizeof(backupId));
+    memcpy(payload + sizeof(backupId), "klmnopqrst", 10);
+    EXPECT_TRUE(transport.outputMatches(0, MockTransport::SEND_REQUEST,
+                                        request, payload, sizeof(payload)));
+    EXPECT_EQ(1u, transport.output.size());
+    EXPECT_TRUE(segment->replicas[0].writeRpc);
+    EXPECT_FALSE(segment->replicas[1].writeRpc);
+    EXPECT_EQ(1u, segment->replicas[1].chainPosition);
+    EXPECT_EQ(openLen + 10, segment->replicas[1].sent.bytes);
+    EXPECT_EQ(openLen, segment->replicas[1].acked.bytes);
+
+    taskQueue.performTask(); // reap chained write
+    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_EQ(0u, segment->replicas[1].chainPosition);
+    EXPECT_EQ(openLen + 10, segment->replicas[1].acked.bytes);
+    EXPECT_TRUE(segment->replicas[1].committed.close);
+    EXPECT_TRUE(segment->getCommitted().close);
+    EXPECT_EQ(1u, transport.output.size());
+    reset();
+}
+
+TEST_F(ReplicatedSegmentTest, performWriteChainReplicationNotForwarded) {
+    segment->chainReplication = true;
+    transport.setInput("0 0"); // open
+    transport.setInput("0 0"); // open
+    transport.setInput("0 0"); // chained write, not forwarded
+    transport.setInput("0 0"); // direct write to second replica
+
+    taskQueue.performTask(); // send opens
+    taskQueue.performTask(); // reap opens
+    createSegment->logSegment.head = openLen + 10; // write queued
+    segment->close();
+    taskQueue.performTask(); // send chained write
+    transport.clearOutput();
+
+    taskQueue.performTask(); // reap chained write, resend directly
+    EXPECT_EQ(0u, segment->replicas[1].chainPosition);
+    EXPECT_EQ(openLen + 10, segment->replicas[0].committed.bytes);
+    EXPECT_TRUE(segment->replicas[1].writeRpc);
+    EXPECT_EQ(openLen + 10, segment->replicas[1].sent.bytes);
+    EXPECT_EQ(openLen, segment->replicas[1].acked.bytes);
+
+    SegmentCertificate certificate;
+    createSegment->logSegment.getAppendedLength(&certificate);
+    EXPECT_TRUE(transport.outputMatches(0, MockTransport::SEND_REQUEST,
+        WrReq{{BACKUP_WRITE, BACKUP_SERVICE, 1},
+                 999, 888, 0, 10, 10, false, true, false, true, certificate},
+                "klmnopqrst", 10));
+
+    taskQueue.performTask(); // reap direct write
+    EXPECT_TRUE(segment->getCommitted().close);
+    reset();
+}
+
+TEST_F(ReplicatedSegmentTest, performWriteCoalesced) {
+    ReplicatedSegment::WriteBatchMap writeBatches;
+    CreateSegment otherSegment(this, NULL, segmentId + 1, numReplicas);
+    ReplicatedSegment* other = otherSegment.segment.get();
+    segment->writeBatches = &writeBatches;
+    other->writeBatches = &writeBatches;
+    transport.setInput("0 2 0 0"); // opens of both segments on backup1
+    transport.setInput("0 2 0 0"); // opens of both segments on backup2
+    uint64_t replicationRpcs = PerfStats::threadStats.replicationRpcs;
+
+    taskQueue.performTask(); // add segment's opens to new batches
+    EXPECT_EQ(0u, transport.output.size());
+    EXPECT_EQ(2u, writeBatches.size());
+    EXPECT_EQ(replicationRpcs + 1, PerfStats::threadStats.replicationRpcs);
+    EXPECT_TRUE(segment->replicas[0].writeInProgress());
+    EXPECT_FALSE(segment->replicas[0].writeRpc);
+    EXPECT_EQ(2u, writeRpcsInFlight);
+
+    taskQueue.performTask(); // add other's opens to the same batches
+    EXPECT_EQ(0u, transport.output.size());
+    EXPECT_EQ(segment->replicas[0].batchedWrite,
+              other->replicas[0].batchedWrite);
+    EXPECT_EQ(segment->replicas[1].batchedWrite,
+              other->replicas[1].batchedWrite);
+    EXPECT_EQ(1u, other->replicas[0].batchIndex);
+    EXPECT_EQ(4u, writeRpcsInFlight);
+    EXPECT_EQ(replicationRpcs + 1, PerfStats::threadStats.replicationRpcs);
+
+    taskQueue.performTask(); // segment sends both batches
+    EXPECT_EQ(2u, transport.output.size());
+    EXPECT_TRUE(writeBatches.empty());
+    auto* request = transport.output[0].second.getStart<
+        BackupMultiWrite::Request>();
+    EXPECT_EQ(BACKUP_MULTI_WRITE, request->common.opcode);
+    EXPECT_EQ(masterId.getId(), request->masterId);
+    EXPECT_EQ(2u, request->count);
+
+    taskQueue.performTask(); // other reaps its opens
+    EXPECT_TRUE(other->getCommitted().open);
+    EXPECT_FALSE(other->replicas[0].writeInProgress());
+    taskQueue.performTask(); // segment reaps its opens
+    EXPECT_TRUE(segment->getCommitted().open);
+    EXPECT_EQ(0u, writeRpcsInFlight);
+    EXPECT_EQ(2u, transport.output.size());
+    EXPECT_TRUE(taskQueue.isIdle());
+}
+
+TEST_F(ReplicatedSegmentTest, performWriteCoalescedTooBig) {
+    ReplicatedSegment::WriteBatchMap writeBatches;
+    segment->writeBatches = &writeBatches;
+    transport.setInput("0 1 0"); // open
+    transport.setInput("0 1 0"); // open
+    transport.setInput("0 1 0"); // write
+    transport.setInput("0 1 0"); // write
+    transport.setInput("0 1 0"); // batch sent once the next write didn't fit
+
+    taskQueue.performTask(); // add opens to batches
+    taskQueue.performTask(); // send opens
+    taskQueue.performTask(); // reap opens
+    transport.clearOutput();
+
+    createSegment->logSegment.head = openLen + 10; // write queued
+    segment->sync(openLen + 10);
+    EXPECT_EQ(2u, transport.output.size());
+    EXPECT_EQ(openLen + 10, segment->getCommitted().bytes);
+
+    // A write that doesn't fit in what remains of MAX_BYTES_PER_WRITE forces
+    // the batch holding the previous one out.
+    std::shared_ptr<MultiWriteSegmentRpc>& batch =
+            writeBatches[backupId1.getId()];
+    batch = std::make_shared<MultiWriteSegmentRpc>(&context, backupId1,
+                                                   masterId);
+    batch->addWrite(segmentId + 1, 0, &createSegment->logSegment, 0, 15,
+                    NULL, false, false, false);
+    std::shared_ptr<MultiWriteSegmentRpc> full = batch;
+    createSegment->logSegment.head = openLen + 20; // write queued
+    segment->queued.bytes = openLen + 20;
+    segment->schedule();
+    taskQueue.performTask();
+    EXPECT_TRUE(full->isSent());
+    EXPECT_NE(full, segment->replicas[0].batchedWrite);
+    EXPECT_EQ(0u, segment->replicas[0].batchIndex);
+    reset();
+}
+
+TEST_F(ReplicatedSegmentTest, performWriteCoalescedCountsPrimaryJoin) {
+    ReplicatedSegment::WriteBatchMap writeBatches;
+    segment->writeBatches = &writeBatches;
+
+    // A secondary write for another segment opened the batch.
+    std::shared_ptr<MultiWriteSegmentRpc>& batch =
+            writeBatches[backupId1.getId()];
+    batch = std::make_shared<MultiWriteSegmentRpc>(&context, backupId1,
+                                                   masterId);
+    batch->addWrite(segmentId + 1, 0, &createSegment->logSegment, 0, 15,
+                    NULL, false, false, false);
+    EXPECT_FALSE(batch->hasPrimaryWrite());
+    uint64_t replicationRpcs = PerfStats::threadStats.replicationRpcs;
+
+    taskQueue.performTask(); // primary open joins it
+    EXPECT_TRUE(writeBatches[backupId1.getId()]->hasPrimaryWrite());
+    EXPECT_EQ(replicationRpcs + 1, PerfStats::threadStats.replicationRpcs);
+    reset();
+}
+
+TEST_F(ReplicatedSegmentTest, handleBackupFailureWithUnsentCoalescedWrite) {
+    ReplicatedSegment::WriteBatchMap writeBatches;
+    segment->writeBatches = &writeBatches;
+    taskQueue.performTask(); // add opens to batches
+    EXPECT_EQ(2u, writeRpcsInFlight);
+
+    segment->handleBackupFailure(backupId1, false);
+    EXPECT_FALSE(segment->replicas[0].isActive);
+    EXPECT_FALSE(segment->replicas[0].writeInProgress());
+    EXPECT_EQ(1u, writeRpcsInFlight);
+    EXPECT_TRUE(segment->replicas[1].writeInProgress());
+    reset();
+}
+
+TEST_F(ReplicatedSegmentTest, handleBackupFailureDuringChainedWrite) {
+    segment->chainReplication = true;
+    transport.setInput("0 0"); // open
+    transport.setInput("0 0"); // open
+
+    taskQueue.performTask(); // send opens
+    taskQueue.performTask(); // reap opens
+    createSegment->logSegment.head = openLen + 10; // write queued
+    segment->close();
+    taskQueue.performTask(); // send chained write
+    EXPECT_EQ(1u, segment->replicas[1].chainPosition);
+
+    segment->handleBackupFailure(backupId1, false);
+    EXPECT_FALSE(segment->replicas[0].isActive);
+    EXPECT_EQ(0u, segment->replicas[1].chainPosition);
+    EXPECT_EQ(openLen, segment->replicas[1].sent.bytes);
+    reset();
+}
+
 TEST_F(ReplicatedSegmentTest, performWriteRpcFailed) {
     ServerIdRpcWrapper::ConvertExceptionsToDoesntExist _;
     transport.clearInput();
@@ -1809,11 +2065,11 @@ TEST_F(ReplicatedSegmentTest, performWrite_CallerNotInClusterException) {
     TestLog::Enable _(performWriteFilter);
     context.coordinatorSession->setLocation("mock:host=coord");
     // Arrange for RPC responses:
-    transport.setInput("0");  // accept write for first replica
+    transport.setInput("0 0"); // accept write for first replica
     transport.setInput("26"); // reject write for 2nd replica - caller not
                               // in cluster
     transport.setInput("0");  // verifyMembership response
-    transport.setInput("0");  // accept write retry for 2nd replica
+    transport.setInput("0 0"); // accept write retry for 2nd replica
 
     taskQueue.performTask();
     // At this point writes should have been issued for both replicas.
@@ -1852,7 +2108,7 @@ TEST_F(ReplicatedSegmentTest, performWriteUnexpectedClientException) {
     TestLog::Enable _(performWriteFilter);
     context.coordinatorSession->setLocation("mock:host=coord");
     // Arrange for RPC responses:
-    transport.setInput("0");  // accept write for first replica
+    transport.setInput("0 0"); // accept write for first replica
     transport.setInput("14"); // reject write for 2nd replica
 
     taskQueue.performTask();
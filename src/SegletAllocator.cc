@@ -13,6 +13,8 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <unistd.h>
+
 #include "Common.h"
 #include "BitOps.h"
 #include "LogSegment.h"
@@ -26,7 +28,8 @@ namespace RAMCloud {
 /**
  * Construct a new SegmentAllocator by allocating a large chunk of memory
  * and chopping it up into individual seglets of the specified size. All
- * seglets will be placed in the lowest priority "default" pool.
+ * seglets will be placed in the lowest priority "default" pool. One per-core
+ * cache is created for each online processor.
  *
  * \param config
  *      Server runtime configuration, specifying various parameters like
@@ -41,7 +44,14 @@ SegletAllocator::SegletAllocator(const ServerConfig* config)
       emergencyHeadPoolReserve(0),
       cleanerPool(),
       cleanerPoolReserve(0),
+      cleanerPoolFull(true),
       defaultPool(),
+      localCacheBatch(std::max(1U, config->segmentSize / config->segletSize)),
+      numLocalCaches(std::max(1U, downCast<uint32_t>(
+                            sysconf(_SC_NPROCESSORS_ONLN)))),
+      localCaches(new LocalCache[numLocalCaches]),
+      cachedSegletCount(0),
+      localCacheFlushes(0),
       segletToSegmentTable(),
       block(config->master.logBytes)
 {
@@ -61,6 +71,8 @@ SegletAllocator::SegletAllocator(const ServerConfig* config)
  */
 SegletAllocator::~SegletAllocator()
 {
+    flushLocalCaches();
+
     size_t totalFree = emergencyHeadPool.size() +
                        cleanerPool.size() +
                        defaultPool.size();
@@ -84,6 +96,16 @@ SegletAllocator::~SegletAllocator()
 void
 SegletAllocator::getMetrics(ProtoBuf::LogMetrics_SegletMetrics& m)
 {
+    // Cache locks must be taken before the monitor lock, so gather these
+    // first.
+    uint64_t cacheAllocs = 0, cacheRefills = 0, cacheSpills = 0;
+    for (uint32_t i = 0; i < numLocalCaches; i++) {
+        SpinLock::Guard _(localCaches[i].lock);
+        cacheAllocs += localCaches[i].allocs;
+        cacheRefills += localCaches[i].refills;
+        cacheSpills += localCaches[i].spills;
+    }
+
     // .size() methods on vectors are not necessarily thread-safe.
     std::lock_guard<SpinLock> guard(lock);
 
@@ -95,7 +117,12 @@ SegletAllocator::getMetrics(ProtoBuf::LogMetrics_SegletMetrics& m)
     m.set_emergency_head_pool_count(emergencyHeadPool.size());
     m.set_cleaner_pool_reserve(cleanerPoolReserve);
     m.set_cleaner_pool_count(cleanerPool.size());
-    m.set_default_pool_count(defaultPool.size());
+    m.set_default_pool_count(defaultPool.size() + cachedSegletCount);
+    m.set_local_cache_count(cachedSegletCount);
+    m.set_local_cache_allocs(cacheAllocs);
+    m.set_local_cache_refills(cacheRefills);
+    m.set_local_cache_spills(cacheSpills);
+    m.set_local_cache_flushes(localCacheFlushes);
 }
 
 /**
@@ -116,15 +143,31 @@ SegletAllocator::alloc(AllocationType type,
                        uint32_t count,
                        vector<Seglet*>& outSeglets)
 {
-    std::lock_guard<SpinLock> guard(lock);
+    if (type == DEFAULT)
+        return allocDefault(count, outSeglets);
 
-    if (type == EMERGENCY_HEAD)
-        return allocFromPool(emergencyHeadPool, count, outSeglets);
+    {
+        std::lock_guard<SpinLock> guard(lock);
 
-    if (type == CLEANER)
-        return allocFromPool(cleanerPool, count, outSeglets);
+        if (type == EMERGENCY_HEAD)
+            return allocFromPool(emergencyHeadPool, count, outSeglets);
 
-    return allocFromPool(defaultPool, count, outSeglets);
+        if (allocFromPool(cleanerPool, count, outSeglets)) {
+            if (count > 0)
+                cleanerPoolFull.store(false);
+            return true;
+        }
+    }
+
+    // The cleaner's reserve is short. Seglets freed while it was full may be
+    // sitting in the per-core caches, and flushing them refills it first.
+    flushLocalCaches();
+    std::lock_guard<SpinLock> guard(lock);
+    if (!allocFromPool(cleanerPool, count, outSeglets))
+        return false;
+    if (count > 0)
+        cleanerPoolFull.store(false);
+    return true;
 }
 
 /**
@@ -143,6 +186,7 @@ SegletAllocator::alloc(AllocationType type,
 bool
 SegletAllocator::initializeEmergencyHeadReserve(uint32_t numSeglets)
 {
+    flushLocalCaches();
     std::lock_guard<SpinLock> guard(lock);
 
     if (emergencyHeadPoolReserve != 0)
@@ -181,6 +225,7 @@ SegletAllocator::initializeEmergencyHeadReserve(uint32_t numSeglets)
 bool
 SegletAllocator::initializeCleanerReserve(uint32_t numSeglets)
 {
+    flushLocalCaches();
     std::lock_guard<SpinLock> guard(lock);
 
     if (cleanerPoolReserve != 0)
@@ -203,6 +248,9 @@ SegletAllocator::initializeCleanerReserve(uint32_t numSeglets)
 /**
  * Return a seglet to this allocator. This is normally invoked within the
  * Seglet::free() method when a seglet returns itself.
+ *
+ * Seglets that would otherwise go to the default pool are kept in the calling
+ * thread's cache, so that the common case does not need the monitor lock.
  */
 void
 SegletAllocator::free(Seglet* seglet)
@@ -210,11 +258,35 @@ SegletAllocator::free(Seglet* seglet)
     if (DEBUG_BUILD)
         memset(seglet->get(), '!', seglet->getLength());
 
-    std::lock_guard<SpinLock> guard(lock);
-
     // This seglet no longer belongs to any segment, so update that fact first.
     setOwnerSegment(seglet, NULL);
 
+    // Seglets owed to one of the reserves must go straight back to it. A free
+    // that races with a cleaner allocation and sees a stale value here simply
+    // behaves as though it happened just before that allocation.
+    if (seglet->getSourcePool() == &emergencyHeadPool ||
+            !cleanerPoolFull.load()) {
+        std::lock_guard<SpinLock> guard(lock);
+        freeToPool(seglet);
+        return;
+    }
+
+    LocalCache& cache = getLocalCache();
+    SpinLock::Guard _(cache.lock);
+    cache.seglets.push_back(seglet);
+    cachedSegletCount++;
+    if (cache.seglets.size() >= 2 * localCacheBatch)
+        spillLocalCache(cache);
+}
+
+/**
+ * Return a seglet to the appropriate global pool. See free() for details.
+ *
+ * This must be called with the monitor lock held.
+ */
+void
+SegletAllocator::freeToPool(Seglet* seglet)
+{
     // The emergency head pool is special. Seglets that came from it must be
     // returned to it. Futhermore, only segments that came from it should be
     // returned.
@@ -234,6 +306,8 @@ SegletAllocator::free(Seglet* seglet)
     // this pool should never remain non-full for long.
     if (cleanerPool.size() < cleanerPoolReserve) {
         cleanerPool.push_back(seglet);
+        if (cleanerPool.size() == cleanerPoolReserve)
+            cleanerPoolFull.store(true);
         return;
     }
 
@@ -267,7 +341,7 @@ SegletAllocator::getFreeCount(AllocationType type)
     if (type == CLEANER)
         return cleanerPool.size();
     assert(type == DEFAULT);
-    return defaultPool.size();
+    return defaultPool.size() + cachedSegletCount;
 }
 
 size_t
@@ -324,7 +398,8 @@ SegletAllocator::getMemoryUtilization()
     size_t maxDefaultPoolSize = getTotalCount() -
                                 emergencyHeadPoolReserve -
                                 cleanerPoolReserve;
-    return downCast<int>(100 * (maxDefaultPoolSize - defaultPool.size()) /
+    size_t freeSeglets = defaultPool.size() + cachedSegletCount;
+    return downCast<int>(100 * (maxDefaultPoolSize - freeSeglets) /
                          maxDefaultPoolSize);
 }
 
@@ -358,6 +433,103 @@ SegletAllocator::setOwnerSegment(Seglet* seglet, LogSegment* segment)
     Fence::sfence();
 }
 
+/**
+ * Allocate seglets from the default pool, going through the calling thread's
+ * cache. If neither the cache nor the default pool can satisfy the request,
+ * all other caches are flushed back to the default pool before giving up, so
+ * seglets held in caches never cause an allocation to fail.
+ *
+ * \param count
+ *      The number of seglets to allocate.
+ * \param[out] outSeglets
+ *      Vector in which allocated seglets will be returned.
+ * \return
+ *      True if the full allocation succeeded, otherwise false (in which case
+ *      nothing was allocated).
+ */
+bool
+SegletAllocator::allocDefault(uint32_t count, vector<Seglet*>& outSeglets)
+{
+    {
+        LocalCache& cache = getLocalCache();
+        SpinLock::Guard _(cache.lock);
+
+        if (cache.seglets.size() < count) {
+            // Take what we're missing from the default pool, plus a batch
+            // extra so the next few allocations stay local.
+            std::lock_guard<SpinLock> guard(lock);
+            size_t shortfall = count - cache.seglets.size();
+            if (defaultPool.size() >= shortfall) {
+                size_t refill = shortfall + localCacheBatch;
+                if (refill > defaultPool.size())
+                    refill = defaultPool.size();
+                allocFromPool(defaultPool, downCast<uint32_t>(refill),
+                              cache.seglets);
+                cachedSegletCount += refill;
+                cache.refills++;
+            }
+        } else {
+            cache.allocs++;
+        }
+
+        if (cache.seglets.size() >= count) {
+            allocFromPool(cache.seglets, count, outSeglets);
+            cachedSegletCount -= count;
+            return true;
+        }
+    }
+
+    // Other threads' caches may be holding the seglets we need.
+    flushLocalCaches();
+    std::lock_guard<SpinLock> guard(lock);
+    localCacheFlushes++;
+    return allocFromPool(defaultPool, count, outSeglets);
+}
+
+/**
+ * Return every seglet in every per-core cache to the global pools, where
+ * they are distributed exactly as in free(): any room in the cleaner's
+ * reserve is filled first and the rest go to the default pool. This is used
+ * when the default or cleaner pool runs short, and at destruction time.
+ *
+ * The caller must not hold the monitor lock or any cache's lock.
+ */
+void
+SegletAllocator::flushLocalCaches()
+{
+    for (uint32_t i = 0; i < numLocalCaches; i++) {
+        LocalCache& cache = localCaches[i];
+        SpinLock::Guard _(cache.lock);
+        std::lock_guard<SpinLock> guard(lock);
+        size_t count = cache.seglets.size();
+        foreach (Seglet* seglet, cache.seglets)
+            freeToPool(seglet);
+        cache.seglets.clear();
+        cachedSegletCount -= count;
+    }
+}
+
+/**
+ * Return a batch of seglets from a cache that has grown too large to the
+ * global pools, where they are distributed exactly as in free().
+ *
+ * This must be called with the cache's lock held, but not the monitor lock.
+ *
+ * \param cache
+ *      The cache to shrink.
+ */
+void
+SegletAllocator::spillLocalCache(LocalCache& cache)
+{
+    std::lock_guard<SpinLock> guard(lock);
+    for (uint32_t i = 0; i < localCacheBatch; i++) {
+        freeToPool(cache.seglets.back());
+        cache.seglets.pop_back();
+    }
+    cachedSegletCount -= localCacheBatch;
+    cache.spills++;
+}
+
 size_t
 SegletAllocator::getSegletIndex(const void* p)
 {
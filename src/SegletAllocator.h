@@ -16,10 +16,14 @@
 #ifndef RAMCLOUD_SEGLETALLOCATOR_H
 #define RAMCLOUD_SEGLETALLOCATOR_H
 
+#include <atomic>
+#include <memory>
+
 #include "Common.h"
 #include "LargeBlockOfMemory.h"
 #include "Seglet.h"
 #include "SpinLock.h"
+#include "ThreadId.h"
 
 #include "LogMetrics.pb.h"
 
@@ -52,6 +56,15 @@ class LogSegment;
  * How seglets are returned to appropriate pools is somewhat subtle (and
  * annoyingly so). See the free() method's documentation if you're interested.
  *
+ * To keep the log head and the cleaner threads from all serializing on one
+ * lock, free seglets from the default pool are also cached per core. Each
+ * thread allocates from and frees to its own cache, which refills from and
+ * spills to the default pool a segment's worth of seglets at a time. Cached
+ * seglets still count as free default seglets, and they are flushed back to
+ * the global pools (refilling the cleaner reserve first) whenever an
+ * allocation cannot otherwise be satisfied. The emergency head and cleaner
+ * pools are never cached.
+ *
  * Seglets are always allocated by the SegmentManager when it creates new log
  * segments and are freed by the Segment class they're assigned to, either at
  * destruction time, or when the segment is closed and told to free unused
@@ -90,6 +103,60 @@ class SegletAllocator {
     void setOwnerSegment(Seglet* seglet, LogSegment* segment);
 
   PRIVATE:
+    /**
+     * A per-core cache of free seglets from the default pool. Threads are
+     * mapped onto caches by their ThreadId, so in the common case each cache
+     * is only touched by one thread and its lock is uncontended.
+     */
+    class LocalCache {
+      public:
+        LocalCache()
+            : lock("SegletAllocator::LocalCache::lock"),
+              seglets(),
+              allocs(0),
+              refills(0),
+              spills(0),
+              pad()
+        {
+        }
+
+        /// Protects all members of this cache. If the allocator's monitor
+        /// lock is also needed, this lock must be acquired first.
+        SpinLock lock;
+
+        /// Free seglets available to this cache's threads.
+        vector<Seglet*> seglets;
+
+        /// Number of allocations satisfied entirely from this cache.
+        uint64_t allocs;
+
+        /// Number of times this cache had to take seglets from the default
+        /// pool.
+        uint64_t refills;
+
+        /// Number of times this cache grew too large and returned seglets to
+        /// the global pools.
+        uint64_t spills;
+
+        /// Keeps neighbouring caches off of each other's cache lines.
+        char pad[CACHE_LINE_SIZE];
+
+        DISALLOW_COPY_AND_ASSIGN(LocalCache);
+    };
+
+    /**
+     * Return the cache used by the calling thread.
+     */
+    LocalCache&
+    getLocalCache()
+    {
+        return localCaches[ThreadId::get() % numLocalCaches];
+    }
+
+    bool allocDefault(uint32_t count, vector<Seglet*>& outSeglets);
+    void flushLocalCaches();
+    void freeToPool(Seglet* seglet);
+    void spillLocalCache(LocalCache& cache);
     size_t getSegletIndex(const void* p);
     bool allocFromPool(vector<Seglet*>& pool,
                        uint32_t count,
@@ -137,9 +204,35 @@ class SegletAllocator {
     /// Maximum number of seglets to reserve in the cleanerPool.
     uint32_t cleanerPoolReserve;
 
+    /// True when the cleanerPool holds cleanerPoolReserve seglets. Freed
+    /// seglets may only go to the per-core caches when this is set; otherwise
+    /// they must refill the cleaner's reserve first. Atomic because it is
+    /// written with the monitor lock held but read without it in free().
+    std::atomic<bool> cleanerPoolFull;
+
     /// Pool holding all other seglets not otherwise reserved.
     vector<Seglet*> defaultPool;
 
+    /// Number of seglets moved between a LocalCache and the defaultPool at a
+    /// time (one segment's worth). A cache spills once it holds twice this
+    /// many.
+    uint32_t localCacheBatch;
+
+    /// Number of entries in localCaches.
+    uint32_t numLocalCaches;
+
+    /// Per-core caches of free default seglets (see LocalCache).
+    std::unique_ptr<LocalCache[]> localCaches;
+
+    /// Total number of seglets currently held in localCaches. These are
+    /// counted as free default seglets.
+    std::atomic<uint64_t> cachedSegletCount;
+
+    /// Number of times flushLocalCaches() had to return every cached seglet
+    /// to the defaultPool to satisfy an allocation. Protected by the monitor
+    /// lock.
+    uint64_t localCacheFlushes;
+
     /// Table mapping blocks of memory backing Seglets to their owner LogSegment
     /// objects. This allows getOwnerSegment() to look up a LogSegment object
     /// based on a pointer anywhere into ``block'' below.
@@ -45,6 +45,11 @@ TEST_F(SegletAllocatorTest, constructor) {
     EXPECT_EQ(0U, allocator.cleanerPool.size());
     EXPECT_EQ(serverConfig.master.logBytes / serverConfig.segletSize,
         allocator.defaultPool.size());
+    EXPECT_TRUE(allocator.cleanerPoolFull);
+    EXPECT_EQ(serverConfig.segmentSize / serverConfig.segletSize,
+        allocator.localCacheBatch);
+    EXPECT_LE(1U, allocator.numLocalCaches);
+    EXPECT_EQ(0U, allocator.cachedSegletCount);
 }
 
 TEST_F(SegletAllocatorTest, destructor) {
@@ -70,16 +75,107 @@ TEST_F(SegletAllocatorTest, alloc) {
 
     allocator.initializeCleanerReserve(1);
     EXPECT_EQ(1U, allocator.cleanerPool.size());
+    EXPECT_TRUE(allocator.cleanerPoolFull);
     EXPECT_TRUE(allocator.alloc(SegletAllocator::CLEANER, 1, seglets));
     EXPECT_EQ(0U, allocator.cleanerPool.size());
+    EXPECT_FALSE(allocator.cleanerPoolFull);
     EXPECT_FALSE(allocator.alloc(SegletAllocator::CLEANER, 1, seglets));
 
     EXPECT_EQ(318U, allocator.defaultPool.size());
     EXPECT_TRUE(allocator.alloc(SegletAllocator::DEFAULT, 254, seglets));
     EXPECT_EQ(0U, allocator.cleanerPool.size());
+    EXPECT_EQ(64U, allocator.getFreeCount(SegletAllocator::DEFAULT));
 
     foreach (Seglet* s, seglets)
         s->free();
+    EXPECT_EQ(1U, allocator.cleanerPool.size());
+    EXPECT_TRUE(allocator.cleanerPoolFull);
+}
+
+TEST_F(SegletAllocatorTest, alloc_cleanerDrainsLocalCaches) {
+    vector<Seglet*> seglets;
+    allocator.initializeCleanerReserve(2);
+    EXPECT_TRUE(allocator.alloc(SegletAllocator::CLEANER, 2, seglets));
+    EXPECT_FALSE(allocator.cleanerPoolFull);
+
+    // Seglets freed while the reserve was full are stranded in a cache.
+    SegletAllocator::LocalCache& cache = allocator.getLocalCache();
+    allocator.allocFromPool(allocator.defaultPool, 3, cache.seglets);
+    allocator.cachedSegletCount = 3;
+    size_t defaultSeglets = allocator.defaultPool.size();
+
+    EXPECT_TRUE(allocator.alloc(SegletAllocator::CLEANER, 1, seglets));
+    EXPECT_EQ(3U, seglets.size());
+    EXPECT_EQ(1U, allocator.cleanerPool.size());
+    EXPECT_FALSE(allocator.cleanerPoolFull);
+    EXPECT_EQ(0U, cache.seglets.size());
+    EXPECT_EQ(0U, allocator.cachedSegletCount);
+    EXPECT_EQ(defaultSeglets + 1, allocator.defaultPool.size());
+
+    foreach (Seglet* s, seglets)
+        s->free();
+    EXPECT_EQ(2U, allocator.cleanerPool.size());
+    EXPECT_TRUE(allocator.cleanerPoolFull);
+}
+
+TEST_F(SegletAllocatorTest, allocDefault) {
+    vector<Seglet*> seglets;
+    SegletAllocator::LocalCache& cache = allocator.getLocalCache();
+    size_t defaultSeglets = allocator.defaultPool.size();
+
+    // A miss takes an extra batch from the default pool.
+    EXPECT_TRUE(allocator.allocDefault(2, seglets));
+    EXPECT_EQ(2U, seglets.size());
+    EXPECT_EQ(1U, cache.seglets.size());
+    EXPECT_EQ(1U, cache.refills);
+    EXPECT_EQ(0U, cache.allocs);
+    EXPECT_EQ(defaultSeglets - 3, allocator.defaultPool.size());
+    EXPECT_EQ(1U, allocator.cachedSegletCount);
+
+    // A hit doesn't touch the default pool.
+    EXPECT_TRUE(allocator.allocDefault(1, seglets));
+    EXPECT_EQ(3U, seglets.size());
+    EXPECT_EQ(0U, cache.seglets.size());
+    EXPECT_EQ(1U, cache.allocs);
+    EXPECT_EQ(defaultSeglets - 3, allocator.defaultPool.size());
+    EXPECT_EQ(0U, allocator.cachedSegletCount);
+
+    // When the default pool can't cover the shortfall, nothing is taken.
+    uint32_t tooMany = downCast<uint32_t>(defaultSeglets);
+    EXPECT_FALSE(allocator.allocDefault(tooMany, seglets));
+    EXPECT_EQ(3U, seglets.size());
+    EXPECT_EQ(defaultSeglets - 3, allocator.defaultPool.size());
+    EXPECT_EQ(1U, allocator.localCacheFlushes);
+
+    foreach (Seglet* s, seglets)
+        s->free();
+}
+
+TEST_F(SegletAllocatorTest, allocDefault_flushLocalCaches) {
+    vector<Seglet*> seglets;
+    allocator.numLocalCaches = 2;
+    allocator.localCaches.reset(new SegletAllocator::LocalCache[2]);
+    SegletAllocator::LocalCache& cache = allocator.getLocalCache();
+    SegletAllocator::LocalCache& other =
+        allocator.localCaches[(ThreadId::get() + 1) % 2];
+
+    // Strand most seglets in another thread's cache.
+    uint32_t total = downCast<uint32_t>(allocator.defaultPool.size());
+    allocator.allocFromPool(allocator.defaultPool, total - 1, other.seglets);
+    allocator.cachedSegletCount = total - 1;
+    EXPECT_EQ(total, allocator.getFreeCount(SegletAllocator::DEFAULT));
+
+    EXPECT_TRUE(allocator.allocDefault(total, seglets));
+    EXPECT_EQ(total, seglets.size());
+    EXPECT_EQ(0U, cache.seglets.size());
+    EXPECT_EQ(0U, other.seglets.size());
+    EXPECT_EQ(0U, allocator.defaultPool.size());
+    EXPECT_EQ(0U, allocator.cachedSegletCount);
+    EXPECT_EQ(1U, allocator.localCacheFlushes);
+
+    foreach (Seglet* s, seglets)
+        s->free();
+    EXPECT_EQ(total, allocator.getFreeCount(SegletAllocator::DEFAULT));
 }
 
 TEST_F(SegletAllocatorTest, initializeEmergencyHeadReserve) {
@@ -128,12 +224,45 @@ TEST_F(SegletAllocatorTest, free) {
     allocator.emergencyHeadPool.clear();
     seglets[0]->setSourcePool(NULL);
     allocator.cleanerPoolReserve = 1;
+    allocator.cleanerPoolFull = false;
     EXPECT_EQ(0U, allocator.cleanerPool.size());
     allocator.free(seglets[0]);
     EXPECT_EQ(1U, allocator.cleanerPool.size());
+    EXPECT_TRUE(allocator.cleanerPoolFull);
 
-    uint32_t defaultSeglets = downCast<uint32_t>(allocator.defaultPool.size());
+    // With the reserves full, seglets go to the local cache.
+    SegletAllocator::LocalCache& cache = allocator.getLocalCache();
+    allocator.localCacheBatch = 4;
+    size_t cached = cache.seglets.size();
+    size_t defaultSeglets = allocator.defaultPool.size();
+    size_t freeSeglets = allocator.getFreeCount(SegletAllocator::DEFAULT);
     allocator.free(seglets[1]);
+    EXPECT_EQ(cached + 1, cache.seglets.size());
+    EXPECT_EQ(cached + 1, allocator.cachedSegletCount);
+    EXPECT_EQ(defaultSeglets, allocator.defaultPool.size());
+    EXPECT_EQ(freeSeglets + 1,
+              allocator.getFreeCount(SegletAllocator::DEFAULT));
+    EXPECT_EQ(0U, cache.spills);
+}
+
+TEST_F(SegletAllocatorTest, spillLocalCache) {
+    vector<Seglet*> seglets;
+    EXPECT_TRUE(allocator.allocFromPool(allocator.defaultPool, 3, seglets));
+    SegletAllocator::LocalCache& cache = allocator.getLocalCache();
+
+    // Spilled seglets refill the cleaner's reserve before the default pool.
+    allocator.cleanerPoolReserve = 1;
+    allocator.cleanerPoolFull = false;
+    size_t defaultSeglets = allocator.defaultPool.size();
+    cache.seglets = seglets;
+    allocator.cachedSegletCount = 3;
+    allocator.localCacheBatch = 2;
+    allocator.spillLocalCache(cache);
+    EXPECT_EQ(1U, cache.seglets.size());
+    EXPECT_EQ(1U, allocator.cachedSegletCount);
+    EXPECT_EQ(1U, cache.spills);
+    EXPECT_EQ(1U, allocator.cleanerPool.size());
+    EXPECT_TRUE(allocator.cleanerPoolFull);
     EXPECT_EQ(defaultSeglets + 1, allocator.defaultPool.size());
 }
 
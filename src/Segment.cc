@@ -19,12 +19,15 @@
 #include "CycleCounter.h"
 #include "Segment.h"
 #include "LogSegment.h"
+#include "LzCodec.h"
 #include "ShortMacros.h"
 #include "LogEntryTypes.h"
 #include "TestLog.h"
 
 namespace RAMCloud {
 
+Segment::DecompressionMetrics Segment::decompressionMetrics;
+
 static bool
 segletLessThan(const Seglet* a, const Seglet* b)
 {
@@ -320,6 +323,59 @@ Segment::append(const void* buffer,
     return true;
 }
 
+/**
+ * Append a typed entry to this segment, compressing its contents if that
+ * saves space. This is used by the log cleaner to shrink entries that have
+ * not been modified for a long time; it is too slow for the log head.
+ *
+ * A compressed entry is stored as a LOG_ENTRY_TYPE_COMPRESSED entry wrapping
+ * a CompressedEntryHeader and the compressed contents. getEntry() and
+ * SegmentIterator unwrap it transparently, so readers see the original type
+ * and contents. Entries that don't compress are appended unchanged, so the
+ * entry never takes more space than append() would have used.
+ *
+ * \param type
+ *      Type of the entry. See LogEntryTypes.h.
+ * \param buffer
+ *      Buffer object describing the entry to be appended.
+ * \param[out] outReference
+ *      If the append was successful, a Segment::Reference pointing to the new
+ *      entry is returned here.
+ * \return
+ *      True if the append succeeded, false if there was insufficient space to
+ *      complete the operation.
+ */
+bool
+Segment::appendCompressed(LogEntryType type,
+                          Buffer& buffer,
+                          Reference* outReference)
+{
+    uint32_t length = buffer.size();
+    uint32_t headerLength = sizeof32(CompressedEntryHeader);
+    if (length <= headerLength + 1)
+        return append(type, buffer, outReference);
+
+    // Leave room for strictly less output than input, so that a compressed
+    // entry is always smaller than the original.
+    Buffer compressed;
+    uint8_t* data = static_cast<uint8_t*>(compressed.alloc(length));
+    uint32_t compressedLength = LzCodec::compress(buffer.getRange(0, length),
+                                                  length,
+                                                  data + headerLength,
+                                                  length - headerLength - 1);
+    if (compressedLength == 0)
+        return append(type, buffer, outReference);
+
+    CompressedEntryHeader header;
+    header.type = downCast<uint8_t>(type);
+    header.length = length;
+    memcpy(data, &header, headerLength);
+    return append(LOG_ENTRY_TYPE_COMPRESSED,
+                  data,
+                  headerLength + compressedLength,
+                  outReference);
+}
+
 /**
  * Adds a log entry header to a buffer. The size of the header is
  * determined by the object size for which this header is to be
@@ -493,15 +549,25 @@ Segment::getEntry(uint32_t offset, Buffer* buffer, uint32_t* lengthWithMetadata)
     copyOut(offset + sizeof32(header), &entryDataLength,
         header.getLengthBytes());
 
-    if (buffer != NULL)
-        appendToBuffer(*buffer, entryDataOffset, entryDataLength);
-
+    // The length returned always describes the entry as stored, since
+    // callers use it to account for space in the segment.
     if (lengthWithMetadata != NULL) {
         *lengthWithMetadata = entryDataLength +
                               sizeof32(header) +
                               header.getLengthBytes();
     }
 
+    if (expect_false(header.getType() == LOG_ENTRY_TYPE_COMPRESSED)) {
+        Buffer compressed;
+        appendToBuffer(compressed, entryDataOffset, entryDataLength);
+        return decompressEntry(compressed.getRange(0, entryDataLength),
+                               entryDataLength,
+                               buffer);
+    }
+
+    if (buffer != NULL)
+        appendToBuffer(*buffer, entryDataOffset, entryDataLength);
+
     return header.getType();
 }
 
@@ -851,6 +917,47 @@ Segment::copyOut(uint32_t offset, void* buffer, uint32_t length) const
  * PRIVATE METHODS
  ******************************************************************************/
 
+/**
+ * Unwrap a LOG_ENTRY_TYPE_COMPRESSED entry written by appendCompressed().
+ *
+ * \param data
+ *      The compressed entry's contents, which must be contiguous.
+ * \param length
+ *      Number of bytes at data.
+ * \param buffer
+ *      If non-NULL, the original entry's contents are decompressed and
+ *      appended to this buffer (in a single contiguous chunk).
+ * \return
+ *      The original entry's type.
+ */
+LogEntryType
+Segment::decompressEntry(const void* data, uint32_t length, Buffer* buffer)
+{
+    CompressedEntryHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (buffer == NULL)
+        return static_cast<LogEntryType>(header.type);
+
+    uint64_t ticks = 0;
+    {
+        CycleCounter<uint64_t> _(&ticks);
+        void* contents = buffer->alloc(header.length);
+        if (!LzCodec::decompress(static_cast<const uint8_t*>(data) +
+                                    sizeof(header),
+                                 length - sizeof32(header),
+                                 contents,
+                                 header.length)) {
+            DIE("corrupt compressed log entry (type %u, %u bytes compressed, "
+                "%u bytes uncompressed)", header.type, length, header.length);
+        }
+    }
+    decompressionMetrics.totalEntries.fetch_add(1, std::memory_order_relaxed);
+    decompressionMetrics.totalBytes.fetch_add(header.length,
+                                              std::memory_order_relaxed);
+    decompressionMetrics.totalTicks.fetch_add(ticks, std::memory_order_relaxed);
+    return static_cast<LogEntryType>(header.type);
+}
+
 /**
  * Return a copy of the EntryHeader structure within the segment at the given
  * offset. Since that structure is only one byte long, we need not worry about
@@ -991,6 +1098,13 @@ Segment::Reference::getEntry(SegletAllocator* allocator,
         uint32_t fullLength = fullHeaderLength + dataLength;
         if (expect_true(offset + fullLength <= segletSize)) {
             // The entry is contiguous.
+            if (lengthWithMetadata != NULL)
+                *lengthWithMetadata = fullLength;
+            if (expect_false(header->getType() == LOG_ENTRY_TYPE_COMPRESSED)) {
+                return decompressEntry(
+                    reinterpret_cast<void*>(reference + fullHeaderLength),
+                    dataLength, buffer);
+            }
             if (buffer != NULL) {
                 if (fullLength < 300)
                     prefetch(
@@ -1000,8 +1114,6 @@ Segment::Reference::getEntry(SegletAllocator* allocator,
                     reinterpret_cast<void*>(reference + fullHeaderLength),
                     dataLength);
             }
-            if (lengthWithMetadata != NULL)
-                *lengthWithMetadata = fullLength;
             return header->getType();
         }
     }
@@ -194,6 +194,22 @@ class Segment {
     static_assert(sizeof(EntryHeader) == 1,
                   "Unexpected padding in Segment::EntryHeader");
 
+    /**
+     * The contents of every LOG_ENTRY_TYPE_COMPRESSED entry begin with this
+     * header, which describes the entry that was compressed. The rest of the
+     * contents are the original entry's contents compressed with LzCodec.
+     * See appendCompressed().
+     */
+    struct CompressedEntryHeader {
+        /// Type of the original entry (a LogEntryType).
+        uint8_t type;
+
+        /// Length of the original entry's contents before compression.
+        uint32_t length;
+    } __attribute__((__packed__));
+    static_assert(sizeof(CompressedEntryHeader) == 5,
+                  "Unexpected padding in Segment::CompressedEntryHeader");
+
   public:
     /**
      * Segment References are handles used to access entries that have been
@@ -246,6 +262,22 @@ class Segment {
                               Buffer* buffer,
                               uint32_t* lengthWithMetadata = NULL);
 
+        /**
+         * Start loading the beginning of the referenced entry into the
+         * processor's caches, in anticipation of a call to getEntry().
+         *
+         * \param bytes
+         *      How many bytes of the entry (including its header) to load.
+         *      The default covers the header, keys, and value of small
+         *      objects.
+         */
+        void
+        prefetchEntry(uint32_t bytes = 128) const
+        {
+            RAMCloud::prefetch(reinterpret_cast<const void*>(reference),
+                               bytes);
+        }
+
         /**
          * Compare references for equality. Returns true if equal, else false.
          */
@@ -268,6 +300,32 @@ class Segment {
         uint64_t reference;
     };
 
+    /**
+     * Counters describing reads of compressed entries, so that the memory
+     * saved by compressing cold data can be weighed against the extra read
+     * latency it costs. They are shared by all segments; compressed entries
+     * are cold by construction, so updates should rarely contend.
+     */
+    struct DecompressionMetrics {
+        DecompressionMetrics()
+            : totalEntries(0),
+              totalBytes(0),
+              totalTicks(0)
+        {
+        }
+
+        /// Number of compressed entries decompressed to be read.
+        std::atomic<uint64_t> totalEntries;
+
+        /// Total length of those entries after decompression.
+        std::atomic<uint64_t> totalBytes;
+
+        /// Total number of cpu cycles spent decompressing them.
+        std::atomic<uint64_t> totalTicks;
+    };
+
+    static DecompressionMetrics decompressionMetrics;
+
     Segment();
     Segment(const vector<Seglet*>& seglets, uint32_t segletSize);
     Segment(const void* buffer, uint32_t length);
@@ -285,6 +343,9 @@ class Segment {
                 uint32_t* entryDataLength = NULL,
                 LogEntryType *type = NULL,
                 Reference* outReference = NULL);
+    bool appendCompressed(LogEntryType type,
+                          Buffer& buffer,
+                          Reference* outReference = NULL);
     static void appendLogHeader(LogEntryType type,
                                 uint32_t objectSize,
                                 Buffer *logBuffer);
@@ -378,6 +439,9 @@ class Segment {
     std::atomic<bool> closedCommitted;
 
   PRIVATE:
+    static LogEntryType decompressEntry(const void* data,
+                                        uint32_t length,
+                                        Buffer* buffer);
     EntryHeader getEntryHeader(uint32_t offset);
     uint32_t copyIn(uint32_t offset, const void* buffer, uint32_t length);
     uint32_t copyInFromBuffer(uint32_t segmentOffset,
@@ -45,7 +45,8 @@ SegmentIterator::SegmentIterator(Segment& segment)
       currentOffset(0),
       offsetLimit(),
       currentHeader(segment.getEntryHeader(0)),
-      currentLength()
+      currentLength(),
+      decompressed()
 {
     offsetLimit = segment.getAppendedLength(&certificate);
 }
@@ -84,7 +85,8 @@ SegmentIterator::SegmentIterator(const void *buffer, uint32_t length,
       currentOffset(0),
       offsetLimit(certificate.segmentLength),
       currentHeader(),
-      currentLength()
+      currentLength(),
+      decompressed()
 {
     wrapperSegment.construct(buffer, length);
     segment = &*wrapperSegment;
@@ -101,7 +103,8 @@ SegmentIterator::SegmentIterator(const SegmentIterator& other)
       currentOffset(other.currentOffset),
       offsetLimit(other.offsetLimit),
       currentHeader(other.currentHeader),
-      currentLength(other.currentLength)
+      currentLength(other.currentLength),
+      decompressed()
 {
     if (other.wrapperSegment) {
         wrapperSegment.construct(buffer, length);
@@ -122,6 +125,7 @@ SegmentIterator::operator=(const SegmentIterator& other)
     offsetLimit = other.offsetLimit;
     currentHeader = other.currentHeader;
     currentLength = other.currentLength;
+    decompressed.destroy();
     if (other.wrapperSegment) {
         wrapperSegment.construct(buffer, length);
         segment = wrapperSegment.get();
@@ -150,7 +154,7 @@ SegmentIterator::next()
 
     currentOffset += sizeof32(currentHeader) +
                      currentHeader.getLengthBytes() +
-                     getLength();
+                     getRawLength();
 
     // Check again, since we may have just moved on from the last entry in the
     // segment.
@@ -160,6 +164,7 @@ SegmentIterator::next()
         currentHeader = segment->getEntryHeader(currentOffset);
 
     currentLength.destroy();
+    decompressed.destroy();
 }
 
 /**
@@ -169,15 +174,41 @@ SegmentIterator::next()
 LogEntryType
 SegmentIterator::getType()
 {
-    return currentHeader.getType();
+    LogEntryType type = currentHeader.getType();
+    if (expect_false(type == LOG_ENTRY_TYPE_COMPRESSED)) {
+        Segment::CompressedEntryHeader header;
+        segment->copyOut(currentOffset + sizeof32(currentHeader) +
+                            currentHeader.getLengthBytes(),
+                         &header, sizeof32(header));
+        type = static_cast<LogEntryType>(header.type);
+    }
+    return type;
 }
 
 /**
  * Return the length of the entry currently pointed to by the iterator.
- * If no entry is currently pointed to, returns 0.
+ * If no entry is currently pointed to, returns 0. For compressed entries
+ * this is the length of the original entry's contents.
  */
 uint32_t
 SegmentIterator::getLength()
+{
+    if (expect_false(currentHeader.getType() == LOG_ENTRY_TYPE_COMPRESSED)) {
+        Segment::CompressedEntryHeader header;
+        segment->copyOut(currentOffset + sizeof32(currentHeader) +
+                            currentHeader.getLengthBytes(),
+                         &header, sizeof32(header));
+        return header.length;
+    }
+    return getRawLength();
+}
+
+/**
+ * Return the number of bytes the contents of the current entry occupy in the
+ * segment. This differs from getLength() only for compressed entries.
+ */
+uint32_t
+SegmentIterator::getRawLength()
 {
     if (currentHeader.getType() == LOG_ENTRY_TYPE_INVALID)
         return 0;
@@ -215,6 +246,7 @@ SegmentIterator::setOffset(uint32_t offset)
     currentOffset = offset;
     currentHeader = segment->getEntryHeader(currentOffset);
     currentLength.destroy();
+    decompressed.destroy();
 }
 
 /**
@@ -250,6 +282,14 @@ SegmentIterator::appendToBuffer(Buffer& buffer)
     uint32_t entryOffset = currentOffset +
                            sizeof32(currentHeader) +
                            currentHeader.getLengthBytes();
+    if (expect_false(currentHeader.getType() == LOG_ENTRY_TYPE_COMPRESSED)) {
+        Buffer compressed;
+        uint32_t length = getRawLength();
+        segment->appendToBuffer(compressed, entryOffset, length);
+        Segment::decompressEntry(compressed.getRange(0, length), length,
+                                 &buffer);
+        return buffer.size();
+    }
     segment->appendToBuffer(buffer, entryOffset, getLength());
     return buffer.size();
 }
@@ -265,6 +305,20 @@ SegmentIterator::setBufferTo(Buffer& buffer)
     return appendToBuffer(buffer);
 }
 
+/**
+ * Return a pointer to the decompressed contents of the current entry, which
+ * must be compressed. The contents remain valid until the iterator moves.
+ */
+const void*
+SegmentIterator::getDecompressed()
+{
+    if (!decompressed) {
+        decompressed.construct();
+        appendToBuffer(*decompressed);
+    }
+    return decompressed->getRange(0, decompressed->size());
+}
+
 /**
  * Check the integrity of the segment's metadata by iterating over all entries
  * and ensuring that:
@@ -42,6 +42,9 @@ struct SegmentIteratorException : public Exception {
  * Note that the segments being iterated over must not change while the iterator
  * exists, otherwise behaviour is undefined.
  *
+ * Entries compressed by Segment::appendCompressed are decompressed on access,
+ * so callers always see the original entry's type, length, and contents.
+ *
  * Copy and assignment is defined on SegmentIterators.
  */
 class SegmentIterator {
@@ -121,6 +124,11 @@ class SegmentIterator {
         if (isDone())
             return NULL;
 
+        if (expect_false(currentHeader.getType() ==
+                         LOG_ENTRY_TYPE_COMPRESSED)) {
+            return reinterpret_cast<const T*>(getDecompressed());
+        }
+
         uint32_t entryOffset = currentOffset +
                                sizeof32(currentHeader) +
                                currentHeader.getLengthBytes();
@@ -138,6 +146,9 @@ class SegmentIterator {
     }
 
   PRIVATE:
+    const void* getDecompressed();
+    uint32_t getRawLength();
+
     /// If the constructor was called on a void pointer, we'll create a wrapper
     /// segment to access the data in a common way using segment object calls.
     Tub<Segment> wrapperSegment;
@@ -172,9 +183,15 @@ class SegmentIterator {
     /// Copy of the current log entry's header (the one at currentOffset).
     Segment::EntryHeader currentHeader;
 
-    /// Cache of the length of the entry at currentOffset. Set the first time
-    /// getLength() is called and destroyed when next() is called.
+    /// Cache of the length of the entry at currentOffset as stored in the
+    /// segment. Set the first time getRawLength() is called and destroyed
+    /// when next() is called.
     Tub<uint32_t> currentLength;
+
+    /// If the entry at currentOffset is compressed and getContiguous() has
+    /// been called on it, this holds its decompressed contents. Destroyed
+    /// when next() is called.
+    Tub<Buffer> decompressed;
 };
 
 } // namespace
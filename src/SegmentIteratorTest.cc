@@ -204,6 +204,37 @@ TEST_F(SegmentIteratorTest, appendToBuffer) {
     EXPECT_EQ(0, memcmp("this is the content", buffer.getRange(0, 20), 20));
 }
 
+TEST_F(SegmentIteratorTest, compressedEntry) {
+    string data;
+    for (int i = 0; i < 50; i++)
+        data += "the quick brown fox ";
+    Buffer original;
+    original.appendExternal(data.data(), 1000);
+    EXPECT_TRUE(s.appendCompressed(LOG_ENTRY_TYPE_OBJ, original));
+    EXPECT_TRUE(s.append(LOG_ENTRY_TYPE_OBJTOMB, "hi", 3));
+
+    SegmentIterator it(s);
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, it.getType());
+    EXPECT_EQ(1000U, it.getLength());
+
+    Buffer buffer;
+    it.appendToBuffer(buffer);
+    EXPECT_EQ(1000U, buffer.size());
+    EXPECT_EQ(0, memcmp(data.data(), buffer.getRange(0, 1000), 1000));
+
+    const char* contents = it.getContiguous<char>(NULL, 0);
+    EXPECT_EQ(0, memcmp(data.data(), contents, 1000));
+    EXPECT_EQ(contents, it.getContiguous<char>(NULL, 0));
+
+    // Moving on skips the compressed bytes as stored.
+    it.next();
+    EXPECT_FALSE(it.isDone());
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJTOMB, it.getType());
+    EXPECT_EQ(3U, it.getLength());
+    it.next();
+    EXPECT_TRUE(it.isDone());
+}
+
 TEST_F(SegmentIteratorTest, setBufferTo) {
     s.append(LOG_ENTRY_TYPE_OBJ, "this is the content", 20);
     SegmentIterator it(s);
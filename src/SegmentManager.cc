@@ -29,6 +29,17 @@
 
 namespace RAMCloud {
 
+/**
+ * Return the number of heads the log will have (see AbstractLog::Head),
+ * including the hot head, if any.
+ */
+static uint32_t
+getNumLogHeads(const ServerConfig* config)
+{
+    return std::max(1U, config->master.numLogHeads) +
+           (config->master.segregateHotWrites ? 1U : 0U);
+}
+
 /**
  * Construct a new segment manager.
  *
@@ -71,12 +82,17 @@ SegmentManager::SegmentManager(Context* context,
       freeEmergencyHeadSlots(),
       freeSurvivorSlots(),
       freeSlots(),
-      emergencyHeadSlotsReserved(2),
+      emergencyHeadSlotsReserved(std::max(2U, getNumLogHeads(config) + 1)),
       survivorSlotsReserved(0),
       nextSegmentId(1),
       idToSlotMap(),
       allSegments(),
       segmentsByState(),
+      heads(getNumLogHeads(config), NULL),
+      headOpenMutex(),
+      unsyncedHead(NULL),
+      unsyncedHeadLength(0),
+      unsyncedHeadCertificate(),
       lock("SegmentManager::lock"),
       segmentsOnDisk(0),
       segmentsOnDiskHistogram(maxSegments, 1),
@@ -91,8 +107,11 @@ SegmentManager::SegmentManager(Context* context,
     if (config->master.diskExpansionFactor < 1.0)
         throw SegmentManagerException(HERE, "diskExpansionFactor not >= 1.0");
 
-    if (!allocator.initializeEmergencyHeadReserve(2 * segletsPerSegment))
-        throw SegmentManagerException(HERE, "must have at least two segments");
+    if (!allocator.initializeEmergencyHeadReserve(
+            emergencyHeadSlotsReserved * segletsPerSegment)) {
+        throw SegmentManagerException(HERE, format("must have at least %u "
+            "segments", emergencyHeadSlotsReserved));
+    }
 
     assert(maxSegments >= (allocator.getTotalCount() / segletsPerSegment));
 
@@ -195,6 +214,11 @@ SegmentManager::getAllocator() const
  *      If out of memory and the MUST_NOT_FAIL flag is provided, an emergency
  *      head segment is allocated and returned. Otherwise, NULL is returned
  *      when out of memory and the flag is not provided.
+ * \param headIndex
+ *      Which of the log's heads (see AbstractLog::Head) is being replaced.
+ *      Each head is a separate chain of segments on backups. Must be less
+ *      than ServerConfig::Master::numLogHeads, plus one if the log has a hot
+ *      head.
  *
  * \return
  *      NULL if out of memory, otherwise the new head segment. If NULL is
@@ -202,11 +226,29 @@ SegmentManager::getAllocator() const
  *      as the head of the log.
  */
 LogSegment*
-SegmentManager::allocHeadSegment(uint32_t flags)
+SegmentManager::allocHeadSegment(uint32_t flags, uint32_t headIndex)
 {
+    // ReplicaManager only orders the opening of a head after that of its
+    // predecessor in the same chain. With several heads, the digest of the
+    // new head names the heads of the other chains, which must be open on
+    // backups before it is: otherwise a crash could leave a digest listing
+    // segments that never reached any backup, and recovery would consider
+    // the log incomplete. So before allocating, finish opening the last head
+    // allocated (usually its first Log::sync has done so already). This can
+    // block on backups, so it happens before #lock is taken.
+    std::unique_lock<std::mutex> openGuard(headOpenMutex, std::defer_lock);
+    if (heads.size() > 1) {
+        openGuard.lock();
+        if (unsyncedHead != NULL) {
+            unsyncedHead->replicatedSegment->sync(unsyncedHeadLength,
+                                                  &unsyncedHeadCertificate);
+            unsyncedHead = NULL;
+        }
+    }
+
     SpinLock::Guard _(lock);
 
-    LogSegment* prevHead = getHeadSegment();
+    LogSegment* prevHead = getHeadSegment(headIndex);
     LogSegment* newHead = alloc(ALLOC_HEAD,
                                 nextSegmentId,
                                 WallTime::secondsTimestamp());
@@ -253,6 +295,7 @@ SegmentManager::allocHeadSegment(uint32_t flags)
     newHead->replicatedSegment = replicaManager.allocateHead(
         newHead->id, newHead, prevReplicatedSegment);
     segmentsOnDiskHistogram.storeSample(++segmentsOnDisk);
+    heads[headIndex] = newHead;
 
     // Close the old head after we've opened up the new head. This ensures that
     // we always have an open segment on backups (unless, of course, there is a
@@ -268,6 +311,12 @@ SegmentManager::allocHeadSegment(uint32_t flags)
             changeState(*prevHead, NEWLY_CLEANABLE);
     }
 
+    if (heads.size() > 1 && !newHead->isEmergencyHead) {
+        unsyncedHead = newHead;
+        unsyncedHeadLength =
+            newHead->getAppendedLength(&unsyncedHeadCertificate);
+    }
+
     return newHead;
 }
 
@@ -698,9 +747,12 @@ SegmentManager::allocateVersion() {
  */
 bool
 SegmentManager::raiseSafeVersion(uint64_t minimum) {
-    if (minimum > safeVersion) {
-        safeVersion = minimum;
-        return true;
+    // Compare-and-swap so that concurrent callers (e.g. recovery segments
+    // replayed in parallel) can never lower the safeVersion.
+    uint64_t current = safeVersion;
+    while (minimum > current) {
+        if (safeVersion.compare_exchange_weak(current, minimum))
+            return true;
     }
     return false;
 }
@@ -842,6 +894,11 @@ SegmentManager::writeDigest(LogSegment* newHead, LogSegment* prevHead)
 
     digest.addSegmentId(newHead->id);
 
+    foreach (LogSegment* head, heads) {
+        if (head != NULL && head != prevHead && !head->isEmergencyHead)
+            digest.addConcurrentHead(head->id);
+    }
+
     SegmentList& list = segmentsByState[
         FREEABLE_PENDING_DIGEST_AND_REFERENCES];
     while (!list.empty()) {
@@ -906,17 +963,17 @@ SegmentManager::writeTableStatsDigest(LogSegment* head)
 }
 
 /**
- * Return a pointer to the current head segment. If there is no head segment
- * yet, NULL is returned.
+ * Return a pointer to the current head segment of one of the log's heads. If
+ * there is no head segment yet, NULL is returned.
+ *
+ * \param headIndex
+ *      Which of the log's heads to return the segment of.
  */
 LogSegment*
-SegmentManager::getHeadSegment()
+SegmentManager::getHeadSegment(uint32_t headIndex)
 {
-    if (segmentsByState[HEAD].size() == 0)
-        return NULL;
-
-    assert(segmentsByState[HEAD].size() == 1);
-    return &segmentsByState[HEAD].front();
+    assert(headIndex < heads.size());
+    return heads[headIndex];
 }
 
 /**
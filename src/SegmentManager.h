@@ -23,6 +23,7 @@
 #endif
 
 #include <stdint.h>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -118,7 +119,8 @@ class SegmentManager {
     void getMetrics(ProtoBuf::LogMetrics_SegmentMetrics& m);
     uint32_t getSegmentsOnDisk();
     SegletAllocator& getAllocator() const;
-    LogSegment* allocHeadSegment(uint32_t flags = EMPTY);
+    LogSegment* allocHeadSegment(uint32_t flags = EMPTY,
+                                 uint32_t headIndex = 0);
     LogSegment* allocSideSegment(uint32_t flags = EMPTY,
                                  LogSegment* replacing = NULL);
     void cleaningComplete(LogSegmentVector& clean, LogSegmentVector& survivors);
@@ -265,7 +267,7 @@ class SegmentManager {
     void writeDigest(LogSegment* newHead, LogSegment* prevHead);
     void writeSafeVersion(LogSegment* head);
     void writeTableStatsDigest(LogSegment* head);
-    LogSegment* getHeadSegment();
+    LogSegment* getHeadSegment(uint32_t headIndex = 0);
     void changeState(LogSegment& s, State newState);
     void addToLists(LogSegment& s);
     void removeFromLists(LogSegment& s);
@@ -353,6 +355,29 @@ class SegmentManager {
     /// segment is present in exactly one of these lists at any given time.
     SegmentList segmentsByState[TOTAL_STATES];
 
+    /// The current head segment of each of the log's heads (see
+    /// AbstractLog::Head), indexed by head number. NULL until the first
+    /// call to allocHeadSegment() for that head. Each of these segments is
+    /// also in segmentsByState[HEAD].
+    vector<LogSegment*> heads;
+
+    /// Serializes the allocation of heads when the log has several of them,
+    /// so that each head is open on backups before the next is allocated
+    /// (see allocHeadSegment()). Unlike #lock, this may be held while
+    /// waiting for backups.
+    std::mutex headOpenMutex;
+
+    /// With several heads, the last head allocated if its header, digest and
+    /// other opening entries may not yet be durable on backups; NULL
+    /// otherwise. The next call to allocHeadSegment() makes them durable
+    /// before allocating. Protected by #headOpenMutex.
+    LogSegment* unsyncedHead;
+
+    /// Length of the opening entries of #unsyncedHead and the certificate
+    /// covering them.
+    uint32_t unsyncedHeadLength;
+    SegmentCertificate unsyncedHeadCertificate;
+
     /// Monitor lock protecting the SegmentManager from multiple calling
     /// threads. At a minimum, the log and log cleaner modules may operate
     /// simultaneously.
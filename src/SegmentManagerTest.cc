@@ -434,6 +434,48 @@ TEST_F(SegmentManagerTest, getHeadSegment) {
         segmentManager.getHeadSegment());
 }
 
+TEST_F(SegmentManagerTest, allocHeadSegment_multipleHeads) {
+    serverConfig.master.numLogHeads = 2;
+    SegletAllocator allocator2(&serverConfig);
+    SegmentManager mgr(&context, &serverConfig, &serverId, allocator2,
+                       replicaManager, &masterTableMetadata);
+    EXPECT_EQ(3U, allocator2.getFreeCount(SegletAllocator::EMERGENCY_HEAD));
+
+    LogSegment* first = mgr.allocHeadSegment(SegmentManager::EMPTY, 0);
+    LogSegment* second = mgr.allocHeadSegment(SegmentManager::EMPTY, 1);
+    EXPECT_EQ(second, mgr.unsyncedHead);
+    TestLog::Enable _("sync");
+    LogSegment* third = mgr.allocHeadSegment(SegmentManager::EMPTY, 0);
+    EXPECT_EQ(third, mgr.getHeadSegment(0));
+    EXPECT_EQ(second, mgr.getHeadSegment(1));
+    EXPECT_TRUE(first->closed);
+    EXPECT_FALSE(second->closed);
+    EXPECT_EQ(2U, mgr.segmentsByState[SegmentManager::HEAD].size());
+
+    // The open of each head is synced before the next head is allocated.
+    EXPECT_EQ(format("sync: syncing segment %lu to offset %u",
+                     second->id, second->getAppendedLength()),
+              TestLog::get());
+    EXPECT_EQ(third, mgr.unsyncedHead);
+    EXPECT_EQ(third->getAppendedLength(), mgr.unsyncedHeadLength);
+
+    for (SegmentIterator it(*third); !it.isDone(); it.next()) {
+        if (it.getType() != LOG_ENTRY_TYPE_LOGDIGEST)
+            continue;
+
+        Buffer buffer;
+        it.appendToBuffer(buffer);
+        LogDigest digest(buffer.getRange(0, buffer.size()),
+                         buffer.size());
+        EXPECT_EQ(3U, digest.size());
+        EXPECT_EQ(first->id, digest[0]);
+        EXPECT_EQ(third->id, digest[1]);
+        EXPECT_EQ(second->id, digest[2]);
+        EXPECT_FALSE(digest.isConcurrentHead(1));
+        EXPECT_TRUE(digest.isConcurrentHead(2));
+    }
+}
+
 TEST_F(SegmentManagerTest, changeState) {
     LogSegment* s = segmentManager.allocHeadSegment();
     EXPECT_EQ(SegmentManager::HEAD, segmentManager.states[s->slot]);
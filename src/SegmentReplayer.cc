@@ -0,0 +1,223 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "SegmentReplayer.h"
+#include "SegmentIterator.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct a SegmentReplayer and start its threads.
+ *
+ * \param objectManager
+ *      The ObjectManager that segments will be replayed into.
+ * \param numThreads
+ *      Number of threads to replay segments on. Must be at least 1.
+ * \param nextNodeIdMap
+ *      If non-NULL, the map to pass to ObjectManager::replaySegment() for
+ *      tracking B+ tree node ids. Each thread works on a copy; the copies
+ *      are merged back into this map by sync().
+ */
+SegmentReplayer::SegmentReplayer(ObjectManager* objectManager,
+        uint32_t numThreads,
+        std::unordered_map<uint64_t, uint64_t>* nextNodeIdMap)
+    : objectManager(objectManager)
+    , nextNodeIdMap(nextNodeIdMap)
+    , workers()
+    , mutex()
+    , jobs()
+    , jobsAvailable()
+    , outstandingJobs(0)
+    , allJobsDone()
+    , completions()
+    , exiting(false)
+{
+    assert(numThreads > 0);
+    for (uint32_t i = 0; i < numThreads; i++) {
+        Worker* worker = new Worker(objectManager, nextNodeIdMap);
+        workers.push_back(worker);
+        worker->thread.construct(replayThreadEntry, this, worker);
+    }
+}
+
+/**
+ * Stop the replay threads. Any segments still queued are discarded, and
+ * anything not yet committed is aborted when the SideLogs are destroyed.
+ */
+SegmentReplayer::~SegmentReplayer()
+{
+    {
+        Lock lock(mutex);
+        exiting = true;
+        jobsAvailable.notify_all();
+    }
+    foreach (Worker* worker, workers) {
+        worker->thread->join();
+        delete worker;
+    }
+    foreach (Job& job, jobs)
+        delete job.segment;
+}
+
+/**
+ * Queue a segment to be replayed by the next idle thread. Returns without
+ * waiting for the replay.
+ *
+ * \param segment
+ *      Buffer holding the segment's contents. The replayer takes ownership
+ *      of it and deletes it once the segment has been replayed. The caller
+ *      should already have checked the segment's metadata (see
+ *      SegmentIterator::checkMetadataIntegrity()).
+ * \param certificate
+ *      Certificate for the segment in \a segment.
+ * \param segmentId
+ *      Id of the segment; getCompleted() returns it once the segment has
+ *      been replayed.
+ */
+void
+SegmentReplayer::replay(Buffer* segment,
+        const SegmentCertificate& certificate, uint64_t segmentId)
+{
+    Lock lock(mutex);
+    jobs.emplace_back(segment, certificate, segmentId);
+    outstandingJobs++;
+    jobsAvailable.notify_one();
+}
+
+/**
+ * Return the outcome of a segment whose replay has finished, without
+ * waiting. Each segment passed to replay() is returned exactly once, either
+ * here or (if it failed) by sync().
+ *
+ * \param[out] segmentId
+ *      Set to the id of the segment, as passed to replay().
+ * \param[out] failure
+ *      Set to the exception that replaying the segment threw, or to an empty
+ *      exception_ptr if the replay succeeded. Anything the failed replay
+ *      appended is harmless, so the caller may replay the segment again
+ *      (e.g. from another backup's replica).
+ * \return
+ *      False if no replay has finished since the last call, in which case
+ *      neither argument is modified.
+ */
+bool
+SegmentReplayer::getCompleted(uint64_t* segmentId, std::exception_ptr* failure)
+{
+    Lock lock(mutex);
+    if (completions.empty())
+        return false;
+    *segmentId = completions.front().segmentId;
+    *failure = completions.front().failure;
+    completions.pop_front();
+    return true;
+}
+
+/**
+ * Wait until every segment passed to replay() has been replayed, then
+ * merge each thread's B+ tree node ids into the caller's nextNodeIdMap.
+ *
+ * \throw
+ *      Whatever exception replaying a segment threw first, among those
+ *      not already returned by getCompleted().
+ */
+void
+SegmentReplayer::sync()
+{
+    Lock lock(mutex);
+    while (outstandingJobs > 0)
+        allJobsDone.wait(lock);
+
+    std::exception_ptr failure;
+    foreach (Completion& completion, completions) {
+        if (!failure)
+            failure = completion.failure;
+    }
+    completions.clear();
+    if (failure)
+        std::rethrow_exception(failure);
+
+    if (nextNodeIdMap == NULL)
+        return;
+    foreach (Worker* worker, workers) {
+        foreach (auto& entry, worker->nextNodeIdMap) {
+            uint64_t& nextNodeId = (*nextNodeIdMap)[entry.first];
+            nextNodeId = std::max(nextNodeId, entry.second);
+        }
+    }
+}
+
+/**
+ * Wait for all queued segments to be replayed and then commit each
+ * thread's SideLog, making everything replayed durable and part of the
+ * log.
+ *
+ * \throw
+ *      Whatever exception sync() throws. Nothing is committed in that case.
+ */
+void
+SegmentReplayer::commit()
+{
+    sync();
+    foreach (Worker* worker, workers)
+        worker->sideLog.commit();
+}
+
+/**
+ * Main loop of each replay thread: replay queued segments into the
+ * thread's own SideLog until the SegmentReplayer is destroyed.
+ *
+ * \param replayer
+ *      The SegmentReplayer this thread belongs to.
+ * \param worker
+ *      This thread's private state.
+ */
+void
+SegmentReplayer::replayThreadEntry(SegmentReplayer* replayer, Worker* worker)
+{
+    Lock lock(replayer->mutex);
+    while (true) {
+        while (replayer->jobs.empty() && !replayer->exiting)
+            replayer->jobsAvailable.wait(lock);
+        if (replayer->exiting)
+            return;
+
+        Job job = replayer->jobs.front();
+        replayer->jobs.pop_front();
+        lock.unlock();
+
+        std::exception_ptr failure;
+        try {
+            uint32_t length = job.segment->size();
+            SegmentIterator it(job.segment->getRange(0, length), length,
+                    job.certificate);
+            replayer->objectManager->replaySegment(&worker->sideLog, it,
+                    replayer->nextNodeIdMap != NULL ?
+                    &worker->nextNodeIdMap : NULL);
+            TEST_LOG("Segment %lu replay complete", job.segmentId);
+        } catch (...) {
+            LOG(WARNING, "Replay of segment %lu failed", job.segmentId);
+            failure = std::current_exception();
+        }
+        delete job.segment;
+
+        lock.lock();
+        replayer->completions.emplace_back(job.segmentId, failure);
+        if (--replayer->outstandingJobs == 0)
+            replayer->allJobsDone.notify_all();
+    }
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,177 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_SEGMENTREPLAYER_H
+#define RAMCLOUD_SEGMENTREPLAYER_H
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "Common.h"
+#include "Buffer.h"
+#include "ObjectManager.h"
+#include "SideLog.h"
+#include "Segment.h"
+
+namespace RAMCloud {
+
+/**
+ * Replays recovery segments into an ObjectManager on a pool of threads, so
+ * that a recovery master can use all of its cores rather than replaying one
+ * segment at a time in the thread that fetches them.
+ *
+ * Each thread appends to its own SideLog, so threads never contend for an
+ * append lock. Conflicting updates to the same key are resolved by
+ * ObjectManager::replaySegment() under the hash table bucket locks, which
+ * already tolerates segments being replayed in any order. Nothing replayed
+ * becomes part of the log until commit() is called.
+ *
+ * The outcome of each segment's replay can be collected with getCompleted(),
+ * so that a segment whose replay failed can be fetched again from another
+ * backup, just as when segments are replayed one at a time.
+ *
+ * The caller must hold an ObjectManager::TombstoneProtector from before the
+ * first call to replay() until commit() returns.
+ *
+ * This class is thread-safe, but is meant to be driven by a single thread.
+ */
+class SegmentReplayer {
+  public:
+    SegmentReplayer(ObjectManager* objectManager, uint32_t numThreads,
+            std::unordered_map<uint64_t, uint64_t>* nextNodeIdMap = NULL);
+    ~SegmentReplayer();
+    void replay(Buffer* segment, const SegmentCertificate& certificate,
+            uint64_t segmentId);
+    bool getCompleted(uint64_t* segmentId, std::exception_ptr* failure);
+    void sync();
+    void commit();
+
+  PRIVATE:
+    /**
+     * A segment waiting to be replayed.
+     */
+    struct Job {
+        Job(Buffer* segment, const SegmentCertificate& certificate,
+                uint64_t segmentId)
+            : segment(segment)
+            , certificate(certificate)
+            , segmentId(segmentId)
+        {
+        }
+
+        /// Contents of the segment. Owned by the job; the thread that
+        /// replays it frees it.
+        Buffer* segment;
+
+        /// Certificate needed to iterate over #segment.
+        SegmentCertificate certificate;
+
+        /// Id of the segment; passed back by getCompleted().
+        uint64_t segmentId;
+    };
+
+    /**
+     * The outcome of replaying a segment, waiting to be collected by
+     * getCompleted() or sync().
+     */
+    struct Completion {
+        Completion(uint64_t segmentId, std::exception_ptr failure)
+            : segmentId(segmentId)
+            , failure(failure)
+        {
+        }
+
+        /// Id of the segment that was replayed.
+        uint64_t segmentId;
+
+        /// The exception its replay threw, or empty if it succeeded.
+        std::exception_ptr failure;
+    };
+
+    /**
+     * State private to each replay thread.
+     */
+    struct Worker {
+        Worker(ObjectManager* objectManager,
+                std::unordered_map<uint64_t, uint64_t>* nextNodeIdMap)
+            : sideLog(objectManager->getLog())
+            , nextNodeIdMap()
+            , thread()
+        {
+            if (nextNodeIdMap != NULL)
+                this->nextNodeIdMap = *nextNodeIdMap;
+        }
+
+        /// Every entry this thread replays is appended here.
+        SideLog sideLog;
+
+        /// This thread's copy of the caller's nextNodeIdMap. Copies are
+        /// merged into the caller's by sync().
+        std::unordered_map<uint64_t, uint64_t> nextNodeIdMap;
+
+        /// The thread itself.
+        Tub<std::thread> thread;
+
+        DISALLOW_COPY_AND_ASSIGN(Worker);
+    };
+
+    static void replayThreadEntry(SegmentReplayer* replayer, Worker* worker);
+
+    typedef std::unique_lock<std::mutex> Lock;
+
+    /// Segments are replayed into this ObjectManager.
+    ObjectManager* objectManager;
+
+    /// Caller's map of the highest B+ tree node ids seen in each indexlet
+    /// backing table (see ObjectManager::replaySegment). NULL if the caller
+    /// doesn't need it.
+    std::unordered_map<uint64_t, uint64_t>* nextNodeIdMap;
+
+    /// One entry for each replay thread.
+    vector<Worker*> workers;
+
+    /// Protects all of the fields below.
+    std::mutex mutex;
+
+    /// Segments queued by replay() that no thread has started on yet.
+    std::deque<Job> jobs;
+
+    /// Signaled when #jobs becomes non-empty or #exiting is set.
+    std::condition_variable jobsAvailable;
+
+    /// Number of segments that have been queued but whose replay has not
+    /// finished.
+    uint32_t outstandingJobs;
+
+    /// Signaled when #outstandingJobs drops to zero.
+    std::condition_variable allJobsDone;
+
+    /// Segments whose replay has finished, in order of completion, that
+    /// haven't yet been returned by getCompleted().
+    std::deque<Completion> completions;
+
+    /// Set by the destructor to tell replay threads to exit.
+    bool exiting;
+
+    DISALLOW_COPY_AND_ASSIGN(SegmentReplayer);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_SEGMENTREPLAYER_H
@@ -0,0 +1,198 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "ClientLeaseValidator.h"
+#include "ClusterClock.h"
+#include "ObjectManager.h"
+#include "SegmentReplayer.h"
+
+namespace RAMCloud {
+
+class SegmentReplayerTest : public ::testing::Test,
+                            public AbstractLog::ReferenceFreer {
+  public:
+    Context context;
+    ClusterClock clusterClock;
+    ClientLeaseValidator clientLeaseValidator;
+    ServerId serverId;
+    ServerList serverList;
+    ServerConfig masterConfig;
+    MasterTableMetadata masterTableMetadata;
+    ObjectManager objectManager;
+    UnackedRpcResults unackedRpcResults;
+    TransactionManager transactionManager;
+    TxRecoveryManager txRecoveryManager;
+    TabletManager tabletManager;
+
+    SegmentReplayerTest()
+        : context()
+        , clusterClock()
+        , clientLeaseValidator(&context, &clusterClock)
+        , serverId(5)
+        , serverList(&context)
+        , masterConfig(ServerConfig::forTesting())
+        , masterTableMetadata()
+        , objectManager(&context,
+                        &serverId,
+                        &masterConfig,
+                        &tabletManager,
+                        &masterTableMetadata,
+                        &unackedRpcResults,
+                        &transactionManager,
+                        &txRecoveryManager)
+        , unackedRpcResults(&context,
+                            this,
+                            &clientLeaseValidator,
+                            &tabletManager)
+        , transactionManager(&context,
+                             objectManager.getLog(),
+                             &unackedRpcResults,
+                             &tabletManager)
+        , txRecoveryManager(&context)
+        , tabletManager()
+    {
+        objectManager.initOnceEnlisted();
+        tabletManager.addTablet(0, 0, ~0UL, TabletManager::NORMAL);
+        tabletManager.addTablet(7, 0, ~0UL, TabletManager::NORMAL);
+    }
+
+    /**
+     * Build a recovery segment holding a single object, in a Buffer of the
+     * kind SegmentReplayer::replay() takes ownership of.
+     */
+    Buffer*
+    buildSegment(Key& key, uint64_t version, string contents,
+            SegmentCertificate* certificate)
+    {
+        Segment s;
+        Buffer dataBuffer;
+        Object object(key, contents.c_str(),
+                downCast<uint32_t>(contents.length()) + 1, version, 0,
+                dataBuffer);
+        Buffer objectBuffer;
+        object.assembleForLog(objectBuffer);
+        EXPECT_TRUE(s.append(LOG_ENTRY_TYPE_OBJ, objectBuffer));
+        s.close();
+        s.getAppendedLength(certificate);
+
+        Buffer contentsBuffer;
+        s.appendToBuffer(contentsBuffer);
+        Buffer* segment = new Buffer();
+        segment->appendCopy(contentsBuffer.getRange(0, contentsBuffer.size()),
+                contentsBuffer.size());
+        return segment;
+    }
+
+    /**
+     * Return the value of the object the hash table holds for the given key,
+     * or "not found".
+     */
+    string
+    readObject(Key& key)
+    {
+        Buffer buffer;
+        LogEntryType type;
+        ObjectManager::HashTableBucketLock lock(objectManager, key);
+        if (!objectManager.lookup(lock, key, type, buffer) ||
+                type != LOG_ENTRY_TYPE_OBJ)
+            return "not found";
+        Object object(buffer);
+        Buffer value;
+        object.appendValueToBuffer(&value);
+        return value.getStart<const char>();
+    }
+
+    void freeLogEntry(Log::Reference ref) {}
+
+    DISALLOW_COPY_AND_ASSIGN(SegmentReplayerTest);
+};
+
+TEST_F(SegmentReplayerTest, replay_newestVersionWins) {
+    ObjectManager::TombstoneProtector p(&objectManager);
+    Key key0(0, "key0", 4);
+    Key key1(0, "key1", 4);
+    SegmentCertificate certificate;
+    {
+        SegmentReplayer replayer(&objectManager, 3);
+        // Queue versions out of order; whichever thread gets them, the
+        // newest version of each key has to end up in the hash table.
+        for (uint64_t version : {3UL, 9UL, 1UL, 7UL, 5UL, 2UL, 8UL}) {
+            replayer.replay(buildSegment(key0, version,
+                    format("key0 v%lu", version), &certificate),
+                    certificate, version);
+            replayer.replay(buildSegment(key1, 10 - version,
+                    format("key1 v%lu", 10 - version), &certificate),
+                    certificate, 100 + version);
+        }
+        replayer.commit();
+    }
+    EXPECT_EQ("key0 v9", readObject(key0));
+    EXPECT_EQ("key1 v9", readObject(key1));
+}
+
+TEST_F(SegmentReplayerTest, getCompleted) {
+    ObjectManager::TombstoneProtector p(&objectManager);
+    Key key(0, "key0", 4);
+    SegmentCertificate certificate;
+    SegmentReplayer replayer(&objectManager, 2);
+    uint64_t segmentId = 0;
+    std::exception_ptr failure;
+    EXPECT_FALSE(replayer.getCompleted(&segmentId, &failure));
+
+    replayer.replay(buildSegment(key, 1, "v1", &certificate), certificate, 88);
+    replayer.sync();
+    EXPECT_FALSE(replayer.getCompleted(&segmentId, &failure));
+
+    replayer.replay(buildSegment(key, 2, "v2", &certificate), certificate, 89);
+    while (!replayer.getCompleted(&segmentId, &failure))
+        std::this_thread::yield();
+    EXPECT_EQ(89U, segmentId);
+    EXPECT_FALSE(failure);
+
+    // A failure collected by getCompleted isn't rethrown by sync.
+    replayer.completions.emplace_back(90,
+            std::make_exception_ptr(SegmentIteratorException(HERE, "corrupt")));
+    EXPECT_TRUE(replayer.getCompleted(&segmentId, &failure));
+    EXPECT_EQ(90U, segmentId);
+    EXPECT_TRUE(failure);
+    EXPECT_NO_THROW(replayer.sync());
+
+    // Otherwise sync rethrows it.
+    replayer.completions.emplace_back(91,
+            std::make_exception_ptr(SegmentIteratorException(HERE, "corrupt")));
+    EXPECT_THROW(replayer.sync(), SegmentIteratorException);
+    EXPECT_FALSE(replayer.getCompleted(&segmentId, &failure));
+}
+
+TEST_F(SegmentReplayerTest, sync_mergesNextNodeIds) {
+    ObjectManager::TombstoneProtector p(&objectManager);
+    std::unordered_map<uint64_t, uint64_t> nextNodeIdMap;
+    nextNodeIdMap[7] = 0;
+    SegmentCertificate certificate;
+    {
+        SegmentReplayer replayer(&objectManager, 2, &nextNodeIdMap);
+        for (uint64_t nodeId : {4UL, 12UL, 6UL}) {
+            Key key(7, &nodeId, sizeof(nodeId));
+            replayer.replay(buildSegment(key, 1, "node", &certificate),
+                    certificate, nodeId);
+        }
+        replayer.sync();
+    }
+    EXPECT_EQ(1U, nextNodeIdMap.size());
+    EXPECT_EQ(13U, nextNodeIdMap[7]);
+}
+
+} // namespace RAMCloud
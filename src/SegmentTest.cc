@@ -232,6 +232,66 @@ TEST_P(SegmentTest, append_differentLengthBytes) {
     }
 }
 
+TEST_P(SegmentTest, appendCompressed) {
+    SegmentAndAllocator segAndAlloc(GetParam());
+    Segment& s = *segAndAlloc.segment;
+
+    string data;
+    for (int i = 0; i < 50; i++)
+        data += "the quick brown fox ";
+    Buffer original;
+    original.appendExternal(data.data(), 1000);
+
+    Segment::Reference ref;
+    EXPECT_TRUE(s.appendCompressed(LOG_ENTRY_TYPE_OBJ, original, &ref));
+    uint32_t compressedLength = s.getAppendedLength();
+    EXPECT_GT(100U, compressedLength);
+
+    Segment::EntryHeader header = s.getEntryHeader(0);
+    EXPECT_EQ(LOG_ENTRY_TYPE_COMPRESSED, header.getType());
+
+    // Reads see the original entry, but the space it takes is what's stored.
+    uint64_t entriesBefore = Segment::decompressionMetrics.totalEntries;
+    Buffer buffer;
+    uint32_t lengthWithMetadata = 0;
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, s.getEntry(0U, &buffer, &lengthWithMetadata));
+    EXPECT_EQ(1000U, buffer.size());
+    EXPECT_EQ(0, memcmp(data.data(), buffer.getRange(0, 1000), 1000));
+    EXPECT_EQ(compressedLength, lengthWithMetadata);
+    EXPECT_EQ(entriesBefore + 1, Segment::decompressionMetrics.totalEntries);
+
+    buffer.reset();
+    lengthWithMetadata = 0;
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, ref.getEntry(segAndAlloc.allocator.get(),
+                                               &buffer, &lengthWithMetadata));
+    EXPECT_EQ(1000U, buffer.size());
+    EXPECT_EQ(0, memcmp(data.data(), buffer.getRange(0, 1000), 1000));
+    EXPECT_EQ(compressedLength, lengthWithMetadata);
+
+    // Just asking for the type doesn't decompress.
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, s.getEntry(0U, NULL));
+    EXPECT_EQ(entriesBefore + 2, Segment::decompressionMetrics.totalEntries);
+}
+
+TEST_P(SegmentTest, appendCompressed_incompressible) {
+    SegmentAndAllocator segAndAlloc(GetParam());
+    Segment& s = *segAndAlloc.segment;
+
+    Buffer original;
+    original.appendExternal("hi", 2);
+    EXPECT_TRUE(s.appendCompressed(LOG_ENTRY_TYPE_OBJTOMB, original));
+    original.reset();
+    original.appendExternal("0123456789abcdefghij", 20);
+    EXPECT_TRUE(s.appendCompressed(LOG_ENTRY_TYPE_OBJ, original));
+
+    // Both were stored as they would have been by append().
+    EXPECT_EQ(4U + 22U, s.getAppendedLength());
+    Buffer buffer;
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJTOMB, s.getEntry(0U, &buffer));
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, s.getEntry(4U, &buffer));
+    EXPECT_EQ("hi0123456789abcdefghij", TestUtil::toString(&buffer));
+}
+
 TEST_F(SegmentTest, appendLogHeader) {
     Buffer buffer;
     // Range of values for the entry length
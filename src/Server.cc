@@ -42,11 +42,22 @@ Server::Server(Context* context, const ServerConfig* config)
     , master()
     , backup()
     , adminService()
+    , dispatchPool()
     , enlistTimer()
 {
     context->coordinatorSession->setLocation(
             config->coordinatorLocator.c_str(), config->clusterName.c_str());
-    context->workerManager = new WorkerManager(context, config->maxCores-1);
+    // Dispatch threads count against maxCores, but leave at least one core
+    // for workers.
+    uint32_t workerCores = 1;
+    if (config->maxCores > config->dispatchThreads + 1) {
+        workerCores = config->maxCores - config->dispatchThreads;
+    }
+    context->workerManager = new WorkerManager(context, workerCores,
+                                               config->inlineShortRpcs,
+                                               config->elasticWorkerCores);
+    context->workerManager->setSchedulingPolicy(config->rpcClassWeights,
+                                                config->backgroundRpcLimit);
 }
 
 /**
@@ -111,6 +122,12 @@ Server::run()
     // significant amounts of time, so execute the enlistment in a worker
     // thread. That way, this thread can enter the dispatcher and start
     // servicing requests.
+    if (config.dispatchThreads > 1) {
+        dispatchPool.construct(context, config.localLocator,
+                               config.dispatchThreads - 1);
+        LOG(NOTICE, "Started %u extra dispatch threads",
+            config.dispatchThreads - 1);
+    }
     enlistTimer.construct(this, formerServerId);
 
     dispatch.run();
@@ -20,6 +20,7 @@
 #include "BackupService.h"
 #include "CoordinatorClient.h"
 #include "CoordinatorSession.h"
+#include "DispatchPool.h"
 #include "FailureDetector.h"
 #include "MasterService.h"
 #include "ServerConfig.h"
@@ -109,6 +110,11 @@ class Server {
      */
     Tub<AdminService> adminService;
 
+    /**
+     * Extra dispatch threads, if config.dispatchThreads asks for any.
+     */
+    Tub<DispatchPool> dispatchPool;
+
     // The class and variable below are used to run enlistment in a
     // worker thread, so that post-enlistment initialization doesn't
     // keep us from servicing RPCs.
@@ -64,6 +64,11 @@ struct ServerConfig {
         , maxObjectDataSize(segmentSize / 4)
         , maxObjectKeySize((64 * 1024) - 1)
         , maxCores(2)
+        , dispatchThreads(1)
+        , inlineShortRpcs(false)
+        , elasticWorkerCores(false)
+        , rpcClassWeights()
+        , backgroundRpcLimit(0)
         , master(testing)
         , backup(testing)
     {}
@@ -88,6 +93,11 @@ struct ServerConfig {
         , maxObjectDataSize(segmentSize / 8)
         , maxObjectKeySize((64 * 1024) - 1)
         , maxCores(2)
+        , dispatchThreads(1)
+        , inlineShortRpcs(false)
+        , elasticWorkerCores(false)
+        , rpcClassWeights()
+        , backgroundRpcLimit(0)
         , master()
         , backup()
     {}
@@ -137,6 +147,11 @@ struct ServerConfig {
         config.set_max_object_data_size(maxObjectDataSize);
         config.set_max_object_key_size(maxObjectKeySize);
         config.set_max_cores(maxCores);
+        config.set_dispatch_threads(dispatchThreads);
+        config.set_inline_short_rpcs(inlineShortRpcs);
+        config.set_elastic_worker_cores(elasticWorkerCores);
+        config.set_rpc_class_weights(rpcClassWeights);
+        config.set_background_rpc_limit(backgroundRpcLimit);
 
         if (services.has(WireFormat::MASTER_SERVICE))
             master.serialize(*config.mutable_master());
@@ -217,6 +232,45 @@ struct ServerConfig {
      */
     uint32_t maxCores;
 
+    /**
+     * Number of threads that receive and transmit RPCs, counting the main
+     * dispatch thread; these count against #maxCores. Values above 1 need
+     * a listening locator that can be shared between threads (see
+     * DispatchPool).
+     */
+    uint32_t dispatchThreads;
+
+    /**
+     * If true, short read-only RPCs (such as reads of small objects) are
+     * executed by the thread that received them instead of being handed to
+     * a worker, as long as that doesn't take up too much of the thread's
+     * time (see WorkerManager::runInline).
+     */
+    bool inlineShortRpcs;
+
+    /**
+     * If true, the number of cores occupied by worker threads (busy or
+     * polling for work) follows the load, between 1 and the number left
+     * over by #maxCores; idle workers beyond that sleep so other processes
+     * on the machine can use their cores. If false, idle workers poll for
+     * a while after each RPC regardless of the load.
+     */
+    bool elasticWorkerCores;
+
+    /**
+     * Determines the order in which RPCs waiting for a worker thread are
+     * started: "fifo" (or empty), "strict" (by class priority), or weights
+     * for the interactive, normal, and background classes such as "8:4:1".
+     * See WorkerManager::setSchedulingPolicy.
+     */
+    string rpcClassWeights;
+
+    /**
+     * If nonzero, the maximum number of background RPCs (such as migration
+     * and enumeration) that worker threads execute at once.
+     */
+    uint32_t backgroundRpcLimit;
+
     /**
      * Configuration details specific to the MasterService on a server,
      * if any.  If !config.has(MASTER_SERVICE) then this field is ignored.
@@ -229,6 +283,7 @@ struct ServerConfig {
         Master(Testing) // NOLINT
             : logBytes(40 * 1024 * 1024)
             , hashTableBytes(1 * 1024 * 1024)
+            , maxHashTableBytes(0)
             , disableLogCleaner(true)
             , disableInMemoryCleaning(true)
             , diskExpansionFactor(1.0)
@@ -238,6 +293,13 @@ struct ServerConfig {
             , numReplicas(0)
             , useMinCopysets(false)
             , allowLocalBackup(false)
+            , numLogHeads(1)
+            , syncGroupCommitMicros(0)
+            , segregateHotWrites(false)
+            , coldCompressionSeconds(0)
+            , recoveryReplayThreads(1)
+            , chainReplication(false)
+            , coalesceBackupWrites(false)
         {}
 
         /**
@@ -248,6 +310,7 @@ struct ServerConfig {
         Master()
             : logBytes()
             , hashTableBytes()
+            , maxHashTableBytes()
             , disableLogCleaner()
             , disableInMemoryCleaning()
             , diskExpansionFactor()
@@ -257,6 +320,13 @@ struct ServerConfig {
             , numReplicas()
             , useMinCopysets()
             , allowLocalBackup()
+            , numLogHeads()
+            , syncGroupCommitMicros()
+            , segregateHotWrites()
+            , coldCompressionSeconds()
+            , recoveryReplayThreads()
+            , chainReplication()
+            , coalesceBackupWrites()
         {}
 
         /**
@@ -267,6 +337,7 @@ struct ServerConfig {
         {
             config.set_log_bytes(logBytes);
             config.set_hash_table_bytes(hashTableBytes);
+            config.set_max_hash_table_bytes(maxHashTableBytes);
             config.set_disable_log_cleaner(disableLogCleaner);
             config.set_disable_in_memory_cleaning(disableInMemoryCleaning);
             config.set_backup_disk_expansion_factor(diskExpansionFactor);
@@ -276,6 +347,13 @@ struct ServerConfig {
             config.set_num_replicas(numReplicas);
             config.set_use_mincopysets(useMinCopysets);
             config.set_use_local_backup(allowLocalBackup);
+            config.set_num_log_heads(numLogHeads);
+            config.set_sync_group_commit_micros(syncGroupCommitMicros);
+            config.set_segregate_hot_writes(segregateHotWrites);
+            config.set_cold_compression_seconds(coldCompressionSeconds);
+            config.set_recovery_replay_threads(recoveryReplayThreads);
+            config.set_chain_replication(chainReplication);
+            config.set_coalesce_backup_writes(coalesceBackupWrites);
         }
 
         /**
@@ -287,6 +365,7 @@ struct ServerConfig {
         {
             logBytes = config.log_bytes();
             hashTableBytes = config.hash_table_bytes();
+            maxHashTableBytes = config.max_hash_table_bytes();
             disableLogCleaner = config.disable_log_cleaner();
             disableInMemoryCleaning = config.disable_in_memory_cleaning();
             diskExpansionFactor = config.backup_disk_expansion_factor();
@@ -296,6 +375,13 @@ struct ServerConfig {
             numReplicas = config.num_replicas();
             useMinCopysets = config.use_mincopysets();
             allowLocalBackup = config.use_local_backup();
+            numLogHeads = config.num_log_heads();
+            syncGroupCommitMicros = config.sync_group_commit_micros();
+            segregateHotWrites = config.segregate_hot_writes();
+            coldCompressionSeconds = config.cold_compression_seconds();
+            recoveryReplayThreads = config.recovery_replay_threads();
+            chainReplication = config.chain_replication();
+            coalesceBackupWrites = config.coalesce_backup_writes();
         }
 
         /// Total number bytes to use for the in-memory Log.
@@ -304,6 +390,12 @@ struct ServerConfig {
         /// Total number of bytes to use for the HashTable.
         uint64_t hashTableBytes;
 
+        /// If larger than hashTableBytes, the HashTable starts out with
+        /// hashTableBytes of buckets and is resized in the background as the
+        /// number of objects changes, never exceeding this many bytes of
+        /// buckets. Otherwise the HashTable has a fixed size.
+        uint64_t maxHashTableBytes;
+
         /// If true, disable the log cleaner entirely.
         bool disableLogCleaner;
 
@@ -339,6 +431,48 @@ struct ServerConfig {
 
         /// If true, allow replication to local backup.
         bool allowLocalBackup;
+
+        /// Number of head segments the log appends to in parallel. Each
+        /// worker thread always appends to the same head, so with more than
+        /// one head, appends from different threads don't serialize on a
+        /// single lock.
+        uint32_t numLogHeads;
+
+        /// Longest time, in microseconds, that Log::sync() will hold back
+        /// replication in order to batch the appends of other syncing threads
+        /// into the same backup writes. The actual delay adapts to how
+        /// quickly syncs are arriving and is zero when they are infrequent.
+        /// 0 disables group commit.
+        uint32_t syncGroupCommitMicros;
+
+        /// If true, the log has an extra head that only receives objects
+        /// whose keys have been overwritten frequently of late (as estimated
+        /// by ObjectManager's UpdateFrequencySketch). Keeping hot objects out
+        /// of the segments that cold objects are written to means the hot
+        /// segments empty out quickly and are cheap to clean.
+        bool segregateHotWrites;
+
+        /// If nonzero, the cleaner gathers entries that were written at least
+        /// this many seconds ago into survivor segments of their own and
+        /// compresses the objects among them. Reads of those objects pay to
+        /// decompress them. 0 disables compression.
+        uint32_t coldCompressionSeconds;
+
+        /// Number of threads a recovery master replays recovery segments on.
+        /// With more than one, segments are replayed in parallel as they
+        /// arrive from backups, each thread into its own SideLog.
+        uint32_t recoveryReplayThreads;
+
+        /// If true, the master sends each replication write only to the
+        /// primary replica's backup, which passes it on to the backups of
+        /// the other replicas. This divides the master's outgoing
+        /// replication bandwidth by numReplicas.
+        bool chainReplication;
+
+        /// If true, the master coalesces small replication writes (to
+        /// different segments) that are bound for the same backup into a
+        /// single RPC, cutting the number of RPCs under heavy write load.
+        bool coalesceBackupWrites;
     } master;
 
     /**
@@ -357,10 +491,13 @@ struct ServerConfig {
             , numSegmentFrames(4)
             , maxNonVolatileBuffers(0)
             , maxRecoveryReplicas(20)
+            , recoveryBuildThreads(1)
             , file()
             , strategy(1)
             , mockSpeed(100)
             , writeRateLimit(0)
+            , ioUring(false)
+            , persistentMemory(false)
         {}
 
         /**
@@ -375,10 +512,13 @@ struct ServerConfig {
             , numSegmentFrames(512)
             , maxNonVolatileBuffers(0)
             , maxRecoveryReplicas(20)
+            , recoveryBuildThreads(1)
             , file("/var/tmp/backup.log")
             , strategy(1)
             , mockSpeed(0)
             , writeRateLimit(0)
+            , ioUring(false)
+            , persistentMemory(false)
         {}
 
         /**
@@ -392,11 +532,14 @@ struct ServerConfig {
             config.set_num_segment_frames(numSegmentFrames);
             config.set_max_non_volatile_buffers(maxNonVolatileBuffers);
             config.set_max_recovery_replicas(maxRecoveryReplicas);
+            config.set_recovery_build_threads(recoveryBuildThreads);
             if (!inMemory)
                 config.set_file(file);
             config.set_strategy(strategy);
             config.set_mock_speed(mockSpeed);
             config.set_write_rate_limit(writeRateLimit);
+            config.set_io_uring(ioUring);
+            config.set_persistent_memory(persistentMemory);
         }
 
         /**
@@ -411,11 +554,14 @@ struct ServerConfig {
             numSegmentFrames = config.num_segment_frames();
             maxNonVolatileBuffers = config.max_non_volatile_buffers();
             maxRecoveryReplicas = config.max_recovery_replicas();
+            recoveryBuildThreads = config.recovery_build_threads();
             if (!inMemory)
                 file = config.file();
             strategy = config.strategy();
             mockSpeed = config.mock_speed();
             writeRateLimit = config.write_rate_limit();
+            ioUring = config.io_uring();
+            persistentMemory = config.persistent_memory();
         }
 
         /**
@@ -457,9 +603,23 @@ struct ServerConfig {
          * The maximum number of replicas that will be kept in memory during any
          * given recovery. A large number may unnecessarily waste memory, but a
          * small number will slow down recovery.
+         *
+         * Each crashed master this backup holds replicas for gets its own
+         * buffer, so the backup may pin up to maxRecoveryReplicas *
+         * segmentSize bytes for every master recovery it is currently
+         * serving. The coordinator runs one master recovery at a time, but
+         * a buffer is only released when its recovery is freed.
          */
         uint32_t maxRecoveryReplicas;
 
+        /**
+         * Number of threads each master recovery uses to construct recovery
+         * segments from replicas, including the backup's task queue thread.
+         * With more than one, replicas are filtered in parallel while the
+         * task queue thread keeps reading more of them from storage.
+         */
+        uint32_t recoveryBuildThreads;
+
         /// Path to a file to use for the backing store if inMemory is false.
         string file;
 
@@ -481,6 +641,20 @@ struct ServerConfig {
          * If non-0, limit writes to backup to this many megabytes per second.
          */
         size_t writeRateLimit;
+
+        /**
+         * If true, disk-based storage uses io_uring rather than POSIX aio
+         * for replica IO (when the kernel supports it).
+         */
+        bool ioUring;
+
+        /**
+         * If true (and inMemory is false), #file is mapped into memory and
+         * replicas are stored in it directly, made durable with cache line
+         * flushes rather than writes. Meant for a file on a DAX filesystem
+         * backed by persistent memory.
+         */
+        bool persistentMemory;
     } backup;
 
   public:
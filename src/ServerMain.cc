@@ -99,6 +99,7 @@ main(int argc, char *argv[])
     try {
         ServerConfig config = ServerConfig::forExecution();
         string masterTotalMemory, hashTableMemory;
+        uint64_t maxHashTableMegs;
 
         bool masterOnly;
         bool backupOnly;
@@ -111,9 +112,18 @@ main(int argc, char *argv[])
             ("backupInMemory,m",
              ProgramOptions::bool_switch(&config.backup.inMemory),
              "Backup will store segment replicas in memory")
+            ("backupIoUring",
+             ProgramOptions::bool_switch(&config.backup.ioUring),
+             "Backup will use io_uring rather than POSIX aio for disk IO, "
+             "if the kernel supports it")
             ("backupOnly,B",
              ProgramOptions::bool_switch(&backupOnly),
              "The server should run the backup service only (no master)")
+            ("backupPersistentMemory",
+             ProgramOptions::bool_switch(&config.backup.persistentMemory),
+             "Backup will map the file given by --file into memory and store "
+             "segment replicas in it directly; meant for a file on a DAX "
+             "filesystem backed by persistent memory")
             ("backupStrategy",
              ProgramOptions::value<int>(&config.backup.strategy)->
                default_value(RANDOM_REFINE_AVG),
@@ -126,6 +136,15 @@ main(int argc, char *argv[])
              "of bandwidth this backup should use. Useful for artificially "
              "restricting bandwidth when measuring various parts of the "
              "system.")
+            ("chainReplication",
+             ProgramOptions::bool_switch(&config.master.chainReplication),
+             "Send each replication write only to the primary replica's "
+             "backup and have it pass the write on to the other replicas' "
+             "backups, rather than sending it to every backup directly")
+            ("coalesceBackupWrites",
+             ProgramOptions::bool_switch(&config.master.coalesceBackupWrites),
+             "Coalesce replication writes to different segments that are "
+             "bound for the same backup into a single RPC")
             ("cleanerBalancer",
              ProgramOptions::value<string>(&config.master.cleanerBalancer)->
                 default_value("tombstoneRatio:0.40"),
@@ -166,6 +185,45 @@ main(int argc, char *argv[])
                 default_value("10%"),
              "Percentage or megabytes of master memory allocated to "
              "the hash table")
+            ("hashTableMaxMemory",
+             ProgramOptions::value<uint64_t>(&maxHashTableMegs)->
+                default_value(0),
+             "If larger than the hash table's initial size, the hash table "
+             "is resized in the background as objects are added and removed, "
+             "using up to this many megabytes. This memory is in addition to "
+             "totalMasterMemory.")
+            ("logHeads",
+             ProgramOptions::value<uint32_t>(
+                &config.master.numLogHeads)->default_value(1),
+             "Number of log head segments that can be appended to in "
+             "parallel. Each has its own replication stream; using more than "
+             "one lets writes handled by different worker threads proceed "
+             "without waiting for one another.")
+            ("syncGroupCommitMicros",
+             ProgramOptions::value<uint32_t>(
+                &config.master.syncGroupCommitMicros)->default_value(0),
+             "Maximum time in microseconds that a log sync may wait so that "
+             "the writes of other concurrently syncing operations can be "
+             "replicated with the same backup RPCs. The wait adapts to the "
+             "current write rate and is skipped when writes are infrequent. "
+             "0 disables this batching.")
+            ("segregateHotWrites",
+             ProgramOptions::bool_switch(&config.master.segregateHotWrites),
+             "Write objects whose keys are overwritten frequently to a "
+             "separate log head, so that segments of short-lived data are "
+             "not mixed with long-lived data and are cheaper to clean.")
+            ("coldCompressionSeconds",
+             ProgramOptions::value<uint32_t>(
+                &config.master.coldCompressionSeconds)->default_value(0),
+             "When cleaning, compress objects written at least this many "
+             "seconds ago into segments of their own, trading read latency "
+             "on those objects for memory. 0 disables compression.")
+            ("recoveryReplayThreads",
+             ProgramOptions::value<uint32_t>(
+                &config.master.recoveryReplayThreads)->default_value(1),
+             "Number of threads to replay recovery segments on when this "
+             "server is a recovery master. More threads let replay keep up "
+             "with the rate at which backups return segments.")
             ("logCleanerThreads",
              ProgramOptions::value<uint32_t>(
                 &config.master.cleanerThreadCount)->default_value(1),
@@ -184,6 +242,36 @@ main(int argc, char *argv[])
              "under this limit, but may occasionally need to exceed it "
              "(e.g., to avoid distributed deadlocks). Th limit does not "
              "include cleaner threads and some other miscellaneous functions.")
+            ("dispatchThreads",
+             ProgramOptions::value<uint32_t>(
+                &config.dispatchThreads)->default_value(1),
+             "Number of threads that receive and transmit RPCs, including "
+             "the main dispatch thread; counts against maxCores. Values "
+             "above 1 need a local locator that can be shared between "
+             "threads, such as basic+udp with reusePort=1.")
+            ("inlineShortRpcs",
+             ProgramOptions::bool_switch(&config.inlineShortRpcs),
+             "Execute short read-only RPCs in the thread that receives them "
+             "rather than handing them to a worker thread, when that thread "
+             "has time to spare")
+            ("elasticWorkerCores",
+             ProgramOptions::bool_switch(&config.elasticWorkerCores),
+             "Vary the number of cores used by worker threads with the load, "
+             "up to the limit set by maxCores, instead of letting idle "
+             "workers poll for new requests regardless of the load")
+            ("rpcClassWeights",
+             ProgramOptions::value<string>(&config.rpcClassWeights)->
+                default_value("fifo"),
+             "Order in which requests waiting for a worker thread are "
+             "started: 'fifo' (arrival order), 'strict' (interactive "
+             "requests first, then normal, then background), or relative "
+             "shares of worker threads for the three classes, such as "
+             "'8:4:1'")
+            ("backgroundRpcLimit",
+             ProgramOptions::value<uint32_t>(&config.backgroundRpcLimit)->
+                default_value(0),
+             "Maximum number of background requests (such as migration and "
+             "enumeration) to execute at once; 0 means no limit")
             ("maxNonVolatileBuffers",
              ProgramOptions::value<uint32_t>(
                &config.backup.maxNonVolatileBuffers)->default_value(10),
@@ -196,6 +284,11 @@ main(int argc, char *argv[])
                &config.backup.maxRecoveryReplicas)->default_value(20),
              "Maximum number of replicas any given master recovery will buffer "
              "in memory.")
+            ("recoveryBuildThreads",
+             ProgramOptions::value<uint32_t>(
+               &config.backup.recoveryBuildThreads)->default_value(1),
+             "Number of threads each master recovery on this backup uses to "
+             "build recovery segments from replicas.")
             ("preferredIndex",
              ProgramOptions::value<uint32_t>(
                 &config.preferredIndex)->default_value(0),
@@ -328,6 +421,7 @@ main(int argc, char *argv[])
         if (!backupOnly) {
             LOG(NOTICE, "Using %u backups", config.master.numReplicas);
             config.setLogAndHashTableSize(masterTotalMemory, hashTableMemory);
+            config.master.maxHashTableBytes = maxHashTableMegs * 1024 * 1024;
         }
 
         // Set PortTimeout and start portTimer
@@ -41,7 +41,8 @@ class ServerRpcPool : public LogProtector::EpochProvider {
     ServerRpcPool()
         : outstandingServerRpcs(),
           pool(),
-          outstandingAllocations(0)
+          outstandingAllocations(0),
+          mutex("ServerRpcPool::mutex")
     {
     }
 
@@ -64,6 +65,7 @@ class ServerRpcPool : public LogProtector::EpochProvider {
     construct(Args&&... args)
     {
         T* rpc = pool.construct(static_cast<Args&&>(args)...);
+        SpinLock::Guard _(mutex);
         outstandingServerRpcs.push_back(*rpc);
         outstandingAllocations++;
         return rpc;
@@ -76,17 +78,21 @@ class ServerRpcPool : public LogProtector::EpochProvider {
     void
     destroy(T* const rpc)
     {
-        outstandingServerRpcs.erase(outstandingServerRpcs.iterator_to(*rpc));
+        {
+            SpinLock::Guard _(mutex);
+            outstandingServerRpcs.erase(
+                    outstandingServerRpcs.iterator_to(*rpc));
+        }
         outstandingAllocations--;
         pool.destroy(rpc);
     }
 
     // See LogProtector::EpochProvider for documentation.
-    // Caller must hold dispatch lock.
     uint64_t
     getEarliestEpoch(int activityMask)
     {
         uint64_t earliest = -1;
+        SpinLock::Guard _(mutex);
 
         ServerRpcList::iterator it = outstandingServerRpcs.begin();
         while (it != outstandingServerRpcs.end()) {
@@ -117,6 +123,11 @@ class ServerRpcPool : public LogProtector::EpochProvider {
     /// yet destroyed. The new ObjectPool does this, but the old one did not.
     /// Keep this simple check around just in case the interface changes.
     uint64_t outstandingAllocations;
+
+    /// Protects #outstandingServerRpcs. The dispatch lock used to be enough,
+    /// but the transports of a DispatchThread modify their pools in a thread
+    /// that the main dispatch lock doesn't exclude.
+    SpinLock mutex;
 };
 
 /**
@@ -58,7 +58,9 @@ class Service {
         Rpc(Worker* worker, Buffer* requestPayload, Buffer* replyPayload)
             : requestPayload(requestPayload)
             , replyPayload(replyPayload)
-            , worker(worker) {}
+            , worker(worker)
+            , mustNotBlock(false)
+            , wouldBlock(false) {}
 
         void sendReply();
 
@@ -72,6 +74,17 @@ class Service {
         /// this request.
         Worker* worker;
 
+        /// True means the RPC is being executed by the dispatch thread
+        /// (see WorkerManager::runInline), so its handler must not wait for
+        /// anything. Handlers that can't finish without waiting set
+        /// #wouldBlock and return instead.
+        bool mustNotBlock;
+
+        /// Set by a handler when #mustNotBlock kept it from completing the
+        /// RPC; the RPC is then discarded and handed to a worker to execute
+        /// from scratch.
+        bool wouldBlock;
+
         friend class WorkerManager;
         friend class Service;
         DISALLOW_COPY_AND_ASSIGN(Rpc);
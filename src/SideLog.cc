@@ -91,7 +91,7 @@ void
 SideLog::commit()
 {
     Tub<SpinLock::Guard> lock;
-    lock.construct(appendLock);
+    lock.construct(heads[0].appendLock);
 
     if (segments.empty())
         return;
@@ -137,17 +137,21 @@ SideLog::commit()
  * part of the log proper. Any segments previously allocated by this call will
  * not be appended to again.
  *
- * This method must be called with AbstractLog's appendLock held.
+ * This method must be called with the head's appendLock held.
  *
  * \param mustNotFail
  *      If true, this method must return a valid LogSegment pointer and may
  *      block as long as needed. If false, it should return immediately with
  *      a NULL pointer if no segments are available.
+ * \param headIndex
+ *      Index of the head the segment is for. A SideLog has only one head, so
+ *      this is always 0.
  */
 LogSegment*
-SideLog::allocNextSegment(bool mustNotFail)
+SideLog::allocNextSegment(bool mustNotFail, uint32_t headIndex)
 {
-    assert(!appendLock.try_lock());
+    assert(headIndex == 0);
+    assert(!heads[headIndex].appendLock.try_lock());
 
     LogSegment* segment;
     if (mustNotFail)
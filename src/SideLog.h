@@ -72,7 +72,7 @@ class SideLog : public AbstractLog {
     void commit();
 
   PRIVATE:
-    LogSegment* allocNextSegment(bool mustNotFail);
+    LogSegment* allocNextSegment(bool mustNotFail, uint32_t headIndex);
 
     /// Pointer to the log that this object will merge appended entries into if
     /// commit() is invoked. This is used to roll the head over after fusing
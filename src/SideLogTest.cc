@@ -105,9 +105,9 @@ TEST_F(SideLogTest, commit) {
     SideLog sl(&l);
 
     // an empty sidelog shouldn't alter the log
-    uint64_t headId = l.head->id;
+    uint64_t headId = l.heads[0].segment->id;
     sl.commit();
-    EXPECT_EQ(headId, l.head->id);
+    EXPECT_EQ(headId, l.heads[0].segment->id);
 
     EXPECT_TRUE(sl.append(LOG_ENTRY_TYPE_OBJ, "hi", 2));
     LogSegment* newSeg = sl.segments[0];
@@ -122,7 +122,7 @@ TEST_F(SideLogTest, commit) {
     EXPECT_EQ(0lu, sl.totalLiveBytes);
     EXPECT_EQ(0lu, sl.metrics.totalAppendCalls);
 
-    EXPECT_NE(headId, l.head->id);
+    EXPECT_NE(headId, l.heads[0].segment->id);
     EXPECT_TRUE(newSeg->closed);
     EXPECT_TRUE(sl.segments.empty());
     EXPECT_EQ(
@@ -144,9 +144,9 @@ TEST_F(SideLogTest, commit) {
         TestLog::get());
 
     // an empty sidelog still shouldn't alter the log
-    headId = l.head->id;
+    headId = l.heads[0].segment->id;
     sl.commit();
-    EXPECT_EQ(headId, l.head->id);
+    EXPECT_EQ(headId, l.heads[0].segment->id);
 
     EXPECT_EQ(4lu, l.totalLiveBytes);
 }
@@ -160,7 +160,7 @@ freeSegmentSoon(SegmentManager* segmentManager, LogSegment* segment) {
 
 TEST_F(SideLogTest, allocNextSegment_basics) {
     SideLog sl(&l);
-    SpinLock::Guard _(sl.appendLock);
+    SpinLock::Guard _(sl.heads[0].appendLock);
 
     LogSegment* segment = segmentManager.allocSideSegment(0, NULL);
     EXPECT_NE(static_cast<LogSegment*>(NULL), segment);
@@ -169,24 +169,24 @@ TEST_F(SideLogTest, allocNextSegment_basics) {
     }
 
     // if SegmentManager is tapped, should return NULL
-    EXPECT_EQ(static_cast<LogSegment*>(NULL), sl.allocNextSegment(false));
+    EXPECT_EQ(static_cast<LogSegment*>(NULL), sl.allocNextSegment(false, 0));
 
     // if we specify to block until we have space, it should not return NULL
     std::thread freer(freeSegmentSoon, &segmentManager, segment);
     EXPECT_EQ(0U, sl.segments.size());
-    EXPECT_EQ(segment, sl.allocNextSegment(true));
+    EXPECT_EQ(segment, sl.allocNextSegment(true, 0));
     EXPECT_EQ(1U, sl.segments.size());
     freer.join();
 }
 
 TEST_F(SideLogTest, allocNextSegment_closePrevious) {
     SideLog sl(&l);
-    SpinLock::Guard _(sl.appendLock);
+    SpinLock::Guard _(sl.heads[0].appendLock);
 
-    LogSegment* s1 = sl.allocNextSegment(false);
+    LogSegment* s1 = sl.allocNextSegment(false, 0);
     EXPECT_FALSE(s1->replicatedSegment->queued.close);
     EXPECT_FALSE(s1->closed);
-    LogSegment* s2 = sl.allocNextSegment(false);
+    LogSegment* s2 = sl.allocNextSegment(false, 0);
     EXPECT_TRUE(s1->closed);
     EXPECT_TRUE(s1->replicatedSegment->queued.close);
     EXPECT_FALSE(s2->closed);
@@ -21,6 +21,38 @@ namespace RAMCloud {
 
 namespace TableStats {
 
+/**
+ * Add the key hashes in [startKeyHash, endKeyHash] to (or subtract them
+ * from) the number of key hashes owned in each histogram bucket of a table.
+ * The caller must hold the block's lock.
+ *
+ * \param stats
+ *      Stats block of the table whose tablet is being added or deleted.
+ * \param startKeyHash
+ *      First key hash value of the tablet.
+ * \param endKeyHash
+ *      Last Key hash value of the tablet.
+ * \param add
+ *      True to add the key hashes; false to subtract them.
+ */
+static void
+updateBucketKeyHashCounts(Block* stats,
+                          uint64_t startKeyHash,
+                          uint64_t endKeyHash,
+                          bool add)
+{
+    uint32_t lastBucket = histogramBucket(endKeyHash);
+    for (uint32_t i = histogramBucket(startKeyHash); i <= lastBucket; i++) {
+        uint64_t first = std::max(startKeyHash, i * histogramBucketWidth);
+        uint64_t last = std::min(endKeyHash,
+                i * histogramBucketWidth + (histogramBucketWidth - 1));
+        if (add)
+            stats->bucketKeyHashCount[i] += last - first + 1;
+        else
+            stats->bucketKeyHashCount[i] -= last - first + 1;
+    }
+}
+
 /**
  * Update the table status information in the event a tablet is added to keep
  * track of the number of key hash values that this master owns for the given
@@ -56,6 +88,7 @@ addKeyHashRange(MasterTableMetadata* mtm,
     if (entry->stats.keyHashCount == 0) {
         entry->stats.totalOwnership = true;
     }
+    updateBucketKeyHashCounts(&entry->stats, startKeyHash, endKeyHash, true);
     TEST_LOG("tableId %lu range [0x%lx,0x%lx]",
             tableId, startKeyHash, endKeyHash);
 }
@@ -95,6 +128,8 @@ deleteKeyHashRange(MasterTableMetadata* mtm,
         entry->stats.keyHashCount -= (endKeyHash - startKeyHash);
         entry->stats.keyHashCount -= 1;
         entry->stats.totalOwnership = false;
+        updateBucketKeyHashCounts(&entry->stats, startKeyHash, endKeyHash,
+                                  false);
     }
     TEST_LOG("tableId %lu range [0x%lx,0x%lx]",
             tableId, startKeyHash, endKeyHash);
@@ -131,6 +166,42 @@ increment(MasterTableMetadata* mtm,
     entry->stats.recordCount += recordCount;
 }
 
+/**
+ * Same as above, but also attributes the new data to the histogram bucket
+ * for \a keyHash so that its distribution across the table's key hash space
+ * is known during recovery. Used for objects and tombstones, which make up
+ * nearly all of a table's data.
+ *
+ * \param mtm
+ *      Pointer to MasterTableMetadata container that is storing the current
+ *      stats information.  Must not be NULL.
+ * \param tableId
+ *      Id of table whose stats information will be updated.
+ * \param keyHash
+ *      Key hash of the object the new data belongs to.
+ * \param byteCount
+ *      Number of bytes of new data (related to tableId) added to the log.
+ * \param recordCount
+ *      Number of new records (related to tableId) added to the log.
+ */
+void
+increment(MasterTableMetadata* mtm,
+          uint64_t tableId,
+          uint64_t keyHash,
+          uint64_t byteCount,
+          uint64_t recordCount)
+{
+    MasterTableMetadata::Entry* entry;
+    entry = mtm->findOrCreate(tableId);
+
+    SpinLock::Guard _(entry->stats.lock);
+    entry->stats.byteCount += byteCount;
+    entry->stats.recordCount += recordCount;
+    uint32_t bucket = histogramBucket(keyHash);
+    entry->stats.bucketByteCount[bucket] += byteCount;
+    entry->stats.bucketRecordCount[bucket] += recordCount;
+}
+
 /**
  * Update table stats information, decrementing the existing stats values by the
  * values provided.  If no stats information previously existed for the
@@ -164,6 +235,91 @@ decrement(MasterTableMetadata* mtm,
     }
 }
 
+/**
+ * Same as above, but also removes the data from the histogram bucket for
+ * \a keyHash. Should only be used for data that was counted with the keyHash
+ * version of increment().
+ *
+ * \param mtm
+ *      Pointer to MasterTableMetadata container that is storing the current
+ *      stats information.  Must not be NULL.
+ * \param tableId
+ *      Id of table whose stats information will be updated.
+ * \param keyHash
+ *      Key hash of the object the cleaned data belonged to.
+ * \param byteCount
+ *      Number of bytes of data (related to tableId) cleaned from the log.
+ * \param recordCount
+ *      Number of records (related to tableId) cleaned to the log.
+ */
+void
+decrement(MasterTableMetadata* mtm,
+          uint64_t tableId,
+          uint64_t keyHash,
+          uint64_t byteCount,
+          uint64_t recordCount)
+{
+    MasterTableMetadata::Entry* entry;
+    entry = mtm->find(tableId);
+
+    if (entry != NULL) {
+        SpinLock::Guard _(entry->stats.lock);
+        entry->stats.byteCount -= byteCount;
+        entry->stats.recordCount -= recordCount;
+        // The histogram is only a guide, so don't let data that was counted
+        // without its key hash wrap a bucket around.
+        uint32_t bucket = histogramBucket(keyHash);
+        uint64_t& bucketBytes = entry->stats.bucketByteCount[bucket];
+        uint64_t& bucketRecords = entry->stats.bucketRecordCount[bucket];
+        bucketBytes -= std::min(bucketBytes, byteCount);
+        bucketRecords -= std::min(bucketRecords, recordCount);
+    }
+}
+
+/**
+ * Append the histogram for one table to a digest being built by serialize().
+ * The per-bucket densities are scaled so that, summed over the key hashes
+ * the master owns, they add up to the table's total byte and record counts;
+ * the histogram only tells recovery how that total is distributed.
+ * The caller must hold the block's lock.
+ *
+ * \param buf
+ *      Buffer where the DigestHistogram will be appended.
+ * \param tableId
+ *      Id of table whose stats are in \a stats.
+ * \param stats
+ *      Stats block of the table.
+ */
+static void
+serializeHistogram(Buffer* buf, uint64_t tableId, const Block* stats)
+{
+    uint64_t bucketByteCount = 0;
+    uint64_t bucketRecordCount = 0;
+    for (uint32_t i = 0; i < histogramBuckets; i++) {
+        bucketByteCount += stats->bucketByteCount[i];
+        bucketRecordCount += stats->bucketRecordCount[i];
+    }
+    double byteScale = bucketByteCount == 0 ? 0 :
+            double(stats->byteCount) / double(bucketByteCount);
+    double recordScale = bucketRecordCount == 0 ? 0 :
+            double(stats->recordCount) / double(bucketRecordCount);
+
+    DigestHistogram* histogram = buf->emplaceAppend<DigestHistogram>();
+    histogram->tableId = tableId;
+    for (uint32_t i = 0; i < histogramBuckets; i++) {
+        if (stats->bucketKeyHashCount[i] == 0) {
+            histogram->bytesPerKeyHash[i] = 0;
+            histogram->recordsPerKeyHash[i] = 0;
+            continue;
+        }
+        double keyHashCount = double(stats->bucketKeyHashCount[i]);
+        histogram->bytesPerKeyHash[i] = float(
+                double(stats->bucketByteCount[i]) * byteScale / keyHashCount);
+        histogram->recordsPerKeyHash[i] = float(
+                double(stats->bucketRecordCount[i]) * recordScale /
+                keyHashCount);
+    }
+}
 
 /**
  * Compress and serialize all table stats information in the MasterTableMetadata
@@ -198,6 +354,13 @@ serialize(Buffer *buf, MasterTableMetadata *mtm)
     uint64_t otherRecordCount = 0;
     bool hasOtherEntries = false;
 
+    // Histograms are collected separately since they go after all of the
+    // entries.
+    Buffer histogramBuffer;
+    DigestHistograms* histogramsHeader =
+            histogramBuffer.emplaceAppend<DigestHistograms>();
+    histogramsHeader->histogramCount = 0;
+
     MasterTableMetadata::scanner sc = mtm->getScanner();
     while (sc.hasNext()) {
         MasterTableMetadata::Entry* entry = sc.next();
@@ -226,6 +389,11 @@ serialize(Buffer *buf, MasterTableMetadata *mtm)
                 *(buf->emplaceAppend<DigestEntry>()) =
                         {entry->tableId, bytesPerKeyHash, recordsPerKeyHash};
 
+                if (entry->stats.byteCount >= histogramThreshold) {
+                    serializeHistogram(&histogramBuffer, entry->tableId,
+                                       &entry->stats);
+                    histogramsHeader->histogramCount++;
+                }
             } else {
                 otherKeyHashCount += keyHashCount;
                 otherByteCount += entry->stats.byteCount;
@@ -241,6 +409,9 @@ serialize(Buffer *buf, MasterTableMetadata *mtm)
             header->otherRecordsPerKeyHash = double(otherRecordCount) /
                                              otherKeyHashCount;
     }
+
+    if (histogramsHeader->histogramCount > 0)
+        buf->append(&histogramBuffer);
 }
 
 /**
@@ -251,11 +422,15 @@ serialize(Buffer *buf, MasterTableMetadata *mtm)
  *      of each of its segments.  This digest is the summarized table stats
  *      information extracted from the head segment of the failed master that is
  *      now to be recovered.
+ * \param digestBytes
+ *      Size of \a digest in bytes. Histograms are only read from the digest
+ *      if this shows they are present; 0 means the digest has none.
  */
-Estimator::Estimator(const Digest* digest)
+Estimator::Estimator(const Digest* digest, uint32_t digestBytes)
     : valid(false)
     , tableStats()
     , otherStats()
+    , histograms()
 {
     // If for some reason, the digest the estimator needs is not available, we
     // should log an error as this should never be the case during normal
@@ -278,6 +453,28 @@ Estimator::Estimator(const Digest* digest)
     otherStats = {digest->header.otherBytesPerKeyHash,
                   digest->header.otherRecordsPerKeyHash};
 
+    size_t histogramsOffset = sizeof(DigestHeader) +
+            digest->header.entryCount * sizeof(DigestEntry);
+    if (digestBytes >= histogramsOffset + sizeof(DigestHistograms)) {
+        const DigestHistograms* digestHistograms =
+                reinterpret_cast<const DigestHistograms*>(
+                reinterpret_cast<const char*>(digest) + histogramsOffset);
+        uint64_t count = digestHistograms->histogramCount;
+        if (digestBytes < histogramsOffset + sizeof(DigestHistograms) +
+                count * sizeof(DigestHistogram)) {
+            LOG(WARNING, "Table digest histograms truncated; ignoring them.");
+            count = 0;
+        }
+        for (uint64_t i = 0; i < count; i++) {
+            const DigestHistogram* entry = &digestHistograms->histograms[i];
+            Histogram& histogram = histograms[entry->tableId];
+            for (uint32_t j = 0; j < histogramBuckets; j++) {
+                histogram.buckets[j] = {entry->bytesPerKeyHash[j],
+                                        entry->recordsPerKeyHash[j]};
+            }
+        }
+    }
+
     valid = true;
 }
 
@@ -300,6 +497,29 @@ Estimator::estimate(Tablet *tablet)
     Estimate est = {0, 0};
     double keyRange = double(tablet->endKeyHash - tablet->startKeyHash) + 1;
 
+    HistogramMap::iterator histogram = histograms.find(tablet->tableId);
+    if (histogram != histograms.end()) {
+        // The table was large enough to have a histogram; sum up the
+        // part of each bucket the tablet covers.
+        double byteCount = 0;
+        double recordCount = 0;
+        uint32_t lastBucket = histogramBucket(tablet->endKeyHash);
+        for (uint32_t i = histogramBucket(tablet->startKeyHash);
+                i <= lastBucket; i++) {
+            uint64_t first = std::max(tablet->startKeyHash,
+                                      i * histogramBucketWidth);
+            uint64_t last = std::min(tablet->endKeyHash,
+                    i * histogramBucketWidth + (histogramBucketWidth - 1));
+            double overlap = double(last - first) + 1;
+            byteCount += histogram->second.buckets[i].bytesPerKeyHash * overlap;
+            recordCount +=
+                    histogram->second.buckets[i].recordsPerKeyHash * overlap;
+        }
+        est.byteCount = uint64_t(byteCount);
+        est.recordCount = uint64_t(recordCount);
+        return est;
+    }
+
     StatsMap::iterator entry = tableStats.find(tablet->tableId);
     if (entry != tableStats.end()) {
         // The table was large enough that statistics were kept specifically
@@ -318,6 +538,56 @@ Estimator::estimate(Tablet *tablet)
     return est;
 }
 
+/**
+ * Returns true if the digest held a histogram for the given table, in which
+ * case estimate() reflects how the table's data is spread across its key
+ * hashes rather than assuming it is spread evenly.
+ *
+ * \param tableId
+ *      Id of the table to check.
+ */
+bool
+Estimator::hasHistogram(uint64_t tableId)
+{
+    return histograms.find(tableId) != histograms.end();
+}
+
+/**
+ * Used to split a tablet into pieces of similar size. Finds the smallest
+ * key hash in the tablet such that the tablet's range up to and including
+ * that key hash is estimated to hold at least \a target bytes or at least
+ * \a target records.
+ *
+ * \param tablet
+ *      Tablet to find the split point in.
+ * \param target
+ *      Estimated size the piece of \a tablet starting at its first key hash
+ *      should reach. A count of 0 in either field means that field is
+ *      ignored.
+ * \return
+ *      The key hash ending the piece; \a tablet's last key hash if the whole
+ *      tablet falls short of \a target.
+ */
+uint64_t
+Estimator::findSplitKeyHash(Tablet* tablet, Estimate target)
+{
+    Tablet piece = *tablet;
+    uint64_t low = tablet->startKeyHash;
+    uint64_t high = tablet->endKeyHash;
+    while (low < high) {
+        piece.endKeyHash = low + (high - low) / 2;
+        Estimate est = estimate(&piece);
+        if ((target.byteCount > 0 && est.byteCount >= target.byteCount) ||
+                (target.recordCount > 0 &&
+                 est.recordCount >= target.recordCount)) {
+            high = piece.endKeyHash;
+        } else {
+            low = piece.endKeyHash + 1;
+        }
+    }
+    return low;
+}
+
 } // namespace TableStats
 
 } // namespace RAMCloud
@@ -45,8 +45,37 @@ class MasterTableMetadata;
  * tables at least as large as a given THRESHOLD, exact information is kept.
  * For those "other" tables that fall below the THRESHOLD aggregate information
  * is kept.
+ *
+ * For the largest tables, a coarse histogram over the key hash space is also
+ * kept so that recovery can split skewed tablets into pieces of roughly equal
+ * size rather than pieces of equal key hash range (see histogramThreshold).
+ * The histogram is kept per table rather than per tablet: the stats blocks
+ * are indexed by table, and tablet boundaries change with splits and
+ * migrations, while the fixed buckets don't. Each bucket also records how
+ * many of its key hashes this master owns (Block::bucketKeyHashCount), so
+ * the histogram gives per-tablet estimates for any tablet of the table,
+ * to within one bucket at the tablet's ends.
  */
 namespace TableStats {
+
+/**
+ * Number of buckets the key hash space is divided into for each table's
+ * histogram. Bucket i covers the key hashes whose top bits equal i.
+ */
+const uint32_t histogramBuckets = 32;
+
+/// Number of key hashes covered by each histogram bucket.
+const uint64_t histogramBucketWidth = (~0UL / histogramBuckets) + 1;
+
+/**
+ * Returns the index of the histogram bucket that \a keyHash falls in.
+ */
+static inline uint32_t
+histogramBucket(uint64_t keyHash)
+{
+    return downCast<uint32_t>(keyHash / histogramBucketWidth);
+}
+
 /**
  * This structure represents a block of stats information for an individual
  * table on a given master.  One of these blocks is stored in each entry
@@ -63,12 +92,24 @@ struct Block {
     uint64_t byteCount;     /// Number of bytes of data related to a table.
     uint64_t recordCount;   /// Number of log records related to a table.
 
+    /// Number of key hashes in each histogram bucket this master owns.
+    uint64_t bucketKeyHashCount[histogramBuckets];
+    /// Bytes of data attributed to each histogram bucket. Only includes data
+    /// whose key hash was known when it was counted, so the sum may be less
+    /// than #byteCount.
+    uint64_t bucketByteCount[histogramBuckets];
+    /// Log records attributed to each histogram bucket; like #bucketByteCount.
+    uint64_t bucketRecordCount[histogramBuckets];
+
     Block()
         : lock("TableStats::lock")
         , keyHashCount(0)
         , totalOwnership(false)
         , byteCount(0)
         , recordCount(0)
+        , bucketKeyHashCount()
+        , bucketByteCount()
+        , bucketRecordCount()
     {}
 };
 
@@ -84,8 +125,18 @@ void increment(MasterTableMetadata* mtm,
                uint64_t tableId,
                uint64_t byteCount,
                uint64_t recordCount);
+void increment(MasterTableMetadata* mtm,
+               uint64_t tableId,
+               uint64_t keyHash,
+               uint64_t byteCount,
+               uint64_t recordCount);
+void decrement(MasterTableMetadata* mtm,
+               uint64_t tableId,
+               uint64_t byteCount,
+               uint64_t recordCount);
 void decrement(MasterTableMetadata* mtm,
                uint64_t tableId,
+               uint64_t keyHash,
                uint64_t byteCount,
                uint64_t recordCount);
 void serialize(Buffer* buf, MasterTableMetadata *mtm);
@@ -118,6 +169,15 @@ void serialize(Buffer* buf, MasterTableMetadata *mtm);
  */
 const uint64_t threshold = 24*1024*1024;  // 24 MB.
 
+/**
+ * Tables with at least this many bytes on a master also get a histogram in
+ * the digest (see DigestHistogram). Only tables this large are likely to
+ * need splitting during recovery. With a 64GB master this bounds the
+ * histograms to 256 * sizeof(DigestHistogram) = 66KB in the worst case,
+ * and to a few KB for typical masters that hold a handful of big tables.
+ */
+const uint64_t histogramThreshold = 256*1024*1024;  // 256 MB.
+
 /**
  * Simple structure representing a stats information entry in the serialized
  * format of TableStats (aka TableStats::Digest).
@@ -157,6 +217,31 @@ struct Digest {
     DigestEntry entries[0];
 } __attribute__((__packed__));
 
+/**
+ * Per-bucket statistics for a single large table. Zero or more of these
+ * follow the last DigestEntry in a Digest, preceded by a count (see
+ * DigestHistograms); digests written before histograms existed simply end
+ * after the entries.
+ */
+struct DigestHistogram {
+    /// Id of table whose histogram is contained herein.
+    uint64_t tableId;
+    /// Avg num bytes per key hash within each bucket.
+    float bytesPerKeyHash[histogramBuckets];
+    /// Avg num log records per key hash within each bucket.
+    float recordsPerKeyHash[histogramBuckets];
+} __attribute__((__packed__));
+
+/**
+ * The optional trailing part of a Digest that holds histograms.
+ */
+struct DigestHistograms {
+    /// Number of DigestHistogram structures that follow.
+    uint64_t histogramCount;
+    /// Memory location of histograms immediately following this struct.
+    DigestHistogram histograms[0];
+} __attribute__((__packed__));
+
 /**
  * Provides estimated tablet size and record count information.  Estimates are
  * only used to inform the tablet partitioning algorithm on the coordinator
@@ -172,8 +257,10 @@ class Estimator {
         uint64_t recordCount;
     };
 
-    explicit Estimator(const Digest* digest);
+    explicit Estimator(const Digest* digest, uint32_t digestBytes = 0);
     Estimate estimate(Tablet *tablet);
+    bool hasHistogram(uint64_t tableId);
+    uint64_t findSplitKeyHash(Tablet* tablet, Estimate target);
 
     /// Flag indicating whether the estimator contains valid estimates
     bool valid;
@@ -199,6 +286,19 @@ class Estimator {
 
     /// Contains cumulative Entry information for tables below threshold.
     Entry otherStats;
+
+    /**
+     * Per-bucket statistics for a single table; see DigestHistogram.
+     */
+    struct Histogram {
+        Entry buckets[histogramBuckets];
+    };
+
+    /// Type defining map between tableId and Estimator::Histogram
+    typedef std::unordered_map<uint64_t, Histogram> HistogramMap;
+
+    /// Contains Histogram information for the tables that have one.
+    HistogramMap histograms;
 };
 
 } // namespace TableStats
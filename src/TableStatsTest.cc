@@ -150,6 +150,60 @@ TEST_F(TableStatsTest, increment) {
     }
 }
 
+TEST_F(TableStatsTest, increment_keyHash) {
+    TableStats::addKeyHashRange(&mtm, 0, 0, ~0UL);
+    TableStats::increment(&mtm, 0, 5, 100, 1);
+    TableStats::increment(&mtm, 0, 3 * TableStats::histogramBucketWidth, 20,
+                          2);
+    TableStats::increment(&mtm, 0, 7, 1);
+    MasterTableMetadata::Entry* entry = mtm.find(0);
+    ASSERT_FALSE(entry == NULL);
+    {
+        SpinLock::Guard _(entry->stats.lock);
+        EXPECT_EQ(127u, entry->stats.byteCount);
+        EXPECT_EQ(4u, entry->stats.recordCount);
+        EXPECT_EQ(100u, entry->stats.bucketByteCount[0]);
+        EXPECT_EQ(1u, entry->stats.bucketRecordCount[0]);
+        EXPECT_EQ(20u, entry->stats.bucketByteCount[3]);
+        EXPECT_EQ(2u, entry->stats.bucketRecordCount[3]);
+        EXPECT_EQ(0u, entry->stats.bucketByteCount[1]);
+    }
+
+    TableStats::decrement(&mtm, 0, 3 * TableStats::histogramBucketWidth, 5,
+                          1);
+    // Data counted without its key hash can't wrap a bucket.
+    TableStats::decrement(&mtm, 0, 5, 150, 2);
+    {
+        SpinLock::Guard _(entry->stats.lock);
+        EXPECT_EQ(15u, entry->stats.bucketByteCount[3]);
+        EXPECT_EQ(1u, entry->stats.bucketRecordCount[3]);
+        EXPECT_EQ(0u, entry->stats.bucketByteCount[0]);
+        EXPECT_EQ(0u, entry->stats.bucketRecordCount[0]);
+    }
+}
+
+TEST_F(TableStatsTest, addKeyHashRange_histogramBuckets) {
+    uint64_t width = TableStats::histogramBucketWidth;
+    TableStats::addKeyHashRange(&mtm, 0, width - 10, 2 * width + 4);
+    MasterTableMetadata::Entry* entry = mtm.find(0);
+    ASSERT_FALSE(entry == NULL);
+    {
+        SpinLock::Guard _(entry->stats.lock);
+        EXPECT_EQ(10u, entry->stats.bucketKeyHashCount[0]);
+        EXPECT_EQ(width, entry->stats.bucketKeyHashCount[1]);
+        EXPECT_EQ(5u, entry->stats.bucketKeyHashCount[2]);
+        EXPECT_EQ(0u, entry->stats.bucketKeyHashCount[3]);
+    }
+
+    TableStats::deleteKeyHashRange(&mtm, 0, width, 2 * width - 1);
+    {
+        SpinLock::Guard _(entry->stats.lock);
+        EXPECT_EQ(10u, entry->stats.bucketKeyHashCount[0]);
+        EXPECT_EQ(0u, entry->stats.bucketKeyHashCount[1]);
+        EXPECT_EQ(5u, entry->stats.bucketKeyHashCount[2]);
+    }
+}
+
 TEST_F(TableStatsTest, decrement) {
     MasterTableMetadata::Entry* entry;
     EXPECT_TRUE(mtm.find(1) == NULL);
@@ -354,4 +408,141 @@ TEST_F(TableStatsTest, estimator_estimate_basic) {
     entry = NULL;
 }
 
+TEST_F(TableStatsTest, serialize_histogram) {
+    uint64_t width = TableStats::histogramBucketWidth;
+    // Table 1 is big enough for a histogram; table 2 only gets an entry.
+    TableStats::addKeyHashRange(&mtm, 1, 0, 4 * width - 1);
+    TableStats::increment(&mtm, 1, 0, TableStats::histogramThreshold / 4,
+                          100);
+    TableStats::increment(&mtm, 1, 2 * width,
+                          TableStats::histogramThreshold / 2, 300);
+    // Data without a key hash is spread in proportion to the rest.
+    TableStats::increment(&mtm, 1, TableStats::histogramThreshold / 4, 0);
+    TableStats::addKeyHashRange(&mtm, 2, 0, 9);
+    TableStats::increment(&mtm, 2, TableStats::threshold, 10);
+
+    digestBuffer.reset();
+    TableStats::serialize(&digestBuffer, &mtm);
+    uint32_t histogramsOffset = sizeof32(TableStats::DigestHeader) +
+                                2 * sizeof32(TableStats::DigestEntry);
+    ASSERT_EQ(histogramsOffset + sizeof32(TableStats::DigestHistograms) +
+              sizeof32(TableStats::DigestHistogram), digestBuffer.size());
+    const TableStats::DigestHistograms* histograms =
+            digestBuffer.getOffset<TableStats::DigestHistograms>(
+                    histogramsOffset);
+    EXPECT_EQ(1u, histograms->histogramCount);
+    const TableStats::DigestHistogram* histogram = &histograms->histograms[0];
+    EXPECT_EQ(1u, histogram->tableId);
+    EXPECT_FLOAT_EQ(float(TableStats::histogramThreshold / 3) / float(width),
+                    histogram->bytesPerKeyHash[0]);
+    EXPECT_FLOAT_EQ(0, histogram->bytesPerKeyHash[1]);
+    EXPECT_FLOAT_EQ(float(TableStats::histogramThreshold * 2 / 3) /
+                    float(width), histogram->bytesPerKeyHash[2]);
+    EXPECT_FLOAT_EQ(100 / float(width), histogram->recordsPerKeyHash[0]);
+    EXPECT_FLOAT_EQ(300 / float(width), histogram->recordsPerKeyHash[2]);
+    // Buckets the master doesn't own are empty.
+    EXPECT_FLOAT_EQ(0, histogram->bytesPerKeyHash[4]);
+
+    // Without any large tables the digest ends after the entries.
+    MasterTableMetadata mtm2;
+    TableStats::addKeyHashRange(&mtm2, 2, 0, 9);
+    TableStats::increment(&mtm2, 2, TableStats::threshold, 10);
+    Buffer buffer;
+    TableStats::serialize(&buffer, &mtm2);
+    EXPECT_EQ(sizeof32(TableStats::DigestHeader) +
+              sizeof32(TableStats::DigestEntry), buffer.size());
+}
+
+TEST_F(TableStatsTest, estimator_constructor_histograms) {
+    uint64_t width = TableStats::histogramBucketWidth;
+    TableStats::addKeyHashRange(&mtm, 1, 0, ~0UL);
+    TableStats::increment(&mtm, 1, 5 * width, TableStats::histogramThreshold,
+                          1000);
+    digestBuffer.reset();
+    TableStats::serialize(&digestBuffer, &mtm);
+    const TableStats::Digest* digest =
+            reinterpret_cast<const TableStats::Digest*>(
+            digestBuffer.getRange(0, digestBuffer.size()));
+
+    // Without the digest's size, histograms are ignored.
+    TableStats::Estimator e1(digest);
+    EXPECT_FALSE(e1.hasHistogram(1));
+
+    // A truncated digest is treated like one without histograms.
+    TestLog::Enable _;
+    TableStats::Estimator e2(digest, digestBuffer.size() - 1);
+    EXPECT_FALSE(e2.hasHistogram(1));
+    EXPECT_EQ("Estimator: Table digest histograms truncated; ignoring them.",
+              TestLog::get());
+
+    TableStats::Estimator e3(digest, digestBuffer.size());
+    EXPECT_TRUE(e3.hasHistogram(1));
+    EXPECT_FALSE(e3.hasHistogram(2));
+    EXPECT_FLOAT_EQ(float(TableStats::histogramThreshold) / float(width),
+                    float(e3.histograms[1].buckets[5].bytesPerKeyHash));
+    EXPECT_FLOAT_EQ(0, float(e3.histograms[1].buckets[4].bytesPerKeyHash));
+}
+
+TEST_F(TableStatsTest, estimator_estimate_histogram) {
+    uint64_t width = TableStats::histogramBucketWidth;
+    TableStats::addKeyHashRange(&mtm, 1, 0, ~0UL);
+    TableStats::increment(&mtm, 1, 5 * width, TableStats::histogramThreshold,
+                          1000);
+    TableStats::increment(&mtm, 1, 6 * width, TableStats::histogramThreshold,
+                          1000);
+    digestBuffer.reset();
+    TableStats::serialize(&digestBuffer, &mtm);
+    TableStats::Estimator e(reinterpret_cast<const TableStats::Digest*>(
+            digestBuffer.getRange(0, digestBuffer.size())),
+            digestBuffer.size());
+
+    TableStats::Estimator::Estimate ret;
+    Tablet empty = {1, 0, 5 * width - 1, ServerId(), Tablet::NORMAL,
+                    LogPosition()};
+    ret = e.estimate(&empty);
+    EXPECT_EQ(0u, ret.byteCount);
+    EXPECT_EQ(0u, ret.recordCount);
+
+    // Half of bucket 5 plus all of bucket 6.
+    Tablet hot = {1, 5 * width + width / 2, ~0UL, ServerId(), Tablet::NORMAL,
+                  LogPosition()};
+    ret = e.estimate(&hot);
+    EXPECT_NEAR(double(TableStats::histogramThreshold) * 1.5,
+                double(ret.byteCount),
+                double(TableStats::histogramThreshold) * 0.001);
+    EXPECT_NEAR(1500, double(ret.recordCount), 1);
+}
+
+TEST_F(TableStatsTest, estimator_findSplitKeyHash) {
+    uint64_t width = TableStats::histogramBucketWidth;
+    TableStats::addKeyHashRange(&mtm, 1, 0, ~0UL);
+    TableStats::increment(&mtm, 1, 5 * width, TableStats::histogramThreshold,
+                          1000);
+    TableStats::increment(&mtm, 1, 6 * width, TableStats::histogramThreshold,
+                          1000);
+    digestBuffer.reset();
+    TableStats::serialize(&digestBuffer, &mtm);
+    TableStats::Estimator e(reinterpret_cast<const TableStats::Digest*>(
+            digestBuffer.getRange(0, digestBuffer.size())),
+            digestBuffer.size());
+
+    Tablet tablet = {1, 0, ~0UL, ServerId(), Tablet::NORMAL, LogPosition()};
+    TableStats::Estimator::Estimate half = {
+            TableStats::histogramThreshold, 0};
+    // Half of the data is in bucket 5, so the split lands at its end rather
+    // than in the middle of the key hash space.
+    uint64_t split = e.findSplitKeyHash(&tablet, half);
+    EXPECT_NEAR(double(6 * width - 1), double(split), double(width) * 0.001);
+
+    // Record counts alone also work.
+    TableStats::Estimator::Estimate quarter = {0, 500};
+    split = e.findSplitKeyHash(&tablet, quarter);
+    EXPECT_NEAR(double(5 * width + width / 2), double(split),
+                double(width) * 0.001);
+
+    // A target that can't be reached gives the whole tablet.
+    TableStats::Estimator::Estimate huge = {~0UL, ~0UL};
+    EXPECT_EQ(~0UL, e.findSplitKeyHash(&tablet, huge));
+}
+
 } // namespace RAMCloud
@@ -94,6 +94,7 @@ TimeTraceUtil::initStatusMessages()
                 opcodeMap[op] = RequestOp::WRITE;
                 break;
             case WireFormat::Opcode::BACKUP_WRITE:
+            case WireFormat::Opcode::BACKUP_MULTI_WRITE:
                 opcodeMap[op] = RequestOp::BACKUP_WRITE;
                 break;
             default:
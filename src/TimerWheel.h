@@ -0,0 +1,390 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_TIMERWHEEL_H
+#define RAMCLOUD_TIMERWHEEL_H
+
+#include "Common.h"
+#include "BitOps.h"
+#include "BoostIntrusive.h"
+
+namespace RAMCloud {
+
+/**
+ * A TimerWheel keeps track of a collection of timers, each with a trigger
+ * time measured in Cycles::rdtsc ticks, and finds the ones whose trigger
+ * times have passed. It is a hierarchical timing wheel: starting or
+ * stopping a timer takes constant time, and finding expired timers takes
+ * amortized constant time per timer, regardless of how many timers are
+ * running (this matters on servers in large clusters, which may have
+ * thousands of session and lease timers).
+ *
+ * Time is divided into ticks of 2^TICK_SHIFT cycles. The wheel has LEVELS
+ * levels of SLOTS slots each; a slot at level L covers SLOTS^L ticks. A
+ * timer is kept at the lowest level whose range covers its trigger time;
+ * when time reaches the part of a higher level that contains a timer, the
+ * timer moves ("cascades") to a lower level, until it reaches level 0,
+ * where it expires. Timers due more than SLOTS^LEVELS ticks (about half an
+ * hour on a 2.5 GHz machine) in the future wait in the farthest slot of
+ * the top level until they come within range.
+ *
+ * Entries are intrusive: T must have the following members, accessible to
+ * this class:
+ * - uint64_t triggerTime: when the timer should trigger. It must not be
+ *   modified while the timer is in the wheel.
+ * - int slot: used by this class. A negative value means the timer isn't
+ *   in the wheel; it must be negative when the timer is inserted.
+ * - IntrusiveListHook links: used by this class.
+ *
+ * This class does no synchronization: callers must ensure that only one
+ * thread at a time invokes its methods.
+ */
+template<typename T>
+class TimerWheel {
+  public:
+    /// Each tick is 2^TICK_SHIFT cycles: short enough compared to the
+    /// timeouts RAMCloud uses that timers rarely share a level-0 slot
+    /// unless they trigger at nearly the same time.
+    static const int TICK_SHIFT = 10;
+
+    /// log2 of the number of slots at each level.
+    static const int SLOT_BITS = 8;
+    static const uint32_t SLOTS = 1 << SLOT_BITS;
+
+    /// Number of levels in the wheel.
+    static const int LEVELS = 4;
+
+    /**
+     * Construct an empty TimerWheel.
+     *
+     * \param now
+     *      The current time (Cycles::rdtsc).
+     */
+    explicit TimerWheel(uint64_t now)
+        : currentTick(now >> TICK_SHIFT)
+        , count(0)
+        , slots()
+        , occupied()
+        , expired()
+    {}
+
+    /**
+     * Returns true if no timers are in the wheel.
+     */
+    bool
+    empty()
+    {
+        return count == 0;
+    }
+
+    /**
+     * Add a timer to the wheel, based on its current triggerTime.
+     *
+     * \param timer
+     *      Timer to add; must not already be in the wheel.
+     */
+    void
+    insert(T* timer)
+    {
+        assert(timer->slot < 0);
+        place(timer);
+        count++;
+    }
+
+    /**
+     * Remove a timer from the wheel (it won't be returned by popExpired,
+     * even if it has already been found to be expired).
+     *
+     * \param timer
+     *      Timer to remove; must currently be in the wheel.
+     */
+    void
+    remove(T* timer)
+    {
+        assert(timer->slot >= 0);
+        if (timer->slot == EXPIRED_SLOT) {
+            erase(expired, *timer);
+        } else {
+            int level = timer->slot / SLOTS;
+            uint32_t index = timer->slot % SLOTS;
+            TimerList& list = slots[level][index];
+            erase(list, *timer);
+            if (list.empty()) {
+                occupied[level][index / 64] &= ~(1lu << (index % 64));
+            }
+        }
+        timer->slot = -1;
+        count--;
+    }
+
+    /**
+     * Find all of the timers whose trigger times are no later than a given
+     * time; they will then be returned by popExpired.
+     *
+     * \param now
+     *      The current time (Cycles::rdtsc). If this is less than the
+     *      time passed to an earlier call (or to the constructor), the
+     *      wheel won't move backwards, but timers whose trigger time is
+     *      no later than now are still found.
+     */
+    void
+    advance(uint64_t now)
+    {
+        uint64_t nowTick = now >> TICK_SHIFT;
+        while (true) {
+            collect(now);
+            if (currentTick >= nowTick) {
+                break;
+            }
+
+            // Skip directly to the next tick where there is something to
+            // do, cascading timers from any higher levels whose slots
+            // start at that tick (highest level first, since its timers
+            // may belong in the slot cascaded at the next level down).
+            currentTick = std::min(nextEventTick(), nowTick);
+            for (int level = LEVELS - 1; level > 0; level--) {
+                if ((currentTick & ((1lu << (SLOT_BITS*level)) - 1)) == 0) {
+                    cascade(level);
+                }
+            }
+        }
+    }
+
+    /**
+     * Remove and return one of the timers found by #advance.
+     *
+     * \return
+     *      An expired timer (no longer in the wheel), or NULL if there are
+     *      none left. Timers are returned in the order their trigger times
+     *      were reached (to within one tick).
+     */
+    T*
+    popExpired()
+    {
+        if (expired.empty()) {
+            return NULL;
+        }
+        T* timer = &expired.front();
+        expired.pop_front();
+        timer->slot = -1;
+        count--;
+        return timer;
+    }
+
+    /**
+     * Return a time before which #advance won't find any expired timers.
+     * This is the exact trigger time of the next timer if it is due within
+     * the current tick, and otherwise the start of the next tick in which
+     * some timer expires or cascades. Computing it doesn't depend on the
+     * number of timers, except for those due in the current tick.
+     *
+     * \return
+     *      A time in Cycles::rdtsc units; ~0 if the wheel is empty.
+     */
+    uint64_t
+    nextCheckTime()
+    {
+        if (!expired.empty()) {
+            return 0;
+        }
+        if (count == 0) {
+            return ~0lu;
+        }
+        TimerList& current = slots[0][currentTick & (SLOTS - 1)];
+        if (!current.empty()) {
+            uint64_t earliest = ~0lu;
+            for (typename TimerList::iterator it = current.begin();
+                    it != current.end(); it++) {
+                earliest = std::min(earliest, it->triggerTime);
+            }
+            return earliest;
+        }
+        return nextEventTick() << TICK_SHIFT;
+    }
+
+    /**
+     * Return one of the timers in the wheel (without removing it), or NULL
+     * if the wheel is empty. Used to dismantle the wheel.
+     */
+    T*
+    any()
+    {
+        if (!expired.empty()) {
+            return &expired.front();
+        }
+        for (int level = 0; level < LEVELS; level++) {
+            int index = nextOccupied(level, 0);
+            if (index >= 0) {
+                return &slots[level][index].front();
+            }
+        }
+        return NULL;
+    }
+
+    /**
+     * Returns the number of timers in the wheel.
+     */
+    size_t
+    size()
+    {
+        return count;
+    }
+
+  PRIVATE:
+    INTRUSIVE_LIST_TYPEDEF(T, links) TimerList;
+
+    /// Value of T::slot for timers that are in #expired.
+    static const int EXPIRED_SLOT = LEVELS * SLOTS;
+
+    /**
+     * Move the timers in the level-0 slot for #currentTick whose trigger
+     * times have been reached to #expired.
+     */
+    void
+    collect(uint64_t now)
+    {
+        uint32_t index = downCast<uint32_t>(currentTick & (SLOTS - 1));
+        TimerList& list = slots[0][index];
+        typename TimerList::iterator it = list.begin();
+        while (it != list.end()) {
+            T* timer = &*it;
+            if (timer->triggerTime <= now) {
+                it = list.erase(it);
+                expired.push_back(*timer);
+                timer->slot = EXPIRED_SLOT;
+            } else {
+                it++;
+            }
+        }
+        if (list.empty()) {
+            occupied[0][index / 64] &= ~(1lu << (index % 64));
+        }
+    }
+
+    /**
+     * Redistribute the timers in the slot at a given level that starts at
+     * #currentTick to lower levels.
+     */
+    void
+    cascade(int level)
+    {
+        uint32_t index = downCast<uint32_t>(
+                (currentTick >> (SLOT_BITS*level)) & (SLOTS - 1));
+        TimerList& list = slots[level][index];
+        while (!list.empty()) {
+            T* timer = &list.front();
+            list.pop_front();
+            place(timer);
+        }
+        occupied[level][index / 64] &= ~(1lu << (index % 64));
+    }
+
+    /**
+     * Return the index of the first nonempty slot at a given level whose
+     * index is at least first, or -1 if there is none.
+     */
+    int
+    nextOccupied(int level, uint32_t first)
+    {
+        for (uint32_t i = first; i < SLOTS; i = (i / 64 + 1) * 64) {
+            uint64_t word = occupied[level][i / 64] >> (i % 64);
+            if (word != 0) {
+                return downCast<int>(i) + BitOps::findFirstSet(word) - 1;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * Return the first tick after #currentTick at which a level-0 slot
+     * has timers or a higher-level slot with timers must be cascaded;
+     * ~0 if there is none.
+     */
+    uint64_t
+    nextEventTick()
+    {
+        uint64_t result = ~0lu;
+        for (int level = 0; level < LEVELS; level++) {
+            int shift = SLOT_BITS * level;
+            uint64_t position = currentTick >> shift;
+            uint32_t index = downCast<uint32_t>(position & (SLOTS - 1));
+            int next = nextOccupied(level, index + 1);
+            if (next < 0) {
+                // Slots at or before the current one are for the wheel's
+                // next revolution at this level.
+                next = nextOccupied(level, 0);
+                if (next < 0) {
+                    continue;
+                }
+                next += SLOTS;
+            }
+            result = std::min(result, (position - index + next) << shift);
+        }
+        return result;
+    }
+
+    /**
+     * Put a timer in the right slot for its trigger time (relative to
+     * #currentTick).
+     */
+    void
+    place(T* timer)
+    {
+        uint64_t tick = std::max(timer->triggerTime >> TICK_SHIFT,
+                                 currentTick);
+        uint64_t delta = tick - currentTick;
+        int level = 0;
+        while ((level < LEVELS - 1) &&
+                ((delta >> (SLOT_BITS * (level + 1))) != 0)) {
+            level++;
+        }
+        if ((delta >> (SLOT_BITS * LEVELS)) != 0) {
+            // Beyond the wheel's range: wait in the farthest slot, then
+            // try again when that slot is cascaded.
+            tick = currentTick + (1lu << (SLOT_BITS * LEVELS)) - 1;
+        }
+        uint32_t index = downCast<uint32_t>(
+                (tick >> (SLOT_BITS * level)) & (SLOTS - 1));
+        slots[level][index].push_back(*timer);
+        occupied[level][index / 64] |= 1lu << (index % 64);
+        timer->slot = downCast<int>(level * SLOTS + index);
+    }
+
+    /// All timers with trigger times before this tick have been moved to
+    /// #expired (or were removed).
+    uint64_t currentTick;
+
+    /// Number of timers in the wheel (including #expired).
+    size_t count;
+
+    /// The wheel: timers not yet expired, each in the slot at the lowest
+    /// level whose range covers its trigger time. T::slot for a timer here
+    /// is level*SLOTS + index.
+    TimerList slots[LEVELS][SLOTS];
+
+    /// One bit for each element of #slots: 1 means the slot is not empty.
+    /// Used to skip quickly over empty slots.
+    uint64_t occupied[LEVELS][SLOTS / 64];
+
+    /// Timers found to be expired by #advance and not yet returned by
+    /// #popExpired.
+    TimerList expired;
+
+    DISALLOW_COPY_AND_ASSIGN(TimerWheel);
+};
+
+} // namespace RAMCloud
+
+#endif  // RAMCLOUD_TIMERWHEEL_H
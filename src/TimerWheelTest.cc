@@ -0,0 +1,251 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "TimerWheel.h"
+
+namespace RAMCloud {
+
+// Entries for the wheels in these tests. Each test declares its timers
+// before its wheel, so that any timers still in the wheel are unlinked
+// before they are destroyed.
+struct TestTimer {
+    explicit TestTimer(uint64_t triggerTime = 0)
+        : triggerTime(triggerTime)
+        , slot(-1)
+        , links()
+    {}
+    uint64_t triggerTime;
+    int slot;
+    IntrusiveListHook links;
+    DISALLOW_COPY_AND_ASSIGN(TestTimer);
+};
+
+class TimerWheelTest : public ::testing::Test {
+  public:
+    typedef TimerWheel<TestTimer> Wheel;
+
+    /// Length of one tick of the wheel, in cycles.
+    uint64_t tick;
+
+    TimerWheelTest()
+        : tick(1lu << Wheel::TICK_SHIFT)
+    {}
+
+    // Returns the trigger times of all the timers that popExpired
+    // returns for a wheel, in order.
+    string
+    popAll(Wheel* wheel)
+    {
+        string result;
+        TestTimer* timer;
+        while ((timer = wheel->popExpired()) != NULL) {
+            if (!result.empty()) {
+                result.append(" ");
+            }
+            result.append(format("%lu", timer->triggerTime));
+        }
+        return result;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(TimerWheelTest);
+};
+
+TEST_F(TimerWheelTest, insert) {
+    TestTimer t1(5*tick), t2(300*tick), t3(70000*tick), t4(1lu << 60);
+    Wheel wheel(0);
+    wheel.insert(&t1);
+    wheel.insert(&t2);
+    wheel.insert(&t3);
+    wheel.insert(&t4);
+    EXPECT_EQ(4U, wheel.size());
+    EXPECT_EQ(5, t1.slot);
+    EXPECT_EQ(Wheel::SLOTS + 1, downCast<uint32_t>(t2.slot));
+    EXPECT_EQ(2*Wheel::SLOTS + 1, downCast<uint32_t>(t3.slot));
+
+    // Beyond the wheel's range: goes in the farthest slot.
+    EXPECT_EQ(4*Wheel::SLOTS - 1, downCast<uint32_t>(t4.slot));
+    EXPECT_EQ(1lu << 5, wheel.occupied[0][0]);
+    EXPECT_EQ(1lu << 63, wheel.occupied[3][3]);
+}
+
+TEST_F(TimerWheelTest, insert_inThePast) {
+    TestTimer t1(10);
+    Wheel wheel(1000*tick);
+    wheel.insert(&t1);
+    EXPECT_EQ(1000 % Wheel::SLOTS, downCast<uint32_t>(t1.slot));
+    wheel.advance(10);
+    EXPECT_EQ("10", popAll(&wheel));
+}
+
+TEST_F(TimerWheelTest, remove) {
+    TestTimer t1(5*tick), t2(5*tick + 1), t3(7*tick);
+    Wheel wheel(0);
+    wheel.insert(&t1);
+    wheel.insert(&t2);
+    wheel.insert(&t3);
+    wheel.remove(&t1);
+    EXPECT_EQ(-1, t1.slot);
+    EXPECT_EQ(2U, wheel.size());
+    EXPECT_EQ((1lu << 5) | (1lu << 7), wheel.occupied[0][0]);
+    wheel.remove(&t2);
+    EXPECT_EQ(1lu << 7, wheel.occupied[0][0]);
+
+    // Remove an expired timer.
+    wheel.insert(&t1);
+    wheel.insert(&t2);
+    wheel.advance(8*tick);
+    EXPECT_TRUE(t2.slot == Wheel::EXPIRED_SLOT);
+    wheel.remove(&t2);
+    EXPECT_EQ(2U, wheel.size());
+    EXPECT_EQ(format("%lu %lu", 5*tick, 7*tick), popAll(&wheel));
+    EXPECT_EQ(0U, wheel.size());
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST_F(TimerWheelTest, advance_basics) {
+    TestTimer t1(100), t2(200), t3(3*tick);
+    Wheel wheel(0);
+    wheel.insert(&t3);
+    wheel.insert(&t2);
+    wheel.insert(&t1);
+    wheel.advance(150);
+    EXPECT_EQ("100", popAll(&wheel));
+    wheel.advance(3*tick - 1);
+    EXPECT_EQ("200", popAll(&wheel));
+    wheel.advance(3*tick);
+    EXPECT_EQ(format("%lu", 3*tick), popAll(&wheel));
+    EXPECT_EQ(0U, wheel.size());
+}
+
+TEST_F(TimerWheelTest, advance_cascade) {
+    TestTimer t1(300*tick + 5), t2(70000*tick + 7), t3(600*tick);
+    Wheel wheel(0);
+    wheel.insert(&t1);
+    wheel.insert(&t2);
+    wheel.insert(&t3);
+    wheel.advance(256*tick);
+    EXPECT_EQ("", popAll(&wheel));
+    EXPECT_EQ(300u % Wheel::SLOTS, downCast<uint32_t>(t1.slot));
+    wheel.advance(300*tick + 4);
+    EXPECT_EQ("", popAll(&wheel));
+    wheel.advance(300*tick + 5);
+    EXPECT_EQ(format("%lu", 300*tick + 5), popAll(&wheel));
+
+    // Jump over several cascades at once.
+    wheel.advance(70000*tick + 6);
+    EXPECT_EQ(format("%lu", 600*tick), popAll(&wheel));
+    EXPECT_EQ(70000u % Wheel::SLOTS, downCast<uint32_t>(t2.slot));
+    wheel.advance(80000*tick);
+    EXPECT_EQ(format("%lu", 70000*tick + 7), popAll(&wheel));
+}
+
+TEST_F(TimerWheelTest, advance_farFuture) {
+    TestTimer t1(1lu << 50);
+    Wheel wheel(0);
+    wheel.insert(&t1);
+    wheel.advance((1lu << 50) - 1);
+    EXPECT_EQ("", popAll(&wheel));
+    wheel.advance(1lu << 50);
+    EXPECT_EQ(format("%lu", 1lu << 50), popAll(&wheel));
+}
+
+TEST_F(TimerWheelTest, advance_backwards) {
+    TestTimer t1(600*tick);
+    Wheel wheel(500*tick);
+    wheel.insert(&t1);
+    wheel.advance(10*tick);
+    EXPECT_EQ("", popAll(&wheel));
+    EXPECT_EQ(500U, wheel.currentTick);
+    wheel.advance(600*tick);
+    EXPECT_EQ(format("%lu", 600*tick), popAll(&wheel));
+}
+
+TEST_F(TimerWheelTest, advance_randomized) {
+    // Many timers at random times: each must be found as soon as its
+    // trigger time has been reached, and not before.
+    const int numTimers = 2000;
+    std::vector<TestTimer*> timers;
+    uint64_t start = 1000*tick + 17;
+    Wheel wheel(start);
+    for (int i = 0; i < numTimers; i++) {
+        timers.push_back(new TestTimer(start +
+                (generateRandom() % (1lu << (Wheel::TICK_SHIFT + 20)))));
+        wheel.insert(timers.back());
+    }
+    uint64_t now = start;
+    int found = 0;
+    while (found < numTimers) {
+        now += generateRandom() % (1lu << (Wheel::TICK_SHIFT + 12));
+        wheel.advance(now);
+        TestTimer* timer;
+        while ((timer = wheel.popExpired()) != NULL) {
+            EXPECT_LE(timer->triggerTime, now);
+            found++;
+        }
+        foreach (TestTimer* t, timers) {
+            if (t->slot >= 0) {
+                EXPECT_GT(t->triggerTime, now);
+            }
+        }
+    }
+    EXPECT_EQ(0U, wheel.size());
+    foreach (TestTimer* t, timers) {
+        delete t;
+    }
+}
+
+TEST_F(TimerWheelTest, nextCheckTime) {
+    TestTimer t1(100), t2(50), t3(5*tick + 3), t4(1000*tick);
+    Wheel wheel(0);
+    EXPECT_EQ(~0lu, wheel.nextCheckTime());
+
+    // Timers in the current tick: exact time.
+    wheel.insert(&t1);
+    wheel.insert(&t2);
+    EXPECT_EQ(50U, wheel.nextCheckTime());
+
+    // Later ticks: the start of the tick.
+    wheel.remove(&t1);
+    wheel.remove(&t2);
+    wheel.insert(&t3);
+    EXPECT_EQ(5*tick, wheel.nextCheckTime());
+
+    // Higher levels: the time of the next cascade.
+    wheel.remove(&t3);
+    wheel.insert(&t4);
+    EXPECT_EQ(768*tick, wheel.nextCheckTime());
+
+    // Expired timers.
+    wheel.advance(2000*tick);
+    EXPECT_EQ(0U, wheel.nextCheckTime());
+}
+
+TEST_F(TimerWheelTest, any) {
+    TestTimer t1(100000*tick), t2(5);
+    Wheel wheel(0);
+    EXPECT_TRUE(wheel.any() == NULL);
+    wheel.insert(&t1);
+    EXPECT_EQ(&t1, wheel.any());
+    wheel.insert(&t2);
+    EXPECT_EQ(&t2, wheel.any());
+    wheel.advance(10);
+    EXPECT_EQ(&t2, wheel.any());
+    wheel.remove(&t2);
+    wheel.remove(&t1);
+    EXPECT_TRUE(wheel.any() == NULL);
+}
+
+}  // namespace RAMCloud
@@ -26,6 +26,7 @@
 #include "Exception.h"
 
 namespace RAMCloud {
+class DispatchThread;
 class ServiceLocator;
 
 /**
@@ -79,6 +80,7 @@ class Transport {
             , epoch(0)
             , activities(~0)
             , outstandingRpcListHook()
+            , dispatchThread(NULL)
         {}
 
       public:
@@ -163,6 +165,13 @@ class Transport {
          */
         IntrusiveListHook outstandingRpcListHook;
 
+        /**
+         * If this RPC arrived on one of a server's extra dispatch threads,
+         * this is that thread, which must send the reply; NULL means the
+         * RPC arrived on the main dispatch thread. See DispatchPool.
+         */
+        DispatchThread* dispatchThread;
+
       PRIVATE:
         DISALLOW_COPY_AND_ASSIGN(ServerRpc);
     };
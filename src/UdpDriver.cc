@@ -52,7 +52,8 @@ Syscall* UdpDriver::sys = &defaultSyscall;
  *      identifying the desired socket.  If NULL then a port will be
  *      chosen by system software. Typically the socket is specified
  *      explicitly for server-side drivers but not for client-side
- *      drivers.
+ *      drivers. The option "reusePort=1" allows other drivers to listen
+ *      on the same socket address.
  */
 UdpDriver::UdpDriver(Context* context,
         const ServiceLocator* localServiceLocator)
@@ -92,6 +93,19 @@ UdpDriver::UdpDriver(Context* context,
     }
 
     if (localServiceLocator != NULL) {
+        // "reusePort=1" lets several drivers (one per dispatch thread, see
+        // DispatchPool) listen on the same port; the kernel spreads the
+        // incoming flows among them.
+        if (localServiceLocator->getOption<bool>("reusePort", false)) {
+            int optval = 1;
+            if (sys->setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &optval,
+                                sizeof(optval)) != 0) {
+                int e = errno;
+                sys->close(fd);
+                throw DriverException(HERE,
+                        "UdpDriver couldn't set SO_REUSEPORT", e);
+            }
+        }
         IpAddress ipAddress(localServiceLocator);
         int r = sys->bind(fd, &ipAddress.address, sizeof(ipAddress.address));
         if (r == -1) {
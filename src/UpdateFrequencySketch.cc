@@ -0,0 +1,138 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "BitOps.h"
+#include "UpdateFrequencySketch.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct an empty sketch, in which every key has an estimate of zero.
+ *
+ * \param countersPerRow
+ *      Number of counters in each row of the sketch; must be a power of two.
+ *      More counters mean fewer collisions between keys. The sketch uses one
+ *      byte per counter per row.
+ * \param hotThreshold
+ *      recordUpdate() reports keys whose estimated number of recent updates
+ *      reaches this value as hot.
+ */
+UpdateFrequencySketch::UpdateFrequencySketch(uint32_t countersPerRow,
+                                             uint8_t hotThreshold)
+    : rowShift(BitOps::findFirstSet(countersPerRow) - 1),
+      rowMask(countersPerRow - 1),
+      hotThreshold(hotThreshold),
+      agingInterval(10UL * countersPerRow),
+      updatesSinceAging(0),
+      agingLock("UpdateFrequencySketch::agingLock"),
+      counters(new std::atomic<uint8_t>[NUM_ROWS * countersPerRow])
+{
+    if (!BitOps::isPowerOfTwo(countersPerRow)) {
+        throw FatalError(HERE, format("UpdateFrequencySketch needs a power of "
+            "two counters per row, not %u", countersPerRow));
+    }
+    for (uint64_t i = 0; i < NUM_ROWS * countersPerRow; i++)
+        counters[i].store(0, std::memory_order_relaxed);
+}
+
+/**
+ * Return an estimate of the number of times the given key has been updated
+ * recently. The estimate is never lower than the true count since the last
+ * aging (unless concurrent updates were lost), but collisions may make it
+ * higher.
+ *
+ * \param keyHash
+ *      Hash of the key (see Key::getHash()).
+ */
+uint8_t
+UpdateFrequencySketch::estimate(uint64_t keyHash)
+{
+    uint8_t min = MAX_COUNT;
+    for (uint32_t row = 0; row < NUM_ROWS; row++) {
+        uint8_t count = counters[getIndex(keyHash, row)].load(
+                std::memory_order_relaxed);
+        if (count < min)
+            min = count;
+    }
+    return min;
+}
+
+/**
+ * Note that the given key is being updated, and decide whether it should be
+ * treated as hot.
+ *
+ * \param keyHash
+ *      Hash of the key (see Key::getHash()).
+ * \return
+ *      True if, counting this update, the key's estimated number of recent
+ *      updates has reached the threshold given to the constructor.
+ */
+bool
+UpdateFrequencySketch::recordUpdate(uint64_t keyHash)
+{
+    uint64_t indexes[NUM_ROWS];
+    uint8_t min = MAX_COUNT;
+    for (uint32_t row = 0; row < NUM_ROWS; row++) {
+        indexes[row] = getIndex(keyHash, row);
+        uint8_t count = counters[indexes[row]].load(std::memory_order_relaxed);
+        if (count < min)
+            min = count;
+    }
+
+    // Conservative update: only the counters holding the current estimate
+    // need to grow for the estimate to grow. Leaving the others alone keeps
+    // keys that share them from looking hotter than they are.
+    if (min < MAX_COUNT) {
+        for (uint32_t row = 0; row < NUM_ROWS; row++) {
+            if (counters[indexes[row]].load(std::memory_order_relaxed) == min) {
+                counters[indexes[row]].store(downCast<uint8_t>(min + 1),
+                                             std::memory_order_relaxed);
+            }
+        }
+        min++;
+    }
+
+    if (updatesSinceAging.fetch_add(1, std::memory_order_relaxed) + 1 >=
+            agingInterval) {
+        age();
+    }
+
+    return min >= hotThreshold;
+}
+
+/**
+ * Halve every counter, so that writes made long ago count for less than
+ * recent ones. If another thread is already doing this, return immediately.
+ */
+void
+UpdateFrequencySketch::age()
+{
+    if (!agingLock.try_lock())
+        return;
+
+    // Check again: the thread that held the lock may have just aged.
+    if (updatesSinceAging.load(std::memory_order_relaxed) >= agingInterval) {
+        updatesSinceAging.store(0, std::memory_order_relaxed);
+        uint64_t numCounters = NUM_ROWS * (rowMask + 1);
+        for (uint64_t i = 0; i < numCounters; i++) {
+            uint8_t count = counters[i].load(std::memory_order_relaxed);
+            counters[i].store(downCast<uint8_t>(count / 2),
+                              std::memory_order_relaxed);
+        }
+    }
+    agingLock.unlock();
+}
+
+} // namespace RAMCloud
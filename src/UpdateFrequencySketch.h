@@ -0,0 +1,106 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_UPDATEFREQUENCYSKETCH_H
+#define RAMCLOUD_UPDATEFREQUENCYSKETCH_H
+
+#include <atomic>
+#include <memory>
+
+#include "Common.h"
+#include "SpinLock.h"
+
+namespace RAMCloud {
+
+/**
+ * This class estimates how often each key has been written recently, so that
+ * the ObjectManager can steer frequently overwritten ("hot") objects into a
+ * log head of their own. Segments full of hot objects then die together and
+ * are nearly free to clean, rather than hot and cold data being mixed in
+ * every head segment.
+ *
+ * The estimates come from a count-min sketch: a few rows of small saturating
+ * counters, each row indexed by a different hash of the key. A key's estimate
+ * is the smallest of its counters, so collisions can only make a key look
+ * hotter than it is. Counters are updated conservatively (only the smallest
+ * are incremented), and every counter is periodically halved so that the
+ * estimates reflect recent writes rather than all writes ever made.
+ *
+ * The sketch never needs to be exact, so counters are read and written
+ * without locks; concurrent updates of the same counter may occasionally lose
+ * an increment. This class is thread-safe in the sense that it never corrupts
+ * itself.
+ */
+class UpdateFrequencySketch {
+  public:
+    UpdateFrequencySketch(uint32_t countersPerRow, uint8_t hotThreshold);
+    uint8_t estimate(uint64_t keyHash);
+    bool recordUpdate(uint64_t keyHash);
+
+  PRIVATE:
+    void age();
+
+    /**
+     * Return the index into #counters of the given key's counter in the
+     * given row.
+     */
+    uint64_t
+    getIndex(uint64_t keyHash, uint32_t row)
+    {
+        // Multiplying by a different odd constant per row and taking the
+        // high-order bits gives each row a nearly independent hash.
+        static const uint64_t multipliers[NUM_ROWS] = {
+            0x9e3779b97f4a7c15UL, 0xc2b2ae3d27d4eb4fUL,
+            0x165667b19e3779f9UL, 0xd6e8feb86659fd93UL
+        };
+        uint64_t hash = (keyHash * multipliers[row]) >> 32;
+        return (static_cast<uint64_t>(row) << rowShift) + (hash & rowMask);
+    }
+
+    /// Number of rows of counters (i.e. hash functions) in the sketch.
+    static const uint32_t NUM_ROWS = 4;
+
+    /// Largest value a counter can hold.
+    static const uint8_t MAX_COUNT = 255;
+
+    /// Log2 of the number of counters in each row.
+    const uint32_t rowShift;
+
+    /// Mask selecting a counter within a row.
+    const uint64_t rowMask;
+
+    /// A key whose estimate reaches this many updates is considered hot by
+    /// recordUpdate().
+    const uint8_t hotThreshold;
+
+    /// Number of updates recorded between each halving of the counters.
+    const uint64_t agingInterval;
+
+    /// Number of updates recorded since the counters were last halved.
+    std::atomic<uint64_t> updatesSinceAging;
+
+    /// Held by the thread halving the counters, so that only one thread
+    /// does so at a time.
+    SpinLock agingLock;
+
+    /// NUM_ROWS rows of counters, stored one row after another.
+    std::unique_ptr<std::atomic<uint8_t>[]> counters;
+
+    DISALLOW_COPY_AND_ASSIGN(UpdateFrequencySketch);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_UPDATEFREQUENCYSKETCH_H
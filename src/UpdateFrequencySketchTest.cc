@@ -0,0 +1,122 @@
+/* Copyright (c) 2017 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any purpose
+ * with or without fee is hereby granted, provided that the above copyright
+ * notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR ANY
+ * SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER
+ * RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF
+ * CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "UpdateFrequencySketch.h"
+
+namespace RAMCloud {
+
+class UpdateFrequencySketchTest : public ::testing::Test {
+  public:
+    UpdateFrequencySketch sketch;
+
+    UpdateFrequencySketchTest()
+        : sketch(1024, 3)
+    {
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(UpdateFrequencySketchTest);
+};
+
+TEST_F(UpdateFrequencySketchTest, constructor) {
+    EXPECT_EQ(10U, sketch.rowShift);
+    EXPECT_EQ(1023U, sketch.rowMask);
+    EXPECT_EQ(10240U, sketch.agingInterval);
+    for (uint32_t i = 0; i < 4 * 1024; i++)
+        EXPECT_EQ(0, sketch.counters[i].load());
+
+    EXPECT_THROW(UpdateFrequencySketch(1000, 3), FatalError);
+}
+
+TEST_F(UpdateFrequencySketchTest, getIndex) {
+    // Each row has its own range of counters.
+    for (uint32_t row = 0; row < 4; row++) {
+        uint64_t index = sketch.getIndex(0x123456789abcdefUL, row);
+        EXPECT_LE(row * 1024U, index);
+        EXPECT_GT((row + 1) * 1024U, index);
+    }
+
+    // Keys that share a counter in one row usually don't in the others.
+    uint32_t sharedRows = 0;
+    for (uint32_t row = 0; row < 4; row++) {
+        if (sketch.getIndex(1, row) == sketch.getIndex(2, row))
+            sharedRows++;
+    }
+    EXPECT_GT(4U, sharedRows);
+}
+
+TEST_F(UpdateFrequencySketchTest, estimate) {
+    EXPECT_EQ(0, sketch.estimate(7));
+    sketch.counters[sketch.getIndex(7, 0)] = 5;
+    sketch.counters[sketch.getIndex(7, 1)] = 2;
+    sketch.counters[sketch.getIndex(7, 2)] = 9;
+    sketch.counters[sketch.getIndex(7, 3)] = 4;
+    EXPECT_EQ(2, sketch.estimate(7));
+}
+
+TEST_F(UpdateFrequencySketchTest, recordUpdate) {
+    EXPECT_FALSE(sketch.recordUpdate(7));
+    EXPECT_EQ(1, sketch.estimate(7));
+    EXPECT_FALSE(sketch.recordUpdate(7));
+    EXPECT_TRUE(sketch.recordUpdate(7));
+    EXPECT_EQ(3, sketch.estimate(7));
+    EXPECT_EQ(3U, sketch.updatesSinceAging.load());
+
+    // Only the smallest counters grow.
+    sketch.counters[sketch.getIndex(8, 0)] = 6;
+    sketch.recordUpdate(8);
+    EXPECT_EQ(6, sketch.counters[sketch.getIndex(8, 0)].load());
+    EXPECT_EQ(1, sketch.estimate(8));
+
+    // Counters saturate.
+    for (uint32_t row = 0; row < 4; row++)
+        sketch.counters[sketch.getIndex(9, row)] = 255;
+    EXPECT_TRUE(sketch.recordUpdate(9));
+    EXPECT_EQ(255, sketch.estimate(9));
+}
+
+TEST_F(UpdateFrequencySketchTest, recordUpdate_ages) {
+    sketch.recordUpdate(7);
+    sketch.recordUpdate(7);
+    sketch.updatesSinceAging = sketch.agingInterval - 2;
+    EXPECT_FALSE(sketch.recordUpdate(8));
+    EXPECT_EQ(2, sketch.estimate(7));
+    EXPECT_TRUE(sketch.recordUpdate(7));
+    EXPECT_EQ(0U, sketch.updatesSinceAging.load());
+    EXPECT_EQ(1, sketch.estimate(7));
+    EXPECT_EQ(0, sketch.estimate(8));
+}
+
+TEST_F(UpdateFrequencySketchTest, age) {
+    for (int i = 0; i < 5; i++)
+        sketch.recordUpdate(7);
+
+    // Not due yet.
+    sketch.age();
+    EXPECT_EQ(5, sketch.estimate(7));
+
+    // Another thread is already aging.
+    sketch.updatesSinceAging = sketch.agingInterval;
+    sketch.agingLock.lock();
+    sketch.age();
+    EXPECT_EQ(5, sketch.estimate(7));
+    sketch.agingLock.unlock();
+
+    sketch.age();
+    EXPECT_EQ(2, sketch.estimate(7));
+    EXPECT_EQ(0U, sketch.updatesSinceAging.load());
+}
+
+}  // namespace RAMCloud
@@ -122,6 +122,8 @@ opcodeSymbol(uint32_t opcode)
         case TX_REQUEST_ABORT:             return "TX_REQUEST_ABORT";
         case TX_HINT_FAILED:               return "TX_HINT_FAILED";
         case ECHO:                         return "ECHO";
+        case BACKUP_MULTI_WRITE:           return "BACKUP_MULTI_WRITE";
+        case BACKUP_CHAIN_WRITE:           return "BACKUP_CHAIN_WRITE";
         case ILLEGAL_RPC_TYPE:             return "ILLEGAL_RPC_TYPE";
     }
 
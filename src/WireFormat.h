@@ -130,7 +130,9 @@ enum Opcode {
     TX_REQUEST_ABORT            = 78,
     TX_HINT_FAILED              = 79,
     ECHO                        = 80,
-    ILLEGAL_RPC_TYPE            = 81, // 1 + the highest legitimate Opcode
+    BACKUP_MULTI_WRITE          = 81,
+    BACKUP_CHAIN_WRITE          = 82,
+    ILLEGAL_RPC_TYPE            = 83, // 1 + the highest legitimate Opcode
 };
 
 /**
@@ -394,6 +396,7 @@ struct BackupWrite {
             , primary()
             , certificateIncluded()
             , certificate()
+            , chainLength()
         {}
         Request(const RequestCommonWithId& common,
                 uint64_t masterId,
@@ -417,6 +420,7 @@ struct BackupWrite {
             , primary(primary)
             , certificateIncluded(certificateIncluded)
             , certificate(certificate)
+            , chainLength(0)
         {}
         RequestCommonWithId common;
         uint64_t masterId;        ///< Server from whom the request is coming.
@@ -440,10 +444,71 @@ struct BackupWrite {
                                         ///< written to storage
                                         ///< following the data included
                                         ///< in this rpc.
-        // Opaque byte string follows with data to write.
+        uint8_t chainLength;      ///< Number of backup ids that follow this
+                                  ///< header. The receiving backup passes
+                                  ///< the write on to each of them in a
+                                  ///< BACKUP_CHAIN_WRITE (chain replication).
+        // chainLength uint64_t backup ids follow, then an opaque byte
+        // string with the data to write.
     } __attribute__((packed));
     struct Response {
         ResponseCommon common;
+        uint8_t chainAcked;       ///< How many of the backups in the
+                                  ///< request's chain (counting from the
+                                  ///< first) stored the write.
+    } __attribute__((packed));
+};
+
+/**
+ * A write that a backup received in a BACKUP_WRITE and passes on to another
+ * backup in the request's chain. It has its own opcode so that it sits one
+ * RPC level below BACKUP_WRITE; its chainLength must be 0, since a backup
+ * never forwards a chained write any further.
+ */
+struct BackupChainWrite {
+    static const Opcode opcode = BACKUP_CHAIN_WRITE;
+    static const ServiceType service = BACKUP_SERVICE;
+    typedef BackupWrite::Request Request;
+    typedef BackupWrite::Response Response;
+};
+
+struct BackupMultiWrite {
+    static const Opcode opcode = BACKUP_MULTI_WRITE;
+    static const ServiceType service = BACKUP_SERVICE;
+    struct Request {
+        RequestCommonWithId common;
+        uint64_t masterId;        ///< Server from whom the request is coming.
+        uint32_t count;           ///< Number of Parts that follow.
+        // count Parts follow, each immediately followed by its data.
+    } __attribute__((packed));
+    /// One write to one replica; fields as in BackupWrite::Request.
+    struct Part {
+        Part()
+            : segmentId()
+            , segmentEpoch()
+            , offset()
+            , length()
+            , open()
+            , close()
+            , primary()
+            , certificateIncluded()
+            , certificate()
+        {}
+        uint64_t segmentId;
+        uint64_t segmentEpoch;
+        uint32_t offset;
+        uint32_t length;
+        bool open;
+        bool close;
+        bool primary;
+        bool certificateIncluded;
+        SegmentCertificate certificate;
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+        uint32_t count;           ///< Number of Status values that follow,
+                                  ///< one for each Part of the request, in
+                                  ///< order.
     } __attribute__((packed));
 };
 
@@ -17,6 +17,7 @@
 #include "BitOps.h"
 #include "Cycles.h"
 #include "CycleCounter.h"
+#include "DispatchPool.h"
 #include "Fence.h"
 #include "Initialize.h"
 #include "LogProtector.h"
@@ -66,6 +67,10 @@ static Syscall defaultSyscall;
  */
 Syscall* WorkerManager::sys = &defaultSyscall;
 
+// PerfStats keeps latency statistics for each RpcClass.
+static_assert(PerfStats::RPC_CLASSES == WorkerManager::NUM_RPC_CLASSES,
+              "PerfStats::RPC_CLASSES doesn't match WorkerManager");
+
 // Length of time that a worker will actively poll for new work before it puts
 // itself to sleep. This period should be much longer than typical RPC
 // round-trip times so the worker thread doesn't go to sleep in an ongoing
@@ -73,6 +78,9 @@ Syscall* WorkerManager::sys = &defaultSyscall;
 // time it takes to wake up the thread once it has gone to sleep (as of
 // September 2011 this time appears to be as much as 50 microseconds).
 int WorkerManager::pollMicros = 10000;
+
+__thread uint64_t WorkerManager::inlineWindowStart = 0;
+__thread uint64_t WorkerManager::inlineWindowUsed = 0;
 // The following constant is used to signal a worker thread that
 // it should exit.
 #define WORKER_EXIT reinterpret_cast<Transport::ServerRpc*>(1)
@@ -87,8 +95,16 @@ int WorkerManager::pollMicros = 10000;
  *      threads doesn't exceed this value. However, in order to prevent
  *      deadlocks, it may occasionally be necessary to go beyond this
  *      limit.
+ * \param inlineShortRpcs
+ *      True means cheap read-only RPCs may be executed in the thread that
+ *      received them instead of being handed to a worker; see runInline.
+ * \param elasticCores
+ *      True means idle workers are parked when the load doesn't need them,
+ *      so that they don't occupy cores by polling for work; see
+ *      updateActiveCores.
  */
-WorkerManager::WorkerManager(Context* context, uint32_t maxCores)
+WorkerManager::WorkerManager(Context* context, uint32_t maxCores,
+                             bool inlineShortRpcs, bool elasticCores)
     : Dispatch::Poller(context->dispatch, "WorkerManager")
     , context(context)
     , levels()
@@ -98,6 +114,24 @@ WorkerManager::WorkerManager(Context* context, uint32_t maxCores)
     , rpcsWaiting(0)
     , testingSaveRpcs(0)
     , testRpcs()
+    , inlineShortRpcs(inlineShortRpcs)
+    , inlineWindowCycles(Cycles::fromNanoseconds(20000))
+    , elasticCores(elasticCores)
+    , activeCores(maxCores)
+    , parkedWorkers(0)
+    , loadIntervalCycles(Cycles::fromMicroseconds(LOAD_INTERVAL_MICROS))
+    , lastLoadSample(Cycles::rdtsc())
+    , loadIntervalStart(lastLoadSample)
+    , busyCycles(0)
+    , peakDemand(0)
+    , lowLoadIntervals(0)
+    , policy(FIFO)
+    , classWeights()
+    , classPass()
+    , currentPass(0)
+    , classRunning()
+    , classWaiting()
+    , backgroundLimit(0)
 {
     levels.resize(RpcLevel::maxLevel() + 1);
 
@@ -135,6 +169,81 @@ WorkerManager::~WorkerManager()
     }
 }
 
+/**
+ * Decide whether an RPC may start executing now or must wait for a
+ * thread. Once we reach our desired concurrency limit (or, for
+ * BACKGROUND_RPCs, the admission limit for that class), only start a new
+ * request if its level is lower than that of any other running request.
+ * This ensures that we will always have enough threads to execute one
+ * request at each level, and this prevents distributed deadlock (deadlock
+ * could occur if all of the servers use up all of their threads on
+ * high-level requests, then those requests invoke lower-level RPCs to other
+ * servers, but none of the servers have threads to execute those
+ * lower-level requests).
+ *
+ * \param level
+ *      RpcLevel of the RPC.
+ * \param rpcClass
+ *      RpcClass of the RPC.
+ * \param running
+ *      Number of workers currently executing RPCs.
+ * \return
+ *      True means the RPC may start.
+ */
+bool
+WorkerManager::canStart(int level, RpcClass rpcClass, size_t running)
+{
+    if ((running < maxCores) && ((rpcClass != BACKGROUND_RPC) ||
+            (backgroundLimit == 0) ||
+            (classRunning[BACKGROUND_RPC] < backgroundLimit))) {
+        return true;
+    }
+    for (int i = level; i >= 0; i--) {
+        if (levels[i].requestsRunning > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Determine the scheduling class of an incoming request.
+ *
+ * \param opcode
+ *      The request's opcode.
+ * \param request
+ *      The request message.
+ */
+WorkerManager::RpcClass
+WorkerManager::getRpcClass(WireFormat::Opcode opcode, Buffer* request)
+{
+    switch (opcode) {
+        case WireFormat::READ:
+        case WireFormat::READ_KEYS_AND_VALUE:
+        case WireFormat::READ_HASHES:
+        case WireFormat::WRITE:
+        case WireFormat::REMOVE:
+        case WireFormat::INCREMENT:
+        case WireFormat::MULTI_OP:
+            return INTERACTIVE_RPC;
+        case WireFormat::TX_PREPARE: {
+            const WireFormat::TxPrepare::Request* reqHdr =
+                    request->getStart<WireFormat::TxPrepare::Request>();
+            if ((reqHdr != NULL) && (reqHdr->opCount > MAX_INTERACTIVE_TX_OPS))
+                return BACKGROUND_RPC;
+            return INTERACTIVE_RPC;
+        }
+        case WireFormat::ENUMERATE:
+        case WireFormat::FILL_WITH_TEST_DATA:
+        case WireFormat::MIGRATE_TABLET:
+        case WireFormat::RECEIVE_MIGRATION_DATA:
+        case WireFormat::SPLIT_AND_MIGRATE_INDEXLET:
+            return BACKGROUND_RPC;
+        default:
+            return NORMAL_RPC;
+    }
+}
+
 /**
  * Transports invoke this method when an incoming RPC is complete and
  * ready for processing.  This method will arrange for the RPC (eventually)
@@ -148,6 +257,24 @@ WorkerManager::~WorkerManager()
 void
 WorkerManager::handleRpc(Transport::ServerRpc* rpc)
 {
+    if (inlineShortRpcs) {
+        const WireFormat::RequestCommon* header =
+                rpc->requestPayload.getStart<WireFormat::RequestCommon>();
+        if ((header != NULL) &&
+                runInline(rpc, WireFormat::Opcode(header->opcode))) {
+            return;
+        }
+    }
+
+    DispatchThread* dispatchThread = DispatchThread::current();
+    if (dispatchThread != NULL) {
+        // The RPC arrived on one of the DispatchPool's threads; the state
+        // below belongs to the main dispatch thread, so pass it there (it
+        // will come back here from DispatchPool::poll).
+        dispatchThread->forwardRequest(rpc);
+        return;
+    }
+
     // Find the service for this RPC.
     const WireFormat::RequestCommon* header;
     header = rpc->requestPayload.getStart<WireFormat::RequestCommon>();
@@ -170,7 +297,7 @@ WorkerManager::handleRpc(Transport::ServerRpc* rpc)
             Service::prepareErrorResponse(&rpc->replyPayload,
                     STATUS_UNIMPLEMENTED_REQUEST);
         }
-        rpc->sendReply();
+        sendReply(rpc);
         return;
     }
 
@@ -190,16 +317,19 @@ WorkerManager::handleRpc(Transport::ServerRpc* rpc)
             MasterService* master = static_cast<MasterService*>(
                     context->services[WireFormat::MASTER_SERVICE]);
             master->dispatch(WireFormat::ECHO, &serviceRpc);
-            rpc->sendReply();
+            sendReply(rpc);
             return;
         }
 #endif
         Service::handleRpc(context, &serviceRpc);
-        rpc->sendReply();
+        sendReply(rpc);
         return;
     }
 
+    uint64_t arrivalTime = Cycles::rdtsc();
     int level = RpcLevel::getLevel(WireFormat::Opcode(header->opcode));
+    RpcClass rpcClass = getRpcClass(WireFormat::Opcode(header->opcode),
+                                    &rpc->requestPayload);
     timeTrace("handleRpc processing opcode %d", header->opcode);
 #ifdef LOG_RPCS
     LOG(NOTICE, "Received %s RPC at %lu with %u bytes",
@@ -208,25 +338,16 @@ WorkerManager::handleRpc(Transport::ServerRpc* rpc)
             rpc->requestPayload.size());
 #endif
 
-    // See if we should start executing this request. Once we reach our
-    // desired concurrency limit, only start a new request if its level
-    // is lower than that of any other running request. This ensures that
-    // we will always have enough threads to execute one request at
-    // each level, and this prevents distributed deadlock (deadlock could
-    // occur if all of the servers use up all of their threads on high-level
-    // requests, then those requests invoke lower-level RPCs to other
-    // servers, but none of the servers have threads to execute those
-    // lower-level requests).
-    if (busyThreads.size() >= maxCores) {
-        for (int i = level; i >= 0; i--) {
-            if (levels[i].requestsRunning > 0) {
-                // Can't run this request right now.
-                levels[level].waitingRpcs.push(rpc);
-                rpcsWaiting++;
-                timeTrace("RPC deferred; threads busy");
-                return;
-            }
+    // See if we should start executing this request.
+    if (!canStart(level, rpcClass, busyThreads.size())) {
+        if ((policy == WEIGHTED) && (classWaiting[rpcClass] == 0)) {
+            classPass[rpcClass] = std::max(classPass[rpcClass], currentPass);
         }
+        levels[level].waitingRpcs[rpcClass].emplace(rpc, arrivalTime);
+        classWaiting[rpcClass]++;
+        rpcsWaiting++;
+        timeTrace("RPC deferred; threads busy");
+        return;
     }
 
     // Temporary code to test how much faster things would be without threads.
@@ -236,22 +357,125 @@ WorkerManager::handleRpc(Transport::ServerRpc* rpc)
         Service::Rpc serviceRpc(NULL, &rpc->requestPayload,
                 &rpc->replyPayload);
         Service::handleRpc(context, &serviceRpc);
-        rpc->sendReply();
+        sendReply(rpc);
         return;
     }
 #endif
 
-    levels[level].requestsRunning++;
-
     // Hand off the RPC to a worker thread.
     assert(!idleThreads.empty());
     Worker* worker = idleThreads.back();
     idleThreads.pop_back();
+    if (idleThreads.size() < parkedWorkers) {
+        // No polling worker was left; this one will have to be woken up.
+        parkedWorkers--;
+    }
     worker->opcode = WireFormat::Opcode(header->opcode);
-    worker->level = level;
-    worker->handoff(rpc);
+    startRpc(worker, rpc, level, rpcClass, arrivalTime);
     worker->busyIndex = downCast<int>(busyThreads.size());
     busyThreads.push_back(worker);
+    if (busyThreads.size() > activeCores) {
+        // The load is rising; don't wait for updateActiveCores to notice,
+        // or the workers now going idle would be parked.
+        activeCores = std::min(downCast<uint32_t>(busyThreads.size()),
+                               maxCores);
+        lowLoadIntervals = 0;
+    }
+}
+
+/**
+ * Execute an RPC in the calling thread (the dispatch thread or one of the
+ * DispatchPool's threads) if it is cheap enough: this saves the cost of
+ * handing it to a worker and back, which is a significant part of the
+ * latency of a small read. Only short reads are eligible, and the time
+ * spent is limited to MAX_INLINE_PERCENT of each window so that the thread
+ * keeps polling its transports.
+ *
+ * Reads can block: an object that isn't replicated yet must be synced to
+ * backups, and a read may have to take a hash table bucket lock that a
+ * worker holds while it waits for the dispatch thread. Both are finished by
+ * the dispatch thread, so a DispatchPool thread may wait for them but the
+ * dispatch thread itself must not. There, reads run with
+ * Service::Rpc::mustNotBlock set, and any read that would have to wait is
+ * handed to a worker instead.
+ *
+ * \param rpc
+ *      An incoming request with a complete header.
+ * \param opcode
+ *      The request's opcode.
+ * \return
+ *      True means the RPC was executed and its reply sent; false means
+ *      it must be handed to a worker as usual.
+ */
+bool
+WorkerManager::runInline(Transport::ServerRpc* rpc, WireFormat::Opcode opcode)
+{
+    bool mustNotBlock = (DispatchThread::current() == NULL);
+    switch (opcode) {
+        case WireFormat::READ:
+        case WireFormat::READ_KEYS_AND_VALUE:
+            break;
+        case WireFormat::READ_HASHES:
+            // Always takes bucket locks, so it can't avoid blocking.
+            if (mustNotBlock) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+    if (rpc->requestPayload.size() > MAX_INLINE_REQUEST_BYTES) {
+        return false;
+    }
+
+    uint64_t start = Cycles::rdtsc();
+    if (start - inlineWindowStart >= inlineWindowCycles) {
+        inlineWindowStart = start;
+        inlineWindowUsed = 0;
+    }
+    if (inlineWindowUsed * 100 >= inlineWindowCycles * MAX_INLINE_PERCENT) {
+        PerfStats::threadStats.inlineRpcsDeferred++;
+        return false;
+    }
+
+    // Same as a worker would do; the epoch keeps any log memory referenced
+    // by the reply alive until the reply has been sent.
+    rpc->epoch = LogProtector::getCurrentEpoch();
+    Service::Rpc serviceRpc(NULL, &rpc->requestPayload, &rpc->replyPayload);
+    serviceRpc.mustNotBlock = mustNotBlock;
+    Service::handleRpc(context, &serviceRpc);
+    if (serviceRpc.wouldBlock) {
+        // Nothing was done that matters; a worker will start over.
+        rpc->replyPayload.reset();
+        inlineWindowUsed += Cycles::rdtsc() - start;
+        PerfStats::threadStats.inlineRpcsDeferred++;
+        return false;
+    }
+    sendReply(rpc);
+
+    uint64_t elapsed = Cycles::rdtsc() - start;
+    inlineWindowUsed += elapsed;
+    PerfStats::threadStats.inlineRpcs++;
+    PerfStats::threadStats.inlineRpcCycles += elapsed;
+    return true;
+}
+
+/**
+ * Send the reply for an RPC that has been serviced. If the RPC arrived on
+ * one of the DispatchPool's threads, the reply is sent by that thread.
+ * Must be invoked in the dispatch thread.
+ *
+ * \param rpc
+ *      RPC whose #replyPayload is complete.
+ */
+void
+WorkerManager::sendReply(Transport::ServerRpc* rpc)
+{
+    if (rpc->dispatchThread != NULL) {
+        rpc->dispatchThread->returnReply(rpc);
+    } else {
+        rpc->sendReply();
+    }
 }
 
 /**
@@ -274,6 +498,7 @@ int
 WorkerManager::poll()
 {
     int foundWork = 0;
+    sampleLoad();
 
     // Each iteration of the following loop checks the status of one active
     // worker. The order of iteration is crucial, since it allows us to
@@ -300,40 +525,18 @@ WorkerManager::poll()
         // Highest priority: if there are pending requests that are waiting
         // for workers, hand off a new request to this worker ASAP.
         bool startedNewRpc = false;
+        if (rpc != NULL) {
+            recordCompletion(worker);
+        }
         if (state != Worker::POSTPROCESSING) {
             levels[worker->level].requestsRunning--;
+            classRunning[worker->rpcClass]--;
             if (rpcsWaiting) {
-                // Start an RPC with the lowest level (this is most efficient,
-                // since it's more likely that there are other servers with
-                // resources tied up waiting for this RPC).
-                //
-                // In addition, we must observe the core limits, which means
-                // we don't start another RPC unless we have spare cores, or
-                // unless the RPC we would start is at a level lower than any
-                // other running RPC.
-                for (int i = 0; ; i++) {
-                    Level* level = &levels[i];
-                    if ((level->requestsRunning != 0) &&
-                            // Note: we haven't yet removed the current
-                            // thread from busyThreads, so the number of
-                            // running workers is one less than
-                            // busyThreads.size().
-                            (busyThreads.size() > maxCores)) {
-                        // Can't start another RPC without exceeding core
-                        // limits.
-                        break;
-                    }
-                    if (level->waitingRpcs.empty()) {
-                        continue;
-                    }
-                    rpcsWaiting--;
-                    level->requestsRunning++;
-                    worker->level = i;
-                    worker->handoff(level->waitingRpcs.front());
-                    level->waitingRpcs.pop();
-                    startedNewRpc = true;
-                    break;
-                }
+                // Note: we haven't yet removed the current thread from
+                // busyThreads, so the number of running workers is one
+                // less than busyThreads.size().
+                startedNewRpc = startWaitingRpc(worker,
+                                                busyThreads.size() - 1);
             }
         }
 
@@ -345,7 +548,7 @@ WorkerManager::poll()
                     reinterpret_cast<uint64_t>(rpc),
                     rpc->replyPayload.size());
 #endif
-            rpc->sendReply();
+            sendReply(rpc);
             timeTrace("sent reply for opcode %d, thread %d",
                     worker->threadId, worker->opcode);
 
@@ -364,9 +567,270 @@ WorkerManager::poll()
             idleThreads.push_back(worker);
         }
     }
+    if (foundWork) {
+        parkIdleWorkers();
+    }
     return foundWork;
 }
 
+/**
+ * When #elasticCores is set, ask idle workers to park (sleep until they
+ * are handed an RPC) until at most #activeCores workers are busy or
+ * polling. The workers parked are the ones that have been idle longest,
+ * since handleRpc picks the most recently idle worker first.
+ */
+void
+WorkerManager::parkIdleWorkers()
+{
+    if (!elasticCores) {
+        return;
+    }
+    size_t polling = idleThreads.size() - parkedWorkers;
+    size_t allowed = 0;
+    if (activeCores > busyThreads.size()) {
+        allowed = activeCores - busyThreads.size();
+    }
+    while (polling > allowed) {
+        idleThreads[parkedWorkers]->parkRequested = true;
+        parkedWorkers++;
+        polling--;
+    }
+}
+
+/**
+ * Invoked on each call to #poll: accounts for the load since the previous
+ * call and, at the end of each load interval, invokes updateActiveCores.
+ */
+void
+WorkerManager::sampleLoad()
+{
+    uint64_t now = context->dispatch->currentTime;
+    if (now <= lastLoadSample) {
+        return;
+    }
+    uint64_t elapsed = now - lastLoadSample;
+    lastLoadSample = now;
+    busyCycles += busyThreads.size() * elapsed;
+    PerfStats::threadStats.workerCoreCycles += activeCores * elapsed;
+    uint32_t demand = downCast<uint32_t>(busyThreads.size()) +
+            downCast<uint32_t>(rpcsWaiting);
+    peakDemand = std::max(peakDemand, demand);
+
+    if (now - loadIntervalStart >= loadIntervalCycles) {
+        if (elasticCores) {
+            updateActiveCores(now - loadIntervalStart);
+        }
+        loadIntervalStart = now;
+        busyCycles = 0;
+        peakDemand = demand;
+    }
+}
+
+/**
+ * Invoked at the end of each load interval when #elasticCores is set:
+ * decides how many cores the workers need, based on the total service time
+ * of the RPCs that executed during the interval and the largest number of
+ * RPCs that were executing or queued at once. Increases take effect at
+ * once; decreases only after the load has stayed low for SHRINK_INTERVALS
+ * intervals, and then one core at a time, so that a step increase in load
+ * right after a lull still finds workers polling.
+ *
+ * \param intervalCycles
+ *      Length of the interval that just ended, in Cycles::rdtsc ticks.
+ */
+void
+WorkerManager::updateActiveCores(uint64_t intervalCycles)
+{
+    // Enough cores to keep up with the observed service time, plus one so
+    // that a new request usually finds a polling worker.
+    uint64_t needed = (busyCycles + intervalCycles - 1) / intervalCycles + 1;
+    needed = std::max(needed, uint64_t(peakDemand));
+    needed = std::min(needed, uint64_t(maxCores));
+    if (needed >= activeCores) {
+        activeCores = downCast<uint32_t>(needed);
+        lowLoadIntervals = 0;
+        return;
+    }
+    lowLoadIntervals++;
+    if (lowLoadIntervals >= SHRINK_INTERVALS) {
+        activeCores--;
+        lowLoadIntervals = 0;
+        parkIdleWorkers();
+    }
+}
+
+/**
+ * Invoked when the reply for the RPC executed by a worker is sent, to
+ * record the RPC's latency in the statistics for its class.
+ *
+ * \param worker
+ *      The worker that executed the RPC.
+ */
+void
+WorkerManager::recordCompletion(Worker* worker)
+{
+    PerfStats* stats = &PerfStats::threadStats;
+    uint64_t latency = Cycles::rdtsc() - worker->arrivalTime;
+    int bucket = std::min(BitOps::findLastSet(Cycles::toMicroseconds(latency)),
+                          PerfStats::RPC_LATENCY_BUCKETS - 1);
+    stats->rpcClassCount[worker->rpcClass]++;
+    stats->rpcClassWaitCycles[worker->rpcClass] +=
+            worker->startTime - worker->arrivalTime;
+    stats->rpcClassLatencyCycles[worker->rpcClass] += latency;
+    stats->rpcClassLatencyHistogram[worker->rpcClass][bucket]++;
+}
+
+/**
+ * Configure the order in which RPCs waiting for a thread are started, and
+ * how many BACKGROUND_RPCs may run at once. The defaults are FIFO order
+ * and no limit. Regardless of these settings, an RPC at a lower level
+ * than any running one will start as soon as possible (see canStart).
+ *
+ * \param classWeights
+ *      Empty or "fifo" means start waiting RPCs in the order they arrived
+ *      (lowest level first). "strict" means strict priority by class:
+ *      INTERACTIVE_RPC before NORMAL_RPC before BACKGROUND_RPC. Otherwise,
+ *      three positive integers separated by colons, such as "8:4:1":
+ *      the relative shares of workers for the three classes (in the order
+ *      above) when RPCs of several classes are waiting.
+ * \param backgroundLimit
+ *      If nonzero, at most this many BACKGROUND_RPCs are executed at once
+ *      (beyond that they wait, even if there are idle cores).
+ *
+ * \throw Exception
+ *      classWeights has an invalid format.
+ */
+void
+WorkerManager::setSchedulingPolicy(const string& classWeights,
+                                   uint32_t backgroundLimit)
+{
+    this->backgroundLimit = backgroundLimit;
+    if (classWeights.empty() || (classWeights == "fifo")) {
+        policy = FIFO;
+        return;
+    }
+    if (classWeights == "strict") {
+        policy = STRICT_PRIORITY;
+        return;
+    }
+    uint32_t weights[NUM_RPC_CLASSES];
+    int length = 0;
+    if ((sscanf(classWeights.c_str(), "%u:%u:%u%n", &weights[0], &weights[1],
+                &weights[2], &length) != 3) ||
+            (length != downCast<int>(classWeights.size())) ||
+            (weights[0] == 0) || (weights[1] == 0) || (weights[2] == 0)) {
+        throw Exception(HERE, format("Bad RPC class weights '%s': must be "
+                "'fifo', 'strict', or three positive integers such as "
+                "'8:4:1'", classWeights.c_str()));
+    }
+    for (int i = 0; i < NUM_RPC_CLASSES; i++) {
+        this->classWeights[i] = weights[i];
+        classPass[i] = currentPass;
+    }
+    policy = WEIGHTED;
+}
+
+/**
+ * Hand an RPC to an idle worker (the caller must update #busyThreads).
+ *
+ * \param worker
+ *      The worker that will execute the RPC.
+ * \param rpc
+ *      The RPC.
+ * \param level
+ *      RpcLevel of the RPC.
+ * \param rpcClass
+ *      RpcClass of the RPC.
+ * \param arrivalTime
+ *      Cycles::rdtsc when the RPC was received by handleRpc.
+ */
+void
+WorkerManager::startRpc(Worker* worker, Transport::ServerRpc* rpc, int level,
+                        RpcClass rpcClass, uint64_t arrivalTime)
+{
+    levels[level].requestsRunning++;
+    classRunning[rpcClass]++;
+    worker->level = level;
+    worker->rpcClass = rpcClass;
+    worker->arrivalTime = arrivalTime;
+    worker->startTime = Cycles::rdtsc();
+    worker->handoff(rpc);
+}
+
+/**
+ * Invoked when a worker finishes an RPC while other RPCs are waiting: picks
+ * the one to start next, if any may start, according to the current
+ * policy (see setSchedulingPolicy). For each class, the candidate is the
+ * oldest RPC at the lowest level where that class has RPCs waiting (this
+ * is most efficient, since it's more likely that there are other servers
+ * with resources tied up waiting for this RPC); the policy then chooses
+ * among the classes.
+ *
+ * \param worker
+ *      A worker that just finished its RPC.
+ * \param running
+ *      Number of workers executing RPCs, not counting #worker.
+ * \return
+ *      True means an RPC was handed to #worker.
+ */
+bool
+WorkerManager::startWaitingRpc(Worker* worker, size_t running)
+{
+    int candidates[NUM_RPC_CLASSES];
+    int chosen = -1;
+    for (int c = 0; c < NUM_RPC_CLASSES; c++) {
+        candidates[c] = -1;
+        if (classWaiting[c] == 0) {
+            continue;
+        }
+        for (int i = 0; i < downCast<int>(levels.size()); i++) {
+            if (levels[i].waitingRpcs[c].empty()) {
+                continue;
+            }
+            // If this RPC can't start, none at a higher level can either.
+            if (canStart(i, RpcClass(c), running)) {
+                candidates[c] = i;
+            }
+            break;
+        }
+        if (candidates[c] < 0) {
+            continue;
+        }
+        if (chosen < 0) {
+            chosen = c;
+        } else if (policy == FIFO) {
+            const Level::PendingRpc& best =
+                    levels[candidates[chosen]].waitingRpcs[chosen].front();
+            const Level::PendingRpc& next =
+                    levels[candidates[c]].waitingRpcs[c].front();
+            if ((candidates[c] < candidates[chosen]) ||
+                    ((candidates[c] == candidates[chosen]) &&
+                    (next.arrivalTime < best.arrivalTime))) {
+                chosen = c;
+            }
+        } else if ((policy == WEIGHTED) &&
+                (classPass[c] < classPass[chosen])) {
+            chosen = c;
+        }
+    }
+    if (chosen < 0) {
+        return false;
+    }
+
+    int level = candidates[chosen];
+    Level::PendingRpc pending = levels[level].waitingRpcs[chosen].front();
+    levels[level].waitingRpcs[chosen].pop();
+    classWaiting[chosen]--;
+    rpcsWaiting--;
+    if (policy == WEIGHTED) {
+        currentPass = classPass[chosen];
+        classPass[chosen] += STRIDE / classWeights[chosen];
+    }
+    startRpc(worker, pending.rpc, level, RpcClass(chosen),
+             pending.arrivalTime);
+    return true;
+}
+
 /**
  * Wait for an RPC request to appear in the testRpcs queue, but give up if
  * it takes too long.  This method is intended only for testing (it only
@@ -422,15 +886,16 @@ WorkerManager::workerMain(Worker* worker)
 
             // Wait for WorkerManager to supply us with some work to do.
             while (worker->state.load() != Worker::WORKING) {
-                if (lastIdle >= stopPollingTime) {
+                if ((lastIdle >= stopPollingTime) || worker->parkRequested) {
                     timeTrace("worker thread %d sleeping", worker->threadId);
 
-                    // It's been a long time since we've had any work to do; go
-                    // to sleep so we don't waste any more CPU cycles.  Tricky
-                    // race condition: the dispatch thread could change the
-                    // state to WORKING just before we change it to SLEEPING,
-                    // so use an atomic op and only change to SLEEPING if the
-                    // current value is POLLING.
+                    // It's been a long time since we've had any work to do
+                    // (or the WorkerManager doesn't need this thread right
+                    // now); go to sleep so we don't waste any more CPU
+                    // cycles.  Tricky race condition: the dispatch thread
+                    // could change the state to WORKING just before we
+                    // change it to SLEEPING, so use an atomic op and only
+                    // change to SLEEPING if the current value is POLLING.
                     int expected = Worker::POLLING;
                     if (worker->state.compareExchange(expected,
                                                       Worker::SLEEPING)) {
@@ -529,6 +994,7 @@ void
 Worker::handoff(Transport::ServerRpc* newRpc)
 {
     assert(rpc == NULL);
+    parkRequested = false;
     rpc = newRpc;
     Fence::leave();
 #ifdef SMTT
@@ -36,7 +36,30 @@ namespace RAMCloud {
  */
 class WorkerManager : Dispatch::Poller {
   public:
-    explicit WorkerManager(Context* context, uint32_t maxCores = 3);
+    /**
+     * Classes of RPCs, for scheduling workers: when more RPCs arrive than
+     * there are cores for, the order in which the waiting ones start
+     * depends on their classes and on the policy set with
+     * setSchedulingPolicy. The class of an RPC comes from getRpcClass.
+     */
+    enum RpcClass {
+        /// Short requests on behalf of applications, such as reads and
+        /// writes of individual objects.
+        INTERACTIVE_RPC = 0,
+
+        /// Everything that isn't in one of the other classes.
+        NORMAL_RPC = 1,
+
+        /// Long-running requests whose latency matters less than that of
+        /// the others, such as tablet migration and enumeration.
+        BACKGROUND_RPC = 2,
+
+        NUM_RPC_CLASSES = 3
+    };
+
+    explicit WorkerManager(Context* context, uint32_t maxCores = 3,
+                           bool inlineShortRpcs = false,
+                           bool elasticCores = false);
     ~WorkerManager();
 
     void exitWorker();
@@ -44,6 +67,8 @@ class WorkerManager : Dispatch::Poller {
     bool idle();
     static void init();
     int poll();
+    void setSchedulingPolicy(const string& classWeights,
+                             uint32_t backgroundLimit);
     void setServerId(ServerId serverId);
     Transport::ServerRpc* waitForRpc(double timeoutSeconds);
 
@@ -60,19 +85,58 @@ class WorkerManager : Dispatch::Poller {
     /// testing.
     static int pollMicros;
 
+    /// When #inlineShortRpcs is set, requests larger than this many bytes
+    /// are always handed to a worker.
+    static const uint32_t MAX_INLINE_REQUEST_BYTES = 256;
+
+    /// When #inlineShortRpcs is set, RPCs executed inline may use at most
+    /// this percentage of the receiving thread's time in any one window of
+    /// #inlineWindowCycles; beyond that they are handed to workers, so
+    /// a burst of reads can't keep the thread from polling the network.
+    static const uint32_t MAX_INLINE_PERCENT = 50;
+
+    /// When #elasticCores is set, #activeCores is reconsidered once per
+    /// this many microseconds.
+    static const uint32_t LOAD_INTERVAL_MICROS = 1000;
+
+    /// When #elasticCores is set, #activeCores only shrinks after the load
+    /// has been low enough for this many consecutive intervals, so that a
+    /// brief lull doesn't leave too few workers polling when load returns.
+    static const uint32_t SHRINK_INTERVALS = 20;
+
+    /// TX_PREPARE requests with more than this many operations are
+    /// considered BACKGROUND_RPCs.
+    static const uint32_t MAX_INTERACTIVE_TX_OPS = 16;
+
+    /// Used for stride scheduling under the WEIGHTED policy: each time a
+    /// class's RPC starts, the class's pass advances by this divided by the
+    /// class's weight.
+    static const uint64_t STRIDE = 1 << 20;
+
     /// Shared RAMCloud information.
     Context* context;
 
     // This class (along with the levels variable) stores information
     // for each of the levels defined by RpcLevel; if we run low on threads
-    // for servicing RPCs, we queue RPCs according to their level.
+    // for servicing RPCs, we queue RPCs according to their level and class.
     class Level {
       public:
+        /// A request waiting for a thread.
+        struct PendingRpc {
+            PendingRpc(Transport::ServerRpc* rpc, uint64_t arrivalTime)
+                : rpc(rpc)
+                , arrivalTime(arrivalTime)
+            {}
+            Transport::ServerRpc* rpc;
+            uint64_t arrivalTime;      /// Cycles::rdtsc when handleRpc
+                                       /// received the request.
+        };
         int requestsRunning;           /// The number of RPCs at this level
                                        /// that are currently executing.
-        std::queue<Transport::ServerRpc*> waitingRpcs;
+        std::queue<PendingRpc> waitingRpcs[NUM_RPC_CLASSES];
                                        /// Requests that cannot execute until
-                                       /// a thread becomes available.
+                                       /// a thread becomes available, one
+                                       /// queue per RpcClass.
         explicit Level()
             : requestsRunning(0)
             , waitingRpcs()
@@ -105,6 +169,96 @@ class WorkerManager : Dispatch::Poller {
     // queued here, not sent to workers.
     std::queue<Transport::ServerRpc*> testRpcs;
 
+    // True means short read-only RPCs are executed in the thread that
+    // received them rather than being handed to a worker; see runInline.
+    bool inlineShortRpcs;
+
+    // Length (in Cycles::rdtsc ticks) of the windows over which the time
+    // spent executing RPCs inline is limited by MAX_INLINE_PERCENT.
+    uint64_t inlineWindowCycles;
+
+    // Start of the calling thread's current inline window (rdtsc ticks),
+    // and the time it has spent executing RPCs inline since then. Per
+    // thread, since both the dispatch thread and any DispatchThreads
+    // execute RPCs inline.
+    static __thread uint64_t inlineWindowStart;
+    static __thread uint64_t inlineWindowUsed;
+
+    // True means #activeCores follows the load (see updateActiveCores);
+    // false means it stays at maxCores.
+    bool elasticCores;
+
+    // Number of worker threads that may occupy a core at once, counting
+    // both busy workers and idle ones polling for work: idle workers beyond
+    // this are asked to park (sleep on a futex, releasing their cores) as
+    // soon as they go idle. Always between 1 and maxCores. Unlike
+    // maxCores, this never delays an RPC: it grows as soon as more workers
+    // are busy, and a parked worker is woken when it's handed an RPC.
+    uint32_t activeCores;
+
+    // The first parkedWorkers entries of idleThreads have been asked to
+    // park; the others may still be polling.
+    uint32_t parkedWorkers;
+
+    // Length of a load interval (LOAD_INTERVAL_MICROS), in Cycles::rdtsc
+    // ticks.
+    uint64_t loadIntervalCycles;
+
+    // Dispatch::currentTime when the load was last sampled in poll.
+    uint64_t lastLoadSample;
+
+    // Start of the current load interval (see LOAD_INTERVAL_MICROS).
+    uint64_t loadIntervalStart;
+
+    // Integral of busyThreads.size() over the current load interval, in
+    // Cycles::rdtsc ticks: the total service time of RPCs in the interval.
+    uint64_t busyCycles;
+
+    // Largest number of RPCs that were executing or queued at once during
+    // the current load interval.
+    uint32_t peakDemand;
+
+    // Number of consecutive load intervals in which fewer than
+    // #activeCores cores would have sufficed.
+    uint32_t lowLoadIntervals;
+
+    // Ways of choosing which waiting RPC to start when a worker becomes
+    // available; see setSchedulingPolicy.
+    enum SchedulingPolicy { FIFO, STRICT_PRIORITY, WEIGHTED };
+    SchedulingPolicy policy;
+
+    // Under the WEIGHTED policy, the relative share of workers that each
+    // RpcClass gets when RPCs are waiting.
+    uint32_t classWeights[NUM_RPC_CLASSES];
+
+    // Under the WEIGHTED policy, the virtual time of each RpcClass (stride
+    // scheduling): the waiting class with the lowest pass starts next.
+    uint64_t classPass[NUM_RPC_CLASSES];
+
+    // Pass of the class whose RPC was started last; a class that had no
+    // RPCs waiting catches up to this, so it can't bank its idle time.
+    uint64_t currentPass;
+
+    // Number of RPCs of each RpcClass currently executing, and waiting
+    // for a thread.
+    uint32_t classRunning[NUM_RPC_CLASSES];
+    uint32_t classWaiting[NUM_RPC_CLASSES];
+
+    // If nonzero, at most this many BACKGROUND_RPCs may execute at once
+    // (except when needed to avoid distributed deadlock).
+    uint32_t backgroundLimit;
+
+    bool canStart(int level, RpcClass rpcClass, size_t running);
+    static RpcClass getRpcClass(WireFormat::Opcode opcode, Buffer* request);
+    void parkIdleWorkers();
+    void recordCompletion(Worker* worker);
+    bool runInline(Transport::ServerRpc* rpc, WireFormat::Opcode opcode);
+    void sampleLoad();
+    void startRpc(Worker* worker, Transport::ServerRpc* rpc, int level,
+                  RpcClass rpcClass, uint64_t arrivalTime);
+    bool startWaitingRpc(Worker* worker, size_t running);
+    void updateActiveCores(uint64_t intervalCycles);
+    static void sendReply(Transport::ServerRpc* rpc);
     static void workerMain(Worker* worker);
     static Syscall *sys;
 
@@ -138,6 +292,11 @@ class Worker {
                                        /// then.
     WireFormat::Opcode opcode;         /// Opcode value from most recent RPC.
     int level;                         /// RpcLevel of most recent RPC.
+    WorkerManager::RpcClass rpcClass;  /// RpcClass of most recent RPC.
+    uint64_t arrivalTime;              /// Cycles::rdtsc when the most recent
+                                       /// RPC was received by handleRpc.
+    uint64_t startTime;                /// Cycles::rdtsc when the most recent
+                                       /// RPC was handed to this worker.
     Transport::ServerRpc* rpc;         /// RPC being serviced by this worker.
                                        /// NULL means the last RPC given to
                                        /// the worker has been finished and a
@@ -183,6 +342,10 @@ class Worker {
     };
     bool exited;                       /// True means the worker is no longer
                                        /// running.
+    volatile bool parkRequested;       /// Set by the dispatch thread to ask
+                                       /// an idle worker to go to SLEEPING
+                                       /// right away instead of polling
+                                       /// first; cleared by #handoff.
 
     explicit Worker(Context* context)
             : context(context)
@@ -190,10 +353,14 @@ class Worker {
             , threadId(0)
             , opcode(WireFormat::Opcode::ILLEGAL_RPC_TYPE)
             , level(0)
+            , rpcClass(WorkerManager::NORMAL_RPC)
+            , arrivalTime(0)
+            , startTime(0)
             , rpc(NULL)
             , busyIndex(-1)
             , state(POLLING)
-            , exited(false),
+            , exited(false)
+            , parkRequested(false),
             threadWork(&ReadThreadingCost_MetricSet::threadWork, false)
         {}
     void exit();
@@ -18,6 +18,7 @@
 #include "MockService.h"
 #include "MockSyscall.h"
 #include "MockTransport.h"
+#include "PerfStats.h"
 #include "RpcLevel.h"
 #include "Tub.h"
 #include "WorkerManager.h"
@@ -137,6 +138,52 @@ TEST_F(WorkerManagerTest, destructor_cleanupThreads) {
                 "workerMain: exiting", TestLog::get());
 }
 
+TEST_F(WorkerManagerTest, canStart) {
+    manager->levels[1].requestsRunning = 1;
+    EXPECT_TRUE(manager->canStart(2, WorkerManager::NORMAL_RPC, 1));
+
+    // At the core limit, only RPCs below all running ones may start.
+    EXPECT_FALSE(manager->canStart(2, WorkerManager::NORMAL_RPC, 2));
+    EXPECT_FALSE(manager->canStart(1, WorkerManager::NORMAL_RPC, 2));
+    EXPECT_TRUE(manager->canStart(0, WorkerManager::NORMAL_RPC, 2));
+
+    // Same for background RPCs once their limit is reached.
+    manager->backgroundLimit = 1;
+    EXPECT_TRUE(manager->canStart(2, WorkerManager::BACKGROUND_RPC, 1));
+    manager->classRunning[WorkerManager::BACKGROUND_RPC] = 1;
+    EXPECT_FALSE(manager->canStart(2, WorkerManager::BACKGROUND_RPC, 1));
+    EXPECT_TRUE(manager->canStart(0, WorkerManager::BACKGROUND_RPC, 1));
+    EXPECT_TRUE(manager->canStart(2, WorkerManager::INTERACTIVE_RPC, 1));
+    manager->classRunning[WorkerManager::BACKGROUND_RPC] = 0;
+    manager->levels[1].requestsRunning = 0;
+}
+
+TEST_F(WorkerManagerTest, getRpcClass) {
+    Buffer request;
+    EXPECT_EQ(WorkerManager::INTERACTIVE_RPC,
+            WorkerManager::getRpcClass(WireFormat::READ, &request));
+    EXPECT_EQ(WorkerManager::INTERACTIVE_RPC,
+            WorkerManager::getRpcClass(WireFormat::MULTI_OP, &request));
+    EXPECT_EQ(WorkerManager::NORMAL_RPC,
+            WorkerManager::getRpcClass(WireFormat::BACKUP_WRITE, &request));
+    EXPECT_EQ(WorkerManager::BACKGROUND_RPC,
+            WorkerManager::getRpcClass(WireFormat::ENUMERATE, &request));
+    EXPECT_EQ(WorkerManager::BACKGROUND_RPC,
+            WorkerManager::getRpcClass(WireFormat::MIGRATE_TABLET, &request));
+
+    // Transactions are interactive unless they are large.
+    EXPECT_EQ(WorkerManager::INTERACTIVE_RPC,
+            WorkerManager::getRpcClass(WireFormat::TX_PREPARE, &request));
+    WireFormat::TxPrepare::Request* reqHdr =
+            request.emplaceAppend<WireFormat::TxPrepare::Request>();
+    reqHdr->opCount = WorkerManager::MAX_INTERACTIVE_TX_OPS;
+    EXPECT_EQ(WorkerManager::INTERACTIVE_RPC,
+            WorkerManager::getRpcClass(WireFormat::TX_PREPARE, &request));
+    reqHdr->opCount = WorkerManager::MAX_INTERACTIVE_TX_OPS + 1;
+    EXPECT_EQ(WorkerManager::BACKGROUND_RPC,
+            WorkerManager::getRpcClass(WireFormat::TX_PREPARE, &request));
+}
+
 TEST_F(WorkerManagerTest, handleRpc_noHeader) {
     TestLog::Enable _;
     MockTransport::MockServerRpc* rpc = new MockTransport::MockServerRpc(
@@ -184,10 +231,120 @@ TEST_F(WorkerManagerTest, handleRpc_deferRpc) {
             &transport, "0x10001 4");
     manager->handleRpc(rpc4);
     EXPECT_EQ(3U, manager->busyThreads.size());
-    EXPECT_EQ(1U, manager->levels[1].waitingRpcs.size());
+    EXPECT_EQ(1U, manager->levels[1].waitingRpcs[
+            WorkerManager::NORMAL_RPC].size());
     EXPECT_EQ(0, manager->levels[1].requestsRunning);
 }
 
+TEST_F(WorkerManagerTest, handleRpc_inline) {
+    manager->inlineShortRpcs = true;
+    WorkerManager::inlineWindowStart = 0;
+    uint64_t inlineRpcs = PerfStats::threadStats.inlineRpcs;
+    MockTransport::MockServerRpc* rpc = new MockTransport::MockServerRpc(
+            &transport, "0x1000d 3 4");
+    manager->handleRpc(rpc);
+    EXPECT_EQ("rpc: 0x1000d 3 4", service.log);
+    EXPECT_EQ("serverReply: 0x1000e 4 5", transport.outputLog);
+    EXPECT_EQ(0U, manager->busyThreads.size());
+    EXPECT_EQ(inlineRpcs + 1, PerfStats::threadStats.inlineRpcs);
+    EXPECT_LT(0U, WorkerManager::inlineWindowUsed);
+}
+
+TEST_F(WorkerManagerTest, handleRpc_inlineWouldBlock) {
+    uint8_t levels[WireFormat::ILLEGAL_RPC_TYPE] = {};
+    RpcLevel::levelsPtr = levels;
+    manager->inlineShortRpcs = true;
+    WorkerManager::inlineWindowStart = 0;
+    uint64_t deferred = PerfStats::threadStats.inlineRpcsDeferred;
+
+    // The handler can't finish without waiting, so the dispatch thread
+    // gives the RPC to a worker, which runs it again from the start.
+    MockTransport::MockServerRpc* rpc = new MockTransport::MockServerRpc(
+            &transport, "0x1000d 54323");
+    manager->handleRpc(rpc);
+    EXPECT_EQ(1U, manager->busyThreads.size());
+    EXPECT_EQ(deferred + 1, PerfStats::threadStats.inlineRpcsDeferred);
+    EXPECT_EQ("", transport.outputLog);
+    waitUntilDone(1);
+    manager->poll();
+    EXPECT_EQ("rpc: 0x1000d 54323, rpc: 0x1000d 54323", service.log);
+    EXPECT_EQ("serverReply: 0x1000e 54324", transport.outputLog);
+}
+
+TEST_F(WorkerManagerTest, handleRpc_inlineReadHashes) {
+    uint8_t levels[WireFormat::ILLEGAL_RPC_TYPE] = {};
+    RpcLevel::levelsPtr = levels;
+    manager->inlineShortRpcs = true;
+    WorkerManager::inlineWindowStart = 0;
+
+    // READ_HASHES always takes bucket locks, so the dispatch thread never
+    // runs it itself.
+    MockTransport::MockServerRpc* rpc = new MockTransport::MockServerRpc(
+            &transport, "0x10042 3");
+    manager->handleRpc(rpc);
+    EXPECT_EQ(1U, manager->busyThreads.size());
+    EXPECT_EQ("", transport.outputLog);
+}
+
+TEST_F(WorkerManagerTest, handleRpc_inlineDisabled) {
+    uint8_t levels[WireFormat::ILLEGAL_RPC_TYPE] = {};
+    RpcLevel::levelsPtr = levels;
+    MockTransport::MockServerRpc* rpc = new MockTransport::MockServerRpc(
+            &transport, "0x1000d 3 4");
+    manager->handleRpc(rpc);
+    EXPECT_EQ(1U, manager->busyThreads.size());
+    waitUntilDone(1);
+    manager->poll();
+    EXPECT_EQ("serverReply: 0x1000e 4 5", transport.outputLog);
+}
+
+TEST_F(WorkerManagerTest, handleRpc_inlineTooBig) {
+    uint8_t levels[WireFormat::ILLEGAL_RPC_TYPE] = {};
+    RpcLevel::levelsPtr = levels;
+    manager->inlineShortRpcs = true;
+    WorkerManager::inlineWindowStart = 0;
+    string padding(WorkerManager::MAX_INLINE_REQUEST_BYTES, 'x');
+
+    // Just short enough.
+    MockTransport::MockServerRpc* rpc = new MockTransport::MockServerRpc(
+            &transport, "0x1000d 3");
+    rpc->requestPayload.appendCopy(padding.c_str(),
+            WorkerManager::MAX_INLINE_REQUEST_BYTES - 8);
+    manager->handleRpc(rpc);
+    EXPECT_EQ(0U, manager->busyThreads.size());
+    EXPECT_NE("", transport.outputLog);
+    transport.outputLog.clear();
+
+    // One byte too many.
+    rpc = new MockTransport::MockServerRpc(&transport, "0x1000d 3");
+    rpc->requestPayload.appendCopy(padding.c_str(),
+            WorkerManager::MAX_INLINE_REQUEST_BYTES - 7);
+    manager->handleRpc(rpc);
+    EXPECT_EQ(1U, manager->busyThreads.size());
+    EXPECT_EQ("", transport.outputLog);
+}
+
+TEST_F(WorkerManagerTest, handleRpc_inlineBudgetUsedUp) {
+    uint8_t levels[WireFormat::ILLEGAL_RPC_TYPE] = {};
+    RpcLevel::levelsPtr = levels;
+    manager->inlineShortRpcs = true;
+    WorkerManager::inlineWindowStart = Cycles::rdtsc();
+    WorkerManager::inlineWindowUsed = manager->inlineWindowCycles;
+    uint64_t deferred = PerfStats::threadStats.inlineRpcsDeferred;
+    MockTransport::MockServerRpc* rpc = new MockTransport::MockServerRpc(
+            &transport, "0x1000d 3 4");
+    manager->handleRpc(rpc);
+    EXPECT_EQ(1U, manager->busyThreads.size());
+    EXPECT_EQ(deferred + 1, PerfStats::threadStats.inlineRpcsDeferred);
+
+    // Once the window has passed, RPCs run inline again.
+    WorkerManager::inlineWindowStart -= manager->inlineWindowCycles;
+    rpc = new MockTransport::MockServerRpc(&transport, "0x1000d 5 6");
+    manager->handleRpc(rpc);
+    EXPECT_EQ("serverReply: 0x1000e 6 7", transport.outputLog);
+    EXPECT_EQ(1U, manager->busyThreads.size());
+}
+
 TEST_F(WorkerManagerTest, handleRpc_handoffToWorker) {
     MockTransport::MockServerRpc* rpc1 = new MockTransport::MockServerRpc(
             &transport, "0x10000 1");
@@ -200,6 +357,30 @@ TEST_F(WorkerManagerTest, handleRpc_handoffToWorker) {
     EXPECT_EQ(5U, manager->idleThreads.size());
 }
 
+TEST_F(WorkerManagerTest, handleRpc_wakeParkedWorker) {
+    manager->elasticCores = true;
+    manager->activeCores = 1;
+    manager->parkIdleWorkers();
+    EXPECT_EQ(4U, manager->parkedWorkers);
+
+    // The first RPC goes to the worker that is still polling.
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 1"));
+    EXPECT_EQ(4U, manager->parkedWorkers);
+    EXPECT_EQ(1U, manager->activeCores);
+
+    // The second has to wake a parked worker, and more cores are needed.
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 2"));
+    EXPECT_EQ(3U, manager->parkedWorkers);
+    EXPECT_EQ(2U, manager->activeCores);
+    EXPECT_FALSE(manager->busyThreads[1]->parkRequested);
+    waitUntilDone(2);
+    manager->poll();
+    EXPECT_EQ(5U, manager->idleThreads.size());
+    EXPECT_EQ(3U, manager->parkedWorkers);
+}
+
 TEST_F(WorkerManagerTest, idle) {
     EXPECT_TRUE(manager->idle());
     // Start one RPC.
@@ -230,8 +411,10 @@ TEST_F(WorkerManagerTest, poll_scheduleWaitingRpcs) {
     manager->handleRpc(rpc3);
     manager->handleRpc(rpc4);
     EXPECT_EQ(2, manager->levels[0].requestsRunning);
-    EXPECT_EQ(1U, manager->levels[1].waitingRpcs.size());
-    EXPECT_EQ(1U, manager->levels[2].waitingRpcs.size());
+    EXPECT_EQ(1U, manager->levels[1].waitingRpcs[
+            WorkerManager::NORMAL_RPC].size());
+    EXPECT_EQ(1U, manager->levels[2].waitingRpcs[
+            WorkerManager::NORMAL_RPC].size());
 
     // Allow the original requests to complete, and make sure that the
     // remaining 2 start service in the right order (e.g., the level
@@ -241,7 +424,8 @@ TEST_F(WorkerManagerTest, poll_scheduleWaitingRpcs) {
     EXPECT_EQ(1, manager->poll());
     EXPECT_EQ(1, manager->levels[0].requestsRunning);
     EXPECT_EQ(1, manager->levels[1].requestsRunning);
-    EXPECT_EQ(0U, manager->levels[1].waitingRpcs.size());
+    EXPECT_EQ(0U, manager->levels[1].waitingRpcs[
+            WorkerManager::NORMAL_RPC].size());
     EXPECT_EQ("serverReply: 0x10001 2", transport.outputLog);
     EXPECT_EQ(1, manager->rpcsWaiting);
     service.gate = 2;
@@ -249,7 +433,8 @@ TEST_F(WorkerManagerTest, poll_scheduleWaitingRpcs) {
     EXPECT_EQ(1, manager->poll());
     EXPECT_EQ(0, manager->levels[0].requestsRunning);
     EXPECT_EQ(1, manager->levels[2].requestsRunning);
-    EXPECT_EQ(0U, manager->levels[2].waitingRpcs.size());
+    EXPECT_EQ(0U, manager->levels[2].waitingRpcs[
+            WorkerManager::NORMAL_RPC].size());
     EXPECT_EQ("serverReply: 0x10001 2 | serverReply: 0x10001 3",
             transport.outputLog);
 
@@ -287,7 +472,8 @@ TEST_F(WorkerManagerTest, poll_avoidDeadlock) {
     EXPECT_EQ(1, manager->levels[0].requestsRunning);
     EXPECT_EQ(0, manager->levels[1].requestsRunning);
     EXPECT_EQ(2, manager->levels[2].requestsRunning);
-    EXPECT_EQ(1U, manager->levels[1].waitingRpcs.size());
+    EXPECT_EQ(1U, manager->levels[1].waitingRpcs[
+            WorkerManager::NORMAL_RPC].size());
 
     // Allow rpc3 (level 0) to complete, and make sure rpc4 (level 1) starts.
     service.gate = 3;
@@ -295,7 +481,8 @@ TEST_F(WorkerManagerTest, poll_avoidDeadlock) {
     EXPECT_EQ(1, manager->poll());
     EXPECT_EQ(0, manager->levels[0].requestsRunning);
     EXPECT_EQ(1, manager->levels[1].requestsRunning);
-    EXPECT_EQ(0U, manager->levels[1].waitingRpcs.size());
+    EXPECT_EQ(0U, manager->levels[1].waitingRpcs[
+            WorkerManager::NORMAL_RPC].size());
     EXPECT_EQ("serverReply: 0x10001 4", transport.outputLog);
     EXPECT_EQ(0, manager->rpcsWaiting);
 
@@ -334,7 +521,8 @@ TEST_F(WorkerManagerTest, poll_coreLimit) {
     EXPECT_EQ(1, manager->levels[0].requestsRunning);
     EXPECT_EQ(0, manager->levels[1].requestsRunning);
     EXPECT_EQ(2, manager->levels[2].requestsRunning);
-    EXPECT_EQ(1U, manager->levels[1].waitingRpcs.size());
+    EXPECT_EQ(1U, manager->levels[1].waitingRpcs[
+            WorkerManager::NORMAL_RPC].size());
 
     // Allow rpc1 (level 2) to complete, and make sure rpc4 (level 1)
     // doesn't start.
@@ -343,7 +531,8 @@ TEST_F(WorkerManagerTest, poll_coreLimit) {
     EXPECT_EQ(1, manager->poll());
     EXPECT_EQ(1, manager->levels[0].requestsRunning);
     EXPECT_EQ(0, manager->levels[1].requestsRunning);
-    EXPECT_EQ(1U, manager->levels[1].waitingRpcs.size());
+    EXPECT_EQ(1U, manager->levels[1].waitingRpcs[
+            WorkerManager::NORMAL_RPC].size());
     EXPECT_EQ("serverReply: 0x10003 2", transport.outputLog);
     EXPECT_EQ(1, manager->rpcsWaiting);
 
@@ -354,7 +543,8 @@ TEST_F(WorkerManagerTest, poll_coreLimit) {
     EXPECT_EQ(1, manager->poll());
     EXPECT_EQ(1, manager->levels[0].requestsRunning);
     EXPECT_EQ(1, manager->levels[1].requestsRunning);
-    EXPECT_EQ(0U, manager->levels[1].waitingRpcs.size());
+    EXPECT_EQ(0U, manager->levels[1].waitingRpcs[
+            WorkerManager::NORMAL_RPC].size());
     EXPECT_EQ("serverReply: 0x10003 3", transport.outputLog);
     EXPECT_EQ(0, manager->rpcsWaiting);
 
@@ -372,6 +562,124 @@ TEST_F(WorkerManagerTest, poll_coreLimit) {
     EXPECT_EQ(0, manager->poll());
 }
 
+TEST_F(WorkerManagerTest, poll_backgroundLimit) {
+    uint8_t levels[WireFormat::ILLEGAL_RPC_TYPE] = {};
+    RpcLevel::levelsPtr = levels;
+    manager->setSchedulingPolicy("fifo", 1);
+    service.gate = -1;
+
+    // The second ENUMERATE waits even though a core is available, but
+    // other RPCs can still use that core.
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10016 1"));
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10016 2"));
+    EXPECT_EQ(1U, manager->busyThreads.size());
+    EXPECT_EQ(1U, manager->levels[0].waitingRpcs[
+            WorkerManager::BACKGROUND_RPC].size());
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 3"));
+    EXPECT_EQ(2U, manager->busyThreads.size());
+    EXPECT_EQ(1U, manager->classRunning[WorkerManager::BACKGROUND_RPC]);
+    EXPECT_EQ(1U, manager->classRunning[WorkerManager::NORMAL_RPC]);
+
+    // When the normal RPC finishes, the limit still holds.
+    service.gate = 3;
+    waitUntilDone(1);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_EQ("serverReply: 0x10001 4", transport.outputLog);
+    EXPECT_EQ(1, manager->rpcsWaiting);
+    EXPECT_EQ(1U, manager->busyThreads.size());
+
+    // Once the first ENUMERATE finishes, the second one starts.
+    transport.outputLog.clear();
+    service.gate = 1;
+    waitUntilDone(1);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_EQ("serverReply: 0x10017 2", transport.outputLog);
+    EXPECT_EQ(0, manager->rpcsWaiting);
+    EXPECT_EQ(1U, manager->classRunning[WorkerManager::BACKGROUND_RPC]);
+    EXPECT_EQ(0U, manager->classWaiting[WorkerManager::BACKGROUND_RPC]);
+
+    service.gate = 0;
+    waitUntilDone(1);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_TRUE(manager->idle());
+}
+
+TEST_F(WorkerManagerTest, poll_strictPriority) {
+    uint8_t levels[WireFormat::ILLEGAL_RPC_TYPE] = {};
+    RpcLevel::levelsPtr = levels;
+    manager->setSchedulingPolicy("strict", 0);
+    service.gate = -1;
+
+    // Occupy both cores, then queue one RPC of each class, lowest
+    // priority first.
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 1"));
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 2"));
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10016 3"));
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 4"));
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x1000d 5"));
+    EXPECT_EQ(3, manager->rpcsWaiting);
+    EXPECT_EQ(1U, manager->classWaiting[WorkerManager::INTERACTIVE_RPC]);
+
+    // They start in priority order.
+    service.gate = 1;
+    waitUntilDone(1);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_EQ(1U, manager->classRunning[WorkerManager::INTERACTIVE_RPC]);
+    EXPECT_EQ(0U, manager->classWaiting[WorkerManager::INTERACTIVE_RPC]);
+    service.gate = 5;
+    waitUntilDone(1);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_EQ(1U, manager->classWaiting[WorkerManager::BACKGROUND_RPC]);
+    EXPECT_EQ(0U, manager->classWaiting[WorkerManager::NORMAL_RPC]);
+    service.gate = 2;
+    waitUntilDone(1);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_EQ("serverReply: 0x10001 2 | serverReply: 0x1000e 6 | "
+            "serverReply: 0x10001 3", transport.outputLog);
+    EXPECT_EQ(0, manager->rpcsWaiting);
+
+    service.gate = 0;
+    waitUntilDone(2);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_TRUE(manager->idle());
+}
+
+TEST_F(WorkerManagerTest, poll_fifoAcrossClasses) {
+    uint8_t levels[WireFormat::ILLEGAL_RPC_TYPE] = {};
+    RpcLevel::levelsPtr = levels;
+    service.gate = -1;
+
+    // By default, a background RPC that arrived first starts first.
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 1"));
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 2"));
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10016 3"));
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x1000d 4"));
+    service.gate = 1;
+    waitUntilDone(1);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_EQ(1U, manager->classRunning[WorkerManager::BACKGROUND_RPC]);
+    EXPECT_EQ(1U, manager->classWaiting[WorkerManager::INTERACTIVE_RPC]);
+
+    service.gate = 0;
+    waitUntilDone(2);
+    EXPECT_EQ(1, manager->poll());
+    waitUntilDone(1);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_TRUE(manager->idle());
+}
+
 TEST_F(WorkerManagerTest, poll_postprocessing) {
     // This test makes sure that the POSTPROCESSING state is handled
     // correctly (along with the subsequent POLLING state).
@@ -400,6 +708,200 @@ TEST_F(WorkerManagerTest, poll_postprocessing) {
     EXPECT_EQ(4U, manager->idleThreads.size());
 }
 
+TEST_F(WorkerManagerTest, poll_parkIdleWorkers) {
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 1"));
+    waitUntilDone(1);
+    manager->poll();
+    EXPECT_EQ(0U, manager->parkedWorkers);
+
+    manager->elasticCores = true;
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 2"));
+    waitUntilDone(1);
+    manager->poll();
+    EXPECT_EQ(3U, manager->parkedWorkers);
+    EXPECT_TRUE(manager->idleThreads[0]->parkRequested);
+    EXPECT_TRUE(manager->idleThreads[2]->parkRequested);
+    EXPECT_FALSE(manager->idleThreads[3]->parkRequested);
+    EXPECT_FALSE(manager->idleThreads[4]->parkRequested);
+
+    // A parked worker goes to sleep right away.
+    Worker* worker = manager->idleThreads[0];
+    // See "Timing-Dependent Tests" in designNotes.
+    for (int i = 0; i < 1000; i++) {
+        if (worker->state.load() == Worker::SLEEPING) {
+            break;
+        }
+        usleep(100);
+    }
+    EXPECT_EQ(Worker::SLEEPING, worker->state.load());
+}
+
+TEST_F(WorkerManagerTest, sampleLoad) {
+    manager->elasticCores = true;
+    manager->activeCores = 1;
+    uint64_t start = manager->lastLoadSample;
+    uint64_t coreCycles = PerfStats::threadStats.workerCoreCycles;
+
+    // Times before the last sample are ignored.
+    context.dispatch->currentTime = start - 1;
+    manager->rpcsWaiting = 3;
+    manager->sampleLoad();
+    EXPECT_EQ(start, manager->lastLoadSample);
+    EXPECT_EQ(0U, manager->peakDemand);
+
+    context.dispatch->currentTime = start + 100;
+    manager->sampleLoad();
+    EXPECT_EQ(coreCycles + 100, PerfStats::threadStats.workerCoreCycles);
+    EXPECT_EQ(3U, manager->peakDemand);
+    EXPECT_EQ(1U, manager->activeCores);
+
+    // End of the interval: the queued RPCs called for more cores.
+    context.dispatch->currentTime = start + manager->loadIntervalCycles;
+    manager->rpcsWaiting = 0;
+    manager->sampleLoad();
+    EXPECT_EQ(2U, manager->activeCores);
+    EXPECT_EQ(0U, manager->peakDemand);
+    EXPECT_EQ(start + manager->loadIntervalCycles,
+            manager->loadIntervalStart);
+}
+
+TEST_F(WorkerManagerTest, updateActiveCores) {
+    manager->elasticCores = true;
+    manager->activeCores = 1;
+
+    // Busy for 1.5 intervals: 2 cores plus a spare, but maxCores is 2.
+    manager->busyCycles = 1500;
+    manager->updateActiveCores(1000);
+    EXPECT_EQ(2U, manager->activeCores);
+
+    // No load: shrink, but only after a while.
+    manager->busyCycles = 0;
+    for (uint32_t i = 1; i < WorkerManager::SHRINK_INTERVALS; i++) {
+        manager->updateActiveCores(1000);
+    }
+    EXPECT_EQ(2U, manager->activeCores);
+    EXPECT_EQ(0U, manager->parkedWorkers);
+    manager->updateActiveCores(1000);
+    EXPECT_EQ(1U, manager->activeCores);
+    EXPECT_EQ(4U, manager->parkedWorkers);
+
+    // Requests executing or queued at once count too.
+    manager->peakDemand = 2;
+    manager->updateActiveCores(1000);
+    EXPECT_EQ(2U, manager->activeCores);
+    EXPECT_EQ(0U, manager->lowLoadIntervals);
+}
+
+TEST_F(WorkerManagerTest, recordCompletion) {
+    PerfStats* stats = &PerfStats::threadStats;
+    uint64_t count = stats->rpcClassCount[WorkerManager::BACKGROUND_RPC];
+    uint64_t wait = stats->rpcClassWaitCycles[WorkerManager::BACKGROUND_RPC];
+    uint64_t latency =
+            stats->rpcClassLatencyCycles[WorkerManager::BACKGROUND_RPC];
+    uint64_t bucket7 =
+            stats->rpcClassLatencyHistogram[WorkerManager::BACKGROUND_RPC][7];
+    uint64_t lastBucket = stats->rpcClassLatencyHistogram[
+            WorkerManager::BACKGROUND_RPC][PerfStats::RPC_LATENCY_BUCKETS-1];
+
+    Worker* worker = manager->idleThreads.back();
+    worker->rpcClass = WorkerManager::BACKGROUND_RPC;
+    Cycles::mockTscValue = Cycles::fromMicroseconds(10000000);
+    worker->arrivalTime = Cycles::mockTscValue - Cycles::fromMicroseconds(100);
+    worker->startTime = worker->arrivalTime + 1000;
+    manager->recordCompletion(worker);
+    EXPECT_EQ(count + 1,
+            stats->rpcClassCount[WorkerManager::BACKGROUND_RPC]);
+    EXPECT_EQ(wait + 1000,
+            stats->rpcClassWaitCycles[WorkerManager::BACKGROUND_RPC]);
+    EXPECT_EQ(latency + Cycles::fromMicroseconds(100),
+            stats->rpcClassLatencyCycles[WorkerManager::BACKGROUND_RPC]);
+    EXPECT_EQ(bucket7 + 1,
+            stats->rpcClassLatencyHistogram[WorkerManager::BACKGROUND_RPC][7]);
+
+    // Very slow RPCs go in the last bucket.
+    worker->arrivalTime = 0;
+    manager->recordCompletion(worker);
+    EXPECT_EQ(lastBucket + 1, stats->rpcClassLatencyHistogram[
+            WorkerManager::BACKGROUND_RPC][PerfStats::RPC_LATENCY_BUCKETS-1]);
+    Cycles::mockTscValue = 0;
+}
+
+TEST_F(WorkerManagerTest, setSchedulingPolicy) {
+    manager->setSchedulingPolicy("strict", 3);
+    EXPECT_EQ(WorkerManager::STRICT_PRIORITY, manager->policy);
+    EXPECT_EQ(3U, manager->backgroundLimit);
+    manager->currentPass = 100;
+    manager->setSchedulingPolicy("8:4:1", 0);
+    EXPECT_EQ(WorkerManager::WEIGHTED, manager->policy);
+    EXPECT_EQ(8U, manager->classWeights[WorkerManager::INTERACTIVE_RPC]);
+    EXPECT_EQ(1U, manager->classWeights[WorkerManager::BACKGROUND_RPC]);
+    EXPECT_EQ(100U, manager->classPass[WorkerManager::NORMAL_RPC]);
+    EXPECT_EQ(0U, manager->backgroundLimit);
+    manager->setSchedulingPolicy("", 0);
+    EXPECT_EQ(WorkerManager::FIFO, manager->policy);
+    manager->setSchedulingPolicy("strict", 0);
+    manager->setSchedulingPolicy("fifo", 0);
+    EXPECT_EQ(WorkerManager::FIFO, manager->policy);
+
+    const char* bad[] = {"8:4", "8:0:1", "8:4:1x", "priority"};
+    foreach (const char* weights, bad) {
+        string message;
+        try {
+            manager->setSchedulingPolicy(weights, 0);
+        } catch (Exception& e) {
+            message = e.message;
+        }
+        EXPECT_EQ(format("Bad RPC class weights '%s': must be 'fifo', "
+                "'strict', or three positive integers such as '8:4:1'",
+                weights), message);
+    }
+    EXPECT_EQ(WorkerManager::FIFO, manager->policy);
+}
+
+TEST_F(WorkerManagerTest, startWaitingRpc_weighted) {
+    uint8_t levels[WireFormat::ILLEGAL_RPC_TYPE] = {};
+    RpcLevel::levelsPtr = levels;
+    manager->setSchedulingPolicy("4:2:1", 0);
+    service.gate = -1;
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 1"));
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10000 2"));
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x1000d 3"));
+    manager->handleRpc(new MockTransport::MockServerRpc(
+            &transport, "0x10016 4"));
+
+    // Pretend a core is free. The background class has been served least
+    // (relative to its weight), so it goes first.
+    manager->classPass[WorkerManager::INTERACTIVE_RPC] = 5;
+    manager->classPass[WorkerManager::BACKGROUND_RPC] = 2;
+    Worker* worker = manager->idleThreads.back();
+    manager->idleThreads.pop_back();
+    worker->busyIndex = downCast<int>(manager->busyThreads.size());
+    manager->busyThreads.push_back(worker);
+    EXPECT_TRUE(manager->startWaitingRpc(worker, 1));
+    EXPECT_EQ(1U, manager->classRunning[WorkerManager::BACKGROUND_RPC]);
+    EXPECT_EQ(2U, manager->currentPass);
+    EXPECT_EQ(2 + WorkerManager::STRIDE,
+            manager->classPass[WorkerManager::BACKGROUND_RPC]);
+
+    // Nothing else may start until an RPC finishes.
+    EXPECT_FALSE(manager->startWaitingRpc(manager->idleThreads.back(), 3));
+    EXPECT_EQ(1, manager->rpcsWaiting);
+
+    service.gate = 0;
+    for (int i = 0; (i < 1000) && !manager->idle(); i++) {
+        manager->poll();
+        usleep(1000);
+    }
+    EXPECT_TRUE(manager->idle());
+    EXPECT_EQ(5 + WorkerManager::STRIDE/4,
+            manager->classPass[WorkerManager::INTERACTIVE_RPC]);
+}
+
 // No tests for waitForRpc: this method is only used in tests.
 
 TEST_F(WorkerManagerTest, workerMain_goToSleep) {
@@ -39,6 +39,8 @@ bool WorkerTimer::disableTimerHandlers = false;
 WorkerTimer::WorkerTimer(Dispatch* dispatch)
     : manager(NULL)
     , triggerTime(0)
+    , slot(-1)
+    , links()
     , startTime(0)
     , active(false)
     , handlerRunning(false)
@@ -103,7 +105,9 @@ WorkerTimer::start(uint64_t rdtscTime)
     // Drop the existing entries first (see WorkerTimer::Manager::activeTimers
     // and WorkerTimer::Manager::runnableTimers).
     if (active) {
-        manager->activeTimers.erase(this);
+        if (slot >= 0) {
+            manager->activeTimers.remove(this);
+        }
         manager->runnableTimers.erase(this);
     }
     triggerTime = rdtscTime;
@@ -155,7 +159,9 @@ void WorkerTimer::stopInternal(Lock& lock)
         }
     }
     if (active) {
-        manager->activeTimers.erase(this);
+        if (slot >= 0) {
+            manager->activeTimers.remove(this);
+        }
         manager->runnableTimers.erase(this);
         active = false;
         if (manager->activeTimers.empty()) {
@@ -203,7 +209,7 @@ WorkerTimer::Manager::Manager(Dispatch* dispatch, Lock& lock)
     , waitingForWork()
     , checkTimerCount(0)
     , checkTimersDone()
-    , activeTimers()
+    , activeTimers(Cycles::rdtsc())
     , runnableTimers()
     , logProtectorActivity()
     , links()
@@ -306,13 +312,13 @@ void WorkerTimer::Manager::checkTimers(Lock& lock)
             break;
         }
 
-        // Scan the list of active timers to find all timers that are ready
-        // to run and pick the runnable timer that has been waiting the longest
-        // (this prevents starvation).
-        Manager::ActiveTimerList::iterator it = activeTimers.begin();
-        while (it != activeTimers.end() && (*it)->triggerTime <= now) {
-            runnableTimers.insert(*it);
-            it = activeTimers.erase(it);
+        // Find all active timers that are ready to run and pick the
+        // runnable timer that has been waiting the longest (this prevents
+        // starvation).
+        activeTimers.advance(now);
+        WorkerTimer* expired;
+        while ((expired = activeTimers.popExpired()) != NULL) {
+            runnableTimers.insert(expired);
         }
         if (!runnableTimers.empty()) {
             // Pull the runnable timer that has been waiting the longest
@@ -325,7 +331,7 @@ void WorkerTimer::Manager::checkTimers(Lock& lock)
             // again when the next timer is ready (if any).
             earliestTriggerTime = ~0lu;
             if (!activeTimers.empty()) {
-                earliestTriggerTime = (*activeTimers.begin())->triggerTime;
+                earliestTriggerTime = activeTimers.nextCheckTime();
                 start(earliestTriggerTime);
             }
             break;
@@ -24,6 +24,7 @@
 #include "BoostIntrusive.h"
 #include "Dispatch.h"
 #include "LogProtector.h"
+#include "TimerWheel.h"
 
 namespace RAMCloud {
 
@@ -63,9 +64,19 @@ class WorkerTimer {
 
     /// If the timer is running it will be invoked as soon as #rdtsc
     /// returns a value greater or equal to this. This value is only
-    /// valid if slot >= 0.
+    /// valid if #active.
     uint64_t triggerTime;
 
+    /// Location of this timer in Manager::activeTimers; <0 means it isn't
+    /// there.
+    int slot;
+
+    /// Used to link this timer into Manager::activeTimers.
+    IntrusiveListHook links;
+
+    // Must precede Manager, whose activeTimers needs access to #links.
+    friend class TimerWheel<WorkerTimer>;
+
     /// The #rdtsc time when start was last called on this timer.
     uint64_t startTime;
 
@@ -148,22 +159,13 @@ class WorkerTimer {
         };
 
         /// Keeps track of all of the timers that are currently active (i.e.
-        /// start has been called, but the timer hasn't actually fired) sorted
-        /// by their triggerTime.  Sorting by triggerTime allows the manager to
+        /// start has been called, but the timer hasn't actually fired),
+        /// organized by their triggerTime so that the manager can
         /// efficiently select runnable timers (see runnableTimers).
         ///
-        /// WARNING: A WorkerTimer must be removed from the ActiveTimerList
-        ////before its triggerTime is updated.  This is because of the intrusive
-        /// SortByTriggerTime comparison operator.
-        struct SortByTriggerTime {
-            bool operator()(WorkerTimer* lhs, WorkerTimer* rhs)
-            {
-                return lhs->triggerTime < rhs->triggerTime ||
-                        (lhs->triggerTime == rhs->triggerTime && lhs < rhs);
-            }
-        };
-        typedef std::set<WorkerTimer*, SortByTriggerTime> ActiveTimerList;
-        ActiveTimerList activeTimers;
+        /// WARNING: A WorkerTimer must be removed from activeTimers before
+        /// its triggerTime is updated.
+        TimerWheel<WorkerTimer> activeTimers;
 
         /// Keeps track of all of the timers that are currently runnable (i.e.
         /// the triggerTime has elapsed) in sorted by their startTime.  This